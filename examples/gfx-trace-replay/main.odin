@@ -0,0 +1,98 @@
+//------------------------------------------------------------------------------
+//  gfx-trace-replay/main.odin
+//
+//  Replays a sokol_gfx_trace.h capture file in a loop and prints the
+//  average CPU time spent in the replayed sokol-gfx calls per frame.
+//
+//  Usage: odin run ../examples/gfx-trace-replay -debug -- capture.sgtrace
+//------------------------------------------------------------------------------
+package main
+
+import "base:runtime"
+import "core:fmt"
+import "core:os"
+import slog "../../sokol/log"
+import sg "../../sokol/gfx"
+import sapp "../../sokol/app"
+import sglue "../../sokol/glue"
+import stm "../../sokol/time"
+import sgtrace "../../sokol/gfx_trace"
+
+state: struct {
+    replaying: bool,
+    frame_count: int,
+    accum_ticks: u64,
+}
+
+// print the average frame time after this number of replayed frames
+NUM_TIMED_FRAMES :: 600
+
+init :: proc "c" () {
+    context = runtime.default_context()
+    sg.setup({
+        environment = sglue.environment(),
+        logger = { func = slog.func },
+    })
+    stm.setup()
+
+    if len(os.args) < 2 {
+        fmt.println("usage: gfx-trace-replay [capture file]")
+        sapp.request_quit()
+        return
+    }
+    data, ok := os.read_entire_file(os.args[1])
+    if !ok {
+        fmt.println("failed to load", os.args[1])
+        sapp.request_quit()
+        return
+    }
+    defer delete(data)
+    // the capture data is copied into sokol_gfx_trace.h
+    state.replaying = sgtrace.begin_replay({
+        data = { ptr = raw_data(data), size = len(data) },
+        logger = { func = slog.func },
+    })
+    if !state.replaying {
+        sapp.request_quit()
+        return
+    }
+    fmt.printfln(">> replaying %d captured frame(s) from %s", sgtrace.replay_num_frames(), os.args[1])
+}
+
+frame :: proc "c" () {
+    context = runtime.default_context()
+    if !state.replaying {
+        return
+    }
+    start := stm.now()
+    sgtrace.replay_frame(sglue.swapchain())
+    sg.commit()
+    state.accum_ticks += stm.since(start)
+    state.frame_count += 1
+    if state.frame_count == NUM_TIMED_FRAMES {
+        fmt.printfln(">> avg frame time: %.3f ms", stm.ms(state.accum_ticks) / NUM_TIMED_FRAMES)
+        state.frame_count = 0
+        state.accum_ticks = 0
+    }
+}
+
+cleanup :: proc "c" () {
+    context = runtime.default_context()
+    if state.replaying {
+        sgtrace.end_replay()
+    }
+    sg.shutdown()
+}
+
+main :: proc() {
+    sapp.run({
+        init_cb = init,
+        frame_cb = frame,
+        cleanup_cb = cleanup,
+        width = 800,
+        height = 600,
+        window_title = "gfx-trace-replay",
+        icon = { sokol_default = true },
+        logger = { func = slog.func },
+    })
+}
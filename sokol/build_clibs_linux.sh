@@ -32,6 +32,11 @@ build_lib_x64_release sokol_glue        glue/sokol_glue_linux_x64_gl_release SOK
 build_lib_x64_release sokol_time        time/sokol_time_linux_x64_gl_release SOKOL_GLCORE
 build_lib_x64_release sokol_audio       audio/sokol_audio_linux_x64_gl_release SOKOL_GLCORE
 build_lib_x64_release sokol_debugtext   debugtext/sokol_debugtext_linux_x64_gl_release SOKOL_GLCORE
+build_lib_x64_release sokol_gfx_trace   gfx_trace/sokol_gfx_trace_linux_x64_gl_release SOKOL_GLCORE
+build_lib_x64_release sokol_profiler    profiler/sokol_profiler_linux_x64_gl_release SOKOL_GLCORE
+build_lib_x64_release sokol_render_graph render_graph/sokol_render_graph_linux_x64_gl_release SOKOL_GLCORE
+build_lib_x64_release sokol_draw_queue  draw_queue/sokol_draw_queue_linux_x64_gl_release SOKOL_GLCORE
+build_lib_x64_release sokol_gpu_cull    gpu_cull/sokol_gpu_cull_linux_x64_gl_release SOKOL_GLCORE
 build_lib_x64_release sokol_shape       shape/sokol_shape_linux_x64_gl_release SOKOL_GLCORE
 build_lib_x64_release sokol_gl          gl/sokol_gl_linux_x64_gl_release SOKOL_GLCORE
 
@@ -43,6 +48,11 @@ build_lib_x64_debug sokol_glue          glue/sokol_glue_linux_x64_gl_debug SOKOL
 build_lib_x64_debug sokol_time          time/sokol_time_linux_x64_gl_debug SOKOL_GLCORE
 build_lib_x64_debug sokol_audio         audio/sokol_audio_linux_x64_gl_debug SOKOL_GLCORE
 build_lib_x64_debug sokol_debugtext     debugtext/sokol_debugtext_linux_x64_gl_debug SOKOL_GLCORE
+build_lib_x64_debug sokol_gfx_trace     gfx_trace/sokol_gfx_trace_linux_x64_gl_debug SOKOL_GLCORE
+build_lib_x64_debug sokol_profiler      profiler/sokol_profiler_linux_x64_gl_debug SOKOL_GLCORE
+build_lib_x64_debug sokol_render_graph  render_graph/sokol_render_graph_linux_x64_gl_debug SOKOL_GLCORE
+build_lib_x64_debug sokol_draw_queue    draw_queue/sokol_draw_queue_linux_x64_gl_debug SOKOL_GLCORE
+build_lib_x64_debug sokol_gpu_cull      gpu_cull/sokol_gpu_cull_linux_x64_gl_debug SOKOL_GLCORE
 build_lib_x64_debug sokol_shape         shape/sokol_shape_linux_x64_gl_debug SOKOL_GLCORE
 build_lib_x64_debug sokol_gl            gl/sokol_gl_linux_x64_gl_debug SOKOL_GLCORE
 
@@ -44,6 +44,11 @@ build_lib_arm64_release sokol_glue        glue/sokol_glue_macos_arm64_metal_rele
 build_lib_arm64_release sokol_time        time/sokol_time_macos_arm64_metal_release SOKOL_METAL
 build_lib_arm64_release sokol_audio       audio/sokol_audio_macos_arm64_metal_release SOKOL_METAL
 build_lib_arm64_release sokol_debugtext   debugtext/sokol_debugtext_macos_arm64_metal_release SOKOL_METAL
+build_lib_arm64_release sokol_gfx_trace   gfx_trace/sokol_gfx_trace_macos_arm64_metal_release SOKOL_METAL
+build_lib_arm64_release sokol_profiler    profiler/sokol_profiler_macos_arm64_metal_release SOKOL_METAL
+build_lib_arm64_release sokol_render_graph render_graph/sokol_render_graph_macos_arm64_metal_release SOKOL_METAL
+build_lib_arm64_release sokol_draw_queue  draw_queue/sokol_draw_queue_macos_arm64_metal_release SOKOL_METAL
+build_lib_arm64_release sokol_gpu_cull    gpu_cull/sokol_gpu_cull_macos_arm64_metal_release SOKOL_METAL
 build_lib_arm64_release sokol_shape       shape/sokol_shape_macos_arm64_metal_release SOKOL_METAL
 build_lib_arm64_release sokol_gl          gl/sokol_gl_macos_arm64_metal_release SOKOL_METAL
 
@@ -55,6 +60,11 @@ build_lib_arm64_debug sokol_glue          glue/sokol_glue_macos_arm64_metal_debu
 build_lib_arm64_debug sokol_time          time/sokol_time_macos_arm64_metal_debug SOKOL_METAL
 build_lib_arm64_debug sokol_audio         audio/sokol_audio_macos_arm64_metal_debug SOKOL_METAL
 build_lib_arm64_debug sokol_debugtext     debugtext/sokol_debugtext_macos_arm64_metal_debug SOKOL_METAL
+build_lib_arm64_debug sokol_gfx_trace     gfx_trace/sokol_gfx_trace_macos_arm64_metal_debug SOKOL_METAL
+build_lib_arm64_debug sokol_profiler      profiler/sokol_profiler_macos_arm64_metal_debug SOKOL_METAL
+build_lib_arm64_debug sokol_render_graph  render_graph/sokol_render_graph_macos_arm64_metal_debug SOKOL_METAL
+build_lib_arm64_debug sokol_draw_queue    draw_queue/sokol_draw_queue_macos_arm64_metal_debug SOKOL_METAL
+build_lib_arm64_debug sokol_gpu_cull      gpu_cull/sokol_gpu_cull_macos_arm64_metal_debug SOKOL_METAL
 build_lib_arm64_debug sokol_shape         shape/sokol_shape_macos_arm64_metal_debug SOKOL_METAL
 build_lib_arm64_debug sokol_gl            gl/sokol_gl_macos_arm64_metal_debug SOKOL_METAL
 
@@ -66,6 +76,11 @@ build_lib_x64_release sokol_glue        glue/sokol_glue_macos_x64_metal_release
 build_lib_x64_release sokol_time        time/sokol_time_macos_x64_metal_release SOKOL_METAL
 build_lib_x64_release sokol_audio       audio/sokol_audio_macos_x64_metal_release SOKOL_METAL
 build_lib_x64_release sokol_debugtext   debugtext/sokol_debugtext_macos_x64_metal_release SOKOL_METAL
+build_lib_x64_release sokol_gfx_trace   gfx_trace/sokol_gfx_trace_macos_x64_metal_release SOKOL_METAL
+build_lib_x64_release sokol_profiler    profiler/sokol_profiler_macos_x64_metal_release SOKOL_METAL
+build_lib_x64_release sokol_render_graph render_graph/sokol_render_graph_macos_x64_metal_release SOKOL_METAL
+build_lib_x64_release sokol_draw_queue  draw_queue/sokol_draw_queue_macos_x64_metal_release SOKOL_METAL
+build_lib_x64_release sokol_gpu_cull    gpu_cull/sokol_gpu_cull_macos_x64_metal_release SOKOL_METAL
 build_lib_x64_release sokol_shape       shape/sokol_shape_macos_x64_metal_release SOKOL_METAL
 build_lib_x64_release sokol_gl          gl/sokol_gl_macos_x64_metal_release SOKOL_METAL
 
@@ -77,6 +92,11 @@ build_lib_x64_debug sokol_glue          glue/sokol_glue_macos_x64_metal_debug SO
 build_lib_x64_debug sokol_time          time/sokol_time_macos_x64_metal_debug SOKOL_METAL
 build_lib_x64_debug sokol_audio         audio/sokol_audio_macos_x64_metal_debug SOKOL_METAL
 build_lib_x64_debug sokol_debugtext     debugtext/sokol_debugtext_macos_x64_metal_debug SOKOL_METAL
+build_lib_x64_debug sokol_gfx_trace     gfx_trace/sokol_gfx_trace_macos_x64_metal_debug SOKOL_METAL
+build_lib_x64_debug sokol_profiler      profiler/sokol_profiler_macos_x64_metal_debug SOKOL_METAL
+build_lib_x64_debug sokol_render_graph  render_graph/sokol_render_graph_macos_x64_metal_debug SOKOL_METAL
+build_lib_x64_debug sokol_draw_queue    draw_queue/sokol_draw_queue_macos_x64_metal_debug SOKOL_METAL
+build_lib_x64_debug sokol_gpu_cull      gpu_cull/sokol_gpu_cull_macos_x64_metal_debug SOKOL_METAL
 build_lib_x64_debug sokol_shape         shape/sokol_shape_macos_x64_metal_debug SOKOL_METAL
 build_lib_x64_debug sokol_gl            gl/sokol_gl_macos_x64_metal_debug SOKOL_METAL
 
@@ -88,6 +108,11 @@ build_lib_arm64_release sokol_glue        glue/sokol_glue_macos_arm64_gl_release
 build_lib_arm64_release sokol_time        time/sokol_time_macos_arm64_gl_release SOKOL_GLCORE
 build_lib_arm64_release sokol_audio       audio/sokol_audio_macos_arm64_gl_release SOKOL_GLCORE
 build_lib_arm64_release sokol_debugtext   debugtext/sokol_debugtext_macos_arm64_gl_release SOKOL_GLCORE
+build_lib_arm64_release sokol_gfx_trace   gfx_trace/sokol_gfx_trace_macos_arm64_gl_release SOKOL_GLCORE
+build_lib_arm64_release sokol_profiler    profiler/sokol_profiler_macos_arm64_gl_release SOKOL_GLCORE
+build_lib_arm64_release sokol_render_graph render_graph/sokol_render_graph_macos_arm64_gl_release SOKOL_GLCORE
+build_lib_arm64_release sokol_draw_queue  draw_queue/sokol_draw_queue_macos_arm64_gl_release SOKOL_GLCORE
+build_lib_arm64_release sokol_gpu_cull    gpu_cull/sokol_gpu_cull_macos_arm64_gl_release SOKOL_GLCORE
 build_lib_arm64_release sokol_shape       shape/sokol_shape_macos_arm64_gl_release SOKOL_GLCORE
 build_lib_arm64_release sokol_gl          gl/sokol_gl_macos_arm64_gl_release SOKOL_GLCORE
 
@@ -99,6 +124,11 @@ build_lib_arm64_debug sokol_glue          glue/sokol_glue_macos_arm64_gl_debug S
 build_lib_arm64_debug sokol_time          time/sokol_time_macos_arm64_gl_debug SOKOL_GLCORE
 build_lib_arm64_debug sokol_audio         audio/sokol_audio_macos_arm64_gl_debug SOKOL_GLCORE
 build_lib_arm64_debug sokol_debugtext     debugtext/sokol_debugtext_macos_arm64_gl_debug SOKOL_GLCORE
+build_lib_arm64_debug sokol_gfx_trace     gfx_trace/sokol_gfx_trace_macos_arm64_gl_debug SOKOL_GLCORE
+build_lib_arm64_debug sokol_profiler      profiler/sokol_profiler_macos_arm64_gl_debug SOKOL_GLCORE
+build_lib_arm64_debug sokol_render_graph  render_graph/sokol_render_graph_macos_arm64_gl_debug SOKOL_GLCORE
+build_lib_arm64_debug sokol_draw_queue    draw_queue/sokol_draw_queue_macos_arm64_gl_debug SOKOL_GLCORE
+build_lib_arm64_debug sokol_gpu_cull      gpu_cull/sokol_gpu_cull_macos_arm64_gl_debug SOKOL_GLCORE
 build_lib_arm64_debug sokol_shape         shape/sokol_shape_macos_arm64_gl_debug SOKOL_GLCORE
 build_lib_arm64_debug sokol_gl            gl/sokol_gl_macos_arm64_gl_debug SOKOL_GLCORE
 
@@ -110,6 +140,11 @@ build_lib_x64_release sokol_glue        glue/sokol_glue_macos_x64_gl_release SOK
 build_lib_x64_release sokol_time        time/sokol_time_macos_x64_gl_release SOKOL_GLCORE
 build_lib_x64_release sokol_audio       audio/sokol_audio_macos_x64_gl_release SOKOL_GLCORE
 build_lib_x64_release sokol_debugtext   debugtext/sokol_debugtext_macos_x64_gl_release SOKOL_GLCORE
+build_lib_x64_release sokol_gfx_trace   gfx_trace/sokol_gfx_trace_macos_x64_gl_release SOKOL_GLCORE
+build_lib_x64_release sokol_profiler    profiler/sokol_profiler_macos_x64_gl_release SOKOL_GLCORE
+build_lib_x64_release sokol_render_graph render_graph/sokol_render_graph_macos_x64_gl_release SOKOL_GLCORE
+build_lib_x64_release sokol_draw_queue  draw_queue/sokol_draw_queue_macos_x64_gl_release SOKOL_GLCORE
+build_lib_x64_release sokol_gpu_cull    gpu_cull/sokol_gpu_cull_macos_x64_gl_release SOKOL_GLCORE
 build_lib_x64_release sokol_shape       shape/sokol_shape_macos_x64_gl_release SOKOL_GLCORE
 build_lib_x64_release sokol_gl          gl/sokol_gl_macos_x64_gl_release SOKOL_GLCORE
 
@@ -121,6 +156,11 @@ build_lib_x64_debug sokol_glue          glue/sokol_glue_macos_x64_gl_debug SOKOL
 build_lib_x64_debug sokol_time          time/sokol_time_macos_x64_gl_debug SOKOL_GLCORE
 build_lib_x64_debug sokol_audio         audio/sokol_audio_macos_x64_gl_debug SOKOL_GLCORE
 build_lib_x64_debug sokol_debugtext     debugtext/sokol_debugtext_macos_x64_gl_debug SOKOL_GLCORE
+build_lib_x64_debug sokol_gfx_trace     gfx_trace/sokol_gfx_trace_macos_x64_gl_debug SOKOL_GLCORE
+build_lib_x64_debug sokol_profiler      profiler/sokol_profiler_macos_x64_gl_debug SOKOL_GLCORE
+build_lib_x64_debug sokol_render_graph  render_graph/sokol_render_graph_macos_x64_gl_debug SOKOL_GLCORE
+build_lib_x64_debug sokol_draw_queue    draw_queue/sokol_draw_queue_macos_x64_gl_debug SOKOL_GLCORE
+build_lib_x64_debug sokol_gpu_cull      gpu_cull/sokol_gpu_cull_macos_x64_gl_debug SOKOL_GLCORE
 build_lib_x64_debug sokol_shape         shape/sokol_shape_macos_x64_gl_debug SOKOL_GLCORE
 build_lib_x64_debug sokol_gl            gl/sokol_gl_macos_x64_gl_debug SOKOL_GLCORE
 
@@ -1,6 +1,6 @@
 @echo off
 
-set sources=log app gfx glue time audio debugtext shape gl
+set sources=log app gfx glue time audio debugtext shape gl gfx_trace profiler render_graph draw_queue gpu_cull
 
 REM Debug
 for %%s in (%sources%) do (
@@ -1,7 +1,7 @@
 #!/bin/bash
 set -e
 
-declare -a libs=("log" "gfx" "app" "glue" "time" "audio" "debugtext" "shape" "gl")
+declare -a libs=("log" "gfx" "app" "glue" "time" "audio" "debugtext" "shape" "gl" "gfx_trace" "profiler" "render_graph" "draw_queue" "gpu_cull")
 
 for l in "${libs[@]}"
 do
@@ -1,6 +1,6 @@
 @echo off
 
-set sources=log app gfx glue time audio debugtext shape gl gp
+set sources=log app gfx glue time audio debugtext shape gl gp gfx_trace profiler render_graph draw_queue gpu_cull
 
 REM D3D11 Debug
 for %%s in (%sources%) do (
@@ -14,5 +14,10 @@
 #include "sokol_gl.h"
 #include "sokol_shape.h"
 #include "sokol_debugtext.h"
+#include "sokol_gfx_trace.h"
+#include "sokol_profiler.h"
+#include "sokol_render_graph.h"
+#include "sokol_draw_queue.h"
+#include "sokol_gpu_cull.h"
 
 #include "sokol_gp.h"
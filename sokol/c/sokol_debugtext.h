@@ -73,6 +73,10 @@
         .context_pool_size (default: 8)
             The max number of text contexts that can be created.
 
+        .block_pool_size (default: 64)
+            The max number of retained text blocks that can be created
+            (see RETAINED TEXT BLOCKS below).
+
         .printf_buf_size (default: 4096)
             The size of the internal text formatting buffer used by
             sdtx_printf() and sdtx_vprintf().
@@ -135,6 +139,18 @@
                 values here when rendering to render targets with different
                 pixel format attributes than the default framebuffer.
 
+            .instanced (default: false)
+                If true, each character is recorded as a single 12-byte
+                instance (position, character code, font and color) instead
+                of 6 vertices (96 bytes), and the quad is expanded in the
+                vertex shader via an instanced draw call. This reduces the
+                per-frame buffer upload size by 8x and is recommended for
+                large amounts of text (e.g. full-screen consoles). In instanced
+                mode, character positions are stored with quarter-pixel precision
+                in a 16-bit range, so positions must be within -1024..1023
+                character cells. NOTE: the instanced vertex shader is always
+                compiled from source, on D3D11 this requires d3dcompiler_47.dll.
+
     --- Before starting to render text, optionally call sdtx_canvas() to
         dynamically resize the virtual canvas. This is recommended when
         rendering to a resizeable window. The virtual canvas size can
@@ -153,6 +169,11 @@
         Do *not* use integer math here, since this will not look nice
         when the render target size isn't divisible by 2.
 
+        The new canvas size applies to all following text, except while a
+        text block is being recorded (see RETAINED TEXT BLOCKS below): block
+        characters are recorded in character cells, and the canvas size is
+        only applied when the block is drawn.
+
     --- Optionally define the origin for the character grid with:
 
             sdtx_origin(x, y);
@@ -220,6 +241,26 @@
             sdtx_vprintf(fmt, args) - same as sdtx_printf() but with the arguments
                                       provided in a va_list
 
+            sdtx_put_int(val)       - output a signed integer in decimal notation
+
+            sdtx_put_float(val, decimals)
+                                    - output a float in fixed-point notation with
+                                      'decimals' (0..9) digits after the decimal point,
+                                      the result is rounded to nearest (ties away from
+                                      zero), values which round to zero are printed
+                                      without a minus sign
+
+            sdtx_put_hex(val, num_digits)
+                                    - output an unsigned integer as uppercase hex
+                                      number without prefix, zero-padded to
+                                      'num_digits' (0..8), 0 means no padding
+
+        - sdtx_put_int(), sdtx_put_float() and sdtx_put_hex() don't go through
+          vsnprintf() and an intermediate format buffer, and are much faster than
+          sdtx_printf() when printing a lot of numbers (sdtx_put_float() only falls
+          back to sdtx_printf() for NaN, infinity and values which don't fit into
+          a 64-bit integer after scaling by 10^decimals)
+
         - Note that the text will not yet be rendered, only recorded for rendering
           at a later time, the actual rendering happens when sdtx_draw() is called
           inside a sokol-gfx render pass.
@@ -287,6 +328,7 @@
         .color_format       -- color pixel format of target render pass
         .depth_format       -- depth pixel format of target render pass
         .sample_count       -- MSAA sample count of target render pass
+        .instanced          -- render each character as one instance instead of 6 vertices
 
     To make a new context the active context, call:
 
@@ -333,6 +375,61 @@
         sdtx_context_draw(ctx)
         sdtx_context_draw_layer(ctx, layer_id)
 
+    RETAINED TEXT BLOCKS
+    ====================
+    Text output with the functions above is recorded anew each frame. For
+    large, mostly static text (like help screens or table headers) you can
+    instead record the text once into a 'text block' which keeps its
+    characters in an immutable sokol-gfx buffer, and then draw the block each
+    frame at a new position and with a tint color, which only costs a single
+    draw call.
+
+    To record a text block, call:
+
+        sdtx_begin_block();
+        sdtx_puts("...");
+        sdtx_printf(...);
+        ...
+        sdtx_block block = sdtx_end_block();
+
+    Between sdtx_begin_block() and sdtx_end_block() all text output of the
+    current context goes into the text block instead of the per-frame
+    text buffer. The cursor position and origin are reset to zero
+    in sdtx_begin_block() and restored in sdtx_end_block(), so that block
+    positions are relative to the top-left corner of the block. Font and
+    color changes are recorded into the block, layer changes are ignored.
+    The canvas size is not recorded: calling sdtx_canvas() while recording
+    a block doesn't change the block's characters, it only changes the
+    context's canvas size, which takes effect when the block (or any other
+    text) is drawn later. Like outside of a block, it also resets the
+    cursor position and origin. A block can hold at most as many characters
+    as the char_buf_size of the recording context.
+
+    The returned handle will be invalid (SG_INVALID_ID) if the block pool
+    is exhausted (see sdtx_desc_t.block_pool_size).
+
+    To draw a text block from inside a sokol-gfx render pass, call:
+
+        sdtx_draw_block(block, x, y, rgba)
+
+    ...where x and y is the position of the block's top-left corner in
+    character cells relative to the virtual canvas of the current context,
+    and rgba is a tint color (ABGR 0xAABBGGRR) which is multiplied with
+    the recorded character colors (0xFFFFFFFF for no tint). Unlike sdtx_draw(),
+    the block is rendered immediately, the pipeline attributes (pixel formats
+    and sample count) and virtual canvas size are taken from the current
+    context. To draw with a specific context:
+
+        sdtx_context_draw_block(ctx, block, x, y, rgba)
+
+    Text blocks are always rendered via instancing (see the .instanced
+    context parameter above), and block positions are limited to the same
+    -1024..1023 character cell range.
+
+    Text blocks are not owned by a context, to destroy a text block, call:
+
+        sdtx_destroy_block(block)
+
     USING YOUR OWN FONT DATA
     ========================
 
@@ -552,6 +649,10 @@ extern "C" {
     _SDTX_LOGITEM_XMACRO(COMMAND_BUFFER_FULL, "command buffer full (adjust via sdtx_context_desc_t.max_commands)") \
     _SDTX_LOGITEM_XMACRO(CONTEXT_POOL_EXHAUSTED, "context pool exhausted (adjust via sdtx_desc_t.context_pool_size)") \
     _SDTX_LOGITEM_XMACRO(CANNOT_DESTROY_DEFAULT_CONTEXT, "cannot destroy default context") \
+    _SDTX_LOGITEM_XMACRO(BLOCK_POOL_EXHAUSTED, "text block pool exhausted (adjust via sdtx_desc_t.block_pool_size)") \
+    _SDTX_LOGITEM_XMACRO(BLOCK_ALREADY_ACTIVE, "sdtx_begin_block() called while already recording a text block") \
+    _SDTX_LOGITEM_XMACRO(NO_ACTIVE_BLOCK, "sdtx_end_block() called without matching sdtx_begin_block()") \
+    _SDTX_LOGITEM_XMACRO(BLOCK_BUFFER_FULL, "text block buffer full, characters dropped (adjust via sdtx_context_desc_t.char_buf_size)") \
 
 #define _SDTX_LOGITEM_XMACRO(item,msg) SDTX_LOGITEM_##item,
 typedef enum sdtx_log_item_t {
@@ -583,6 +684,9 @@ typedef struct sdtx_context { uint32_t id; } sdtx_context;
 /* the default context handle */
 static const sdtx_context SDTX_DEFAULT_CONTEXT = { 0x00010001 };
 
+/* a retained text block handle */
+typedef struct sdtx_block { uint32_t id; } sdtx_block;
+
 /*
     sdtx_range is a pointer-size-pair struct used to pass memory
     blobs into sokol-debugtext. When initialized from a value type
@@ -651,6 +755,7 @@ typedef struct sdtx_context_desc_t {
     sg_pixel_format color_format;           // color pixel format of target render pass
     sg_pixel_format depth_format;           // depth pixel format of target render pass
     int sample_count;                       // MSAA sample count of target render pass
+    bool instanced;                         // render each character as one 12-byte instance instead of 6 vertices
 } sdtx_context_desc_t;
 
 /*
@@ -685,6 +790,7 @@ typedef struct sdtx_allocator_t {
 */
 typedef struct sdtx_desc_t {
     int context_pool_size;                  // max number of rendering contexts that can be created, default: 8
+    int block_pool_size;                    // max number of retained text blocks that can be created, default: 64
     int printf_buf_size;                    // size of internal buffer for snprintf(), default: 4096
     sdtx_font_desc_t fonts[SDTX_MAX_FONTS]; // up to 8 fonts descriptions
     sdtx_context_desc_t context;            // the default context creation parameters
@@ -752,10 +858,20 @@ SOKOL_DEBUGTEXT_API_DECL void sdtx_puts(const char* str);             // does NO
 SOKOL_DEBUGTEXT_API_DECL void sdtx_putr(const char* str, int len);    // 'put range', also stops at zero-char
 SOKOL_DEBUGTEXT_API_DECL int sdtx_printf(const char* fmt, ...) SOKOL_DEBUGTEXT_PRINTF_ATTR;
 SOKOL_DEBUGTEXT_API_DECL int sdtx_vprintf(const char* fmt, va_list args);
+SOKOL_DEBUGTEXT_API_DECL void sdtx_put_int(int val);
+SOKOL_DEBUGTEXT_API_DECL void sdtx_put_float(float val, int decimals);    // decimals: 0..9
+SOKOL_DEBUGTEXT_API_DECL void sdtx_put_hex(uint32_t val, int num_digits); // num_digits: 0..8, 0 means no zero-padding
 
 /* language bindings helper: get the internal printf format buffer */
 SOKOL_DEBUGTEXT_API_DECL sdtx_range sdtx_get_cleared_fmt_buffer(void);
 
+/* retained text blocks */
+SOKOL_DEBUGTEXT_API_DECL void sdtx_begin_block(void);
+SOKOL_DEBUGTEXT_API_DECL sdtx_block sdtx_end_block(void);
+SOKOL_DEBUGTEXT_API_DECL void sdtx_destroy_block(sdtx_block block);
+SOKOL_DEBUGTEXT_API_DECL void sdtx_draw_block(sdtx_block block, float x, float y, uint32_t rgba);   // tint color ABGR 0xAABBGGRR
+SOKOL_DEBUGTEXT_API_DECL void sdtx_context_draw_block(sdtx_context ctx, sdtx_block block, float x, float y, uint32_t rgba);
+
 #ifdef __cplusplus
 } /* extern "C" */
 /* C++ const-ref wrappers */
@@ -813,6 +929,7 @@ inline sdtx_context sdtx_make_context(const sdtx_context_desc_t& desc) { return
 
 #define _SDTX_DEFAULT_MAX_COMMANDS (4096)
 #define _SDTX_DEFAULT_CONTEXT_POOL_SIZE (8)
+#define _SDTX_DEFAULT_BLOCK_POOL_SIZE (64)
 #define _SDTX_DEFAULT_CHAR_BUF_SIZE (4096)
 #define _SDTX_DEFAULT_PRINTF_BUF_SIZE (4096)
 #define _SDTX_DEFAULT_CANVAS_WIDTH (640)
@@ -2407,6 +2524,12 @@ static const uint8_t _sdtx_font_oric[2048] = {
         @end
 
         @program debugtext vs fs
+
+    The vertex shader for instanced rendering (_sdtx_vs_inst_*) is not
+    generated by sokol-shdc but hand-written for each backend, and is
+    always provided as source code (also on D3D11 and Metal). It expands
+    each glyph instance into a quad using the vertex index and shares the
+    fragment shader with the regular vertex shader.
 */
 #if defined(SOKOL_GLCORE)
 /*
@@ -2480,6 +2603,68 @@ static const uint8_t _sdtx_fs_source_glsl410[224] = {
     0x78,0x78,0x20,0x2a,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
 
 };
+/*
+    #version 410
+
+    uniform vec4 vs_params[3];
+    layout(location = 0) in ivec2 position;
+    layout(location = 0) out vec2 uv;
+    layout(location = 1) in uvec4 glyph;
+    layout(location = 1) out vec4 color;
+    layout(location = 2) in vec4 color0;
+
+    void main()
+    {
+        vec2 corner = vec2(float((0x16 >> gl_VertexID) & 1), float((0x34 >> gl_VertexID) & 1));
+        vec2 pos = ((vec2(position) + vs_params[1].xy) + (corner * 32.0)) * vs_params[0].xy;
+        gl_Position = vec4(fma(pos, vec2(2.0, -2.0), vec2(-1.0, 1.0)), 0.0, 1.0);
+        uv = fma(vec2(glyph.xy) + corner, vs_params[0].zw, (vec2(1.0) - (corner * 2.0)) * 1.52587890625e-05);
+        color = color0 * vs_params[2];
+    }
+*/
+static const uint8_t _sdtx_vs_inst_source_glsl410[645] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x31,0x30,0x0a,0x0a,0x75,0x6e,
+    0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x73,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x5b,0x33,0x5d,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,
+    0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x69,0x6e,
+    0x20,0x69,0x76,0x65,0x63,0x32,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,
+    0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,
+    0x20,0x3d,0x20,0x30,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x32,0x20,0x75,
+    0x76,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,
+    0x6f,0x6e,0x20,0x3d,0x20,0x31,0x29,0x20,0x69,0x6e,0x20,0x75,0x76,0x65,0x63,0x34,
+    0x20,0x67,0x6c,0x79,0x70,0x68,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,
+    0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x31,0x29,0x20,0x6f,0x75,0x74,
+    0x20,0x76,0x65,0x63,0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x6c,0x61,0x79,
+    0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x32,
+    0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x30,
+    0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x63,0x6f,0x72,0x6e,0x65,0x72,
+    0x20,0x3d,0x20,0x76,0x65,0x63,0x32,0x28,0x66,0x6c,0x6f,0x61,0x74,0x28,0x28,0x30,
+    0x78,0x31,0x36,0x20,0x3e,0x3e,0x20,0x67,0x6c,0x5f,0x56,0x65,0x72,0x74,0x65,0x78,
+    0x49,0x44,0x29,0x20,0x26,0x20,0x31,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x28,
+    0x28,0x30,0x78,0x33,0x34,0x20,0x3e,0x3e,0x20,0x67,0x6c,0x5f,0x56,0x65,0x72,0x74,
+    0x65,0x78,0x49,0x44,0x29,0x20,0x26,0x20,0x31,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x76,0x65,0x63,0x32,0x20,0x70,0x6f,0x73,0x20,0x3d,0x20,0x28,0x28,0x76,0x65,
+    0x63,0x32,0x28,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x29,0x20,0x2b,0x20,0x76,
+    0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,0x2e,0x78,0x79,0x29,0x20,
+    0x2b,0x20,0x28,0x63,0x6f,0x72,0x6e,0x65,0x72,0x20,0x2a,0x20,0x33,0x32,0x2e,0x30,
+    0x29,0x29,0x20,0x2a,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,
+    0x5d,0x2e,0x78,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,
+    0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x66,0x6d,0x61,
+    0x28,0x70,0x6f,0x73,0x2c,0x20,0x76,0x65,0x63,0x32,0x28,0x32,0x2e,0x30,0x2c,0x20,
+    0x2d,0x32,0x2e,0x30,0x29,0x2c,0x20,0x76,0x65,0x63,0x32,0x28,0x2d,0x31,0x2e,0x30,
+    0x2c,0x20,0x31,0x2e,0x30,0x29,0x29,0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,
+    0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x76,0x20,0x3d,0x20,0x66,0x6d,0x61,
+    0x28,0x76,0x65,0x63,0x32,0x28,0x67,0x6c,0x79,0x70,0x68,0x2e,0x78,0x79,0x29,0x20,
+    0x2b,0x20,0x63,0x6f,0x72,0x6e,0x65,0x72,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,
+    0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x7a,0x77,0x2c,0x20,0x28,0x76,0x65,0x63,0x32,
+    0x28,0x31,0x2e,0x30,0x29,0x20,0x2d,0x20,0x28,0x63,0x6f,0x72,0x6e,0x65,0x72,0x20,
+    0x2a,0x20,0x32,0x2e,0x30,0x29,0x29,0x20,0x2a,0x20,0x31,0x2e,0x35,0x32,0x35,0x38,
+    0x37,0x38,0x39,0x30,0x36,0x32,0x35,0x65,0x2d,0x30,0x35,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x30,
+    0x20,0x2a,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x32,0x5d,0x3b,
+    0x0a,0x7d,0x0a,0x0a,0x00,
+};
 #elif defined(SOKOL_GLES3)
 /*
     #version 300 es
@@ -2552,6 +2737,65 @@ static const uint8_t _sdtx_fs_source_glsl300es[255] = {
     0x74,0x65,0x78,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x75,0x76,0x29,0x2e,0x78,0x78,0x78,
     0x78,0x20,0x2a,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
 };
+/*
+    #version 300 es
+
+    uniform vec4 vs_params[3];
+    layout(location = 0) in ivec2 position;
+    out vec2 uv;
+    layout(location = 1) in uvec4 glyph;
+    out vec4 color;
+    layout(location = 2) in vec4 color0;
+
+    void main()
+    {
+        vec2 corner = vec2(float((0x16 >> gl_VertexID) & 1), float((0x34 >> gl_VertexID) & 1));
+        vec2 pos = ((vec2(position) + vs_params[1].xy) + (corner * 32.0)) * vs_params[0].xy;
+        gl_Position = vec4(pos * vec2(2.0, -2.0) + vec2(-1.0, 1.0), 0.0, 1.0);
+        uv = (vec2(glyph.xy) + corner) * vs_params[0].zw + (vec2(1.0) - (corner * 2.0)) * 1.52587890625e-05;
+        color = color0 * vs_params[2];
+    }
+*/
+static const uint8_t _sdtx_vs_inst_source_glsl300es[602] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x30,0x30,0x20,0x65,0x73,0x0a,
+    0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x73,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x33,0x5d,0x3b,0x0a,0x6c,0x61,0x79,0x6f,
+    0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,
+    0x20,0x69,0x6e,0x20,0x69,0x76,0x65,0x63,0x32,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,
+    0x6f,0x6e,0x3b,0x0a,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x32,0x20,0x75,0x76,0x3b,
+    0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,
+    0x20,0x3d,0x20,0x31,0x29,0x20,0x69,0x6e,0x20,0x75,0x76,0x65,0x63,0x34,0x20,0x67,
+    0x6c,0x79,0x70,0x68,0x3b,0x0a,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x34,0x20,0x63,
+    0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,
+    0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x32,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,
+    0x63,0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x30,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,
+    0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,
+    0x63,0x32,0x20,0x63,0x6f,0x72,0x6e,0x65,0x72,0x20,0x3d,0x20,0x76,0x65,0x63,0x32,
+    0x28,0x66,0x6c,0x6f,0x61,0x74,0x28,0x28,0x30,0x78,0x31,0x36,0x20,0x3e,0x3e,0x20,
+    0x67,0x6c,0x5f,0x56,0x65,0x72,0x74,0x65,0x78,0x49,0x44,0x29,0x20,0x26,0x20,0x31,
+    0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x28,0x28,0x30,0x78,0x33,0x34,0x20,0x3e,
+    0x3e,0x20,0x67,0x6c,0x5f,0x56,0x65,0x72,0x74,0x65,0x78,0x49,0x44,0x29,0x20,0x26,
+    0x20,0x31,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x70,
+    0x6f,0x73,0x20,0x3d,0x20,0x28,0x28,0x76,0x65,0x63,0x32,0x28,0x70,0x6f,0x73,0x69,
+    0x74,0x69,0x6f,0x6e,0x29,0x20,0x2b,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x73,0x5b,0x31,0x5d,0x2e,0x78,0x79,0x29,0x20,0x2b,0x20,0x28,0x63,0x6f,0x72,0x6e,
+    0x65,0x72,0x20,0x2a,0x20,0x33,0x32,0x2e,0x30,0x29,0x29,0x20,0x2a,0x20,0x76,0x73,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x78,0x79,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,
+    0x20,0x76,0x65,0x63,0x34,0x28,0x70,0x6f,0x73,0x20,0x2a,0x20,0x76,0x65,0x63,0x32,
+    0x28,0x32,0x2e,0x30,0x2c,0x20,0x2d,0x32,0x2e,0x30,0x29,0x20,0x2b,0x20,0x76,0x65,
+    0x63,0x32,0x28,0x2d,0x31,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x2c,0x20,0x30,
+    0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x76,
+    0x20,0x3d,0x20,0x28,0x76,0x65,0x63,0x32,0x28,0x67,0x6c,0x79,0x70,0x68,0x2e,0x78,
+    0x79,0x29,0x20,0x2b,0x20,0x63,0x6f,0x72,0x6e,0x65,0x72,0x29,0x20,0x2a,0x20,0x76,
+    0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x7a,0x77,0x20,0x2b,
+    0x20,0x28,0x76,0x65,0x63,0x32,0x28,0x31,0x2e,0x30,0x29,0x20,0x2d,0x20,0x28,0x63,
+    0x6f,0x72,0x6e,0x65,0x72,0x20,0x2a,0x20,0x32,0x2e,0x30,0x29,0x29,0x20,0x2a,0x20,
+    0x31,0x2e,0x35,0x32,0x35,0x38,0x37,0x38,0x39,0x30,0x36,0x32,0x35,0x65,0x2d,0x30,
+    0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x63,
+    0x6f,0x6c,0x6f,0x72,0x30,0x20,0x2a,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x73,0x5b,0x32,0x5d,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
 #elif defined(SOKOL_METAL)
 /*
     #include <metal_stdlib>
@@ -3533,6 +3777,111 @@ static const uint8_t _sdtx_fs_source_metal_sim[441] = {
     0x6c,0x6f,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,
     0x6f,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
 };
+/*
+    #include <metal_stdlib>
+    #include <simd/simd.h>
+
+    using namespace metal;
+
+    struct vs_params
+    {
+        float4 scale;
+        float4 offset;
+        float4 tint;
+    };
+
+    struct main0_out
+    {
+        float2 uv [[user(locn0)]];
+        float4 color [[user(locn1)]];
+        float4 gl_Position [[position]];
+    };
+
+    struct main0_in
+    {
+        int2 position [[attribute(0)]];
+        uint4 glyph [[attribute(1)]];
+        float4 color0 [[attribute(2)]];
+    };
+
+    vertex main0_out main0(main0_in in [[stage_in]], constant vs_params& _params [[buffer(0)]], uint gl_VertexIndex [[vertex_id]])
+    {
+        main0_out out = {};
+        float2 corner = float2(float((0x16u >> gl_VertexIndex) & 1u), float((0x34u >> gl_VertexIndex) & 1u));
+        float2 pos = ((float2(in.position) + _params.offset.xy) + (corner * 32.0)) * _params.scale.xy;
+        out.gl_Position = float4(fma(pos, float2(2.0, -2.0), float2(-1.0, 1.0)), 0.0, 1.0);
+        out.uv = fma(float2(in.glyph.xy) + corner, _params.scale.zw, (float2(1.0) - (corner * 2.0)) * 1.52587890625e-05);
+        out.color = in.color0 * _params.tint;
+        return out;
+    }
+*/
+static const uint8_t _sdtx_vs_inst_source_metal[1028] = {
+    0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,
+    0x73,0x74,0x64,0x6c,0x69,0x62,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,
+    0x20,0x3c,0x73,0x69,0x6d,0x64,0x2f,0x73,0x69,0x6d,0x64,0x2e,0x68,0x3e,0x0a,0x0a,
+    0x75,0x73,0x69,0x6e,0x67,0x20,0x6e,0x61,0x6d,0x65,0x73,0x70,0x61,0x63,0x65,0x20,
+    0x6d,0x65,0x74,0x61,0x6c,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x76,
+    0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x34,0x20,0x73,0x63,0x61,0x6c,0x65,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x6f,0x66,0x66,0x73,0x65,0x74,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x74,0x69,0x6e,0x74,0x3b,
+    0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,
+    0x30,0x5f,0x6f,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x32,0x20,0x75,0x76,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,
+    0x6e,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,
+    0x6f,0x63,0x6e,0x31,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x34,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,
+    0x5b,0x5b,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,
+    0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,
+    0x6e,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x32,0x20,0x70,0x6f,0x73,
+    0x69,0x74,0x69,0x6f,0x6e,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,
+    0x65,0x28,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,
+    0x34,0x20,0x67,0x6c,0x79,0x70,0x68,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,0x62,
+    0x75,0x74,0x65,0x28,0x31,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x30,0x20,0x5b,0x5b,0x61,0x74,
+    0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x28,0x32,0x29,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,
+    0x0a,0x0a,0x76,0x65,0x72,0x74,0x65,0x78,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,
+    0x75,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x28,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,
+    0x6e,0x20,0x69,0x6e,0x20,0x5b,0x5b,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x5d,
+    0x5d,0x2c,0x20,0x63,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x20,0x76,0x73,0x5f,0x70,
+    0x61,0x72,0x61,0x6d,0x73,0x26,0x20,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x20,0x5b,
+    0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x30,0x29,0x5d,0x5d,0x2c,0x20,0x75,0x69,
+    0x6e,0x74,0x20,0x67,0x6c,0x5f,0x56,0x65,0x72,0x74,0x65,0x78,0x49,0x6e,0x64,0x65,
+    0x78,0x20,0x5b,0x5b,0x76,0x65,0x72,0x74,0x65,0x78,0x5f,0x69,0x64,0x5d,0x5d,0x29,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,
+    0x20,0x6f,0x75,0x74,0x20,0x3d,0x20,0x7b,0x7d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x20,0x63,0x6f,0x72,0x6e,0x65,0x72,0x20,0x3d,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x28,0x66,0x6c,0x6f,0x61,0x74,0x28,0x28,0x30,0x78,0x31,
+    0x36,0x75,0x20,0x3e,0x3e,0x20,0x67,0x6c,0x5f,0x56,0x65,0x72,0x74,0x65,0x78,0x49,
+    0x6e,0x64,0x65,0x78,0x29,0x20,0x26,0x20,0x31,0x75,0x29,0x2c,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x28,0x28,0x30,0x78,0x33,0x34,0x75,0x20,0x3e,0x3e,0x20,0x67,0x6c,0x5f,
+    0x56,0x65,0x72,0x74,0x65,0x78,0x49,0x6e,0x64,0x65,0x78,0x29,0x20,0x26,0x20,0x31,
+    0x75,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,
+    0x70,0x6f,0x73,0x20,0x3d,0x20,0x28,0x28,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x69,
+    0x6e,0x2e,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x29,0x20,0x2b,0x20,0x5f,0x70,
+    0x61,0x72,0x61,0x6d,0x73,0x2e,0x6f,0x66,0x66,0x73,0x65,0x74,0x2e,0x78,0x79,0x29,
+    0x20,0x2b,0x20,0x28,0x63,0x6f,0x72,0x6e,0x65,0x72,0x20,0x2a,0x20,0x33,0x32,0x2e,
+    0x30,0x29,0x29,0x20,0x2a,0x20,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x2e,0x73,0x63,
+    0x61,0x6c,0x65,0x2e,0x78,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,
+    0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x34,0x28,0x66,0x6d,0x61,0x28,0x70,0x6f,0x73,0x2c,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x32,0x28,0x32,0x2e,0x30,0x2c,0x20,0x2d,0x32,0x2e,0x30,0x29,0x2c,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x2d,0x31,0x2e,0x30,0x2c,0x20,0x31,0x2e,
+    0x30,0x29,0x29,0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x75,0x76,0x20,0x3d,0x20,0x66,0x6d,0x61,
+    0x28,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x69,0x6e,0x2e,0x67,0x6c,0x79,0x70,0x68,
+    0x2e,0x78,0x79,0x29,0x20,0x2b,0x20,0x63,0x6f,0x72,0x6e,0x65,0x72,0x2c,0x20,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x73,0x2e,0x73,0x63,0x61,0x6c,0x65,0x2e,0x7a,0x77,0x2c,
+    0x20,0x28,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x31,0x2e,0x30,0x29,0x20,0x2d,0x20,
+    0x28,0x63,0x6f,0x72,0x6e,0x65,0x72,0x20,0x2a,0x20,0x32,0x2e,0x30,0x29,0x29,0x20,
+    0x2a,0x20,0x31,0x2e,0x35,0x32,0x35,0x38,0x37,0x38,0x39,0x30,0x36,0x32,0x35,0x65,
+    0x2d,0x30,0x35,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x63,0x6f,
+    0x6c,0x6f,0x72,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x63,0x6f,0x6c,0x6f,0x72,0x30,0x20,
+    0x2a,0x20,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x2e,0x74,0x69,0x6e,0x74,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6f,0x75,0x74,0x3b,0x0a,
+    0x7d,0x0a,0x0a,0x00,
+};
 #elif defined(SOKOL_D3D11)
 /*
     static float4 gl_Position;
@@ -3696,6 +4045,95 @@ static const uint8_t _sdtx_fs_bytecode_hlsl4[608] = {
     0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
     0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 };
+/*
+    cbuffer vs_params : register(b0)
+    {
+        float4 scale;
+        float4 offset;
+        float4 tint;
+    };
+
+    struct vs_in
+    {
+        int2 position : TEXCOORD0;
+        uint4 glyph : TEXCOORD1;
+        float4 color0 : TEXCOORD2;
+        uint vertex_id : SV_VertexID;
+    };
+
+    struct vs_out
+    {
+        float2 uv : TEXCOORD0;
+        float4 color : TEXCOORD1;
+        float4 gl_Position : SV_Position;
+    };
+
+    vs_out main(vs_in inp)
+    {
+        vs_out outp;
+        float2 corner = float2(float((0x16u >> inp.vertex_id) & 1u), float((0x34u >> inp.vertex_id) & 1u));
+        float2 pos = ((float2(inp.position) + offset.xy) + (corner * 32.0f)) * scale.xy;
+        outp.gl_Position = float4(mad(pos, float2(2.0f, -2.0f), float2(-1.0f, 1.0f)), 0.0f, 1.0f);
+        outp.uv = mad(float2(inp.glyph.xy) + corner, scale.zw, (1.0f - (corner * 2.0f)) * 1.52587890625e-05f);
+        outp.color = inp.color0 * tint;
+        return outp;
+    }
+*/
+static const uint8_t _sdtx_vs_inst_source_hlsl4[842] = {
+    0x63,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x73,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x62,0x30,0x29,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x73,0x63,
+    0x61,0x6c,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
+    0x6f,0x66,0x66,0x73,0x65,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x34,0x20,0x74,0x69,0x6e,0x74,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,
+    0x75,0x63,0x74,0x20,0x76,0x73,0x5f,0x69,0x6e,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x69,0x6e,0x74,0x32,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3a,0x20,
+    0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,
+    0x69,0x6e,0x74,0x34,0x20,0x67,0x6c,0x79,0x70,0x68,0x20,0x3a,0x20,0x54,0x45,0x58,
+    0x43,0x4f,0x4f,0x52,0x44,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x30,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,
+    0x4f,0x4f,0x52,0x44,0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,
+    0x76,0x65,0x72,0x74,0x65,0x78,0x5f,0x69,0x64,0x20,0x3a,0x20,0x53,0x56,0x5f,0x56,
+    0x65,0x72,0x74,0x65,0x78,0x49,0x44,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,
+    0x75,0x63,0x74,0x20,0x76,0x73,0x5f,0x6f,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x75,0x76,0x20,0x3a,0x20,0x54,0x45,0x58,
+    0x43,0x4f,0x4f,0x52,0x44,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,
+    0x4f,0x52,0x44,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,
+    0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3a,0x20,0x53,
+    0x56,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,
+    0x76,0x73,0x5f,0x6f,0x75,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x76,0x73,0x5f,0x69,
+    0x6e,0x20,0x69,0x6e,0x70,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x73,0x5f,
+    0x6f,0x75,0x74,0x20,0x6f,0x75,0x74,0x70,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x32,0x20,0x63,0x6f,0x72,0x6e,0x65,0x72,0x20,0x3d,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x32,0x28,0x66,0x6c,0x6f,0x61,0x74,0x28,0x28,0x30,0x78,0x31,0x36,
+    0x75,0x20,0x3e,0x3e,0x20,0x69,0x6e,0x70,0x2e,0x76,0x65,0x72,0x74,0x65,0x78,0x5f,
+    0x69,0x64,0x29,0x20,0x26,0x20,0x31,0x75,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x28,0x28,0x30,0x78,0x33,0x34,0x75,0x20,0x3e,0x3e,0x20,0x69,0x6e,0x70,0x2e,0x76,
+    0x65,0x72,0x74,0x65,0x78,0x5f,0x69,0x64,0x29,0x20,0x26,0x20,0x31,0x75,0x29,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x6f,0x73,
+    0x20,0x3d,0x20,0x28,0x28,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x69,0x6e,0x70,0x2e,
+    0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x29,0x20,0x2b,0x20,0x6f,0x66,0x66,0x73,
+    0x65,0x74,0x2e,0x78,0x79,0x29,0x20,0x2b,0x20,0x28,0x63,0x6f,0x72,0x6e,0x65,0x72,
+    0x20,0x2a,0x20,0x33,0x32,0x2e,0x30,0x66,0x29,0x29,0x20,0x2a,0x20,0x73,0x63,0x61,
+    0x6c,0x65,0x2e,0x78,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x70,0x2e,
+    0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x34,0x28,0x6d,0x61,0x64,0x28,0x70,0x6f,0x73,0x2c,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x32,0x28,0x32,0x2e,0x30,0x66,0x2c,0x20,0x2d,0x32,0x2e,0x30,0x66,
+    0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x2d,0x31,0x2e,0x30,0x66,0x2c,
+    0x20,0x31,0x2e,0x30,0x66,0x29,0x29,0x2c,0x20,0x30,0x2e,0x30,0x66,0x2c,0x20,0x31,
+    0x2e,0x30,0x66,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x70,0x2e,0x75,
+    0x76,0x20,0x3d,0x20,0x6d,0x61,0x64,0x28,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x69,
+    0x6e,0x70,0x2e,0x67,0x6c,0x79,0x70,0x68,0x2e,0x78,0x79,0x29,0x20,0x2b,0x20,0x63,
+    0x6f,0x72,0x6e,0x65,0x72,0x2c,0x20,0x73,0x63,0x61,0x6c,0x65,0x2e,0x7a,0x77,0x2c,
+    0x20,0x28,0x31,0x2e,0x30,0x66,0x20,0x2d,0x20,0x28,0x63,0x6f,0x72,0x6e,0x65,0x72,
+    0x20,0x2a,0x20,0x32,0x2e,0x30,0x66,0x29,0x29,0x20,0x2a,0x20,0x31,0x2e,0x35,0x32,
+    0x35,0x38,0x37,0x38,0x39,0x30,0x36,0x32,0x35,0x65,0x2d,0x30,0x35,0x66,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x70,0x2e,0x63,0x6f,0x6c,0x6f,0x72,0x20,
+    0x3d,0x20,0x69,0x6e,0x70,0x2e,0x63,0x6f,0x6c,0x6f,0x72,0x30,0x20,0x2a,0x20,0x74,
+    0x69,0x6e,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,
+    0x6f,0x75,0x74,0x70,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
 #elif defined(SOKOL_WGPU)
 /*
     diagnostic(off, derivative_uniformity);
@@ -3880,9 +4318,100 @@ static const uint8_t _sdtx_fs_source_wgsl[663] = {
     0x6e,0x5f,0x6f,0x75,0x74,0x28,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,
     0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
 };
+/*
+    diagnostic(off, derivative_uniformity);
+
+    struct vs_params {
+      scale : vec4f,
+      offset : vec4f,
+      tint : vec4f,
+    }
+
+    @group(0) @binding(0) var<uniform> x_params : vs_params;
+
+    struct main_out {
+      @builtin(position)
+      gl_Position : vec4f,
+      @location(0)
+      uv_1 : vec2f,
+      @location(1)
+      color_1 : vec4f,
+    }
+
+    @vertex
+    fn main(@builtin(vertex_index) vertex_index : u32, @location(0) position_param : vec2i, @location(1) glyph_param : vec4u, @location(2) color0_param : vec4f) -> main_out {
+      let corner : vec2f = vec2f(f32((0x16u >> vertex_index) & 1u), f32((0x34u >> vertex_index) & 1u));
+      let pos : vec2f = (((vec2f(position_param) + x_params.offset.xy) + (corner * 32.0f)) * x_params.scale.xy);
+      let uv : vec2f = (((vec2f(glyph_param.xy) + corner) * x_params.scale.zw) + ((vec2f(1.0f) - (corner * 2.0f)) * 1.52587890625e-05f));
+      return main_out(vec4f(((pos * vec2f(2.0f, -2.0f)) + vec2f(-1.0f, 1.0f)), 0.0f, 1.0f), uv, (color0_param * x_params.tint));
+    }
+*/
+static const uint8_t _sdtx_vs_inst_source_wgsl[953] = {
+    0x64,0x69,0x61,0x67,0x6e,0x6f,0x73,0x74,0x69,0x63,0x28,0x6f,0x66,0x66,0x2c,0x20,
+    0x64,0x65,0x72,0x69,0x76,0x61,0x74,0x69,0x76,0x65,0x5f,0x75,0x6e,0x69,0x66,0x6f,
+    0x72,0x6d,0x69,0x74,0x79,0x29,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,
+    0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x20,0x7b,0x0a,0x20,0x20,0x73,0x63,
+    0x61,0x6c,0x65,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x0a,0x20,0x20,0x6f,
+    0x66,0x66,0x73,0x65,0x74,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x0a,0x20,
+    0x20,0x74,0x69,0x6e,0x74,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x0a,0x7d,
+    0x0a,0x0a,0x40,0x67,0x72,0x6f,0x75,0x70,0x28,0x30,0x29,0x20,0x40,0x62,0x69,0x6e,
+    0x64,0x69,0x6e,0x67,0x28,0x30,0x29,0x20,0x76,0x61,0x72,0x3c,0x75,0x6e,0x69,0x66,
+    0x6f,0x72,0x6d,0x3e,0x20,0x78,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x20,0x3a,0x20,
+    0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,
+    0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x6f,0x75,0x74,0x20,0x7b,0x0a,0x20,0x20,
+    0x40,0x62,0x75,0x69,0x6c,0x74,0x69,0x6e,0x28,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,
+    0x6e,0x29,0x0a,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,
+    0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x0a,0x20,0x20,0x40,0x6c,0x6f,0x63,
+    0x61,0x74,0x69,0x6f,0x6e,0x28,0x30,0x29,0x0a,0x20,0x20,0x75,0x76,0x5f,0x31,0x20,
+    0x3a,0x20,0x76,0x65,0x63,0x32,0x66,0x2c,0x0a,0x20,0x20,0x40,0x6c,0x6f,0x63,0x61,
+    0x74,0x69,0x6f,0x6e,0x28,0x31,0x29,0x0a,0x20,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x5f,
+    0x31,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x66,0x2c,0x0a,0x7d,0x0a,0x0a,0x40,0x76,
+    0x65,0x72,0x74,0x65,0x78,0x0a,0x66,0x6e,0x20,0x6d,0x61,0x69,0x6e,0x28,0x40,0x62,
+    0x75,0x69,0x6c,0x74,0x69,0x6e,0x28,0x76,0x65,0x72,0x74,0x65,0x78,0x5f,0x69,0x6e,
+    0x64,0x65,0x78,0x29,0x20,0x76,0x65,0x72,0x74,0x65,0x78,0x5f,0x69,0x6e,0x64,0x65,
+    0x78,0x20,0x3a,0x20,0x75,0x33,0x32,0x2c,0x20,0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,
+    0x6f,0x6e,0x28,0x30,0x29,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x70,
+    0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,0x32,0x69,0x2c,0x20,0x40,0x6c,
+    0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x31,0x29,0x20,0x67,0x6c,0x79,0x70,0x68,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,0x75,0x2c,0x20,
+    0x40,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x28,0x32,0x29,0x20,0x63,0x6f,0x6c,
+    0x6f,0x72,0x30,0x5f,0x70,0x61,0x72,0x61,0x6d,0x20,0x3a,0x20,0x76,0x65,0x63,0x34,
+    0x66,0x29,0x20,0x2d,0x3e,0x20,0x6d,0x61,0x69,0x6e,0x5f,0x6f,0x75,0x74,0x20,0x7b,
+    0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,0x63,0x6f,0x72,0x6e,0x65,0x72,0x20,0x3a,0x20,
+    0x76,0x65,0x63,0x32,0x66,0x20,0x3d,0x20,0x76,0x65,0x63,0x32,0x66,0x28,0x66,0x33,
+    0x32,0x28,0x28,0x30,0x78,0x31,0x36,0x75,0x20,0x3e,0x3e,0x20,0x76,0x65,0x72,0x74,
+    0x65,0x78,0x5f,0x69,0x6e,0x64,0x65,0x78,0x29,0x20,0x26,0x20,0x31,0x75,0x29,0x2c,
+    0x20,0x66,0x33,0x32,0x28,0x28,0x30,0x78,0x33,0x34,0x75,0x20,0x3e,0x3e,0x20,0x76,
+    0x65,0x72,0x74,0x65,0x78,0x5f,0x69,0x6e,0x64,0x65,0x78,0x29,0x20,0x26,0x20,0x31,
+    0x75,0x29,0x29,0x3b,0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,0x70,0x6f,0x73,0x20,0x3a,
+    0x20,0x76,0x65,0x63,0x32,0x66,0x20,0x3d,0x20,0x28,0x28,0x28,0x76,0x65,0x63,0x32,
+    0x66,0x28,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x29,0x20,0x2b,0x20,0x78,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x2e,0x6f,0x66,0x66,
+    0x73,0x65,0x74,0x2e,0x78,0x79,0x29,0x20,0x2b,0x20,0x28,0x63,0x6f,0x72,0x6e,0x65,
+    0x72,0x20,0x2a,0x20,0x33,0x32,0x2e,0x30,0x66,0x29,0x29,0x20,0x2a,0x20,0x78,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x73,0x2e,0x73,0x63,0x61,0x6c,0x65,0x2e,0x78,0x79,0x29,
+    0x3b,0x0a,0x20,0x20,0x6c,0x65,0x74,0x20,0x75,0x76,0x20,0x3a,0x20,0x76,0x65,0x63,
+    0x32,0x66,0x20,0x3d,0x20,0x28,0x28,0x28,0x76,0x65,0x63,0x32,0x66,0x28,0x67,0x6c,
+    0x79,0x70,0x68,0x5f,0x70,0x61,0x72,0x61,0x6d,0x2e,0x78,0x79,0x29,0x20,0x2b,0x20,
+    0x63,0x6f,0x72,0x6e,0x65,0x72,0x29,0x20,0x2a,0x20,0x78,0x5f,0x70,0x61,0x72,0x61,
+    0x6d,0x73,0x2e,0x73,0x63,0x61,0x6c,0x65,0x2e,0x7a,0x77,0x29,0x20,0x2b,0x20,0x28,
+    0x28,0x76,0x65,0x63,0x32,0x66,0x28,0x31,0x2e,0x30,0x66,0x29,0x20,0x2d,0x20,0x28,
+    0x63,0x6f,0x72,0x6e,0x65,0x72,0x20,0x2a,0x20,0x32,0x2e,0x30,0x66,0x29,0x29,0x20,
+    0x2a,0x20,0x31,0x2e,0x35,0x32,0x35,0x38,0x37,0x38,0x39,0x30,0x36,0x32,0x35,0x65,
+    0x2d,0x30,0x35,0x66,0x29,0x29,0x3b,0x0a,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,
+    0x20,0x6d,0x61,0x69,0x6e,0x5f,0x6f,0x75,0x74,0x28,0x76,0x65,0x63,0x34,0x66,0x28,
+    0x28,0x28,0x70,0x6f,0x73,0x20,0x2a,0x20,0x76,0x65,0x63,0x32,0x66,0x28,0x32,0x2e,
+    0x30,0x66,0x2c,0x20,0x2d,0x32,0x2e,0x30,0x66,0x29,0x29,0x20,0x2b,0x20,0x76,0x65,
+    0x63,0x32,0x66,0x28,0x2d,0x31,0x2e,0x30,0x66,0x2c,0x20,0x31,0x2e,0x30,0x66,0x29,
+    0x29,0x2c,0x20,0x30,0x2e,0x30,0x66,0x2c,0x20,0x31,0x2e,0x30,0x66,0x29,0x2c,0x20,
+    0x75,0x76,0x2c,0x20,0x28,0x63,0x6f,0x6c,0x6f,0x72,0x30,0x5f,0x70,0x61,0x72,0x61,
+    0x6d,0x20,0x2a,0x20,0x78,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x2e,0x74,0x69,0x6e,
+    0x74,0x29,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
 #elif defined(SOKOL_DUMMY_BACKEND)
 static const char* _sdtx_vs_src_dummy = "";
 static const char* _sdtx_fs_src_dummy = "";
+static const char* _sdtx_vs_inst_src_dummy = "";
 #else
 #error "Please define one of SOKOL_GLCORE, SOKOL_GLES3, SOKOL_D3D11, SOKOL_METAL, SOKOL_WGPU or SOKOL_DUMMY_BACKEND!"
 #endif
@@ -3916,10 +4445,29 @@ typedef struct {
     uint32_t color;
 } _sdtx_vertex_t;
 
+// per-character instance data in instanced mode, position is in quarter-pixel canvas units
+typedef struct {
+    int16_t x, y;
+    uint8_t chr, font;
+    uint8_t pad[2];
+    uint32_t color;
+} _sdtx_instance_t;
+
+// vertex shader uniforms in instanced mode
+typedef struct {
+    float pos_scale[2];     // quarter-pixel canvas units to 0..1
+    float uv_scale[2];      // glyph cell size in font texture
+    float offset[2];        // position offset in quarter-pixel canvas units
+    float _pad[2];
+    float tint[4];          // multiplied with the character color
+} _sdtx_vs_params_t;
+
+// NOTE: in instanced mode first_vertex and num_vertices count instances
 typedef struct {
     int layer_id;
     int first_vertex;
     int num_vertices;
+    _sdtx_float2_t canvas_size;
 } _sdtx_command_t;
 
 typedef struct {
@@ -3932,13 +4480,27 @@ typedef struct {
         int next;
         _sdtx_vertex_t* ptr;
     } vertices;
+    struct {
+        int cap;
+        int next;
+        _sdtx_instance_t* ptr;
+    } instances;
     struct {
         int cap;
         int next;
         _sdtx_command_t* ptr;
     } commands;
+    struct {
+        bool active;
+        int cap;
+        int next;
+        _sdtx_instance_t* ptr;      // allocated on first use
+        _sdtx_float2_t origin;      // saved origin and cursor position
+        _sdtx_float2_t pos;
+    } block;
     sg_buffer vbuf;
     sg_pipeline pip;
+    sg_pipeline block_pip;          // instanced pipeline for non-instanced contexts, created on demand
     int cur_font;
     int cur_layer_id;
     _sdtx_float2_t canvas_size;
@@ -3954,18 +4516,31 @@ typedef struct {
     _sdtx_context_t* contexts;
 } _sdtx_context_pool_t;
 
+typedef struct {
+    _sdtx_slot_t slot;
+    sg_buffer vbuf;     // may be invalid for empty blocks
+    int num_chars;
+} _sdtx_block_t;
+
+typedef struct {
+    _sdtx_pool_t pool;
+    _sdtx_block_t* blocks;
+} _sdtx_block_pool_t;
+
 typedef struct {
     uint32_t init_cookie;
     sdtx_desc_t desc;
     sg_image font_img;
     sg_sampler font_smp;
     sg_shader shader;
+    sg_shader inst_shader;      // created on demand for instanced contexts
     uint32_t fmt_buf_size;
     char* fmt_buf;
     sdtx_context def_ctx_id;
     sdtx_context cur_ctx_id;
     _sdtx_context_t* cur_ctx;   // may be 0!
     _sdtx_context_pool_t context_pool;
+    _sdtx_block_pool_t block_pool;
     uint8_t font_pixels[SDTX_MAX_FONTS * 256 * 8 * 8];
 } _sdtx_t;
 static _sdtx_t _sdtx;
@@ -4127,6 +4702,22 @@ static void _sdtx_discard_context_pool(void) {
     _sdtx_discard_pool(&_sdtx.context_pool.pool);
 }
 
+static void _sdtx_setup_block_pool(const sdtx_desc_t* desc) {
+    SOKOL_ASSERT(desc);
+    // note: the pool will have an additional item, since slot 0 is reserved
+    SOKOL_ASSERT((desc->block_pool_size > 0) && (desc->block_pool_size < _SDTX_MAX_POOL_SIZE));
+    _sdtx_init_pool(&_sdtx.block_pool.pool, desc->block_pool_size);
+    size_t pool_byte_size = sizeof(_sdtx_block_t) * (size_t)_sdtx.block_pool.pool.size;
+    _sdtx.block_pool.blocks = (_sdtx_block_t*) _sdtx_malloc_clear(pool_byte_size);
+}
+
+static void _sdtx_discard_block_pool(void) {
+    SOKOL_ASSERT(_sdtx.block_pool.blocks);
+    _sdtx_free(_sdtx.block_pool.blocks);
+    _sdtx.block_pool.blocks = 0;
+    _sdtx_discard_pool(&_sdtx.block_pool.pool);
+}
+
 /* allocate the slot at slot_index:
     - bump the slot's generation counter
     - create a resource id from the generation counter and slot index
@@ -4181,6 +4772,19 @@ static sdtx_context _sdtx_make_ctx_id(uint32_t ctx_id) {
     return ctx;
 }
 
+// get block pointer with id-check, returns 0 if no match
+static _sdtx_block_t* _sdtx_lookup_block(uint32_t block_id) {
+    if (SG_INVALID_ID != block_id) {
+        int slot_index = _sdtx_slot_index(block_id);
+        SOKOL_ASSERT((slot_index > _SDTX_INVALID_SLOT_INDEX) && (slot_index < _sdtx.block_pool.pool.size));
+        _sdtx_block_t* block = &_sdtx.block_pool.blocks[slot_index];
+        if (block->slot.id == block_id) {
+            return block;
+        }
+    }
+    return 0;
+}
+
 static sdtx_context _sdtx_alloc_context(void) {
     sdtx_context ctx_id;
     int slot_index = _sdtx_pool_alloc_index(&_sdtx.context_pool.pool);
@@ -4214,6 +4818,7 @@ static void _sdtx_rewind(_sdtx_context_t* ctx) {
     SOKOL_ASSERT(ctx);
     ctx->frame_id++;
     ctx->vertices.next = 0;
+    ctx->instances.next = 0;
     ctx->commands.next = 0;
     _sdtx_set_layer(ctx, 0);
     ctx->cur_font = 0;
@@ -4233,6 +4838,42 @@ static sg_commit_listener _sdtx_make_commit_listener(_sdtx_context_t* ctx) {
     return listener;
 }
 
+static sg_shader _sdtx_make_inst_shader(void);
+static sg_pipeline _sdtx_make_pipeline(const sdtx_context_desc_t* desc, bool instanced) {
+    sg_pipeline_desc pip_desc;
+    _sdtx_clear(&pip_desc, sizeof(pip_desc));
+    if (instanced) {
+        if (SG_INVALID_ID == _sdtx.inst_shader.id) {
+            _sdtx.inst_shader = _sdtx_make_inst_shader();
+        }
+        pip_desc.layout.buffers[0].stride = sizeof(_sdtx_instance_t);
+        pip_desc.layout.buffers[0].step_func = SG_VERTEXSTEP_PER_INSTANCE;
+        pip_desc.layout.attrs[0].format = SG_VERTEXFORMAT_SHORT2;
+        pip_desc.layout.attrs[1].format = SG_VERTEXFORMAT_UBYTE4;
+        pip_desc.layout.attrs[2].format = SG_VERTEXFORMAT_UBYTE4N;
+        pip_desc.shader = _sdtx.inst_shader;
+    } else {
+        pip_desc.layout.buffers[0].stride = sizeof(_sdtx_vertex_t);
+        pip_desc.layout.attrs[0].format = SG_VERTEXFORMAT_FLOAT2;
+        pip_desc.layout.attrs[1].format = SG_VERTEXFORMAT_USHORT2N;
+        pip_desc.layout.attrs[2].format = SG_VERTEXFORMAT_UBYTE4N;
+        pip_desc.shader = _sdtx.shader;
+    }
+    pip_desc.index_type = SG_INDEXTYPE_NONE;
+    pip_desc.sample_count = desc->sample_count;
+    pip_desc.depth.pixel_format = desc->depth_format;
+    pip_desc.colors[0].pixel_format = desc->color_format;
+    pip_desc.colors[0].blend.enabled = true;
+    pip_desc.colors[0].blend.src_factor_rgb = SG_BLENDFACTOR_SRC_ALPHA;
+    pip_desc.colors[0].blend.dst_factor_rgb = SG_BLENDFACTOR_ONE_MINUS_SRC_ALPHA;
+    pip_desc.colors[0].blend.src_factor_alpha = SG_BLENDFACTOR_ONE;
+    pip_desc.colors[0].blend.dst_factor_alpha = SG_BLENDFACTOR_ZERO;
+    pip_desc.label = "sdtx-pipeline";
+    sg_pipeline pip = sg_make_pipeline(&pip_desc);
+    SOKOL_ASSERT(SG_INVALID_ID != pip.id);
+    return pip;
+}
+
 static void _sdtx_init_context(sdtx_context ctx_id, const sdtx_context_desc_t* in_desc) {
     sg_push_debug_group("sokol-debugtext");
 
@@ -4243,9 +4884,22 @@ static void _sdtx_init_context(sdtx_context ctx_id, const sdtx_context_desc_t* i
     // NOTE: frame_id must be non-zero, so that updates trigger in first frame
     ctx->frame_id = 1;
 
-    ctx->vertices.cap = 6 * ctx->desc.char_buf_size;
-    const size_t vbuf_size = (size_t)ctx->vertices.cap * sizeof(_sdtx_vertex_t);
-    ctx->vertices.ptr = (_sdtx_vertex_t*) _sdtx_malloc(vbuf_size);
+    size_t vbuf_size;
+    if (ctx->desc.instanced) {
+        ctx->instances.cap = ctx->desc.char_buf_size;
+        vbuf_size = (size_t)ctx->instances.cap * sizeof(_sdtx_instance_t);
+        ctx->instances.ptr = (_sdtx_instance_t*) _sdtx_malloc(vbuf_size);
+    } else {
+        ctx->vertices.cap = 6 * ctx->desc.char_buf_size;
+        vbuf_size = (size_t)ctx->vertices.cap * sizeof(_sdtx_vertex_t);
+        ctx->vertices.ptr = (_sdtx_vertex_t*) _sdtx_malloc(vbuf_size);
+    }
+
+    // NOTE: the canvas size must be known before the first draw command is started
+    ctx->canvas_size.x = ctx->desc.canvas_width;
+    ctx->canvas_size.y = ctx->desc.canvas_height;
+    ctx->glyph_size.x = 8.0f / ctx->canvas_size.x;
+    ctx->glyph_size.y = 8.0f / ctx->canvas_size.y;
 
     ctx->commands.cap = ctx->desc.max_commands;
     ctx->commands.ptr = (_sdtx_command_t*) _sdtx_malloc((size_t)ctx->commands.cap * sizeof(_sdtx_command_t));
@@ -4260,30 +4914,8 @@ static void _sdtx_init_context(sdtx_context ctx_id, const sdtx_context_desc_t* i
     ctx->vbuf = sg_make_buffer(&vbuf_desc);
     SOKOL_ASSERT(SG_INVALID_ID != ctx->vbuf.id);
 
-    sg_pipeline_desc pip_desc;
-    _sdtx_clear(&pip_desc, sizeof(pip_desc));
-    pip_desc.layout.buffers[0].stride = sizeof(_sdtx_vertex_t);
-    pip_desc.layout.attrs[0].format = SG_VERTEXFORMAT_FLOAT2;
-    pip_desc.layout.attrs[1].format = SG_VERTEXFORMAT_USHORT2N;
-    pip_desc.layout.attrs[2].format = SG_VERTEXFORMAT_UBYTE4N;
-    pip_desc.shader = _sdtx.shader;
-    pip_desc.index_type = SG_INDEXTYPE_NONE;
-    pip_desc.sample_count = ctx->desc.sample_count;
-    pip_desc.depth.pixel_format = ctx->desc.depth_format;
-    pip_desc.colors[0].pixel_format = ctx->desc.color_format;
-    pip_desc.colors[0].blend.enabled = true;
-    pip_desc.colors[0].blend.src_factor_rgb = SG_BLENDFACTOR_SRC_ALPHA;
-    pip_desc.colors[0].blend.dst_factor_rgb = SG_BLENDFACTOR_ONE_MINUS_SRC_ALPHA;
-    pip_desc.colors[0].blend.src_factor_alpha = SG_BLENDFACTOR_ONE;
-    pip_desc.colors[0].blend.dst_factor_alpha = SG_BLENDFACTOR_ZERO;
-    pip_desc.label = "sdtx-pipeline";
-    ctx->pip = sg_make_pipeline(&pip_desc);
-    SOKOL_ASSERT(SG_INVALID_ID != ctx->pip.id);
+    ctx->pip = _sdtx_make_pipeline(&ctx->desc, ctx->desc.instanced);
 
-    ctx->canvas_size.x = ctx->desc.canvas_width;
-    ctx->canvas_size.y = ctx->desc.canvas_height;
-    ctx->glyph_size.x = 8.0f / ctx->canvas_size.x;
-    ctx->glyph_size.y = 8.0f / ctx->canvas_size.y;
     ctx->tab_width = (float) ctx->desc.tab_width;
     ctx->color = _SDTX_DEFAULT_COLOR;
 
@@ -4302,15 +4934,30 @@ static void _sdtx_destroy_context(sdtx_context ctx_id) {
             ctx->vertices.cap = 0;
             ctx->vertices.next = 0;
         }
+        if (ctx->instances.ptr) {
+            _sdtx_free(ctx->instances.ptr);
+            ctx->instances.ptr = 0;
+            ctx->instances.cap = 0;
+            ctx->instances.next = 0;
+        }
         if (ctx->commands.ptr) {
             _sdtx_free(ctx->commands.ptr);
             ctx->commands.ptr = 0;
             ctx->commands.cap = 0;
             ctx->commands.next = 0;
         }
+        if (ctx->block.ptr) {
+            _sdtx_free(ctx->block.ptr);
+            ctx->block.ptr = 0;
+            ctx->block.cap = 0;
+            ctx->block.next = 0;
+        }
         sg_push_debug_group("sokol_debugtext");
         sg_destroy_buffer(ctx->vbuf);
         sg_destroy_pipeline(ctx->pip);
+        if (SG_INVALID_ID != ctx->block_pip.id) {
+            sg_destroy_pipeline(ctx->block_pip);
+        }
         sg_remove_commit_listener(_sdtx_make_commit_listener(ctx));
         sg_pop_debug_group();
         _sdtx_clear(ctx, sizeof(*ctx));
@@ -4347,6 +4994,87 @@ static void _sdtx_unpack_font(const sdtx_font_desc_t* font_desc, uint8_t* out_pi
     }
 }
 
+// shader desc items shared by the regular and the instanced shader
+static void _sdtx_init_shader_desc(sg_shader_desc* shd_desc, const char* label) {
+    _sdtx_clear(shd_desc, sizeof(sg_shader_desc));
+    shd_desc->label = label;
+    shd_desc->attrs[0].glsl_name = "position";
+    shd_desc->attrs[1].glsl_name = "texcoord0";
+    shd_desc->attrs[2].glsl_name = "color0";
+    shd_desc->attrs[0].hlsl_sem_name = "TEXCOORD";
+    shd_desc->attrs[0].hlsl_sem_index = 0;
+    shd_desc->attrs[1].hlsl_sem_name = "TEXCOORD";
+    shd_desc->attrs[1].hlsl_sem_index = 1;
+    shd_desc->attrs[2].hlsl_sem_name = "TEXCOORD";
+    shd_desc->attrs[2].hlsl_sem_index = 2;
+    shd_desc->images[0].stage = SG_SHADERSTAGE_FRAGMENT;
+    shd_desc->images[0].image_type = SG_IMAGETYPE_2D;
+    shd_desc->images[0].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+    shd_desc->images[0].hlsl_register_t_n = 0;
+    shd_desc->images[0].msl_texture_n = 0;
+    shd_desc->images[0].wgsl_group1_binding_n = 64;
+    shd_desc->samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+    shd_desc->samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
+    shd_desc->samplers[0].hlsl_register_s_n = 0;
+    shd_desc->samplers[0].msl_sampler_n = 0;
+    shd_desc->samplers[0].wgsl_group1_binding_n = 80;
+    shd_desc->image_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+    shd_desc->image_sampler_pairs[0].image_slot = 0;
+    shd_desc->image_sampler_pairs[0].sampler_slot = 0;
+    shd_desc->image_sampler_pairs[0].glsl_name = "tex_smp";
+}
+
+// the instanced vertex shader is always provided as source code, and shares the fragment shader
+static sg_shader _sdtx_make_inst_shader(void) {
+    sg_push_debug_group("sokol-debugtext");
+    sg_shader_desc shd_desc;
+    _sdtx_init_shader_desc(&shd_desc, "sokol-debugtext-instanced-shader");
+    shd_desc.attrs[1].glsl_name = "glyph";
+    shd_desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
+    shd_desc.uniform_blocks[0].size = sizeof(_sdtx_vs_params_t);
+    shd_desc.uniform_blocks[0].hlsl_register_b_n = 0;
+    shd_desc.uniform_blocks[0].msl_buffer_n = 0;
+    shd_desc.uniform_blocks[0].wgsl_group0_binding_n = 0;
+    shd_desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "vs_params";
+    shd_desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+    shd_desc.uniform_blocks[0].glsl_uniforms[0].array_count = 3;
+    #if defined(SOKOL_GLCORE)
+        shd_desc.vertex_func.source = (const char*)_sdtx_vs_inst_source_glsl410;
+        shd_desc.fragment_func.source = (const char*)_sdtx_fs_source_glsl410;
+    #elif defined(SOKOL_GLES3)
+        shd_desc.vertex_func.source = (const char*)_sdtx_vs_inst_source_glsl300es;
+        shd_desc.fragment_func.source = (const char*)_sdtx_fs_source_glsl300es;
+    #elif defined(SOKOL_METAL)
+        shd_desc.vertex_func.entry = "main0";
+        shd_desc.fragment_func.entry = "main0";
+        shd_desc.vertex_func.source = (const char*)_sdtx_vs_inst_source_metal;
+        switch (sg_query_backend()) {
+            case SG_BACKEND_METAL_MACOS:
+                shd_desc.fragment_func.bytecode = SG_RANGE(_sdtx_fs_bytecode_metal_macos);
+                break;
+            case SG_BACKEND_METAL_IOS:
+                shd_desc.fragment_func.bytecode = SG_RANGE(_sdtx_fs_bytecode_metal_ios);
+                break;
+            default:
+                shd_desc.fragment_func.source = (const char*)_sdtx_fs_source_metal_sim;
+                break;
+        }
+    #elif defined(SOKOL_D3D11)
+        shd_desc.vertex_func.source = (const char*)_sdtx_vs_inst_source_hlsl4;
+        shd_desc.fragment_func.bytecode = SG_RANGE(_sdtx_fs_bytecode_hlsl4);
+    #elif defined(SOKOL_WGPU)
+        shd_desc.vertex_func.source = (const char*)_sdtx_vs_inst_source_wgsl;
+        shd_desc.fragment_func.source = (const char*)_sdtx_fs_source_wgsl;
+    #else
+        shd_desc.vertex_func.source = _sdtx_vs_inst_src_dummy;
+        shd_desc.fragment_func.source = _sdtx_fs_src_dummy;
+    #endif
+    sg_shader shd = sg_make_shader(&shd_desc);
+    SOKOL_ASSERT(SG_INVALID_ID != shd.id);
+    sg_pop_debug_group();
+    return shd;
+}
+
 static void _sdtx_setup_common(void) {
 
     // common printf formatting buffer
@@ -4357,32 +5085,7 @@ static void _sdtx_setup_common(void) {
 
     // common shader for all contexts
     sg_shader_desc shd_desc;
-    _sdtx_clear(&shd_desc, sizeof(shd_desc));
-    shd_desc.label = "sokol-debugtext-shader";
-    shd_desc.attrs[0].glsl_name = "position";
-    shd_desc.attrs[1].glsl_name = "texcoord0";
-    shd_desc.attrs[2].glsl_name = "color0";
-    shd_desc.attrs[0].hlsl_sem_name = "TEXCOORD";
-    shd_desc.attrs[0].hlsl_sem_index = 0;
-    shd_desc.attrs[1].hlsl_sem_name = "TEXCOORD";
-    shd_desc.attrs[1].hlsl_sem_index = 1;
-    shd_desc.attrs[2].hlsl_sem_name = "TEXCOORD";
-    shd_desc.attrs[2].hlsl_sem_index = 2;
-    shd_desc.images[0].stage = SG_SHADERSTAGE_FRAGMENT;
-    shd_desc.images[0].image_type = SG_IMAGETYPE_2D;
-    shd_desc.images[0].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
-    shd_desc.images[0].hlsl_register_t_n = 0;
-    shd_desc.images[0].msl_texture_n = 0;
-    shd_desc.images[0].wgsl_group1_binding_n = 64;
-    shd_desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
-    shd_desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
-    shd_desc.samplers[0].hlsl_register_s_n = 0;
-    shd_desc.samplers[0].msl_sampler_n = 0;
-    shd_desc.samplers[0].wgsl_group1_binding_n = 80;
-    shd_desc.image_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
-    shd_desc.image_sampler_pairs[0].image_slot = 0;
-    shd_desc.image_sampler_pairs[0].sampler_slot = 0;
-    shd_desc.image_sampler_pairs[0].glsl_name = "tex_smp";
+    _sdtx_init_shader_desc(&shd_desc, "sokol-debugtext-shader");
     #if defined(SOKOL_GLCORE)
         shd_desc.vertex_func.source = (const char*)_sdtx_vs_source_glsl410;
         shd_desc.fragment_func.source = (const char*)_sdtx_fs_source_glsl410;
@@ -4457,6 +5160,9 @@ static void _sdtx_discard_common(void) {
     sg_destroy_sampler(_sdtx.font_smp);
     sg_destroy_image(_sdtx.font_img);
     sg_destroy_shader(_sdtx.shader);
+    if (SG_INVALID_ID != _sdtx.inst_shader.id) {
+        sg_destroy_shader(_sdtx.inst_shader);
+    }
     if (_sdtx.fmt_buf) {
         _sdtx_free(_sdtx.fmt_buf);
         _sdtx.fmt_buf = 0;
@@ -4510,6 +5216,14 @@ static _sdtx_vertex_t* _sdtx_next_vertex(_sdtx_context_t* ctx) {
     }
 }
 
+static _sdtx_instance_t* _sdtx_next_instance(_sdtx_context_t* ctx) {
+    if (ctx->instances.next < ctx->instances.cap) {
+        return &ctx->instances.ptr[ctx->instances.next++];
+    } else {
+        return 0;
+    }
+}
+
 static _sdtx_command_t* _sdtx_cur_command(_sdtx_context_t* ctx) {
     if (ctx->commands.next > 0) {
         return &ctx->commands.ptr[ctx->commands.next - 1];
@@ -4527,13 +5241,17 @@ static _sdtx_command_t* _sdtx_next_command(_sdtx_context_t* ctx) {
     }
 }
 
+// NOTE: in instanced mode, the canvas size is a shader uniform, so a canvas size change also starts a new draw command
 static void _sdtx_set_layer(_sdtx_context_t* ctx, int layer_id) {
     ctx->cur_layer_id = layer_id;
     _sdtx_command_t* cur_cmd = _sdtx_cur_command(ctx);
     if (cur_cmd) {
-        if ((cur_cmd->num_vertices == 0) || (cur_cmd->layer_id == layer_id)) {
+        const bool canvas_changed = ctx->desc.instanced &&
+            ((cur_cmd->canvas_size.x != ctx->canvas_size.x) || (cur_cmd->canvas_size.y != ctx->canvas_size.y));
+        if ((cur_cmd->num_vertices == 0) || ((cur_cmd->layer_id == layer_id) && !canvas_changed)) {
             // no vertices recorded in current draw command, or layer hasn't changed, can just reuse this
             cur_cmd->layer_id = layer_id;
+            cur_cmd->canvas_size = ctx->canvas_size;
         } else {
             // layer has changed, need to start a new draw command
             _sdtx_command_t* next_cmd = _sdtx_next_command(ctx);
@@ -4541,6 +5259,7 @@ static void _sdtx_set_layer(_sdtx_context_t* ctx, int layer_id) {
                 next_cmd->layer_id = layer_id;
                 next_cmd->first_vertex = cur_cmd->first_vertex + cur_cmd->num_vertices;
                 next_cmd->num_vertices = 0;
+                next_cmd->canvas_size = ctx->canvas_size;
             }
         }
     } else {
@@ -4550,11 +5269,60 @@ static void _sdtx_set_layer(_sdtx_context_t* ctx, int layer_id) {
             next_cmd->layer_id = layer_id;
             next_cmd->first_vertex = 0;
             next_cmd->num_vertices = 0;
+            next_cmd->canvas_size = ctx->canvas_size;
         }
     }
 }
 
+// convert a character cell position into quarter-pixel canvas units
+static int16_t _sdtx_inst_pos(float cell_pos) {
+    float v = cell_pos * 32.0f;
+    v = (v < -32768.0f) ? -32768.0f : ((v > 32767.0f) ? 32767.0f : v);
+    return (int16_t) floorf(v + 0.5f);
+}
+
+static void _sdtx_render_char_instanced(_sdtx_context_t* ctx, uint8_t c) {
+    _sdtx_instance_t* inst = _sdtx_next_instance(ctx);
+    _sdtx_command_t* cmd = _sdtx_cur_command(ctx);
+    if (inst && cmd) {
+        // update instance count in current draw command
+        cmd->num_vertices += 1;
+        inst->x = _sdtx_inst_pos(ctx->origin.x + ctx->pos.x);
+        inst->y = _sdtx_inst_pos(ctx->origin.y + ctx->pos.y);
+        inst->chr = c;
+        inst->font = (uint8_t)ctx->cur_font;
+        inst->pad[0] = inst->pad[1] = 0;
+        inst->color = ctx->color;
+    }
+    ctx->pos.x += 1.0f;
+}
+
+static void _sdtx_render_block_char(_sdtx_context_t* ctx, uint8_t c) {
+    if (ctx->block.next < ctx->block.cap) {
+        _sdtx_instance_t* inst = &ctx->block.ptr[ctx->block.next++];
+        inst->x = _sdtx_inst_pos(ctx->origin.x + ctx->pos.x);
+        inst->y = _sdtx_inst_pos(ctx->origin.y + ctx->pos.y);
+        inst->chr = c;
+        inst->font = (uint8_t)ctx->cur_font;
+        inst->pad[0] = inst->pad[1] = 0;
+        inst->color = ctx->color;
+    } else if (ctx->block.next == ctx->block.cap) {
+        // only warn once per block
+        ctx->block.next++;
+        _SDTX_WARN(BLOCK_BUFFER_FULL);
+    }
+    ctx->pos.x += 1.0f;
+}
+
 static void _sdtx_render_char(_sdtx_context_t* ctx, uint8_t c) {
+    if (ctx->block.active) {
+        _sdtx_render_block_char(ctx, c);
+        return;
+    }
+    if (ctx->desc.instanced) {
+        _sdtx_render_char_instanced(ctx, c);
+        return;
+    }
     _sdtx_vertex_t* vx = _sdtx_next_vertex(ctx);
     _sdtx_command_t* cmd = _sdtx_cur_command(ctx);
     if (vx && cmd) {
@@ -4597,9 +5365,158 @@ static void _sdtx_put_char(_sdtx_context_t* ctx, char c) {
     }
 }
 
+// lookup tables for fast number output, decimal digits are emitted two at a time
+static const char _sdtx_dec_digit_pairs[201] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+static const char _sdtx_hex_digits[17] = "0123456789ABCDEF";
+static const uint64_t _sdtx_pow10[10] = {
+    1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL, 100000000ULL, 1000000000ULL
+};
+
+// output an unsigned decimal number, zero-padded to min_digits
+static void _sdtx_put_u64(_sdtx_context_t* ctx, uint64_t val, int min_digits) {
+    // digits are written back to front into a small scratch buffer, 20 digits is enough for UINT64_MAX
+    char buf[24];
+    int i = (int)sizeof(buf);
+    while (val >= 100) {
+        const int pair = (int)(val % 100) * 2;
+        val /= 100;
+        buf[--i] = _sdtx_dec_digit_pairs[pair + 1];
+        buf[--i] = _sdtx_dec_digit_pairs[pair];
+    }
+    if (val >= 10) {
+        const int pair = (int)val * 2;
+        buf[--i] = _sdtx_dec_digit_pairs[pair + 1];
+        buf[--i] = _sdtx_dec_digit_pairs[pair];
+    } else {
+        buf[--i] = (char)('0' + val);
+    }
+    while ((i > 0) && (((int)sizeof(buf) - i) < min_digits)) {
+        buf[--i] = '0';
+    }
+    for (; i < (int)sizeof(buf); i++) {
+        _sdtx_render_char(ctx, (uint8_t)buf[i]);
+    }
+}
+
+static void _sdtx_put_int(_sdtx_context_t* ctx, int val) {
+    uint64_t abs_val;
+    if (val < 0) {
+        _sdtx_render_char(ctx, '-');
+        abs_val = (uint64_t)(-(int64_t)val);
+    } else {
+        abs_val = (uint64_t)val;
+    }
+    _sdtx_put_u64(ctx, abs_val, 0);
+}
+
+// returns false if the value can't be handled and needs to go through printf
+static bool _sdtx_put_float(_sdtx_context_t* ctx, float val, int decimals) {
+    SOKOL_ASSERT((decimals >= 0) && (decimals <= 9));
+    if (isnan(val)) {
+        return false;
+    }
+    const double abs_val = (val < 0.0f) ? -(double)val : (double)val;
+    const uint64_t scale = _sdtx_pow10[decimals];
+    const double scaled_val = abs_val * (double)scale + 0.5;
+    // the float-to-integer conversion below is undefined for values outside the uint64_t range
+    if (!(scaled_val < 18446744073709551615.0)) {
+        return false;
+    }
+    const uint64_t scaled = (uint64_t)scaled_val;
+    if (signbit(val) && (scaled != 0)) {
+        _sdtx_render_char(ctx, '-');
+    }
+    _sdtx_put_u64(ctx, scaled / scale, 0);
+    if (decimals > 0) {
+        _sdtx_render_char(ctx, '.');
+        _sdtx_put_u64(ctx, scaled % scale, decimals);
+    }
+    return true;
+}
+
+static void _sdtx_put_hex(_sdtx_context_t* ctx, uint32_t val, int num_digits) {
+    SOKOL_ASSERT((num_digits >= 0) && (num_digits <= 8));
+    int n = 1;
+    while ((n < 8) && ((val >> (n * 4)) != 0)) {
+        n++;
+    }
+    if (n < num_digits) {
+        n = num_digits;
+    }
+    for (int i = n - 1; i >= 0; i--) {
+        _sdtx_render_char(ctx, (uint8_t)_sdtx_hex_digits[(val >> (i * 4)) & 0xF]);
+    }
+}
+
+static void _sdtx_apply_inst_uniforms(_sdtx_float2_t canvas_size, float offset_x, float offset_y, uint32_t tint) {
+    _sdtx_vs_params_t vs_params;
+    _sdtx_clear(&vs_params, sizeof(vs_params));
+    vs_params.pos_scale[0] = 1.0f / (4.0f * canvas_size.x);
+    vs_params.pos_scale[1] = 1.0f / (4.0f * canvas_size.y);
+    vs_params.uv_scale[0] = 1.0f / 256.0f;
+    vs_params.uv_scale[1] = 1.0f / (float)SDTX_MAX_FONTS;
+    vs_params.offset[0] = offset_x;
+    vs_params.offset[1] = offset_y;
+    vs_params.tint[0] = (float)(tint & 0xFF) / 255.0f;
+    vs_params.tint[1] = (float)((tint >> 8) & 0xFF) / 255.0f;
+    vs_params.tint[2] = (float)((tint >> 16) & 0xFF) / 255.0f;
+    vs_params.tint[3] = (float)((tint >> 24) & 0xFF) / 255.0f;
+    const sg_range ub_range = SG_RANGE(vs_params);
+    sg_apply_uniforms(0, &ub_range);
+}
+
+static void _sdtx_draw_layer_instanced(_sdtx_context_t* ctx, int layer_id) {
+    if ((ctx->instances.next > 0) && (ctx->commands.next > 0)) {
+        sg_push_debug_group("sokol-debugtext");
+
+        if (ctx->update_frame_id != ctx->frame_id) {
+            ctx->update_frame_id = ctx->frame_id;
+            const sg_range range = { ctx->instances.ptr, (size_t)ctx->instances.next * sizeof(_sdtx_instance_t) };
+            sg_update_buffer(ctx->vbuf, &range);
+        }
+
+        sg_apply_pipeline(ctx->pip);
+        sg_bindings bindings;
+        _sdtx_clear(&bindings, sizeof(bindings));
+        bindings.vertex_buffers[0] = ctx->vbuf;
+        bindings.images[0] = _sdtx.font_img;
+        bindings.samplers[0] = _sdtx.font_smp;
+        _sdtx_float2_t cur_canvas_size = { 0.0f, 0.0f };
+        for (int cmd_index = 0; cmd_index < ctx->commands.next; cmd_index++) {
+            const _sdtx_command_t* cmd = &ctx->commands.ptr[cmd_index];
+            if ((cmd->layer_id != layer_id) || (cmd->num_vertices == 0)) {
+                continue;
+            }
+            // there's no base-instance in sg_draw(), so offset the instance buffer instead
+            bindings.vertex_buffer_offsets[0] = cmd->first_vertex * (int)sizeof(_sdtx_instance_t);
+            sg_apply_bindings(&bindings);
+            if ((cur_canvas_size.x != cmd->canvas_size.x) || (cur_canvas_size.y != cmd->canvas_size.y)) {
+                cur_canvas_size = cmd->canvas_size;
+                _sdtx_apply_inst_uniforms(cur_canvas_size, 0.0f, 0.0f, 0xFFFFFFFF);
+            }
+            sg_draw(0, 6, cmd->num_vertices);
+        }
+        sg_pop_debug_group();
+    }
+}
+
 SOKOL_API_IMPL void _sdtx_draw_layer(_sdtx_context_t* ctx, int layer_id) {
     SOKOL_ASSERT(_SDTX_INIT_COOKIE == _sdtx.init_cookie);
     SOKOL_ASSERT(ctx);
+    if (ctx->desc.instanced) {
+        _sdtx_draw_layer_instanced(ctx, layer_id);
+        return;
+    }
     if ((ctx->vertices.next > 0) && (ctx->commands.next > 0)) {
         sg_push_debug_group("sokol-debugtext");
 
@@ -4628,11 +5545,100 @@ SOKOL_API_IMPL void _sdtx_draw_layer(_sdtx_context_t* ctx, int layer_id) {
     }
 }
 
+static void _sdtx_begin_block(_sdtx_context_t* ctx) {
+    if (ctx->block.active) {
+        _SDTX_ERROR(BLOCK_ALREADY_ACTIVE);
+        return;
+    }
+    if (0 == ctx->block.ptr) {
+        ctx->block.cap = ctx->desc.char_buf_size;
+        ctx->block.ptr = (_sdtx_instance_t*) _sdtx_malloc((size_t)ctx->block.cap * sizeof(_sdtx_instance_t));
+    }
+    ctx->block.active = true;
+    ctx->block.next = 0;
+    ctx->block.origin = ctx->origin;
+    ctx->block.pos = ctx->pos;
+    ctx->origin.x = ctx->origin.y = 0.0f;
+    ctx->pos.x = ctx->pos.y = 0.0f;
+}
+
+static sdtx_block _sdtx_end_block(_sdtx_context_t* ctx) {
+    sdtx_block res = { SG_INVALID_ID };
+    if (!ctx->block.active) {
+        _SDTX_ERROR(NO_ACTIVE_BLOCK);
+        return res;
+    }
+    ctx->block.active = false;
+    ctx->origin = ctx->block.origin;
+    ctx->pos = ctx->block.pos;
+    const int num_chars = (ctx->block.next < ctx->block.cap) ? ctx->block.next : ctx->block.cap;
+    ctx->block.next = 0;
+
+    int slot_index = _sdtx_pool_alloc_index(&_sdtx.block_pool.pool);
+    if (_SDTX_INVALID_SLOT_INDEX == slot_index) {
+        _SDTX_ERROR(BLOCK_POOL_EXHAUSTED);
+        return res;
+    }
+    _sdtx_block_t* block = &_sdtx.block_pool.blocks[slot_index];
+    res.id = _sdtx_slot_alloc(&_sdtx.block_pool.pool, &block->slot, slot_index);
+    block->num_chars = num_chars;
+    if (num_chars > 0) {
+        sg_push_debug_group("sokol-debugtext");
+        sg_buffer_desc vbuf_desc;
+        _sdtx_clear(&vbuf_desc, sizeof(vbuf_desc));
+        vbuf_desc.data.ptr = ctx->block.ptr;
+        vbuf_desc.data.size = (size_t)num_chars * sizeof(_sdtx_instance_t);
+        vbuf_desc.usage.vertex_buffer = true;
+        vbuf_desc.usage.immutable = true;
+        vbuf_desc.label = "sdtx-block-vbuf";
+        block->vbuf = sg_make_buffer(&vbuf_desc);
+        sg_pop_debug_group();
+    }
+    block->slot.state = SG_RESOURCESTATE_VALID;
+    return res;
+}
+
+static void _sdtx_destroy_block(sdtx_block block_id) {
+    _sdtx_block_t* block = _sdtx_lookup_block(block_id.id);
+    if (block) {
+        if (SG_INVALID_ID != block->vbuf.id) {
+            sg_destroy_buffer(block->vbuf);
+        }
+        _sdtx_clear(block, sizeof(*block));
+        _sdtx_pool_free_index(&_sdtx.block_pool.pool, _sdtx_slot_index(block_id.id));
+    }
+}
+
+static void _sdtx_draw_block(_sdtx_context_t* ctx, sdtx_block block_id, float x, float y, uint32_t rgba) {
+    const _sdtx_block_t* block = _sdtx_lookup_block(block_id.id);
+    if (!block || (0 == block->num_chars)) {
+        return;
+    }
+    sg_push_debug_group("sokol-debugtext");
+    sg_pipeline pip = ctx->pip;
+    if (!ctx->desc.instanced) {
+        if (SG_INVALID_ID == ctx->block_pip.id) {
+            ctx->block_pip = _sdtx_make_pipeline(&ctx->desc, true);
+        }
+        pip = ctx->block_pip;
+    }
+    sg_apply_pipeline(pip);
+    sg_bindings bindings;
+    _sdtx_clear(&bindings, sizeof(bindings));
+    bindings.vertex_buffers[0] = block->vbuf;
+    bindings.images[0] = _sdtx.font_img;
+    bindings.samplers[0] = _sdtx.font_smp;
+    sg_apply_bindings(&bindings);
+    _sdtx_apply_inst_uniforms(ctx->canvas_size, x * 32.0f, y * 32.0f, rgba);
+    sg_draw(0, 6, block->num_chars);
+    sg_pop_debug_group();
+}
 
 static sdtx_desc_t _sdtx_desc_defaults(const sdtx_desc_t* desc) {
     SOKOL_ASSERT((desc->allocator.alloc_fn && desc->allocator.free_fn) || (!desc->allocator.alloc_fn && !desc->allocator.free_fn));
     sdtx_desc_t res = *desc;
     res.context_pool_size = _sdtx_def(res.context_pool_size, _SDTX_DEFAULT_CONTEXT_POOL_SIZE);
+    res.block_pool_size = _sdtx_def(res.block_pool_size, _SDTX_DEFAULT_BLOCK_POOL_SIZE);
     res.printf_buf_size = _sdtx_def(res.printf_buf_size, _SDTX_DEFAULT_PRINTF_BUF_SIZE);
     for (int i = 0; i < SDTX_MAX_FONTS; i++) {
         if (res.fonts[i].data.ptr) {
@@ -4641,6 +5647,7 @@ static sdtx_desc_t _sdtx_desc_defaults(const sdtx_desc_t* desc) {
     }
     res.context = _sdtx_context_desc_defaults(&res.context);
     SOKOL_ASSERT(res.context_pool_size > 0);
+    SOKOL_ASSERT(res.block_pool_size > 0);
     SOKOL_ASSERT(res.printf_buf_size > 0);
     SOKOL_ASSERT(res.context.char_buf_size > 0);
     return res;
@@ -4659,6 +5666,7 @@ SOKOL_API_IMPL void sdtx_setup(const sdtx_desc_t* desc) {
     _sdtx.init_cookie = _SDTX_INIT_COOKIE;
     _sdtx.desc = _sdtx_desc_defaults(desc);
     _sdtx_setup_context_pool(&_sdtx.desc);
+    _sdtx_setup_block_pool(&_sdtx.desc);
     _sdtx_setup_common();
     _sdtx.def_ctx_id = sdtx_make_context(&_sdtx.desc.context);
     SOKOL_ASSERT(SDTX_DEFAULT_CONTEXT.id == _sdtx.def_ctx_id.id);
@@ -4671,7 +5679,12 @@ SOKOL_API_IMPL void sdtx_shutdown(void) {
         _sdtx_context_t* ctx = &_sdtx.context_pool.contexts[i];
         _sdtx_destroy_context(_sdtx_make_ctx_id(ctx->slot.id));
     }
+    for (int i = 0; i < _sdtx.block_pool.pool.size; i++) {
+        sdtx_block block_id = { _sdtx.block_pool.blocks[i].slot.id };
+        _sdtx_destroy_block(block_id);
+    }
     _sdtx_discard_common();
+    _sdtx_discard_block_pool();
     _sdtx_discard_context_pool();
     _sdtx.init_cookie = 0;
 }
@@ -4782,6 +5795,9 @@ SOKOL_API_IMPL void sdtx_canvas(float w, float h) {
         ctx->origin.y = 0.0f;
         ctx->pos.x = 0.0f;
         ctx->pos.y = 0.0f;
+        if (ctx->desc.instanced) {
+            _sdtx_set_layer(ctx, ctx->cur_layer_id);
+        }
     }
 }
 
@@ -4958,6 +5974,34 @@ SOKOL_DEBUGTEXT_API_DECL int sdtx_printf(const char* fmt, ...) {
     return res;
 }
 
+SOKOL_DEBUGTEXT_API_DECL void sdtx_put_int(int val) {
+    SOKOL_ASSERT(_SDTX_INIT_COOKIE == _sdtx.init_cookie);
+    _sdtx_context_t* ctx = _sdtx.cur_ctx;
+    if (ctx) {
+        _sdtx_put_int(ctx, val);
+    }
+}
+
+SOKOL_DEBUGTEXT_API_DECL void sdtx_put_float(float val, int decimals) {
+    SOKOL_ASSERT(_SDTX_INIT_COOKIE == _sdtx.init_cookie);
+    SOKOL_ASSERT((decimals >= 0) && (decimals <= 9));
+    _sdtx_context_t* ctx = _sdtx.cur_ctx;
+    if (ctx) {
+        if (!_sdtx_put_float(ctx, val, decimals)) {
+            sdtx_printf("%.*f", decimals, (double)val);
+        }
+    }
+}
+
+SOKOL_DEBUGTEXT_API_DECL void sdtx_put_hex(uint32_t val, int num_digits) {
+    SOKOL_ASSERT(_SDTX_INIT_COOKIE == _sdtx.init_cookie);
+    SOKOL_ASSERT((num_digits >= 0) && (num_digits <= 8));
+    _sdtx_context_t* ctx = _sdtx.cur_ctx;
+    if (ctx) {
+        _sdtx_put_hex(ctx, val, num_digits);
+    }
+}
+
 SOKOL_DEBUGTEXT_API_DECL sdtx_range sdtx_get_cleared_fmt_buffer(void) {
     SOKOL_ASSERT(_SDTX_INIT_COOKIE == _sdtx.init_cookie);
     SOKOL_ASSERT(_sdtx.fmt_buf && (_sdtx.fmt_buf_size >= 2));
@@ -4999,4 +6043,44 @@ SOKOL_API_IMPL void sdtx_context_draw_layer(sdtx_context ctx_id, int layer_id) {
         _sdtx_draw_layer(ctx, layer_id);
     }
 }
+
+SOKOL_API_IMPL void sdtx_begin_block(void) {
+    SOKOL_ASSERT(_SDTX_INIT_COOKIE == _sdtx.init_cookie);
+    _sdtx_context_t* ctx = _sdtx.cur_ctx;
+    if (ctx) {
+        _sdtx_begin_block(ctx);
+    }
+}
+
+SOKOL_API_IMPL sdtx_block sdtx_end_block(void) {
+    SOKOL_ASSERT(_SDTX_INIT_COOKIE == _sdtx.init_cookie);
+    _sdtx_context_t* ctx = _sdtx.cur_ctx;
+    if (ctx) {
+        return _sdtx_end_block(ctx);
+    } else {
+        sdtx_block res = { SG_INVALID_ID };
+        return res;
+    }
+}
+
+SOKOL_API_IMPL void sdtx_destroy_block(sdtx_block block_id) {
+    SOKOL_ASSERT(_SDTX_INIT_COOKIE == _sdtx.init_cookie);
+    _sdtx_destroy_block(block_id);
+}
+
+SOKOL_API_IMPL void sdtx_draw_block(sdtx_block block_id, float x, float y, uint32_t rgba) {
+    SOKOL_ASSERT(_SDTX_INIT_COOKIE == _sdtx.init_cookie);
+    _sdtx_context_t* ctx = _sdtx.cur_ctx;
+    if (ctx) {
+        _sdtx_draw_block(ctx, block_id, x, y, rgba);
+    }
+}
+
+SOKOL_API_IMPL void sdtx_context_draw_block(sdtx_context ctx_id, sdtx_block block_id, float x, float y, uint32_t rgba) {
+    SOKOL_ASSERT(_SDTX_INIT_COOKIE == _sdtx.init_cookie);
+    _sdtx_context_t* ctx = _sdtx_lookup_context(ctx_id.id);
+    if (ctx) {
+        _sdtx_draw_block(ctx, block_id, x, y, rgba);
+    }
+}
 #endif // SOKOL_DEBUGTEXT_IMPL
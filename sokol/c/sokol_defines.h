@@ -1,4 +1,6 @@
 #define SOKOL_NO_ENTRY
+// required by sokol_gfx_trace.h
+#define SOKOL_TRACE_HOOKS
 #if defined(_WIN32)
     #define SOKOL_WIN32_FORCE_MAIN
 #endif
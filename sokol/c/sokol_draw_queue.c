@@ -0,0 +1,6 @@
+#if defined(IMPL)
+#define SOKOL_DRAW_QUEUE_IMPL
+#endif
+#include "sokol_defines.h"
+#include "sokol_gfx.h"
+#include "sokol_draw_queue.h"
@@ -0,0 +1,790 @@
+#if defined(SOKOL_IMPL) && !defined(SOKOL_DRAW_QUEUE_IMPL)
+#define SOKOL_DRAW_QUEUE_IMPL
+#endif
+#ifndef SOKOL_DRAW_QUEUE_INCLUDED
+/*
+    sokol_draw_queue.h -- sort draw calls by a 64-bit key and submit them with minimal state changes
+
+    Project URL: https://github.com/Ed94/SectrPrototype (Sectr fork of sokol-odin)
+
+    This header is an addition of the Sectr fork and is not part of the upstream
+    sokol headers (https://github.com/floooh/sokol), it follows their API conventions.
+
+    Do this:
+        #define SOKOL_IMPL or
+        #define SOKOL_DRAW_QUEUE_IMPL
+    before you include this file in *one* C or C++ file to create the
+    implementation.
+
+    Optionally provide the following defines with your own implementations:
+
+    SOKOL_ASSERT(c)             - your own assert macro (default: assert(c))
+    SOKOL_DRAW_QUEUE_API_DECL   - public function declaration prefix (default: extern)
+    SOKOL_API_DECL              - same as SOKOL_DRAW_QUEUE_API_DECL
+    SOKOL_API_IMPL              - public function implementation prefix (default: -)
+
+    If sokol_draw_queue.h is compiled as a DLL, define the following before
+    including the declaration or implementation:
+
+    SOKOL_DLL
+
+    On Windows, SOKOL_DLL will define SOKOL_DRAW_QUEUE_API_DECL as __declspec(dllexport)
+    or __declspec(dllimport) as needed.
+
+    Include the following headers before including sokol_draw_queue.h:
+
+        sokol_gfx.h
+
+    FEATURES AND CONCEPTS
+    =====================
+    - draw calls are queued together with their pipeline, bindings (or
+      bindgroup), uniform data and a 64-bit sort key
+    - when the queue is flushed, the queued draws are radix-sorted by
+      their sort key (draws with the same key keep their submission order)
+      and submitted to sokol_gfx.h, sg_apply_pipeline(), sg_apply_bindings(),
+      sg_apply_bindgroup() and sg_apply_uniforms() calls which wouldn't
+      change the current state are skipped
+    - this means that a scene can be submitted in traversal order, and
+      the number of state changes is minimized automatically
+    - the sort key layout is up to the caller, but sdq_make_key() builds
+      a key from the typical ingredients (from most to least significant):
+
+        - pass (8 bits): a queue can collect the draws for several
+          sokol_gfx.h passes, each pass is flushed separately
+          with sdq_flush_pass()
+        - layer (8 bits): for instance opaque, alpha-tested, transparent, UI
+        - pipeline (16 bits): the slot index of the sg_pipeline handle
+        - material (16 bits): an application-defined material index
+        - depth (16 bits): a depth value between 0.0 and 1.0, for
+          front-to-back sorting (pass 1.0 - depth for back-to-front sorting),
+          values outside this range are clamped and NaN is treated as 0.0
+
+    STEP BY STEP
+    ============
+    --- call sdq_setup() after sg_setup():
+
+            sg_setup(&(sg_desc){ ... });
+            sdq_setup(&(sdq_desc_t){ .logger.func = slog_func });
+
+        The following sdq_desc_t items can be provided:
+
+            .max_draws          - the max number of queued draws (default: 16384)
+            .max_uniform_bytes  - the max size of all queued uniform data
+                                  (default: 1 MByte)
+
+    --- queue draws with sdq_draw(), this doesn't call into sokol_gfx.h:
+
+            sdq_draw(&(sdq_draw_desc){
+                .key = sdq_make_key(0, LAYER_OPAQUE, pip, mat_index, depth),
+                .pipeline = pip,
+                .bindings = { ... },
+                .uniforms[UB_vs_params] = SG_RANGE(vs_params),
+                .num_elements = 36,
+                .num_instances = 1,
+            });
+
+        Uniform data is copied, and at most SG_MAX_UNIFORMBLOCK_BINDSLOTS
+        uniform blocks can be provided per draw. Instead of .bindings, a
+        bindgroup can be provided via .bindgroup. Empty bindings are not
+        applied (for shaders without resource bindings).
+
+    --- inside a sokol_gfx.h pass, submit the queued draws:
+
+            sg_begin_pass(...);
+            sdq_flush();
+            sg_end_pass();
+
+        sdq_flush() submits all queued draws and resets the queue. If the
+        queue collects the draws for several passes, call:
+
+            sg_begin_pass(&(sg_pass){ .label = "shadow", ... });
+            sdq_flush_pass(PASS_SHADOW);
+            sg_end_pass();
+            sg_begin_pass(&(sg_pass){ .label = "main", ... });
+            sdq_flush_pass(PASS_MAIN);
+            sg_end_pass();
+
+        ...this only submits the queued draws with the given pass value in
+        the upper 8 bits of their sort key. The queue is reset when all
+        queued draws have been submitted, or explicitly with sdq_clear().
+
+    --- to check how many state changes have been eliminated, call:
+
+            sdq_stats stats = sdq_query_stats();
+
+        ...this returns the accumulated statistics since the last call
+        to sdq_reset_stats().
+
+    --- call sdq_shutdown() before sg_shutdown():
+
+            sdq_shutdown();
+            sg_shutdown();
+
+    ERROR REPORTING AND LOGGING
+    ===========================
+    To get any logging information at all you need to provide a logging callback in the setup call,
+    the easiest way is to use sokol_log.h:
+
+        #include "sokol_log.h"
+
+        sdq_setup(&(sdq_desc_t){
+            // ...
+            .logger.func = slog_func
+        });
+
+    MEMORY ALLOCATION OVERRIDE
+    ==========================
+    You can override the memory allocation functions at initialization time
+    like this:
+
+        void* my_alloc(size_t size, void* user_data) {
+            return malloc(size);
+        }
+
+        void my_free(void* ptr, void* user_data) {
+            free(ptr);
+        }
+
+        ...
+            sdq_setup(&(sdq_desc_t){
+                // ...
+                .allocator = {
+                    .alloc_fn = my_alloc,
+                    .free_fn = my_free,
+                    .user_data = ...;
+                }
+            });
+        ...
+
+    If no overrides are provided, malloc and free will be used.
+
+    LICENSE
+    =======
+    zlib/libpng license
+
+    Copyright (c) 2026 the Sectr fork contributors
+
+    This software is provided 'as-is', without any express or implied warranty.
+    In no event will the authors be held liable for any damages arising from the
+    use of this software.
+
+    Permission is granted to anyone to use this software for any purpose,
+    including commercial applications, and to alter it and redistribute it
+    freely, subject to the following restrictions:
+
+        1. The origin of this software must not be misrepresented; you must not
+        claim that you wrote the original software. If you use this software in a
+        product, an acknowledgment in the product documentation would be
+        appreciated but is not required.
+
+        2. Altered source versions must be plainly marked as such, and must not
+        be misrepresented as being the original software.
+
+        3. This notice may not be removed or altered from any source
+        distribution.
+*/
+#define SOKOL_DRAW_QUEUE_INCLUDED (1)
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h> // size_t
+
+#if !defined(SOKOL_GFX_INCLUDED)
+#error "Please include sokol_gfx.h before sokol_draw_queue.h"
+#endif
+
+#if defined(SOKOL_API_DECL) && !defined(SOKOL_DRAW_QUEUE_API_DECL)
+#define SOKOL_DRAW_QUEUE_API_DECL SOKOL_API_DECL
+#endif
+#ifndef SOKOL_DRAW_QUEUE_API_DECL
+#if defined(_WIN32) && defined(SOKOL_DLL) && defined(SOKOL_DRAW_QUEUE_IMPL)
+#define SOKOL_DRAW_QUEUE_API_DECL __declspec(dllexport)
+#elif defined(_WIN32) && defined(SOKOL_DLL)
+#define SOKOL_DRAW_QUEUE_API_DECL __declspec(dllimport)
+#else
+#define SOKOL_DRAW_QUEUE_API_DECL extern
+#endif
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+    sdq_log_item_t
+
+    Log items are defined via X-Macros, and expanded to an
+    enum 'sdq_log_item' - and in debug mode only - corresponding strings.
+
+    Used as parameter in the logging callback.
+*/
+#define _SDQ_LOG_ITEMS \
+    _SDQ_LOGITEM_XMACRO(OK, "Ok") \
+    _SDQ_LOGITEM_XMACRO(MALLOC_FAILED, "memory allocation failed") \
+    _SDQ_LOGITEM_XMACRO(DRAWS_EXHAUSTED, "draw queue is full, draw dropped (adjust via sdq_desc_t.max_draws)") \
+    _SDQ_LOGITEM_XMACRO(UNIFORMS_EXHAUSTED, "uniform data buffer is full, draw dropped (adjust via sdq_desc_t.max_uniform_bytes)") \
+
+#define _SDQ_LOGITEM_XMACRO(item,msg) SDQ_LOGITEM_##item,
+typedef enum sdq_log_item_t {
+    _SDQ_LOG_ITEMS
+} sdq_log_item_t;
+#undef _SDQ_LOGITEM_XMACRO
+
+/*
+    sdq_logger_t
+
+    Used in sdq_desc_t to provide a custom logging and error reporting
+    callback to sokol-draw-queue.
+*/
+typedef struct sdq_logger_t {
+    void (*func)(
+        const char* tag,                // always "sdq"
+        uint32_t log_level,             // 0=panic, 1=error, 2=warning, 3=info
+        uint32_t log_item_id,           // SDQ_LOGITEM_*
+        const char* message_or_null,    // a message string, may be nullptr in release mode
+        uint32_t line_nr,               // line number in sokol_draw_queue.h
+        const char* filename_or_null,   // source filename, may be nullptr in release mode
+        void* user_data);
+    void* user_data;
+} sdq_logger_t;
+
+/*
+    sdq_allocator_t
+
+    Used in sdq_desc_t to provide custom memory-alloc and -free functions
+    to sokol_draw_queue.h. If memory management should be overridden, both
+    the alloc_fn and free_fn function must be provided (e.g. it's not valid
+    to override one function but not the other).
+*/
+typedef struct sdq_allocator_t {
+    void* (*alloc_fn)(size_t size, void* user_data);
+    void (*free_fn)(void* ptr, void* user_data);
+    void* user_data;
+} sdq_allocator_t;
+
+/*
+    sdq_desc_t
+
+    Describes the draw queue setup parameters, passed to sdq_setup().
+*/
+typedef struct sdq_desc_t {
+    int max_draws;                          // max number of queued draws, default: 16384
+    int max_uniform_bytes;                  // max size of queued uniform data, default: 1 MByte
+    sdq_allocator_t allocator;              // optional memory allocation overrides (default: malloc/free)
+    sdq_logger_t logger;                    // optional log override function (default: NO LOGGING)
+} sdq_desc_t;
+
+/*
+    sdq_draw_desc
+
+    Describes a queued draw call, passed to sdq_draw(). If a bindgroup
+    is provided, the bindings are ignored.
+*/
+typedef struct sdq_draw_desc {
+    uint64_t key;
+    sg_pipeline pipeline;
+    sg_bindings bindings;
+    sg_bindgroup bindgroup;
+    sg_range uniforms[SG_MAX_UNIFORMBLOCK_BINDSLOTS];
+    int base_element;
+    int num_elements;
+    int num_instances;
+} sdq_draw_desc;
+
+/*
+    sdq_stats
+
+    Accumulated statistics since the last call to sdq_reset_stats(),
+    returned by sdq_query_stats().
+*/
+typedef struct sdq_stats {
+    uint32_t num_draws;                     // number of submitted draws
+    uint32_t num_dropped_draws;             // number of draws dropped because the queue was full
+    uint32_t num_apply_pipeline;            // number of sg_apply_pipeline() calls
+    uint32_t num_apply_bindings;            // number of sg_apply_bindings() and sg_apply_bindgroup() calls
+    uint32_t num_apply_uniforms;            // number of sg_apply_uniforms() calls
+    uint32_t num_skipped_apply_pipeline;    // number of redundant sg_apply_pipeline() calls skipped
+    uint32_t num_skipped_apply_bindings;    // number of redundant sg_apply_bindings() and sg_apply_bindgroup() calls skipped
+    uint32_t num_skipped_apply_uniforms;    // number of redundant sg_apply_uniforms() calls skipped
+} sdq_stats;
+
+/* setup and shutdown */
+SOKOL_DRAW_QUEUE_API_DECL void sdq_setup(const sdq_desc_t* desc);
+SOKOL_DRAW_QUEUE_API_DECL void sdq_shutdown(void);
+
+/* build a sort key from pass, layer, pipeline, material and depth (0.0 .. 1.0) */
+SOKOL_DRAW_QUEUE_API_DECL uint64_t sdq_make_key(int pass, int layer, sg_pipeline pip, int material, float depth);
+
+/* queue draws and submit them */
+SOKOL_DRAW_QUEUE_API_DECL void sdq_draw(const sdq_draw_desc* desc);
+SOKOL_DRAW_QUEUE_API_DECL void sdq_flush(void);
+SOKOL_DRAW_QUEUE_API_DECL void sdq_flush_pass(int pass);
+SOKOL_DRAW_QUEUE_API_DECL void sdq_clear(void);
+SOKOL_DRAW_QUEUE_API_DECL int sdq_num_queued_draws(void);
+
+/* statistics */
+SOKOL_DRAW_QUEUE_API_DECL sdq_stats sdq_query_stats(void);
+SOKOL_DRAW_QUEUE_API_DECL void sdq_reset_stats(void);
+
+#ifdef __cplusplus
+} /* extern "C" */
+/* C++ const-ref wrappers */
+inline void sdq_setup(const sdq_desc_t& desc) { return sdq_setup(&desc); }
+inline void sdq_draw(const sdq_draw_desc& desc) { return sdq_draw(&desc); }
+#endif
+#endif /* SOKOL_DRAW_QUEUE_INCLUDED */
+
+// ██ ███    ███ ██████  ██      ███████ ███    ███ ███████ ███    ██ ████████  █████  ████████ ██  ██████  ███    ██
+// ██ ████  ████ ██   ██ ██      ██      ████  ████ ██      ████   ██    ██    ██   ██    ██    ██ ██    ██ ████   ██
+// ██ ██ ████ ██ ██████  ██      █████   ██ ████ ██ █████   ██ ██  ██    ██    ███████    ██    ██ ██    ██ ██ ██  ██
+// ██ ██  ██  ██ ██      ██      ██      ██  ██  ██ ██      ██  ██ ██    ██    ██   ██    ██    ██ ██    ██ ██  ██ ██
+// ██ ██      ██ ██      ███████ ███████ ██      ██ ███████ ██   ████    ██    ██   ██    ██    ██  ██████  ██   ████
+//
+// >>implementation
+#ifdef SOKOL_DRAW_QUEUE_IMPL
+#define SOKOL_DRAW_QUEUE_IMPL_INCLUDED (1)
+
+#if defined(SOKOL_MALLOC) || defined(SOKOL_CALLOC) || defined(SOKOL_FREE)
+#error "SOKOL_MALLOC/CALLOC/FREE macros are no longer supported, please use sdq_desc_t.allocator to override memory allocation functions"
+#endif
+
+#include <string.h> // memset, memcpy, memcmp
+#include <stdlib.h> // malloc/free
+
+#ifndef SOKOL_API_IMPL
+    #define SOKOL_API_IMPL
+#endif
+#ifndef SOKOL_DEBUG
+    #ifndef NDEBUG
+        #define SOKOL_DEBUG
+    #endif
+#endif
+#ifndef SOKOL_ASSERT
+    #include <assert.h>
+    #define SOKOL_ASSERT(c) assert(c)
+#endif
+#ifndef _SOKOL_UNUSED
+    #define _SOKOL_UNUSED(x) (void)(x)
+#endif
+
+#define _sdq_def(val, def) (((val) == 0) ? (def) : (val))
+#define _SDQ_INIT_COOKIE (0xABCDBEAD)
+#define _SDQ_DEFAULT_MAX_DRAWS (16384)
+#define _SDQ_DEFAULT_MAX_UNIFORM_BYTES (1024 * 1024)
+#define _SDQ_UNIFORM_ALIGN (16)
+#define _SDQ_PASS_SHIFT (56)
+
+typedef struct {
+    uint32_t offset;
+    uint32_t size;
+} _sdq_uniform_t;
+
+typedef struct {
+    sg_pipeline pipeline;
+    sg_bindgroup bindgroup;
+    sg_bindings bindings;
+    bool has_bindings;
+    _sdq_uniform_t uniforms[SG_MAX_UNIFORMBLOCK_BINDSLOTS];
+    int base_element;
+    int num_elements;
+    int num_instances;
+} _sdq_draw_t;
+
+// the radix sort only moves these around, not the much bigger draw items
+typedef struct {
+    uint64_t key;
+    uint32_t draw_index;
+} _sdq_sort_item_t;
+
+typedef struct {
+    uint32_t init_cookie;
+    sdq_desc_t desc;
+    _sdq_draw_t* draws;
+    int num_draws;
+    uint8_t* uniform_data;
+    uint32_t uniform_pos;
+    // the pending (not yet submitted) draws, sorted when sorted is true
+    _sdq_sort_item_t* items;
+    _sdq_sort_item_t* tmp_items;
+    int num_items;
+    bool sorted;
+    sdq_stats stats;
+} _sdq_t;
+static _sdq_t _sdq;
+
+// ██       ██████   ██████   ██████  ██ ███    ██  ██████
+// ██      ██    ██ ██       ██       ██ ████   ██ ██
+// ██      ██    ██ ██   ███ ██   ███ ██ ██ ██  ██ ██   ███
+// ██      ██    ██ ██    ██ ██    ██ ██ ██  ██ ██ ██    ██
+// ███████  ██████   ██████   ██████  ██ ██   ████  ██████
+//
+// >>logging
+#if defined(SOKOL_DEBUG)
+#define _SDQ_LOGITEM_XMACRO(item,msg) #item ": " msg,
+static const char* _sdq_log_messages[] = {
+    _SDQ_LOG_ITEMS
+};
+#undef _SDQ_LOGITEM_XMACRO
+#endif // SOKOL_DEBUG
+
+#define _SDQ_PANIC(code) _sdq_log(SDQ_LOGITEM_ ##code, 0, __LINE__)
+#define _SDQ_ERROR(code) _sdq_log(SDQ_LOGITEM_ ##code, 1, __LINE__)
+#define _SDQ_WARN(code) _sdq_log(SDQ_LOGITEM_ ##code, 2, __LINE__)
+#define _SDQ_INFO(code) _sdq_log(SDQ_LOGITEM_ ##code, 3, __LINE__)
+
+static void _sdq_log(sdq_log_item_t log_item, uint32_t log_level, uint32_t line_nr) {
+    if (_sdq.desc.logger.func) {
+        #if defined(SOKOL_DEBUG)
+            const char* filename = __FILE__;
+            const char* message = _sdq_log_messages[log_item];
+        #else
+            const char* filename = 0;
+            const char* message = 0;
+        #endif
+        _sdq.desc.logger.func("sdq", log_level, (uint32_t)log_item, message, line_nr, filename, _sdq.desc.logger.user_data);
+    } else {
+        // for log level PANIC it would be 'undefined behaviour' to continue
+        if (log_level == 0) {
+            abort();
+        }
+    }
+}
+
+// ███    ███ ███████ ███    ███  ██████  ██████  ██    ██
+// ████  ████ ██      ████  ████ ██    ██ ██   ██  ██  ██
+// ██ ████ ██ █████   ██ ████ ██ ██    ██ ██████    ████
+// ██  ██  ██ ██      ██  ██  ██ ██    ██ ██   ██    ██
+// ██      ██ ███████ ██      ██  ██████  ██   ██    ██
+//
+// >>memory
+static void _sdq_clear(void* ptr, size_t size) {
+    SOKOL_ASSERT(ptr && (size > 0));
+    memset(ptr, 0, size);
+}
+
+static void* _sdq_malloc(size_t size) {
+    SOKOL_ASSERT(size > 0);
+    void* ptr;
+    if (_sdq.desc.allocator.alloc_fn) {
+        ptr = _sdq.desc.allocator.alloc_fn(size, _sdq.desc.allocator.user_data);
+    } else {
+        ptr = malloc(size);
+    }
+    if (0 == ptr) {
+        _SDQ_PANIC(MALLOC_FAILED);
+    }
+    return ptr;
+}
+
+static void* _sdq_malloc_clear(size_t size) {
+    void* ptr = _sdq_malloc(size);
+    _sdq_clear(ptr, size);
+    return ptr;
+}
+
+static void _sdq_free(void* ptr) {
+    if (_sdq.desc.allocator.free_fn) {
+        _sdq.desc.allocator.free_fn(ptr, _sdq.desc.allocator.user_data);
+    } else {
+        free(ptr);
+    }
+}
+
+// ███████  ██████  ██████  ████████
+// ██      ██    ██ ██   ██    ██
+// ███████ ██    ██ ██████     ██
+//      ██ ██    ██ ██   ██    ██
+// ███████  ██████  ██   ██    ██
+//
+// >>sort
+// stable LSD radix sort over the 8 key bytes, byte positions where all
+// keys have the same value are skipped (which is common for the upper
+// key bits, or when only a few pipelines are in use)
+static void _sdq_radix_sort(void) {
+    const int num = _sdq.num_items;
+    if (num < 2) {
+        return;
+    }
+    uint32_t hist[8][256];
+    _sdq_clear(hist, sizeof(hist));
+    for (int i = 0; i < num; i++) {
+        const uint64_t key = _sdq.items[i].key;
+        for (int b = 0; b < 8; b++) {
+            hist[b][(key >> (b * 8)) & 0xFF]++;
+        }
+    }
+    _sdq_sort_item_t* src = _sdq.items;
+    _sdq_sort_item_t* dst = _sdq.tmp_items;
+    for (int b = 0; b < 8; b++) {
+        const uint64_t first_byte = (src[0].key >> (b * 8)) & 0xFF;
+        if (hist[b][first_byte] == (uint32_t)num) {
+            continue;
+        }
+        uint32_t offsets[256];
+        uint32_t sum = 0;
+        for (int i = 0; i < 256; i++) {
+            offsets[i] = sum;
+            sum += hist[b][i];
+        }
+        for (int i = 0; i < num; i++) {
+            const uint32_t byte = (uint32_t)((src[i].key >> (b * 8)) & 0xFF);
+            dst[offsets[byte]++] = src[i];
+        }
+        _sdq_sort_item_t* tmp = src;
+        src = dst;
+        dst = tmp;
+    }
+    // after an odd number of sort passes the result is in the tmp array
+    if (src != _sdq.items) {
+        _sdq.tmp_items = _sdq.items;
+        _sdq.items = src;
+    }
+}
+
+// ███████ ██    ██ ██████  ███    ███ ██ ████████
+// ██      ██    ██ ██   ██ ████  ████ ██    ██
+// ███████ ██    ██ ██████  ██ ████ ██ ██    ██
+//      ██ ██    ██ ██   ██ ██  ██  ██ ██    ██
+// ███████  ██████  ██████  ██      ██ ██    ██
+//
+// >>submit
+// submits the sorted pending draws in the range [start, end), the applied
+// state is tracked per submit call since the caller may change the
+// sokol_gfx.h state between calls
+static void _sdq_submit(int start, int end) {
+    const _sdq_draw_t* cur = 0;
+    for (int i = start; i < end; i++) {
+        const _sdq_draw_t* draw = &_sdq.draws[_sdq.items[i].draw_index];
+        // a pipeline change requires that bindings and uniforms are applied again
+        bool force = false;
+        if ((0 == cur) || (cur->pipeline.id != draw->pipeline.id)) {
+            sg_apply_pipeline(draw->pipeline);
+            _sdq.stats.num_apply_pipeline++;
+            force = true;
+        } else {
+            _sdq.stats.num_skipped_apply_pipeline++;
+        }
+        if (draw->bindgroup.id != SG_INVALID_ID) {
+            if (force || (cur->bindgroup.id != draw->bindgroup.id)) {
+                sg_apply_bindgroup(draw->bindgroup);
+                _sdq.stats.num_apply_bindings++;
+            } else {
+                _sdq.stats.num_skipped_apply_bindings++;
+            }
+        } else if (draw->has_bindings) {
+            if (force || !cur->has_bindings || (cur->bindgroup.id != SG_INVALID_ID) || (0 != memcmp(&cur->bindings, &draw->bindings, sizeof(sg_bindings)))) {
+                sg_apply_bindings(&draw->bindings);
+                _sdq.stats.num_apply_bindings++;
+            } else {
+                _sdq.stats.num_skipped_apply_bindings++;
+            }
+        }
+        for (int ub = 0; ub < SG_MAX_UNIFORMBLOCK_BINDSLOTS; ub++) {
+            const _sdq_uniform_t* u = &draw->uniforms[ub];
+            if (u->size == 0) {
+                continue;
+            }
+            const uint8_t* data = _sdq.uniform_data + u->offset;
+            const bool same = !force
+                && (cur->uniforms[ub].size == u->size)
+                && ((cur->uniforms[ub].offset == u->offset) || (0 == memcmp(_sdq.uniform_data + cur->uniforms[ub].offset, data, u->size)));
+            if (!same) {
+                const sg_range range = { data, u->size };
+                sg_apply_uniforms(ub, &range);
+                _sdq.stats.num_apply_uniforms++;
+            } else {
+                _sdq.stats.num_skipped_apply_uniforms++;
+            }
+        }
+        sg_draw(draw->base_element, draw->num_elements, draw->num_instances);
+        _sdq.stats.num_draws++;
+        cur = draw;
+    }
+}
+
+// sokol_gfx.h doesn't allow to apply bindings for shaders without resource bindings,
+// so empty bindings are not applied at all
+static bool _sdq_has_bindings(const sg_bindings* bnd) {
+    bool res = bnd->index_buffer.id != SG_INVALID_ID;
+    for (int i = 0; i < SG_MAX_VERTEXBUFFER_BINDSLOTS; i++) {
+        res |= bnd->vertex_buffers[i].id != SG_INVALID_ID;
+    }
+    for (int i = 0; i < SG_MAX_IMAGE_BINDSLOTS; i++) {
+        res |= bnd->images[i].id != SG_INVALID_ID;
+    }
+    for (int i = 0; i < SG_MAX_SAMPLER_BINDSLOTS; i++) {
+        res |= bnd->samplers[i].id != SG_INVALID_ID;
+    }
+    for (int i = 0; i < SG_MAX_STORAGEBUFFER_BINDSLOTS; i++) {
+        res |= bnd->storage_buffers[i].id != SG_INVALID_ID;
+    }
+    return res;
+}
+
+static void _sdq_reset_queue(void) {
+    _sdq.num_draws = 0;
+    _sdq.num_items = 0;
+    _sdq.uniform_pos = 0;
+    _sdq.sorted = true;
+}
+
+// ██████  ██    ██ ██████  ██      ██  ██████
+// ██   ██ ██    ██ ██   ██ ██      ██ ██
+// ██████  ██    ██ ██████  ██      ██ ██
+// ██      ██    ██ ██   ██ ██      ██ ██
+// ██       ██████  ██████  ███████ ██  ██████
+//
+// >>public
+static sdq_desc_t _sdq_desc_defaults(const sdq_desc_t* desc) {
+    SOKOL_ASSERT((desc->allocator.alloc_fn && desc->allocator.free_fn) || (!desc->allocator.alloc_fn && !desc->allocator.free_fn));
+    sdq_desc_t res = *desc;
+    res.max_draws = _sdq_def(res.max_draws, _SDQ_DEFAULT_MAX_DRAWS);
+    res.max_uniform_bytes = _sdq_def(res.max_uniform_bytes, _SDQ_DEFAULT_MAX_UNIFORM_BYTES);
+    return res;
+}
+
+SOKOL_API_IMPL void sdq_setup(const sdq_desc_t* desc) {
+    SOKOL_ASSERT(desc);
+    _sdq_clear(&_sdq, sizeof(_sdq));
+    _sdq.init_cookie = _SDQ_INIT_COOKIE;
+    _sdq.desc = _sdq_desc_defaults(desc);
+    SOKOL_ASSERT((_sdq.desc.max_draws > 0) && (_sdq.desc.max_uniform_bytes > 0));
+    _sdq.draws = (_sdq_draw_t*) _sdq_malloc_clear((size_t)_sdq.desc.max_draws * sizeof(_sdq_draw_t));
+    _sdq.items = (_sdq_sort_item_t*) _sdq_malloc((size_t)_sdq.desc.max_draws * sizeof(_sdq_sort_item_t));
+    _sdq.tmp_items = (_sdq_sort_item_t*) _sdq_malloc((size_t)_sdq.desc.max_draws * sizeof(_sdq_sort_item_t));
+    _sdq.uniform_data = (uint8_t*) _sdq_malloc((size_t)_sdq.desc.max_uniform_bytes);
+    _sdq.sorted = true;
+}
+
+SOKOL_API_IMPL void sdq_shutdown(void) {
+    SOKOL_ASSERT(_SDQ_INIT_COOKIE == _sdq.init_cookie);
+    _sdq_free(_sdq.uniform_data);
+    _sdq_free(_sdq.tmp_items);
+    _sdq_free(_sdq.items);
+    _sdq_free(_sdq.draws);
+    _sdq.init_cookie = 0;
+}
+
+SOKOL_API_IMPL uint64_t sdq_make_key(int pass, int layer, sg_pipeline pip, int material, float depth) {
+    SOKOL_ASSERT((pass >= 0) && (pass < 256));
+    SOKOL_ASSERT((layer >= 0) && (layer < 256));
+    SOKOL_ASSERT((material >= 0) && (material < 65536));
+    // written as a negated comparison so that a NaN depth also maps to 0.0
+    // (converting NaN to an integer is undefined behaviour)
+    if (!(depth >= 0.0f)) {
+        depth = 0.0f;
+    } else if (depth > 1.0f) {
+        depth = 1.0f;
+    }
+    // the lower 16 bits of a resource handle are the pool slot index
+    const uint64_t pip_bits = pip.id & 0xFFFF;
+    const uint64_t depth_bits = (uint64_t)(depth * 65535.0f);
+    return ((uint64_t)pass << _SDQ_PASS_SHIFT)
+        | ((uint64_t)layer << 48)
+        | (pip_bits << 32)
+        | ((uint64_t)material << 16)
+        | depth_bits;
+}
+
+SOKOL_API_IMPL void sdq_draw(const sdq_draw_desc* desc) {
+    SOKOL_ASSERT(_SDQ_INIT_COOKIE == _sdq.init_cookie);
+    SOKOL_ASSERT(desc);
+    if (_sdq.num_draws >= _sdq.desc.max_draws) {
+        _SDQ_ERROR(DRAWS_EXHAUSTED);
+        _sdq.stats.num_dropped_draws++;
+        return;
+    }
+    uint32_t uniform_bytes = 0;
+    for (int ub = 0; ub < SG_MAX_UNIFORMBLOCK_BINDSLOTS; ub++) {
+        const uint32_t size = (uint32_t)desc->uniforms[ub].size;
+        uniform_bytes += (size + (_SDQ_UNIFORM_ALIGN - 1)) & ~(uint32_t)(_SDQ_UNIFORM_ALIGN - 1);
+    }
+    if ((_sdq.uniform_pos + uniform_bytes) > (uint32_t)_sdq.desc.max_uniform_bytes) {
+        _SDQ_ERROR(UNIFORMS_EXHAUSTED);
+        _sdq.stats.num_dropped_draws++;
+        return;
+    }
+    const int draw_index = _sdq.num_draws++;
+    _sdq_draw_t* draw = &_sdq.draws[draw_index];
+    draw->pipeline = desc->pipeline;
+    draw->bindgroup = desc->bindgroup;
+    draw->bindings = desc->bindings;
+    draw->has_bindings = _sdq_has_bindings(&desc->bindings);
+    draw->base_element = desc->base_element;
+    draw->num_elements = desc->num_elements;
+    draw->num_instances = desc->num_instances;
+    for (int ub = 0; ub < SG_MAX_UNIFORMBLOCK_BINDSLOTS; ub++) {
+        const sg_range* src = &desc->uniforms[ub];
+        _sdq_uniform_t* dst = &draw->uniforms[ub];
+        dst->offset = _sdq.uniform_pos;
+        dst->size = (uint32_t)src->size;
+        if (src->size > 0) {
+            SOKOL_ASSERT(src->ptr);
+            memcpy(_sdq.uniform_data + _sdq.uniform_pos, src->ptr, src->size);
+            _sdq.uniform_pos += (dst->size + (_SDQ_UNIFORM_ALIGN - 1)) & ~(uint32_t)(_SDQ_UNIFORM_ALIGN - 1);
+        }
+    }
+    _sdq_sort_item_t* item = &_sdq.items[_sdq.num_items++];
+    item->key = desc->key;
+    item->draw_index = (uint32_t)draw_index;
+    _sdq.sorted = false;
+}
+
+SOKOL_API_IMPL void sdq_flush(void) {
+    SOKOL_ASSERT(_SDQ_INIT_COOKIE == _sdq.init_cookie);
+    if (!_sdq.sorted) {
+        _sdq_radix_sort();
+        _sdq.sorted = true;
+    }
+    _sdq_submit(0, _sdq.num_items);
+    _sdq_reset_queue();
+}
+
+SOKOL_API_IMPL void sdq_flush_pass(int pass) {
+    SOKOL_ASSERT(_SDQ_INIT_COOKIE == _sdq.init_cookie);
+    SOKOL_ASSERT((pass >= 0) && (pass < 256));
+    if (!_sdq.sorted) {
+        _sdq_radix_sort();
+        _sdq.sorted = true;
+    }
+    // the draws of a pass are a contiguous range in the sorted items
+    int start = 0;
+    while ((start < _sdq.num_items) && ((int)(_sdq.items[start].key >> _SDQ_PASS_SHIFT) < pass)) {
+        start++;
+    }
+    int end = start;
+    while ((end < _sdq.num_items) && ((int)(_sdq.items[end].key >> _SDQ_PASS_SHIFT) == pass)) {
+        end++;
+    }
+    _sdq_submit(start, end);
+    // remove the submitted range, the remaining items stay sorted
+    const int num_tail = _sdq.num_items - end;
+    if (num_tail > 0) {
+        memmove(&_sdq.items[start], &_sdq.items[end], (size_t)num_tail * sizeof(_sdq_sort_item_t));
+    }
+    _sdq.num_items -= (end - start);
+    if (_sdq.num_items == 0) {
+        _sdq_reset_queue();
+    }
+}
+
+SOKOL_API_IMPL void sdq_clear(void) {
+    SOKOL_ASSERT(_SDQ_INIT_COOKIE == _sdq.init_cookie);
+    _sdq_reset_queue();
+}
+
+SOKOL_API_IMPL int sdq_num_queued_draws(void) {
+    SOKOL_ASSERT(_SDQ_INIT_COOKIE == _sdq.init_cookie);
+    return _sdq.num_items;
+}
+
+SOKOL_API_IMPL sdq_stats sdq_query_stats(void) {
+    SOKOL_ASSERT(_SDQ_INIT_COOKIE == _sdq.init_cookie);
+    return _sdq.stats;
+}
+
+SOKOL_API_IMPL void sdq_reset_stats(void) {
+    SOKOL_ASSERT(_SDQ_INIT_COOKIE == _sdq.init_cookie);
+    _sdq_clear(&_sdq.stats, sizeof(_sdq.stats));
+}
+
+#endif /* SOKOL_DRAW_QUEUE_IMPL */
@@ -34,7 +34,8 @@
 
     The dummy backend replaces the platform-specific backend code with empty
     stub functions. This is useful for writing tests that need to run on the
-    command line.
+    command line. With frame stats enabled, the dummy backend also records
+    the effects a real backend would have (see DUMMY BACKEND STATS).
 
     Optionally provide the following defines with your own implementations:
 
@@ -186,6 +187,18 @@
         or index-buffer bindings are allowed and will be rejected by the validation
         layer.
 
+        If the same resource bindings are applied over and over again, consider
+        baking them into a pre-validated sg_bindgroup object instead:
+
+            sg_bindgroup sg_make_bindgroup(const sg_bindgroup_desc* desc)
+            sg_apply_bindgroup(sg_bindgroup bg)
+
+        See the documentation block of sg_bindgroup_desc for details.
+
+        Sequences of sg_apply_*(), sg_draw() and sg_dispatch() calls can
+        also be recorded into a command list (on any thread) and replayed
+        later inside a pass, see the section 'COMMAND LISTS' below.
+
     --- optionally update shader uniform data with:
 
             sg_apply_uniforms(int ub_slot, const sg_range* data)
@@ -207,6 +220,12 @@
         containing per-instance data must be bound, and the num_instances parameter
         must be > 1.
 
+    --- ...or kick off a draw call with arguments read from a GPU buffer:
+
+            sg_draw_indirect(sg_buffer buf, int offset)
+
+        See the section 'ON INDIRECT DRAWS' for details.
+
     --- ...or kick of a dispatch call to invoke a compute shader workload:
 
             sg_dispatch(int num_groups_x, int num_groups_y, int num_groups_z)
@@ -234,6 +253,8 @@
             sg_destroy_shader(sg_shader shd)
             sg_destroy_pipeline(sg_pipeline pip)
             sg_destroy_attachments(sg_attachments atts)
+            sg_destroy_bindgroup(sg_bindgroup bg)
+            sg_destroy_command_list(sg_command_list cl)
 
     --- to set a new viewport rectangle, call:
 
@@ -274,6 +295,74 @@
         operation only references the valid (updated) data in the
         buffer or image.
 
+    --- to overwrite parts of a buffer or image while keeping the remaining
+        content intact, call:
+
+            sg_update_buffer_range(sg_buffer buf, int offset, const sg_range* data)
+            sg_update_image_region(sg_image img, const sg_image_region* region, const sg_range* data)
+
+        Unlike sg_update_buffer() and sg_update_image(), those functions can
+        be called any number of times per frame and resource, for instance
+        to stream in dirty tiles of a terrain heightmap or dirty rectangles of
+        a texture atlas. Resources updated this way must have been created with
+        .usage.dynamic_update (not .stream_update).
+
+        sg_update_buffer_range() writes data->size bytes at the byte offset
+        'offset', both the offset and size must be a multiple of 4.
+
+        sg_update_image_region() overwrites a rectangle in a single mipmap
+        level and slice (cubemap face, array layer or 3D-texture depth slice)
+        of an image, described by an sg_image_region struct:
+
+            sg_update_image_region(img,
+                &(sg_image_region){
+                    .mip_level = 0,
+                    .slice = 0,
+                    .x = 64, .y = 32,
+                    .width = 16, .height = 16,
+                },
+                &SG_RANGE(pixels));
+
+        The pixel data must be tightly packed (no row padding). Compressed
+        pixel formats are not supported.
+
+        Partial updates can be mixed with a preceding sg_update_buffer() or
+        sg_update_image() in the same frame (but not the other way around),
+        and can't be mixed with sg_append_buffer() in the same frame.
+
+        All partial updates of a resource in a frame must happen before the
+        resource is bound with sg_apply_bindings() or sg_apply_bindgroup()
+        in that frame, otherwise the validation layer reports an error. On
+        Metal and WebGPU the GPU only executes the frame's draw calls after
+        the updates have been written, so a draw issued before a partial
+        update would already see the updated data.
+
+        Backend-specific notes:
+
+            - GL: consecutive range updates into the same buffer are
+              gathered and uploaded with a single glBufferSubData() call
+            - Metal: since dynamic resources are multi-buffered, the first
+              partial update in a frame copies the current content into the
+              next buffer or texture before the update is applied
+            - D3D11: buffers and images with usage.dynamic_update are created
+              with D3D11_USAGE_DEFAULT and updated via UpdateSubresource()
+              (injected D3D11 resources must also use D3D11_USAGE_DEFAULT
+              for partial updates). This also applies to full updates with
+              sg_update_buffer() and sg_update_image(), which then go through
+              UpdateSubresource() instead of Map(WRITE_DISCARD), and the
+              driver may need to copy the data into a temporary buffer when
+              the GPU still uses the resource. Resources which are only
+              updated as a whole should be created with usage.stream_update,
+              which keeps D3D11_USAGE_DYNAMIC and Map(WRITE_DISCARD).
+
+    --- to (re-)build the mipmap chain of an image on the GPU from the
+        content of its top mip level, call:
+
+            sg_generate_mipmaps(sg_image img)
+
+        The image must have been created with sg_image_desc.generate_mipmaps,
+        see the section 'ON MIPMAP GENERATION' for details.
+
     --- to append a chunk of data to a buffer resource, call:
 
             int sg_append_buffer(sg_buffer buf, const sg_range* data)
@@ -329,6 +418,73 @@
         is associated with one draw call, but will be problematic when
         a single indexed draw call spans several appended chunks of indices.
 
+    --- to read back the content of an image or buffer (for instance for
+        screenshots, automated rendering tests or to get the results of
+        a compute shader), call:
+
+            sg_readback sg_read_image_async(const sg_image_readback_desc* desc)
+            sg_readback sg_read_buffer_async(const sg_buffer_readback_desc* desc)
+
+        Both functions must be called outside a pass, they record a copy
+        operation into the current frame and return immediately with an
+        sg_readback handle. The readback completes a couple of frames later
+        when the GPU has finished the copy, completion is checked in sg_commit(),
+        at which point the data is copied into the memory provided in
+        desc.data and the completion callback is invoked:
+
+            static void readback_done(const sg_readback_result* res) {
+                if (!res->failed) {
+                    // res->data.ptr and res->data.size point to the destination memory
+                    ...
+                }
+            }
+
+            sg_read_image_async(&(sg_image_readback_desc){
+                .image = img,
+                .data = SG_RANGE(pixels),
+                .callback = readback_done,
+                .user_data = ...,
+            });
+
+        The destination memory must remain valid until the callback
+        has been called. Instead of providing a callback you can also poll
+        the readback state with:
+
+            bool sg_query_readback_pending(sg_readback rb)
+
+        ...which returns false when the readback has completed (or failed).
+
+        An image readback reads a rectangle in a single mipmap level and
+        slice described by an sg_image_region struct (by default the entire
+        mipmap level 0 and slice 0), the pixel data is written tightly packed
+        with the same row order as sg_update_image() data. Depth-stencil,
+        compressed and MSAA images can't be read back. A buffer readback
+        reads desc.size bytes (by default the entire buffer) starting at the
+        byte offset desc.offset, both must be a multiple of 4.
+
+        Readbacks which are still pending in sg_shutdown() will be completed
+        with the .failed flag set.
+
+        The maximum number of pending readbacks is defined by
+        sg_desc.readback_pool_size (default: 16).
+
+        Backend-specific notes:
+
+            - GL: images are read with glReadPixels() into a pixel-pack-buffer,
+              buffers are copied with glCopyBufferSubData(), completion is
+              detected with a fence object. On WebGL2 image readbacks are
+              synchronous (but the callback is still deferred to sg_commit())
+              and buffer readbacks are not supported. On GLES3 only RGBA8
+              images are guaranteed to be readable
+            - Metal: the copy happens in a blit command encoder into a
+              shared MTLBuffer, completion is detected via the command
+              buffer status
+            - D3D11: the copy goes into a staging resource which is polled
+              with Map(..., D3D11_MAP_FLAG_DO_NOT_WAIT, ...)
+            - WebGPU: the copy goes into a mappable buffer which is mapped with
+              wgpuBufferMapAsync(), so the WebGPU event loop must be pumped
+              for readbacks to complete
+
     --- to check at runtime for optional features, limits and pixelformat support,
         call:
 
@@ -394,6 +550,23 @@
         to sokol_gfx.h internals, and may change more often than other
         public API functions and structs.
 
+    --- you can inspect the current size, usage and high-water-mark of
+        the resource pools via:
+
+            sg_pool_stats sg_query_pool_stats(void)
+
+        ...this is useful to tune the sg_desc.*_pool_size values, or to
+        check how much growable pools have grown (see sg_desc.growable_pools).
+
+    --- you can query the estimated GPU memory used by buffer and image
+        objects via:
+
+            sg_memory_stats sg_query_memory_stats(void)
+
+        ...and get notified when a memory budget is exceeded by setting
+        sg_desc.memory_budget (see the sg_memory_stats documentation
+        for details).
+
     --- you can query frame stats and control stats collection via:
 
             sg_query_frame_stats()
@@ -401,6 +574,11 @@
             sg_disable_frame_stats()
             sg_frame_stats_enabled()
 
+    --- when GPU timings are enabled via sg_desc.gpu_timings, you can query
+        the GPU time spent in each pass and debug group of a recent frame via:
+
+            sg_gpu_timings sg_query_gpu_timings(void)
+
     --- you can ask at runtime what backend sokol_gfx.h has been compiled for:
 
             sg_backend sg_query_backend(void)
@@ -818,6 +996,123 @@
         - https://floooh.github.io/sokol-webgpu/imageblur-sapp.html
 
 
+    ON INDIRECT DRAWS
+    =================
+    sg_draw_indirect() issues a draw call which reads its arguments (number
+    of elements, number of instances, etc...) from a GPU buffer instead of
+    from function arguments. The typical use case is a compute shader which
+    decides how many instances to render (for instance after frustum culling
+    on the GPU), without a round trip to the CPU.
+
+    Indirect draws are supported where compute passes are supported,
+    check sg_query_features().draw_indirect.
+
+    A buffer which holds indirect draw arguments must be created with
+    `indirect_buffer` usage, and if the arguments are written by a compute
+    shader, also with `storage_buffer` usage:
+
+        sg_buffer args_buf = sg_make_buffer(&(sg_buffer_desc){
+            .usage = {
+                .storage_buffer = true,
+                .indirect_buffer = true,
+            },
+            .size = sizeof(sg_draw_indexed_indirect_args),
+        });
+
+    The buffer content at the byte offset passed to sg_draw_indirect() must
+    have the memory layout of the struct sg_draw_indirect_args for
+    non-indexed rendering, or sg_draw_indexed_indirect_args for indexed
+    rendering (the currently applied pipeline decides which):
+
+        typedef struct sg_draw_indirect_args {
+            uint32_t num_elements;
+            uint32_t num_instances;
+            uint32_t base_element;
+            uint32_t base_instance;     // must be 0
+        } sg_draw_indirect_args;
+
+        typedef struct sg_draw_indexed_indirect_args {
+            uint32_t num_elements;
+            uint32_t num_instances;
+            uint32_t base_element;
+            int32_t base_vertex;
+            uint32_t base_instance;     // must be 0
+        } sg_draw_indexed_indirect_args;
+
+    Inside a render pass, indirect draws work exactly like sg_draw() except
+    for where the arguments come from:
+
+        sg_apply_pipeline(pip);
+        sg_apply_bindings(&bindings);
+        sg_draw_indirect(args_buf, 0);
+
+    NOTE: in the GL backends, the index buffer offset in sg_bindings must
+    be zero for indexed indirect draws, use base_element in the indirect
+    draw arguments instead.
+
+    The header sokol_gpu_cull.h provides a reusable compute stage which
+    frustum-culls instances on the GPU and writes the indirect draw
+    arguments for the following render pass.
+
+
+    ON MIPMAP GENERATION
+    ====================
+    Instead of providing the content of all mip levels in sg_make_image(),
+    an image can be created with the .generate_mipmaps flag, and sokol-gfx
+    will build mip levels 1..N on the GPU by downsampling mip level 0:
+
+        sg_image img = sg_make_image(&(sg_image_desc){
+            .width = 256,
+            .height = 256,
+            .generate_mipmaps = true,
+            .data.subimage[0][0] = SG_RANGE(pixels),
+        });
+
+    If .num_mipmaps is left at zero, the image gets a complete mip chain down
+    to 1x1 pixels (clamped to SG_MAX_MIPMAPS), otherwise only the requested
+    number of mip levels is created.
+
+    Only the top mip level may be provided as initialization data (and in
+    sg_update_image()), the validation layer rejects data for the other mip
+    levels. The mip chain is built automatically:
+
+        - after sg_make_image() with initial data
+        - after each sg_update_image()
+
+    For all other cases (render- and storage-attachment images, or after
+    sg_update_image_region()) call sg_generate_mipmaps() explicitly, for
+    instance after the render pass which rendered into mip level 0 of an
+    offscreen render target:
+
+        sg_begin_pass(&(sg_pass){ .attachments = offscreen_atts, ... });
+        ...
+        sg_end_pass();
+        sg_generate_mipmaps(offscreen_img);
+
+    sg_generate_mipmaps() may be called inside a pass (but not while recording
+    a command list), in that case the mipmap generation is deferred until
+    sg_end_pass() since most 3D APIs can't do it in the middle of a pass.
+
+    Mipmap generation requires a pixel format which is both filterable and
+    renderable (see sg_query_pixelformat()), and it doesn't work with
+    MSAA images, compressed or depth-stencil pixel formats, or injected
+    native textures.
+
+    Backend-specific notes:
+
+        - GL: glGenerateMipmap()
+        - D3D11: the texture is created with D3D11_RESOURCE_MISC_GENERATE_MIPS
+          and the mip chain is built with ID3D11DeviceContext::GenerateMips()
+        - Metal: a blit-encoder generateMipmapsForTexture: call
+        - WebGPU: there is no builtin mipmap generation, sokol-gfx renders
+          each mip level with a downsampling fullscreen-triangle pipeline
+          (not supported for 3D images)
+
+    Note that the mip levels are generated with a simple box filter, if you
+    need higher-quality downsampling, provide all mip levels as image data
+    instead.
+
+
     ON SHADER CREATION
     ==================
     sokol-gfx doesn't come with an integrated shader cross-compiler, instead
@@ -1599,6 +1894,84 @@
     listener item was found and removed, and false otherwise.
 
 
+    COMMAND LISTS
+    =============
+    A command list records a sequence of the following calls into a compact
+    binary command stream, instead of executing them immediately:
+
+        sg_apply_viewport(), sg_apply_viewportf()
+        sg_apply_scissor_rect(), sg_apply_scissor_rectf()
+        sg_apply_pipeline()
+        sg_apply_bindings()
+        sg_apply_bindgroup()
+        sg_apply_uniforms()
+        sg_draw()
+        sg_dispatch()
+
+    The recorded calls are validated at record time, and resource handles
+    are resolved into internal references, so that replaying a command list
+    skips the validation layer and resource lookups. This is useful for
+    static parts of a scene which are rendered the same way each frame, and
+    for recording draw calls on worker threads.
+
+    Command lists are created on the render thread with:
+
+        sg_command_list cl = sg_make_command_list(&(sg_command_list_desc){
+            .buffer_size = 64 * 1024,   // the default
+        });
+
+    ...where .buffer_size is the size of the command stream in bytes. To record
+    into a command list, bracket the calls to be recorded with:
+
+        sg_begin_command_list(cl);
+        sg_apply_pipeline(pip);
+        sg_apply_bindings(&bindings);
+        sg_apply_uniforms(UB_vs_params, &SG_RANGE(vs_params));
+        sg_draw(0, 36, 1);
+        ...
+        sg_end_command_list();
+
+    sg_begin_command_list() discards any previously recorded commands. While a
+    command list is being recorded, the above functions don't access any
+    sokol-gfx state other than the command list and the resource pools, so
+    recording can happen outside a pass, and on any thread (one command list
+    per thread, the recording command list is tracked in a thread-local
+    variable). Note that any validation errors will also be reported on the
+    recording thread.
+
+    Execute a recorded command list inside a render- or compute-pass on
+    the render thread with:
+
+        sg_execute_command_list(cl);
+
+    ...this can happen any number of times, until the command list is recorded
+    again. A command list must either contain only render pipelines and be
+    executed in a render pass, or only compute pipelines and be executed in
+    a compute pass. The first recorded call after sg_begin_command_list()
+    which depends on a pipeline must be preceded by a recorded sg_apply_pipeline()
+    (e.g. the pipeline state of the pass doesn't carry over into the command list),
+    on the other hand the pipeline, bindings and uniforms applied by the last
+    recorded commands remain applied after sg_execute_command_list() returns.
+
+    Please note the following restrictions:
+
+    - while worker threads are recording command lists, the render thread must
+      not call any functions which create, destroy or update resource objects
+    - resource objects referenced by a command list may be updated or
+      destroyed between recording and execution (just as with regular
+      rendering, draw calls with destroyed or invalid resources will be skipped),
+      but a command list doesn't keep referenced resources alive
+    - validation checks which depend on the pass (for instance that an image
+      isn't bound as texture while also being used as pass attachment) are
+      not performed on recorded commands
+    - when a command list runs out of space, an error will be logged and the
+      command list can't be executed until it is recorded again
+    - the frame stats returned by sg_query_frame_stats() are counted when
+      command lists are executed, not when they are recorded
+
+    The number of command list objects is defined by sg_desc.command_list_pool_size
+    (default: 16).
+
     RESOURCE CREATION AND DESTRUCTION IN DETAIL
     ===========================================
     The 'vanilla' way to create resource objects is with the 'make functions':
@@ -1763,6 +2136,40 @@
     an attachments object with invalid image objects.
 
 
+    DUMMY BACKEND STATS
+    ===================
+    The dummy backend doesn't talk to a 3D API, but when frame stats are
+    enabled via sg_enable_frame_stats() it records what a GL-style backend
+    with a state cache would have done into sg_frame_stats.dummy. This allows
+    to run CPU-side benchmarks and state-change regression tests on headless
+    CI machines without a GPU, for instance by rendering a scene for a couple
+    of frames and comparing sg_query_frame_stats() against known values.
+
+    The simulated state cache works like this:
+
+    - sg_apply_pipeline() with the same pipeline as the previous call is
+      counted in .num_skip_redundant_pipeline, otherwise in .num_set_pipeline,
+      and each changed render state group (depth, stencil, blend and
+      rasterizer state) between the old and new pipeline is counted in
+      .num_set_render_state
+    - each vertex buffer, index buffer, image, sampler, storage buffer and
+      storage image bound in sg_apply_bindings() is compared against what is
+      currently bound to the same bind slot (including the buffer offset and the
+      currently active internal buffer of dynamic and stream resources), and
+      counted either in .num_bind_* or .num_skip_redundant_*
+    - sg_begin_pass() sets viewport and scissor rect to the full framebuffer,
+      sg_apply_viewport() and sg_apply_scissor_rect() are only counted in
+      .num_set_viewport/.num_set_scissor_rect when the rectangle changes
+    - uploaded bytes are tracked in .size_upload_buffer and .size_upload_image,
+      this includes initial content provided at resource creation
+    - draws are additionally split into indexed, instanced and indirect draws,
+      and the number of elements and instances are summed up in .num_elements
+      and .num_instances (indirect draws don't contribute to those)
+
+    The cache persists across passes and frames, and is cleared by
+    sg_reset_state_cache().
+
+
     WEBGPU CAVEATS
     ==============
     For a general overview and design notes of the WebGPU backend see:
@@ -1935,6 +2342,9 @@ typedef struct sg_sampler       { uint32_t id; } sg_sampler;
 typedef struct sg_shader        { uint32_t id; } sg_shader;
 typedef struct sg_pipeline      { uint32_t id; } sg_pipeline;
 typedef struct sg_attachments   { uint32_t id; } sg_attachments;
+typedef struct sg_bindgroup     { uint32_t id; } sg_bindgroup;
+typedef struct sg_command_list  { uint32_t id; } sg_command_list;
+typedef struct sg_readback      { uint32_t id; } sg_readback;
 
 /*
     sg_range is a pointer-size-pair struct used to pass memory blobs into
@@ -1965,6 +2375,7 @@ typedef struct sg_range {
 enum {
     SG_INVALID_ID = 0,
     SG_NUM_INFLIGHT_FRAMES = 2,
+    SG_MAX_UPDATE_SLOTS = 3,
     SG_MAX_COLOR_ATTACHMENTS = 4,
     SG_MAX_STORAGE_ATTACHMENTS = 4,
     SG_MAX_UNIFORMBLOCK_MEMBERS = 16,
@@ -1977,6 +2388,8 @@ enum {
     SG_MAX_SAMPLER_BINDSLOTS = 16,
     SG_MAX_STORAGEBUFFER_BINDSLOTS = 8,
     SG_MAX_IMAGE_SAMPLER_PAIRS = 16,
+    SG_MAX_GPU_TIMINGS = 64,
+    SG_GPU_TIMING_LABEL_SIZE = 32,
 };
 
 /*
@@ -2156,6 +2569,8 @@ typedef struct sg_features {
     bool compute;                       // storage buffers and compute shaders are supported
     bool msaa_image_bindings;           // if true, multisampled images can be bound as texture resources
     bool separate_buffer_types;         // cannot use the same buffer for vertex and indices (onlu WebGL2)
+    bool gpu_timings;                   // GPU timer queries are supported (see sg_desc.gpu_timings)
+    bool draw_indirect;                 // sg_draw_indirect() is supported
 } sg_features;
 
 /*
@@ -3046,6 +3461,119 @@ typedef struct sg_bindings {
     uint32_t _end_canary;
 } sg_bindings;
 
+/*
+    sg_bindgroup_desc
+
+    Creation parameters for sg_bindgroup objects, used in the
+    sg_make_bindgroup() call.
+
+    A bindgroup is an immutable, pre-validated snapshot of an sg_bindings
+    struct. Applying a bindgroup with sg_apply_bindgroup() has the same
+    effect as calling sg_apply_bindings() with the original sg_bindings
+    struct, but the bindings are only validated and resolved into internal
+    resource pointers once in sg_make_bindgroup(), instead of on each
+    sg_apply_bindings() call:
+
+        // at setup time:
+        sg_bindgroup bg = sg_make_bindgroup(&(sg_bindgroup_desc){
+            .pipeline = pip,
+            .bindings = {
+                .vertex_buffers[0] = vbuf,
+                .index_buffer = ibuf,
+                .images[IMG_tex] = img,
+                .samplers[SMP_smp] = smp,
+            },
+        });
+
+        // in the frame loop:
+        sg_apply_pipeline(pip);
+        sg_apply_bindgroup(bg);
+        sg_apply_uniforms(...);
+        sg_draw(...);
+
+    The .pipeline item is required and defines the expected bindings
+    layout (the vertex buffer layout and index type of the pipeline,
+    and the image-, sampler- and storage-buffer bindslots of the pipeline's
+    shader). The bindings are validated against this pipeline exactly
+    like in sg_apply_bindings() (so any validation errors will be reported
+    with the sg_apply_bindings prefix), and any bindings not used by
+    the pipeline are dropped.
+
+    A bindgroup can be applied with any pipeline which uses the same
+    shader object and has a compatible vertex buffer and index buffer
+    layout as the pipeline used to create the bindgroup.
+
+    A bindgroup doesn't own the referenced resources. If a referenced
+    resource is destroyed, or a buffer has overflown after sg_append_buffer(),
+    draw calls after sg_apply_bindgroup() will be silently skipped (and in
+    debug mode a validation error is reported).
+
+    Note that the content of dynamic or stream-update resources can still
+    be updated after the bindgroup has been created.
+
+    The .bindgroup_pool_size item in sg_desc defines the maximum number
+    of bindgroup objects (default: 256).
+*/
+typedef struct sg_bindgroup_desc {
+    uint32_t _start_canary;
+    sg_pipeline pipeline;
+    sg_bindings bindings;
+    const char* label;
+    uint32_t _end_canary;
+} sg_bindgroup_desc;
+
+/*
+    sg_command_list_desc
+
+    Creation parameters for sg_command_list objects, used in the
+    sg_make_command_list() call:
+
+    .buffer_size    size of the recorded command stream in bytes (default: 64 KBytes)
+    .label          optional debug label
+
+    See the documentation section 'COMMAND LISTS' at the top of
+    sokol_gfx.h for details.
+*/
+typedef struct sg_command_list_desc {
+    uint32_t _start_canary;
+    size_t buffer_size;
+    const char* label;
+    uint32_t _end_canary;
+} sg_command_list_desc;
+
+/*
+    sg_update_mode
+
+    How the GL and Metal backends avoid CPU/GPU synchronization stalls when
+    the content of a dynamic- or stream-update buffer or image is replaced
+    with sg_update_buffer(), sg_append_buffer() or sg_update_image(). This
+    is used in sg_buffer_desc.update_mode, sg_image_desc.update_mode and
+    as default value for both in sg_desc.update_mode:
+
+    SG_UPDATEMODE_MULTIBUFFER
+        sokol_gfx.h creates .num_update_slots (1..SG_MAX_UPDATE_SLOTS)
+        backend objects per resource and rotates through them on each
+        update, so that the GPU can still read from the previous frame's
+        copy while the CPU writes the next one
+    SG_UPDATEMODE_ORPHAN
+        only a single backend object is created, and each update first
+        orphans the old storage (glBufferData() with a null pointer) so
+        that the GL driver can hand out fresh memory without waiting for
+        the GPU, this saves memory for big streamed buffers
+
+    The default is SG_UPDATEMODE_MULTIBUFFER.
+
+    See the section 'Dynamic resource updates' in the sg_desc documentation
+    for details and backend-specific restrictions.
+*/
+typedef enum sg_update_mode {
+    _SG_UPDATEMODE_DEFAULT, // value 0 reserved for default-init
+    SG_UPDATEMODE_MULTIBUFFER,
+    SG_UPDATEMODE_ORPHAN,
+    _SG_UPDATEMODE_NUM,
+    _SG_UPDATEMODE_FORCE_U32 = 0x7FFFFFFF
+} sg_update_mode;
+
 /*
     sg_buffer_usage
 
@@ -3057,6 +3585,9 @@ typedef struct sg_bindings {
         the buffer will bound as index buffer via sg_bindings.index_buffer
     .storage_buffer (default: false)
         the buffer will bound as storage buffer via sg_bindings.storage_buffers[]
+    .indirect_buffer (default: false)
+        the buffer will provide the arguments for sg_draw_indirect() (can be
+        combined with .storage_buffer to write the arguments in a compute shader)
     .immutable (default: true)
         the buffer content will never be updated from the CPU side (but
         may be written to by a compute shader)
@@ -3069,6 +3600,7 @@ typedef struct sg_buffer_usage {
     bool vertex_buffer;
     bool index_buffer;
     bool storage_buffer;
+    bool indirect_buffer;
     bool immutable;
     bool dynamic_update;
     bool stream_update;
@@ -3085,6 +3617,8 @@ typedef struct sg_buffer_usage {
     .usage              .vertex_buffer = true, .immutable = true
     .data.ptr   0       (*must* be valid for immutable buffers without storage buffer usage)
     .data.size  0       (*must* be > 0 for immutable buffers without storage buffer usage)
+    .update_mode        sg_desc.update_mode (only for dynamic- and stream-update buffers)
+    .num_update_slots   sg_desc.num_update_slots (only with SG_UPDATEMODE_MULTIBUFFER)
     .label      0       (optional string label)
 
     For immutable buffers which are initialized with initial data,
@@ -3121,7 +3655,9 @@ typedef struct sg_buffer_usage {
     3D-API buffer, otherwise you need to provide SG_NUM_INFLIGHT_FRAMES buffers
     (only for GL and Metal, not D3D11). Providing multiple buffers for GL and
     Metal is necessary because sokol_gfx will rotate through them when calling
-    sg_update_buffer() to prevent lock-stalls.
+    sg_update_buffer() to prevent lock-stalls. Injected buffers ignore the
+    sg_desc.update_mode and sg_desc.num_update_slots defaults, and an explicit
+    .num_update_slots must not be greater than SG_NUM_INFLIGHT_FRAMES.
 
     Note that it is expected that immutable injected buffer have already been
     initialized with content, and the .content member must be 0!
@@ -3134,6 +3670,8 @@ typedef struct sg_buffer_desc {
     size_t size;
     sg_buffer_usage usage;
     sg_range data;
+    sg_update_mode update_mode;
+    int num_update_slots;
     const char* label;
     // optionally inject backend-specific resources
     uint32_t gl_buffers[SG_NUM_INFLIGHT_FRAMES];
@@ -3143,6 +3681,30 @@ typedef struct sg_buffer_desc {
     uint32_t _end_canary;
 } sg_buffer_desc;
 
+/*
+    sg_draw_indirect_args
+    sg_draw_indexed_indirect_args
+
+    The memory layout of the draw arguments in a buffer with
+    indirect_buffer usage, read by sg_draw_indirect(). The first
+    struct is used for non-indexed rendering, the second for
+    indexed rendering. The base_instance item must be zero.
+*/
+typedef struct sg_draw_indirect_args {
+    uint32_t num_elements;
+    uint32_t num_instances;
+    uint32_t base_element;
+    uint32_t base_instance;
+} sg_draw_indirect_args;
+
+typedef struct sg_draw_indexed_indirect_args {
+    uint32_t num_elements;
+    uint32_t num_instances;
+    uint32_t base_element;
+    int32_t base_vertex;
+    uint32_t base_instance;
+} sg_draw_indexed_indirect_args;
+
 /*
     sg_image_usage
 
@@ -3183,6 +3745,23 @@ typedef struct sg_image_data {
     sg_range subimage[SG_CUBEFACE_NUM][SG_MAX_MIPMAPS];
 } sg_image_data;
 
+/*
+    sg_image_region
+
+    Describes a rectangular area in a single mipmap level and slice of an
+    image for sg_update_image_region(). The .slice item is the cubemap face
+    index for cubemap images, the layer index for array images, and the
+    depth-slice index (in the given mipmap level) for 3D images.
+*/
+typedef struct sg_image_region {
+    int mip_level;
+    int slice;
+    int x;
+    int y;
+    int width;
+    int height;
+} sg_image_region;
+
 /*
     sg_image_desc
 
@@ -3195,10 +3774,13 @@ typedef struct sg_image_data {
     .width              0 (must be set to >0)
     .height             0 (must be set to >0)
     .num_slices         1 (3D textures: depth; array textures: number of layers)
-    .num_mipmaps        1
+    .num_mipmaps        1 (or the full mip chain if .generate_mipmaps is true)
+    .generate_mipmaps   false (build mip levels 1..N on the GPU from mip level 0)
     .pixel_format       SG_PIXELFORMAT_RGBA8 for textures, or sg_desc.environment.defaults.color_format for render targets
     .sample_count       1 for textures, or sg_desc.environment.defaults.sample_count for render targets
     .data               an sg_image_data struct to define the initial content
+    .update_mode        sg_desc.update_mode (only for dynamic- and stream-update images)
+    .num_update_slots   sg_desc.num_update_slots (only with SG_UPDATEMODE_MULTIBUFFER)
     .label              0 (optional string label for trace hooks)
 
     Q: Why is the default sample_count for render targets identical with the
@@ -3213,7 +3795,8 @@ typedef struct sg_image_data {
     NOTE:
 
     Regular (non-attachment) images with usage.immutable must be fully initialized by
-    providing a valid .data member which points to initialization data.
+    providing a valid .data member which points to initialization data
+    (with .generate_mipmaps only the top mip level must be provided).
 
     Images with usage.render_attachment or usage.storage_attachment must
     *not* be created with initial content. Be aware that the initial
@@ -3241,6 +3824,8 @@ typedef struct sg_image_data {
 
     The same rules apply as for injecting native buffers (see sg_buffer_desc
     documentation for more details).
+
+    See the section 'ON MIPMAP GENERATION' for details about .generate_mipmaps.
 */
 typedef struct sg_image_desc {
     uint32_t _start_canary;
@@ -3250,9 +3835,12 @@ typedef struct sg_image_desc {
     int height;
     int num_slices;
     int num_mipmaps;
+    bool generate_mipmaps;
     sg_pixel_format pixel_format;
     int sample_count;
     sg_image_data data;
+    sg_update_mode update_mode;
+    int num_update_slots;
     const char* label;
     // optionally inject backend-specific resources
     uint32_t gl_textures[SG_NUM_INFLIGHT_FRAMES];
@@ -3782,6 +4370,58 @@ typedef struct sg_attachments_desc {
     uint32_t _end_canary;
 } sg_attachments_desc;
 
+/*
+    sg_readback_result
+    sg_image_readback_desc
+    sg_buffer_readback_desc
+
+    Describe an asynchronous image- or buffer-readback operation for
+    sg_read_image_async() and sg_read_buffer_async().
+
+    The .data item points to the destination memory which will be written
+    when the readback has completed, this memory must remain valid until
+    the callback has been called (or sg_query_readback_pending() returns
+    false), and must be big enough to hold the requested data.
+
+    In sg_image_readback_desc, a zero .region.width or .region.height
+    means 'the remaining width or height of the mipmap level starting at
+    .region.x or .region.y'.
+
+    In sg_buffer_readback_desc, a zero .size means 'the remaining buffer
+    size starting at .offset'.
+
+    The optional callback is invoked from inside sg_commit() (or sg_shutdown()
+    for readbacks which didn't complete) with a pointer to an sg_readback_result
+    struct, the .data item is the written part of the destination memory.
+*/
+typedef struct sg_readback_result {
+    sg_readback readback;
+    bool failed;
+    sg_range data;
+    void* user_data;
+} sg_readback_result;
+
+typedef struct sg_image_readback_desc {
+    uint32_t _start_canary;
+    sg_image image;
+    sg_image_region region;
+    sg_range data;
+    void (*callback)(const sg_readback_result* result);
+    void* user_data;
+    uint32_t _end_canary;
+} sg_image_readback_desc;
+
+typedef struct sg_buffer_readback_desc {
+    uint32_t _start_canary;
+    sg_buffer buffer;
+    int offset;
+    int size;
+    sg_range data;
+    void (*callback)(const sg_readback_result* result);
+    void* user_data;
+    uint32_t _end_canary;
+} sg_buffer_readback_desc;
+
 /*
     sg_trace_hooks
 
@@ -3803,23 +4443,35 @@ typedef struct sg_trace_hooks {
     void (*make_shader)(const sg_shader_desc* desc, sg_shader result, void* user_data);
     void (*make_pipeline)(const sg_pipeline_desc* desc, sg_pipeline result, void* user_data);
     void (*make_attachments)(const sg_attachments_desc* desc, sg_attachments result, void* user_data);
+    void (*make_bindgroup)(const sg_bindgroup_desc* desc, sg_bindgroup result, void* user_data);
+    void (*make_command_list)(const sg_command_list_desc* desc, sg_command_list result, void* user_data);
     void (*destroy_buffer)(sg_buffer buf, void* user_data);
     void (*destroy_image)(sg_image img, void* user_data);
     void (*destroy_sampler)(sg_sampler smp, void* user_data);
     void (*destroy_shader)(sg_shader shd, void* user_data);
     void (*destroy_pipeline)(sg_pipeline pip, void* user_data);
     void (*destroy_attachments)(sg_attachments atts, void* user_data);
+    void (*destroy_bindgroup)(sg_bindgroup bg, void* user_data);
+    void (*destroy_command_list)(sg_command_list cl, void* user_data);
     void (*update_buffer)(sg_buffer buf, const sg_range* data, void* user_data);
     void (*update_image)(sg_image img, const sg_image_data* data, void* user_data);
+    void (*update_buffer_range)(sg_buffer buf, int offset, const sg_range* data, void* user_data);
+    void (*update_image_region)(sg_image img, const sg_image_region* region, const sg_range* data, void* user_data);
+    void (*generate_mipmaps)(sg_image img, void* user_data);
+    void (*read_image_async)(const sg_image_readback_desc* desc, sg_readback result, void* user_data);
+    void (*read_buffer_async)(const sg_buffer_readback_desc* desc, sg_readback result, void* user_data);
     void (*append_buffer)(sg_buffer buf, const sg_range* data, int result, void* user_data);
     void (*begin_pass)(const sg_pass* pass, void* user_data);
     void (*apply_viewport)(int x, int y, int width, int height, bool origin_top_left, void* user_data);
     void (*apply_scissor_rect)(int x, int y, int width, int height, bool origin_top_left, void* user_data);
     void (*apply_pipeline)(sg_pipeline pip, void* user_data);
     void (*apply_bindings)(const sg_bindings* bindings, void* user_data);
+    void (*apply_bindgroup)(sg_bindgroup bg, void* user_data);
     void (*apply_uniforms)(int ub_index, const sg_range* data, void* user_data);
     void (*draw)(int base_element, int num_elements, int num_instances, void* user_data);
+    void (*draw_indirect)(sg_buffer buf, int offset, void* user_data);
     void (*dispatch)(int num_groups_x, int num_groups_y, int num_groups_z, void* user_data);
+    void (*execute_command_list)(sg_command_list cl, void* user_data);
     void (*end_pass)(void* user_data);
     void (*commit)(void* user_data);
     void (*alloc_buffer)(sg_buffer result, void* user_data);
@@ -3893,6 +4545,7 @@ typedef struct sg_buffer_info {
     bool append_overflow;           // is buffer in overflow state (due to sg_append_buffer)
     int num_slots;                  // number of renaming-slots for dynamically updated buffers
     int active_slot;                // currently active write-slot for dynamically updated buffers
+    uint64_t num_bytes;             // estimated GPU memory size including all renaming-slots (see sg_query_memory_stats())
 } sg_buffer_info;
 
 typedef struct sg_image_info {
@@ -3900,6 +4553,7 @@ typedef struct sg_image_info {
     uint32_t upd_frame_index;       // frame index of last sg_update_image()
     int num_slots;                  // number of renaming-slots for dynamically updated images
     int active_slot;                // currently active write-slot for dynamically updated images
+    uint64_t num_bytes;             // estimated GPU memory size including all renaming-slots and MSAA samples
 } sg_image_info;
 
 typedef struct sg_sampler_info {
@@ -3918,6 +4572,114 @@ typedef struct sg_attachments_info {
     sg_slot_info slot;              // resource pool slot info
 } sg_attachments_info;
 
+/*
+    sg_pool_info
+    sg_pool_stats
+
+    Runtime information about the resource pools, returned by
+    sg_query_pool_stats(). The .high_water_mark item is the maximum
+    number of resource objects which have been alive at the same time
+    since sg_setup(). Pool sizes don't include the reserved slot for the
+    invalid resource id, and may be bigger than the pool sizes provided
+    in sg_desc when sg_desc.growable_pools is true.
+*/
+typedef struct sg_pool_info {
+    int size;               // current number of resource slots in the pool
+    int num_used;           // number of currently allocated resource slots
+    int high_water_mark;    // max number of allocated resource slots since sg_setup()
+} sg_pool_info;
+
+typedef struct sg_pool_stats {
+    sg_pool_info buffers;
+    sg_pool_info images;
+    sg_pool_info samplers;
+    sg_pool_info shaders;
+    sg_pool_info pipelines;
+    sg_pool_info attachments;
+    sg_pool_info bindgroups;
+    sg_pool_info command_lists;
+    sg_pool_info readbacks;
+} sg_pool_stats;
+
+/*
+    sg_memory_info
+    sg_buffer_memory_stats
+    sg_image_memory_stats
+    sg_memory_stats
+
+    The estimated GPU memory used by buffer and image objects, returned by
+    sg_query_memory_stats(). The numbers are tracked in the sokol_gfx.h core
+    when resource objects are created and destroyed, and are computed from
+    the creation parameters, they are not queried from the 3D backend:
+
+    - buffers: the buffer size
+    - images: the sum of all mip levels, faces and slices (with the row
+      pitch of the pixel format), multiplied by the sample count
+    - both are multiplied by the number of backend objects per resource
+      on GL and Metal (see sg_update_mode), D3D11 and WebGPU always
+      use a single backend object
+
+    Backend-internal allocations (like uniform buffers, GL pixel-unpack
+    buffers or driver-side renaming of streamed resources), padding and
+    alignment aren't included, the numbers should be treated as a lower
+    bound. Resource objects with injected backend objects are included,
+    and destroyed resources are only subtracted when their backend objects
+    are actually released (see sg_desc.deferred_destroy).
+
+    Buffers are counted by their update frequency, images with render- or
+    storage-attachment usage are counted in the .render_attachment or
+    .storage_attachment items instead of .immutable. The .total items
+    are the sum of all items in a group.
+
+    Memory budget:
+
+    Set sg_desc.memory_budget.num_bytes to a value > 0 to get notified
+    when the estimated total memory exceeds this budget:
+
+        sg_setup(&(sg_desc){
+            .memory_budget = {
+                .num_bytes = 512 * 1024 * 1024,
+                .exceeded_cb = my_budget_exceeded,
+                .user_data = ...,
+            },
+        });
+
+    The exceeded_cb callback (if provided) and a MEMORY_BUDGET_EXCEEDED
+    warning fire at the end of the sg_make_buffer(), sg_make_image(),
+    sg_init_buffer() or sg_init_image() call which pushed the total above
+    the budget. The callback is only called again after the total has
+    dropped back to or below the budget. It's safe to destroy resources
+    inside the callback (for instance to evict streamed textures).
+*/
+typedef struct sg_memory_info {
+    int num_resources;      // number of live resource objects
+    uint64_t num_bytes;     // estimated GPU memory in bytes
+} sg_memory_info;
+
+typedef struct sg_buffer_memory_stats {
+    sg_memory_info immutable;
+    sg_memory_info dynamic_update;
+    sg_memory_info stream_update;
+    sg_memory_info total;
+} sg_buffer_memory_stats;
+
+typedef struct sg_image_memory_stats {
+    sg_memory_info immutable;
+    sg_memory_info dynamic_update;
+    sg_memory_info stream_update;
+    sg_memory_info render_attachment;
+    sg_memory_info storage_attachment;
+    sg_memory_info total;
+} sg_image_memory_stats;
+
+typedef struct sg_memory_stats {
+    sg_buffer_memory_stats buffers;
+    sg_image_memory_stats images;
+    sg_memory_info total;           // buffers and images
+    uint64_t high_water_mark;       // max value of total.num_bytes since sg_setup()
+    uint64_t budget;                // sg_desc.memory_budget.num_bytes
+} sg_memory_stats;
+
 /*
     sg_frame_stats
 
@@ -3938,6 +4700,14 @@ typedef struct sg_frame_stats_gl {
     uint32_t num_disable_vertex_attrib_array;
     uint32_t num_uniform;
     uint32_t num_memory_barriers;
+    uint32_t num_bind_vertex_array;
+    uint32_t num_vao_cache_hits;
+    uint32_t num_vao_cache_misses;
+    uint32_t num_pbo_uploads;
+    uint32_t num_pbo_upload_fallbacks;
+    uint32_t num_pbo_fence_waits;
+    uint32_t size_pbo_uploads;
+    uint32_t num_buffer_orphans;
 } sg_frame_stats_gl;
 
 typedef struct sg_frame_stats_d3d11_pass {
@@ -4061,6 +4831,41 @@ typedef struct sg_frame_stats_wgpu {
     sg_frame_stats_wgpu_bindings bindings;
 } sg_frame_stats_wgpu;
 
+typedef struct sg_frame_stats_dummy {
+    uint32_t num_set_pipeline;
+    uint32_t num_skip_redundant_pipeline;
+    uint32_t num_set_render_state;
+    uint32_t num_set_viewport;
+    uint32_t num_skip_redundant_viewport;
+    uint32_t num_set_scissor_rect;
+    uint32_t num_skip_redundant_scissor_rect;
+    uint32_t num_bind_vertex_buffer;
+    uint32_t num_skip_redundant_vertex_buffer;
+    uint32_t num_bind_index_buffer;
+    uint32_t num_skip_redundant_index_buffer;
+    uint32_t num_bind_image;
+    uint32_t num_skip_redundant_image;
+    uint32_t num_bind_sampler;
+    uint32_t num_skip_redundant_sampler;
+    uint32_t num_bind_storage_buffer;
+    uint32_t num_skip_redundant_storage_buffer;
+    uint32_t num_bind_storage_image;
+    uint32_t num_skip_redundant_storage_image;
+    uint32_t num_uniform;
+    uint32_t size_uniform;
+    uint32_t num_upload_buffer;
+    uint32_t size_upload_buffer;
+    uint32_t num_upload_image;
+    uint32_t size_upload_image;
+    uint32_t num_draw;
+    uint32_t num_draw_indexed;
+    uint32_t num_draw_instanced;
+    uint32_t num_draw_indirect;
+    uint32_t num_dispatch;
+    uint32_t num_elements;
+    uint32_t num_instances;
+} sg_frame_stats_dummy;
+
 typedef struct sg_frame_stats {
     uint32_t frame_index;   // current frame counter, starts at 0
 
@@ -4070,6 +4875,7 @@ typedef struct sg_frame_stats {
     uint32_t num_apply_pipeline;
     uint32_t num_apply_bindings;
     uint32_t num_apply_uniforms;
+    uint32_t num_apply_uniforms_skipped;    // redundant sg_apply_uniforms() calls skipped (see sg_desc.dedup_uniforms)
     uint32_t num_draw;
     uint32_t num_dispatch;
     uint32_t num_update_buffer;
@@ -4085,8 +4891,44 @@ typedef struct sg_frame_stats {
     sg_frame_stats_d3d11 d3d11;
     sg_frame_stats_metal metal;
     sg_frame_stats_wgpu wgpu;
+    sg_frame_stats_dummy dummy;
 } sg_frame_stats;
 
+/*
+    sg_gpu_timings
+
+    GPU execution times of the passes and debug groups of a past frame,
+    obtained by calling sg_query_gpu_timings() when GPU timings have been
+    enabled with sg_desc.gpu_timings (currently only supported on the
+    GLCORE backend, check sg_features.gpu_timings).
+
+    Each sg_begin_pass()/sg_end_pass() and sg_push_debug_group()/
+    sg_pop_debug_group() pair records one sg_gpu_timing item, in the order
+    the scopes were opened. The .depth item is the nesting depth of the
+    scope (e.g. a debug group inside a pass has depth 1). Scopes beyond
+    SG_MAX_GPU_TIMINGS per frame are not measured and counted in
+    .num_dropped.
+
+    GPU timer results are collected without stalling the CPU, so the
+    returned timings are typically SG_NUM_INFLIGHT_FRAMES frames old
+    (compare .frame_index with sg_frame_stats.frame_index). The .valid
+    item is false until the first results are available.
+*/
+typedef struct sg_gpu_timing {
+    char label[SG_GPU_TIMING_LABEL_SIZE];   // the (truncated) pass label or debug group name
+    int depth;                              // nesting depth of the scope, 0 for top-level scopes
+    uint64_t duration_ns;                   // GPU time between the start and end of the scope in nanoseconds
+} sg_gpu_timing;
+
+typedef struct sg_gpu_timings {
+    bool valid;                 // false if no results are available (yet)
+    uint32_t frame_index;       // the frame the timings have been measured in
+    uint64_t frame_duration_ns; // GPU time between the start of the first and the end of the last scope
+    int num_timings;
+    int num_dropped;            // number of scopes which didn't fit into the timings array
+    sg_gpu_timing timings[SG_MAX_GPU_TIMINGS];
+} sg_gpu_timings;
+
 /*
     sg_log_item
 
@@ -4113,6 +4955,9 @@ typedef struct sg_frame_stats {
     _SG_LOGITEM_XMACRO(GL_FRAMEBUFFER_STATUS_UNSUPPORTED, "framebuffer completeness check failed with GL_FRAMEBUFFER_UNSUPPORTED (gl)") \
     _SG_LOGITEM_XMACRO(GL_FRAMEBUFFER_STATUS_INCOMPLETE_MULTISAMPLE, "framebuffer completeness check failed with GL_FRAMEBUFFER_INCOMPLETE_MULTISAMPLE (gl)") \
     _SG_LOGITEM_XMACRO(GL_FRAMEBUFFER_STATUS_UNKNOWN, "framebuffer completeness check failed (unknown reason) (gl)") \
+    _SG_LOGITEM_XMACRO(GL_READBACK_FRAMEBUFFER_INCOMPLETE, "framebuffer for image readback is incomplete (gl)") \
+    _SG_LOGITEM_XMACRO(GL_BUFFER_READBACK_NOT_SUPPORTED, "buffer readback not supported on this platform (gl)") \
+    _SG_LOGITEM_XMACRO(GL_DRAW_INDIRECT_INDEX_BUFFER_OFFSET, "indexed indirect draws require an index buffer offset of zero, draw skipped (gl)") \
     _SG_LOGITEM_XMACRO(D3D11_CREATE_BUFFER_FAILED, "CreateBuffer() failed (d3d11)") \
     _SG_LOGITEM_XMACRO(D3D11_CREATE_BUFFER_SRV_FAILED, "CreateShaderResourceView() failed for storage buffer (d3d11)") \
     _SG_LOGITEM_XMACRO(D3D11_CREATE_BUFFER_UAV_FAILED, "CreateUnorderedAccessView() failed for storage buffer (d3d11)") \
@@ -4146,6 +4991,9 @@ typedef struct sg_frame_stats {
     _SG_LOGITEM_XMACRO(D3D11_MAP_FOR_UPDATE_BUFFER_FAILED, "Map() failed when updating buffer (d3d11)") \
     _SG_LOGITEM_XMACRO(D3D11_MAP_FOR_APPEND_BUFFER_FAILED, "Map() failed when appending to buffer (d3d11)") \
     _SG_LOGITEM_XMACRO(D3D11_MAP_FOR_UPDATE_IMAGE_FAILED, "Map() failed when updating image (d3d11)") \
+    _SG_LOGITEM_XMACRO(D3D11_CREATE_READBACK_STAGING_FAILED, "failed to create staging resource for readback (d3d11)") \
+    _SG_LOGITEM_XMACRO(D3D11_MAP_FOR_READBACK_FAILED, "Map() failed when reading back image or buffer (d3d11)") \
+    _SG_LOGITEM_XMACRO(D3D11_PARTIAL_UPDATE_REQUIRES_DEFAULT_USAGE, "sg_update_buffer_range() or sg_update_image_region() on injected resource without D3D11_USAGE_DEFAULT (d3d11)") \
     _SG_LOGITEM_XMACRO(METAL_CREATE_BUFFER_FAILED, "failed to create buffer object (metal)") \
     _SG_LOGITEM_XMACRO(METAL_TEXTURE_FORMAT_NOT_SUPPORTED, "pixel format not supported for texture (metal)") \
     _SG_LOGITEM_XMACRO(METAL_CREATE_TEXTURE_FAILED, "failed to create texture object (metal)") \
@@ -4164,6 +5012,8 @@ typedef struct sg_frame_stats {
     _SG_LOGITEM_XMACRO(METAL_CREATE_RPS_FAILED, "failed to create render pipeline state (metal)") \
     _SG_LOGITEM_XMACRO(METAL_CREATE_RPS_OUTPUT, "") \
     _SG_LOGITEM_XMACRO(METAL_CREATE_DSS_FAILED, "failed to create depth stencil state (metal)") \
+    _SG_LOGITEM_XMACRO(METAL_CREATE_READBACK_BUFFER_FAILED, "failed to create buffer object for readback (metal)") \
+    _SG_LOGITEM_XMACRO(METAL_READBACK_COMMAND_BUFFER_FAILED, "command buffer with readback operation failed (metal)") \
     _SG_LOGITEM_XMACRO(WGPU_BINDGROUPS_POOL_EXHAUSTED, "bindgroups pool exhausted (increase sg_desc.bindgroups_cache_size) (wgpu)") \
     _SG_LOGITEM_XMACRO(WGPU_BINDGROUPSCACHE_SIZE_GREATER_ONE, "sg_desc.wgpu_bindgroups_cache_size must be > 1 (wgpu)") \
     _SG_LOGITEM_XMACRO(WGPU_BINDGROUPSCACHE_SIZE_POW2, "sg_desc.wgpu_bindgroups_cache_size must be a power of 2 (wgpu)") \
@@ -4183,9 +5033,13 @@ typedef struct sg_frame_stats {
     _SG_LOGITEM_XMACRO(WGPU_CREATE_RENDER_PIPELINE_FAILED, "wgpuDeviceCreateRenderPipeline() failed") \
     _SG_LOGITEM_XMACRO(WGPU_CREATE_COMPUTE_PIPELINE_FAILED, "wgpuDeviceCreateComputePipeline() failed") \
     _SG_LOGITEM_XMACRO(WGPU_ATTACHMENTS_CREATE_TEXTURE_VIEW_FAILED, "wgpuTextureCreateView() failed in create attachments") \
+    _SG_LOGITEM_XMACRO(WGPU_CREATE_READBACK_BUFFER_FAILED, "wgpuDeviceCreateBuffer() failed for readback") \
+    _SG_LOGITEM_XMACRO(WGPU_MAP_READBACK_BUFFER_FAILED, "wgpuBufferMapAsync() failed for readback") \
+    _SG_LOGITEM_XMACRO(WGPU_GENERATE_MIPMAPS_3D_IMAGE, "sg_generate_mipmaps: 3D images are not supported in the WebGPU backend") \
     _SG_LOGITEM_XMACRO(IDENTICAL_COMMIT_LISTENER, "attempting to add identical commit listener") \
     _SG_LOGITEM_XMACRO(COMMIT_LISTENER_ARRAY_FULL, "commit listener array full") \
     _SG_LOGITEM_XMACRO(TRACE_HOOKS_NOT_ENABLED, "sg_install_trace_hooks() called, but SOKOL_TRACE_HOOKS is not defined") \
+    _SG_LOGITEM_XMACRO(GPU_TIMINGS_NOT_SUPPORTED, "sg_desc.gpu_timings is true, but GPU timer queries are not supported by the backend (see sg_features.gpu_timings)") \
     _SG_LOGITEM_XMACRO(DEALLOC_BUFFER_INVALID_STATE, "sg_dealloc_buffer(): buffer must be in ALLOC state") \
     _SG_LOGITEM_XMACRO(DEALLOC_IMAGE_INVALID_STATE, "sg_dealloc_image(): image must be in alloc state") \
     _SG_LOGITEM_XMACRO(DEALLOC_SAMPLER_INVALID_STATE, "sg_dealloc_sampler(): sampler must be in alloc state") \
@@ -4216,9 +5070,14 @@ typedef struct sg_frame_stats {
     _SG_LOGITEM_XMACRO(SHADER_POOL_EXHAUSTED, "shader pool exhausted") \
     _SG_LOGITEM_XMACRO(PIPELINE_POOL_EXHAUSTED, "pipeline pool exhausted") \
     _SG_LOGITEM_XMACRO(PASS_POOL_EXHAUSTED, "pass pool exhausted") \
+    _SG_LOGITEM_XMACRO(BINDGROUP_POOL_EXHAUSTED, "bindgroup pool exhausted (increase sg_desc.bindgroup_pool_size)") \
+    _SG_LOGITEM_XMACRO(COMMAND_LIST_POOL_EXHAUSTED, "command list pool exhausted (increase sg_desc.command_list_pool_size)") \
+    _SG_LOGITEM_XMACRO(COMMAND_LIST_OVERFLOW, "command list buffer full (increase sg_command_list_desc.buffer_size)") \
+    _SG_LOGITEM_XMACRO(READBACK_POOL_EXHAUSTED, "readback pool exhausted (increase sg_desc.readback_pool_size)") \
     _SG_LOGITEM_XMACRO(BEGINPASS_ATTACHMENT_INVALID, "sg_begin_pass: an attachment was provided that no longer exists") \
     _SG_LOGITEM_XMACRO(APPLY_BINDINGS_STORAGE_BUFFER_TRACKER_EXHAUSTED, "sg_apply_bindings: too many read/write storage buffers in pass (bump sg_desc.max_dispatch_calls_per_pass") \
     _SG_LOGITEM_XMACRO(DRAW_WITHOUT_BINDINGS, "attempting to draw without resource bindings") \
+    _SG_LOGITEM_XMACRO(MEMORY_BUDGET_EXCEEDED, "estimated GPU memory of buffers and images exceeds sg_desc.memory_budget.num_bytes (see sg_query_memory_stats())") \
     _SG_LOGITEM_XMACRO(VALIDATE_BUFFERDESC_CANARY, "sg_buffer_desc not initialized") \
     _SG_LOGITEM_XMACRO(VALIDATE_BUFFERDESC_IMMUTABLE_DYNAMIC_STREAM, "sg_buffer_desc.usage: only one of .immutable, .dynamic_update, .stream_update can be true") \
     _SG_LOGITEM_XMACRO(VALIDATE_BUFFERDESC_SEPARATE_BUFFER_TYPES, "sg_buffer_desc.usage: on WebGL2, only one of .vertex_buffer or .index_buffer can be true (check sg_features.separate_buffer_types)") \
@@ -4229,6 +5088,10 @@ typedef struct sg_frame_stats {
     _SG_LOGITEM_XMACRO(VALIDATE_BUFFERDESC_EXPECT_DATA, "sg_buffer_desc: initial content data must be provided for immutable buffers without storage buffer usage") \
     _SG_LOGITEM_XMACRO(VALIDATE_BUFFERDESC_STORAGEBUFFER_SUPPORTED, "storage buffers not supported by the backend 3D API (requires OpenGL >= 4.3)") \
     _SG_LOGITEM_XMACRO(VALIDATE_BUFFERDESC_STORAGEBUFFER_SIZE_MULTIPLE_4, "size of storage buffers must be a multiple of 4") \
+    _SG_LOGITEM_XMACRO(VALIDATE_BUFFERDESC_INDIRECTBUFFER_SUPPORTED, "indirect buffers not supported by the backend 3D API (requires OpenGL >= 4.3)") \
+    _SG_LOGITEM_XMACRO(VALIDATE_BUFFERDESC_INDIRECTBUFFER_SIZE_MULTIPLE_4, "size of indirect buffers must be a multiple of 4") \
+    _SG_LOGITEM_XMACRO(VALIDATE_BUFFERDESC_NUM_UPDATE_SLOTS, "sg_buffer_desc.num_update_slots must be between 1 and SG_MAX_UPDATE_SLOTS") \
+    _SG_LOGITEM_XMACRO(VALIDATE_BUFFERDESC_INJECTED_NUM_UPDATE_SLOTS, "buffers with injected backend objects cannot have more than SG_NUM_INFLIGHT_FRAMES update slots") \
     _SG_LOGITEM_XMACRO(VALIDATE_IMAGEDATA_NODATA, "sg_image_data: no data (.ptr and/or .size is zero)") \
     _SG_LOGITEM_XMACRO(VALIDATE_IMAGEDATA_DATA_SIZE, "sg_image_data: data size doesn't match expected surface size") \
     _SG_LOGITEM_XMACRO(VALIDATE_IMAGEDESC_CANARY, "sg_image_desc not initialized") \
@@ -4252,6 +5115,12 @@ typedef struct sg_frame_stats {
     _SG_LOGITEM_XMACRO(VALIDATE_IMAGEDESC_INJECTED_NO_DATA, "images with injected textures cannot be initialized with data") \
     _SG_LOGITEM_XMACRO(VALIDATE_IMAGEDESC_DYNAMIC_NO_DATA, "dynamic/stream-update images cannot be initialized with data") \
     _SG_LOGITEM_XMACRO(VALIDATE_IMAGEDESC_COMPRESSED_IMMUTABLE, "compressed images must be immutable") \
+    _SG_LOGITEM_XMACRO(VALIDATE_IMAGEDESC_GENMIPMAPS_PIXELFORMAT, "sg_image_desc.generate_mipmaps requires a filterable and renderable pixel format (no depth-stencil or compressed formats)") \
+    _SG_LOGITEM_XMACRO(VALIDATE_IMAGEDESC_GENMIPMAPS_MSAA, "sg_image_desc.generate_mipmaps: multisampled images cannot have generated mipmaps") \
+    _SG_LOGITEM_XMACRO(VALIDATE_IMAGEDESC_GENMIPMAPS_INJECTED, "sg_image_desc.generate_mipmaps: not supported for images with injected textures") \
+    _SG_LOGITEM_XMACRO(VALIDATE_IMAGEDESC_GENMIPMAPS_MIPDATA, "sg_image_desc.generate_mipmaps: only mip level 0 can be initialized with data") \
+    _SG_LOGITEM_XMACRO(VALIDATE_IMAGEDESC_NUM_UPDATE_SLOTS, "sg_image_desc.num_update_slots must be between 1 and SG_MAX_UPDATE_SLOTS") \
+    _SG_LOGITEM_XMACRO(VALIDATE_IMAGEDESC_INJECTED_NUM_UPDATE_SLOTS, "images with injected backend objects cannot have more than SG_NUM_INFLIGHT_FRAMES update slots") \
     _SG_LOGITEM_XMACRO(VALIDATE_SAMPLERDESC_CANARY, "sg_sampler_desc not initialized") \
     _SG_LOGITEM_XMACRO(VALIDATE_SAMPLERDESC_ANISTROPIC_REQUIRES_LINEAR_FILTERING, "sg_sampler_desc.max_anisotropy > 1 requires min/mag/mipmap_filter to be SG_FILTER_LINEAR") \
     _SG_LOGITEM_XMACRO(VALIDATE_SHADERDESC_CANARY, "sg_shader_desc not initialized") \
@@ -4367,6 +5236,32 @@ typedef struct sg_frame_stats {
     _SG_LOGITEM_XMACRO(VALIDATE_ATTACHMENTSDESC_STORAGE_IMAGE_NO_STORAGEATTACHMENT, "storage attachment images must be sg_image_desc.usage.storage_attachment=true") \
     _SG_LOGITEM_XMACRO(VALIDATE_ATTACHMENTSDESC_STORAGE_INV_PIXELFORMAT, "storage attachment pixel format must have .compute_readwrite or .compute_writeonly capabilities") \
     _SG_LOGITEM_XMACRO(VALIDATE_ATTACHMENTSDESC_RENDER_VS_STORAGE_ATTACHMENTS, "cannot use color/depth and storage attachment images on the same sg_attachments object") \
+    _SG_LOGITEM_XMACRO(VALIDATE_BGDESC_CANARY, "sg_bindgroup_desc not initialized") \
+    _SG_LOGITEM_XMACRO(VALIDATE_BGDESC_PIPELINE, "sg_bindgroup_desc.pipeline must be a valid pipeline handle") \
+    _SG_LOGITEM_XMACRO(VALIDATE_BGDESC_PIPELINE_ALIVE, "sg_bindgroup_desc.pipeline object no longer alive") \
+    _SG_LOGITEM_XMACRO(VALIDATE_BGDESC_PIPELINE_VALID, "sg_bindgroup_desc.pipeline object not in valid state") \
+    _SG_LOGITEM_XMACRO(VALIDATE_BGDESC_PIPELINE_SHADER_ALIVE, "sg_bindgroup_desc.pipeline: shader object no longer alive") \
+    _SG_LOGITEM_XMACRO(VALIDATE_BGDESC_PIPELINE_SHADER_VALID, "sg_bindgroup_desc.pipeline: shader object not in valid state") \
+    _SG_LOGITEM_XMACRO(VALIDATE_BGDESC_EMPTY_BINDINGS, "sg_bindgroup_desc.bindings is empty") \
+    _SG_LOGITEM_XMACRO(VALIDATE_BGDESC_BINDINGS, "sg_bindgroup_desc.bindings don't match pipeline (see previous sg_apply_bindings validation errors)") \
+    _SG_LOGITEM_XMACRO(VALIDATE_CLDESC_CANARY, "sg_command_list_desc not initialized") \
+    _SG_LOGITEM_XMACRO(VALIDATE_BEGINCL_CMDLIST_EXISTS, "sg_begin_command_list: command list object no longer alive") \
+    _SG_LOGITEM_XMACRO(VALIDATE_BEGINCL_CMDLIST_VALID, "sg_begin_command_list: command list object not in valid state") \
+    _SG_LOGITEM_XMACRO(VALIDATE_BEGINCL_ALREADY_RECORDING, "sg_begin_command_list: a command list is already being recorded on this thread") \
+    _SG_LOGITEM_XMACRO(VALIDATE_BEGINCL_CMDLIST_BUSY, "sg_begin_command_list: command list is already being recorded on another thread") \
+    _SG_LOGITEM_XMACRO(VALIDATE_ENDCL_NOT_RECORDING, "sg_end_command_list: no command list is being recorded on this thread") \
+    _SG_LOGITEM_XMACRO(VALIDATE_RECCL_NO_PIPELINE, "command list recording: sg_apply_pipeline() must be recorded first") \
+    _SG_LOGITEM_XMACRO(VALIDATE_RECCL_PIPELINE_ALIVE, "command list recording: recorded pipeline object no longer alive") \
+    _SG_LOGITEM_XMACRO(VALIDATE_RECCL_MIXED_PIPELINES, "command list recording: cannot mix render and compute pipelines in the same command list") \
+    _SG_LOGITEM_XMACRO(VALIDATE_RECCL_RENDER_PIPELINE_EXPECTED, "command list recording: sg_draw(), sg_apply_viewport() and sg_apply_scissor_rect() require a render pipeline") \
+    _SG_LOGITEM_XMACRO(VALIDATE_RECCL_COMPUTE_PIPELINE_EXPECTED, "command list recording: sg_dispatch() requires a compute pipeline") \
+    _SG_LOGITEM_XMACRO(VALIDATE_EXECCL_PASS_EXPECTED, "sg_execute_command_list: must be called in a pass") \
+    _SG_LOGITEM_XMACRO(VALIDATE_EXECCL_CMDLIST_EXISTS, "sg_execute_command_list: command list object no longer alive") \
+    _SG_LOGITEM_XMACRO(VALIDATE_EXECCL_CMDLIST_VALID, "sg_execute_command_list: command list object not in valid state") \
+    _SG_LOGITEM_XMACRO(VALIDATE_EXECCL_RECORDING, "sg_execute_command_list: command list is still being recorded (missing sg_end_command_list()?)") \
+    _SG_LOGITEM_XMACRO(VALIDATE_EXECCL_OVERFLOW, "sg_execute_command_list: command list has overflown during recording") \
+    _SG_LOGITEM_XMACRO(VALIDATE_EXECCL_RENDERPASS_EXPECTED, "sg_execute_command_list: command list with render pipelines must be executed in a render pass") \
+    _SG_LOGITEM_XMACRO(VALIDATE_EXECCL_COMPUTEPASS_EXPECTED, "sg_execute_command_list: command list with compute pipelines must be executed in a compute pass") \
     _SG_LOGITEM_XMACRO(VALIDATE_BEGINPASS_CANARY, "sg_begin_pass: pass struct not initialized") \
     _SG_LOGITEM_XMACRO(VALIDATE_BEGINPASS_ATTACHMENTS_EXISTS, "sg_begin_pass: attachments object no longer alive") \
     _SG_LOGITEM_XMACRO(VALIDATE_BEGINPASS_ATTACHMENTS_VALID, "sg_begin_pass: attachments object not in resource state VALID") \
@@ -4472,6 +5367,18 @@ typedef struct sg_frame_stats {
     _SG_LOGITEM_XMACRO(VALIDATE_ABND_IMAGE_BINDING_VS_COLOR_ATTACHMENT, "sg_apply_bindings: cannot bind image in the same pass it is used as color attachment") \
     _SG_LOGITEM_XMACRO(VALIDATE_ABND_IMAGE_BINDING_VS_RESOLVE_ATTACHMENT, "sg_apply_bindings: cannot bind image in the same pass it is used as resolve attachment") \
     _SG_LOGITEM_XMACRO(VALIDATE_ABND_IMAGE_BINDING_VS_STORAGE_ATTACHMENT, "sg_apply_bindings: cannot bind image in the same pass it is used as storage attachment") \
+    _SG_LOGITEM_XMACRO(VALIDATE_ABG_PASS_EXPECTED, "sg_apply_bindgroup: must be called in a pass") \
+    _SG_LOGITEM_XMACRO(VALIDATE_ABG_BINDGROUP_EXISTS, "sg_apply_bindgroup: bindgroup object no longer alive") \
+    _SG_LOGITEM_XMACRO(VALIDATE_ABG_BINDGROUP_VALID, "sg_apply_bindgroup: bindgroup object not in valid state") \
+    _SG_LOGITEM_XMACRO(VALIDATE_ABG_NO_PIPELINE, "sg_apply_bindgroup: must be called after sg_apply_pipeline") \
+    _SG_LOGITEM_XMACRO(VALIDATE_ABG_PIPELINE_ALIVE, "sg_apply_bindgroup: currently applied pipeline object no longer alive") \
+    _SG_LOGITEM_XMACRO(VALIDATE_ABG_PIPELINE_VALID, "sg_apply_bindgroup: currently applied pipeline object not in valid state") \
+    _SG_LOGITEM_XMACRO(VALIDATE_ABG_SHADER_MISMATCH, "sg_apply_bindgroup: currently applied pipeline doesn't use the same shader as the bindgroup's pipeline") \
+    _SG_LOGITEM_XMACRO(VALIDATE_ABG_EXPECTED_VB, "sg_apply_bindgroup: currently applied pipeline expects a vertex buffer binding which is missing in bindgroup") \
+    _SG_LOGITEM_XMACRO(VALIDATE_ABG_NO_IB, "sg_apply_bindgroup: currently applied pipeline defines indexed rendering, but bindgroup has no index buffer") \
+    _SG_LOGITEM_XMACRO(VALIDATE_ABG_IB, "sg_apply_bindgroup: currently applied pipeline defines non-indexed rendering, but bindgroup has an index buffer") \
+    _SG_LOGITEM_XMACRO(VALIDATE_ABG_RESOURCE_ALIVE, "sg_apply_bindgroup: a resource referenced by the bindgroup is no longer alive") \
+    _SG_LOGITEM_XMACRO(VALIDATE_ABG_BUFFER_OVERFLOW, "sg_apply_bindgroup: a vertex- or index-buffer referenced by the bindgroup is overflown") \
     _SG_LOGITEM_XMACRO(VALIDATE_AU_PASS_EXPECTED, "sg_apply_uniforms: must be called in a pass") \
     _SG_LOGITEM_XMACRO(VALIDATE_AU_NO_PIPELINE, "sg_apply_uniforms: must be called after sg_apply_pipeline()") \
     _SG_LOGITEM_XMACRO(VALIDATE_AU_PIPELINE_ALIVE, "sg_apply_uniforms: currently applied pipeline object no longer alive") \
@@ -4485,6 +5392,13 @@ typedef struct sg_frame_stats {
     _SG_LOGITEM_XMACRO(VALIDATE_DRAW_NUMELEMENTS, "sg_draw: num_elements cannot be < 0") \
     _SG_LOGITEM_XMACRO(VALIDATE_DRAW_NUMINSTANCES, "sg_draw: num_instances cannot be < 0") \
     _SG_LOGITEM_XMACRO(VALIDATE_DRAW_REQUIRED_BINDINGS_OR_UNIFORMS_MISSING, "sg_draw: call to sg_apply_bindings() and/or sg_apply_uniforms() missing after sg_apply_pipeline()") \
+    _SG_LOGITEM_XMACRO(VALIDATE_DRAWINDIRECT_RENDERPASS_EXPECTED, "sg_draw_indirect: must be called in a render pass") \
+    _SG_LOGITEM_XMACRO(VALIDATE_DRAWINDIRECT_SUPPORTED, "sg_draw_indirect: indirect draws not supported by the backend 3D API (requires OpenGL >= 4.3)") \
+    _SG_LOGITEM_XMACRO(VALIDATE_DRAWINDIRECT_BUFFER_ALIVE, "sg_draw_indirect: indirect buffer no longer alive") \
+    _SG_LOGITEM_XMACRO(VALIDATE_DRAWINDIRECT_BUFFER_TYPE, "sg_draw_indirect: buffer doesn't have indirect buffer usage (sg_buffer_desc.usage.indirect_buffer)") \
+    _SG_LOGITEM_XMACRO(VALIDATE_DRAWINDIRECT_OFFSET, "sg_draw_indirect: offset must be >= 0 and a multiple of 4") \
+    _SG_LOGITEM_XMACRO(VALIDATE_DRAWINDIRECT_SIZE, "sg_draw_indirect: offset plus size of draw arguments is bigger than buffer size") \
+    _SG_LOGITEM_XMACRO(VALIDATE_DRAWINDIRECT_REQUIRED_BINDINGS_OR_UNIFORMS_MISSING, "sg_draw_indirect: call to sg_apply_bindings() and/or sg_apply_uniforms() missing after sg_apply_pipeline()") \
     _SG_LOGITEM_XMACRO(VALIDATE_DISPATCH_COMPUTEPASS_EXPECTED, "sg_dispatch: must be called in a compute pass") \
     _SG_LOGITEM_XMACRO(VALIDATE_DISPATCH_NUMGROUPSX, "sg_dispatch: num_groups_x must be >=0 and <65536") \
     _SG_LOGITEM_XMACRO(VALIDATE_DISPATCH_NUMGROUPSY, "sg_dispatch: num_groups_y must be >=0 and <65536") \
@@ -4499,6 +5413,35 @@ typedef struct sg_frame_stats {
     _SG_LOGITEM_XMACRO(VALIDATE_APPENDBUF_UPDATE, "sg_append_buffer: cannot call sg_append_buffer and sg_update_buffer in same frame") \
     _SG_LOGITEM_XMACRO(VALIDATE_UPDIMG_USAGE, "sg_update_image: cannot update immutable image") \
     _SG_LOGITEM_XMACRO(VALIDATE_UPDIMG_ONCE, "sg_update_image: only one update allowed per image and frame") \
+    _SG_LOGITEM_XMACRO(VALIDATE_UPDIMG_GENMIPMAPS_MIPDATA, "sg_update_image: images with generate_mipmaps can only be updated with data for mip level 0") \
+    _SG_LOGITEM_XMACRO(VALIDATE_UPDBUFRANGE_USAGE, "sg_update_buffer_range: buffer must have been created with usage.dynamic_update") \
+    _SG_LOGITEM_XMACRO(VALIDATE_UPDBUFRANGE_ALIGNMENT, "sg_update_buffer_range: offset and size must be a multiple of 4") \
+    _SG_LOGITEM_XMACRO(VALIDATE_UPDBUFRANGE_SIZE, "sg_update_buffer_range: offset + size is outside the buffer") \
+    _SG_LOGITEM_XMACRO(VALIDATE_UPDBUFRANGE_APPEND, "sg_update_buffer_range: cannot call sg_update_buffer_range and sg_append_buffer in same frame") \
+    _SG_LOGITEM_XMACRO(VALIDATE_UPDBUFRANGE_BOUND, "sg_update_buffer_range: buffer has already been bound in this frame (partial updates must happen before the buffer is used)") \
+    _SG_LOGITEM_XMACRO(VALIDATE_UPDIMGREGION_USAGE, "sg_update_image_region: image must have been created with usage.dynamic_update") \
+    _SG_LOGITEM_XMACRO(VALIDATE_UPDIMGREGION_COMPRESSED, "sg_update_image_region: compressed pixel formats are not supported") \
+    _SG_LOGITEM_XMACRO(VALIDATE_UPDIMGREGION_MIPLEVEL, "sg_update_image_region: region.mip_level is out of range") \
+    _SG_LOGITEM_XMACRO(VALIDATE_UPDIMGREGION_SLICE, "sg_update_image_region: region.slice is out of range") \
+    _SG_LOGITEM_XMACRO(VALIDATE_UPDIMGREGION_RECT, "sg_update_image_region: region rectangle is empty or outside the mipmap level") \
+    _SG_LOGITEM_XMACRO(VALIDATE_UPDIMGREGION_DATA, "sg_update_image_region: data size doesn't match region size (must be tightly packed)") \
+    _SG_LOGITEM_XMACRO(VALIDATE_UPDIMGREGION_BOUND, "sg_update_image_region: image has already been bound in this frame (partial updates must happen before the image is used)") \
+    _SG_LOGITEM_XMACRO(VALIDATE_GENMIPMAPS_FLAG, "sg_generate_mipmaps: image must have been created with sg_image_desc.generate_mipmaps") \
+    _SG_LOGITEM_XMACRO(VALIDATE_IMGRBDESC_CANARY, "sg_image_readback_desc not initialized") \
+    _SG_LOGITEM_XMACRO(VALIDATE_IMGRB_IN_PASS, "sg_read_image_async: cannot be called inside a pass") \
+    _SG_LOGITEM_XMACRO(VALIDATE_IMGRB_IMAGE, "sg_read_image_async: image object no longer alive or not in valid state") \
+    _SG_LOGITEM_XMACRO(VALIDATE_IMGRB_SAMPLECOUNT, "sg_read_image_async: MSAA images cannot be read back") \
+    _SG_LOGITEM_XMACRO(VALIDATE_IMGRB_PIXELFORMAT, "sg_read_image_async: depth-stencil and compressed pixel formats cannot be read back") \
+    _SG_LOGITEM_XMACRO(VALIDATE_IMGRB_MIPLEVEL, "sg_read_image_async: region.mip_level is out of range") \
+    _SG_LOGITEM_XMACRO(VALIDATE_IMGRB_SLICE, "sg_read_image_async: region.slice is out of range") \
+    _SG_LOGITEM_XMACRO(VALIDATE_IMGRB_RECT, "sg_read_image_async: region rectangle is outside the mipmap level") \
+    _SG_LOGITEM_XMACRO(VALIDATE_IMGRB_DATA, "sg_read_image_async: destination memory missing or too small") \
+    _SG_LOGITEM_XMACRO(VALIDATE_BUFRBDESC_CANARY, "sg_buffer_readback_desc not initialized") \
+    _SG_LOGITEM_XMACRO(VALIDATE_BUFRB_IN_PASS, "sg_read_buffer_async: cannot be called inside a pass") \
+    _SG_LOGITEM_XMACRO(VALIDATE_BUFRB_BUFFER, "sg_read_buffer_async: buffer object no longer alive or not in valid state") \
+    _SG_LOGITEM_XMACRO(VALIDATE_BUFRB_ALIGNMENT, "sg_read_buffer_async: offset and size must be a multiple of 4") \
+    _SG_LOGITEM_XMACRO(VALIDATE_BUFRB_SIZE, "sg_read_buffer_async: offset + size is outside the buffer") \
+    _SG_LOGITEM_XMACRO(VALIDATE_BUFRB_DATA, "sg_read_buffer_async: destination memory missing or too small") \
     _SG_LOGITEM_XMACRO(VALIDATION_FAILED, "validation layer checks failed") \
 
 #define _SG_LOGITEM_XMACRO(item,msg) SG_LOGITEM_##item,
@@ -4521,13 +5464,27 @@ typedef enum sg_log_item {
     .shader_pool_size               32
     .pipeline_pool_size             64
     .attachments_pool_size          16
+    .bindgroup_pool_size            256
+    .command_list_pool_size         16
+    .readback_pool_size             16
+    .growable_pools                 false
+    .dedup_pipelines                false
+    .dedup_samplers                 false
+    .deferred_destroy               false
+    .dedup_uniforms                 false
+    .gpu_timings                    false
+    .update_mode                    SG_UPDATEMODE_MULTIBUFFER
+    .num_update_slots               SG_NUM_INFLIGHT_FRAMES (2)
     .uniform_buffer_size            4 MB (4*1024*1024)
     .max_dispatch_calls_per_pass    1024
     .max_commit_listeners           1024
     .disable_validation             false
+    .gl_vao_cache_size              0 (disabled)
+    .gl_texture_upload_buffer_size  0 (disabled)
     .mtl_force_managed_storage_mode false
     .wgpu_disable_bindgroups_cache  false
     .wgpu_bindgroups_cache_size     1024
+    .memory_budget.num_bytes        0 (disabled)
 
     .allocator.alloc_fn     0 (in this case, malloc() will be called)
     .allocator.free_fn      0 (in this case, free() will be called)
@@ -4540,6 +5497,142 @@ typedef enum sg_log_item {
     .environment.defaults.depth_format: SG_PIXELFORMAT_DEPTH_STENCIL
     .environment.defaults.sample_count: 1
 
+    Resource pools:
+        .growable_pools
+            By default, the resource pools are allocated once in sg_setup()
+            with the sizes provided in the *_pool_size items, and creating
+            a resource object fails with a POOL_EXHAUSTED log message when
+            its pool is full. When .growable_pools is true, an exhausted pool
+            instead grows by its initial size (up to a maximum of 65535
+            resource objects per pool). Growing a pool doesn't invalidate
+            existing resource handles, but the initial pool sizes should
+            still be picked so that growing the pools is a rare event (call
+            sg_query_pool_stats() to inspect the pool high-water-marks).
+        .dedup_pipelines
+        .dedup_samplers
+            When true, sg_make_pipeline() or sg_make_sampler() first look
+            for an existing object created from an identical desc struct
+            (after default values have been patched in, ignoring the .label
+            item) and return its handle instead of creating a new object.
+            Deduplicated objects are reference counted, each call to
+            sg_make_pipeline() or sg_make_sampler() must be balanced with a
+            call to sg_destroy_pipeline() or sg_destroy_sampler(), and the
+            object is only destroyed when the last reference is dropped
+            (calling sg_uninit_pipeline() or sg_uninit_sampler() on a
+            deduplicated object ignores the reference count though). This
+            allows libraries like sokol_gl.h and sokol_debugtext.h to share
+            identical pipeline and sampler objects. Samplers with injected
+            backend objects are never deduplicated, and the separate
+            alloc/init functions bypass the cache.
+
+    Resource destruction:
+        .deferred_destroy
+            By default, the sg_destroy_*() and sg_uninit_*() functions
+            immediately release the backend objects owned by a resource
+            (e.g. with glDeleteBuffers() in the GL backend), which may cause
+            stalls when the GPU is still using the resource, and invalidates
+            the backend's state cache in the middle of a frame. When
+            .deferred_destroy is true, the resource handle becomes invalid
+            immediately, but the backend objects are put into a queue and
+            released together in sg_commit() SG_NUM_INFLIGHT_FRAMES frames
+            later. This helps to smooth frame times when destroying many
+            resources at once (e.g. when unloading a level). Bindgroups,
+            command lists and readbacks don't own backend objects and are
+            not affected.
+
+    Uniform data:
+        .dedup_uniforms
+            When true, sokol_gfx.h keeps a copy and a hash of the uniform
+            data last applied to each uniform block slot, and
+            sg_apply_uniforms() skips the backend upload when the size, hash
+            and content of the new data match (the hash only serves as a
+            quick pre-check before comparing the bytes). The cache is reset
+            by sg_begin_pass(), sg_apply_pipeline() and
+            sg_reset_state_cache(), so only redundant calls between two
+            pipeline changes are skipped (e.g. a camera or material block
+            which is re-applied for each draw call). This trades the cost of
+            hashing and comparing the uniform data against the cost of the
+            backend upload
+            (and uniform buffer space in the Metal, D3D11 and WebGPU
+            backends). Check the .num_apply_uniforms_skipped item returned
+            by sg_query_frame_stats() to see whether it pays off.
+
+    Dynamic resource updates:
+        .update_mode
+        .num_update_slots
+            The defaults for the same-named sg_buffer_desc and sg_image_desc
+            items of dynamic- and stream-update resources (immutable
+            resources always have a single backend object). With the
+            default SG_UPDATEMODE_MULTIBUFFER, the GL and Metal backends
+            create .num_update_slots copies of each backend object and
+            rotate through them on each sg_update_*() call. Two copies match
+            the number of frames in flight (SG_NUM_INFLIGHT_FRAMES), a third
+            copy can avoid stalls when the GPU runs behind, and a single
+            copy leaves the synchronization to the GL driver (which may then
+            stall in glBufferSubData()). With SG_UPDATEMODE_ORPHAN the GL
+            backend only creates a single buffer and calls glBufferData()
+            with a null pointer before each full update (and before the
+            first sg_append_buffer() call in a frame), which allows the
+            driver to allocate fresh storage while the GPU is still reading
+            from the old one. This halves the memory footprint of big
+            streamed buffers without introducing stalls, the number of
+            orphaning calls is counted in the .gl.num_buffer_orphans item
+            returned by sg_query_frame_stats().
+            Backend-specific notes:
+                - GL textures are created with immutable storage and can't
+                  be orphaned, SG_UPDATEMODE_ORPHAN images use a single
+                  texture which is updated with glTexSubImage*() (combine
+                  this with .gl_texture_upload_buffer_size to keep the
+                  upload asynchronous)
+                - the Metal backend writes directly into its buffers and
+                  textures and always uses at least SG_NUM_INFLIGHT_FRAMES
+                  copies, SG_UPDATEMODE_ORPHAN behaves like the default
+                - D3D11 and WebGPU use a single backend object and let the
+                  driver handle renaming (D3D11_MAP_WRITE_DISCARD is the
+                  D3D11 equivalent of orphaning), the update mode is ignored
+
+    GPU timings:
+        .gpu_timings
+            When true, sokol_gfx.h measures the GPU execution time of each
+            render pass and debug group with timestamp queries, and the
+            results can be obtained a few frames later with
+            sg_query_gpu_timings(). The queries are ring-buffered over
+            several frames and results which aren't available yet are never
+            waited for, so that measuring doesn't stall the CPU. This is
+            currently only implemented in the GLCORE backend (GL 3.3 or
+            later), check sg_features.gpu_timings at runtime.
+
+    GL specific:
+        .gl_vao_cache_size
+            When this is > 0, the GL backend keeps a cache of up to this many
+            vertex array objects, keyed by the pipeline object, the vertex
+            buffers, vertex buffer offsets and the index buffer passed into
+            sg_apply_bindings(). On a cache hit, sg_apply_bindings() only
+            needs a single glBindVertexArray() call instead of updating
+            the vertex attribute state of a single shared VAO. When the cache
+            is full, the least recently used VAO is discarded. Check the
+            .gl.num_vao_cache_hits and .gl.num_vao_cache_misses items returned
+            by sg_query_frame_stats() to tune the cache size (a good starting
+            point is the number of different meshes rendered per frame).
+            Please note that the cache is keyed by the GL buffer names, so
+            that streaming buffers which are updated each frame will cycle
+            through multiple cache entries. The cache is disabled by default.
+        .gl_texture_upload_buffer_size
+            When this is > 0, the GL backend creates a ring of pixel-unpack
+            buffers of this size (in bytes, one per frame-in-flight plus one),
+            and sg_update_image() and sg_update_image_region() copy the pixel
+            data into the current frame's buffer instead of handing a client
+            memory pointer to glTexSubImage*(). This allows the GL driver to
+            perform the actual texture upload asynchronously instead of
+            stalling the render thread, which helps with video playback or
+            streamed texture pages. The buffer size should be big enough to
+            hold all image updates of a single frame, updates which don't fit
+            fall back to the regular (synchronous) upload path. Check the
+            .gl.num_pbo_uploads, .gl.num_pbo_upload_fallbacks and
+            .gl.num_pbo_fence_waits items returned by sg_query_frame_stats()
+            to tune the buffer size. Not supported on WebGL2, where this
+            item is ignored.
+
     Metal specific:
         (NOTE: All Objective-C object references are transferred through
         a bridged cast (__bridge const void*) to sokol_gfx, which will use an
@@ -4651,6 +5744,19 @@ typedef struct sg_allocator {
     void* user_data;
 } sg_allocator;
 
+/*
+    sg_memory_budget
+
+    Used in sg_desc to provide an optional GPU memory budget for buffer and
+    image objects, and a callback which is called when the budget is
+    exceeded. See the sg_memory_stats documentation for details.
+*/
+typedef struct sg_memory_budget {
+    uint64_t num_bytes;     // 0 disables the budget check
+    void (*exceeded_cb)(const sg_memory_stats* stats, void* user_data);
+    void* user_data;
+} sg_memory_budget;
+
 /*
     sg_logger
 
@@ -4682,15 +5788,29 @@ typedef struct sg_desc {
     int shader_pool_size;
     int pipeline_pool_size;
     int attachments_pool_size;
+    int bindgroup_pool_size;
+    int command_list_pool_size;
+    int readback_pool_size;
+    bool growable_pools;        // if true, exhausted resource pools grow instead of failing (default: false)
+    bool dedup_pipelines;       // if true, sg_make_pipeline() returns existing pipelines for identical descs (default: false)
+    bool dedup_samplers;        // if true, sg_make_sampler() returns existing samplers for identical descs (default: false)
+    bool deferred_destroy;      // if true, backend objects of destroyed resources are released SG_NUM_INFLIGHT_FRAMES frames later (default: false)
+    bool dedup_uniforms;        // if true, sg_apply_uniforms() skips uploading data identical to the last data applied to the same slot (default: false)
+    bool gpu_timings;           // if true, measure the GPU time of passes and debug groups, see sg_query_gpu_timings() (default: false)
+    sg_update_mode update_mode; // default update mode of dynamic- and stream-update resources (default: SG_UPDATEMODE_MULTIBUFFER)
+    int num_update_slots;       // default number of multi-buffered copies, 1..SG_MAX_UPDATE_SLOTS (default: SG_NUM_INFLIGHT_FRAMES)
     int uniform_buffer_size;
     int max_dispatch_calls_per_pass;    // max expected number of dispatch calls per pass (default: 1024)
     int max_commit_listeners;
     bool disable_validation;    // disable validation layer even in debug mode, useful for tests
+    int gl_vao_cache_size;      // GL: number of cached vertex array objects (default: 0, disabled)
+    int gl_texture_upload_buffer_size;  // GL: size of pixel-unpack-buffers for async texture updates (default: 0, disabled)
     bool d3d11_shader_debugging;    // if true, HLSL shaders are compiled with D3DCOMPILE_DEBUG | D3DCOMPILE_SKIP_OPTIMIZATION
     bool mtl_force_managed_storage_mode; // for debugging: use Metal managed storage mode for resources even with UMA
     bool mtl_use_command_buffer_with_retained_references;    // Metal: use a managed MTLCommandBuffer which ref-counts used resources
     bool wgpu_disable_bindgroups_cache;  // set to true to disable the WebGPU backend BindGroup cache
     int wgpu_bindgroups_cache_size;      // number of slots in the WebGPU bindgroup cache (must be 2^N)
+    sg_memory_budget memory_budget;      // optional GPU memory budget, see sg_memory_stats (default: disabled)
     sg_allocator allocator;
     sg_logger logger; // optional log function override
     sg_environment environment;
@@ -4723,14 +5843,23 @@ SOKOL_GFX_API_DECL sg_sampler sg_make_sampler(const sg_sampler_desc* desc);
 SOKOL_GFX_API_DECL sg_shader sg_make_shader(const sg_shader_desc* desc);
 SOKOL_GFX_API_DECL sg_pipeline sg_make_pipeline(const sg_pipeline_desc* desc);
 SOKOL_GFX_API_DECL sg_attachments sg_make_attachments(const sg_attachments_desc* desc);
+SOKOL_GFX_API_DECL sg_bindgroup sg_make_bindgroup(const sg_bindgroup_desc* desc);
+SOKOL_GFX_API_DECL sg_command_list sg_make_command_list(const sg_command_list_desc* desc);
 SOKOL_GFX_API_DECL void sg_destroy_buffer(sg_buffer buf);
 SOKOL_GFX_API_DECL void sg_destroy_image(sg_image img);
 SOKOL_GFX_API_DECL void sg_destroy_sampler(sg_sampler smp);
 SOKOL_GFX_API_DECL void sg_destroy_shader(sg_shader shd);
 SOKOL_GFX_API_DECL void sg_destroy_pipeline(sg_pipeline pip);
 SOKOL_GFX_API_DECL void sg_destroy_attachments(sg_attachments atts);
+SOKOL_GFX_API_DECL void sg_destroy_bindgroup(sg_bindgroup bg);
+SOKOL_GFX_API_DECL void sg_destroy_command_list(sg_command_list cl);
 SOKOL_GFX_API_DECL void sg_update_buffer(sg_buffer buf, const sg_range* data);
 SOKOL_GFX_API_DECL void sg_update_image(sg_image img, const sg_image_data* data);
+SOKOL_GFX_API_DECL void sg_update_buffer_range(sg_buffer buf, int offset, const sg_range* data);
+SOKOL_GFX_API_DECL void sg_update_image_region(sg_image img, const sg_image_region* region, const sg_range* data);
+SOKOL_GFX_API_DECL void sg_generate_mipmaps(sg_image img);
+SOKOL_GFX_API_DECL sg_readback sg_read_image_async(const sg_image_readback_desc* desc);
+SOKOL_GFX_API_DECL sg_readback sg_read_buffer_async(const sg_buffer_readback_desc* desc);
 SOKOL_GFX_API_DECL int sg_append_buffer(sg_buffer buf, const sg_range* data);
 SOKOL_GFX_API_DECL bool sg_query_buffer_overflow(sg_buffer buf);
 SOKOL_GFX_API_DECL bool sg_query_buffer_will_overflow(sg_buffer buf, size_t size);
@@ -4743,12 +5872,19 @@ SOKOL_GFX_API_DECL void sg_apply_scissor_rect(int x, int y, int width, int heigh
 SOKOL_GFX_API_DECL void sg_apply_scissor_rectf(float x, float y, float width, float height, bool origin_top_left);
 SOKOL_GFX_API_DECL void sg_apply_pipeline(sg_pipeline pip);
 SOKOL_GFX_API_DECL void sg_apply_bindings(const sg_bindings* bindings);
+SOKOL_GFX_API_DECL void sg_apply_bindgroup(sg_bindgroup bg);
 SOKOL_GFX_API_DECL void sg_apply_uniforms(int ub_slot, const sg_range* data);
 SOKOL_GFX_API_DECL void sg_draw(int base_element, int num_elements, int num_instances);
+SOKOL_GFX_API_DECL void sg_draw_indirect(sg_buffer buf, int offset);
 SOKOL_GFX_API_DECL void sg_dispatch(int num_groups_x, int num_groups_y, int num_groups_z);
 SOKOL_GFX_API_DECL void sg_end_pass(void);
 SOKOL_GFX_API_DECL void sg_commit(void);
 
+// command list recording and execution
+SOKOL_GFX_API_DECL void sg_begin_command_list(sg_command_list cl);
+SOKOL_GFX_API_DECL void sg_end_command_list(void);
+SOKOL_GFX_API_DECL void sg_execute_command_list(sg_command_list cl);
+
 // getting information
 SOKOL_GFX_API_DECL sg_desc sg_query_desc(void);
 SOKOL_GFX_API_DECL sg_backend sg_query_backend(void);
@@ -4764,6 +5900,10 @@ SOKOL_GFX_API_DECL sg_resource_state sg_query_sampler_state(sg_sampler smp);
 SOKOL_GFX_API_DECL sg_resource_state sg_query_shader_state(sg_shader shd);
 SOKOL_GFX_API_DECL sg_resource_state sg_query_pipeline_state(sg_pipeline pip);
 SOKOL_GFX_API_DECL sg_resource_state sg_query_attachments_state(sg_attachments atts);
+SOKOL_GFX_API_DECL sg_resource_state sg_query_bindgroup_state(sg_bindgroup bg);
+SOKOL_GFX_API_DECL sg_resource_state sg_query_command_list_state(sg_command_list cl);
+// check if an asynchronous readback is still in flight
+SOKOL_GFX_API_DECL bool sg_query_readback_pending(sg_readback rb);
 // get runtime information about a resource
 SOKOL_GFX_API_DECL sg_buffer_info sg_query_buffer_info(sg_buffer buf);
 SOKOL_GFX_API_DECL sg_image_info sg_query_image_info(sg_image img);
@@ -4771,6 +5911,10 @@ SOKOL_GFX_API_DECL sg_sampler_info sg_query_sampler_info(sg_sampler smp);
 SOKOL_GFX_API_DECL sg_shader_info sg_query_shader_info(sg_shader shd);
 SOKOL_GFX_API_DECL sg_pipeline_info sg_query_pipeline_info(sg_pipeline pip);
 SOKOL_GFX_API_DECL sg_attachments_info sg_query_attachments_info(sg_attachments atts);
+// get size, usage and high-water-mark of the resource pools
+SOKOL_GFX_API_DECL sg_pool_stats sg_query_pool_stats(void);
+// get the estimated GPU memory used by buffers and images
+SOKOL_GFX_API_DECL sg_memory_stats sg_query_memory_stats(void);
 // get desc structs matching a specific resource (NOTE that not all creation attributes may be provided)
 SOKOL_GFX_API_DECL sg_buffer_desc sg_query_buffer_desc(sg_buffer buf);
 SOKOL_GFX_API_DECL sg_image_desc sg_query_image_desc(sg_image img);
@@ -4835,6 +5979,9 @@ SOKOL_GFX_API_DECL void sg_disable_frame_stats(void);
 SOKOL_GFX_API_DECL bool sg_frame_stats_enabled(void);
 SOKOL_GFX_API_DECL sg_frame_stats sg_query_frame_stats(void);
 
+// GPU timings
+SOKOL_GFX_API_DECL sg_gpu_timings sg_query_gpu_timings(void);
+
 /* Backend-specific structs and functions, these may come in handy for mixing
    sokol-gfx rendering with 'native backend' rendering functions.
 
@@ -4875,12 +6022,12 @@ typedef struct sg_d3d11_attachments_info {
 } sg_d3d11_attachments_info;
 
 typedef struct sg_mtl_buffer_info {
-    const void* buf[SG_NUM_INFLIGHT_FRAMES];  // id<MTLBuffer>
+    const void* buf[SG_MAX_UPDATE_SLOTS];  // id<MTLBuffer>
     int active_slot;
 } sg_mtl_buffer_info;
 
 typedef struct sg_mtl_image_info {
-    const void* tex[SG_NUM_INFLIGHT_FRAMES]; // id<MTLTexture>
+    const void* tex[SG_MAX_UPDATE_SLOTS]; // id<MTLTexture>
     int active_slot;
 } sg_mtl_image_info;
 
@@ -4931,12 +6078,12 @@ typedef struct sg_wgpu_attachments_info {
 } sg_wgpu_attachments_info;
 
 typedef struct sg_gl_buffer_info {
-    uint32_t buf[SG_NUM_INFLIGHT_FRAMES];
+    uint32_t buf[SG_MAX_UPDATE_SLOTS];
     int active_slot;
 } sg_gl_buffer_info;
 
 typedef struct sg_gl_image_info {
-    uint32_t tex[SG_NUM_INFLIGHT_FRAMES];
+    uint32_t tex[SG_MAX_UPDATE_SLOTS];
     uint32_t tex_target;
     uint32_t msaa_render_buffer;
     int active_slot;
@@ -5035,6 +6182,8 @@ inline sg_sampler sg_make_sampler(const sg_sampler_desc& desc) { return sg_make_
 inline sg_shader sg_make_shader(const sg_shader_desc& desc) { return sg_make_shader(&desc); }
 inline sg_pipeline sg_make_pipeline(const sg_pipeline_desc& desc) { return sg_make_pipeline(&desc); }
 inline sg_attachments sg_make_attachments(const sg_attachments_desc& desc) { return sg_make_attachments(&desc); }
+inline sg_bindgroup sg_make_bindgroup(const sg_bindgroup_desc& desc) { return sg_make_bindgroup(&desc); }
+inline sg_command_list sg_make_command_list(const sg_command_list_desc& desc) { return sg_make_command_list(&desc); }
 inline void sg_update_image(sg_image img, const sg_image_data& data) { return sg_update_image(img, &data); }
 
 inline void sg_begin_pass(const sg_pass& pass) { return sg_begin_pass(&pass); }
@@ -5056,6 +6205,10 @@ inline void sg_init_pipeline(sg_pipeline pip, const sg_pipeline_desc& desc) { re
 inline void sg_init_attachments(sg_attachments atts, const sg_attachments_desc& desc) { return sg_init_attachments(atts, &desc); }
 
 inline void sg_update_buffer(sg_buffer buf_id, const sg_range& data) { return sg_update_buffer(buf_id, &data); }
+inline void sg_update_buffer_range(sg_buffer buf_id, int offset, const sg_range& data) { return sg_update_buffer_range(buf_id, offset, &data); }
+inline void sg_update_image_region(sg_image img_id, const sg_image_region& region, const sg_range& data) { return sg_update_image_region(img_id, &region, &data); }
+inline sg_readback sg_read_image_async(const sg_image_readback_desc& desc) { return sg_read_image_async(&desc); }
+inline sg_readback sg_read_buffer_async(const sg_buffer_readback_desc& desc) { return sg_read_buffer_async(&desc); }
 inline int sg_append_buffer(sg_buffer buf_id, const sg_range& data) { return sg_append_buffer(buf_id, &data); }
 #endif
 #endif // SOKOL_GFX_INCLUDED
@@ -5117,6 +6270,12 @@ inline int sg_append_buffer(sg_buffer buf_id, const sg_range& data) { return sg_
 #define _SG_TRACE_NOARGS(fn)
 #endif
 
+#if defined(_MSC_VER)
+#define _SG_THREAD_LOCAL __declspec(thread)
+#else
+#define _SG_THREAD_LOCAL __thread
+#endif
+
 // default clear values
 #ifndef SG_DEFAULT_CLEAR_RED
 #define SG_DEFAULT_CLEAR_RED (0.5f)
@@ -5241,6 +6400,16 @@ inline int sg_append_buffer(sg_buffer buf_id, const sg_range& data) { return sg_
         #endif
     #endif
 
+    // pixel-unpack-buffer streaming and asynchronous readbacks need glMapBufferRange(), which isn't available in WebGL2
+    #if !defined(__EMSCRIPTEN__)
+        #define _SOKOL_GL_HAS_MAPBUFFER (1)
+    #endif
+
+    // GPU timestamp queries are core since GL 3.3, but not available in GLES3 and WebGL2
+    #if defined(SOKOL_GLCORE)
+        #define _SOKOL_GL_HAS_TIMER_QUERY (1)
+    #endif
+
     // optional GL loader definitions (only on Win32)
     #if defined(_SOKOL_USE_WIN32_GL_LOADER)
         #define __gl_h_ 1
@@ -5273,6 +6442,7 @@ inline int sg_append_buffer(sg_buffer buf_id, const sg_range& data) { return sg_
         typedef short  GLshort;
         typedef void  GLvoid;
         typedef int64_t  GLint64;
+        typedef struct __GLsync* GLsync;
         typedef float  GLfloat;
         typedef int  GLint;
         #define GL_INT_2_10_10_10_REV 0x8D9F
@@ -5502,6 +6672,28 @@ inline int sg_append_buffer(sg_buffer buf_id, const sg_range& data) { return sg_
         #define GL_MAX 0x8008
         #define GL_WRITE_ONLY 0x88B9
         #define GL_READ_WRITE 0x88BA
+        #define GL_PIXEL_UNPACK_BUFFER 0x88EC
+        #define GL_MAP_WRITE_BIT 0x0002
+        #define GL_MAP_INVALIDATE_RANGE_BIT 0x0004
+        #define GL_MAP_UNSYNCHRONIZED_BIT 0x0020
+        #define GL_SYNC_GPU_COMMANDS_COMPLETE 0x9117
+        #define GL_SYNC_FLUSH_COMMANDS_BIT 0x00000001
+        #define GL_TIMEOUT_EXPIRED 0x911B
+        #define GL_WAIT_FAILED 0x911D
+        #define GL_PIXEL_PACK_BUFFER 0x88EB
+        #define GL_COPY_READ_BUFFER 0x8F36
+        #define GL_COPY_WRITE_BUFFER 0x8F37
+        #define GL_STREAM_READ 0x88E1
+        #define GL_MAP_READ_BIT 0x0001
+        #define GL_PACK_ALIGNMENT 0x0D05
+        #define GL_FRAMEBUFFER_BARRIER_BIT 0x00000400
+        #define GL_BUFFER_UPDATE_BARRIER_BIT 0x00000200
+        #define GL_TIMESTAMP 0x8E28
+        #define GL_QUERY_RESULT 0x8866
+        #define GL_QUERY_RESULT_AVAILABLE 0x8867
+        #define GL_DRAW_INDIRECT_BUFFER 0x8F3F
+        #define GL_COMMAND_BARRIER_BIT 0x00000040
+        #define GL_TEXTURE_UPDATE_BARRIER_BIT 0x00000100
     #endif
 
     #ifndef GL_UNSIGNED_INT_2_10_10_10_REV
@@ -5608,6 +6800,9 @@ inline int sg_append_buffer(sg_buffer buf_id, const sg_range& data) { return sg_
     #ifndef GL_SHADER_STORAGE_BUFFER
     #define GL_SHADER_STORAGE_BUFFER 0x90D2
     #endif
+    #ifndef GL_DRAW_INDIRECT_BUFFER
+    #define GL_DRAW_INDIRECT_BUFFER 0x8F3F
+    #endif
 #endif
 
 #if defined(SOKOL_GLES3)
@@ -5639,6 +6834,9 @@ typedef struct {
     int queue_top;
     uint32_t* gen_ctrs;
     int* free_queue;
+    int init_size;          // size of the first item chunk
+    int grow_size;          // number of slots added when an exhausted pool grows (0: pool doesn't grow)
+    int high_water_mark;    // max number of allocated slots
 } _sg_pool_t;
 
 // resource func forward decls
@@ -5648,6 +6846,7 @@ struct _sg_sampler_s;
 struct _sg_shader_s;
 struct _sg_pipeline_s;
 struct _sg_attachments_s;
+struct _sg_readback_s;
 
 // a general resource slot reference useful for caches
 typedef struct _sg_sref_s {
@@ -5706,6 +6905,10 @@ enum {
     _SG_DEFAULT_SHADER_POOL_SIZE = 32,
     _SG_DEFAULT_PIPELINE_POOL_SIZE = 64,
     _SG_DEFAULT_ATTACHMENTS_POOL_SIZE = 16,
+    _SG_DEFAULT_BINDGROUP_POOL_SIZE = 256,
+    _SG_DEFAULT_COMMAND_LIST_POOL_SIZE = 16,
+    _SG_DEFAULT_READBACK_POOL_SIZE = 16,
+    _SG_DEFAULT_COMMAND_LIST_BUFFER_SIZE = 64 * 1024,
     _SG_DEFAULT_UB_SIZE = 4 * 1024 * 1024,
     _SG_DEFAULT_MAX_DISPATCH_CALLS_PER_PASS = 1024,
     _SG_DEFAULT_MAX_COMMIT_LISTENERS = 1024,
@@ -5723,23 +6926,31 @@ typedef struct {
     bool append_overflow;
     uint32_t update_frame_index;
     uint32_t append_frame_index;
+    uint32_t bind_frame_index;      // only tracked with SOKOL_DEBUG, see _sg_track_bound_resources()
     int num_slots;
     int active_slot;
+    sg_update_mode update_mode;
     sg_buffer_usage usage;
+    uint64_t mem_size;      // estimated GPU memory size, see sg_query_memory_stats()
 } _sg_buffer_common_t;
 
 typedef struct {
     uint32_t upd_frame_index;
+    uint32_t bind_frame_index;      // only tracked with SOKOL_DEBUG, see _sg_track_bound_resources()
     int num_slots;
     int active_slot;
+    sg_update_mode update_mode;
     sg_image_type type;
     int width;
     int height;
     int num_slices;
     int num_mipmaps;
+    bool generate_mipmaps;
+    bool mipmaps_pending;   // mipmap generation deferred until sg_end_pass()
     sg_image_usage usage;
     sg_pixel_format pixel_format;
     int sample_count;
+    uint64_t mem_size;      // estimated GPU memory size, see sg_query_memory_stats()
 } _sg_image_common_t;
 
 typedef struct {
@@ -5845,6 +7056,18 @@ typedef struct {
     _sg_attachment_common_t storages[SG_MAX_STORAGE_ATTACHMENTS];
 } _sg_attachments_common_t;
 
+typedef struct {
+    bool completed;     // backend readback operation has finished (or failed)
+    bool failed;
+    int width;          // image readback: region width in pixels, buffer readback: size in bytes
+    int height;         // image readback: region height in pixels, buffer readback: 1
+    int row_pitch;      // tightly packed row pitch in destination memory
+    int size;           // number of bytes written to destination memory
+    sg_range data;
+    void (*callback)(const sg_readback_result* result);
+    void* user_data;
+} _sg_readback_common_t;
+
 #if defined(SOKOL_DUMMY_BACKEND)
 typedef struct _sg_buffer_s {
     _sg_slot_t slot;
@@ -5882,20 +7105,59 @@ typedef struct _sg_attachments_s {
 } _sg_dummy_attachments_t;
 typedef _sg_dummy_attachments_t _sg_attachments_t;
 
+typedef struct _sg_readback_s {
+    _sg_slot_t slot;
+    _sg_readback_common_t cmn;
+} _sg_dummy_readback_t;
+typedef _sg_dummy_readback_t _sg_readback_t;
+
+// simulated state cache entry for a bound buffer or image
+typedef struct {
+    uint32_t id;
+    int active_slot;
+    int offset;
+} _sg_dummy_cache_binding_t;
+
+typedef struct {
+    bool valid;
+    int x, y, w, h;
+    bool origin_top_left;
+} _sg_dummy_cache_rect_t;
+
+typedef struct {
+    uint32_t cur_pip_id;
+    bool cur_pip_indexed;
+    bool render_state_valid;
+    _sg_pipeline_common_t render_state;
+    _sg_dummy_cache_rect_t viewport;
+    _sg_dummy_cache_rect_t scissor_rect;
+    _sg_dummy_cache_binding_t vbs[SG_MAX_VERTEXBUFFER_BINDSLOTS];
+    _sg_dummy_cache_binding_t ib;
+    _sg_dummy_cache_binding_t imgs[SG_MAX_IMAGE_BINDSLOTS];
+    uint32_t smp_ids[SG_MAX_SAMPLER_BINDSLOTS];
+    _sg_dummy_cache_binding_t sbufs[SG_MAX_STORAGEBUFFER_BINDSLOTS];
+    uint32_t simg_ids[SG_MAX_STORAGE_ATTACHMENTS];
+} _sg_dummy_state_cache_t;
+
+typedef struct {
+    _sg_dummy_state_cache_t cache;
+} _sg_dummy_backend_t;
+
 #elif defined(_SOKOL_ANY_GL)
 
 typedef enum {
     _SG_GL_GPUDIRTY_VERTEXBUFFER = (1<<0),
     _SG_GL_GPUDIRTY_INDEXBUFFER = (1<<1),
     _SG_GL_GPUDIRTY_STORAGEBUFFER = (1<<2),
-    _SG_GL_GPUDIRTY_BUFFER_ALL = _SG_GL_GPUDIRTY_VERTEXBUFFER | _SG_GL_GPUDIRTY_INDEXBUFFER | _SG_GL_GPUDIRTY_STORAGEBUFFER,
+    _SG_GL_GPUDIRTY_INDIRECTBUFFER = (1<<3),
+    _SG_GL_GPUDIRTY_BUFFER_ALL = _SG_GL_GPUDIRTY_VERTEXBUFFER | _SG_GL_GPUDIRTY_INDEXBUFFER | _SG_GL_GPUDIRTY_STORAGEBUFFER | _SG_GL_GPUDIRTY_INDIRECTBUFFER,
 } _sg_gl_gpudirty_t;
 
 typedef struct _sg_buffer_s {
     _sg_slot_t slot;
     _sg_buffer_common_t cmn;
     struct {
-        GLuint buf[SG_NUM_INFLIGHT_FRAMES];
+        GLuint buf[SG_MAX_UPDATE_SLOTS];
         bool injected;  // if true, external buffers were injected with sg_buffer_desc.gl_buffers
         uint8_t gpu_dirty_flags; // combination of _sg_gl_gpudirty_t flags
     } gl;
@@ -5908,7 +7170,7 @@ typedef struct _sg_image_s {
     struct {
         GLenum target;
         GLuint msaa_render_buffer;
-        GLuint tex[SG_NUM_INFLIGHT_FRAMES];
+        GLuint tex[SG_MAX_UPDATE_SLOTS];
         bool injected;  // if true, external textures were injected with sg_image_desc.gl_textures
     } gl;
 } _sg_gl_image_t;
@@ -5993,11 +7255,87 @@ typedef struct _sg_attachments_s {
 } _sg_gl_attachments_t;
 typedef _sg_gl_attachments_t _sg_attachments_t;
 
+typedef struct _sg_readback_s {
+    _sg_slot_t slot;
+    _sg_readback_common_t cmn;
+    struct {
+        GLuint buf;     // pixel-pack-buffer or copy-target buffer
+        #if defined(_SOKOL_GL_HAS_MAPBUFFER)
+        GLsync fence;
+        #endif
+    } gl;
+} _sg_gl_readback_t;
+typedef _sg_gl_readback_t _sg_readback_t;
+
 typedef struct {
     _sg_gl_attr_t gl_attr;
     GLuint gl_vbuf;
 } _sg_gl_cache_attr_t;
 
+// VAO cache items are keyed by pipeline (defines the vertex layout) and buffer bindings
+typedef struct {
+    _sg_sref_t pip;
+    GLuint vbs[SG_MAX_VERTEXBUFFER_BINDSLOTS];
+    int vb_offsets[SG_MAX_VERTEXBUFFER_BINDSLOTS];
+    GLuint ib;
+} _sg_gl_vao_key_t;
+
+typedef struct {
+    _sg_gl_vao_key_t key;
+    GLuint vao;
+    uint32_t last_used;
+} _sg_gl_vao_cache_item_t;
+
+typedef struct {
+    int num;
+    uint32_t tick;
+    _sg_gl_vao_cache_item_t* items;
+} _sg_gl_vao_cache_t;
+
+// ring of pixel-unpack-buffers for asynchronous texture updates, one buffer per frame
+#define _SG_GL_NUM_UPLOAD_BUFFERS (SG_NUM_INFLIGHT_FRAMES + 1)
+typedef struct {
+    int size;           // 0 if disabled
+    int pos;            // write offset into current buffer
+    int index;          // index of current buffer
+    uint32_t frame_index;
+    bool bound;
+    GLuint buf[_SG_GL_NUM_UPLOAD_BUFFERS];
+    #if defined(_SOKOL_GL_HAS_MAPBUFFER)
+    GLsync fence[_SG_GL_NUM_UPLOAD_BUFFERS];
+    #endif
+} _sg_gl_upload_ring_t;
+
+// GPU timestamp queries of one frame, scope i uses queries[2*i] and queries[2*i+1]
+#define _SG_GL_NUM_TIMER_FRAMES (SG_NUM_INFLIGHT_FRAMES + 2)
+#define _SG_GL_MAX_TIMER_DEPTH (16)
+typedef struct {
+    bool pending;       // true if waiting for query results
+    uint32_t frame_index;
+    int num_timings;
+    int num_dropped;
+    sg_gpu_timing timings[SG_MAX_GPU_TIMINGS];
+    GLuint queries[2 * SG_MAX_GPU_TIMINGS];
+} _sg_gl_timer_frame_t;
+
+typedef struct {
+    bool enabled;
+    int cur_frame;      // index of the currently recorded frame
+    int depth;          // current nesting depth
+    int stack[_SG_GL_MAX_TIMER_DEPTH];  // open scope indices, or -1 for dropped scopes
+    _sg_gl_timer_frame_t frames[_SG_GL_NUM_TIMER_FRAMES];
+} _sg_gl_timer_t;
+
+// consecutive sg_update_buffer_range() calls into the same buffer are gathered here
+enum { _SG_GL_RANGE_STAGING_SIZE = 64 * 1024 };
+typedef struct {
+    GLuint buf;
+    GLenum target;
+    int offset;
+    int size;
+    uint8_t* ptr;   // lazily allocated, _SG_GL_RANGE_STAGING_SIZE bytes
+} _sg_gl_range_staging_t;
+
 typedef struct {
     GLenum target;
     GLuint texture;
@@ -6023,10 +7361,14 @@ typedef struct {
     GLuint index_buffer;
     GLuint storage_buffer;  // general bind point
     GLuint storage_buffers[_SG_GL_MAX_SBUF_BINDINGS];
+    GLuint indirect_buffer;
     GLuint stored_vertex_buffer;
     GLuint stored_index_buffer;
     GLuint stored_storage_buffer;
+    GLuint stored_indirect_buffer;
     GLuint prog;
+    GLuint vao;
+    GLuint stored_vao;
     _sg_gl_cache_texture_sampler_bind_slot texture_samplers[_SG_GL_MAX_IMG_SMP_BINDINGS];
     _sg_gl_cache_texture_sampler_bind_slot stored_texture_sampler;
     int cur_ib_offset;
@@ -6040,6 +7382,10 @@ typedef struct {
     bool valid;
     GLuint vao;
     _sg_gl_state_cache_t cache;
+    _sg_gl_vao_cache_t vao_cache;
+    _sg_gl_range_staging_t range_staging;
+    _sg_gl_upload_ring_t upload_ring;
+    _sg_gl_timer_t timer;
     bool ext_anisotropic;
     GLint max_anisotropy;
     sg_store_action color_store_actions[SG_MAX_COLOR_ATTACHMENTS];
@@ -6059,6 +7405,7 @@ typedef struct _sg_buffer_s {
         ID3D11Buffer* buf;
         ID3D11ShaderResourceView* srv;
         ID3D11UnorderedAccessView* uav;
+        D3D11_USAGE usage;      // DEFAULT: updated via UpdateSubresource(), DYNAMIC: via Map()
     } d3d11;
 } _sg_d3d11_buffer_t;
 typedef _sg_d3d11_buffer_t _sg_buffer_t;
@@ -6072,6 +7419,7 @@ typedef struct _sg_image_s {
         ID3D11Texture3D* tex3d;
         ID3D11Resource* res;    // either tex2d or tex3d
         ID3D11ShaderResourceView* srv;
+        D3D11_USAGE usage;      // DEFAULT: updated via UpdateSubresource(), DYNAMIC: via Map()
     } d3d11;
 } _sg_d3d11_image_t;
 typedef _sg_d3d11_image_t _sg_image_t;
@@ -6154,6 +7502,15 @@ typedef struct _sg_attachments_s {
 } _sg_d3d11_attachments_t;
 typedef _sg_d3d11_attachments_t _sg_attachments_t;
 
+typedef struct _sg_readback_s {
+    _sg_slot_t slot;
+    _sg_readback_common_t cmn;
+    struct {
+        ID3D11Resource* staging;
+    } d3d11;
+} _sg_d3d11_readback_t;
+typedef _sg_d3d11_readback_t _sg_readback_t;
+
 typedef struct {
     bool valid;
     ID3D11Device* dev;
@@ -6200,7 +7557,7 @@ typedef struct _sg_buffer_s {
     _sg_slot_t slot;
     _sg_buffer_common_t cmn;
     struct {
-        int buf[SG_NUM_INFLIGHT_FRAMES];  // index into _sg_mtl_pool
+        int buf[SG_MAX_UPDATE_SLOTS];  // index into _sg_mtl_pool
     } mtl;
 } _sg_mtl_buffer_t;
 typedef _sg_mtl_buffer_t _sg_buffer_t;
@@ -6209,7 +7566,7 @@ typedef struct _sg_image_s {
     _sg_slot_t slot;
     _sg_image_common_t cmn;
     struct {
-        int tex[SG_NUM_INFLIGHT_FRAMES];
+        int tex[SG_MAX_UPDATE_SLOTS];
     } mtl;
 } _sg_mtl_image_t;
 typedef _sg_mtl_image_t _sg_image_t;
@@ -6272,6 +7629,16 @@ typedef struct _sg_attachments_s {
 } _sg_mtl_attachments_t;
 typedef _sg_mtl_attachments_t _sg_attachments_t;
 
+typedef struct _sg_readback_s {
+    _sg_slot_t slot;
+    _sg_readback_common_t cmn;
+    struct {
+        int buf;        // index into _sg_mtl_pool, shared-storage MTLBuffer
+        int cmd_buf;    // index into _sg_mtl_pool, command buffer with the blit operation
+    } mtl;
+} _sg_mtl_readback_t;
+typedef _sg_mtl_readback_t _sg_readback_t;
+
 // resource binding state cache
 #define _SG_MTL_MAX_STAGE_UB_BINDINGS (SG_MAX_UNIFORMBLOCK_BINDSLOTS)
 #define _SG_MTL_MAX_STAGE_UB_SBUF_BINDINGS (_SG_MTL_MAX_STAGE_UB_BINDINGS + SG_MAX_STORAGEBUFFER_BINDSLOTS)
@@ -6417,6 +7784,17 @@ typedef struct _sg_attachments_s {
 } _sg_wgpu_attachments_t;
 typedef _sg_wgpu_attachments_t _sg_attachments_t;
 
+typedef struct _sg_readback_s {
+    _sg_slot_t slot;
+    _sg_readback_common_t cmn;
+    struct {
+        WGPUBuffer buf;
+        int row_pitch;      // row pitch in buf (aligned to _SG_WGPU_ROWPITCH_ALIGN for images)
+        bool map_requested;
+    } wgpu;
+} _sg_wgpu_readback_t;
+typedef _sg_wgpu_readback_t _sg_readback_t;
+
 // a pool of per-frame uniform buffers
 typedef struct {
     uint32_t num_bytes;
@@ -6481,6 +7859,15 @@ typedef struct {
     _sg_wgpu_bindgroup_handle_t bg;
 } _sg_wgpu_bindings_cache_t;
 
+// lazily created state for sg_generate_mipmaps() (WebGPU has no builtin mipmap generation)
+typedef struct {
+    WGPUShaderModule shd_mod;
+    WGPUSampler smp;
+    WGPUBindGroupLayout bgl;
+    WGPUPipelineLayout pip_layout;
+    WGPURenderPipeline pip[_SG_PIXELFORMAT_NUM];
+} _sg_wgpu_mipgen_t;
+
 // the WGPU backend state
 typedef struct {
     bool valid;
@@ -6496,34 +7883,197 @@ typedef struct {
     _sg_wgpu_bindings_cache_t bindings_cache;
     _sg_wgpu_bindgroups_cache_t bindgroups_cache;
     _sg_wgpu_bindgroups_pool_t bindgroups_pool;
+    _sg_wgpu_mipgen_t mipgen;
 } _sg_wgpu_backend_t;
 #endif
 
 // this *MUST* remain 0
 #define _SG_INVALID_SLOT_INDEX (0)
 
-typedef struct _sg_pools_s {
-    _sg_pool_t buffer_pool;
-    _sg_pool_t image_pool;
-    _sg_pool_t sampler_pool;
-    _sg_pool_t shader_pool;
-    _sg_pool_t pipeline_pool;
-    _sg_pool_t attachments_pool;
-    _sg_buffer_t* buffers;
-    _sg_image_t* images;
-    _sg_sampler_t* samplers;
-    _sg_shader_t* shaders;
-    _sg_pipeline_t* pipelines;
-    _sg_attachments_t* attachments;
-} _sg_pools_t;
-
+// a pre-resolved sg_bindings snapshot, this is a frontend-only resource type
 typedef struct {
-    int num;        // number of allocated commit listener items
-    int upper;      // the current upper index (no valid items past this point)
-    sg_commit_listener* items;
-} _sg_commit_listeners_t;
+    _sg_slot_t slot;
+    _sg_pipeline_ref_t pip;
+    _sg_shader_ref_t shd;
+    bool is_compute;
+    // compact lists of used bindslots
+    uint8_t num_vbs;
+    uint8_t num_imgs;
+    uint8_t num_smps;
+    uint8_t num_sbufs;
+    uint8_t vb_slots[SG_MAX_VERTEXBUFFER_BINDSLOTS];
+    uint8_t img_slots[SG_MAX_IMAGE_BINDSLOTS];
+    uint8_t smp_slots[SG_MAX_SAMPLER_BINDSLOTS];
+    uint8_t sbuf_slots[SG_MAX_STORAGEBUFFER_BINDSLOTS];
+    // resource references indexed by bindslot
+    _sg_buffer_ref_t vbs[SG_MAX_VERTEXBUFFER_BINDSLOTS];
+    int vb_offsets[SG_MAX_VERTEXBUFFER_BINDSLOTS];
+    _sg_buffer_ref_t ib;
+    int ib_offset;
+    _sg_image_ref_t imgs[SG_MAX_IMAGE_BINDSLOTS];
+    _sg_sampler_ref_t smps[SG_MAX_SAMPLER_BINDSLOTS];
+    _sg_buffer_ref_t sbufs[SG_MAX_STORAGEBUFFER_BINDSLOTS];
+    #if defined(SOKOL_DEBUG)
+    sg_bindings bindings;   // the original bindings for the validation layer
+    #endif
+} _sg_bindgroup_t;
 
-// resolved pass attachments struct
+// command list stream items, all items are padded to a multiple of 8 bytes
+typedef enum {
+    _SG_CMD_APPLY_VIEWPORT,
+    _SG_CMD_APPLY_SCISSOR_RECT,
+    _SG_CMD_APPLY_PIPELINE,
+    _SG_CMD_APPLY_BINDINGS,
+    _SG_CMD_APPLY_UNIFORMS,
+    _SG_CMD_DRAW,
+    _SG_CMD_DRAW_INDIRECT,
+    _SG_CMD_DISPATCH,
+    _SG_CMD_INVALIDATE,     // recorded in place of a call which failed validation, skips the next draws
+} _sg_cmd_type_t;
+
+typedef struct {
+    uint32_t type;
+    uint32_t size;      // size of the item including header and payload
+} _sg_cmd_t;
+
+typedef struct {
+    _sg_cmd_t cmd;
+    int x, y, width, height;
+    bool origin_top_left;
+} _sg_cmd_rect_t;
+
+typedef struct {
+    _sg_cmd_t cmd;
+    _sg_pipeline_ref_t pip;
+} _sg_cmd_pipeline_t;
+
+typedef enum {
+    _SG_CMDRES_VERTEXBUFFER,
+    _SG_CMDRES_INDEXBUFFER,
+    _SG_CMDRES_IMAGE,
+    _SG_CMDRES_SAMPLER,
+    _SG_CMDRES_STORAGEBUFFER,
+} _sg_cmdres_type_t;
+
+enum {
+    _SG_CMD_MAX_RESOURCES = SG_MAX_VERTEXBUFFER_BINDSLOTS + 1 + SG_MAX_IMAGE_BINDSLOTS + SG_MAX_SAMPLER_BINDSLOTS + SG_MAX_STORAGEBUFFER_BINDSLOTS,
+};
+
+typedef struct {
+    uint8_t type;
+    uint8_t slot;
+    int offset;
+    union {
+        _sg_buffer_ref_t buf;
+        _sg_image_ref_t img;
+        _sg_sampler_ref_t smp;
+    } ref;
+} _sg_cmd_resource_t;
+
+// followed by num_resources _sg_cmd_resource_t items
+typedef struct {
+    _sg_cmd_t cmd;
+    bool valid;
+    int num_resources;
+} _sg_cmd_bindings_t;
+
+// followed by num_bytes uniform data bytes
+typedef struct {
+    _sg_cmd_t cmd;
+    int ub_slot;
+    uint32_t num_bytes;
+} _sg_cmd_uniforms_t;
+
+// used for both sg_draw() and sg_dispatch()
+typedef struct {
+    _sg_cmd_t cmd;
+    int args[3];
+} _sg_cmd_draw_t;
+
+typedef struct {
+    _sg_cmd_t cmd;
+    _sg_buffer_ref_t buf;
+    int offset;
+} _sg_cmd_draw_indirect_t;
+
+typedef struct {
+    _sg_slot_t slot;
+    uint8_t* buf;
+    size_t size;
+    size_t pos;
+    bool recording;
+    bool overflow;
+    bool has_pipeline;
+    bool is_compute;
+    // recording state, only used by the recording thread
+    struct {
+        _sg_pipeline_ref_t pip;
+        uint32_t required_bindings_and_uniforms;
+        uint32_t applied_bindings_and_uniforms;
+    } rec;
+} _sg_command_list_t;
+
+typedef struct _sg_pools_s {
+    _sg_pool_t buffer_pool;
+    _sg_pool_t image_pool;
+    _sg_pool_t sampler_pool;
+    _sg_pool_t shader_pool;
+    _sg_pool_t pipeline_pool;
+    _sg_pool_t attachments_pool;
+    _sg_pool_t bindgroup_pool;
+    _sg_pool_t command_list_pool;
+    _sg_pool_t readback_pool;
+    // per-slot pointers into resource item chunks (see _SG_IMPL_POOL_ITEMS_GROW)
+    _sg_buffer_t** buffers;
+    _sg_image_t** images;
+    _sg_sampler_t** samplers;
+    _sg_shader_t** shaders;
+    _sg_pipeline_t** pipelines;
+    _sg_attachments_t** attachments;
+    _sg_bindgroup_t** bindgroups;
+    _sg_command_list_t** command_lists;
+    _sg_readback_t** readbacks;
+} _sg_pools_t;
+
+typedef struct {
+    int num;        // number of allocated commit listener items
+    int upper;      // the current upper index (no valid items past this point)
+    sg_commit_listener* items;
+} _sg_commit_listeners_t;
+
+// a pipeline- or sampler-deduplication cache (see sg_desc.dedup_pipelines and sg_desc.dedup_samplers)
+typedef struct {
+    uint64_t hash;
+    uint32_t res_id;    // SG_INVALID_ID if the table entry is unused
+    int ref_count;
+    void* key;          // copy of the key struct (the defaulted desc struct with label and canaries cleared)
+} _sg_dedup_item_t;
+
+// an open-addressing hash table (linear probing) keyed by the desc hash, plus a
+// map from resource slot index to table index for releasing items by resource id
+typedef struct {
+    int num;            // number of used table entries
+    int cap;            // table size, always a power of 2
+    _sg_dedup_item_t* items;
+    int num_slots;
+    int* slot_items;    // resource slot index => table index + 1 (0 if the resource isn't cached)
+} _sg_dedup_cache_t;
+
+typedef struct {
+    sg_pipeline_desc desc;
+    uint32_t shd_uninit_count;  // don't match pipelines created with a previous incarnation of the shader
+} _sg_pipeline_dedup_key_t;
+
+// a queue of destroyed resource objects waiting for their backend objects to be released (see sg_desc.deferred_destroy)
+typedef struct {
+    int num;
+    int cap;
+    size_t item_size;
+    uint32_t* frame_indices;    // frame index when an item was queued
+    uint8_t* items;             // copies of the resource structs
+} _sg_destroy_queue_t;
+
+// resolved pass attachments struct
 typedef struct {
     _sg_image_t* color_images[SG_MAX_COLOR_ATTACHMENTS];
     _sg_image_t* resolve_images[SG_MAX_COLOR_ATTACHMENTS];
@@ -6576,12 +8126,23 @@ typedef struct {
     bool next_draw_valid;
     uint32_t required_bindings_and_uniforms;    // used to check that bindings and uniforms are applied after applying pipeline
     uint32_t applied_bindings_and_uniforms;     // bits 0..7: uniform blocks, bit 8: bindings
-    #if defined(SOKOL_DEBUG)
-    sg_log_item validate_error;
-    #endif
+    struct {
+        uint64_t hash[SG_MAX_UNIFORMBLOCK_BINDSLOTS];
+        size_t size[SG_MAX_UNIFORMBLOCK_BINDSLOTS];    // 0 if slot has no cached uniform data
+        uint8_t* data[SG_MAX_UNIFORMBLOCK_BINDSLOTS];  // copy of the last applied uniform data
+        size_t capacity[SG_MAX_UNIFORMBLOCK_BINDSLOTS];
+    } uniform_cache;    // see sg_desc.dedup_uniforms
     struct {
         _sg_tracker_t readwrite_sbufs;  // tracks read/write storage buffers used in compute pass
     } compute;
+    struct {
+        _sg_tracker_t pending;          // images with mipmap generation deferred until sg_end_pass()
+    } mipmaps;
+    struct {
+        sg_memory_stats stats;
+        bool budget_exceeded;           // stats.total.num_bytes went above stats.budget
+        bool budget_notified;           // sg_desc.memory_budget.exceeded_cb has been called
+    } memory;
     _sg_pools_t pools;
     sg_backend backend;
     sg_features features;
@@ -6590,7 +8151,10 @@ typedef struct {
     bool stats_enabled;
     sg_frame_stats stats;
     sg_frame_stats prev_stats;
-    #if defined(_SOKOL_ANY_GL)
+    sg_gpu_timings gpu_timings;     // latest available GPU timings (see sg_desc.gpu_timings)
+    #if defined(SOKOL_DUMMY_BACKEND)
+    _sg_dummy_backend_t dummy;
+    #elif defined(_SOKOL_ANY_GL)
     _sg_gl_backend_t gl;
     #elif defined(SOKOL_METAL)
     _sg_mtl_backend_t mtl;
@@ -6603,8 +8167,25 @@ typedef struct {
     sg_trace_hooks hooks;
     #endif
     _sg_commit_listeners_t commit_listeners;
+    struct {
+        _sg_dedup_cache_t pipelines;
+        _sg_dedup_cache_t samplers;
+    } dedup;
+    struct {
+        _sg_destroy_queue_t buffers;
+        _sg_destroy_queue_t images;
+        _sg_destroy_queue_t samplers;
+        _sg_destroy_queue_t shaders;
+        _sg_destroy_queue_t pipelines;
+        _sg_destroy_queue_t attachments;
+    } destroy_queue;
 } _sg_state_t;
 static _sg_state_t _sg;
+// the command list currently recorded on this thread, and the per-thread validation result
+static _SG_THREAD_LOCAL _sg_command_list_t* _sg_rec_cmdlist;
+#if defined(SOKOL_DEBUG)
+static _SG_THREAD_LOCAL sg_log_item _sg_validate_error;
+#endif
 
 // ██       ██████   ██████   ██████  ██ ███    ██  ██████
 // ██      ██    ██ ██       ██       ██ ████   ██ ██
@@ -6626,7 +8207,7 @@ static const char* _sg_log_messages[] = {
 #define _SG_WARN(code) _sg_log(SG_LOGITEM_ ##code, 2, 0, __LINE__)
 #define _SG_INFO(code) _sg_log(SG_LOGITEM_ ##code, 3, 0, __LINE__)
 #define _SG_LOGMSG(code,msg) _sg_log(SG_LOGITEM_ ##code, 3, msg, __LINE__)
-#define _SG_VALIDATE(cond,code) if (!(cond)){ _sg.validate_error = SG_LOGITEM_ ##code; _sg_log(SG_LOGITEM_ ##code, 1, 0, __LINE__); }
+#define _SG_VALIDATE(cond,code) if (!(cond)){ _sg_validate_error = SG_LOGITEM_ ##code; _sg_log(SG_LOGITEM_ ##code, 1, 0, __LINE__); }
 
 static void _sg_log(sg_log_item log_item, uint32_t log_level, const char* msg, uint32_t line_nr) {
     if (_sg.desc.logger.func) {
@@ -6727,11 +8308,14 @@ _SOKOL_PRIVATE void _sg_strcpy(_sg_str_t* dst, const char* src) {
 // ██       ██████   ██████  ███████
 //
 // >>pool
-_SOKOL_PRIVATE void _sg_pool_init(_sg_pool_t* pool, int num) {
-    SOKOL_ASSERT(pool && (num >= 1));
+_SOKOL_PRIVATE void _sg_pool_init(_sg_pool_t* pool, int num, int grow_size) {
+    SOKOL_ASSERT(pool && (num >= 1) && (grow_size >= 0));
     // slot 0 is reserved for the 'invalid id', so bump the pool size by 1
     pool->size = num + 1;
     pool->queue_top = 0;
+    pool->init_size = pool->size;
+    pool->grow_size = grow_size;
+    pool->high_water_mark = 0;
     // generation counters indexable by pool slot index, slot 0 is reserved
     size_t gen_ctrs_size = sizeof(uint32_t) * (size_t)pool->size;
     pool->gen_ctrs = (uint32_t*)_sg_malloc_clear(gen_ctrs_size);
@@ -6753,6 +8337,45 @@ _SOKOL_PRIVATE void _sg_pool_discard(_sg_pool_t* pool) {
     pool->gen_ctrs = 0;
     pool->size = 0;
     pool->queue_top = 0;
+    pool->init_size = 0;
+    pool->grow_size = 0;
+    pool->high_water_mark = 0;
+}
+
+/* grow an exhausted pool by pool->grow_size slots (up to _SG_MAX_POOL_SIZE),
+   returns false if the pool isn't exhausted or can't grow; the slot indices
+   of existing resources don't change, so their handles remain valid, but the
+   caller must also grow the pool's resource item table
+*/
+_SOKOL_PRIVATE bool _sg_pool_grow_if_exhausted(_sg_pool_t* pool) {
+    SOKOL_ASSERT(pool);
+    SOKOL_ASSERT(pool->free_queue && pool->gen_ctrs);
+    if ((pool->queue_top > 0) || (0 == pool->grow_size) || (pool->size >= _SG_MAX_POOL_SIZE)) {
+        return false;
+    }
+    const int old_size = pool->size;
+    int new_size = old_size + pool->grow_size;
+    if (new_size > _SG_MAX_POOL_SIZE) {
+        new_size = _SG_MAX_POOL_SIZE;
+    }
+    uint32_t* gen_ctrs = (uint32_t*)_sg_malloc_clear(sizeof(uint32_t) * (size_t)new_size);
+    memcpy(gen_ctrs, pool->gen_ctrs, sizeof(uint32_t) * (size_t)old_size);
+    _sg_free(pool->gen_ctrs);
+    pool->gen_ctrs = gen_ctrs;
+    // the free queue is empty, so its content doesn't need to be copied
+    _sg_free(pool->free_queue);
+    pool->free_queue = (int*)_sg_malloc_clear(sizeof(int) * (size_t)(new_size - 1));
+    for (int i = new_size-1; i >= old_size; i--) {
+        pool->free_queue[pool->queue_top++] = i;
+    }
+    pool->size = new_size;
+    return true;
+}
+
+// returns the start index of the next resource item chunk
+_SOKOL_PRIVATE int _sg_pool_next_chunk(const _sg_pool_t* pool, int chunk_start) {
+    SOKOL_ASSERT(pool);
+    return (0 == chunk_start) ? pool->init_size : (chunk_start + pool->grow_size);
 }
 
 _SOKOL_PRIVATE int _sg_pool_alloc_index(_sg_pool_t* pool) {
@@ -6761,6 +8384,10 @@ _SOKOL_PRIVATE int _sg_pool_alloc_index(_sg_pool_t* pool) {
     if (pool->queue_top > 0) {
         int slot_index = pool->free_queue[--pool->queue_top];
         SOKOL_ASSERT((slot_index > 0) && (slot_index < pool->size));
+        const int num_used = pool->size - 1 - pool->queue_top;
+        if (num_used > pool->high_water_mark) {
+            pool->high_water_mark = num_used;
+        }
         return slot_index;
     } else {
         // pool exhausted
@@ -6842,49 +8469,136 @@ _SOKOL_PRIVATE void _sg_reset_attachments_to_alloc_state(_sg_attachments_t* atts
     atts->slot.state = SG_RESOURCESTATE_ALLOC;
 }
 
+_SOKOL_PRIVATE void _sg_reset_bindgroup_to_alloc_state(_sg_bindgroup_t* bg) {
+    SOKOL_ASSERT(bg);
+    _sg_slot_t slot = bg->slot;
+    _sg_clear(bg, sizeof(*bg));
+    bg->slot = slot;
+    bg->slot.uninit_count += 1;
+    bg->slot.state = SG_RESOURCESTATE_ALLOC;
+}
+
+_SOKOL_PRIVATE void _sg_reset_command_list_to_alloc_state(_sg_command_list_t* cl) {
+    SOKOL_ASSERT(cl);
+    _sg_slot_t slot = cl->slot;
+    _sg_clear(cl, sizeof(*cl));
+    cl->slot = slot;
+    cl->slot.uninit_count += 1;
+    cl->slot.state = SG_RESOURCESTATE_ALLOC;
+}
+
+_SOKOL_PRIVATE void _sg_reset_readback_to_alloc_state(_sg_readback_t* rb) {
+    SOKOL_ASSERT(rb);
+    _sg_slot_t slot = rb->slot;
+    _sg_clear(rb, sizeof(*rb));
+    rb->slot = slot;
+    rb->slot.uninit_count += 1;
+    rb->slot.state = SG_RESOURCESTATE_ALLOC;
+}
+
+/* resource objects are allocated in chunks and accessed through a per-slot
+   pointer table, when a pool grows, only the pointer table is reallocated
+   and a new chunk is added, so that existing resource objects never move
+   (internal resource references hold direct pointers)
+*/
+#define _SG_IMPL_POOL_ITEMS_GROW(NAME,RES) \
+_SOKOL_PRIVATE RES** NAME(RES** old_items, int old_size, int new_size) { \
+    SOKOL_ASSERT((old_size >= 0) && (new_size > old_size)); \
+    RES** items = (RES**)_sg_malloc_clear(sizeof(RES*) * (size_t)new_size); \
+    if (old_items) { \
+        memcpy(items, old_items, sizeof(RES*) * (size_t)old_size); \
+        _sg_free(old_items); \
+    } \
+    RES* chunk = (RES*)_sg_malloc_clear(sizeof(RES) * (size_t)(new_size - old_size)); \
+    for (int i = old_size; i < new_size; i++) { \
+        items[i] = chunk++; \
+    } \
+    return items; \
+}
+_SG_IMPL_POOL_ITEMS_GROW(_sg_buffer_items_grow, _sg_buffer_t)
+_SG_IMPL_POOL_ITEMS_GROW(_sg_image_items_grow, _sg_image_t)
+_SG_IMPL_POOL_ITEMS_GROW(_sg_sampler_items_grow, _sg_sampler_t)
+_SG_IMPL_POOL_ITEMS_GROW(_sg_shader_items_grow, _sg_shader_t)
+_SG_IMPL_POOL_ITEMS_GROW(_sg_pipeline_items_grow, _sg_pipeline_t)
+_SG_IMPL_POOL_ITEMS_GROW(_sg_attachments_items_grow, _sg_attachments_t)
+_SG_IMPL_POOL_ITEMS_GROW(_sg_bindgroup_items_grow, _sg_bindgroup_t)
+_SG_IMPL_POOL_ITEMS_GROW(_sg_command_list_items_grow, _sg_command_list_t)
+_SG_IMPL_POOL_ITEMS_GROW(_sg_readback_items_grow, _sg_readback_t)
+
+#define _SG_IMPL_POOL_ITEMS_DISCARD(NAME,RES) \
+_SOKOL_PRIVATE void NAME(const _sg_pool_t* pool, RES** items) { \
+    SOKOL_ASSERT(pool && items); \
+    for (int i = 0; i < pool->size; i = _sg_pool_next_chunk(pool, i)) { \
+        _sg_free(items[i]); \
+    } \
+    _sg_free(items); \
+}
+_SG_IMPL_POOL_ITEMS_DISCARD(_sg_buffer_items_discard, _sg_buffer_t)
+_SG_IMPL_POOL_ITEMS_DISCARD(_sg_image_items_discard, _sg_image_t)
+_SG_IMPL_POOL_ITEMS_DISCARD(_sg_sampler_items_discard, _sg_sampler_t)
+_SG_IMPL_POOL_ITEMS_DISCARD(_sg_shader_items_discard, _sg_shader_t)
+_SG_IMPL_POOL_ITEMS_DISCARD(_sg_pipeline_items_discard, _sg_pipeline_t)
+_SG_IMPL_POOL_ITEMS_DISCARD(_sg_attachments_items_discard, _sg_attachments_t)
+_SG_IMPL_POOL_ITEMS_DISCARD(_sg_bindgroup_items_discard, _sg_bindgroup_t)
+_SG_IMPL_POOL_ITEMS_DISCARD(_sg_command_list_items_discard, _sg_command_list_t)
+_SG_IMPL_POOL_ITEMS_DISCARD(_sg_readback_items_discard, _sg_readback_t)
+
 _SOKOL_PRIVATE void _sg_setup_pools(_sg_pools_t* p, const sg_desc* desc) {
     SOKOL_ASSERT(p);
     SOKOL_ASSERT(desc);
-    // note: the pools here will have an additional item, since slot 0 is reserved
+    // note: the pools here will have an additional item, since slot 0 is reserved,
+    // growable pools grow by their initial size when exhausted
     SOKOL_ASSERT((desc->buffer_pool_size > 0) && (desc->buffer_pool_size < _SG_MAX_POOL_SIZE));
-    _sg_pool_init(&p->buffer_pool, desc->buffer_pool_size);
-    size_t buffer_pool_byte_size = sizeof(_sg_buffer_t) * (size_t)p->buffer_pool.size;
-    p->buffers = (_sg_buffer_t*) _sg_malloc_clear(buffer_pool_byte_size);
+    _sg_pool_init(&p->buffer_pool, desc->buffer_pool_size, desc->growable_pools ? desc->buffer_pool_size : 0);
+    p->buffers = _sg_buffer_items_grow(0, 0, p->buffer_pool.size);
 
     SOKOL_ASSERT((desc->image_pool_size > 0) && (desc->image_pool_size < _SG_MAX_POOL_SIZE));
-    _sg_pool_init(&p->image_pool, desc->image_pool_size);
-    size_t image_pool_byte_size = sizeof(_sg_image_t) * (size_t)p->image_pool.size;
-    p->images = (_sg_image_t*) _sg_malloc_clear(image_pool_byte_size);
+    _sg_pool_init(&p->image_pool, desc->image_pool_size, desc->growable_pools ? desc->image_pool_size : 0);
+    p->images = _sg_image_items_grow(0, 0, p->image_pool.size);
 
     SOKOL_ASSERT((desc->sampler_pool_size > 0) && (desc->sampler_pool_size < _SG_MAX_POOL_SIZE));
-    _sg_pool_init(&p->sampler_pool, desc->sampler_pool_size);
-    size_t sampler_pool_byte_size = sizeof(_sg_sampler_t) * (size_t)p->sampler_pool.size;
-    p->samplers = (_sg_sampler_t*) _sg_malloc_clear(sampler_pool_byte_size);
+    _sg_pool_init(&p->sampler_pool, desc->sampler_pool_size, desc->growable_pools ? desc->sampler_pool_size : 0);
+    p->samplers = _sg_sampler_items_grow(0, 0, p->sampler_pool.size);
 
     SOKOL_ASSERT((desc->shader_pool_size > 0) && (desc->shader_pool_size < _SG_MAX_POOL_SIZE));
-    _sg_pool_init(&p->shader_pool, desc->shader_pool_size);
-    size_t shader_pool_byte_size = sizeof(_sg_shader_t) * (size_t)p->shader_pool.size;
-    p->shaders = (_sg_shader_t*) _sg_malloc_clear(shader_pool_byte_size);
+    _sg_pool_init(&p->shader_pool, desc->shader_pool_size, desc->growable_pools ? desc->shader_pool_size : 0);
+    p->shaders = _sg_shader_items_grow(0, 0, p->shader_pool.size);
 
     SOKOL_ASSERT((desc->pipeline_pool_size > 0) && (desc->pipeline_pool_size < _SG_MAX_POOL_SIZE));
-    _sg_pool_init(&p->pipeline_pool, desc->pipeline_pool_size);
-    size_t pipeline_pool_byte_size = sizeof(_sg_pipeline_t) * (size_t)p->pipeline_pool.size;
-    p->pipelines = (_sg_pipeline_t*) _sg_malloc_clear(pipeline_pool_byte_size);
+    _sg_pool_init(&p->pipeline_pool, desc->pipeline_pool_size, desc->growable_pools ? desc->pipeline_pool_size : 0);
+    p->pipelines = _sg_pipeline_items_grow(0, 0, p->pipeline_pool.size);
 
     SOKOL_ASSERT((desc->attachments_pool_size > 0) && (desc->attachments_pool_size < _SG_MAX_POOL_SIZE));
-    _sg_pool_init(&p->attachments_pool, desc->attachments_pool_size);
-    size_t attachments_pool_byte_size = sizeof(_sg_attachments_t) * (size_t)p->attachments_pool.size;
-    p->attachments = (_sg_attachments_t*) _sg_malloc_clear(attachments_pool_byte_size);
+    _sg_pool_init(&p->attachments_pool, desc->attachments_pool_size, desc->growable_pools ? desc->attachments_pool_size : 0);
+    p->attachments = _sg_attachments_items_grow(0, 0, p->attachments_pool.size);
+
+    SOKOL_ASSERT((desc->bindgroup_pool_size > 0) && (desc->bindgroup_pool_size < _SG_MAX_POOL_SIZE));
+    _sg_pool_init(&p->bindgroup_pool, desc->bindgroup_pool_size, desc->growable_pools ? desc->bindgroup_pool_size : 0);
+    p->bindgroups = _sg_bindgroup_items_grow(0, 0, p->bindgroup_pool.size);
+
+    SOKOL_ASSERT((desc->command_list_pool_size > 0) && (desc->command_list_pool_size < _SG_MAX_POOL_SIZE));
+    _sg_pool_init(&p->command_list_pool, desc->command_list_pool_size, desc->growable_pools ? desc->command_list_pool_size : 0);
+    p->command_lists = _sg_command_list_items_grow(0, 0, p->command_list_pool.size);
+
+    SOKOL_ASSERT((desc->readback_pool_size > 0) && (desc->readback_pool_size < _SG_MAX_POOL_SIZE));
+    _sg_pool_init(&p->readback_pool, desc->readback_pool_size, desc->growable_pools ? desc->readback_pool_size : 0);
+    p->readbacks = _sg_readback_items_grow(0, 0, p->readback_pool.size);
 }
 
 _SOKOL_PRIVATE void _sg_discard_pools(_sg_pools_t* p) {
     SOKOL_ASSERT(p);
-    _sg_free(p->attachments); p->attachments = 0;
-    _sg_free(p->pipelines);   p->pipelines = 0;
-    _sg_free(p->shaders);     p->shaders = 0;
-    _sg_free(p->samplers);    p->samplers = 0;
-    _sg_free(p->images);      p->images = 0;
-    _sg_free(p->buffers);     p->buffers = 0;
+    _sg_readback_items_discard(&p->readback_pool, p->readbacks); p->readbacks = 0;
+    _sg_command_list_items_discard(&p->command_list_pool, p->command_lists); p->command_lists = 0;
+    _sg_bindgroup_items_discard(&p->bindgroup_pool, p->bindgroups); p->bindgroups = 0;
+    _sg_attachments_items_discard(&p->attachments_pool, p->attachments); p->attachments = 0;
+    _sg_pipeline_items_discard(&p->pipeline_pool, p->pipelines); p->pipelines = 0;
+    _sg_shader_items_discard(&p->shader_pool, p->shaders); p->shaders = 0;
+    _sg_sampler_items_discard(&p->sampler_pool, p->samplers); p->samplers = 0;
+    _sg_image_items_discard(&p->image_pool, p->images); p->images = 0;
+    _sg_buffer_items_discard(&p->buffer_pool, p->buffers); p->buffers = 0;
+    _sg_pool_discard(&p->readback_pool);
+    _sg_pool_discard(&p->command_list_pool);
+    _sg_pool_discard(&p->bindgroup_pool);
     _sg_pool_discard(&p->attachments_pool);
     _sg_pool_discard(&p->pipeline_pool);
     _sg_pool_discard(&p->shader_pool);
@@ -6927,42 +8641,63 @@ _SOKOL_PRIVATE _sg_buffer_t* _sg_buffer_at(uint32_t buf_id) {
     SOKOL_ASSERT(SG_INVALID_ID != buf_id);
     int slot_index = _sg_slot_index(buf_id);
     SOKOL_ASSERT((slot_index > _SG_INVALID_SLOT_INDEX) && (slot_index < _sg.pools.buffer_pool.size));
-    return &_sg.pools.buffers[slot_index];
+    return _sg.pools.buffers[slot_index];
 }
 
 _SOKOL_PRIVATE _sg_image_t* _sg_image_at(uint32_t img_id) {
     SOKOL_ASSERT(SG_INVALID_ID != img_id);
     int slot_index = _sg_slot_index(img_id);
     SOKOL_ASSERT((slot_index > _SG_INVALID_SLOT_INDEX) && (slot_index < _sg.pools.image_pool.size));
-    return &_sg.pools.images[slot_index];
+    return _sg.pools.images[slot_index];
 }
 
 _SOKOL_PRIVATE _sg_sampler_t* _sg_sampler_at(uint32_t smp_id) {
     SOKOL_ASSERT(SG_INVALID_ID != smp_id);
     int slot_index = _sg_slot_index(smp_id);
     SOKOL_ASSERT((slot_index > _SG_INVALID_SLOT_INDEX) && (slot_index < _sg.pools.sampler_pool.size));
-    return &_sg.pools.samplers[slot_index];
+    return _sg.pools.samplers[slot_index];
 }
 
 _SOKOL_PRIVATE _sg_shader_t* _sg_shader_at(uint32_t shd_id) {
     SOKOL_ASSERT(SG_INVALID_ID != shd_id);
     int slot_index = _sg_slot_index(shd_id);
     SOKOL_ASSERT((slot_index > _SG_INVALID_SLOT_INDEX) && (slot_index < _sg.pools.shader_pool.size));
-    return &_sg.pools.shaders[slot_index];
+    return _sg.pools.shaders[slot_index];
 }
 
 _SOKOL_PRIVATE _sg_pipeline_t* _sg_pipeline_at(uint32_t pip_id) {
     SOKOL_ASSERT(SG_INVALID_ID != pip_id);
     int slot_index = _sg_slot_index(pip_id);
     SOKOL_ASSERT((slot_index > _SG_INVALID_SLOT_INDEX) && (slot_index < _sg.pools.pipeline_pool.size));
-    return &_sg.pools.pipelines[slot_index];
+    return _sg.pools.pipelines[slot_index];
 }
 
 _SOKOL_PRIVATE _sg_attachments_t* _sg_attachments_at(uint32_t atts_id) {
     SOKOL_ASSERT(SG_INVALID_ID != atts_id);
     int slot_index = _sg_slot_index(atts_id);
     SOKOL_ASSERT((slot_index > _SG_INVALID_SLOT_INDEX) && (slot_index < _sg.pools.attachments_pool.size));
-    return &_sg.pools.attachments[slot_index];
+    return _sg.pools.attachments[slot_index];
+}
+
+_SOKOL_PRIVATE _sg_bindgroup_t* _sg_bindgroup_at(uint32_t bg_id) {
+    SOKOL_ASSERT(SG_INVALID_ID != bg_id);
+    int slot_index = _sg_slot_index(bg_id);
+    SOKOL_ASSERT((slot_index > _SG_INVALID_SLOT_INDEX) && (slot_index < _sg.pools.bindgroup_pool.size));
+    return _sg.pools.bindgroups[slot_index];
+}
+
+_SOKOL_PRIVATE _sg_command_list_t* _sg_command_list_at(uint32_t cl_id) {
+    SOKOL_ASSERT(SG_INVALID_ID != cl_id);
+    int slot_index = _sg_slot_index(cl_id);
+    SOKOL_ASSERT((slot_index > _SG_INVALID_SLOT_INDEX) && (slot_index < _sg.pools.command_list_pool.size));
+    return _sg.pools.command_lists[slot_index];
+}
+
+_SOKOL_PRIVATE _sg_readback_t* _sg_readback_at(uint32_t rb_id) {
+    SOKOL_ASSERT(SG_INVALID_ID != rb_id);
+    int slot_index = _sg_slot_index(rb_id);
+    SOKOL_ASSERT((slot_index > _SG_INVALID_SLOT_INDEX) && (slot_index < _sg.pools.readback_pool.size));
+    return _sg.pools.readbacks[slot_index];
 }
 
 // returns pointer to resource with matching id check, may return 0
@@ -7026,6 +8761,36 @@ _SOKOL_PRIVATE _sg_attachments_t* _sg_lookup_attachments(uint32_t atts_id) {
     return 0;
 }
 
+_SOKOL_PRIVATE _sg_bindgroup_t* _sg_lookup_bindgroup(uint32_t bg_id) {
+    if (SG_INVALID_ID != bg_id) {
+        _sg_bindgroup_t* bg = _sg_bindgroup_at(bg_id);
+        if (bg->slot.id == bg_id) {
+            return bg;
+        }
+    }
+    return 0;
+}
+
+_SOKOL_PRIVATE _sg_command_list_t* _sg_lookup_command_list(uint32_t cl_id) {
+    if (SG_INVALID_ID != cl_id) {
+        _sg_command_list_t* cl = _sg_command_list_at(cl_id);
+        if (cl->slot.id == cl_id) {
+            return cl;
+        }
+    }
+    return 0;
+}
+
+_SOKOL_PRIVATE _sg_readback_t* _sg_lookup_readback(uint32_t rb_id) {
+    if (SG_INVALID_ID != rb_id) {
+        _sg_readback_t* rb = _sg_readback_at(rb_id);
+        if (rb->slot.id == rb_id) {
+            return rb;
+        }
+    }
+    return 0;
+}
+
 // ██████  ███████ ███████ ███████
 // ██   ██ ██      ██      ██
 // ██████  █████   █████   ███████
@@ -7218,6 +8983,45 @@ _SOKOL_PRIVATE uint32_t _sg_align_u32(uint32_t val, uint32_t align) {
     return (val + (align - 1)) & ~(align - 1);
 }
 
+// MurmurHash64B (see: https://github.com/aappleby/smhasher/blob/61a0530f28277f2e850bfc39600ce61d02b518de/src/MurmurHash2.cpp#L142)
+_SOKOL_PRIVATE uint64_t _sg_hash(const void* key, int len, uint64_t seed) {
+    const uint32_t m = 0x5bd1e995;
+    const int r = 24;
+    uint32_t h1 = (uint32_t)seed ^ (uint32_t)len;
+    uint32_t h2 = (uint32_t)(seed >> 32);
+    const uint32_t * data = (const uint32_t *)key;
+    while (len >= 8) {
+        uint32_t k1 = *data++;
+        k1 *= m; k1 ^= k1 >> r; k1 *= m;
+        h1 *= m; h1 ^= k1;
+        len -= 4;
+        uint32_t k2 = *data++;
+        k2 *= m; k2 ^= k2 >> r; k2 *= m;
+        h2 *= m; h2 ^= k2;
+        len -= 4;
+    }
+    if (len >= 4) {
+        uint32_t k1 = *data++;
+        k1 *= m; k1 ^= k1 >> r; k1 *= m;
+        h1 *= m; h1 ^= k1;
+        len -= 4;
+    }
+    if (len > 0) {
+        const unsigned char* tail = (const unsigned char*)data;
+        if (len >= 3) { h2 ^= (uint32_t)(tail[2] << 16); }
+        if (len >= 2) { h2 ^= (uint32_t)(tail[1] << 8); }
+        h2 ^= tail[0];
+        h2 *= m;
+    }
+    h1 ^= h2 >> 18; h1 *= m;
+    h2 ^= h1 >> 22; h2 *= m;
+    h1 ^= h2 >> 17; h1 *= m;
+    h2 ^= h1 >> 19; h2 *= m;
+    uint64_t h = h1;
+    h = (h << 32) | h2;
+    return h;
+}
+
 typedef struct { int x, y, w, h; } _sg_recti_t;
 
 _SOKOL_PRIVATE _sg_recti_t _sg_clipi(int x, int y, int w, int h, int clip_width, int clip_height) {
@@ -7241,23 +9045,31 @@ _SOKOL_PRIVATE void _sg_buffer_common_init(_sg_buffer_common_t* cmn, const sg_bu
     cmn->append_overflow = false;
     cmn->update_frame_index = 0;
     cmn->append_frame_index = 0;
-    cmn->num_slots = desc->usage.immutable ? 1 : SG_NUM_INFLIGHT_FRAMES;
+    cmn->bind_frame_index = 0;
+    cmn->num_slots = desc->num_update_slots;
     cmn->active_slot = 0;
+    cmn->update_mode = desc->update_mode;
     cmn->usage = desc->usage;
+    cmn->mem_size = 0;
 }
 
 _SOKOL_PRIVATE void _sg_image_common_init(_sg_image_common_t* cmn, const sg_image_desc* desc) {
     cmn->upd_frame_index = 0;
-    cmn->num_slots = desc->usage.immutable ? 1 : SG_NUM_INFLIGHT_FRAMES;
+    cmn->bind_frame_index = 0;
+    cmn->num_slots = desc->num_update_slots;
     cmn->active_slot = 0;
+    cmn->update_mode = desc->update_mode;
     cmn->type = desc->type;
     cmn->width = desc->width;
     cmn->height = desc->height;
     cmn->num_slices = desc->num_slices;
     cmn->num_mipmaps = desc->num_mipmaps;
+    cmn->generate_mipmaps = desc->generate_mipmaps;
+    cmn->mipmaps_pending = false;
     cmn->usage = desc->usage;
     cmn->pixel_format = desc->pixel_format;
     cmn->sample_count = desc->sample_count;
+    cmn->mem_size = 0;
 }
 
 _SOKOL_PRIVATE void _sg_sampler_common_init(_sg_sampler_common_t* cmn, const sg_sampler_desc* desc) {
@@ -7844,6 +9656,17 @@ _SOKOL_PRIVATE int _sg_miplevel_dim(int base_dim, int mip_level) {
     return _sg_max(base_dim >> mip_level, 1);
 }
 
+// return number of mipmap levels in a complete mip chain (clamped to SG_MAX_MIPMAPS)
+_SOKOL_PRIVATE int _sg_num_mipmaps_for_dims(int width, int height, int depth) {
+    int max_dim = _sg_max(_sg_max(width, height), depth);
+    int num_mips = 1;
+    while ((max_dim > 1) && (num_mips < SG_MAX_MIPMAPS)) {
+        max_dim >>= 1;
+        num_mips++;
+    }
+    return num_mips;
+}
+
 /* return pitch of a 2D subimage / texture slice
     see ComputePitch in https://github.com/microsoft/DirectXTex/blob/master/DirectXTex/DirectXTexUtil.cpp
 */
@@ -7991,13 +9814,108 @@ _SOKOL_PRIVATE void _sg_dummy_discard_backend(void) {
 }
 
 _SOKOL_PRIVATE void _sg_dummy_reset_state_cache(void) {
-    // empty
+    _sg_clear(&_sg.dummy.cache, sizeof(_sg.dummy.cache));
+}
+
+// returns true if the cached binding had to be updated (e.g. the bind wasn't redundant)
+_SOKOL_PRIVATE bool _sg_dummy_cache_bind(_sg_dummy_cache_binding_t* cache, uint32_t id, int active_slot, int offset) {
+    if ((cache->id == id) && (cache->active_slot == active_slot) && (cache->offset == offset)) {
+        return false;
+    }
+    cache->id = id;
+    cache->active_slot = active_slot;
+    cache->offset = offset;
+    return true;
+}
+
+_SOKOL_PRIVATE bool _sg_dummy_cache_rect(_sg_dummy_cache_rect_t* cache, int x, int y, int w, int h, bool origin_top_left) {
+    if (cache->valid && (cache->x == x) && (cache->y == y) && (cache->w == w) && (cache->h == h) && (cache->origin_top_left == origin_top_left)) {
+        return false;
+    }
+    cache->valid = true;
+    cache->x = x;
+    cache->y = y;
+    cache->w = w;
+    cache->h = h;
+    cache->origin_top_left = origin_top_left;
+    return true;
+}
+
+_SOKOL_PRIVATE bool _sg_dummy_depth_state_equal(const sg_depth_state* a, const sg_depth_state* b) {
+    return (a->compare == b->compare)
+        && (a->write_enabled == b->write_enabled)
+        && (a->bias == b->bias)
+        && (a->bias_slope_scale == b->bias_slope_scale)
+        && (a->bias_clamp == b->bias_clamp);
+}
+
+_SOKOL_PRIVATE bool _sg_dummy_stencil_face_state_equal(const sg_stencil_face_state* a, const sg_stencil_face_state* b) {
+    return (a->compare == b->compare)
+        && (a->fail_op == b->fail_op)
+        && (a->depth_fail_op == b->depth_fail_op)
+        && (a->pass_op == b->pass_op);
+}
+
+_SOKOL_PRIVATE bool _sg_dummy_stencil_state_equal(const sg_stencil_state* a, const sg_stencil_state* b) {
+    return (a->enabled == b->enabled)
+        && _sg_dummy_stencil_face_state_equal(&a->front, &b->front)
+        && _sg_dummy_stencil_face_state_equal(&a->back, &b->back)
+        && (a->read_mask == b->read_mask)
+        && (a->write_mask == b->write_mask)
+        && (a->ref == b->ref);
+}
+
+_SOKOL_PRIVATE bool _sg_dummy_blend_state_equal(const _sg_pipeline_common_t* a, const _sg_pipeline_common_t* b) {
+    if ((a->color_count != b->color_count)
+        || (a->blend_color.r != b->blend_color.r)
+        || (a->blend_color.g != b->blend_color.g)
+        || (a->blend_color.b != b->blend_color.b)
+        || (a->blend_color.a != b->blend_color.a))
+    {
+        return false;
+    }
+    for (int i = 0; i < a->color_count; i++) {
+        const sg_color_target_state* ca = &a->colors[i];
+        const sg_color_target_state* cb = &b->colors[i];
+        if ((ca->write_mask != cb->write_mask)
+            || (ca->blend.enabled != cb->blend.enabled)
+            || (ca->blend.src_factor_rgb != cb->blend.src_factor_rgb)
+            || (ca->blend.dst_factor_rgb != cb->blend.dst_factor_rgb)
+            || (ca->blend.op_rgb != cb->blend.op_rgb)
+            || (ca->blend.src_factor_alpha != cb->blend.src_factor_alpha)
+            || (ca->blend.dst_factor_alpha != cb->blend.dst_factor_alpha)
+            || (ca->blend.op_alpha != cb->blend.op_alpha))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+_SOKOL_PRIVATE bool _sg_dummy_rasterizer_state_equal(const _sg_pipeline_common_t* a, const _sg_pipeline_common_t* b) {
+    return (a->cull_mode == b->cull_mode)
+        && (a->face_winding == b->face_winding)
+        && (a->sample_count == b->sample_count)
+        && (a->alpha_to_coverage_enabled == b->alpha_to_coverage_enabled);
+}
+
+_SOKOL_PRIVATE uint32_t _sg_dummy_image_data_size(const sg_image_data* data) {
+    uint32_t size = 0;
+    for (int face_index = 0; face_index < SG_CUBEFACE_NUM; face_index++) {
+        for (int mip_index = 0; mip_index < SG_MAX_MIPMAPS; mip_index++) {
+            size += (uint32_t)data->subimage[face_index][mip_index].size;
+        }
+    }
+    return size;
 }
 
 _SOKOL_PRIVATE sg_resource_state _sg_dummy_create_buffer(_sg_buffer_t* buf, const sg_buffer_desc* desc) {
     SOKOL_ASSERT(buf && desc);
     _SOKOL_UNUSED(buf);
-    _SOKOL_UNUSED(desc);
+    if (desc->data.ptr) {
+        _sg_stats_add(dummy.num_upload_buffer, 1);
+        _sg_stats_add(dummy.size_upload_buffer, (uint32_t)desc->data.size);
+    }
     return SG_RESOURCESTATE_VALID;
 }
 
@@ -8009,7 +9927,11 @@ _SOKOL_PRIVATE void _sg_dummy_discard_buffer(_sg_buffer_t* buf) {
 _SOKOL_PRIVATE sg_resource_state _sg_dummy_create_image(_sg_image_t* img, const sg_image_desc* desc) {
     SOKOL_ASSERT(img && desc);
     _SOKOL_UNUSED(img);
-    _SOKOL_UNUSED(desc);
+    const uint32_t size = _sg_dummy_image_data_size(&desc->data);
+    if (size > 0) {
+        _sg_stats_add(dummy.num_upload_image, 1);
+        _sg_stats_add(dummy.size_upload_image, size);
+    }
     return SG_RESOURCESTATE_VALID;
 }
 
@@ -8069,6 +9991,17 @@ _SOKOL_PRIVATE void _sg_dummy_discard_attachments(_sg_attachments_t* atts) {
 _SOKOL_PRIVATE void _sg_dummy_begin_pass(const sg_pass* pass) {
     SOKOL_ASSERT(pass);
     _SOKOL_UNUSED(pass);
+    if (!_sg.cur_pass.is_compute) {
+        // like the GL backend, set viewport and scissor rect to the full framebuffer
+        const int w = _sg.cur_pass.width;
+        const int h = _sg.cur_pass.height;
+        if (_sg_dummy_cache_rect(&_sg.dummy.cache.viewport, 0, 0, w, h, true)) {
+            _sg_stats_add(dummy.num_set_viewport, 1);
+        }
+        if (_sg_dummy_cache_rect(&_sg.dummy.cache.scissor_rect, 0, 0, w, h, true)) {
+            _sg_stats_add(dummy.num_set_scissor_rect, 1);
+        }
+    }
 }
 
 _SOKOL_PRIVATE void _sg_dummy_end_pass(void) {
@@ -8079,76 +10012,240 @@ _SOKOL_PRIVATE void _sg_dummy_commit(void) {
     // empty
 }
 
-_SOKOL_PRIVATE void _sg_dummy_apply_viewport(int x, int y, int w, int h, bool origin_top_left) {
-    _SOKOL_UNUSED(x);
-    _SOKOL_UNUSED(y);
-    _SOKOL_UNUSED(w);
-    _SOKOL_UNUSED(h);
-    _SOKOL_UNUSED(origin_top_left);
-}
-
-_SOKOL_PRIVATE void _sg_dummy_apply_scissor_rect(int x, int y, int w, int h, bool origin_top_left) {
-    _SOKOL_UNUSED(x);
-    _SOKOL_UNUSED(y);
-    _SOKOL_UNUSED(w);
-    _SOKOL_UNUSED(h);
-    _SOKOL_UNUSED(origin_top_left);
-}
-
-_SOKOL_PRIVATE void _sg_dummy_apply_pipeline(_sg_pipeline_t* pip) {
-    SOKOL_ASSERT(pip);
-    _SOKOL_UNUSED(pip);
-}
-
-_SOKOL_PRIVATE bool _sg_dummy_apply_bindings(_sg_bindings_ptrs_t* bnd) {
-    SOKOL_ASSERT(bnd);
-    SOKOL_ASSERT(bnd->pip);
-    _SOKOL_UNUSED(bnd);
-    return true;
+_SOKOL_PRIVATE sg_resource_state _sg_dummy_create_image_readback(_sg_readback_t* rb, _sg_image_t* img, const sg_image_region* region) {
+    SOKOL_ASSERT(rb && img && region);
+    _SOKOL_UNUSED(rb);
+    _SOKOL_UNUSED(img);
+    _SOKOL_UNUSED(region);
+    return SG_RESOURCESTATE_VALID;
 }
 
-_SOKOL_PRIVATE void _sg_dummy_apply_uniforms(int ub_slot, const sg_range* data) {
-    _SOKOL_UNUSED(ub_slot);
-    _SOKOL_UNUSED(data);
+_SOKOL_PRIVATE sg_resource_state _sg_dummy_create_buffer_readback(_sg_readback_t* rb, _sg_buffer_t* buf, int offset) {
+    SOKOL_ASSERT(rb && buf);
+    _SOKOL_UNUSED(rb);
+    _SOKOL_UNUSED(buf);
+    _SOKOL_UNUSED(offset);
+    return SG_RESOURCESTATE_VALID;
 }
 
-_SOKOL_PRIVATE void _sg_dummy_draw(int base_element, int num_elements, int num_instances) {
-    _SOKOL_UNUSED(base_element);
-    _SOKOL_UNUSED(num_elements);
-    _SOKOL_UNUSED(num_instances);
+// the dummy backend has no resource content, readbacks complete in the next sg_commit() with zeroed data
+_SOKOL_PRIVATE void _sg_dummy_poll_readback(_sg_readback_t* rb) {
+    SOKOL_ASSERT(rb && rb->cmn.data.ptr);
+    _sg_clear((void*)rb->cmn.data.ptr, (size_t)rb->cmn.size);
+    rb->cmn.completed = true;
 }
 
-_SOKOL_PRIVATE void _sg_dummy_dispatch(int num_groups_x, int num_groups_y, int num_groups_z) {
-    _SOKOL_UNUSED(num_groups_x);
-    _SOKOL_UNUSED(num_groups_y);
-    _SOKOL_UNUSED(num_groups_z);
+_SOKOL_PRIVATE void _sg_dummy_discard_readback(_sg_readback_t* rb) {
+    SOKOL_ASSERT(rb);
+    _SOKOL_UNUSED(rb);
 }
 
-_SOKOL_PRIVATE void _sg_dummy_update_buffer(_sg_buffer_t* buf, const sg_range* data) {
-    SOKOL_ASSERT(buf && data && data->ptr && (data->size > 0));
-    _SOKOL_UNUSED(data);
-    if (++buf->cmn.active_slot >= buf->cmn.num_slots) {
-        buf->cmn.active_slot = 0;
+_SOKOL_PRIVATE void _sg_dummy_apply_viewport(int x, int y, int w, int h, bool origin_top_left) {
+    if (_sg_dummy_cache_rect(&_sg.dummy.cache.viewport, x, y, w, h, origin_top_left)) {
+        _sg_stats_add(dummy.num_set_viewport, 1);
+    } else {
+        _sg_stats_add(dummy.num_skip_redundant_viewport, 1);
     }
 }
 
-_SOKOL_PRIVATE bool _sg_dummy_append_buffer(_sg_buffer_t* buf, const sg_range* data, bool new_frame) {
-    SOKOL_ASSERT(buf && data && data->ptr && (data->size > 0));
-    _SOKOL_UNUSED(data);
-    if (new_frame) {
-        if (++buf->cmn.active_slot >= buf->cmn.num_slots) {
-            buf->cmn.active_slot = 0;
-        }
+_SOKOL_PRIVATE void _sg_dummy_apply_scissor_rect(int x, int y, int w, int h, bool origin_top_left) {
+    if (_sg_dummy_cache_rect(&_sg.dummy.cache.scissor_rect, x, y, w, h, origin_top_left)) {
+        _sg_stats_add(dummy.num_set_scissor_rect, 1);
+    } else {
+        _sg_stats_add(dummy.num_skip_redundant_scissor_rect, 1);
     }
-    return true;
+}
+
+_SOKOL_PRIVATE void _sg_dummy_apply_pipeline(_sg_pipeline_t* pip) {
+    SOKOL_ASSERT(pip);
+    _sg_dummy_state_cache_t* cache = &_sg.dummy.cache;
+    if (cache->cur_pip_id == pip->slot.id) {
+        _sg_stats_add(dummy.num_skip_redundant_pipeline, 1);
+        return;
+    }
+    _sg_stats_add(dummy.num_set_pipeline, 1);
+    cache->cur_pip_id = pip->slot.id;
+    cache->cur_pip_indexed = pip->cmn.index_type != SG_INDEXTYPE_NONE;
+    if (pip->cmn.is_compute) {
+        return;
+    }
+    const _sg_pipeline_common_t* cur = &cache->render_state;
+    const _sg_pipeline_common_t* next = &pip->cmn;
+    if (!cache->render_state_valid || !_sg_dummy_depth_state_equal(&cur->depth, &next->depth)) {
+        _sg_stats_add(dummy.num_set_render_state, 1);
+    }
+    if (!cache->render_state_valid || !_sg_dummy_stencil_state_equal(&cur->stencil, &next->stencil)) {
+        _sg_stats_add(dummy.num_set_render_state, 1);
+    }
+    if (!cache->render_state_valid || !_sg_dummy_blend_state_equal(cur, next)) {
+        _sg_stats_add(dummy.num_set_render_state, 1);
+    }
+    if (!cache->render_state_valid || !_sg_dummy_rasterizer_state_equal(cur, next)) {
+        _sg_stats_add(dummy.num_set_render_state, 1);
+    }
+    cache->render_state = pip->cmn;
+    cache->render_state_valid = true;
+}
+
+_SOKOL_PRIVATE bool _sg_dummy_apply_bindings(_sg_bindings_ptrs_t* bnd) {
+    SOKOL_ASSERT(bnd);
+    SOKOL_ASSERT(bnd->pip);
+    _sg_dummy_state_cache_t* cache = &_sg.dummy.cache;
+    for (size_t i = 0; i < SG_MAX_VERTEXBUFFER_BINDSLOTS; i++) {
+        const _sg_buffer_t* vb = bnd->vbs[i];
+        if (vb == 0) {
+            continue;
+        }
+        if (_sg_dummy_cache_bind(&cache->vbs[i], vb->slot.id, vb->cmn.active_slot, bnd->vb_offsets[i])) {
+            _sg_stats_add(dummy.num_bind_vertex_buffer, 1);
+        } else {
+            _sg_stats_add(dummy.num_skip_redundant_vertex_buffer, 1);
+        }
+    }
+    if (bnd->ib) {
+        if (_sg_dummy_cache_bind(&cache->ib, bnd->ib->slot.id, bnd->ib->cmn.active_slot, bnd->ib_offset)) {
+            _sg_stats_add(dummy.num_bind_index_buffer, 1);
+        } else {
+            _sg_stats_add(dummy.num_skip_redundant_index_buffer, 1);
+        }
+    }
+    for (size_t i = 0; i < SG_MAX_IMAGE_BINDSLOTS; i++) {
+        const _sg_image_t* img = bnd->imgs[i];
+        if (img == 0) {
+            continue;
+        }
+        if (_sg_dummy_cache_bind(&cache->imgs[i], img->slot.id, img->cmn.active_slot, 0)) {
+            _sg_stats_add(dummy.num_bind_image, 1);
+        } else {
+            _sg_stats_add(dummy.num_skip_redundant_image, 1);
+        }
+    }
+    for (size_t i = 0; i < SG_MAX_SAMPLER_BINDSLOTS; i++) {
+        const _sg_sampler_t* smp = bnd->smps[i];
+        if (smp == 0) {
+            continue;
+        }
+        if (cache->smp_ids[i] != smp->slot.id) {
+            cache->smp_ids[i] = smp->slot.id;
+            _sg_stats_add(dummy.num_bind_sampler, 1);
+        } else {
+            _sg_stats_add(dummy.num_skip_redundant_sampler, 1);
+        }
+    }
+    for (size_t i = 0; i < SG_MAX_STORAGEBUFFER_BINDSLOTS; i++) {
+        const _sg_buffer_t* sbuf = bnd->sbufs[i];
+        if (sbuf == 0) {
+            continue;
+        }
+        if (_sg_dummy_cache_bind(&cache->sbufs[i], sbuf->slot.id, sbuf->cmn.active_slot, 0)) {
+            _sg_stats_add(dummy.num_bind_storage_buffer, 1);
+        } else {
+            _sg_stats_add(dummy.num_skip_redundant_storage_buffer, 1);
+        }
+    }
+    for (size_t i = 0; i < SG_MAX_STORAGE_ATTACHMENTS; i++) {
+        const _sg_image_t* simg = bnd->simgs[i];
+        if (simg == 0) {
+            continue;
+        }
+        if (cache->simg_ids[i] != simg->slot.id) {
+            cache->simg_ids[i] = simg->slot.id;
+            _sg_stats_add(dummy.num_bind_storage_image, 1);
+        } else {
+            _sg_stats_add(dummy.num_skip_redundant_storage_image, 1);
+        }
+    }
+    return true;
+}
+
+_SOKOL_PRIVATE void _sg_dummy_apply_uniforms(int ub_slot, const sg_range* data) {
+    _SOKOL_UNUSED(ub_slot);
+    _sg_stats_add(dummy.num_uniform, 1);
+    _sg_stats_add(dummy.size_uniform, (uint32_t)data->size);
+}
+
+_SOKOL_PRIVATE void _sg_dummy_draw(int base_element, int num_elements, int num_instances) {
+    _SOKOL_UNUSED(base_element);
+    _sg_stats_add(dummy.num_draw, 1);
+    if (_sg.dummy.cache.cur_pip_indexed) {
+        _sg_stats_add(dummy.num_draw_indexed, 1);
+    }
+    if (num_instances > 1) {
+        _sg_stats_add(dummy.num_draw_instanced, 1);
+    }
+    _sg_stats_add(dummy.num_elements, (uint32_t)num_elements);
+    _sg_stats_add(dummy.num_instances, (uint32_t)num_instances);
+}
+
+_SOKOL_PRIVATE void _sg_dummy_draw_indirect(_sg_buffer_t* buf, int offset) {
+    SOKOL_ASSERT(buf);
+    _SOKOL_UNUSED(buf);
+    _SOKOL_UNUSED(offset);
+    _sg_stats_add(dummy.num_draw, 1);
+    _sg_stats_add(dummy.num_draw_indirect, 1);
+    if (_sg.dummy.cache.cur_pip_indexed) {
+        _sg_stats_add(dummy.num_draw_indexed, 1);
+    }
+}
+
+_SOKOL_PRIVATE void _sg_dummy_dispatch(int num_groups_x, int num_groups_y, int num_groups_z) {
+    _SOKOL_UNUSED(num_groups_x);
+    _SOKOL_UNUSED(num_groups_y);
+    _SOKOL_UNUSED(num_groups_z);
+    _sg_stats_add(dummy.num_dispatch, 1);
+}
+
+_SOKOL_PRIVATE void _sg_dummy_update_buffer(_sg_buffer_t* buf, const sg_range* data) {
+    SOKOL_ASSERT(buf && data && data->ptr && (data->size > 0));
+    if (++buf->cmn.active_slot >= buf->cmn.num_slots) {
+        buf->cmn.active_slot = 0;
+    }
+    _sg_stats_add(dummy.num_upload_buffer, 1);
+    _sg_stats_add(dummy.size_upload_buffer, (uint32_t)data->size);
+}
+
+_SOKOL_PRIVATE bool _sg_dummy_append_buffer(_sg_buffer_t* buf, const sg_range* data, bool new_frame) {
+    SOKOL_ASSERT(buf && data && data->ptr && (data->size > 0));
+    if (new_frame) {
+        if (++buf->cmn.active_slot >= buf->cmn.num_slots) {
+            buf->cmn.active_slot = 0;
+        }
+    }
+    _sg_stats_add(dummy.num_upload_buffer, 1);
+    _sg_stats_add(dummy.size_upload_buffer, (uint32_t)data->size);
+    return true;
 }
 
 _SOKOL_PRIVATE void _sg_dummy_update_image(_sg_image_t* img, const sg_image_data* data) {
     SOKOL_ASSERT(img && data);
-    _SOKOL_UNUSED(data);
     if (++img->cmn.active_slot >= img->cmn.num_slots) {
         img->cmn.active_slot = 0;
     }
+    _sg_stats_add(dummy.num_upload_image, 1);
+    _sg_stats_add(dummy.size_upload_image, _sg_dummy_image_data_size(data));
+}
+
+_SOKOL_PRIVATE void _sg_dummy_update_buffer_range(_sg_buffer_t* buf, int offset, const sg_range* data, bool new_frame) {
+    SOKOL_ASSERT(buf && data && data->ptr && (data->size > 0));
+    _SOKOL_UNUSED(buf);
+    _SOKOL_UNUSED(offset);
+    _SOKOL_UNUSED(new_frame);
+    _sg_stats_add(dummy.num_upload_buffer, 1);
+    _sg_stats_add(dummy.size_upload_buffer, (uint32_t)data->size);
+}
+
+_SOKOL_PRIVATE void _sg_dummy_update_image_region(_sg_image_t* img, const sg_image_region* region, const sg_range* data, bool new_frame) {
+    SOKOL_ASSERT(img && region && data && data->ptr);
+    _SOKOL_UNUSED(img);
+    _SOKOL_UNUSED(region);
+    _SOKOL_UNUSED(new_frame);
+    _sg_stats_add(dummy.num_upload_image, 1);
+    _sg_stats_add(dummy.size_upload_image, (uint32_t)data->size);
+}
+
+_SOKOL_PRIVATE void _sg_dummy_generate_mipmaps(_sg_image_t* img) {
+    SOKOL_ASSERT(img && img->cmn.generate_mipmaps);
+    _SOKOL_UNUSED(img);
 }
 
 //  ██████  ██████  ███████ ███    ██  ██████  ██          ██████   █████   ██████ ██   ██ ███████ ███    ██ ██████
@@ -8207,6 +10304,13 @@ _SOKOL_PRIVATE void _sg_dummy_update_image(_sg_image_t* img, const sg_image_data
     _SG_XMACRO(glDrawBuffers,                     void, (GLsizei n, const GLenum * bufs)) \
     _SG_XMACRO(glVertexAttribDivisor,             void, (GLuint index, GLuint divisor)) \
     _SG_XMACRO(glBufferSubData,                   void, (GLenum target, GLintptr offset, GLsizeiptr size, const void * data)) \
+    _SG_XMACRO(glMapBufferRange,                  void *, (GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access)) \
+    _SG_XMACRO(glUnmapBuffer,                     GLboolean, (GLenum target)) \
+    _SG_XMACRO(glFenceSync,                       GLsync, (GLenum condition, GLbitfield flags)) \
+    _SG_XMACRO(glClientWaitSync,                  GLenum, (GLsync sync, GLbitfield flags, GLuint64 timeout)) \
+    _SG_XMACRO(glDeleteSync,                      void, (GLsync sync)) \
+    _SG_XMACRO(glReadPixels,                      void, (GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void * data)) \
+    _SG_XMACRO(glCopyBufferSubData,               void, (GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size)) \
     _SG_XMACRO(glGenBuffers,                      void, (GLsizei n, GLuint * buffers)) \
     _SG_XMACRO(glCheckFramebufferStatus,          GLenum, (GLenum target)) \
     _SG_XMACRO(glFramebufferRenderbuffer,         void, (GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer)) \
@@ -8285,7 +10389,15 @@ _SOKOL_PRIVATE void _sg_dummy_update_image(_sg_image_t* img, const sg_image_data
     _SG_XMACRO(glTexStorage3DMultisample,         void, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations)) \
     _SG_XMACRO(glTexStorage3D,                    void, (GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth)) \
     _SG_XMACRO(glCompressedTexSubImage2D,         void, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data)) \
-    _SG_XMACRO(glCompressedTexSubImage3D,         void, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data))
+    _SG_XMACRO(glCompressedTexSubImage3D,         void, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data)) \
+    _SG_XMACRO(glGenQueries,                      void, (GLsizei n, GLuint * ids)) \
+    _SG_XMACRO(glDeleteQueries,                   void, (GLsizei n, const GLuint * ids)) \
+    _SG_XMACRO(glQueryCounter,                    void, (GLuint id, GLenum target)) \
+    _SG_XMACRO(glGetQueryObjectiv,                void, (GLuint id, GLenum pname, GLint * params)) \
+    _SG_XMACRO(glGetQueryObjectui64v,             void, (GLuint id, GLenum pname, GLuint64 * params)) \
+    _SG_XMACRO(glDrawArraysIndirect,              void, (GLenum mode, const void * indirect)) \
+    _SG_XMACRO(glDrawElementsIndirect,            void, (GLenum mode, GLenum type, const void * indirect)) \
+    _SG_XMACRO(glGenerateMipmap,                  void, (GLenum target))
 
 // generate GL function pointer typedefs
 #define _SG_XMACRO(name, ret, args) typedef ret (GL_APIENTRY* PFN_ ## name) args;
@@ -8340,6 +10452,8 @@ _SOKOL_PRIVATE GLenum _sg_gl_buffer_target(const sg_buffer_usage* usg) {
         return GL_ELEMENT_ARRAY_BUFFER;
     } else if (usg->storage_buffer) {
         return GL_SHADER_STORAGE_BUFFER;
+    } else if (usg->indirect_buffer) {
+        return GL_DRAW_INDIRECT_BUFFER;
     } else {
         SOKOL_UNREACHABLE; return 0;
     }
@@ -9067,6 +11181,8 @@ _SOKOL_PRIVATE void _sg_gl_init_caps_glcore(void) {
     _sg.features.mrt_independent_blend_state = false;
     _sg.features.mrt_independent_write_mask = true;
     _sg.features.compute = version >= 430;
+    _sg.features.draw_indirect = _sg.features.compute;
+    _sg.features.gpu_timings = version >= 330;
     #if defined(__APPLE__)
     _sg.features.msaa_image_bindings = false;
     #else
@@ -9147,6 +11263,7 @@ _SOKOL_PRIVATE void _sg_gl_init_caps_gles3(void) {
     _sg.features.mrt_independent_blend_state = false;
     _sg.features.mrt_independent_write_mask = false;
     _sg.features.compute = version >= 310;
+    _sg.features.draw_indirect = _sg.features.compute;
     _sg.features.msaa_image_bindings = false;
     #if defined(__EMSCRIPTEN__)
     _sg.features.separate_buffer_types = true;
@@ -9264,10 +11381,17 @@ _SOKOL_PRIVATE void _sg_gl_cache_clear_buffer_bindings(bool force) {
             _sg_stats_add(gl.num_bind_buffer, 1);
         }
     }
+    if (force || (_sg.gl.cache.indirect_buffer != 0)) {
+        if (_sg.features.draw_indirect) {
+            glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+        }
+        _sg.gl.cache.indirect_buffer = 0;
+        _sg_stats_add(gl.num_bind_buffer, 1);
+    }
 }
 
 _SOKOL_PRIVATE void _sg_gl_cache_bind_buffer(GLenum target, GLuint buffer) {
-    SOKOL_ASSERT((GL_ARRAY_BUFFER == target) || (GL_ELEMENT_ARRAY_BUFFER == target) || (GL_SHADER_STORAGE_BUFFER == target));
+    SOKOL_ASSERT((GL_ARRAY_BUFFER == target) || (GL_ELEMENT_ARRAY_BUFFER == target) || (GL_SHADER_STORAGE_BUFFER == target) || (GL_DRAW_INDIRECT_BUFFER == target));
     if (target == GL_ARRAY_BUFFER) {
         if (_sg.gl.cache.vertex_buffer != buffer) {
             _sg.gl.cache.vertex_buffer = buffer;
@@ -9288,6 +11412,14 @@ _SOKOL_PRIVATE void _sg_gl_cache_bind_buffer(GLenum target, GLuint buffer) {
             }
             _sg_stats_add(gl.num_bind_buffer, 1);
         }
+    } else if (target == GL_DRAW_INDIRECT_BUFFER) {
+        if (_sg.gl.cache.indirect_buffer != buffer) {
+            _sg.gl.cache.indirect_buffer = buffer;
+            if (_sg.features.draw_indirect) {
+                glBindBuffer(target, buffer);
+            }
+            _sg_stats_add(gl.num_bind_buffer, 1);
+        }
     } else {
         SOKOL_UNREACHABLE;
     }
@@ -9305,13 +11437,36 @@ _SOKOL_PRIVATE void _sg_gl_cache_bind_storage_buffer(uint8_t glsl_binding_n, GLu
     }
 }
 
+_SOKOL_PRIVATE void _sg_gl_cache_bind_vao(GLuint vao, GLuint ib) {
+    if (_sg.gl.cache.vao != vao) {
+        _sg.gl.cache.vao = vao;
+        glBindVertexArray(vao);
+        _sg_stats_add(gl.num_bind_vertex_array, 1);
+        // the index buffer binding is part of the VAO state
+        _sg.gl.cache.index_buffer = ib;
+    }
+}
+
+_SOKOL_PRIVATE void _sg_gl_cache_bind_default_vao(void) {
+    _sg_gl_cache_bind_vao(_sg.gl.vao, 0);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    _sg_stats_add(gl.num_bind_buffer, 1);
+}
+
 _SOKOL_PRIVATE void _sg_gl_cache_store_buffer_binding(GLenum target) {
     if (target == GL_ARRAY_BUFFER) {
         _sg.gl.cache.stored_vertex_buffer = _sg.gl.cache.vertex_buffer;
     } else if (target == GL_ELEMENT_ARRAY_BUFFER) {
         _sg.gl.cache.stored_index_buffer = _sg.gl.cache.index_buffer;
+        // don't clobber the index buffer binding of a cached VAO
+        _sg.gl.cache.stored_vao = _sg.gl.cache.vao;
+        if (_sg.gl.cache.vao != _sg.gl.vao) {
+            _sg_gl_cache_bind_default_vao();
+        }
     } else if (target == GL_SHADER_STORAGE_BUFFER) {
         _sg.gl.cache.stored_storage_buffer = _sg.gl.cache.storage_buffer;
+    } else if (target == GL_DRAW_INDIRECT_BUFFER) {
+        _sg.gl.cache.stored_indirect_buffer = _sg.gl.cache.indirect_buffer;
     } else {
         SOKOL_UNREACHABLE;
     }
@@ -9325,24 +11480,367 @@ _SOKOL_PRIVATE void _sg_gl_cache_restore_buffer_binding(GLenum target) {
             _sg.gl.cache.stored_vertex_buffer = 0;
         }
     } else if (target == GL_ELEMENT_ARRAY_BUFFER) {
-        if (_sg.gl.cache.stored_index_buffer != 0) {
+        if ((_sg.gl.cache.stored_vao != 0) && (_sg.gl.cache.stored_vao != _sg.gl.cache.vao)) {
+            _sg_gl_cache_bind_vao(_sg.gl.cache.stored_vao, _sg.gl.cache.stored_index_buffer);
+        } else if (_sg.gl.cache.stored_index_buffer != 0) {
             // we only care about restoring valid ids
             _sg_gl_cache_bind_buffer(target, _sg.gl.cache.stored_index_buffer);
-            _sg.gl.cache.stored_index_buffer = 0;
         }
+        _sg.gl.cache.stored_index_buffer = 0;
+        _sg.gl.cache.stored_vao = 0;
     } else if (target == GL_SHADER_STORAGE_BUFFER) {
         if (_sg.gl.cache.stored_storage_buffer != 0) {
             // we only care about restoring valid ids
             _sg_gl_cache_bind_buffer(target, _sg.gl.cache.stored_storage_buffer);
             _sg.gl.cache.stored_storage_buffer = 0;
         }
+    } else if (target == GL_DRAW_INDIRECT_BUFFER) {
+        if (_sg.gl.cache.stored_indirect_buffer != 0) {
+            // we only care about restoring valid ids
+            _sg_gl_cache_bind_buffer(target, _sg.gl.cache.stored_indirect_buffer);
+            _sg.gl.cache.stored_indirect_buffer = 0;
+        }
     } else {
         SOKOL_UNREACHABLE;
     }
 }
 
+_SOKOL_PRIVATE void _sg_gl_vao_cache_discard_item(_sg_gl_vao_cache_item_t* item) {
+    SOKOL_ASSERT(item && (0 != item->vao));
+    if (_sg.gl.cache.vao == item->vao) {
+        // deleting a bound VAO reverts to VAO 0, switch back to the default VAO instead
+        _sg_gl_cache_bind_default_vao();
+    }
+    glDeleteVertexArrays(1, &item->vao);
+    _sg_clear(item, sizeof(_sg_gl_vao_cache_item_t));
+}
+
+_SOKOL_PRIVATE void _sg_gl_setup_vao_cache(const sg_desc* desc) {
+    SOKOL_ASSERT((desc->gl_vao_cache_size >= 0) && (desc->gl_vao_cache_size < _SG_MAX_POOL_SIZE));
+    if (desc->gl_vao_cache_size > 0) {
+        _sg.gl.vao_cache.num = desc->gl_vao_cache_size;
+        const size_t size = (size_t)_sg.gl.vao_cache.num * sizeof(_sg_gl_vao_cache_item_t);
+        _sg.gl.vao_cache.items = (_sg_gl_vao_cache_item_t*)_sg_malloc_clear(size);
+    }
+}
+
+_SOKOL_PRIVATE void _sg_gl_discard_vao_cache(void) {
+    for (int i = 0; i < _sg.gl.vao_cache.num; i++) {
+        if (_sg.gl.vao_cache.items[i].vao) {
+            _sg_gl_vao_cache_discard_item(&_sg.gl.vao_cache.items[i]);
+        }
+    }
+    if (_sg.gl.vao_cache.items) {
+        _sg_free(_sg.gl.vao_cache.items);
+    }
+    _sg_clear(&_sg.gl.vao_cache, sizeof(_sg.gl.vao_cache));
+}
+
+// a deleted GL buffer stays attached to VAOs which are not currently bound,
+// and the buffer name may be reused, so cached VAOs referencing the buffer must go
+_SOKOL_PRIVATE void _sg_gl_vao_cache_invalidate_buffer(GLuint buf) {
+    for (int i = 0; i < _sg.gl.vao_cache.num; i++) {
+        _sg_gl_vao_cache_item_t* item = &_sg.gl.vao_cache.items[i];
+        if (0 == item->vao) {
+            continue;
+        }
+        bool match = item->key.ib == buf;
+        for (size_t vb_index = 0; vb_index < SG_MAX_VERTEXBUFFER_BINDSLOTS; vb_index++) {
+            match |= item->key.vbs[vb_index] == buf;
+        }
+        if (match) {
+            _sg_gl_vao_cache_discard_item(item);
+        }
+    }
+}
+
+_SOKOL_PRIVATE void _sg_gl_vao_cache_invalidate_pipeline(const _sg_pipeline_t* pip) {
+    for (int i = 0; i < _sg.gl.vao_cache.num; i++) {
+        _sg_gl_vao_cache_item_t* item = &_sg.gl.vao_cache.items[i];
+        if ((0 != item->vao) && _sg_sref_eql(&item->key.pip, &pip->slot)) {
+            _sg_gl_vao_cache_discard_item(item);
+        }
+    }
+}
+
+_SOKOL_PRIVATE void _sg_gl_flush_buffer_range_updates(void) {
+    _sg_gl_range_staging_t* st = &_sg.gl.range_staging;
+    if (st->size > 0) {
+        SOKOL_ASSERT(st->buf && st->ptr);
+        _sg_gl_cache_store_buffer_binding(st->target);
+        _sg_gl_cache_bind_buffer(st->target, st->buf);
+        glBufferSubData(st->target, st->offset, st->size, st->ptr);
+        _sg_gl_cache_restore_buffer_binding(st->target);
+        _SG_GL_CHECK_ERROR();
+        st->buf = 0;
+        st->size = 0;
+    }
+}
+
+_SOKOL_PRIVATE void _sg_gl_setup_upload_ring(const sg_desc* desc) {
+    SOKOL_ASSERT(desc->gl_texture_upload_buffer_size >= 0);
+    _SOKOL_UNUSED(desc);
+    #if defined(_SOKOL_GL_HAS_MAPBUFFER)
+    _sg_gl_upload_ring_t* ring = &_sg.gl.upload_ring;
+    if (desc->gl_texture_upload_buffer_size > 0) {
+        ring->size = desc->gl_texture_upload_buffer_size;
+        ring->frame_index = _sg.frame_index - 1;
+        glGenBuffers(_SG_GL_NUM_UPLOAD_BUFFERS, ring->buf);
+        for (int i = 0; i < _SG_GL_NUM_UPLOAD_BUFFERS; i++) {
+            glBindBuffer(GL_PIXEL_UNPACK_BUFFER, ring->buf[i]);
+            glBufferData(GL_PIXEL_UNPACK_BUFFER, ring->size, 0, GL_STREAM_DRAW);
+        }
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+        _SG_GL_CHECK_ERROR();
+    }
+    #endif
+}
+
+_SOKOL_PRIVATE void _sg_gl_discard_upload_ring(void) {
+    _sg_gl_upload_ring_t* ring = &_sg.gl.upload_ring;
+    if (ring->size > 0) {
+        #if defined(_SOKOL_GL_HAS_MAPBUFFER)
+        for (int i = 0; i < _SG_GL_NUM_UPLOAD_BUFFERS; i++) {
+            if (ring->fence[i]) {
+                glDeleteSync(ring->fence[i]);
+            }
+        }
+        #endif
+        glDeleteBuffers(_SG_GL_NUM_UPLOAD_BUFFERS, ring->buf);
+    }
+    _sg_clear(ring, sizeof(_sg_gl_upload_ring_t));
+}
+
+// called from _sg_gl_commit(), protects the current upload buffer from being overwritten
+// by the CPU while the GPU still reads from it
+_SOKOL_PRIVATE void _sg_gl_upload_ring_fence(void) {
+    #if defined(_SOKOL_GL_HAS_MAPBUFFER)
+    _sg_gl_upload_ring_t* ring = &_sg.gl.upload_ring;
+    // if the buffer still has a pending fence it wasn't written this frame (see _sg_gl_upload_ring_push())
+    if ((ring->size > 0) && (ring->frame_index == _sg.frame_index) && (0 == ring->fence[ring->index])) {
+        ring->fence[ring->index] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    }
+    #endif
+}
+
+_SOKOL_PRIVATE void _sg_gl_upload_ring_unbind(void) {
+    if (_sg.gl.upload_ring.bound) {
+        _sg.gl.upload_ring.bound = false;
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    }
+}
+
+// Copy texture data into the current upload buffer and return the 'pixels' argument for
+// glTexSubImage*(), which is either an offset into the then bound pixel-unpack-buffer, or
+// the original pointer if the upload ring is disabled or full. Call _sg_gl_upload_ring_unbind()
+// after the glTexSubImage*() call.
+_SOKOL_PRIVATE const GLvoid* _sg_gl_upload_ring_push(const void* ptr, size_t size) {
+    #if defined(_SOKOL_GL_HAS_MAPBUFFER)
+    _sg_gl_upload_ring_t* ring = &_sg.gl.upload_ring;
+    if ((0 == ring->size) || (0 == ptr)) {
+        return ptr;
+    }
+    if (ring->frame_index != _sg.frame_index) {
+        // first upload in a new frame, switch to the next buffer and make sure the GPU is done with it
+        ring->frame_index = _sg.frame_index;
+        ring->index = (ring->index + 1) % _SG_GL_NUM_UPLOAD_BUFFERS;
+        ring->pos = 0;
+        GLsync fence = ring->fence[ring->index];
+        if (fence) {
+            GLenum res = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+            if (GL_TIMEOUT_EXPIRED == res) {
+                _sg_stats_add(gl.num_pbo_fence_waits, 1);
+                res = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000);
+            }
+            if ((GL_TIMEOUT_EXPIRED != res) && (GL_WAIT_FAILED != res)) {
+                glDeleteSync(fence);
+                ring->fence[ring->index] = 0;
+            }
+        }
+    }
+    // if waiting for the fence timed out or failed, the GPU may still read from the buffer,
+    // keep the fence and fall back to direct uploads for the rest of the frame
+    if ((0 != ring->fence[ring->index]) || (((size_t)ring->pos + size) > (size_t)ring->size)) {
+        _sg_stats_add(gl.num_pbo_upload_fallbacks, 1);
+        return ptr;
+    }
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, ring->buf[ring->index]);
+    ring->bound = true;
+    // the GPU doesn't read from this buffer anymore (see above), so no need for the driver to synchronize
+    const GLbitfield access = GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT;
+    void* dst = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, ring->pos, (GLsizeiptr)size, access);
+    if (0 == dst) {
+        _sg_gl_upload_ring_unbind();
+        _sg_stats_add(gl.num_pbo_upload_fallbacks, 1);
+        return ptr;
+    }
+    memcpy(dst, ptr, size);
+    glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+    const GLvoid* result = (const GLvoid*)(GLintptr)ring->pos;
+    // keep offsets aligned for any pixel format
+    ring->pos += (int)_sg_roundup_u64(size, 16);
+    _sg_stats_add(gl.num_pbo_uploads, 1);
+    _sg_stats_add(gl.size_pbo_uploads, (uint32_t)size);
+    return result;
+    #else
+    _SOKOL_UNUSED(size);
+    return ptr;
+    #endif
+}
+
+_SOKOL_PRIVATE void _sg_gl_setup_timer(const sg_desc* desc) {
+    _SOKOL_UNUSED(desc);
+    #if defined(_SOKOL_GL_HAS_TIMER_QUERY)
+    _sg_gl_timer_t* timer = &_sg.gl.timer;
+    if (desc->gpu_timings && _sg.features.gpu_timings) {
+        timer->enabled = true;
+        for (int i = 0; i < _SG_GL_NUM_TIMER_FRAMES; i++) {
+            glGenQueries(2 * SG_MAX_GPU_TIMINGS, timer->frames[i].queries);
+        }
+        _SG_GL_CHECK_ERROR();
+    }
+    #endif
+}
+
+_SOKOL_PRIVATE void _sg_gl_discard_timer(void) {
+    #if defined(_SOKOL_GL_HAS_TIMER_QUERY)
+    _sg_gl_timer_t* timer = &_sg.gl.timer;
+    if (timer->enabled) {
+        for (int i = 0; i < _SG_GL_NUM_TIMER_FRAMES; i++) {
+            glDeleteQueries(2 * SG_MAX_GPU_TIMINGS, timer->frames[i].queries);
+        }
+    }
+    #endif
+    _sg_clear(&_sg.gl.timer, sizeof(_sg_gl_timer_t));
+}
+
+// called at the start of a pass or debug group
+_SOKOL_PRIVATE void _sg_gl_begin_gpu_timing(const char* label) {
+    #if defined(_SOKOL_GL_HAS_TIMER_QUERY)
+    _sg_gl_timer_t* timer = &_sg.gl.timer;
+    if (!timer->enabled) {
+        return;
+    }
+    _sg_gl_timer_frame_t* frame = &timer->frames[timer->cur_frame];
+    int index = -1;
+    if ((timer->depth < _SG_GL_MAX_TIMER_DEPTH) && (frame->num_timings < SG_MAX_GPU_TIMINGS)) {
+        index = frame->num_timings++;
+        sg_gpu_timing* timing = &frame->timings[index];
+        _sg_clear(timing, sizeof(sg_gpu_timing));
+        #if defined(_MSC_VER)
+        strncpy_s(timing->label, SG_GPU_TIMING_LABEL_SIZE, label, (SG_GPU_TIMING_LABEL_SIZE-1));
+        #else
+        strncpy(timing->label, label, SG_GPU_TIMING_LABEL_SIZE - 1);
+        #endif
+        timing->depth = timer->depth;
+        glQueryCounter(frame->queries[2 * index], GL_TIMESTAMP);
+    } else {
+        frame->num_dropped++;
+    }
+    if (timer->depth < _SG_GL_MAX_TIMER_DEPTH) {
+        timer->stack[timer->depth] = index;
+    }
+    timer->depth++;
+    #else
+    _SOKOL_UNUSED(label);
+    #endif
+}
+
+// called at the end of a pass or debug group
+_SOKOL_PRIVATE void _sg_gl_end_gpu_timing(void) {
+    #if defined(_SOKOL_GL_HAS_TIMER_QUERY)
+    _sg_gl_timer_t* timer = &_sg.gl.timer;
+    if (!timer->enabled || (0 == timer->depth)) {
+        return;
+    }
+    timer->depth--;
+    if (timer->depth < _SG_GL_MAX_TIMER_DEPTH) {
+        const int index = timer->stack[timer->depth];
+        if (index >= 0) {
+            glQueryCounter(timer->frames[timer->cur_frame].queries[2 * index + 1], GL_TIMESTAMP);
+        }
+    }
+    #endif
+}
+
+#if defined(_SOKOL_GL_HAS_TIMER_QUERY)
+// if all query results of a frame are available, copy them into _sg.gpu_timings
+_SOKOL_PRIVATE bool _sg_gl_resolve_gpu_timings(_sg_gl_timer_frame_t* frame) {
+    SOKOL_ASSERT(frame->pending);
+    for (int i = 0; i < 2 * frame->num_timings; i++) {
+        GLint available = 0;
+        glGetQueryObjectiv(frame->queries[i], GL_QUERY_RESULT_AVAILABLE, &available);
+        if (!available) {
+            return false;
+        }
+    }
+    sg_gpu_timings* res = &_sg.gpu_timings;
+    _sg_clear(res, sizeof(sg_gpu_timings));
+    res->valid = true;
+    res->frame_index = frame->frame_index;
+    res->num_timings = frame->num_timings;
+    res->num_dropped = frame->num_dropped;
+    GLuint64 frame_start = 0;
+    GLuint64 frame_end = 0;
+    for (int i = 0; i < frame->num_timings; i++) {
+        GLuint64 start = 0;
+        GLuint64 end = 0;
+        glGetQueryObjectui64v(frame->queries[2 * i], GL_QUERY_RESULT, &start);
+        glGetQueryObjectui64v(frame->queries[2 * i + 1], GL_QUERY_RESULT, &end);
+        res->timings[i] = frame->timings[i];
+        res->timings[i].duration_ns = (end > start) ? (uint64_t)(end - start) : 0;
+        if ((0 == i) || (start < frame_start)) {
+            frame_start = start;
+        }
+        if (end > frame_end) {
+            frame_end = end;
+        }
+    }
+    res->frame_duration_ns = (frame_end > frame_start) ? (uint64_t)(frame_end - frame_start) : 0;
+    frame->pending = false;
+    return true;
+}
+#endif
+
+// called from _sg_gl_commit(), finish the current frame and collect available results of previous frames
+_SOKOL_PRIVATE void _sg_gl_update_gpu_timings(void) {
+    #if defined(_SOKOL_GL_HAS_TIMER_QUERY)
+    _sg_gl_timer_t* timer = &_sg.gl.timer;
+    if (!timer->enabled) {
+        return;
+    }
+    // close any scopes which are still open (e.g. unbalanced debug groups)
+    while (timer->depth > 0) {
+        _sg_gl_end_gpu_timing();
+    }
+    _sg_gl_timer_frame_t* frame = &timer->frames[timer->cur_frame];
+    frame->frame_index = _sg.frame_index;
+    frame->pending = frame->num_timings > 0;
+    timer->cur_frame = (timer->cur_frame + 1) % _SG_GL_NUM_TIMER_FRAMES;
+    // check pending frames from oldest to newest, so that the newest available results win
+    for (int i = 0; i < _SG_GL_NUM_TIMER_FRAMES; i++) {
+        _sg_gl_timer_frame_t* pending_frame = &timer->frames[(timer->cur_frame + i) % _SG_GL_NUM_TIMER_FRAMES];
+        if (pending_frame->pending) {
+            _sg_gl_resolve_gpu_timings(pending_frame);
+        }
+    }
+    // never wait for results, if the next frame's queries are still pending, drop their results
+    _sg_gl_timer_frame_t* next_frame = &timer->frames[timer->cur_frame];
+    next_frame->pending = false;
+    next_frame->num_timings = 0;
+    next_frame->num_dropped = 0;
+    _SG_GL_CHECK_ERROR();
+    #endif
+}
+
 // called from _sg_gl_discard_buffer()
 _SOKOL_PRIVATE void _sg_gl_cache_invalidate_buffer(GLuint buf) {
+    _sg_gl_vao_cache_invalidate_buffer(buf);
+    if (buf == _sg.gl.range_staging.buf) {
+        // drop pending updates into the destroyed buffer
+        _sg.gl.range_staging.buf = 0;
+        _sg.gl.range_staging.size = 0;
+    }
     if (buf == _sg.gl.cache.vertex_buffer) {
         _sg.gl.cache.vertex_buffer = 0;
         glBindBuffer(GL_ARRAY_BUFFER, 0);
@@ -9366,6 +11864,11 @@ _SOKOL_PRIVATE void _sg_gl_cache_invalidate_buffer(GLuint buf) {
             _sg_stats_add(gl.num_bind_buffer, 1);
         }
     }
+    if (buf == _sg.gl.cache.indirect_buffer) {
+        _sg.gl.cache.indirect_buffer = 0;
+        glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+        _sg_stats_add(gl.num_bind_buffer, 1);
+    }
     if (buf == _sg.gl.cache.stored_vertex_buffer) {
         _sg.gl.cache.stored_vertex_buffer = 0;
     }
@@ -9375,6 +11878,9 @@ _SOKOL_PRIVATE void _sg_gl_cache_invalidate_buffer(GLuint buf) {
     if (buf == _sg.gl.cache.stored_storage_buffer) {
         _sg.gl.cache.stored_storage_buffer = 0;
     }
+    if (buf == _sg.gl.cache.stored_indirect_buffer) {
+        _sg.gl.cache.stored_indirect_buffer = 0;
+    }
     for (int i = 0; i < SG_MAX_VERTEX_ATTRIBUTES; i++) {
         if (buf == _sg.gl.cache.attrs[i].gl_vbuf) {
             _sg.gl.cache.attrs[i].gl_vbuf = 0;
@@ -9508,6 +12014,7 @@ _SOKOL_PRIVATE void _sg_gl_cache_invalidate_pipeline(_sg_pipeline_t* pip) {
     if (_sg_sref_eql(&_sg.gl.cache.cur_pip, &pip->slot)) {
         _sg.gl.cache.cur_pip = _sg_sref(0);
     }
+    _sg_gl_vao_cache_invalidate_pipeline(pip);
 }
 
 _SOKOL_PRIVATE void _sg_gl_reset_state_cache(void) {
@@ -9515,6 +12022,7 @@ _SOKOL_PRIVATE void _sg_gl_reset_state_cache(void) {
     glBindVertexArray(_sg.gl.vao);
     _SG_GL_CHECK_ERROR();
     _sg_clear(&_sg.gl.cache, sizeof(_sg.gl.cache));
+    _sg.gl.cache.vao = _sg.gl.vao;
     _sg_gl_cache_clear_buffer_bindings(true);
     _SG_GL_CHECK_ERROR();
     _sg_gl_cache_clear_texture_sampler_bindings(true);
@@ -9591,7 +12099,7 @@ _SOKOL_PRIVATE void _sg_gl_reset_state_cache(void) {
 }
 
 _SOKOL_PRIVATE void _sg_gl_setup_backend(const sg_desc* desc) {
-    _SOKOL_UNUSED(desc);
+    SOKOL_ASSERT(desc);
 
     // assumes that _sg.gl is already zero-initialized
     _sg.gl.valid = true;
@@ -9613,8 +12121,12 @@ _SOKOL_PRIVATE void _sg_gl_setup_backend(const sg_desc* desc) {
     glGenVertexArrays(1, &_sg.gl.vao);
     glBindVertexArray(_sg.gl.vao);
     _SG_GL_CHECK_ERROR();
-    // incoming texture data is generally expected to be packed tightly
+    _sg_gl_setup_vao_cache(desc);
+    _sg_gl_setup_upload_ring(desc);
+    _sg_gl_setup_timer(desc);
+    // incoming texture data is generally expected to be packed tightly, same for readback data
     glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
     #if defined(SOKOL_GLCORE)
         // enable seamless cubemap sampling (only desktop GL)
         glEnable(GL_TEXTURE_CUBE_MAP_SEAMLESS);
@@ -9624,6 +12136,12 @@ _SOKOL_PRIVATE void _sg_gl_setup_backend(const sg_desc* desc) {
 
 _SOKOL_PRIVATE void _sg_gl_discard_backend(void) {
     SOKOL_ASSERT(_sg.gl.valid);
+    _sg_gl_discard_vao_cache();
+    _sg_gl_discard_upload_ring();
+    _sg_gl_discard_timer();
+    if (_sg.gl.range_staging.ptr) {
+        _sg_free(_sg.gl.range_staging.ptr);
+    }
     if (_sg.gl.vao) {
         glDeleteVertexArrays(1, &_sg.gl.vao);
     }
@@ -10913,6 +13431,74 @@ _SOKOL_PRIVATE void _sg_gl_handle_memory_barriers(const _sg_shader_t* shd, const
 }
 #endif
 
+// lookup or create a VAO for the vertex- and index-buffer bindings (only if sg_desc.gl_vao_cache_size > 0)
+_SOKOL_PRIVATE void _sg_gl_apply_cached_vao(const _sg_bindings_ptrs_t* bnd) {
+    const _sg_pipeline_t* pip = bnd->pip;
+    _sg_gl_vao_key_t key;
+    _sg_clear(&key, sizeof(key));
+    key.pip = _sg_sref(&pip->slot);
+    for (size_t i = 0; i < SG_MAX_VERTEXBUFFER_BINDSLOTS; i++) {
+        if (pip->cmn.vertex_buffer_layout_active[i]) {
+            const _sg_buffer_t* vb = bnd->vbs[i];
+            SOKOL_ASSERT(vb);
+            key.vbs[i] = vb->gl.buf[vb->cmn.active_slot];
+            key.vb_offsets[i] = bnd->vb_offsets[i];
+        }
+    }
+    key.ib = bnd->ib ? bnd->ib->gl.buf[bnd->ib->cmn.active_slot] : 0;
+    _sg.gl.cache.cur_ib_offset = bnd->ib_offset;
+
+    // find a matching VAO, or otherwise the least recently used (or a free) cache slot
+    _sg_gl_vao_cache_t* vc = &_sg.gl.vao_cache;
+    vc->tick += 1;
+    _sg_gl_vao_cache_item_t* lru = 0;
+    for (int i = 0; i < vc->num; i++) {
+        _sg_gl_vao_cache_item_t* item = &vc->items[i];
+        if (0 == item->vao) {
+            if ((0 == lru) || (0 != lru->vao)) {
+                lru = item;
+            }
+        } else if (0 == memcmp(&item->key, &key, sizeof(key))) {
+            item->last_used = vc->tick;
+            _sg_stats_add(gl.num_vao_cache_hits, 1);
+            _sg_gl_cache_bind_vao(item->vao, key.ib);
+            return;
+        } else if ((0 == lru) || ((0 != lru->vao) && (item->last_used < lru->last_used))) {
+            lru = item;
+        }
+    }
+    SOKOL_ASSERT(lru);
+    _sg_stats_add(gl.num_vao_cache_misses, 1);
+    if (0 != lru->vao) {
+        _sg_gl_vao_cache_discard_item(lru);
+    }
+    lru->key = key;
+    lru->last_used = vc->tick;
+    glGenVertexArrays(1, &lru->vao);
+    _sg_gl_cache_bind_vao(lru->vao, 0);
+    _sg_gl_cache_bind_buffer(GL_ELEMENT_ARRAY_BUFFER, key.ib);
+    for (GLuint attr_index = 0; attr_index < (GLuint)_sg.limits.max_vertex_attrs; attr_index++) {
+        const _sg_gl_attr_t* attr = &pip->gl.attrs[attr_index];
+        if (attr->vb_index < 0) {
+            continue;
+        }
+        SOKOL_ASSERT(attr->vb_index < SG_MAX_VERTEXBUFFER_BINDSLOTS);
+        const int vb_offset = key.vb_offsets[attr->vb_index] + attr->offset;
+        _sg_gl_cache_bind_buffer(GL_ARRAY_BUFFER, key.vbs[attr->vb_index]);
+        if (attr->base_type == SG_SHADERATTRBASETYPE_FLOAT) {
+            glVertexAttribPointer(attr_index, attr->size, attr->type, attr->normalized, attr->stride, (const GLvoid*)(GLintptr)vb_offset);
+        } else {
+            glVertexAttribIPointer(attr_index, attr->size, attr->type, attr->stride, (const GLvoid*)(GLintptr)vb_offset);
+        }
+        _sg_stats_add(gl.num_vertex_attrib_pointer, 1);
+        glVertexAttribDivisor(attr_index, (GLuint)attr->divisor);
+        _sg_stats_add(gl.num_vertex_attrib_divisor, 1);
+        glEnableVertexAttribArray(attr_index);
+        _sg_stats_add(gl.num_enable_vertex_attrib_array, 1);
+    }
+    _SG_GL_CHECK_ERROR();
+}
+
 _SOKOL_PRIVATE bool _sg_gl_apply_bindings(_sg_bindings_ptrs_t* bnd) {
     SOKOL_ASSERT(bnd);
     SOKOL_ASSERT(bnd->pip);
@@ -10954,7 +13540,9 @@ _SOKOL_PRIVATE bool _sg_gl_apply_bindings(_sg_bindings_ptrs_t* bnd) {
     }
     _SG_GL_CHECK_ERROR();
 
-    if (!bnd->pip->cmn.is_compute) {
+    if (!bnd->pip->cmn.is_compute && (_sg.gl.vao_cache.num > 0)) {
+        _sg_gl_apply_cached_vao(bnd);
+    } else if (!bnd->pip->cmn.is_compute) {
         // index buffer (can be 0)
         const GLuint gl_ib = bnd->ib ? bnd->ib->gl.buf[bnd->ib->cmn.active_slot] : 0;
         _sg_gl_cache_bind_buffer(GL_ELEMENT_ARRAY_BUFFER, gl_ib);
@@ -11079,6 +13667,7 @@ _SOKOL_PRIVATE void _sg_gl_apply_uniforms(int ub_slot, const sg_range* data) {
 }
 
 _SOKOL_PRIVATE void _sg_gl_draw(int base_element, int num_elements, int num_instances) {
+    _sg_gl_flush_buffer_range_updates();
     const GLenum i_type = _sg.gl.cache.cur_index_type;
     const GLenum p_type = _sg.gl.cache.cur_primitive_type;
     const bool use_instanced_draw = (num_instances > 1) || _sg_pipeline_ref_ptr(&_sg.cur_pip)->cmn.use_instanced_draw;
@@ -11102,36 +13691,212 @@ _SOKOL_PRIVATE void _sg_gl_draw(int base_element, int num_elements, int num_inst
     }
 }
 
-_SOKOL_PRIVATE void _sg_gl_dispatch(int num_groups_x, int num_groups_y, int num_groups_z) {
+_SOKOL_PRIVATE void _sg_gl_draw_indirect(_sg_buffer_t* buf, int offset) {
+    SOKOL_ASSERT(buf);
     #if defined(_SOKOL_GL_HAS_COMPUTE)
-    if (!_sg.features.compute) {
+    if (!_sg.features.draw_indirect) {
         return;
     }
-    glDispatchCompute((GLuint)num_groups_x, (GLuint)num_groups_y, (GLuint)num_groups_z);
+    _sg_gl_flush_buffer_range_updates();
+    // the draw arguments may have been written by a compute shader
+    if (buf->gl.gpu_dirty_flags & _SG_GL_GPUDIRTY_INDIRECTBUFFER) {
+        glMemoryBarrier(GL_COMMAND_BARRIER_BIT);
+        _sg_stats_add(gl.num_memory_barriers, 1);
+        buf->gl.gpu_dirty_flags &= (uint8_t)~_SG_GL_GPUDIRTY_INDIRECTBUFFER;
+    }
+    _sg_gl_cache_bind_buffer(GL_DRAW_INDIRECT_BUFFER, buf->gl.buf[buf->cmn.active_slot]);
+    const GLenum i_type = _sg.gl.cache.cur_index_type;
+    const GLenum p_type = _sg.gl.cache.cur_primitive_type;
+    const GLvoid* indirect = (const GLvoid*)(GLintptr)offset;
+    if (0 != i_type) {
+        // GL has no way to pass the index buffer offset into an indirect draw
+        if (0 != _sg.gl.cache.cur_ib_offset) {
+            _SG_ERROR(GL_DRAW_INDIRECT_INDEX_BUFFER_OFFSET);
+            return;
+        }
+        glDrawElementsIndirect(p_type, i_type, indirect);
+    } else {
+        glDrawArraysIndirect(p_type, indirect);
+    }
     #else
-    (void)num_groups_x; (void)num_groups_y; (void)num_groups_z;
+    _SOKOL_UNUSED(buf); _SOKOL_UNUSED(offset);
     #endif
 }
 
-_SOKOL_PRIVATE void _sg_gl_commit(void) {
+_SOKOL_PRIVATE void _sg_gl_dispatch(int num_groups_x, int num_groups_y, int num_groups_z) {
+    #if defined(_SOKOL_GL_HAS_COMPUTE)
+    if (!_sg.features.compute) {
+        return;
+    }
+    _sg_gl_flush_buffer_range_updates();
+    glDispatchCompute((GLuint)num_groups_x, (GLuint)num_groups_y, (GLuint)num_groups_z);
+    #else
+    (void)num_groups_x; (void)num_groups_y; (void)num_groups_z;
+    #endif
+}
+
+_SOKOL_PRIVATE void _sg_gl_commit(void) {
+    _sg_gl_flush_buffer_range_updates();
+    _sg_gl_upload_ring_fence();
+    _sg_gl_update_gpu_timings();
     // "soft" clear bindings (only those that are actually bound)
     _sg_gl_cache_clear_buffer_bindings(false);
     _sg_gl_cache_clear_texture_sampler_bindings(false);
 }
 
+_SOKOL_PRIVATE sg_resource_state _sg_gl_create_image_readback(_sg_readback_t* rb, _sg_image_t* img, const sg_image_region* region) {
+    SOKOL_ASSERT(rb && img && region);
+    SOKOL_ASSERT(img->cmn.active_slot < SG_MAX_UPDATE_SLOTS);
+    SOKOL_ASSERT(0 != img->gl.tex[img->cmn.active_slot]);
+    _SG_GL_CHECK_ERROR();
+    #if defined(_SOKOL_GL_HAS_COMPUTE)
+    if (_sg.features.compute && img->cmn.usage.storage_attachment) {
+        // image may have been written by a compute shader
+        glMemoryBarrier(GL_FRAMEBUFFER_BARRIER_BIT);
+    }
+    #endif
+    // read the image through a temporary framebuffer object
+    const GLuint gl_tex = img->gl.tex[img->cmn.active_slot];
+    GLuint gl_fb = 0;
+    glGenFramebuffers(1, &gl_fb);
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, gl_fb);
+    switch (img->cmn.type) {
+        case SG_IMAGETYPE_2D:
+            glFramebufferTexture2D(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, gl_tex, region->mip_level);
+            break;
+        case SG_IMAGETYPE_CUBE:
+            glFramebufferTexture2D(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, _sg_gl_cubeface_target(region->slice), gl_tex, region->mip_level);
+            break;
+        default:
+            glFramebufferTextureLayer(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, gl_tex, region->mip_level, region->slice);
+            break;
+    }
+    sg_resource_state res = SG_RESOURCESTATE_VALID;
+    if (GL_FRAMEBUFFER_COMPLETE == glCheckFramebufferStatus(GL_READ_FRAMEBUFFER)) {
+        glReadBuffer(GL_COLOR_ATTACHMENT0);
+        const GLenum gl_img_format = _sg_gl_teximage_format(img->cmn.pixel_format);
+        const GLenum gl_img_type = _sg_gl_teximage_type(img->cmn.pixel_format);
+        #if defined(_SOKOL_GL_HAS_MAPBUFFER)
+            glGenBuffers(1, &rb->gl.buf);
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, rb->gl.buf);
+            glBufferData(GL_PIXEL_PACK_BUFFER, rb->cmn.size, 0, GL_STREAM_READ);
+            glReadPixels(region->x, region->y, region->width, region->height, gl_img_format, gl_img_type, 0);
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+            rb->gl.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        #else
+            // WebGL2 can't map buffers, read synchronously (the callback is still deferred to sg_commit())
+            glReadPixels(region->x, region->y, region->width, region->height, gl_img_format, gl_img_type, (void*)rb->cmn.data.ptr);
+            rb->cmn.completed = true;
+        #endif
+    } else {
+        _SG_ERROR(GL_READBACK_FRAMEBUFFER_INCOMPLETE);
+        res = SG_RESOURCESTATE_FAILED;
+    }
+    // NOTE: deleting the bound framebuffer reverts the binding to the default framebuffer
+    glDeleteFramebuffers(1, &gl_fb);
+    _SG_GL_CHECK_ERROR();
+    return res;
+}
+
+_SOKOL_PRIVATE sg_resource_state _sg_gl_create_buffer_readback(_sg_readback_t* rb, _sg_buffer_t* buf, int offset) {
+    SOKOL_ASSERT(rb && buf);
+    #if defined(_SOKOL_GL_HAS_MAPBUFFER)
+        SOKOL_ASSERT(buf->cmn.active_slot < SG_MAX_UPDATE_SLOTS);
+        SOKOL_ASSERT(0 != buf->gl.buf[buf->cmn.active_slot]);
+        _SG_GL_CHECK_ERROR();
+        _sg_gl_flush_buffer_range_updates();
+        #if defined(_SOKOL_GL_HAS_COMPUTE)
+        if (_sg.features.compute && (0 != buf->gl.gpu_dirty_flags)) {
+            // buffer may have been written by a compute shader
+            glMemoryBarrier(GL_BUFFER_UPDATE_BARRIER_BIT);
+        }
+        #endif
+        // NOTE: the copy-read and copy-write bind points are not tracked by the state cache
+        glGenBuffers(1, &rb->gl.buf);
+        glBindBuffer(GL_COPY_WRITE_BUFFER, rb->gl.buf);
+        glBufferData(GL_COPY_WRITE_BUFFER, rb->cmn.size, 0, GL_STREAM_READ);
+        glBindBuffer(GL_COPY_READ_BUFFER, buf->gl.buf[buf->cmn.active_slot]);
+        glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, offset, 0, rb->cmn.size);
+        glBindBuffer(GL_COPY_READ_BUFFER, 0);
+        glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+        rb->gl.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        _SG_GL_CHECK_ERROR();
+        return SG_RESOURCESTATE_VALID;
+    #else
+        _SOKOL_UNUSED(rb);
+        _SOKOL_UNUSED(buf);
+        _SOKOL_UNUSED(offset);
+        _SG_ERROR(GL_BUFFER_READBACK_NOT_SUPPORTED);
+        return SG_RESOURCESTATE_FAILED;
+    #endif
+}
+
+_SOKOL_PRIVATE void _sg_gl_poll_readback(_sg_readback_t* rb) {
+    SOKOL_ASSERT(rb);
+    #if defined(_SOKOL_GL_HAS_MAPBUFFER)
+        SOKOL_ASSERT(rb->gl.fence && rb->gl.buf);
+        const GLenum wait_res = glClientWaitSync(rb->gl.fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+        if (GL_TIMEOUT_EXPIRED == wait_res) {
+            return;
+        }
+        rb->cmn.failed = true;
+        if (GL_WAIT_FAILED != wait_res) {
+            glBindBuffer(GL_COPY_READ_BUFFER, rb->gl.buf);
+            const void* src = glMapBufferRange(GL_COPY_READ_BUFFER, 0, rb->cmn.size, GL_MAP_READ_BIT);
+            if (src) {
+                memcpy((void*)rb->cmn.data.ptr, src, (size_t)rb->cmn.size);
+                glUnmapBuffer(GL_COPY_READ_BUFFER);
+                rb->cmn.failed = false;
+            }
+            glBindBuffer(GL_COPY_READ_BUFFER, 0);
+        }
+        rb->cmn.completed = true;
+        _SG_GL_CHECK_ERROR();
+    #else
+        // WebGL2 readbacks are completed in _sg_gl_create_image_readback()
+        _SOKOL_UNUSED(rb);
+        SOKOL_UNREACHABLE;
+    #endif
+}
+
+_SOKOL_PRIVATE void _sg_gl_discard_readback(_sg_readback_t* rb) {
+    SOKOL_ASSERT(rb);
+    _SG_GL_CHECK_ERROR();
+    #if defined(_SOKOL_GL_HAS_MAPBUFFER)
+    if (rb->gl.fence) {
+        glDeleteSync(rb->gl.fence);
+    }
+    #endif
+    if (rb->gl.buf) {
+        glDeleteBuffers(1, &rb->gl.buf);
+    }
+    _SG_GL_CHECK_ERROR();
+}
+
+// detach the buffer's current storage from in-flight draw calls, so that the
+// driver doesn't need to wait for the GPU in the following glBufferSubData()
+_SOKOL_PRIVATE void _sg_gl_orphan_buffer(const _sg_buffer_t* buf, GLenum gl_tgt) {
+    glBufferData(gl_tgt, buf->cmn.size, 0, _sg_gl_buffer_usage(&buf->cmn.usage));
+    _sg_stats_add(gl.num_buffer_orphans, 1);
+}
+
 _SOKOL_PRIVATE void _sg_gl_update_buffer(_sg_buffer_t* buf, const sg_range* data) {
     SOKOL_ASSERT(buf && data && data->ptr && (data->size > 0));
+    _sg_gl_flush_buffer_range_updates();
     // only one update per buffer per frame allowed
     if (++buf->cmn.active_slot >= buf->cmn.num_slots) {
         buf->cmn.active_slot = 0;
     }
     GLenum gl_tgt = _sg_gl_buffer_target(&buf->cmn.usage);
-    SOKOL_ASSERT(buf->cmn.active_slot < SG_NUM_INFLIGHT_FRAMES);
+    SOKOL_ASSERT(buf->cmn.active_slot < SG_MAX_UPDATE_SLOTS);
     GLuint gl_buf = buf->gl.buf[buf->cmn.active_slot];
     SOKOL_ASSERT(gl_buf);
     _SG_GL_CHECK_ERROR();
     _sg_gl_cache_store_buffer_binding(gl_tgt);
     _sg_gl_cache_bind_buffer(gl_tgt, gl_buf);
+    if (SG_UPDATEMODE_ORPHAN == buf->cmn.update_mode) {
+        _sg_gl_orphan_buffer(buf, gl_tgt);
+    }
     glBufferSubData(gl_tgt, 0, (GLsizeiptr)data->size, data->ptr);
     _sg_gl_cache_restore_buffer_binding(gl_tgt);
     _SG_GL_CHECK_ERROR();
@@ -11139,18 +13904,22 @@ _SOKOL_PRIVATE void _sg_gl_update_buffer(_sg_buffer_t* buf, const sg_range* data
 
 _SOKOL_PRIVATE void _sg_gl_append_buffer(_sg_buffer_t* buf, const sg_range* data, bool new_frame) {
     SOKOL_ASSERT(buf && data && data->ptr && (data->size > 0));
+    _sg_gl_flush_buffer_range_updates();
     if (new_frame) {
         if (++buf->cmn.active_slot >= buf->cmn.num_slots) {
             buf->cmn.active_slot = 0;
         }
     }
     GLenum gl_tgt = _sg_gl_buffer_target(&buf->cmn.usage);
-    SOKOL_ASSERT(buf->cmn.active_slot < SG_NUM_INFLIGHT_FRAMES);
+    SOKOL_ASSERT(buf->cmn.active_slot < SG_MAX_UPDATE_SLOTS);
     GLuint gl_buf = buf->gl.buf[buf->cmn.active_slot];
     SOKOL_ASSERT(gl_buf);
     _SG_GL_CHECK_ERROR();
     _sg_gl_cache_store_buffer_binding(gl_tgt);
     _sg_gl_cache_bind_buffer(gl_tgt, gl_buf);
+    if (new_frame && (SG_UPDATEMODE_ORPHAN == buf->cmn.update_mode)) {
+        _sg_gl_orphan_buffer(buf, gl_tgt);
+    }
     glBufferSubData(gl_tgt, buf->cmn.append_pos, (GLsizeiptr)data->size, data->ptr);
     _sg_gl_cache_restore_buffer_binding(gl_tgt);
     _SG_GL_CHECK_ERROR();
@@ -11162,21 +13931,22 @@ _SOKOL_PRIVATE void _sg_gl_update_image(_sg_image_t* img, const sg_image_data* d
     if (++img->cmn.active_slot >= img->cmn.num_slots) {
         img->cmn.active_slot = 0;
     }
-    SOKOL_ASSERT(img->cmn.active_slot < SG_NUM_INFLIGHT_FRAMES);
+    SOKOL_ASSERT(img->cmn.active_slot < SG_MAX_UPDATE_SLOTS);
     SOKOL_ASSERT(0 != img->gl.tex[img->cmn.active_slot]);
     _sg_gl_cache_store_texture_sampler_binding(0);
     _sg_gl_cache_bind_texture_sampler(0, img->gl.target, img->gl.tex[img->cmn.active_slot], 0);
     const GLenum gl_img_format = _sg_gl_teximage_format(img->cmn.pixel_format);
     const GLenum gl_img_type = _sg_gl_teximage_type(img->cmn.pixel_format);
     const int num_faces = img->cmn.type == SG_IMAGETYPE_CUBE ? 6 : 1;
-    const int num_mips = img->cmn.num_mipmaps;
+    // with generate_mipmaps only the top mip level is provided
+    const int num_mips = img->cmn.generate_mipmaps ? 1 : img->cmn.num_mipmaps;
     for (int face_index = 0; face_index < num_faces; face_index++) {
         for (int mip_index = 0; mip_index < num_mips; mip_index++) {
             GLenum gl_img_target = img->gl.target;
             if (SG_IMAGETYPE_CUBE == img->cmn.type) {
                 gl_img_target = _sg_gl_cubeface_target(face_index);
             }
-            const GLvoid* data_ptr = data->subimage[face_index][mip_index].ptr;
+            const GLvoid* data_ptr = _sg_gl_upload_ring_push(data->subimage[face_index][mip_index].ptr, data->subimage[face_index][mip_index].size);
             int mip_width = _sg_miplevel_dim(img->cmn.width, mip_index);
             int mip_height = _sg_miplevel_dim(img->cmn.height, mip_index);
             if ((SG_IMAGETYPE_2D == img->cmn.type) || (SG_IMAGETYPE_CUBE == img->cmn.type)) {
@@ -11197,11 +13967,101 @@ _SOKOL_PRIVATE void _sg_gl_update_image(_sg_image_t* img, const sg_image_data* d
                     data_ptr);
 
             }
+            _sg_gl_upload_ring_unbind();
         }
     }
     _sg_gl_cache_restore_texture_sampler_binding(0);
 }
 
+// NOTE: partial updates don't rotate the active buffer or texture slot, GL takes care
+// of synchronization with in-flight draw calls in glBufferSubData() and glTexSubImage*()
+_SOKOL_PRIVATE void _sg_gl_update_buffer_range(_sg_buffer_t* buf, int offset, const sg_range* data, bool new_frame) {
+    SOKOL_ASSERT(buf && data && data->ptr && (data->size > 0));
+    _SOKOL_UNUSED(new_frame);
+    SOKOL_ASSERT(buf->cmn.active_slot < SG_MAX_UPDATE_SLOTS);
+    const GLuint gl_buf = buf->gl.buf[buf->cmn.active_slot];
+    SOKOL_ASSERT(gl_buf);
+    const int size = (int)data->size;
+    _sg_gl_range_staging_t* st = &_sg.gl.range_staging;
+    const bool contiguous = (st->buf == gl_buf) && ((st->offset + st->size) == offset);
+    if (!contiguous || ((st->size + size) > _SG_GL_RANGE_STAGING_SIZE)) {
+        _sg_gl_flush_buffer_range_updates();
+    }
+    const GLenum gl_tgt = _sg_gl_buffer_target(&buf->cmn.usage);
+    if (size > _SG_GL_RANGE_STAGING_SIZE) {
+        // too big for the staging area, upload directly
+        _sg_gl_cache_store_buffer_binding(gl_tgt);
+        _sg_gl_cache_bind_buffer(gl_tgt, gl_buf);
+        glBufferSubData(gl_tgt, offset, (GLsizeiptr)size, data->ptr);
+        _sg_gl_cache_restore_buffer_binding(gl_tgt);
+        _SG_GL_CHECK_ERROR();
+        return;
+    }
+    if (0 == st->ptr) {
+        st->ptr = (uint8_t*)_sg_malloc(_SG_GL_RANGE_STAGING_SIZE);
+    }
+    if (0 == st->size) {
+        st->buf = gl_buf;
+        st->target = gl_tgt;
+        st->offset = offset;
+    }
+    memcpy(st->ptr + st->size, data->ptr, data->size);
+    st->size += size;
+}
+
+_SOKOL_PRIVATE void _sg_gl_update_image_region(_sg_image_t* img, const sg_image_region* region, const sg_range* data, bool new_frame) {
+    SOKOL_ASSERT(img && region && data && data->ptr);
+    _SOKOL_UNUSED(new_frame);
+    SOKOL_ASSERT(img->cmn.active_slot < SG_MAX_UPDATE_SLOTS);
+    SOKOL_ASSERT(0 != img->gl.tex[img->cmn.active_slot]);
+    _sg_gl_cache_store_texture_sampler_binding(0);
+    _sg_gl_cache_bind_texture_sampler(0, img->gl.target, img->gl.tex[img->cmn.active_slot], 0);
+    const GLenum gl_img_format = _sg_gl_teximage_format(img->cmn.pixel_format);
+    const GLenum gl_img_type = _sg_gl_teximage_type(img->cmn.pixel_format);
+    const GLvoid* data_ptr = _sg_gl_upload_ring_push(data->ptr, data->size);
+    if (SG_IMAGETYPE_2D == img->cmn.type) {
+        glTexSubImage2D(img->gl.target, region->mip_level,
+            region->x, region->y,
+            region->width, region->height,
+            gl_img_format, gl_img_type,
+            data_ptr);
+    } else if (SG_IMAGETYPE_CUBE == img->cmn.type) {
+        glTexSubImage2D(_sg_gl_cubeface_target(region->slice), region->mip_level,
+            region->x, region->y,
+            region->width, region->height,
+            gl_img_format, gl_img_type,
+            data_ptr);
+    } else {
+        SOKOL_ASSERT((SG_IMAGETYPE_3D == img->cmn.type) || (SG_IMAGETYPE_ARRAY == img->cmn.type));
+        glTexSubImage3D(img->gl.target, region->mip_level,
+            region->x, region->y, region->slice,
+            region->width, region->height, 1,
+            gl_img_format, gl_img_type,
+            data_ptr);
+    }
+    _sg_gl_upload_ring_unbind();
+    _SG_GL_CHECK_ERROR();
+    _sg_gl_cache_restore_texture_sampler_binding(0);
+}
+
+_SOKOL_PRIVATE void _sg_gl_generate_mipmaps(_sg_image_t* img) {
+    SOKOL_ASSERT(img && img->cmn.generate_mipmaps);
+    SOKOL_ASSERT(img->cmn.active_slot < SG_MAX_UPDATE_SLOTS);
+    SOKOL_ASSERT(0 != img->gl.tex[img->cmn.active_slot]);
+    _SG_GL_CHECK_ERROR();
+    #if defined(_SOKOL_GL_HAS_COMPUTE)
+    if (_sg.features.compute && img->cmn.usage.storage_attachment) {
+        // top mip level may have been written by a compute shader
+        glMemoryBarrier(GL_TEXTURE_UPDATE_BARRIER_BIT);
+    }
+    #endif
+    _sg_gl_cache_store_texture_sampler_binding(0);
+    _sg_gl_cache_bind_texture_sampler(0, img->gl.target, img->gl.tex[img->cmn.active_slot], 0);
+    glGenerateMipmap(img->gl.target);
+    _SG_GL_CHECK_ERROR();
+    _sg_gl_cache_restore_texture_sampler_binding(0);
+}
+
 // ██████  ██████  ██████   ██  ██     ██████   █████   ██████ ██   ██ ███████ ███    ██ ██████
 // ██   ██      ██ ██   ██ ███ ███     ██   ██ ██   ██ ██      ██  ██  ██      ████   ██ ██   ██
 // ██   ██  █████  ██   ██  ██  ██     ██████  ███████ ██      █████   █████   ██ ██  ██ ██   ██
@@ -11599,6 +14459,14 @@ static inline void _sg_d3d11_ResolveSubresource(ID3D11DeviceContext* self, ID3D1
     #endif
 }
 
+static inline void _sg_d3d11_CopySubresourceRegion(ID3D11DeviceContext* self, ID3D11Resource* pDstResource, UINT DstSubresource, UINT DstX, UINT DstY, UINT DstZ, ID3D11Resource* pSrcResource, UINT SrcSubresource, const D3D11_BOX* pSrcBox) {
+    #if defined(__cplusplus)
+        self->CopySubresourceRegion(pDstResource, DstSubresource, DstX, DstY, DstZ, pSrcResource, SrcSubresource, pSrcBox);
+    #else
+        self->lpVtbl->CopySubresourceRegion(self, pDstResource, DstSubresource, DstX, DstY, DstZ, pSrcResource, SrcSubresource, pSrcBox);
+    #endif
+}
+
 static inline void _sg_d3d11_IASetPrimitiveTopology(ID3D11DeviceContext* self, D3D11_PRIMITIVE_TOPOLOGY Topology) {
     #if defined(__cplusplus)
         self->IASetPrimitiveTopology(Topology);
@@ -11615,6 +14483,14 @@ static inline void _sg_d3d11_UpdateSubresource(ID3D11DeviceContext* self, ID3D11
     #endif
 }
 
+static inline void _sg_d3d11_GenerateMips(ID3D11DeviceContext* self, ID3D11ShaderResourceView* pShaderResourceView) {
+    #if defined(__cplusplus)
+        self->GenerateMips(pShaderResourceView);
+    #else
+        self->lpVtbl->GenerateMips(self, pShaderResourceView);
+    #endif
+}
+
 static inline void _sg_d3d11_DrawIndexed(ID3D11DeviceContext* self, UINT IndexCount, UINT StartIndexLocation, INT  BaseVertexLocation) {
     #if defined(__cplusplus)
         self->DrawIndexed(IndexCount, StartIndexLocation, BaseVertexLocation);
@@ -11647,6 +14523,22 @@ static inline void _sg_d3d11_DrawInstanced(ID3D11DeviceContext* self, UINT Verte
     #endif
 }
 
+static inline void _sg_d3d11_DrawInstancedIndirect(ID3D11DeviceContext* self, ID3D11Buffer* pBufferForArgs, UINT AlignedByteOffsetForArgs) {
+    #if defined(__cplusplus)
+        self->DrawInstancedIndirect(pBufferForArgs, AlignedByteOffsetForArgs);
+    #else
+        self->lpVtbl->DrawInstancedIndirect(self, pBufferForArgs, AlignedByteOffsetForArgs);
+    #endif
+}
+
+static inline void _sg_d3d11_DrawIndexedInstancedIndirect(ID3D11DeviceContext* self, ID3D11Buffer* pBufferForArgs, UINT AlignedByteOffsetForArgs) {
+    #if defined(__cplusplus)
+        self->DrawIndexedInstancedIndirect(pBufferForArgs, AlignedByteOffsetForArgs);
+    #else
+        self->lpVtbl->DrawIndexedInstancedIndirect(self, pBufferForArgs, AlignedByteOffsetForArgs);
+    #endif
+}
+
 static inline void _sg_d3d11_Dispatch(ID3D11DeviceContext* self, UINT ThreadGroupCountX, UINT ThreadGroupCountY, UINT ThreadGroupCountZ) {
     #if defined(__cplusplus)
         self->Dispatch(ThreadGroupCountX, ThreadGroupCountY, ThreadGroupCountZ);
@@ -11687,6 +14579,10 @@ _SOKOL_PRIVATE D3D11_USAGE _sg_d3d11_image_usage(const sg_image_usage* usg) {
         } else {
             return D3D11_USAGE_IMMUTABLE;
         }
+    } else if (usg->dynamic_update) {
+        // allows partial updates via UpdateSubresource(), full updates also go through
+        // UpdateSubresource() (use .stream_update for the Map(WRITE_DISCARD) path)
+        return D3D11_USAGE_DEFAULT;
     } else {
         return D3D11_USAGE_DYNAMIC;
     }
@@ -11707,7 +14603,7 @@ _SOKOL_PRIVATE UINT _sg_d3d11_image_bind_flags(const sg_image_usage* usg, sg_pix
 }
 
 _SOKOL_PRIVATE UINT _sg_d3d11_image_cpu_access_flags(const sg_image_usage* usg) {
-    if (usg->render_attachment || usg->storage_attachment || usg->immutable) {
+    if (usg->render_attachment || usg->storage_attachment || usg->immutable || usg->dynamic_update) {
         return 0;
     } else {
         return D3D11_CPU_ACCESS_WRITE;
@@ -11717,6 +14613,10 @@ _SOKOL_PRIVATE UINT _sg_d3d11_image_cpu_access_flags(const sg_image_usage* usg)
 _SOKOL_PRIVATE D3D11_USAGE _sg_d3d11_buffer_usage(const sg_buffer_usage* usg) {
     if (usg->immutable) {
         return usg->storage_buffer ? D3D11_USAGE_DEFAULT : D3D11_USAGE_IMMUTABLE;
+    } else if (usg->dynamic_update) {
+        // allows partial updates via UpdateSubresource(), full updates also go through
+        // UpdateSubresource() (use .stream_update for the Map(WRITE_DISCARD) path)
+        return D3D11_USAGE_DEFAULT;
     } else {
         return D3D11_USAGE_DYNAMIC;
     }
@@ -11741,11 +14641,18 @@ _SOKOL_PRIVATE UINT _sg_d3d11_buffer_bind_flags(const sg_buffer_usage* usg) {
 }
 
 _SOKOL_PRIVATE UINT _sg_d3d11_buffer_misc_flags(const sg_buffer_usage* usg) {
-    return usg->storage_buffer ? D3D11_RESOURCE_MISC_BUFFER_ALLOW_RAW_VIEWS : 0;
+    UINT res = 0;
+    if (usg->storage_buffer) {
+        res |= D3D11_RESOURCE_MISC_BUFFER_ALLOW_RAW_VIEWS;
+    }
+    if (usg->indirect_buffer) {
+        res |= D3D11_RESOURCE_MISC_DRAWINDIRECT_ARGS;
+    }
+    return res;
 }
 
 _SOKOL_PRIVATE UINT _sg_d3d11_buffer_cpu_access_flags(const sg_buffer_usage* usg) {
-    return usg->immutable ? 0 : D3D11_CPU_ACCESS_WRITE;
+    return (usg->immutable || usg->dynamic_update) ? 0 : D3D11_CPU_ACCESS_WRITE;
 }
 
 _SOKOL_PRIVATE DXGI_FORMAT _sg_d3d11_texture_pixel_format(sg_pixel_format fmt) {
@@ -12056,6 +14963,7 @@ _SOKOL_PRIVATE void _sg_d3d11_init_caps(void) {
     _sg.features.mrt_independent_blend_state = true;
     _sg.features.mrt_independent_write_mask = true;
     _sg.features.compute = true;
+    _sg.features.draw_indirect = true;
     _sg.features.msaa_image_bindings = true;
 
     _sg.limits.max_image_size_2d = 16 * 1024;
@@ -12117,6 +15025,8 @@ _SOKOL_PRIVATE sg_resource_state _sg_d3d11_create_buffer(_sg_buffer_t* buf, cons
     SOKOL_ASSERT(buf && desc);
     SOKOL_ASSERT(!buf->d3d11.buf);
     const bool injected = (0 != desc->d3d11_buffer);
+    // injected non-immutable buffers are expected to be mappable
+    buf->d3d11.usage = (injected && !buf->cmn.usage.immutable) ? D3D11_USAGE_DYNAMIC : _sg_d3d11_buffer_usage(&buf->cmn.usage);
     if (injected) {
         buf->d3d11.buf = (ID3D11Buffer*) desc->d3d11_buffer;
         _sg_d3d11_AddRef(buf->d3d11.buf);
@@ -12219,6 +15129,25 @@ _SOKOL_PRIVATE void _sg_d3d11_fill_subres_data(const _sg_image_t* img, const sg_
     }
 }
 
+// images with generate_mipmaps are D3D11_USAGE_DEFAULT, and only get the top mip level uploaded
+_SOKOL_PRIVATE void _sg_d3d11_update_top_miplevel(_sg_image_t* img, const sg_image_data* data) {
+    SOKOL_ASSERT(img->cmn.generate_mipmaps && (img->d3d11.usage == D3D11_USAGE_DEFAULT));
+    const int num_faces = (img->cmn.type == SG_IMAGETYPE_CUBE) ? 6:1;
+    const int num_slices = (img->cmn.type == SG_IMAGETYPE_ARRAY) ? img->cmn.num_slices:1;
+    const int src_row_pitch = _sg_row_pitch(img->cmn.pixel_format, img->cmn.width, 1);
+    const int src_depth_pitch = _sg_surface_pitch(img->cmn.pixel_format, img->cmn.width, img->cmn.height, 1);
+    for (int face_index = 0; face_index < num_faces; face_index++) {
+        const sg_range* subimg_data = &(data->subimage[face_index][0]);
+        const size_t slice_size = subimg_data->size / (size_t)num_slices;
+        for (int slice_index = 0; slice_index < num_slices; slice_index++) {
+            // see D3D11CalcSubresource()
+            const UINT subres_index = (UINT)((face_index * num_slices + slice_index) * img->cmn.num_mipmaps);
+            const uint8_t* slice_ptr = ((const uint8_t*)subimg_data->ptr) + slice_size * (size_t)slice_index;
+            _sg_d3d11_UpdateSubresource(_sg.d3d11.ctx, img->d3d11.res, subres_index, NULL, slice_ptr, (UINT)src_row_pitch, (UINT)src_depth_pitch);
+        }
+    }
+}
+
 _SOKOL_PRIVATE sg_resource_state _sg_d3d11_create_image(_sg_image_t* img, const sg_image_desc* desc) {
     SOKOL_ASSERT(img && desc);
     SOKOL_ASSERT((0 == img->d3d11.tex2d) && (0 == img->d3d11.tex3d) && (0 == img->d3d11.res) && (0 == img->d3d11.srv));
@@ -12226,6 +15155,13 @@ _SOKOL_PRIVATE sg_resource_state _sg_d3d11_create_image(_sg_image_t* img, const
 
     const bool injected = (0 != desc->d3d11_texture);
     const bool msaa = (img->cmn.sample_count > 1);
+    // injected non-immutable textures are expected to be mappable
+    img->d3d11.usage = (injected && !img->cmn.usage.immutable) ? D3D11_USAGE_DYNAMIC : _sg_d3d11_image_usage(&img->cmn.usage);
+    // GenerateMips() requires a default-usage render target texture
+    const bool gen_mips = img->cmn.generate_mipmaps;
+    if (gen_mips) {
+        img->d3d11.usage = D3D11_USAGE_DEFAULT;
+    }
     SOKOL_ASSERT(!(msaa && (img->cmn.type == SG_IMAGETYPE_CUBE)));
     img->d3d11.format = _sg_d3d11_texture_pixel_format(img->cmn.pixel_format);
     if (img->d3d11.format == DXGI_FORMAT_UNKNOWN) {
@@ -12233,9 +15169,9 @@ _SOKOL_PRIVATE sg_resource_state _sg_d3d11_create_image(_sg_image_t* img, const
         return SG_RESOURCESTATE_FAILED;
     }
 
-    // prepare initial content pointers
+    // prepare initial content pointers (with generate_mipmaps, the top mip level is uploaded after creation)
     D3D11_SUBRESOURCE_DATA* init_data = 0;
-    if (!injected && desc->data.subimage[0][0].ptr) {
+    if (!injected && !gen_mips && desc->data.subimage[0][0].ptr) {
         _sg_d3d11_fill_subres_data(img, &desc->data);
         init_data = _sg.d3d11.subres_data;
     }
@@ -12268,6 +15204,12 @@ _SOKOL_PRIVATE sg_resource_state _sg_d3d11_create_image(_sg_image_t* img, const
             d3d11_tex_desc.SampleDesc.Count = (UINT)img->cmn.sample_count;
             d3d11_tex_desc.SampleDesc.Quality = (UINT) (msaa ? D3D11_STANDARD_MULTISAMPLE_PATTERN : 0);
             d3d11_tex_desc.MiscFlags = (img->cmn.type == SG_IMAGETYPE_CUBE) ? D3D11_RESOURCE_MISC_TEXTURECUBE : 0;
+            if (gen_mips) {
+                d3d11_tex_desc.BindFlags |= D3D11_BIND_RENDER_TARGET;
+                d3d11_tex_desc.Usage = D3D11_USAGE_DEFAULT;
+                d3d11_tex_desc.CPUAccessFlags = 0;
+                d3d11_tex_desc.MiscFlags |= D3D11_RESOURCE_MISC_GENERATE_MIPS;
+            }
             hr = _sg_d3d11_CreateTexture2D(_sg.d3d11.dev, &d3d11_tex_desc, init_data, &img->d3d11.tex2d);
             if (!(SUCCEEDED(hr) && img->d3d11.tex2d)) {
                 _SG_ERROR(D3D11_CREATE_2D_TEXTURE_FAILED);
@@ -12327,6 +15269,12 @@ _SOKOL_PRIVATE sg_resource_state _sg_d3d11_create_image(_sg_image_t* img, const
             d3d11_tex_desc.BindFlags = _sg_d3d11_image_bind_flags(&img->cmn.usage, img->cmn.pixel_format);
             d3d11_tex_desc.Usage = _sg_d3d11_image_usage(&img->cmn.usage);
             d3d11_tex_desc.CPUAccessFlags = _sg_d3d11_image_cpu_access_flags(&img->cmn.usage);
+            if (gen_mips) {
+                d3d11_tex_desc.BindFlags |= D3D11_BIND_RENDER_TARGET;
+                d3d11_tex_desc.Usage = D3D11_USAGE_DEFAULT;
+                d3d11_tex_desc.CPUAccessFlags = 0;
+                d3d11_tex_desc.MiscFlags = D3D11_RESOURCE_MISC_GENERATE_MIPS;
+            }
             if (img->d3d11.format == DXGI_FORMAT_UNKNOWN) {
                 _SG_ERROR(D3D11_CREATE_3D_TEXTURE_UNSUPPORTED_PIXEL_FORMAT);
                 return SG_RESOURCESTATE_FAILED;
@@ -12357,6 +15305,9 @@ _SOKOL_PRIVATE sg_resource_state _sg_d3d11_create_image(_sg_image_t* img, const
         img->d3d11.res = (ID3D11Resource*)img->d3d11.tex3d;
         _sg_d3d11_AddRef(img->d3d11.res);
     }
+    if (gen_mips && desc->data.subimage[0][0].ptr) {
+        _sg_d3d11_update_top_miplevel(img, &desc->data);
+    }
     return SG_RESOURCESTATE_VALID;
 }
 
@@ -13402,6 +16353,15 @@ _SOKOL_PRIVATE void _sg_d3d11_draw(int base_element, int num_elements, int num_i
     }
 }
 
+_SOKOL_PRIVATE void _sg_d3d11_draw_indirect(_sg_buffer_t* buf, int offset) {
+    SOKOL_ASSERT(buf && buf->d3d11.buf);
+    if (_sg.d3d11.use_indexed_draw) {
+        _sg_d3d11_DrawIndexedInstancedIndirect(_sg.d3d11.ctx, buf->d3d11.buf, (UINT)offset);
+    } else {
+        _sg_d3d11_DrawInstancedIndirect(_sg.d3d11.ctx, buf->d3d11.buf, (UINT)offset);
+    }
+}
+
 _SOKOL_PRIVATE void _sg_d3d11_dispatch(int num_groups_x, int num_groups_y, int num_groups_z) {
     _sg_d3d11_Dispatch(_sg.d3d11.ctx, (UINT)num_groups_x, (UINT)num_groups_y, (UINT)num_groups_z);
 }
@@ -13410,10 +16370,137 @@ _SOKOL_PRIVATE void _sg_d3d11_commit(void) {
     // empty
 }
 
+_SOKOL_PRIVATE sg_resource_state _sg_d3d11_create_image_readback(_sg_readback_t* rb, _sg_image_t* img, const sg_image_region* region) {
+    SOKOL_ASSERT(rb && img && region);
+    SOKOL_ASSERT(img->d3d11.res);
+    SOKOL_ASSERT(0 == rb->d3d11.staging);
+    HRESULT hr;
+    D3D11_BOX box;
+    _sg_clear(&box, sizeof(box));
+    box.left = (UINT)region->x;
+    box.top = (UINT)region->y;
+    box.right = (UINT)(region->x + region->width);
+    box.bottom = (UINT)(region->y + region->height);
+    UINT src_subres;
+    if (SG_IMAGETYPE_3D == img->cmn.type) {
+        D3D11_TEXTURE3D_DESC d3d11_tex_desc;
+        _sg_clear(&d3d11_tex_desc, sizeof(d3d11_tex_desc));
+        d3d11_tex_desc.Width = (UINT)region->width;
+        d3d11_tex_desc.Height = (UINT)region->height;
+        d3d11_tex_desc.Depth = 1;
+        d3d11_tex_desc.MipLevels = 1;
+        d3d11_tex_desc.Format = img->d3d11.format;
+        d3d11_tex_desc.Usage = D3D11_USAGE_STAGING;
+        d3d11_tex_desc.CPUAccessFlags = D3D11_CPU_ACCESS_READ;
+        ID3D11Texture3D* tex3d = 0;
+        hr = _sg_d3d11_CreateTexture3D(_sg.d3d11.dev, &d3d11_tex_desc, 0, &tex3d);
+        rb->d3d11.staging = (ID3D11Resource*)tex3d;
+        src_subres = (UINT)region->mip_level;
+        box.front = (UINT)region->slice;
+        box.back = (UINT)region->slice + 1;
+    } else {
+        D3D11_TEXTURE2D_DESC d3d11_tex_desc;
+        _sg_clear(&d3d11_tex_desc, sizeof(d3d11_tex_desc));
+        d3d11_tex_desc.Width = (UINT)region->width;
+        d3d11_tex_desc.Height = (UINT)region->height;
+        d3d11_tex_desc.MipLevels = 1;
+        d3d11_tex_desc.ArraySize = 1;
+        d3d11_tex_desc.Format = img->d3d11.format;
+        d3d11_tex_desc.Usage = D3D11_USAGE_STAGING;
+        d3d11_tex_desc.CPUAccessFlags = D3D11_CPU_ACCESS_READ;
+        d3d11_tex_desc.SampleDesc.Count = 1;
+        ID3D11Texture2D* tex2d = 0;
+        hr = _sg_d3d11_CreateTexture2D(_sg.d3d11.dev, &d3d11_tex_desc, 0, &tex2d);
+        rb->d3d11.staging = (ID3D11Resource*)tex2d;
+        src_subres = D3D11CalcSubresource((UINT)region->mip_level, (UINT)region->slice, (UINT)img->cmn.num_mipmaps);
+        box.front = 0;
+        box.back = 1;
+    }
+    if (!(SUCCEEDED(hr) && rb->d3d11.staging)) {
+        _SG_ERROR(D3D11_CREATE_READBACK_STAGING_FAILED);
+        return SG_RESOURCESTATE_FAILED;
+    }
+    _sg_d3d11_CopySubresourceRegion(_sg.d3d11.ctx, rb->d3d11.staging, 0, 0, 0, 0, img->d3d11.res, src_subres, &box);
+    return SG_RESOURCESTATE_VALID;
+}
+
+_SOKOL_PRIVATE sg_resource_state _sg_d3d11_create_buffer_readback(_sg_readback_t* rb, _sg_buffer_t* buf, int offset) {
+    SOKOL_ASSERT(rb && buf);
+    SOKOL_ASSERT(buf->d3d11.buf);
+    SOKOL_ASSERT(0 == rb->d3d11.staging);
+    D3D11_BUFFER_DESC d3d11_buf_desc;
+    _sg_clear(&d3d11_buf_desc, sizeof(d3d11_buf_desc));
+    d3d11_buf_desc.ByteWidth = (UINT)rb->cmn.size;
+    d3d11_buf_desc.Usage = D3D11_USAGE_STAGING;
+    d3d11_buf_desc.CPUAccessFlags = D3D11_CPU_ACCESS_READ;
+    ID3D11Buffer* staging_buf = 0;
+    HRESULT hr = _sg_d3d11_CreateBuffer(_sg.d3d11.dev, &d3d11_buf_desc, 0, &staging_buf);
+    if (!(SUCCEEDED(hr) && staging_buf)) {
+        _SG_ERROR(D3D11_CREATE_READBACK_STAGING_FAILED);
+        return SG_RESOURCESTATE_FAILED;
+    }
+    rb->d3d11.staging = (ID3D11Resource*)staging_buf;
+    D3D11_BOX box;
+    _sg_clear(&box, sizeof(box));
+    box.left = (UINT)offset;
+    box.right = (UINT)(offset + rb->cmn.size);
+    box.top = 0;
+    box.bottom = 1;
+    box.front = 0;
+    box.back = 1;
+    _sg_d3d11_CopySubresourceRegion(_sg.d3d11.ctx, rb->d3d11.staging, 0, 0, 0, 0, (ID3D11Resource*)buf->d3d11.buf, 0, &box);
+    return SG_RESOURCESTATE_VALID;
+}
+
+_SOKOL_PRIVATE void _sg_d3d11_poll_readback(_sg_readback_t* rb) {
+    SOKOL_ASSERT(rb && rb->d3d11.staging);
+    D3D11_MAPPED_SUBRESOURCE d3d11_msr;
+    HRESULT hr = _sg_d3d11_Map(_sg.d3d11.ctx, rb->d3d11.staging, 0, D3D11_MAP_READ, D3D11_MAP_FLAG_DO_NOT_WAIT, &d3d11_msr);
+    if (DXGI_ERROR_WAS_STILL_DRAWING == hr) {
+        return;
+    }
+    if (SUCCEEDED(hr)) {
+        // the staging resource may have padded rows
+        const uint8_t* src_ptr = (const uint8_t*)d3d11_msr.pData;
+        uint8_t* dst_ptr = (uint8_t*)rb->cmn.data.ptr;
+        for (int y = 0; y < rb->cmn.height; y++) {
+            memcpy(dst_ptr, src_ptr, (size_t)rb->cmn.row_pitch);
+            src_ptr += d3d11_msr.RowPitch;
+            dst_ptr += rb->cmn.row_pitch;
+        }
+        _sg_d3d11_Unmap(_sg.d3d11.ctx, rb->d3d11.staging, 0);
+    } else {
+        _SG_ERROR(D3D11_MAP_FOR_READBACK_FAILED);
+        rb->cmn.failed = true;
+    }
+    rb->cmn.completed = true;
+}
+
+_SOKOL_PRIVATE void _sg_d3d11_discard_readback(_sg_readback_t* rb) {
+    SOKOL_ASSERT(rb);
+    if (rb->d3d11.staging) {
+        _sg_d3d11_Release(rb->d3d11.staging);
+    }
+}
+
+_SOKOL_PRIVATE void _sg_d3d11_update_buffer_subresource(_sg_buffer_t* buf, int offset, const sg_range* data) {
+    D3D11_BOX box;
+    _sg_clear(&box, sizeof(box));
+    box.left = (UINT)offset;
+    box.right = (UINT)offset + (UINT)data->size;
+    box.bottom = 1;
+    box.back = 1;
+    _sg_d3d11_UpdateSubresource(_sg.d3d11.ctx, (ID3D11Resource*)buf->d3d11.buf, 0, &box, data->ptr, 0, 0);
+}
+
 _SOKOL_PRIVATE void _sg_d3d11_update_buffer(_sg_buffer_t* buf, const sg_range* data) {
     SOKOL_ASSERT(buf && data && data->ptr && (data->size > 0));
     SOKOL_ASSERT(_sg.d3d11.ctx);
     SOKOL_ASSERT(buf->d3d11.buf);
+    if (buf->d3d11.usage == D3D11_USAGE_DEFAULT) {
+        _sg_d3d11_update_buffer_subresource(buf, 0, data);
+        return;
+    }
     D3D11_MAPPED_SUBRESOURCE d3d11_msr;
     HRESULT hr = _sg_d3d11_Map(_sg.d3d11.ctx, (ID3D11Resource*)buf->d3d11.buf, 0, D3D11_MAP_WRITE_DISCARD, 0, &d3d11_msr);
     _sg_stats_add(d3d11.num_map, 1);
@@ -13430,6 +16517,10 @@ _SOKOL_PRIVATE void _sg_d3d11_append_buffer(_sg_buffer_t* buf, const sg_range* d
     SOKOL_ASSERT(buf && data && data->ptr && (data->size > 0));
     SOKOL_ASSERT(_sg.d3d11.ctx);
     SOKOL_ASSERT(buf->d3d11.buf);
+    if (buf->d3d11.usage == D3D11_USAGE_DEFAULT) {
+        _sg_d3d11_update_buffer_subresource(buf, buf->cmn.append_pos, data);
+        return;
+    }
     D3D11_MAP map_type = new_frame ? D3D11_MAP_WRITE_DISCARD : D3D11_MAP_WRITE_NO_OVERWRITE;
     D3D11_MAPPED_SUBRESOURCE d3d11_msr;
     HRESULT hr = _sg_d3d11_Map(_sg.d3d11.ctx, (ID3D11Resource*)buf->d3d11.buf, 0, map_type, 0, &d3d11_msr);
@@ -13450,6 +16541,10 @@ _SOKOL_PRIVATE void _sg_d3d11_update_image(_sg_image_t* img, const sg_image_data
     SOKOL_ASSERT(img && data);
     SOKOL_ASSERT(_sg.d3d11.ctx);
     SOKOL_ASSERT(img->d3d11.res);
+    if (img->cmn.generate_mipmaps) {
+        _sg_d3d11_update_top_miplevel(img, data);
+        return;
+    }
     const int num_faces = (img->cmn.type == SG_IMAGETYPE_CUBE) ? 6:1;
     const int num_slices = (img->cmn.type == SG_IMAGETYPE_ARRAY) ? img->cmn.num_slices:1;
     const int num_depth_slices = (img->cmn.type == SG_IMAGETYPE_3D) ? img->cmn.num_slices:1;
@@ -13469,6 +16564,10 @@ _SOKOL_PRIVATE void _sg_d3d11_update_image(_sg_image_t* img, const sg_image_data
                 SOKOL_ASSERT(slice_size == (size_t)(src_depth_pitch * num_depth_slices));
                 const size_t slice_offset = slice_size * (size_t)slice_index;
                 const uint8_t* slice_ptr = ((const uint8_t*)subimg_data->ptr) + slice_offset;
+                if (img->d3d11.usage == D3D11_USAGE_DEFAULT) {
+                    _sg_d3d11_UpdateSubresource(_sg.d3d11.ctx, img->d3d11.res, subres_index, NULL, slice_ptr, (UINT)src_row_pitch, (UINT)src_depth_pitch);
+                    continue;
+                }
                 hr = _sg_d3d11_Map(_sg.d3d11.ctx, img->d3d11.res, subres_index, D3D11_MAP_WRITE_DISCARD, 0, &d3d11_msr);
                 _sg_stats_add(d3d11.num_map, 1);
                 if (SUCCEEDED(hr)) {
@@ -13502,6 +16601,56 @@ _SOKOL_PRIVATE void _sg_d3d11_update_image(_sg_image_t* img, const sg_image_data
     }
 }
 
+_SOKOL_PRIVATE void _sg_d3d11_update_buffer_range(_sg_buffer_t* buf, int offset, const sg_range* data, bool new_frame) {
+    SOKOL_ASSERT(buf && data && data->ptr && (data->size > 0));
+    SOKOL_ASSERT(_sg.d3d11.ctx);
+    SOKOL_ASSERT(buf->d3d11.buf);
+    _SOKOL_UNUSED(new_frame);
+    if (buf->d3d11.usage != D3D11_USAGE_DEFAULT) {
+        _SG_ERROR(D3D11_PARTIAL_UPDATE_REQUIRES_DEFAULT_USAGE);
+        return;
+    }
+    _sg_d3d11_update_buffer_subresource(buf, offset, data);
+}
+
+_SOKOL_PRIVATE void _sg_d3d11_update_image_region(_sg_image_t* img, const sg_image_region* region, const sg_range* data, bool new_frame) {
+    SOKOL_ASSERT(img && region && data && data->ptr);
+    SOKOL_ASSERT(_sg.d3d11.ctx);
+    SOKOL_ASSERT(img->d3d11.res);
+    _SOKOL_UNUSED(new_frame);
+    if (img->d3d11.usage != D3D11_USAGE_DEFAULT) {
+        _SG_ERROR(D3D11_PARTIAL_UPDATE_REQUIRES_DEFAULT_USAGE);
+        return;
+    }
+    D3D11_BOX box;
+    _sg_clear(&box, sizeof(box));
+    box.left = (UINT)region->x;
+    box.top = (UINT)region->y;
+    box.right = (UINT)(region->x + region->width);
+    box.bottom = (UINT)(region->y + region->height);
+    UINT subres_index;
+    if (img->cmn.type == SG_IMAGETYPE_3D) {
+        subres_index = (UINT)region->mip_level;
+        box.front = (UINT)region->slice;
+        box.back = (UINT)region->slice + 1;
+    } else {
+        // see D3D11CalcSubresource()
+        subres_index = (UINT)(region->mip_level + region->slice * img->cmn.num_mipmaps);
+        box.front = 0;
+        box.back = 1;
+    }
+    const int src_row_pitch = _sg_row_pitch(img->cmn.pixel_format, region->width, 1);
+    const int src_depth_pitch = _sg_surface_pitch(img->cmn.pixel_format, region->width, region->height, 1);
+    _sg_d3d11_UpdateSubresource(_sg.d3d11.ctx, img->d3d11.res, subres_index, &box, data->ptr, (UINT)src_row_pitch, (UINT)src_depth_pitch);
+}
+
+_SOKOL_PRIVATE void _sg_d3d11_generate_mipmaps(_sg_image_t* img) {
+    SOKOL_ASSERT(img && img->cmn.generate_mipmaps);
+    SOKOL_ASSERT(_sg.d3d11.ctx);
+    SOKOL_ASSERT(img->d3d11.srv);
+    _sg_d3d11_GenerateMips(_sg.d3d11.ctx, img->d3d11.srv);
+}
+
 // ███    ███ ███████ ████████  █████  ██          ██████   █████   ██████ ██   ██ ███████ ███    ██ ██████
 // ████  ████ ██         ██    ██   ██ ██          ██   ██ ██   ██ ██      ██  ██  ██      ████   ██ ██   ██
 // ██ ████ ██ █████      ██    ███████ ██          ██████  ███████ ██      █████   █████   ██ ██  ██ ██   ██
@@ -13881,12 +17030,13 @@ _SOKOL_PRIVATE size_t _sg_mtl_vertexbuffer_bindslot(size_t sokol_bindslot) {
 _SOKOL_PRIVATE void _sg_mtl_init_pool(const sg_desc* desc) {
     _sg.mtl.idpool.num_slots = 2 *
         (
-            2 * desc->buffer_pool_size +
-            4 * desc->image_pool_size +
+            SG_MAX_UPDATE_SLOTS * desc->buffer_pool_size +
+            (SG_MAX_UPDATE_SLOTS + 2) * desc->image_pool_size +
             1 * desc->sampler_pool_size +
             4 * desc->shader_pool_size +
             2 * desc->pipeline_pool_size +
             desc->attachments_pool_size +
+            2 * desc->readback_pool_size +
             128
         );
     _sg.mtl.idpool.pool = [NSMutableArray arrayWithCapacity:(NSUInteger)_sg.mtl.idpool.num_slots];
@@ -13919,8 +17069,44 @@ _SOKOL_PRIVATE void _sg_mtl_destroy_pool(void) {
     _SG_OBJC_RELEASE(_sg.mtl.idpool.pool);
 }
 
+// grow the exhausted pool to twice its size (only when sg_desc.growable_pools is true)
+_SOKOL_PRIVATE void _sg_mtl_grow_pool(void) {
+    SOKOL_ASSERT(0 == _sg.mtl.idpool.free_queue_top);
+    const int old_num_slots = _sg.mtl.idpool.num_slots;
+    const int new_num_slots = 2 * old_num_slots;
+    NSNull* null = [NSNull null];
+    for (int i = old_num_slots; i < new_num_slots; i++) {
+        [_sg.mtl.idpool.pool addObject:null];
+    }
+    SOKOL_ASSERT([_sg.mtl.idpool.pool count] == (NSUInteger)new_num_slots);
+    // the free queue is empty, so only the new slot indices need to be added
+    _sg_free(_sg.mtl.idpool.free_queue);
+    _sg.mtl.idpool.free_queue = (int*)_sg_malloc_clear((size_t)new_num_slots * sizeof(int));
+    for (int i = new_num_slots-1; i >= old_num_slots; i--) {
+        _sg.mtl.idpool.free_queue[_sg.mtl.idpool.free_queue_top++] = i;
+    }
+    // copy the pending items of the circular release queue into a new, linear queue
+    _sg_mtl_release_item_t* old_release_queue = _sg.mtl.idpool.release_queue;
+    _sg.mtl.idpool.release_queue = (_sg_mtl_release_item_t*)_sg_malloc_clear((size_t)new_num_slots * sizeof(_sg_mtl_release_item_t));
+    int num_pending = 0;
+    for (int i = _sg.mtl.idpool.release_queue_back; i != _sg.mtl.idpool.release_queue_front; i = (i + 1) % old_num_slots) {
+        _sg.mtl.idpool.release_queue[num_pending++] = old_release_queue[i];
+    }
+    for (int i = num_pending; i < new_num_slots; i++) {
+        _sg.mtl.idpool.release_queue[i].frame_index = 0;
+        _sg.mtl.idpool.release_queue[i].slot_index = _SG_MTL_INVALID_SLOT_INDEX;
+    }
+    _sg_free(old_release_queue);
+    _sg.mtl.idpool.release_queue_back = 0;
+    _sg.mtl.idpool.release_queue_front = num_pending;
+    _sg.mtl.idpool.num_slots = new_num_slots;
+}
+
 // get a new free resource pool slot
 _SOKOL_PRIVATE int _sg_mtl_alloc_pool_slot(void) {
+    if ((0 == _sg.mtl.idpool.free_queue_top) && _sg.desc.growable_pools) {
+        _sg_mtl_grow_pool();
+    }
     SOKOL_ASSERT(_sg.mtl.idpool.free_queue_top > 0);
     const int slot_index = _sg.mtl.idpool.free_queue[--_sg.mtl.idpool.free_queue_top];
     SOKOL_ASSERT((slot_index > 0) && (slot_index < _sg.mtl.idpool.num_slots));
@@ -14023,6 +17209,7 @@ _SOKOL_PRIVATE void _sg_mtl_init_caps(void) {
     _sg.features.mrt_independent_blend_state = true;
     _sg.features.mrt_independent_write_mask = true;
     _sg.features.compute = true;
+    _sg.features.draw_indirect = true;
     _sg.features.msaa_image_bindings = true;
 
     _sg.features.image_clamp_to_border = false;
@@ -14301,8 +17488,10 @@ _SOKOL_PRIVATE void _sg_mtl_discard_buffer(_sg_buffer_t* buf) {
 _SOKOL_PRIVATE void _sg_mtl_copy_image_data(const _sg_image_t* img, __unsafe_unretained id<MTLTexture> mtl_tex, const sg_image_data* data) {
     const int num_faces = (img->cmn.type == SG_IMAGETYPE_CUBE) ? 6:1;
     const int num_slices = (img->cmn.type == SG_IMAGETYPE_ARRAY) ? img->cmn.num_slices : 1;
+    // with generate_mipmaps only the top mip level is provided
+    const int num_mips = img->cmn.generate_mipmaps ? 1 : img->cmn.num_mipmaps;
     for (int face_index = 0; face_index < num_faces; face_index++) {
-        for (int mip_index = 0; mip_index < img->cmn.num_mipmaps; mip_index++) {
+        for (int mip_index = 0; mip_index < num_mips; mip_index++) {
             SOKOL_ASSERT(data->subimage[face_index][mip_index].ptr);
             SOKOL_ASSERT(data->subimage[face_index][mip_index].size > 0);
             const uint8_t* data_ptr = (const uint8_t*)data->subimage[face_index][mip_index].ptr;
@@ -14390,7 +17579,7 @@ _SOKOL_PRIVATE sg_resource_state _sg_mtl_create_image(_sg_image_t* img, const sg
     const bool injected = (0 != desc->mtl_textures[0]);
 
     // first initialize all Metal resource pool slots to 'empty'
-    for (int i = 0; i < SG_NUM_INFLIGHT_FRAMES; i++) {
+    for (int i = 0; i < SG_MAX_UPDATE_SLOTS; i++) {
         img->mtl.tex[i] = _sg_mtl_add_resource(nil);
     }
 
@@ -15063,15 +18252,8 @@ _SOKOL_PRIVATE void _sg_mtl_begin_render_pass(const sg_pass* pass) {
     #endif
 }
 
-_SOKOL_PRIVATE void _sg_mtl_begin_pass(const sg_pass* pass) {
-    SOKOL_ASSERT(pass);
-    SOKOL_ASSERT(_sg.mtl.cmd_queue);
-    SOKOL_ASSERT(nil == _sg.mtl.compute_cmd_encoder);
-    SOKOL_ASSERT(nil == _sg.mtl.render_cmd_encoder);
-    SOKOL_ASSERT(nil == _sg.mtl.cur_drawable);
-    _sg_mtl_clear_state_cache();
-
-    // if this is the first pass in the frame, create one command buffer and blit-cmd-encoder for the entire frame
+// create the per-frame command buffer, called from the first sg_begin_pass() or readback in a frame
+_SOKOL_PRIVATE void _sg_mtl_begin_cmd_buffer(void) {
     if (nil == _sg.mtl.cmd_buffer) {
         // block until the oldest frame in flight has finished
         dispatch_semaphore_wait(_sg.mtl.sem, DISPATCH_TIME_FOREVER);
@@ -15087,6 +18269,18 @@ _SOKOL_PRIVATE void _sg_mtl_begin_pass(const sg_pass* pass) {
             dispatch_semaphore_signal(_sg.mtl.sem);
         }];
     }
+}
+
+_SOKOL_PRIVATE void _sg_mtl_begin_pass(const sg_pass* pass) {
+    SOKOL_ASSERT(pass);
+    SOKOL_ASSERT(_sg.mtl.cmd_queue);
+    SOKOL_ASSERT(nil == _sg.mtl.compute_cmd_encoder);
+    SOKOL_ASSERT(nil == _sg.mtl.render_cmd_encoder);
+    SOKOL_ASSERT(nil == _sg.mtl.cur_drawable);
+    _sg_mtl_clear_state_cache();
+
+    // if this is the first pass in the frame, create one command buffer and blit-cmd-encoder for the entire frame
+    _sg_mtl_begin_cmd_buffer();
 
     // if this is first pass in frame, get uniform buffer base pointer
     if (0 == _sg.mtl.cur_ub_base_ptr) {
@@ -15162,28 +18356,107 @@ _SOKOL_PRIVATE void _sg_mtl_commit(void) {
     _sg.mtl.cmd_buffer = nil;
 }
 
-_SOKOL_PRIVATE void _sg_mtl_apply_viewport(int x, int y, int w, int h, bool origin_top_left) {
-    SOKOL_ASSERT(nil != _sg.mtl.render_cmd_encoder);
-    SOKOL_ASSERT(_sg.cur_pass.height > 0);
-    MTLViewport vp;
-    vp.originX = (double) x;
-    vp.originY = (double) (origin_top_left ? y : (_sg.cur_pass.height - (y + h)));
-    vp.width   = (double) w;
-    vp.height  = (double) h;
-    vp.znear   = 0.0;
-    vp.zfar    = 1.0;
-    [_sg.mtl.render_cmd_encoder setViewport:vp];
+// create the shared-storage destination buffer of a readback and keep the current command buffer alive to check its status
+_SOKOL_PRIVATE bool _sg_mtl_begin_readback(_sg_readback_t* rb) {
+    SOKOL_ASSERT(rb && (rb->cmn.size > 0));
+    id<MTLBuffer> mtl_buf = [_sg.mtl.device newBufferWithLength:(NSUInteger)rb->cmn.size options:MTLResourceStorageModeShared];
+    if (nil == mtl_buf) {
+        _SG_ERROR(METAL_CREATE_READBACK_BUFFER_FAILED);
+        return false;
+    }
+    rb->mtl.buf = _sg_mtl_add_resource(mtl_buf);
+    _SG_OBJC_RELEASE(mtl_buf);
+    _sg_mtl_begin_cmd_buffer();
+    // NOTE: MTLCommandBuffer is autoreleased, the id pool takes a reference
+    rb->mtl.cmd_buf = _sg_mtl_add_resource(_sg.mtl.cmd_buffer);
+    return true;
 }
 
-_SOKOL_PRIVATE void _sg_mtl_apply_scissor_rect(int x, int y, int w, int h, bool origin_top_left) {
-    SOKOL_ASSERT(nil != _sg.mtl.render_cmd_encoder);
-    SOKOL_ASSERT(_sg.cur_pass.width > 0);
-    SOKOL_ASSERT(_sg.cur_pass.height > 0);
-    // clip against framebuffer rect
-    const _sg_recti_t clip = _sg_clipi(x, y, w, h, _sg.cur_pass.width, _sg.cur_pass.height);
-    MTLScissorRect r;
-    r.x = (NSUInteger)clip.x;
-    r.y = (NSUInteger) (origin_top_left ? clip.y : (_sg.cur_pass.height - (clip.y + clip.h)));
+_SOKOL_PRIVATE sg_resource_state _sg_mtl_create_image_readback(_sg_readback_t* rb, _sg_image_t* img, const sg_image_region* region) {
+    SOKOL_ASSERT(rb && img && region);
+    SOKOL_ASSERT(img->cmn.active_slot < SG_MAX_UPDATE_SLOTS);
+    SOKOL_ASSERT(nil == _sg.mtl.render_cmd_encoder);
+    SOKOL_ASSERT(nil == _sg.mtl.compute_cmd_encoder);
+    if (!_sg_mtl_begin_readback(rb)) {
+        return SG_RESOURCESTATE_FAILED;
+    }
+    const bool is_3d = SG_IMAGETYPE_3D == img->cmn.type;
+    id<MTLBlitCommandEncoder> blit_cmd_encoder = [_sg.mtl.cmd_buffer blitCommandEncoder];
+    [blit_cmd_encoder copyFromTexture:_sg_mtl_id(img->mtl.tex[img->cmn.active_slot])
+        sourceSlice:is_3d ? 0 : (NSUInteger)region->slice
+        sourceLevel:(NSUInteger)region->mip_level
+        sourceOrigin:MTLOriginMake((NSUInteger)region->x, (NSUInteger)region->y, is_3d ? (NSUInteger)region->slice : 0)
+        sourceSize:MTLSizeMake((NSUInteger)region->width, (NSUInteger)region->height, 1)
+        toBuffer:_sg_mtl_id(rb->mtl.buf)
+        destinationOffset:0
+        destinationBytesPerRow:(NSUInteger)rb->cmn.row_pitch
+        destinationBytesPerImage:(NSUInteger)rb->cmn.size];
+    [blit_cmd_encoder endEncoding];
+    return SG_RESOURCESTATE_VALID;
+}
+
+_SOKOL_PRIVATE sg_resource_state _sg_mtl_create_buffer_readback(_sg_readback_t* rb, _sg_buffer_t* buf, int offset) {
+    SOKOL_ASSERT(rb && buf);
+    SOKOL_ASSERT(buf->cmn.active_slot < SG_MAX_UPDATE_SLOTS);
+    SOKOL_ASSERT(nil == _sg.mtl.render_cmd_encoder);
+    SOKOL_ASSERT(nil == _sg.mtl.compute_cmd_encoder);
+    if (!_sg_mtl_begin_readback(rb)) {
+        return SG_RESOURCESTATE_FAILED;
+    }
+    id<MTLBlitCommandEncoder> blit_cmd_encoder = [_sg.mtl.cmd_buffer blitCommandEncoder];
+    [blit_cmd_encoder copyFromBuffer:_sg_mtl_id(buf->mtl.buf[buf->cmn.active_slot])
+        sourceOffset:(NSUInteger)offset
+        toBuffer:_sg_mtl_id(rb->mtl.buf)
+        destinationOffset:0
+        size:(NSUInteger)rb->cmn.size];
+    [blit_cmd_encoder endEncoding];
+    return SG_RESOURCESTATE_VALID;
+}
+
+_SOKOL_PRIVATE void _sg_mtl_poll_readback(_sg_readback_t* rb) {
+    SOKOL_ASSERT(rb && rb->mtl.buf && rb->mtl.cmd_buf);
+    id<MTLCommandBuffer> cmd_buf = _sg_mtl_id(rb->mtl.cmd_buf);
+    const MTLCommandBufferStatus status = [cmd_buf status];
+    if (status == MTLCommandBufferStatusCompleted) {
+        id<MTLBuffer> mtl_buf = _sg_mtl_id(rb->mtl.buf);
+        memcpy((void*)rb->cmn.data.ptr, [mtl_buf contents], (size_t)rb->cmn.size);
+        rb->cmn.completed = true;
+    } else if (status == MTLCommandBufferStatusError) {
+        _SG_ERROR(METAL_READBACK_COMMAND_BUFFER_FAILED);
+        rb->cmn.failed = true;
+        rb->cmn.completed = true;
+    }
+}
+
+_SOKOL_PRIVATE void _sg_mtl_discard_readback(_sg_readback_t* rb) {
+    SOKOL_ASSERT(rb);
+    // it's valid to call release resource with '0'
+    _sg_mtl_release_resource(_sg.frame_index, rb->mtl.buf);
+    _sg_mtl_release_resource(_sg.frame_index, rb->mtl.cmd_buf);
+}
+
+_SOKOL_PRIVATE void _sg_mtl_apply_viewport(int x, int y, int w, int h, bool origin_top_left) {
+    SOKOL_ASSERT(nil != _sg.mtl.render_cmd_encoder);
+    SOKOL_ASSERT(_sg.cur_pass.height > 0);
+    MTLViewport vp;
+    vp.originX = (double) x;
+    vp.originY = (double) (origin_top_left ? y : (_sg.cur_pass.height - (y + h)));
+    vp.width   = (double) w;
+    vp.height  = (double) h;
+    vp.znear   = 0.0;
+    vp.zfar    = 1.0;
+    [_sg.mtl.render_cmd_encoder setViewport:vp];
+}
+
+_SOKOL_PRIVATE void _sg_mtl_apply_scissor_rect(int x, int y, int w, int h, bool origin_top_left) {
+    SOKOL_ASSERT(nil != _sg.mtl.render_cmd_encoder);
+    SOKOL_ASSERT(_sg.cur_pass.width > 0);
+    SOKOL_ASSERT(_sg.cur_pass.height > 0);
+    // clip against framebuffer rect
+    const _sg_recti_t clip = _sg_clipi(x, y, w, h, _sg.cur_pass.width, _sg.cur_pass.height);
+    MTLScissorRect r;
+    r.x = (NSUInteger)clip.x;
+    r.y = (NSUInteger) (origin_top_left ? clip.y : (_sg.cur_pass.height - (clip.y + clip.h)));
     r.width = (NSUInteger)clip.w;
     r.height = (NSUInteger)clip.h;
     [_sg.mtl.render_cmd_encoder setScissorRect:r];
@@ -15450,6 +18723,29 @@ _SOKOL_PRIVATE void _sg_mtl_draw(int base_element, int num_elements, int num_ins
     }
 }
 
+_SOKOL_PRIVATE void _sg_mtl_draw_indirect(_sg_buffer_t* buf, int offset) {
+    SOKOL_ASSERT(nil != _sg.mtl.render_cmd_encoder);
+    SOKOL_ASSERT(buf && (buf->mtl.buf[buf->cmn.active_slot] != _SG_MTL_INVALID_SLOT_INDEX));
+    const _sg_pipeline_t* pip = _sg_pipeline_ref_ptr(&_sg.cur_pip);
+    SOKOL_ASSERT(pip);
+    if (SG_INDEXTYPE_NONE != pip->cmn.index_type) {
+        // indexed rendering
+        const _sg_buffer_t* ib = _sg_buffer_ref_ptr(&_sg.mtl.state_cache.cur_ibuf);
+        SOKOL_ASSERT(ib && (ib->mtl.buf[ib->cmn.active_slot] != _SG_MTL_INVALID_SLOT_INDEX));
+        [_sg.mtl.render_cmd_encoder drawIndexedPrimitives:pip->mtl.prim_type
+            indexType:pip->mtl.index_type
+            indexBuffer:_sg_mtl_id(ib->mtl.buf[ib->cmn.active_slot])
+            indexBufferOffset:(NSUInteger)_sg.mtl.state_cache.cur_ibuf_offset
+            indirectBuffer:_sg_mtl_id(buf->mtl.buf[buf->cmn.active_slot])
+            indirectBufferOffset:(NSUInteger)offset];
+    } else {
+        // non-indexed rendering
+        [_sg.mtl.render_cmd_encoder drawPrimitives:pip->mtl.prim_type
+            indirectBuffer:_sg_mtl_id(buf->mtl.buf[buf->cmn.active_slot])
+            indirectBufferOffset:(NSUInteger)offset];
+    }
+}
+
 _SOKOL_PRIVATE void _sg_mtl_dispatch(int num_groups_x, int num_groups_y, int num_groups_z) {
     SOKOL_ASSERT(nil != _sg.mtl.compute_cmd_encoder);
     const _sg_pipeline_t* pip = _sg_pipeline_ref_ptr(&_sg.cur_pip);
@@ -15504,6 +18800,102 @@ _SOKOL_PRIVATE void _sg_mtl_update_image(_sg_image_t* img, const sg_image_data*
     _sg_mtl_copy_image_data(img, mtl_tex, data);
 }
 
+// NOTE: dynamic buffers and images are multi-buffered, and partial updates must not
+// scribble over data that might still be used by the GPU. The first partial update in
+// a frame therefore switches to the next slot and carries over the current content
+// (all CPU-side since the resources are shared or managed), following partial updates
+// in the same frame write straight into the new slot.
+_SOKOL_PRIVATE void _sg_mtl_update_buffer_range(_sg_buffer_t* buf, int offset, const sg_range* data, bool new_frame) {
+    SOKOL_ASSERT(buf && data && data->ptr && (data->size > 0));
+    const bool managed = _sg_mtl_resource_options_storage_mode_managed_or_shared() == MTLResourceStorageModeManaged;
+    _SOKOL_UNUSED(managed);
+    if (new_frame && (buf->cmn.num_slots > 1)) {
+        __unsafe_unretained id<MTLBuffer> src_buf = _sg_mtl_id(buf->mtl.buf[buf->cmn.active_slot]);
+        if (++buf->cmn.active_slot >= buf->cmn.num_slots) {
+            buf->cmn.active_slot = 0;
+        }
+        __unsafe_unretained id<MTLBuffer> dst_buf = _sg_mtl_id(buf->mtl.buf[buf->cmn.active_slot]);
+        memcpy([dst_buf contents], [src_buf contents], (size_t)buf->cmn.size);
+        #if defined(_SG_TARGET_MACOS)
+        if (managed) {
+            [dst_buf didModifyRange:NSMakeRange(0, (NSUInteger)buf->cmn.size)];
+        }
+        #endif
+    }
+    __unsafe_unretained id<MTLBuffer> mtl_buf = _sg_mtl_id(buf->mtl.buf[buf->cmn.active_slot]);
+    uint8_t* dst_ptr = ((uint8_t*)[mtl_buf contents]) + offset;
+    memcpy(dst_ptr, data->ptr, data->size);
+    #if defined(_SG_TARGET_MACOS)
+    if (managed) {
+        [mtl_buf didModifyRange:NSMakeRange((NSUInteger)offset, (NSUInteger)data->size)];
+    }
+    #endif
+}
+
+_SOKOL_PRIVATE void _sg_mtl_copy_texture_content(const _sg_image_t* img, __unsafe_unretained id<MTLTexture> src_tex, __unsafe_unretained id<MTLTexture> dst_tex) {
+    const int num_slices = (img->cmn.type == SG_IMAGETYPE_CUBE) ? 6 : ((img->cmn.type == SG_IMAGETYPE_ARRAY) ? img->cmn.num_slices : 1);
+    const int depth = (img->cmn.type == SG_IMAGETYPE_3D) ? img->cmn.num_slices : 1;
+    // the scratch buffer is big enough for the biggest mipmap
+    const size_t scratch_size = (size_t)_sg_surface_pitch(img->cmn.pixel_format, img->cmn.width, img->cmn.height, 1) * (size_t)depth;
+    void* scratch = _sg_malloc(scratch_size);
+    for (int mip_index = 0; mip_index < img->cmn.num_mipmaps; mip_index++) {
+        const int mip_width = _sg_miplevel_dim(img->cmn.width, mip_index);
+        const int mip_height = _sg_miplevel_dim(img->cmn.height, mip_index);
+        const int mip_depth = _sg_miplevel_dim(depth, mip_index);
+        const NSUInteger bytes_per_row = (NSUInteger)_sg_row_pitch(img->cmn.pixel_format, mip_width, 1);
+        const NSUInteger bytes_per_image = (img->cmn.type == SG_IMAGETYPE_3D) ? (NSUInteger)_sg_surface_pitch(img->cmn.pixel_format, mip_width, mip_height, 1) : 0;
+        const MTLRegion region = MTLRegionMake3D(0, 0, 0, (NSUInteger)mip_width, (NSUInteger)mip_height, (NSUInteger)mip_depth);
+        for (int slice_index = 0; slice_index < num_slices; slice_index++) {
+            [src_tex getBytes:scratch bytesPerRow:bytes_per_row bytesPerImage:bytes_per_image fromRegion:region mipmapLevel:(NSUInteger)mip_index slice:(NSUInteger)slice_index];
+            [dst_tex replaceRegion:region mipmapLevel:(NSUInteger)mip_index slice:(NSUInteger)slice_index withBytes:scratch bytesPerRow:bytes_per_row bytesPerImage:bytes_per_image];
+        }
+    }
+    _sg_free(scratch);
+}
+
+_SOKOL_PRIVATE void _sg_mtl_update_image_region(_sg_image_t* img, const sg_image_region* region, const sg_range* data, bool new_frame) {
+    SOKOL_ASSERT(img && region && data && data->ptr);
+    if (new_frame && (img->cmn.num_slots > 1)) {
+        __unsafe_unretained id<MTLTexture> src_tex = _sg_mtl_id(img->mtl.tex[img->cmn.active_slot]);
+        if (++img->cmn.active_slot >= img->cmn.num_slots) {
+            img->cmn.active_slot = 0;
+        }
+        _sg_mtl_copy_texture_content(img, src_tex, _sg_mtl_id(img->mtl.tex[img->cmn.active_slot]));
+    }
+    __unsafe_unretained id<MTLTexture> mtl_tex = _sg_mtl_id(img->mtl.tex[img->cmn.active_slot]);
+    const NSUInteger bytes_per_row = (NSUInteger)_sg_row_pitch(img->cmn.pixel_format, region->width, 1);
+    MTLRegion mtl_region;
+    NSUInteger mtl_slice;
+    NSUInteger bytes_per_image;
+    if (img->cmn.type == SG_IMAGETYPE_3D) {
+        mtl_region = MTLRegionMake3D((NSUInteger)region->x, (NSUInteger)region->y, (NSUInteger)region->slice, (NSUInteger)region->width, (NSUInteger)region->height, 1);
+        mtl_slice = 0;
+        bytes_per_image = bytes_per_row * (NSUInteger)region->height;
+    } else {
+        mtl_region = MTLRegionMake2D((NSUInteger)region->x, (NSUInteger)region->y, (NSUInteger)region->width, (NSUInteger)region->height);
+        mtl_slice = (NSUInteger)region->slice;
+        bytes_per_image = 0;
+    }
+    [mtl_tex replaceRegion:mtl_region
+        mipmapLevel:(NSUInteger)region->mip_level
+        slice:mtl_slice
+        withBytes:data->ptr
+        bytesPerRow:bytes_per_row
+        bytesPerImage:bytes_per_image];
+}
+
+_SOKOL_PRIVATE void _sg_mtl_generate_mipmaps(_sg_image_t* img) {
+    SOKOL_ASSERT(img && img->cmn.generate_mipmaps);
+    SOKOL_ASSERT(nil == _sg.mtl.render_cmd_encoder);
+    SOKOL_ASSERT(nil == _sg.mtl.compute_cmd_encoder);
+    _sg_mtl_begin_cmd_buffer();
+    SOKOL_ASSERT(nil != _sg.mtl.cmd_buffer);
+    __unsafe_unretained id<MTLTexture> mtl_tex = _sg_mtl_id(img->mtl.tex[img->cmn.active_slot]);
+    id<MTLBlitCommandEncoder> blit_cmd_encoder = [_sg.mtl.cmd_buffer blitCommandEncoder];
+    [blit_cmd_encoder generateMipmapsForTexture:mtl_tex];
+    [blit_cmd_encoder endEncoding];
+}
+
 _SOKOL_PRIVATE void _sg_mtl_push_debug_group(const char* name) {
     SOKOL_ASSERT(name);
     if (_sg.mtl.render_cmd_encoder) {
@@ -15558,9 +18950,14 @@ _SOKOL_PRIVATE WGPUBufferUsage _sg_wgpu_buffer_usage(const sg_buffer_usage* usg)
     if (usg->storage_buffer) {
         res |= WGPUBufferUsage_Storage;
     }
+    if (usg->indirect_buffer) {
+        res |= WGPUBufferUsage_Indirect;
+    }
     if (!usg->immutable) {
         res |= WGPUBufferUsage_CopyDst;
     }
+    // required for sg_read_buffer_async()
+    res |= WGPUBufferUsage_CopySrc;
     return (WGPUBufferUsage)res;
 }
 
@@ -15933,6 +19330,7 @@ _SOKOL_PRIVATE void _sg_wgpu_init_caps(void) {
     _sg.features.mrt_independent_blend_state = true;
     _sg.features.mrt_independent_write_mask = true;
     _sg.features.compute = true;
+    _sg.features.draw_indirect = true;
     _sg.features.msaa_image_bindings = true;
 
     wgpuDeviceGetLimits(_sg.wgpu.dev, &_sg.wgpu.limits);
@@ -16093,7 +19491,7 @@ _SOKOL_PRIVATE void _sg_wgpu_bindgroups_pool_init(const sg_desc* desc) {
     _sg_wgpu_bindgroups_pool_t* p = &_sg.wgpu.bindgroups_pool;
     SOKOL_ASSERT(0 == p->bindgroups);
     const int pool_size = desc->wgpu_bindgroups_cache_size;
-    _sg_pool_init(&p->pool, pool_size);
+    _sg_pool_init(&p->pool, pool_size, 0);
     size_t pool_byte_size = sizeof(_sg_wgpu_bindgroup_t) * (size_t)p->pool.size;
     p->bindgroups = (_sg_wgpu_bindgroup_t*) _sg_malloc_clear(pool_byte_size);
 }
@@ -16151,44 +19549,6 @@ _SOKOL_PRIVATE void _sg_wgpu_reset_bindgroup_to_alloc_state(_sg_wgpu_bindgroup_t
     bg->slot.state = SG_RESOURCESTATE_ALLOC;
 }
 
-// MurmurHash64B (see: https://github.com/aappleby/smhasher/blob/61a0530f28277f2e850bfc39600ce61d02b518de/src/MurmurHash2.cpp#L142)
-_SOKOL_PRIVATE uint64_t _sg_wgpu_hash(const void* key, int len, uint64_t seed) {
-    const uint32_t m = 0x5bd1e995;
-    const int r = 24;
-    uint32_t h1 = (uint32_t)seed ^ (uint32_t)len;
-    uint32_t h2 = (uint32_t)(seed >> 32);
-    const uint32_t * data = (const uint32_t *)key;
-    while (len >= 8) {
-        uint32_t k1 = *data++;
-        k1 *= m; k1 ^= k1 >> r; k1 *= m;
-        h1 *= m; h1 ^= k1;
-        len -= 4;
-        uint32_t k2 = *data++;
-        k2 *= m; k2 ^= k2 >> r; k2 *= m;
-        h2 *= m; h2 ^= k2;
-        len -= 4;
-    }
-    if (len >= 4) {
-        uint32_t k1 = *data++;
-        k1 *= m; k1 ^= k1 >> r; k1 *= m;
-        h1 *= m; h1 ^= k1;
-        len -= 4;
-    }
-    switch(len) {
-        case 3: h2 ^= (uint32_t)(((unsigned char*)data)[2] << 16);
-        case 2: h2 ^= (uint32_t)(((unsigned char*)data)[1] << 8);
-        case 1: h2 ^= ((unsigned char*)data)[0];
-        h2 *= m;
-    };
-    h1 ^= h2 >> 18; h1 *= m;
-    h2 ^= h1 >> 22; h2 *= m;
-    h1 ^= h2 >> 17; h1 *= m;
-    h2 ^= h1 >> 19; h2 *= m;
-    uint64_t h = h1;
-    h = (h << 32) | h2;
-    return h;
-}
-
 _SOKOL_PRIVATE uint64_t _sg_wgpu_bindgroups_cache_item(_sg_wgpu_bindgroups_cache_item_type_t type, uint8_t wgpu_binding, uint32_t id, uint32_t uninit_count) {
     const uint64_t bb = wgpu_binding;
     const uint64_t t = type & 7;
@@ -16253,7 +19613,7 @@ _SOKOL_PRIVATE void _sg_wgpu_init_bindgroups_cache_key(_sg_wgpu_bindgroups_cache
         const uint8_t wgpu_binding = shd->wgpu.sbuf_grp1_bnd_n[i];
         key->items[item_idx] = _sg_wgpu_bindgroups_cache_sbuf_item(wgpu_binding, &bnd->sbufs[i]->slot);
     }
-    key->hash = _sg_wgpu_hash(&key->items, (int)sizeof(key->items), 0x1234567887654321);
+    key->hash = _sg_hash(&key->items, (int)sizeof(key->items), 0x1234567887654321);
 }
 
 _SOKOL_PRIVATE bool _sg_wgpu_compare_bindgroups_cache_key(_sg_wgpu_bindgroups_cache_key_t* k0, _sg_wgpu_bindgroups_cache_key_t* k1) {
@@ -16616,6 +19976,145 @@ _SOKOL_PRIVATE bool _sg_wgpu_apply_vertex_buffers(_sg_bindings_ptrs_t* bnd) {
     return true;
 }
 
+// fullscreen-triangle shader which downsamples one mip level into the next
+static const char* _sg_wgpu_mipgen_wgsl =
+    "struct vs_out {\n"
+    "    @builtin(position) pos: vec4f,\n"
+    "    @location(0) uv: vec2f,\n"
+    "}\n"
+    "@vertex fn vs_main(@builtin(vertex_index) vi: u32) -> vs_out {\n"
+    "    var out: vs_out;\n"
+    "    out.uv = vec2f(f32((vi << 1u) & 2u), f32(vi & 2u));\n"
+    "    out.pos = vec4f(out.uv * vec2f(2.0, -2.0) + vec2f(-1.0, 1.0), 0.0, 1.0);\n"
+    "    return out;\n"
+    "}\n"
+    "@group(0) @binding(0) var src_tex: texture_2d<f32>;\n"
+    "@group(0) @binding(1) var src_smp: sampler;\n"
+    "@fragment fn fs_main(in: vs_out) -> @location(0) vec4f {\n"
+    "    return textureSampleLevel(src_tex, src_smp, in.uv, 0.0);\n"
+    "}\n";
+
+// returns the mipmap generation pipeline for a pixel format, creates shared state on first use
+_SOKOL_PRIVATE WGPURenderPipeline _sg_wgpu_mipgen_pipeline(sg_pixel_format fmt) {
+    SOKOL_ASSERT((fmt > SG_PIXELFORMAT_NONE) && (fmt < _SG_PIXELFORMAT_NUM));
+    _sg_wgpu_mipgen_t* mg = &_sg.wgpu.mipgen;
+    if (0 == mg->shd_mod) {
+        WGPUShaderModuleWGSLDescriptor wgpu_shdmod_wgsl_desc;
+        _sg_clear(&wgpu_shdmod_wgsl_desc, sizeof(wgpu_shdmod_wgsl_desc));
+        wgpu_shdmod_wgsl_desc.chain.sType = WGPUSType_ShaderSourceWGSL;
+        wgpu_shdmod_wgsl_desc.code = _sg_wgpu_stringview(_sg_wgpu_mipgen_wgsl);
+        WGPUShaderModuleDescriptor wgpu_shdmod_desc;
+        _sg_clear(&wgpu_shdmod_desc, sizeof(wgpu_shdmod_desc));
+        wgpu_shdmod_desc.nextInChain = &wgpu_shdmod_wgsl_desc.chain;
+        wgpu_shdmod_desc.label = _sg_wgpu_stringview("sokol-gfx-mipgen");
+        mg->shd_mod = wgpuDeviceCreateShaderModule(_sg.wgpu.dev, &wgpu_shdmod_desc);
+        if (0 == mg->shd_mod) {
+            _SG_ERROR(WGPU_CREATE_SHADER_MODULE_FAILED);
+            return 0;
+        }
+    }
+    if (0 == mg->smp) {
+        WGPUSamplerDescriptor wgpu_smp_desc;
+        _sg_clear(&wgpu_smp_desc, sizeof(wgpu_smp_desc));
+        wgpu_smp_desc.addressModeU = WGPUAddressMode_ClampToEdge;
+        wgpu_smp_desc.addressModeV = WGPUAddressMode_ClampToEdge;
+        wgpu_smp_desc.addressModeW = WGPUAddressMode_ClampToEdge;
+        wgpu_smp_desc.magFilter = WGPUFilterMode_Linear;
+        wgpu_smp_desc.minFilter = WGPUFilterMode_Linear;
+        wgpu_smp_desc.mipmapFilter = WGPUMipmapFilterMode_Nearest;
+        wgpu_smp_desc.lodMaxClamp = 32.0f;
+        wgpu_smp_desc.maxAnisotropy = 1;
+        mg->smp = wgpuDeviceCreateSampler(_sg.wgpu.dev, &wgpu_smp_desc);
+        if (0 == mg->smp) {
+            _SG_ERROR(WGPU_CREATE_SAMPLER_FAILED);
+            return 0;
+        }
+    }
+    if (0 == mg->bgl) {
+        WGPUBindGroupLayoutEntry bgl_entries[2];
+        _sg_clear(&bgl_entries, sizeof(bgl_entries));
+        bgl_entries[0].binding = 0;
+        bgl_entries[0].visibility = WGPUShaderStage_Fragment;
+        bgl_entries[0].texture.sampleType = WGPUTextureSampleType_Float;
+        bgl_entries[0].texture.viewDimension = WGPUTextureViewDimension_2D;
+        bgl_entries[1].binding = 1;
+        bgl_entries[1].visibility = WGPUShaderStage_Fragment;
+        bgl_entries[1].sampler.type = WGPUSamplerBindingType_Filtering;
+        WGPUBindGroupLayoutDescriptor bgl_desc;
+        _sg_clear(&bgl_desc, sizeof(bgl_desc));
+        bgl_desc.entryCount = 2;
+        bgl_desc.entries = bgl_entries;
+        mg->bgl = wgpuDeviceCreateBindGroupLayout(_sg.wgpu.dev, &bgl_desc);
+        if (0 == mg->bgl) {
+            _SG_ERROR(WGPU_SHADER_CREATE_BINDGROUP_LAYOUT_FAILED);
+            return 0;
+        }
+    }
+    if (0 == mg->pip_layout) {
+        WGPUPipelineLayoutDescriptor wgpu_pl_desc;
+        _sg_clear(&wgpu_pl_desc, sizeof(wgpu_pl_desc));
+        wgpu_pl_desc.bindGroupLayoutCount = 1;
+        wgpu_pl_desc.bindGroupLayouts = &mg->bgl;
+        mg->pip_layout = wgpuDeviceCreatePipelineLayout(_sg.wgpu.dev, &wgpu_pl_desc);
+        if (0 == mg->pip_layout) {
+            _SG_ERROR(WGPU_CREATE_PIPELINE_LAYOUT_FAILED);
+            return 0;
+        }
+    }
+    if (0 == mg->pip[fmt]) {
+        WGPUColorTargetState wgpu_ctgt_state;
+        _sg_clear(&wgpu_ctgt_state, sizeof(wgpu_ctgt_state));
+        wgpu_ctgt_state.format = _sg_wgpu_textureformat(fmt);
+        wgpu_ctgt_state.writeMask = WGPUColorWriteMask_All;
+        WGPUFragmentState wgpu_frag_state;
+        _sg_clear(&wgpu_frag_state, sizeof(wgpu_frag_state));
+        wgpu_frag_state.module = mg->shd_mod;
+        wgpu_frag_state.entryPoint = _sg_wgpu_stringview("fs_main");
+        wgpu_frag_state.targetCount = 1;
+        wgpu_frag_state.targets = &wgpu_ctgt_state;
+        WGPURenderPipelineDescriptor wgpu_pip_desc;
+        _sg_clear(&wgpu_pip_desc, sizeof(wgpu_pip_desc));
+        wgpu_pip_desc.label = _sg_wgpu_stringview("sokol-gfx-mipgen");
+        wgpu_pip_desc.layout = mg->pip_layout;
+        wgpu_pip_desc.vertex.module = mg->shd_mod;
+        wgpu_pip_desc.vertex.entryPoint = _sg_wgpu_stringview("vs_main");
+        wgpu_pip_desc.primitive.topology = WGPUPrimitiveTopology_TriangleList;
+        wgpu_pip_desc.primitive.frontFace = WGPUFrontFace_CCW;
+        wgpu_pip_desc.primitive.cullMode = WGPUCullMode_None;
+        wgpu_pip_desc.multisample.count = 1;
+        wgpu_pip_desc.multisample.mask = 0xFFFFFFFF;
+        wgpu_pip_desc.fragment = &wgpu_frag_state;
+        mg->pip[fmt] = wgpuDeviceCreateRenderPipeline(_sg.wgpu.dev, &wgpu_pip_desc);
+        if (0 == mg->pip[fmt]) {
+            _SG_ERROR(WGPU_CREATE_RENDER_PIPELINE_FAILED);
+            return 0;
+        }
+    }
+    return mg->pip[fmt];
+}
+
+_SOKOL_PRIVATE void _sg_wgpu_discard_mipgen(void) {
+    _sg_wgpu_mipgen_t* mg = &_sg.wgpu.mipgen;
+    for (int i = 0; i < _SG_PIXELFORMAT_NUM; i++) {
+        if (mg->pip[i]) {
+            wgpuRenderPipelineRelease(mg->pip[i]);
+        }
+    }
+    if (mg->pip_layout) {
+        wgpuPipelineLayoutRelease(mg->pip_layout);
+    }
+    if (mg->bgl) {
+        wgpuBindGroupLayoutRelease(mg->bgl);
+    }
+    if (mg->smp) {
+        wgpuSamplerRelease(mg->smp);
+    }
+    if (mg->shd_mod) {
+        wgpuShaderModuleRelease(mg->shd_mod);
+    }
+    _sg_clear(mg, sizeof(_sg_wgpu_mipgen_t));
+}
+
 _SOKOL_PRIVATE void _sg_wgpu_setup_backend(const sg_desc* desc) {
     SOKOL_ASSERT(desc);
     SOKOL_ASSERT(desc->environment.wgpu.device);
@@ -16659,6 +20158,7 @@ _SOKOL_PRIVATE void _sg_wgpu_discard_backend(void) {
     _sg_wgpu_bindgroups_cache_discard();
     _sg_wgpu_bindgroups_pool_discard();
     _sg_wgpu_uniform_buffer_discard();
+    _sg_wgpu_discard_mipgen();
     wgpuBindGroupRelease(_sg.wgpu.empty_bind_group); _sg.wgpu.empty_bind_group = 0;
     wgpuCommandEncoderRelease(_sg.wgpu.cmd_enc); _sg.wgpu.cmd_enc = 0;
     wgpuQueueRelease(_sg.wgpu.queue); _sg.wgpu.queue = 0;
@@ -16746,8 +20246,10 @@ _SOKOL_PRIVATE void _sg_wgpu_copy_image_data(const _sg_image_t* img, WGPUTexture
     WGPUExtent3D wgpu_extent;
     _sg_clear(&wgpu_extent, sizeof(wgpu_extent));
     const int num_faces = (img->cmn.type == SG_IMAGETYPE_CUBE) ? 6 : 1;
+    // with generate_mipmaps only the top mip level is provided
+    const int num_mips = img->cmn.generate_mipmaps ? 1 : img->cmn.num_mipmaps;
     for (int face_index = 0; face_index < num_faces; face_index++) {
-        for (int mip_index = 0; mip_index < img->cmn.num_mipmaps; mip_index++) {
+        for (int mip_index = 0; mip_index < num_mips; mip_index++) {
             wgpu_copy_tex.mipLevel = (uint32_t)mip_index;
             wgpu_copy_tex.origin.z = (uint32_t)face_index;
             int mip_width = _sg_miplevel_dim(img->cmn.width, mip_index);
@@ -16796,8 +20298,10 @@ _SOKOL_PRIVATE sg_resource_state _sg_wgpu_create_image(_sg_image_t* img, const s
         WGPUTextureDescriptor wgpu_tex_desc;
         _sg_clear(&wgpu_tex_desc, sizeof(wgpu_tex_desc));
         wgpu_tex_desc.label = _sg_wgpu_stringview(desc->label);
-        wgpu_tex_desc.usage = WGPUTextureUsage_TextureBinding|WGPUTextureUsage_CopyDst;
-        if (desc->usage.render_attachment) {
+        // NOTE: CopySrc is required for sg_read_image_async()
+        wgpu_tex_desc.usage = WGPUTextureUsage_TextureBinding|WGPUTextureUsage_CopyDst|WGPUTextureUsage_CopySrc;
+        if (desc->usage.render_attachment || desc->generate_mipmaps) {
+            // NOTE: mipmaps are generated by rendering into each mip level
             wgpu_tex_desc.usage |= WGPUTextureUsage_RenderAttachment;
         }
         if (desc->usage.storage_attachment) {
@@ -17594,6 +21098,114 @@ _SOKOL_PRIVATE void _sg_wgpu_commit(void) {
     _sg.wgpu.cmd_enc = wgpuDeviceCreateCommandEncoder(_sg.wgpu.dev, &cmd_enc_desc);
 }
 
+_SOKOL_PRIVATE bool _sg_wgpu_begin_readback(_sg_readback_t* rb, int row_pitch) {
+    SOKOL_ASSERT(rb && (row_pitch > 0));
+    rb->wgpu.row_pitch = row_pitch;
+    WGPUBufferDescriptor wgpu_buf_desc;
+    _sg_clear(&wgpu_buf_desc, sizeof(wgpu_buf_desc));
+    wgpu_buf_desc.usage = WGPUBufferUsage_MapRead|WGPUBufferUsage_CopyDst;
+    wgpu_buf_desc.size = (uint64_t)row_pitch * (uint64_t)rb->cmn.height;
+    rb->wgpu.buf = wgpuDeviceCreateBuffer(_sg.wgpu.dev, &wgpu_buf_desc);
+    if (0 == rb->wgpu.buf) {
+        _SG_ERROR(WGPU_CREATE_READBACK_BUFFER_FAILED);
+        return false;
+    }
+    return true;
+}
+
+_SOKOL_PRIVATE sg_resource_state _sg_wgpu_create_image_readback(_sg_readback_t* rb, _sg_image_t* img, const sg_image_region* region) {
+    SOKOL_ASSERT(rb && img && region);
+    SOKOL_ASSERT(_sg.wgpu.cmd_enc);
+    // WebGPU requires a row pitch aligned to 256 bytes for texture-to-buffer copies
+    const int row_pitch = (int)_sg_roundup_u64((uint64_t)rb->cmn.row_pitch, _SG_WGPU_ROWPITCH_ALIGN);
+    if (!_sg_wgpu_begin_readback(rb, row_pitch)) {
+        return SG_RESOURCESTATE_FAILED;
+    }
+    WGPUTexelCopyTextureInfo wgpu_copy_tex;
+    _sg_clear(&wgpu_copy_tex, sizeof(wgpu_copy_tex));
+    wgpu_copy_tex.texture = img->wgpu.tex;
+    wgpu_copy_tex.mipLevel = (uint32_t)region->mip_level;
+    wgpu_copy_tex.origin.x = (uint32_t)region->x;
+    wgpu_copy_tex.origin.y = (uint32_t)region->y;
+    wgpu_copy_tex.origin.z = (uint32_t)region->slice;
+    wgpu_copy_tex.aspect = WGPUTextureAspect_All;
+    WGPUTexelCopyBufferInfo wgpu_copy_buf;
+    _sg_clear(&wgpu_copy_buf, sizeof(wgpu_copy_buf));
+    wgpu_copy_buf.layout.bytesPerRow = (uint32_t)row_pitch;
+    wgpu_copy_buf.layout.rowsPerImage = (uint32_t)region->height;
+    wgpu_copy_buf.buffer = rb->wgpu.buf;
+    WGPUExtent3D wgpu_extent;
+    _sg_clear(&wgpu_extent, sizeof(wgpu_extent));
+    wgpu_extent.width = (uint32_t)region->width;
+    wgpu_extent.height = (uint32_t)region->height;
+    wgpu_extent.depthOrArrayLayers = 1;
+    wgpuCommandEncoderCopyTextureToBuffer(_sg.wgpu.cmd_enc, &wgpu_copy_tex, &wgpu_copy_buf, &wgpu_extent);
+    return SG_RESOURCESTATE_VALID;
+}
+
+_SOKOL_PRIVATE sg_resource_state _sg_wgpu_create_buffer_readback(_sg_readback_t* rb, _sg_buffer_t* buf, int offset) {
+    SOKOL_ASSERT(rb && buf);
+    SOKOL_ASSERT(_sg.wgpu.cmd_enc);
+    if (!_sg_wgpu_begin_readback(rb, rb->cmn.size)) {
+        return SG_RESOURCESTATE_FAILED;
+    }
+    wgpuCommandEncoderCopyBufferToBuffer(_sg.wgpu.cmd_enc, buf->wgpu.buf, (uint64_t)offset, rb->wgpu.buf, 0, (uint64_t)rb->cmn.size);
+    return SG_RESOURCESTATE_VALID;
+}
+
+// NOTE: depending on the WebGPU implementation, this may be called from inside
+// wgpuInstanceProcessEvents() or from the browser event loop
+_SOKOL_PRIVATE void _sg_wgpu_readback_map_callback(WGPUMapAsyncStatus status, WGPUStringView message, void* userdata1, void* userdata2) {
+    _SOKOL_UNUSED(message);
+    _SOKOL_UNUSED(userdata2);
+    if (!_sg.valid) {
+        return;
+    }
+    // the readback object may have been destroyed in the meantime
+    _sg_readback_t* rb = _sg_lookup_readback((uint32_t)(uintptr_t)userdata1);
+    if (0 == rb) {
+        return;
+    }
+    if (WGPUMapAsyncStatus_Success == status) {
+        const size_t map_size = (size_t)rb->wgpu.row_pitch * (size_t)rb->cmn.height;
+        const uint8_t* src_ptr = (const uint8_t*)wgpuBufferGetConstMappedRange(rb->wgpu.buf, 0, map_size);
+        SOKOL_ASSERT(src_ptr);
+        uint8_t* dst_ptr = (uint8_t*)rb->cmn.data.ptr;
+        for (int y = 0; y < rb->cmn.height; y++) {
+            memcpy(dst_ptr, src_ptr, (size_t)rb->cmn.row_pitch);
+            src_ptr += rb->wgpu.row_pitch;
+            dst_ptr += rb->cmn.row_pitch;
+        }
+        wgpuBufferUnmap(rb->wgpu.buf);
+    } else {
+        _SG_ERROR(WGPU_MAP_READBACK_BUFFER_FAILED);
+        rb->cmn.failed = true;
+    }
+    rb->cmn.completed = true;
+}
+
+// called after the frame's command buffer has been submitted, the actual completion happens in the map callback
+_SOKOL_PRIVATE void _sg_wgpu_poll_readback(_sg_readback_t* rb) {
+    SOKOL_ASSERT(rb && rb->wgpu.buf);
+    if (!rb->wgpu.map_requested) {
+        rb->wgpu.map_requested = true;
+        WGPUBufferMapCallbackInfo cb_info;
+        _sg_clear(&cb_info, sizeof(cb_info));
+        cb_info.mode = WGPUCallbackMode_AllowSpontaneous;
+        cb_info.callback = _sg_wgpu_readback_map_callback;
+        cb_info.userdata1 = (void*)(uintptr_t)rb->slot.id;
+        const size_t map_size = (size_t)rb->wgpu.row_pitch * (size_t)rb->cmn.height;
+        wgpuBufferMapAsync(rb->wgpu.buf, WGPUMapMode_Read, 0, map_size, cb_info);
+    }
+}
+
+_SOKOL_PRIVATE void _sg_wgpu_discard_readback(_sg_readback_t* rb) {
+    SOKOL_ASSERT(rb);
+    if (rb->wgpu.buf) {
+        wgpuBufferRelease(rb->wgpu.buf);
+    }
+}
+
 _SOKOL_PRIVATE void _sg_wgpu_apply_viewport(int x, int y, int w, int h, bool origin_top_left) {
     SOKOL_ASSERT(_sg.wgpu.rpass_enc);
     // FIXME FIXME FIXME: CLIPPING THE VIEWPORT HERE IS WRONG!!!
@@ -17750,6 +21362,17 @@ _SOKOL_PRIVATE void _sg_wgpu_draw(int base_element, int num_elements, int num_in
     }
 }
 
+_SOKOL_PRIVATE void _sg_wgpu_draw_indirect(_sg_buffer_t* buf, int offset) {
+    SOKOL_ASSERT(_sg.wgpu.rpass_enc);
+    SOKOL_ASSERT(buf && buf->wgpu.buf);
+    const _sg_pipeline_t* pip = _sg_pipeline_ref_ptr(&_sg.cur_pip);
+    if (SG_INDEXTYPE_NONE != pip->cmn.index_type) {
+        wgpuRenderPassEncoderDrawIndexedIndirect(_sg.wgpu.rpass_enc, buf->wgpu.buf, (uint64_t)offset);
+    } else {
+        wgpuRenderPassEncoderDrawIndirect(_sg.wgpu.rpass_enc, buf->wgpu.buf, (uint64_t)offset);
+    }
+}
+
 _SOKOL_PRIVATE void _sg_wgpu_dispatch(int num_groups_x, int num_groups_y, int num_groups_z) {
     SOKOL_ASSERT(_sg.wgpu.cpass_enc);
     wgpuComputePassEncoderDispatchWorkgroups(_sg.wgpu.cpass_enc,
@@ -17774,6 +21397,114 @@ _SOKOL_PRIVATE void _sg_wgpu_update_image(_sg_image_t* img, const sg_image_data*
     SOKOL_ASSERT(img && data);
     _sg_wgpu_copy_image_data(img, img->wgpu.tex, data);
 }
+
+// NOTE: writeBuffer and writeTexture are ordered on the queue, so partial updates are
+// safe without additional synchronization
+_SOKOL_PRIVATE void _sg_wgpu_update_buffer_range(_sg_buffer_t* buf, int offset, const sg_range* data, bool new_frame) {
+    SOKOL_ASSERT(buf && data && data->ptr && (data->size > 0));
+    _SOKOL_UNUSED(new_frame);
+    _sg_wgpu_copy_buffer_data(buf, (uint64_t)offset, data);
+}
+
+_SOKOL_PRIVATE void _sg_wgpu_update_image_region(_sg_image_t* img, const sg_image_region* region, const sg_range* data, bool new_frame) {
+    SOKOL_ASSERT(img && region && data && data->ptr);
+    _SOKOL_UNUSED(new_frame);
+    WGPUTexelCopyBufferLayout wgpu_layout;
+    _sg_clear(&wgpu_layout, sizeof(wgpu_layout));
+    wgpu_layout.bytesPerRow = (uint32_t)_sg_row_pitch(img->cmn.pixel_format, region->width, 1);
+    wgpu_layout.rowsPerImage = (uint32_t)region->height;
+    WGPUTexelCopyTextureInfo wgpu_copy_tex;
+    _sg_clear(&wgpu_copy_tex, sizeof(wgpu_copy_tex));
+    wgpu_copy_tex.texture = img->wgpu.tex;
+    wgpu_copy_tex.mipLevel = (uint32_t)region->mip_level;
+    wgpu_copy_tex.origin.x = (uint32_t)region->x;
+    wgpu_copy_tex.origin.y = (uint32_t)region->y;
+    wgpu_copy_tex.origin.z = (uint32_t)region->slice;
+    wgpu_copy_tex.aspect = WGPUTextureAspect_All;
+    WGPUExtent3D wgpu_extent;
+    _sg_clear(&wgpu_extent, sizeof(wgpu_extent));
+    wgpu_extent.width = (uint32_t)region->width;
+    wgpu_extent.height = (uint32_t)region->height;
+    wgpu_extent.depthOrArrayLayers = 1;
+    wgpuQueueWriteTexture(_sg.wgpu.queue, &wgpu_copy_tex, data->ptr, data->size, &wgpu_layout, &wgpu_extent);
+}
+
+_SOKOL_PRIVATE void _sg_wgpu_generate_mipmaps(_sg_image_t* img) {
+    SOKOL_ASSERT(img && img->cmn.generate_mipmaps);
+    SOKOL_ASSERT(_sg.wgpu.cmd_enc);
+    SOKOL_ASSERT((0 == _sg.wgpu.rpass_enc) && (0 == _sg.wgpu.cpass_enc));
+    if (img->cmn.type == SG_IMAGETYPE_3D) {
+        _SG_ERROR(WGPU_GENERATE_MIPMAPS_3D_IMAGE);
+        return;
+    }
+    WGPURenderPipeline pip = _sg_wgpu_mipgen_pipeline(img->cmn.pixel_format);
+    if (0 == pip) {
+        return;
+    }
+    const int num_layers = (img->cmn.type == SG_IMAGETYPE_CUBE) ? 6 : img->cmn.num_slices;
+    WGPUTextureViewDescriptor wgpu_texview_desc;
+    _sg_clear(&wgpu_texview_desc, sizeof(wgpu_texview_desc));
+    wgpu_texview_desc.format = _sg_wgpu_textureformat(img->cmn.pixel_format);
+    wgpu_texview_desc.dimension = WGPUTextureViewDimension_2D;
+    wgpu_texview_desc.mipLevelCount = 1;
+    wgpu_texview_desc.arrayLayerCount = 1;
+    wgpu_texview_desc.aspect = WGPUTextureAspect_All;
+    for (int layer_index = 0; layer_index < num_layers; layer_index++) {
+        wgpu_texview_desc.baseArrayLayer = (uint32_t)layer_index;
+        for (int mip_index = 1; mip_index < img->cmn.num_mipmaps; mip_index++) {
+            wgpu_texview_desc.baseMipLevel = (uint32_t)(mip_index - 1);
+            WGPUTextureView src_view = wgpuTextureCreateView(img->wgpu.tex, &wgpu_texview_desc);
+            wgpu_texview_desc.baseMipLevel = (uint32_t)mip_index;
+            WGPUTextureView dst_view = wgpuTextureCreateView(img->wgpu.tex, &wgpu_texview_desc);
+            if ((0 == src_view) || (0 == dst_view)) {
+                _SG_ERROR(WGPU_CREATE_TEXTURE_VIEW_FAILED);
+                if (src_view) {
+                    wgpuTextureViewRelease(src_view);
+                }
+                if (dst_view) {
+                    wgpuTextureViewRelease(dst_view);
+                }
+                return;
+            }
+            WGPUBindGroupEntry bg_entries[2];
+            _sg_clear(&bg_entries, sizeof(bg_entries));
+            bg_entries[0].binding = 0;
+            bg_entries[0].textureView = src_view;
+            bg_entries[1].binding = 1;
+            bg_entries[1].sampler = _sg.wgpu.mipgen.smp;
+            WGPUBindGroupDescriptor bg_desc;
+            _sg_clear(&bg_desc, sizeof(bg_desc));
+            bg_desc.layout = _sg.wgpu.mipgen.bgl;
+            bg_desc.entryCount = 2;
+            bg_desc.entries = bg_entries;
+            WGPUBindGroup bg = wgpuDeviceCreateBindGroup(_sg.wgpu.dev, &bg_desc);
+            if (bg) {
+                WGPURenderPassColorAttachment wgpu_color_att;
+                _sg_clear(&wgpu_color_att, sizeof(wgpu_color_att));
+                wgpu_color_att.depthSlice = WGPU_DEPTH_SLICE_UNDEFINED;
+                wgpu_color_att.view = dst_view;
+                wgpu_color_att.loadOp = WGPULoadOp_Clear;
+                wgpu_color_att.storeOp = WGPUStoreOp_Store;
+                WGPURenderPassDescriptor wgpu_pass_desc;
+                _sg_clear(&wgpu_pass_desc, sizeof(wgpu_pass_desc));
+                wgpu_pass_desc.colorAttachmentCount = 1;
+                wgpu_pass_desc.colorAttachments = &wgpu_color_att;
+                WGPURenderPassEncoder rpass_enc = wgpuCommandEncoderBeginRenderPass(_sg.wgpu.cmd_enc, &wgpu_pass_desc);
+                SOKOL_ASSERT(rpass_enc);
+                wgpuRenderPassEncoderSetPipeline(rpass_enc, pip);
+                wgpuRenderPassEncoderSetBindGroup(rpass_enc, 0, bg, 0, 0);
+                wgpuRenderPassEncoderDraw(rpass_enc, 3, 1, 0, 0);
+                wgpuRenderPassEncoderEnd(rpass_enc);
+                wgpuRenderPassEncoderRelease(rpass_enc);
+                wgpuBindGroupRelease(bg);
+            } else {
+                _SG_ERROR(WGPU_CREATEBINDGROUP_FAILED);
+            }
+            wgpuTextureViewRelease(dst_view);
+            wgpuTextureViewRelease(src_view);
+        }
+    }
+}
 #endif
 
 //  ██████  ███████ ███    ██ ███████ ██████  ██  ██████     ██████   █████   ██████ ██   ██ ███████ ███    ██ ██████
@@ -18151,6 +21882,22 @@ static inline void _sg_draw(int base_element, int num_elements, int num_instance
     #endif
 }
 
+static inline void _sg_draw_indirect(_sg_buffer_t* buf, int offset) {
+    #if defined(_SOKOL_ANY_GL)
+    _sg_gl_draw_indirect(buf, offset);
+    #elif defined(SOKOL_METAL)
+    _sg_mtl_draw_indirect(buf, offset);
+    #elif defined(SOKOL_D3D11)
+    _sg_d3d11_draw_indirect(buf, offset);
+    #elif defined(SOKOL_WGPU)
+    _sg_wgpu_draw_indirect(buf, offset);
+    #elif defined(SOKOL_DUMMY_BACKEND)
+    _sg_dummy_draw_indirect(buf, offset);
+    #else
+    #error("INVALID BACKEND");
+    #endif
+}
+
 static inline void _sg_dispatch(int num_groups_x, int num_groups_y, int num_groups_z) {
     #if defined(_SOKOL_ANY_GL)
     _sg_gl_dispatch(num_groups_x, num_groups_y, num_groups_z);
@@ -18183,17 +21930,81 @@ static inline void _sg_commit(void) {
     #endif
 }
 
-static inline void _sg_update_buffer(_sg_buffer_t* buf, const sg_range* data) {
+static inline sg_resource_state _sg_create_image_readback(_sg_readback_t* rb, _sg_image_t* img, const sg_image_region* region) {
     #if defined(_SOKOL_ANY_GL)
-    _sg_gl_update_buffer(buf, data);
+    return _sg_gl_create_image_readback(rb, img, region);
     #elif defined(SOKOL_METAL)
-    _sg_mtl_update_buffer(buf, data);
+    return _sg_mtl_create_image_readback(rb, img, region);
     #elif defined(SOKOL_D3D11)
-    _sg_d3d11_update_buffer(buf, data);
+    return _sg_d3d11_create_image_readback(rb, img, region);
     #elif defined(SOKOL_WGPU)
-    _sg_wgpu_update_buffer(buf, data);
+    return _sg_wgpu_create_image_readback(rb, img, region);
     #elif defined(SOKOL_DUMMY_BACKEND)
-    _sg_dummy_update_buffer(buf, data);
+    return _sg_dummy_create_image_readback(rb, img, region);
+    #else
+    #error("INVALID BACKEND");
+    #endif
+}
+
+static inline sg_resource_state _sg_create_buffer_readback(_sg_readback_t* rb, _sg_buffer_t* buf, int offset) {
+    #if defined(_SOKOL_ANY_GL)
+    return _sg_gl_create_buffer_readback(rb, buf, offset);
+    #elif defined(SOKOL_METAL)
+    return _sg_mtl_create_buffer_readback(rb, buf, offset);
+    #elif defined(SOKOL_D3D11)
+    return _sg_d3d11_create_buffer_readback(rb, buf, offset);
+    #elif defined(SOKOL_WGPU)
+    return _sg_wgpu_create_buffer_readback(rb, buf, offset);
+    #elif defined(SOKOL_DUMMY_BACKEND)
+    return _sg_dummy_create_buffer_readback(rb, buf, offset);
+    #else
+    #error("INVALID BACKEND");
+    #endif
+}
+
+static inline void _sg_poll_readback(_sg_readback_t* rb) {
+    #if defined(_SOKOL_ANY_GL)
+    _sg_gl_poll_readback(rb);
+    #elif defined(SOKOL_METAL)
+    _sg_mtl_poll_readback(rb);
+    #elif defined(SOKOL_D3D11)
+    _sg_d3d11_poll_readback(rb);
+    #elif defined(SOKOL_WGPU)
+    _sg_wgpu_poll_readback(rb);
+    #elif defined(SOKOL_DUMMY_BACKEND)
+    _sg_dummy_poll_readback(rb);
+    #else
+    #error("INVALID BACKEND");
+    #endif
+}
+
+static inline void _sg_discard_readback(_sg_readback_t* rb) {
+    #if defined(_SOKOL_ANY_GL)
+    _sg_gl_discard_readback(rb);
+    #elif defined(SOKOL_METAL)
+    _sg_mtl_discard_readback(rb);
+    #elif defined(SOKOL_D3D11)
+    _sg_d3d11_discard_readback(rb);
+    #elif defined(SOKOL_WGPU)
+    _sg_wgpu_discard_readback(rb);
+    #elif defined(SOKOL_DUMMY_BACKEND)
+    _sg_dummy_discard_readback(rb);
+    #else
+    #error("INVALID BACKEND");
+    #endif
+}
+
+static inline void _sg_update_buffer(_sg_buffer_t* buf, const sg_range* data) {
+    #if defined(_SOKOL_ANY_GL)
+    _sg_gl_update_buffer(buf, data);
+    #elif defined(SOKOL_METAL)
+    _sg_mtl_update_buffer(buf, data);
+    #elif defined(SOKOL_D3D11)
+    _sg_d3d11_update_buffer(buf, data);
+    #elif defined(SOKOL_WGPU)
+    _sg_wgpu_update_buffer(buf, data);
+    #elif defined(SOKOL_DUMMY_BACKEND)
+    _sg_dummy_update_buffer(buf, data);
     #else
     #error("INVALID BACKEND");
     #endif
@@ -18231,6 +22042,54 @@ static inline void _sg_update_image(_sg_image_t* img, const sg_image_data* data)
     #endif
 }
 
+static inline void _sg_update_buffer_range(_sg_buffer_t* buf, int offset, const sg_range* data, bool new_frame) {
+    #if defined(_SOKOL_ANY_GL)
+    _sg_gl_update_buffer_range(buf, offset, data, new_frame);
+    #elif defined(SOKOL_METAL)
+    _sg_mtl_update_buffer_range(buf, offset, data, new_frame);
+    #elif defined(SOKOL_D3D11)
+    _sg_d3d11_update_buffer_range(buf, offset, data, new_frame);
+    #elif defined(SOKOL_WGPU)
+    _sg_wgpu_update_buffer_range(buf, offset, data, new_frame);
+    #elif defined(SOKOL_DUMMY_BACKEND)
+    _sg_dummy_update_buffer_range(buf, offset, data, new_frame);
+    #else
+    #error("INVALID BACKEND");
+    #endif
+}
+
+static inline void _sg_update_image_region(_sg_image_t* img, const sg_image_region* region, const sg_range* data, bool new_frame) {
+    #if defined(_SOKOL_ANY_GL)
+    _sg_gl_update_image_region(img, region, data, new_frame);
+    #elif defined(SOKOL_METAL)
+    _sg_mtl_update_image_region(img, region, data, new_frame);
+    #elif defined(SOKOL_D3D11)
+    _sg_d3d11_update_image_region(img, region, data, new_frame);
+    #elif defined(SOKOL_WGPU)
+    _sg_wgpu_update_image_region(img, region, data, new_frame);
+    #elif defined(SOKOL_DUMMY_BACKEND)
+    _sg_dummy_update_image_region(img, region, data, new_frame);
+    #else
+    #error("INVALID BACKEND");
+    #endif
+}
+
+static inline void _sg_generate_mipmaps(_sg_image_t* img) {
+    #if defined(_SOKOL_ANY_GL)
+    _sg_gl_generate_mipmaps(img);
+    #elif defined(SOKOL_METAL)
+    _sg_mtl_generate_mipmaps(img);
+    #elif defined(SOKOL_D3D11)
+    _sg_d3d11_generate_mipmaps(img);
+    #elif defined(SOKOL_WGPU)
+    _sg_wgpu_generate_mipmaps(img);
+    #elif defined(SOKOL_DUMMY_BACKEND)
+    _sg_dummy_generate_mipmaps(img);
+    #else
+    #error("INVALID BACKEND");
+    #endif
+}
+
 static inline void _sg_push_debug_group(const char* name) {
     #if defined(SOKOL_METAL)
     _sg_mtl_push_debug_group(name);
@@ -18245,6 +22104,20 @@ static inline void _sg_pop_debug_group(void) {
     #endif
 }
 
+static inline void _sg_begin_gpu_timing(const char* label) {
+    #if defined(_SOKOL_ANY_GL)
+    _sg_gl_begin_gpu_timing(label);
+    #else
+    _SOKOL_UNUSED(label);
+    #endif
+}
+
+static inline void _sg_end_gpu_timing(void) {
+    #if defined(_SOKOL_ANY_GL)
+    _sg_gl_end_gpu_timing();
+    #endif
+}
+
 // ██    ██  █████  ██      ██ ██████   █████  ████████ ██  ██████  ███    ██
 // ██    ██ ██   ██ ██      ██ ██   ██ ██   ██    ██    ██ ██    ██ ████   ██
 // ██    ██ ███████ ██      ██ ██   ██ ███████    ██    ██ ██    ██ ██ ██  ██
@@ -18254,11 +22127,11 @@ static inline void _sg_pop_debug_group(void) {
 // >>validation
 #if defined(SOKOL_DEBUG)
 _SOKOL_PRIVATE void _sg_validate_begin(void) {
-    _sg.validate_error = SG_LOGITEM_OK;
+    _sg_validate_error = SG_LOGITEM_OK;
 }
 
 _SOKOL_PRIVATE bool _sg_validate_end(void) {
-    if (_sg.validate_error != SG_LOGITEM_OK) {
+    if (_sg_validate_error != SG_LOGITEM_OK) {
         #if !defined(SOKOL_VALIDATE_NON_FATAL)
             _SG_PANIC(VALIDATION_FAILED);
             return false;
@@ -18311,6 +22184,14 @@ _SOKOL_PRIVATE bool _sg_validate_buffer_desc(const sg_buffer_desc* desc) {
             _SG_VALIDATE(_sg.features.compute, VALIDATE_BUFFERDESC_STORAGEBUFFER_SUPPORTED);
             _SG_VALIDATE(_sg_multiple_u64(desc->size, 4), VALIDATE_BUFFERDESC_STORAGEBUFFER_SIZE_MULTIPLE_4);
         }
+        if (desc->usage.indirect_buffer) {
+            _SG_VALIDATE(_sg.features.draw_indirect, VALIDATE_BUFFERDESC_INDIRECTBUFFER_SUPPORTED);
+            _SG_VALIDATE(_sg_multiple_u64(desc->size, 4), VALIDATE_BUFFERDESC_INDIRECTBUFFER_SIZE_MULTIPLE_4);
+        }
+        _SG_VALIDATE((desc->num_update_slots >= 1) && (desc->num_update_slots <= SG_MAX_UPDATE_SLOTS), VALIDATE_BUFFERDESC_NUM_UPDATE_SLOTS);
+        if (injected) {
+            _SG_VALIDATE(desc->num_update_slots <= SG_NUM_INFLIGHT_FRAMES, VALIDATE_BUFFERDESC_INJECTED_NUM_UPDATE_SLOTS);
+        }
         return _sg_validate_end();
     #endif
 }
@@ -18394,13 +22275,13 @@ _SOKOL_PRIVATE bool _sg_validate_image_desc(const sg_image_desc* desc) {
                 _SG_VALIDATE(usage->immutable, VALIDATE_IMAGEDESC_COMPRESSED_IMMUTABLE);
             }
             if (!injected && usage->immutable) {
-                // image desc must have valid data
+                // image desc must have valid data (only the top mip level with generate_mipmaps)
                 _sg_validate_image_data(&desc->data,
                     desc->pixel_format,
                     desc->width,
                     desc->height,
                     (desc->type == SG_IMAGETYPE_CUBE) ? 6 : 1,
-                    desc->num_mipmaps,
+                    desc->generate_mipmaps ? 1 : desc->num_mipmaps,
                     desc->num_slices);
             } else {
                 // image desc must not have data
@@ -18418,6 +22299,24 @@ _SOKOL_PRIVATE bool _sg_validate_image_desc(const sg_image_desc* desc) {
                 }
             }
         }
+        if (desc->generate_mipmaps) {
+            SOKOL_ASSERT(((int)fmt >= 0) && ((int)fmt < _SG_PIXELFORMAT_NUM));
+            const bool genmips_fmt = _sg.formats[fmt].filter && _sg.formats[fmt].render
+                && !_sg_is_depth_or_depth_stencil_format(fmt)
+                && !_sg_is_compressed_pixel_format(fmt);
+            _SG_VALIDATE(genmips_fmt, VALIDATE_IMAGEDESC_GENMIPMAPS_PIXELFORMAT);
+            _SG_VALIDATE(desc->sample_count == 1, VALIDATE_IMAGEDESC_GENMIPMAPS_MSAA);
+            _SG_VALIDATE(!injected, VALIDATE_IMAGEDESC_GENMIPMAPS_INJECTED);
+            for (int face_index = 0; face_index < SG_CUBEFACE_NUM; face_index++) {
+                for (int mip_index = 1; mip_index < SG_MAX_MIPMAPS; mip_index++) {
+                    _SG_VALIDATE(0 == desc->data.subimage[face_index][mip_index].ptr, VALIDATE_IMAGEDESC_GENMIPMAPS_MIPDATA);
+                }
+            }
+        }
+        _SG_VALIDATE((desc->num_update_slots >= 1) && (desc->num_update_slots <= SG_MAX_UPDATE_SLOTS), VALIDATE_IMAGEDESC_NUM_UPDATE_SLOTS);
+        if (injected) {
+            _SG_VALIDATE(desc->num_update_slots <= SG_NUM_INFLIGHT_FRAMES, VALIDATE_IMAGEDESC_INJECTED_NUM_UPDATE_SLOTS);
+        }
         return _sg_validate_end();
     #endif
 }
@@ -19300,6 +23199,175 @@ _SOKOL_PRIVATE bool _sg_validate_apply_pipeline(sg_pipeline pip_id) {
     #endif
 }
 
+#if defined(SOKOL_DEBUG)
+_SOKOL_PRIVATE bool _sg_validate_bindings_not_empty(const sg_bindings* bindings) {
+    bool has_any_bindings = bindings->index_buffer.id != SG_INVALID_ID;
+    if (!has_any_bindings) for (size_t i = 0; i < SG_MAX_VERTEXBUFFER_BINDSLOTS; i++) {
+        has_any_bindings |= bindings->vertex_buffers[i].id != SG_INVALID_ID;
+    }
+    if (!has_any_bindings) for (size_t i = 0; i < SG_MAX_IMAGE_BINDSLOTS; i++) {
+        has_any_bindings |= bindings->images[i].id != SG_INVALID_ID;
+    }
+    if (!has_any_bindings) for (size_t i = 0; i < SG_MAX_SAMPLER_BINDSLOTS; i++) {
+        has_any_bindings |= bindings->samplers[i].id != SG_INVALID_ID;
+    }
+    if (!has_any_bindings) for (size_t i = 0; i < SG_MAX_STORAGEBUFFER_BINDSLOTS; i++) {
+        has_any_bindings |= bindings->storage_buffers[i].id != SG_INVALID_ID;
+    }
+    return has_any_bindings;
+}
+
+// checks shared by sg_apply_bindings() and sg_make_bindgroup()
+_SOKOL_PRIVATE void _sg_validate_bindings_vs_pipeline(const sg_bindings* bindings, const _sg_pipeline_t* pip, const _sg_shader_t* shd, bool is_compute) {
+    if (is_compute) {
+        for (size_t i = 0; i < SG_MAX_VERTEXBUFFER_BINDSLOTS; i++) {
+            _SG_VALIDATE(bindings->vertex_buffers[i].id == SG_INVALID_ID, VALIDATE_ABND_COMPUTE_EXPECTED_NO_VBS);
+        }
+    } else {
+        // has expected vertex buffers, and vertex buffers still exist
+        for (size_t i = 0; i < SG_MAX_VERTEXBUFFER_BINDSLOTS; i++) {
+            if (pip->cmn.vertex_buffer_layout_active[i]) {
+                _SG_VALIDATE(bindings->vertex_buffers[i].id != SG_INVALID_ID, VALIDATE_ABND_EXPECTED_VB);
+                // buffers in vertex-buffer-slots must have vertex buffer usage
+                if (bindings->vertex_buffers[i].id != SG_INVALID_ID) {
+                    const _sg_buffer_t* buf = _sg_lookup_buffer(bindings->vertex_buffers[i].id);
+                    _SG_VALIDATE(buf != 0, VALIDATE_ABND_VB_ALIVE);
+                    // NOTE: state != VALID is legal and skips rendering!
+                    if (buf && buf->slot.state == SG_RESOURCESTATE_VALID) {
+                        _SG_VALIDATE(buf->cmn.usage.vertex_buffer, VALIDATE_ABND_VB_TYPE);
+                        _SG_VALIDATE(!buf->cmn.append_overflow, VALIDATE_ABND_VB_OVERFLOW);
+                    }
+                }
+            }
+        }
+    }
+
+    if (is_compute) {
+        _SG_VALIDATE(bindings->index_buffer.id == SG_INVALID_ID, VALIDATE_ABND_COMPUTE_EXPECTED_NO_IB);
+    } else {
+        // index buffer expected or not, and index buffer still exists
+        if (pip->cmn.index_type == SG_INDEXTYPE_NONE) {
+            // pipeline defines non-indexed rendering, but index buffer provided
+            _SG_VALIDATE(bindings->index_buffer.id == SG_INVALID_ID, VALIDATE_ABND_IB);
+        } else {
+            // pipeline defines indexed rendering, but no index buffer provided
+            _SG_VALIDATE(bindings->index_buffer.id != SG_INVALID_ID, VALIDATE_ABND_NO_IB);
+        }
+        if (bindings->index_buffer.id != SG_INVALID_ID) {
+            // buffer in index-buffer-slot must have index buffer usage
+            const _sg_buffer_t* buf = _sg_lookup_buffer(bindings->index_buffer.id);
+            _SG_VALIDATE(buf != 0, VALIDATE_ABND_IB_ALIVE);
+            // NOTE: state != VALID is legal and skips rendering!
+            if (buf && buf->slot.state == SG_RESOURCESTATE_VALID) {
+                _SG_VALIDATE(buf->cmn.usage.index_buffer, VALIDATE_ABND_IB_TYPE);
+                _SG_VALIDATE(!buf->cmn.append_overflow, VALIDATE_ABND_IB_OVERFLOW);
+            }
+        }
+    }
+
+    // has expected images
+    for (size_t i = 0; i < SG_MAX_IMAGE_BINDSLOTS; i++) {
+        if (shd->cmn.images[i].stage != SG_SHADERSTAGE_NONE) {
+            _SG_VALIDATE(bindings->images[i].id != SG_INVALID_ID, VALIDATE_ABND_EXPECTED_IMAGE_BINDING);
+            if (bindings->images[i].id != SG_INVALID_ID) {
+                const _sg_image_t* img = _sg_lookup_image(bindings->images[i].id);
+                _SG_VALIDATE(img != 0, VALIDATE_ABND_IMG_ALIVE);
+                // NOTE: state != VALID is legal and skips rendering!
+                if (img && img->slot.state == SG_RESOURCESTATE_VALID) {
+                    _SG_VALIDATE(img->cmn.type == shd->cmn.images[i].image_type, VALIDATE_ABND_IMAGE_TYPE_MISMATCH);
+                    if (!_sg.features.msaa_image_bindings) {
+                        _SG_VALIDATE(img->cmn.sample_count == 1, VALIDATE_ABND_IMAGE_MSAA);
+                    }
+                    if (shd->cmn.images[i].multisampled) {
+                        _SG_VALIDATE(img->cmn.sample_count > 1, VALIDATE_ABND_EXPECTED_MULTISAMPLED_IMAGE);
+                    }
+                    const _sg_pixelformat_info_t* info = &_sg.formats[img->cmn.pixel_format];
+                    switch (shd->cmn.images[i].sample_type) {
+                        case SG_IMAGESAMPLETYPE_FLOAT:
+                            _SG_VALIDATE(info->filter, VALIDATE_ABND_EXPECTED_FILTERABLE_IMAGE);
+                            break;
+                        case SG_IMAGESAMPLETYPE_DEPTH:
+                            _SG_VALIDATE(info->depth, VALIDATE_ABND_EXPECTED_DEPTH_IMAGE);
+                            break;
+                        default:
+                            break;
+                    }
+                }
+            }
+        }
+    }
+
+    // has expected samplers
+    for (size_t i = 0; i < SG_MAX_SAMPLER_BINDSLOTS; i++) {
+        if (shd->cmn.samplers[i].stage != SG_SHADERSTAGE_NONE) {
+            _SG_VALIDATE(bindings->samplers[i].id != SG_INVALID_ID, VALIDATE_ABND_EXPECTED_SAMPLER_BINDING);
+            if (bindings->samplers[i].id != SG_INVALID_ID) {
+                const _sg_sampler_t* smp = _sg_lookup_sampler(bindings->samplers[i].id);
+                _SG_VALIDATE(smp != 0, VALIDATE_ABND_SMP_ALIVE);
+                if (smp) {
+                    // NOTE: for samplers we're specifically checking that they are in valid state
+                    // (technically an invalid sample skips rendering, but an invalid sampler is
+                    // most likely an oversight)
+                    _SG_VALIDATE(smp->slot.state == SG_RESOURCESTATE_VALID, VALIDATE_ABND_SMP_VALID);
+                    if (shd->cmn.samplers[i].sampler_type == SG_SAMPLERTYPE_COMPARISON) {
+                        _SG_VALIDATE(smp->cmn.compare != SG_COMPAREFUNC_NEVER, VALIDATE_ABND_UNEXPECTED_SAMPLER_COMPARE_NEVER);
+                    } else {
+                        _SG_VALIDATE(smp->cmn.compare == SG_COMPAREFUNC_NEVER, VALIDATE_ABND_EXPECTED_SAMPLER_COMPARE_NEVER);
+                    }
+                    if (shd->cmn.samplers[i].sampler_type == SG_SAMPLERTYPE_NONFILTERING) {
+                        const bool nonfiltering = (smp->cmn.min_filter != SG_FILTER_LINEAR)
+                                               && (smp->cmn.mag_filter != SG_FILTER_LINEAR)
+                                               && (smp->cmn.mipmap_filter != SG_FILTER_LINEAR);
+                        _SG_VALIDATE(nonfiltering, VALIDATE_ABND_EXPECTED_NONFILTERING_SAMPLER);
+                    }
+                }
+            }
+        }
+    }
+
+    // has expected storage buffers
+    for (size_t i = 0; i < SG_MAX_STORAGEBUFFER_BINDSLOTS; i++) {
+        if (shd->cmn.storage_buffers[i].stage != SG_SHADERSTAGE_NONE) {
+            _SG_VALIDATE(bindings->storage_buffers[i].id != SG_INVALID_ID, VALIDATE_ABND_EXPECTED_STORAGEBUFFER_BINDING);
+            if (bindings->storage_buffers[i].id != SG_INVALID_ID) {
+                const _sg_buffer_t* sbuf = _sg_lookup_buffer(bindings->storage_buffers[i].id);
+                _SG_VALIDATE(sbuf != 0, VALIDATE_ABND_STORAGEBUFFER_ALIVE);
+                // NOTE: state != VALID is legal and skips rendering!
+                if (sbuf && sbuf->slot.state == SG_RESOURCESTATE_VALID) {
+                    _SG_VALIDATE(sbuf->cmn.usage.storage_buffer, VALIDATE_ABND_STORAGEBUFFER_BINDING_BUFFERTYPE);
+                    // read/write bindings are only allowed for immutable buffers
+                    if (!shd->cmn.storage_buffers[i].readonly) {
+                        _SG_VALIDATE(sbuf->cmn.usage.immutable, VALIDATE_ABND_STORAGEBUFFER_READWRITE_IMMUTABLE);
+                    }
+                }
+            }
+        }
+    }
+}
+
+_SOKOL_PRIVATE void _sg_validate_bindings_vs_pass_attachments(const sg_bindings* bindings, const _sg_shader_t* shd) {
+    if (!_sg_attachments_ref_null(&_sg.cur_pass.atts)) {
+        const _sg_attachments_t* atts = _sg_attachments_ref_ptr(&_sg.cur_pass.atts);
+        for (size_t img_idx = 0; img_idx < SG_MAX_IMAGE_BINDSLOTS; img_idx++) {
+            if (shd->cmn.images[img_idx].stage != SG_SHADERSTAGE_NONE) {
+                const uint32_t img_id = bindings->images[img_idx].id;
+                if (img_id == SG_INVALID_ID) {
+                    continue;
+                }
+                _SG_VALIDATE(img_id != atts->cmn.depth_stencil.image.sref.id, VALIDATE_ABND_IMAGE_BINDING_VS_DEPTHSTENCIL_ATTACHMENT);
+                for (size_t att_idx = 0; att_idx < SG_MAX_COLOR_ATTACHMENTS; att_idx++) {
+                    _SG_VALIDATE(img_id != atts->cmn.colors[att_idx].image.sref.id, VALIDATE_ABND_IMAGE_BINDING_VS_COLOR_ATTACHMENT);
+                    _SG_VALIDATE(img_id != atts->cmn.resolves[att_idx].image.sref.id, VALIDATE_ABND_IMAGE_BINDING_VS_RESOLVE_ATTACHMENT);
+                }
+                for (size_t att_idx = 0; att_idx < SG_MAX_STORAGE_ATTACHMENTS; att_idx++) {
+                    _SG_VALIDATE(img_id != atts->cmn.storages[att_idx].image.sref.id, VALIDATE_ABND_IMAGE_BINDING_VS_STORAGE_ATTACHMENT);
+                }
+            }
+        }
+    }
+}
+#endif
+
 _SOKOL_PRIVATE bool _sg_validate_apply_bindings(const sg_bindings* bindings) {
     #if !defined(SOKOL_DEBUG)
         _SOKOL_UNUSED(bindings);
@@ -19314,19 +23382,7 @@ _SOKOL_PRIVATE bool _sg_validate_apply_bindings(const sg_bindings* bindings) {
         _SG_VALIDATE(_sg.cur_pass.in_pass, VALIDATE_ABND_PASS_EXPECTED);
 
         // bindings must not be empty
-        bool has_any_bindings = bindings->index_buffer.id != SG_INVALID_ID;
-        if (!has_any_bindings) for (size_t i = 0; i < SG_MAX_VERTEXBUFFER_BINDSLOTS; i++) {
-            has_any_bindings |= bindings->vertex_buffers[i].id != SG_INVALID_ID;
-        }
-        if (!has_any_bindings) for (size_t i = 0; i < SG_MAX_IMAGE_BINDSLOTS; i++) {
-            has_any_bindings |= bindings->images[i].id != SG_INVALID_ID;
-        }
-        if (!has_any_bindings) for (size_t i = 0; i < SG_MAX_SAMPLER_BINDSLOTS; i++) {
-            has_any_bindings |= bindings->samplers[i].id != SG_INVALID_ID;
-        }
-        if (!has_any_bindings) for (size_t i = 0; i < SG_MAX_STORAGEBUFFER_BINDSLOTS; i++) {
-            has_any_bindings |= bindings->storage_buffers[i].id != SG_INVALID_ID;
-        }
+        const bool has_any_bindings = _sg_validate_bindings_not_empty(bindings);
         _SG_VALIDATE(has_any_bindings, VALIDATE_ABND_EMPTY_BINDINGS);
 
         // a pipeline object must have been applied
@@ -19348,189 +23404,178 @@ _SOKOL_PRIVATE bool _sg_validate_apply_bindings(const sg_bindings* bindings) {
         const _sg_shader_t* shd = _sg_shader_ref_ptr(&pip->cmn.shader);
         _SG_VALIDATE(shd->slot.state == SG_RESOURCESTATE_VALID, VALIDATE_ABND_PIPELINE_SHADER_VALID);
 
-        if (_sg.cur_pass.is_compute) {
-            for (size_t i = 0; i < SG_MAX_VERTEXBUFFER_BINDSLOTS; i++) {
-                _SG_VALIDATE(bindings->vertex_buffers[i].id == SG_INVALID_ID, VALIDATE_ABND_COMPUTE_EXPECTED_NO_VBS);
-            }
-        } else {
-            // has expected vertex buffers, and vertex buffers still exist
-            for (size_t i = 0; i < SG_MAX_VERTEXBUFFER_BINDSLOTS; i++) {
-                if (pip->cmn.vertex_buffer_layout_active[i]) {
-                    _SG_VALIDATE(bindings->vertex_buffers[i].id != SG_INVALID_ID, VALIDATE_ABND_EXPECTED_VB);
-                    // buffers in vertex-buffer-slots must have vertex buffer usage
-                    if (bindings->vertex_buffers[i].id != SG_INVALID_ID) {
-                        const _sg_buffer_t* buf = _sg_lookup_buffer(bindings->vertex_buffers[i].id);
-                        _SG_VALIDATE(buf != 0, VALIDATE_ABND_VB_ALIVE);
-                        // NOTE: state != VALID is legal and skips rendering!
-                        if (buf && buf->slot.state == SG_RESOURCESTATE_VALID) {
-                            _SG_VALIDATE(buf->cmn.usage.vertex_buffer, VALIDATE_ABND_VB_TYPE);
-                            _SG_VALIDATE(!buf->cmn.append_overflow, VALIDATE_ABND_VB_OVERFLOW);
-                        }
-                    }
-                }
-            }
-        }
-
-        if (_sg.cur_pass.is_compute) {
-            _SG_VALIDATE(bindings->index_buffer.id == SG_INVALID_ID, VALIDATE_ABND_COMPUTE_EXPECTED_NO_IB);
-        } else {
-            // index buffer expected or not, and index buffer still exists
-            if (pip->cmn.index_type == SG_INDEXTYPE_NONE) {
-                // pipeline defines non-indexed rendering, but index buffer provided
-                _SG_VALIDATE(bindings->index_buffer.id == SG_INVALID_ID, VALIDATE_ABND_IB);
-            } else {
-                // pipeline defines indexed rendering, but no index buffer provided
-                _SG_VALIDATE(bindings->index_buffer.id != SG_INVALID_ID, VALIDATE_ABND_NO_IB);
-            }
-            if (bindings->index_buffer.id != SG_INVALID_ID) {
-                // buffer in index-buffer-slot must have index buffer usage
-                const _sg_buffer_t* buf = _sg_lookup_buffer(bindings->index_buffer.id);
-                _SG_VALIDATE(buf != 0, VALIDATE_ABND_IB_ALIVE);
-                // NOTE: state != VALID is legal and skips rendering!
-                if (buf && buf->slot.state == SG_RESOURCESTATE_VALID) {
-                    _SG_VALIDATE(buf->cmn.usage.index_buffer, VALIDATE_ABND_IB_TYPE);
-                    _SG_VALIDATE(!buf->cmn.append_overflow, VALIDATE_ABND_IB_OVERFLOW);
-                }
-            }
-        }
-
-        // has expected images
-        for (size_t i = 0; i < SG_MAX_IMAGE_BINDSLOTS; i++) {
-            if (shd->cmn.images[i].stage != SG_SHADERSTAGE_NONE) {
-                _SG_VALIDATE(bindings->images[i].id != SG_INVALID_ID, VALIDATE_ABND_EXPECTED_IMAGE_BINDING);
-                if (bindings->images[i].id != SG_INVALID_ID) {
-                    const _sg_image_t* img = _sg_lookup_image(bindings->images[i].id);
-                    _SG_VALIDATE(img != 0, VALIDATE_ABND_IMG_ALIVE);
-                    // NOTE: state != VALID is legal and skips rendering!
-                    if (img && img->slot.state == SG_RESOURCESTATE_VALID) {
-                        _SG_VALIDATE(img->cmn.type == shd->cmn.images[i].image_type, VALIDATE_ABND_IMAGE_TYPE_MISMATCH);
-                        if (!_sg.features.msaa_image_bindings) {
-                            _SG_VALIDATE(img->cmn.sample_count == 1, VALIDATE_ABND_IMAGE_MSAA);
-                        }
-                        if (shd->cmn.images[i].multisampled) {
-                            _SG_VALIDATE(img->cmn.sample_count > 1, VALIDATE_ABND_EXPECTED_MULTISAMPLED_IMAGE);
-                        }
-                        const _sg_pixelformat_info_t* info = &_sg.formats[img->cmn.pixel_format];
-                        switch (shd->cmn.images[i].sample_type) {
-                            case SG_IMAGESAMPLETYPE_FLOAT:
-                                _SG_VALIDATE(info->filter, VALIDATE_ABND_EXPECTED_FILTERABLE_IMAGE);
-                                break;
-                            case SG_IMAGESAMPLETYPE_DEPTH:
-                                _SG_VALIDATE(info->depth, VALIDATE_ABND_EXPECTED_DEPTH_IMAGE);
-                                break;
-                            default:
-                                break;
-                        }
-                    }
-                }
-            }
-        }
-
-        // has expected samplers
-        for (size_t i = 0; i < SG_MAX_SAMPLER_BINDSLOTS; i++) {
-            if (shd->cmn.samplers[i].stage != SG_SHADERSTAGE_NONE) {
-                _SG_VALIDATE(bindings->samplers[i].id != SG_INVALID_ID, VALIDATE_ABND_EXPECTED_SAMPLER_BINDING);
-                if (bindings->samplers[i].id != SG_INVALID_ID) {
-                    const _sg_sampler_t* smp = _sg_lookup_sampler(bindings->samplers[i].id);
-                    _SG_VALIDATE(smp != 0, VALIDATE_ABND_SMP_ALIVE);
-                    if (smp) {
-                        // NOTE: for samplers we're specifically checking that they are in valid state
-                        // (technically an invalid sample skips rendering, but an invalid sampler is
-                        // most likely an oversight)
-                        _SG_VALIDATE(smp->slot.state == SG_RESOURCESTATE_VALID, VALIDATE_ABND_SMP_VALID);
-                        if (shd->cmn.samplers[i].sampler_type == SG_SAMPLERTYPE_COMPARISON) {
-                            _SG_VALIDATE(smp->cmn.compare != SG_COMPAREFUNC_NEVER, VALIDATE_ABND_UNEXPECTED_SAMPLER_COMPARE_NEVER);
-                        } else {
-                            _SG_VALIDATE(smp->cmn.compare == SG_COMPAREFUNC_NEVER, VALIDATE_ABND_EXPECTED_SAMPLER_COMPARE_NEVER);
-                        }
-                        if (shd->cmn.samplers[i].sampler_type == SG_SAMPLERTYPE_NONFILTERING) {
-                            const bool nonfiltering = (smp->cmn.min_filter != SG_FILTER_LINEAR)
-                                                   && (smp->cmn.mag_filter != SG_FILTER_LINEAR)
-                                                   && (smp->cmn.mipmap_filter != SG_FILTER_LINEAR);
-                            _SG_VALIDATE(nonfiltering, VALIDATE_ABND_EXPECTED_NONFILTERING_SAMPLER);
-                        }
-                    }
-                }
-            }
-        }
-
-        // has expected storage buffers
-        for (size_t i = 0; i < SG_MAX_STORAGEBUFFER_BINDSLOTS; i++) {
-            if (shd->cmn.storage_buffers[i].stage != SG_SHADERSTAGE_NONE) {
-                _SG_VALIDATE(bindings->storage_buffers[i].id != SG_INVALID_ID, VALIDATE_ABND_EXPECTED_STORAGEBUFFER_BINDING);
-                if (bindings->storage_buffers[i].id != SG_INVALID_ID) {
-                    const _sg_buffer_t* sbuf = _sg_lookup_buffer(bindings->storage_buffers[i].id);
-                    _SG_VALIDATE(sbuf != 0, VALIDATE_ABND_STORAGEBUFFER_ALIVE);
-                    // NOTE: state != VALID is legal and skips rendering!
-                    if (sbuf && sbuf->slot.state == SG_RESOURCESTATE_VALID) {
-                        _SG_VALIDATE(sbuf->cmn.usage.storage_buffer, VALIDATE_ABND_STORAGEBUFFER_BINDING_BUFFERTYPE);
-                        // read/write bindings are only allowed for immutable buffers
-                        if (!shd->cmn.storage_buffers[i].readonly) {
-                            _SG_VALIDATE(sbuf->cmn.usage.immutable, VALIDATE_ABND_STORAGEBUFFER_READWRITE_IMMUTABLE);
-                        }
-                    }
-                }
-            }
-        }
+        _sg_validate_bindings_vs_pipeline(bindings, pip, shd, _sg.cur_pass.is_compute);
 
         // the same image cannot be bound as texture and pass attachment
-        if (!_sg_attachments_ref_null(&_sg.cur_pass.atts)) {
-            const _sg_attachments_t* atts = _sg_attachments_ref_ptr(&_sg.cur_pass.atts);
-            for (size_t img_idx = 0; img_idx < SG_MAX_IMAGE_BINDSLOTS; img_idx++) {
-                if (shd->cmn.images[img_idx].stage != SG_SHADERSTAGE_NONE) {
-                    const uint32_t img_id = bindings->images[img_idx].id;
-                    if (img_id == SG_INVALID_ID) {
-                        continue;
-                    }
-                    _SG_VALIDATE(img_id != atts->cmn.depth_stencil.image.sref.id, VALIDATE_ABND_IMAGE_BINDING_VS_DEPTHSTENCIL_ATTACHMENT);
-                    for (size_t att_idx = 0; att_idx < SG_MAX_COLOR_ATTACHMENTS; att_idx++) {
-                        _SG_VALIDATE(img_id != atts->cmn.colors[att_idx].image.sref.id, VALIDATE_ABND_IMAGE_BINDING_VS_COLOR_ATTACHMENT);
-                        _SG_VALIDATE(img_id != atts->cmn.resolves[att_idx].image.sref.id, VALIDATE_ABND_IMAGE_BINDING_VS_RESOLVE_ATTACHMENT);
-                    }
-                    for (size_t att_idx = 0; att_idx < SG_MAX_STORAGE_ATTACHMENTS; att_idx++) {
-                        _SG_VALIDATE(img_id != atts->cmn.storages[att_idx].image.sref.id, VALIDATE_ABND_IMAGE_BINDING_VS_STORAGE_ATTACHMENT);
-                    }
-                }
-            }
-        }
+        _sg_validate_bindings_vs_pass_attachments(bindings, shd);
         return _sg_validate_end();
     #endif
 }
 
-_SOKOL_PRIVATE bool _sg_validate_apply_uniforms(int ub_slot, const sg_range* data) {
+_SOKOL_PRIVATE bool _sg_validate_bindgroup_desc(const sg_bindgroup_desc* desc) {
     #if !defined(SOKOL_DEBUG)
-        _SOKOL_UNUSED(ub_slot);
-        _SOKOL_UNUSED(data);
+        _SOKOL_UNUSED(desc);
         return true;
     #else
         if (_sg.desc.disable_validation) {
             return true;
         }
-        SOKOL_ASSERT((ub_slot >= 0) && (ub_slot < SG_MAX_UNIFORMBLOCK_BINDSLOTS));
+        SOKOL_ASSERT(desc);
         _sg_validate_begin();
-        _SG_VALIDATE(_sg.cur_pass.in_pass, VALIDATE_AU_PASS_EXPECTED);
-        const _sg_pipeline_ref_t* pip_ref = &_sg.cur_pip;
-        const bool pip_null = _sg_pipeline_ref_null(pip_ref);
-        const bool pip_alive = _sg_pipeline_ref_alive(pip_ref);
-        _SG_VALIDATE(!pip_null, VALIDATE_AU_NO_PIPELINE);
-        _SG_VALIDATE(pip_alive, VALIDATE_AU_PIPELINE_ALIVE);
-        if (pip_alive) {
-            const _sg_pipeline_t* pip = _sg_pipeline_ref_ptr(pip_ref);
-            _SG_VALIDATE(pip->slot.state == SG_RESOURCESTATE_VALID, VALIDATE_AU_PIPELINE_VALID);
-            const _sg_shader_ref_t* shd_ref = &pip->cmn.shader;
-            const bool shd_alive = _sg_shader_ref_alive(shd_ref);
-            _SG_VALIDATE(shd_alive, VALIDATE_AU_PIPELINE_SHADER_ALIVE);
-            if (shd_alive) {
-                const _sg_shader_t* shd = _sg_shader_ref_ptr(shd_ref);
-                _SG_VALIDATE(shd->slot.state == SG_RESOURCESTATE_VALID, VALIDATE_AU_PIPELINE_SHADER_VALID);
-                _SG_VALIDATE(shd->cmn.uniform_blocks[ub_slot].stage != SG_SHADERSTAGE_NONE, VALIDATE_AU_NO_UNIFORMBLOCK_AT_SLOT);
-                _SG_VALIDATE(data->size == shd->cmn.uniform_blocks[ub_slot].size, VALIDATE_AU_SIZE);
-            }
+        _SG_VALIDATE(desc->_start_canary == 0, VALIDATE_BGDESC_CANARY);
+        _SG_VALIDATE(desc->_end_canary == 0, VALIDATE_BGDESC_CANARY);
+        _SG_VALIDATE(desc->pipeline.id != SG_INVALID_ID, VALIDATE_BGDESC_PIPELINE);
+        const _sg_pipeline_t* pip = _sg_lookup_pipeline(desc->pipeline.id);
+        _SG_VALIDATE(pip != 0, VALIDATE_BGDESC_PIPELINE_ALIVE);
+        if (0 == pip) {
+            return _sg_validate_end();
         }
-        return _sg_validate_end();
-    #endif
-}
-
+        _SG_VALIDATE(pip->slot.state == SG_RESOURCESTATE_VALID, VALIDATE_BGDESC_PIPELINE_VALID);
+        const bool shd_alive = _sg_shader_ref_alive(&pip->cmn.shader);
+        _SG_VALIDATE(shd_alive, VALIDATE_BGDESC_PIPELINE_SHADER_ALIVE);
+        if (!shd_alive) {
+            return _sg_validate_end();
+        }
+        const _sg_shader_t* shd = _sg_shader_ref_ptr(&pip->cmn.shader);
+        _SG_VALIDATE(shd->slot.state == SG_RESOURCESTATE_VALID, VALIDATE_BGDESC_PIPELINE_SHADER_VALID);
+        _SG_VALIDATE(_sg_validate_bindings_not_empty(&desc->bindings), VALIDATE_BGDESC_EMPTY_BINDINGS);
+        if (_sg_validate_error == SG_LOGITEM_OK) {
+            // this logs the actual errors as VALIDATE_ABND_* items
+            _sg_validate_bindings_vs_pipeline(&desc->bindings, pip, shd, pip->cmn.is_compute);
+            _SG_VALIDATE(_sg_validate_error == SG_LOGITEM_OK, VALIDATE_BGDESC_BINDINGS);
+        }
+        return _sg_validate_end();
+    #endif
+}
+
+#if defined(SOKOL_DEBUG)
+// checks shared by sg_apply_bindgroup() and command list recording, returns true if the shader matches
+_SOKOL_PRIVATE bool _sg_validate_bindgroup_vs_pipeline(const _sg_bindgroup_t* bg, const _sg_pipeline_t* pip) {
+    // the bindings layout must be compatible with the pipeline
+    const bool shd_match = _sg_shader_ref_alive(&bg->shd) && _sg_shader_ref_eql(&pip->cmn.shader, bg->shd.ptr);
+    _SG_VALIDATE(shd_match, VALIDATE_ABG_SHADER_MISMATCH);
+    if (!pip->cmn.is_compute) {
+        for (size_t i = 0; i < SG_MAX_VERTEXBUFFER_BINDSLOTS; i++) {
+            if (pip->cmn.vertex_buffer_layout_active[i]) {
+                _SG_VALIDATE(!_sg_buffer_ref_null(&bg->vbs[i]), VALIDATE_ABG_EXPECTED_VB);
+            }
+        }
+        if (pip->cmn.index_type == SG_INDEXTYPE_NONE) {
+            _SG_VALIDATE(_sg_buffer_ref_null(&bg->ib), VALIDATE_ABG_IB);
+        } else {
+            _SG_VALIDATE(!_sg_buffer_ref_null(&bg->ib), VALIDATE_ABG_NO_IB);
+        }
+    }
+
+    // referenced resources must still be alive, and vertex/index buffers must not be overflown
+    // NOTE: state != VALID is legal and skips rendering!
+    bool all_alive = true;
+    bool any_overflow = false;
+    for (size_t i = 0; i < bg->num_vbs; i++) {
+        const _sg_buffer_ref_t* ref = &bg->vbs[bg->vb_slots[i]];
+        const bool alive = _sg_buffer_ref_alive(ref);
+        all_alive &= alive;
+        any_overflow |= alive && ref->ptr->cmn.append_overflow;
+    }
+    if (!_sg_buffer_ref_null(&bg->ib)) {
+        const bool alive = _sg_buffer_ref_alive(&bg->ib);
+        all_alive &= alive;
+        any_overflow |= alive && bg->ib.ptr->cmn.append_overflow;
+    }
+    for (size_t i = 0; i < bg->num_imgs; i++) {
+        all_alive &= _sg_image_ref_alive(&bg->imgs[bg->img_slots[i]]);
+    }
+    for (size_t i = 0; i < bg->num_smps; i++) {
+        all_alive &= _sg_sampler_ref_alive(&bg->smps[bg->smp_slots[i]]);
+    }
+    for (size_t i = 0; i < bg->num_sbufs; i++) {
+        all_alive &= _sg_buffer_ref_alive(&bg->sbufs[bg->sbuf_slots[i]]);
+    }
+    _SG_VALIDATE(all_alive, VALIDATE_ABG_RESOURCE_ALIVE);
+    _SG_VALIDATE(!any_overflow, VALIDATE_ABG_BUFFER_OVERFLOW);
+    return shd_match;
+}
+#endif
+
+_SOKOL_PRIVATE bool _sg_validate_apply_bindgroup(sg_bindgroup bg_id) {
+    #if !defined(SOKOL_DEBUG)
+        _SOKOL_UNUSED(bg_id);
+        return true;
+    #else
+        if (_sg.desc.disable_validation) {
+            return true;
+        }
+        _sg_validate_begin();
+
+        // must be called in a pass
+        _SG_VALIDATE(_sg.cur_pass.in_pass, VALIDATE_ABG_PASS_EXPECTED);
+
+        // bindgroup must exist and be valid
+        const _sg_bindgroup_t* bg = _sg_lookup_bindgroup(bg_id.id);
+        _SG_VALIDATE(bg != 0, VALIDATE_ABG_BINDGROUP_EXISTS);
+        if (0 == bg) {
+            return _sg_validate_end();
+        }
+        _SG_VALIDATE(bg->slot.state == SG_RESOURCESTATE_VALID, VALIDATE_ABG_BINDGROUP_VALID);
+        if (bg->slot.state != SG_RESOURCESTATE_VALID) {
+            return _sg_validate_end();
+        }
+
+        // a pipeline object must have been applied
+        const bool pip_null = _sg_pipeline_ref_null(&_sg.cur_pip);
+        const bool pip_alive = _sg_pipeline_ref_alive(&_sg.cur_pip);
+        _SG_VALIDATE(!pip_null, VALIDATE_ABG_NO_PIPELINE);
+        _SG_VALIDATE(pip_alive, VALIDATE_ABG_PIPELINE_ALIVE);
+        if (!pip_alive) {
+            return _sg_validate_end();
+        }
+        const _sg_pipeline_t* pip = _sg_pipeline_ref_ptr(&_sg.cur_pip);
+        _SG_VALIDATE(pip->slot.state == SG_RESOURCESTATE_VALID, VALIDATE_ABG_PIPELINE_VALID);
+
+        const bool shd_match = _sg_validate_bindgroup_vs_pipeline(bg, pip);
+
+        // the same image cannot be bound as texture and pass attachment
+        if (shd_match) {
+            _sg_validate_bindings_vs_pass_attachments(&bg->bindings, bg->shd.ptr);
+        }
+        return _sg_validate_end();
+    #endif
+}
+
+_SOKOL_PRIVATE bool _sg_validate_apply_uniforms(int ub_slot, const sg_range* data) {
+    #if !defined(SOKOL_DEBUG)
+        _SOKOL_UNUSED(ub_slot);
+        _SOKOL_UNUSED(data);
+        return true;
+    #else
+        if (_sg.desc.disable_validation) {
+            return true;
+        }
+        SOKOL_ASSERT((ub_slot >= 0) && (ub_slot < SG_MAX_UNIFORMBLOCK_BINDSLOTS));
+        _sg_validate_begin();
+        _SG_VALIDATE(_sg.cur_pass.in_pass, VALIDATE_AU_PASS_EXPECTED);
+        const _sg_pipeline_ref_t* pip_ref = &_sg.cur_pip;
+        const bool pip_null = _sg_pipeline_ref_null(pip_ref);
+        const bool pip_alive = _sg_pipeline_ref_alive(pip_ref);
+        _SG_VALIDATE(!pip_null, VALIDATE_AU_NO_PIPELINE);
+        _SG_VALIDATE(pip_alive, VALIDATE_AU_PIPELINE_ALIVE);
+        if (pip_alive) {
+            const _sg_pipeline_t* pip = _sg_pipeline_ref_ptr(pip_ref);
+            _SG_VALIDATE(pip->slot.state == SG_RESOURCESTATE_VALID, VALIDATE_AU_PIPELINE_VALID);
+            const _sg_shader_ref_t* shd_ref = &pip->cmn.shader;
+            const bool shd_alive = _sg_shader_ref_alive(shd_ref);
+            _SG_VALIDATE(shd_alive, VALIDATE_AU_PIPELINE_SHADER_ALIVE);
+            if (shd_alive) {
+                const _sg_shader_t* shd = _sg_shader_ref_ptr(shd_ref);
+                _SG_VALIDATE(shd->slot.state == SG_RESOURCESTATE_VALID, VALIDATE_AU_PIPELINE_SHADER_VALID);
+                _SG_VALIDATE(shd->cmn.uniform_blocks[ub_slot].stage != SG_SHADERSTAGE_NONE, VALIDATE_AU_NO_UNIFORMBLOCK_AT_SLOT);
+                _SG_VALIDATE(data->size == shd->cmn.uniform_blocks[ub_slot].size, VALIDATE_AU_SIZE);
+            }
+        }
+        return _sg_validate_end();
+    #endif
+}
+
 _SOKOL_PRIVATE bool _sg_validate_draw(int base_element, int num_elements, int num_instances) {
     #if !defined(SOKOL_DEBUG)
         _SOKOL_UNUSED(base_element);
@@ -19551,6 +23596,44 @@ _SOKOL_PRIVATE bool _sg_validate_draw(int base_element, int num_elements, int nu
     #endif
 }
 
+// size of the indirect draw arguments for the given pipeline
+_SOKOL_PRIVATE int _sg_draw_indirect_args_size(const _sg_pipeline_t* pip) {
+    SOKOL_ASSERT(pip);
+    if (SG_INDEXTYPE_NONE != pip->cmn.index_type) {
+        return (int)sizeof(sg_draw_indexed_indirect_args);
+    } else {
+        return (int)sizeof(sg_draw_indirect_args);
+    }
+}
+
+_SOKOL_PRIVATE bool _sg_validate_draw_indirect(sg_buffer buf_id, int offset) {
+    #if !defined(SOKOL_DEBUG)
+        _SOKOL_UNUSED(buf_id);
+        _SOKOL_UNUSED(offset);
+        return true;
+    #else
+        if (_sg.desc.disable_validation) {
+            return true;
+        }
+        _sg_validate_begin();
+        _SG_VALIDATE(_sg.cur_pass.in_pass && !_sg.cur_pass.is_compute, VALIDATE_DRAWINDIRECT_RENDERPASS_EXPECTED);
+        _SG_VALIDATE(_sg.features.draw_indirect, VALIDATE_DRAWINDIRECT_SUPPORTED);
+        _SG_VALIDATE((offset >= 0) && _sg_multiple_u64((uint64_t)offset, 4), VALIDATE_DRAWINDIRECT_OFFSET);
+        const _sg_buffer_t* buf = _sg_lookup_buffer(buf_id.id);
+        _SG_VALIDATE(buf != 0, VALIDATE_DRAWINDIRECT_BUFFER_ALIVE);
+        // NOTE: state != VALID is legal and skips rendering!
+        if (buf && (buf->slot.state == SG_RESOURCESTATE_VALID)) {
+            _SG_VALIDATE(buf->cmn.usage.indirect_buffer, VALIDATE_DRAWINDIRECT_BUFFER_TYPE);
+            if (_sg_pipeline_ref_alive(&_sg.cur_pip)) {
+                const int args_size = _sg_draw_indirect_args_size(_sg_pipeline_ref_ptr(&_sg.cur_pip));
+                _SG_VALIDATE((offset + args_size) <= buf->cmn.size, VALIDATE_DRAWINDIRECT_SIZE);
+            }
+        }
+        _SG_VALIDATE(_sg.required_bindings_and_uniforms == _sg.applied_bindings_and_uniforms, VALIDATE_DRAWINDIRECT_REQUIRED_BINDINGS_OR_UNIFORMS_MISSING);
+        return _sg_validate_end();
+    #endif
+}
+
 _SOKOL_PRIVATE bool _sg_validate_dispatch(int num_groups_x, int num_groups_y, int num_groups_z) {
     #if !defined(SOKOL_DEBUG)
         _SOKOL_UNUSED(num_groups_x);
@@ -19571,6 +23654,289 @@ _SOKOL_PRIVATE bool _sg_validate_dispatch(int num_groups_x, int num_groups_y, in
     #endif
 }
 
+_SOKOL_PRIVATE bool _sg_validate_command_list_desc(const sg_command_list_desc* desc) {
+    #if !defined(SOKOL_DEBUG)
+        _SOKOL_UNUSED(desc);
+        return true;
+    #else
+        if (_sg.desc.disable_validation) {
+            return true;
+        }
+        SOKOL_ASSERT(desc);
+        _sg_validate_begin();
+        _SG_VALIDATE(desc->_start_canary == 0, VALIDATE_CLDESC_CANARY);
+        _SG_VALIDATE(desc->_end_canary == 0, VALIDATE_CLDESC_CANARY);
+        return _sg_validate_end();
+    #endif
+}
+
+_SOKOL_PRIVATE bool _sg_validate_begin_command_list(sg_command_list cl_id) {
+    #if !defined(SOKOL_DEBUG)
+        _SOKOL_UNUSED(cl_id);
+        return true;
+    #else
+        if (_sg.desc.disable_validation) {
+            return true;
+        }
+        _sg_validate_begin();
+        _SG_VALIDATE(0 == _sg_rec_cmdlist, VALIDATE_BEGINCL_ALREADY_RECORDING);
+        const _sg_command_list_t* cl = _sg_lookup_command_list(cl_id.id);
+        _SG_VALIDATE(cl != 0, VALIDATE_BEGINCL_CMDLIST_EXISTS);
+        if (cl) {
+            _SG_VALIDATE(cl->slot.state == SG_RESOURCESTATE_VALID, VALIDATE_BEGINCL_CMDLIST_VALID);
+            _SG_VALIDATE(!cl->recording, VALIDATE_BEGINCL_CMDLIST_BUSY);
+        }
+        return _sg_validate_end();
+    #endif
+}
+
+_SOKOL_PRIVATE bool _sg_validate_end_command_list(void) {
+    #if !defined(SOKOL_DEBUG)
+        return true;
+    #else
+        if (_sg.desc.disable_validation) {
+            return true;
+        }
+        _sg_validate_begin();
+        _SG_VALIDATE(0 != _sg_rec_cmdlist, VALIDATE_ENDCL_NOT_RECORDING);
+        return _sg_validate_end();
+    #endif
+}
+
+_SOKOL_PRIVATE bool _sg_validate_execute_command_list(sg_command_list cl_id) {
+    #if !defined(SOKOL_DEBUG)
+        _SOKOL_UNUSED(cl_id);
+        return true;
+    #else
+        if (_sg.desc.disable_validation) {
+            return true;
+        }
+        _sg_validate_begin();
+        _SG_VALIDATE(_sg.cur_pass.in_pass, VALIDATE_EXECCL_PASS_EXPECTED);
+        const _sg_command_list_t* cl = _sg_lookup_command_list(cl_id.id);
+        _SG_VALIDATE(cl != 0, VALIDATE_EXECCL_CMDLIST_EXISTS);
+        if (0 == cl) {
+            return _sg_validate_end();
+        }
+        _SG_VALIDATE(cl->slot.state == SG_RESOURCESTATE_VALID, VALIDATE_EXECCL_CMDLIST_VALID);
+        _SG_VALIDATE(!cl->recording, VALIDATE_EXECCL_RECORDING);
+        _SG_VALIDATE(!cl->overflow, VALIDATE_EXECCL_OVERFLOW);
+        if (cl->has_pipeline) {
+            if (cl->is_compute) {
+                _SG_VALIDATE(_sg.cur_pass.is_compute, VALIDATE_EXECCL_COMPUTEPASS_EXPECTED);
+            } else {
+                _SG_VALIDATE(!_sg.cur_pass.is_compute, VALIDATE_EXECCL_RENDERPASS_EXPECTED);
+            }
+        }
+        return _sg_validate_end();
+    #endif
+}
+
+// record-time validation of the calls recorded into a command list, this
+// doesn't look at the current pass (which may not exist yet)
+#if defined(SOKOL_DEBUG)
+_SOKOL_PRIVATE const _sg_pipeline_t* _sg_validate_recorded_pipeline(const _sg_command_list_t* cl) {
+    _SG_VALIDATE(cl->has_pipeline, VALIDATE_RECCL_NO_PIPELINE);
+    if (!cl->has_pipeline) {
+        return 0;
+    }
+    const bool pip_alive = _sg_pipeline_ref_alive(&cl->rec.pip);
+    _SG_VALIDATE(pip_alive, VALIDATE_RECCL_PIPELINE_ALIVE);
+    return pip_alive ? _sg_pipeline_ref_ptr(&cl->rec.pip) : 0;
+}
+#endif
+
+_SOKOL_PRIVATE bool _sg_validate_record_rect(const _sg_command_list_t* cl) {
+    #if !defined(SOKOL_DEBUG)
+        _SOKOL_UNUSED(cl);
+        return true;
+    #else
+        if (_sg.desc.disable_validation) {
+            return true;
+        }
+        _sg_validate_begin();
+        _SG_VALIDATE(!(cl->has_pipeline && cl->is_compute), VALIDATE_RECCL_RENDER_PIPELINE_EXPECTED);
+        return _sg_validate_end();
+    #endif
+}
+
+_SOKOL_PRIVATE bool _sg_validate_record_apply_pipeline(const _sg_command_list_t* cl, sg_pipeline pip_id) {
+    #if !defined(SOKOL_DEBUG)
+        _SOKOL_UNUSED(cl);
+        _SOKOL_UNUSED(pip_id);
+        return true;
+    #else
+        if (_sg.desc.disable_validation) {
+            return true;
+        }
+        _sg_validate_begin();
+        _SG_VALIDATE(pip_id.id != SG_INVALID_ID, VALIDATE_APIP_PIPELINE_VALID_ID);
+        const _sg_pipeline_t* pip = _sg_lookup_pipeline(pip_id.id);
+        _SG_VALIDATE(pip != 0, VALIDATE_APIP_PIPELINE_EXISTS);
+        if (!pip) {
+            return _sg_validate_end();
+        }
+        _SG_VALIDATE(pip->slot.state == SG_RESOURCESTATE_VALID, VALIDATE_APIP_PIPELINE_VALID);
+        const bool shd_alive = _sg_shader_ref_alive(&pip->cmn.shader);
+        _SG_VALIDATE(shd_alive, VALIDATE_APIP_PIPELINE_SHADER_ALIVE);
+        if (shd_alive) {
+            _SG_VALIDATE(_sg_shader_ref_ptr(&pip->cmn.shader)->slot.state == SG_RESOURCESTATE_VALID, VALIDATE_APIP_PIPELINE_SHADER_VALID);
+        }
+        if (cl->has_pipeline) {
+            _SG_VALIDATE(pip->cmn.is_compute == cl->is_compute, VALIDATE_RECCL_MIXED_PIPELINES);
+        }
+        return _sg_validate_end();
+    #endif
+}
+
+_SOKOL_PRIVATE bool _sg_validate_record_apply_bindings(const _sg_command_list_t* cl, const sg_bindings* bindings) {
+    #if !defined(SOKOL_DEBUG)
+        _SOKOL_UNUSED(cl);
+        _SOKOL_UNUSED(bindings);
+        return true;
+    #else
+        if (_sg.desc.disable_validation) {
+            return true;
+        }
+        _sg_validate_begin();
+        _SG_VALIDATE(_sg_validate_bindings_not_empty(bindings), VALIDATE_ABND_EMPTY_BINDINGS);
+        const _sg_pipeline_t* pip = _sg_validate_recorded_pipeline(cl);
+        if (0 == pip) {
+            return _sg_validate_end();
+        }
+        const bool shd_alive = _sg_shader_ref_alive(&pip->cmn.shader);
+        _SG_VALIDATE(shd_alive, VALIDATE_ABND_PIPELINE_SHADER_ALIVE);
+        if (shd_alive) {
+            _sg_validate_bindings_vs_pipeline(bindings, pip, _sg_shader_ref_ptr(&pip->cmn.shader), pip->cmn.is_compute);
+        }
+        return _sg_validate_end();
+    #endif
+}
+
+_SOKOL_PRIVATE bool _sg_validate_record_apply_bindgroup(const _sg_command_list_t* cl, sg_bindgroup bg_id) {
+    #if !defined(SOKOL_DEBUG)
+        _SOKOL_UNUSED(cl);
+        _SOKOL_UNUSED(bg_id);
+        return true;
+    #else
+        if (_sg.desc.disable_validation) {
+            return true;
+        }
+        _sg_validate_begin();
+        const _sg_bindgroup_t* bg = _sg_lookup_bindgroup(bg_id.id);
+        _SG_VALIDATE(bg != 0, VALIDATE_ABG_BINDGROUP_EXISTS);
+        if (0 == bg) {
+            return _sg_validate_end();
+        }
+        _SG_VALIDATE(bg->slot.state == SG_RESOURCESTATE_VALID, VALIDATE_ABG_BINDGROUP_VALID);
+        if (bg->slot.state != SG_RESOURCESTATE_VALID) {
+            return _sg_validate_end();
+        }
+        const _sg_pipeline_t* pip = _sg_validate_recorded_pipeline(cl);
+        if (pip) {
+            _sg_validate_bindgroup_vs_pipeline(bg, pip);
+        }
+        return _sg_validate_end();
+    #endif
+}
+
+_SOKOL_PRIVATE bool _sg_validate_record_apply_uniforms(const _sg_command_list_t* cl, int ub_slot, const sg_range* data) {
+    #if !defined(SOKOL_DEBUG)
+        _SOKOL_UNUSED(cl);
+        _SOKOL_UNUSED(ub_slot);
+        _SOKOL_UNUSED(data);
+        return true;
+    #else
+        if (_sg.desc.disable_validation) {
+            return true;
+        }
+        _sg_validate_begin();
+        const _sg_pipeline_t* pip = _sg_validate_recorded_pipeline(cl);
+        if (pip) {
+            const bool shd_alive = _sg_shader_ref_alive(&pip->cmn.shader);
+            _SG_VALIDATE(shd_alive, VALIDATE_AU_PIPELINE_SHADER_ALIVE);
+            if (shd_alive) {
+                const _sg_shader_t* shd = _sg_shader_ref_ptr(&pip->cmn.shader);
+                _SG_VALIDATE(shd->cmn.uniform_blocks[ub_slot].stage != SG_SHADERSTAGE_NONE, VALIDATE_AU_NO_UNIFORMBLOCK_AT_SLOT);
+                _SG_VALIDATE(data->size == shd->cmn.uniform_blocks[ub_slot].size, VALIDATE_AU_SIZE);
+            }
+        }
+        return _sg_validate_end();
+    #endif
+}
+
+_SOKOL_PRIVATE bool _sg_validate_record_draw(const _sg_command_list_t* cl, int base_element, int num_elements, int num_instances) {
+    #if !defined(SOKOL_DEBUG)
+        _SOKOL_UNUSED(cl);
+        _SOKOL_UNUSED(base_element);
+        _SOKOL_UNUSED(num_elements);
+        _SOKOL_UNUSED(num_instances);
+        return true;
+    #else
+        if (_sg.desc.disable_validation) {
+            return true;
+        }
+        _sg_validate_begin();
+        _SG_VALIDATE(cl->has_pipeline, VALIDATE_RECCL_NO_PIPELINE);
+        _SG_VALIDATE(!cl->is_compute, VALIDATE_RECCL_RENDER_PIPELINE_EXPECTED);
+        _SG_VALIDATE(base_element >= 0, VALIDATE_DRAW_BASEELEMENT);
+        _SG_VALIDATE(num_elements >= 0, VALIDATE_DRAW_NUMELEMENTS);
+        _SG_VALIDATE(num_instances >= 0, VALIDATE_DRAW_NUMINSTANCES);
+        _SG_VALIDATE(cl->rec.required_bindings_and_uniforms == cl->rec.applied_bindings_and_uniforms, VALIDATE_DRAW_REQUIRED_BINDINGS_OR_UNIFORMS_MISSING);
+        return _sg_validate_end();
+    #endif
+}
+
+_SOKOL_PRIVATE bool _sg_validate_record_draw_indirect(const _sg_command_list_t* cl, const _sg_buffer_t* buf, int offset) {
+    #if !defined(SOKOL_DEBUG)
+        _SOKOL_UNUSED(cl);
+        _SOKOL_UNUSED(buf);
+        _SOKOL_UNUSED(offset);
+        return true;
+    #else
+        if (_sg.desc.disable_validation) {
+            return true;
+        }
+        _sg_validate_begin();
+        _SG_VALIDATE(cl->has_pipeline, VALIDATE_RECCL_NO_PIPELINE);
+        _SG_VALIDATE(!cl->is_compute, VALIDATE_RECCL_RENDER_PIPELINE_EXPECTED);
+        _SG_VALIDATE(_sg.features.draw_indirect, VALIDATE_DRAWINDIRECT_SUPPORTED);
+        _SG_VALIDATE((offset >= 0) && _sg_multiple_u64((uint64_t)offset, 4), VALIDATE_DRAWINDIRECT_OFFSET);
+        _SG_VALIDATE(buf != 0, VALIDATE_DRAWINDIRECT_BUFFER_ALIVE);
+        if (buf && (buf->slot.state == SG_RESOURCESTATE_VALID)) {
+            _SG_VALIDATE(buf->cmn.usage.indirect_buffer, VALIDATE_DRAWINDIRECT_BUFFER_TYPE);
+            if (_sg_pipeline_ref_alive(&cl->rec.pip)) {
+                const int args_size = _sg_draw_indirect_args_size(_sg_pipeline_ref_ptr(&cl->rec.pip));
+                _SG_VALIDATE((offset + args_size) <= buf->cmn.size, VALIDATE_DRAWINDIRECT_SIZE);
+            }
+        }
+        _SG_VALIDATE(cl->rec.required_bindings_and_uniforms == cl->rec.applied_bindings_and_uniforms, VALIDATE_DRAWINDIRECT_REQUIRED_BINDINGS_OR_UNIFORMS_MISSING);
+        return _sg_validate_end();
+    #endif
+}
+
+_SOKOL_PRIVATE bool _sg_validate_record_dispatch(const _sg_command_list_t* cl, int num_groups_x, int num_groups_y, int num_groups_z) {
+    #if !defined(SOKOL_DEBUG)
+        _SOKOL_UNUSED(cl);
+        _SOKOL_UNUSED(num_groups_x);
+        _SOKOL_UNUSED(num_groups_y);
+        _SOKOL_UNUSED(num_groups_z);
+        return true;
+    #else
+        if (_sg.desc.disable_validation) {
+            return true;
+        }
+        _sg_validate_begin();
+        _SG_VALIDATE(cl->has_pipeline, VALIDATE_RECCL_NO_PIPELINE);
+        _SG_VALIDATE(cl->is_compute, VALIDATE_RECCL_COMPUTE_PIPELINE_EXPECTED);
+        _SG_VALIDATE((num_groups_x >= 0) && (num_groups_x < (1<<16)), VALIDATE_DISPATCH_NUMGROUPSX);
+        _SG_VALIDATE((num_groups_y >= 0) && (num_groups_y < (1<<16)), VALIDATE_DISPATCH_NUMGROUPSY);
+        _SG_VALIDATE((num_groups_z >= 0) && (num_groups_z < (1<<16)), VALIDATE_DISPATCH_NUMGROUPSZ);
+        _SG_VALIDATE(cl->rec.required_bindings_and_uniforms == cl->rec.applied_bindings_and_uniforms, VALIDATE_DRAW_REQUIRED_BINDINGS_OR_UNIFORMS_MISSING);
+        return _sg_validate_end();
+    #endif
+}
+
 _SOKOL_PRIVATE bool _sg_validate_update_buffer(const _sg_buffer_t* buf, const sg_range* data) {
     #if !defined(SOKOL_DEBUG)
         _SOKOL_UNUSED(buf);
@@ -19617,17 +23983,168 @@ _SOKOL_PRIVATE bool _sg_validate_update_image(const _sg_image_t* img, const sg_i
         if (_sg.desc.disable_validation) {
             return true;
         }
-        SOKOL_ASSERT(img && data);
+        SOKOL_ASSERT(img && data);
+        _sg_validate_begin();
+        _SG_VALIDATE(!img->cmn.usage.immutable, VALIDATE_UPDIMG_USAGE);
+        _SG_VALIDATE(img->cmn.upd_frame_index != _sg.frame_index, VALIDATE_UPDIMG_ONCE);
+        _sg_validate_image_data(data,
+            img->cmn.pixel_format,
+            img->cmn.width,
+            img->cmn.height,
+            (img->cmn.type == SG_IMAGETYPE_CUBE) ? 6 : 1,
+            img->cmn.generate_mipmaps ? 1 : img->cmn.num_mipmaps,
+            img->cmn.num_slices);
+        if (img->cmn.generate_mipmaps) {
+            for (int face_index = 0; face_index < SG_CUBEFACE_NUM; face_index++) {
+                for (int mip_index = 1; mip_index < SG_MAX_MIPMAPS; mip_index++) {
+                    _SG_VALIDATE(0 == data->subimage[face_index][mip_index].ptr, VALIDATE_UPDIMG_GENMIPMAPS_MIPDATA);
+                }
+            }
+        }
+        return _sg_validate_end();
+    #endif
+}
+
+_SOKOL_PRIVATE bool _sg_validate_generate_mipmaps(const _sg_image_t* img) {
+    #if !defined(SOKOL_DEBUG)
+        _SOKOL_UNUSED(img);
+        return true;
+    #else
+        if (_sg.desc.disable_validation) {
+            return true;
+        }
+        SOKOL_ASSERT(img);
+        _sg_validate_begin();
+        _SG_VALIDATE(img->cmn.generate_mipmaps, VALIDATE_GENMIPMAPS_FLAG);
+        return _sg_validate_end();
+    #endif
+}
+
+_SOKOL_PRIVATE bool _sg_validate_update_buffer_range(const _sg_buffer_t* buf, int offset, const sg_range* data) {
+    #if !defined(SOKOL_DEBUG)
+        _SOKOL_UNUSED(buf);
+        _SOKOL_UNUSED(offset);
+        _SOKOL_UNUSED(data);
+        return true;
+    #else
+        if (_sg.desc.disable_validation) {
+            return true;
+        }
+        SOKOL_ASSERT(buf && data && data->ptr);
+        _sg_validate_begin();
+        _SG_VALIDATE(buf->cmn.usage.dynamic_update, VALIDATE_UPDBUFRANGE_USAGE);
+        _SG_VALIDATE(_sg_multiple_u64((uint64_t)offset, 4) && _sg_multiple_u64(data->size, 4), VALIDATE_UPDBUFRANGE_ALIGNMENT);
+        _SG_VALIDATE((offset >= 0) && (((size_t)offset + data->size) <= (size_t)buf->cmn.size), VALIDATE_UPDBUFRANGE_SIZE);
+        _SG_VALIDATE(buf->cmn.append_frame_index != _sg.frame_index, VALIDATE_UPDBUFRANGE_APPEND);
+        _SG_VALIDATE(buf->cmn.bind_frame_index != _sg.frame_index, VALIDATE_UPDBUFRANGE_BOUND);
+        return _sg_validate_end();
+    #endif
+}
+
+_SOKOL_PRIVATE bool _sg_validate_update_image_region(const _sg_image_t* img, const sg_image_region* region, const sg_range* data) {
+    #if !defined(SOKOL_DEBUG)
+        _SOKOL_UNUSED(img);
+        _SOKOL_UNUSED(region);
+        _SOKOL_UNUSED(data);
+        return true;
+    #else
+        if (_sg.desc.disable_validation) {
+            return true;
+        }
+        SOKOL_ASSERT(img && region && data);
+        _sg_validate_begin();
+        _SG_VALIDATE(img->cmn.usage.dynamic_update, VALIDATE_UPDIMGREGION_USAGE);
+        _SG_VALIDATE(!_sg_is_compressed_pixel_format(img->cmn.pixel_format), VALIDATE_UPDIMGREGION_COMPRESSED);
+        _SG_VALIDATE(img->cmn.bind_frame_index != _sg.frame_index, VALIDATE_UPDIMGREGION_BOUND);
+        const bool mip_level_valid = (region->mip_level >= 0) && (region->mip_level < img->cmn.num_mipmaps);
+        _SG_VALIDATE(mip_level_valid, VALIDATE_UPDIMGREGION_MIPLEVEL);
+        if (mip_level_valid) {
+            const int mip_width = _sg_miplevel_dim(img->cmn.width, region->mip_level);
+            const int mip_height = _sg_miplevel_dim(img->cmn.height, region->mip_level);
+            int num_slices;
+            switch (img->cmn.type) {
+                case SG_IMAGETYPE_CUBE: num_slices = SG_CUBEFACE_NUM; break;
+                case SG_IMAGETYPE_3D:   num_slices = _sg_miplevel_dim(img->cmn.num_slices, region->mip_level); break;
+                default:                num_slices = img->cmn.num_slices; break;
+            }
+            _SG_VALIDATE((region->slice >= 0) && (region->slice < num_slices), VALIDATE_UPDIMGREGION_SLICE);
+            _SG_VALIDATE((region->x >= 0) && (region->y >= 0) && (region->width > 0) && (region->height > 0)
+                && ((region->x + region->width) <= mip_width) && ((region->y + region->height) <= mip_height),
+                VALIDATE_UPDIMGREGION_RECT);
+            const size_t expected_size = (size_t)_sg_surface_pitch(img->cmn.pixel_format, region->width, region->height, 1);
+            _SG_VALIDATE(data->ptr && (data->size == expected_size), VALIDATE_UPDIMGREGION_DATA);
+        }
+        return _sg_validate_end();
+    #endif
+}
+
+_SOKOL_PRIVATE bool _sg_validate_image_readback_desc(const sg_image_readback_desc* desc) {
+    #if !defined(SOKOL_DEBUG)
+        _SOKOL_UNUSED(desc);
+        return true;
+    #else
+        if (_sg.desc.disable_validation) {
+            return true;
+        }
+        SOKOL_ASSERT(desc);
+        _sg_validate_begin();
+        _SG_VALIDATE(desc->_start_canary == 0, VALIDATE_IMGRBDESC_CANARY);
+        _SG_VALIDATE(desc->_end_canary == 0, VALIDATE_IMGRBDESC_CANARY);
+        _SG_VALIDATE(!_sg.cur_pass.in_pass, VALIDATE_IMGRB_IN_PASS);
+        const _sg_image_t* img = _sg_lookup_image(desc->image.id);
+        const bool img_valid = img && (img->slot.state == SG_RESOURCESTATE_VALID);
+        _SG_VALIDATE(img_valid, VALIDATE_IMGRB_IMAGE);
+        if (img_valid) {
+            const sg_image_region* region = &desc->region;
+            const sg_pixel_format fmt = img->cmn.pixel_format;
+            _SG_VALIDATE(img->cmn.sample_count == 1, VALIDATE_IMGRB_SAMPLECOUNT);
+            _SG_VALIDATE(!_sg_is_compressed_pixel_format(fmt) && !_sg_is_depth_or_depth_stencil_format(fmt), VALIDATE_IMGRB_PIXELFORMAT);
+            const bool mip_level_valid = (region->mip_level >= 0) && (region->mip_level < img->cmn.num_mipmaps);
+            _SG_VALIDATE(mip_level_valid, VALIDATE_IMGRB_MIPLEVEL);
+            if (mip_level_valid) {
+                const int mip_width = _sg_miplevel_dim(img->cmn.width, region->mip_level);
+                const int mip_height = _sg_miplevel_dim(img->cmn.height, region->mip_level);
+                int num_slices;
+                switch (img->cmn.type) {
+                    case SG_IMAGETYPE_CUBE: num_slices = SG_CUBEFACE_NUM; break;
+                    case SG_IMAGETYPE_3D:   num_slices = _sg_miplevel_dim(img->cmn.num_slices, region->mip_level); break;
+                    default:                num_slices = img->cmn.num_slices; break;
+                }
+                _SG_VALIDATE((region->slice >= 0) && (region->slice < num_slices), VALIDATE_IMGRB_SLICE);
+                _SG_VALIDATE((region->x >= 0) && (region->y >= 0) && (region->width > 0) && (region->height > 0)
+                    && ((region->x + region->width) <= mip_width) && ((region->y + region->height) <= mip_height),
+                    VALIDATE_IMGRB_RECT);
+                if ((region->width > 0) && (region->height > 0)) {
+                    const size_t required_size = (size_t)_sg_surface_pitch(fmt, region->width, region->height, 1);
+                    _SG_VALIDATE(desc->data.ptr && (desc->data.size >= required_size), VALIDATE_IMGRB_DATA);
+                }
+            }
+        }
+        return _sg_validate_end();
+    #endif
+}
+
+_SOKOL_PRIVATE bool _sg_validate_buffer_readback_desc(const sg_buffer_readback_desc* desc) {
+    #if !defined(SOKOL_DEBUG)
+        _SOKOL_UNUSED(desc);
+        return true;
+    #else
+        if (_sg.desc.disable_validation) {
+            return true;
+        }
+        SOKOL_ASSERT(desc);
         _sg_validate_begin();
-        _SG_VALIDATE(!img->cmn.usage.immutable, VALIDATE_UPDIMG_USAGE);
-        _SG_VALIDATE(img->cmn.upd_frame_index != _sg.frame_index, VALIDATE_UPDIMG_ONCE);
-        _sg_validate_image_data(data,
-            img->cmn.pixel_format,
-            img->cmn.width,
-            img->cmn.height,
-            (img->cmn.type == SG_IMAGETYPE_CUBE) ? 6 : 1,
-            img->cmn.num_mipmaps,
-            img->cmn.num_slices);
+        _SG_VALIDATE(desc->_start_canary == 0, VALIDATE_BUFRBDESC_CANARY);
+        _SG_VALIDATE(desc->_end_canary == 0, VALIDATE_BUFRBDESC_CANARY);
+        _SG_VALIDATE(!_sg.cur_pass.in_pass, VALIDATE_BUFRB_IN_PASS);
+        const _sg_buffer_t* buf = _sg_lookup_buffer(desc->buffer.id);
+        const bool buf_valid = buf && (buf->slot.state == SG_RESOURCESTATE_VALID);
+        _SG_VALIDATE(buf_valid, VALIDATE_BUFRB_BUFFER);
+        if (buf_valid) {
+            _SG_VALIDATE(_sg_multiple_u64((uint64_t)desc->offset, 4) && _sg_multiple_u64((uint64_t)desc->size, 4), VALIDATE_BUFRB_ALIGNMENT);
+            _SG_VALIDATE((desc->offset >= 0) && (desc->size > 0) && ((desc->offset + desc->size) <= buf->cmn.size), VALIDATE_BUFRB_SIZE);
+            _SG_VALIDATE(desc->data.ptr && (desc->data.size >= (size_t)desc->size), VALIDATE_BUFRB_DATA);
+        }
         return _sg_validate_end();
     #endif
 }
@@ -19641,7 +24158,7 @@ _SOKOL_PRIVATE bool _sg_validate_update_image(const _sg_image_t* img, const sg_i
 // >>resources
 _SOKOL_PRIVATE sg_buffer_usage _sg_buffer_usage_defaults(const sg_buffer_usage* usg) {
     sg_buffer_usage def = *usg;
-    if (!(def.vertex_buffer || def.index_buffer || def.storage_buffer)) {
+    if (!(def.vertex_buffer || def.index_buffer || def.storage_buffer || def.indirect_buffer)) {
         def.vertex_buffer = true;
     }
     if (!(def.immutable || def.stream_update || def.dynamic_update)) {
@@ -19650,6 +24167,19 @@ _SOKOL_PRIVATE sg_buffer_usage _sg_buffer_usage_defaults(const sg_buffer_usage*
     return def;
 }
 
+// resolve the number of backend objects of a dynamic- or stream-update resource
+_SOKOL_PRIVATE int _sg_num_update_slots(sg_update_mode mode, int num_slots, bool injected) {
+    if (0 == num_slots) {
+        num_slots = injected ? SG_NUM_INFLIGHT_FRAMES : _sg.desc.num_update_slots;
+    }
+    #if defined(SOKOL_METAL)
+        // Metal writes directly into its buffers and textures, and needs one copy per frame-in-flight
+        _SOKOL_UNUSED(mode);
+        return _sg_max(num_slots, SG_NUM_INFLIGHT_FRAMES);
+    #else
+        return (SG_UPDATEMODE_ORPHAN == mode) ? 1 : num_slots;
+    #endif
+}
 
 _SOKOL_PRIVATE sg_buffer_desc _sg_buffer_desc_defaults(const sg_buffer_desc* desc) {
     sg_buffer_desc def = *desc;
@@ -19657,6 +24187,14 @@ _SOKOL_PRIVATE sg_buffer_desc _sg_buffer_desc_defaults(const sg_buffer_desc* des
     if (def.size == 0) {
         def.size = def.data.size;
     }
+    if (def.usage.immutable) {
+        def.update_mode = SG_UPDATEMODE_MULTIBUFFER;
+        def.num_update_slots = 1;
+    } else {
+        const bool injected = (0 != def.gl_buffers[0]) || (0 != def.mtl_buffers[0]);
+        def.update_mode = _sg_def(def.update_mode, injected ? SG_UPDATEMODE_MULTIBUFFER : _sg.desc.update_mode);
+        def.num_update_slots = _sg_num_update_slots(def.update_mode, def.num_update_slots, injected);
+    }
     return def;
 }
 
@@ -19673,7 +24211,12 @@ _SOKOL_PRIVATE sg_image_desc _sg_image_desc_defaults(const sg_image_desc* desc)
     def.type = _sg_def(def.type, SG_IMAGETYPE_2D);
     def.usage = _sg_image_usage_defaults(&def.usage);
     def.num_slices = _sg_def(def.num_slices, 1);
-    def.num_mipmaps = _sg_def(def.num_mipmaps, 1);
+    if (def.generate_mipmaps && (def.num_mipmaps == 0)) {
+        const int depth = (def.type == SG_IMAGETYPE_3D) ? def.num_slices : 1;
+        def.num_mipmaps = _sg_num_mipmaps_for_dims(def.width, def.height, depth);
+    } else {
+        def.num_mipmaps = _sg_def(def.num_mipmaps, 1);
+    }
     if (def.usage.render_attachment) {
         def.pixel_format = _sg_def(def.pixel_format, _sg.desc.environment.defaults.color_format);
         def.sample_count = _sg_def(def.sample_count, _sg.desc.environment.defaults.sample_count);
@@ -19681,6 +24224,14 @@ _SOKOL_PRIVATE sg_image_desc _sg_image_desc_defaults(const sg_image_desc* desc)
         def.pixel_format = _sg_def(def.pixel_format, SG_PIXELFORMAT_RGBA8);
         def.sample_count = _sg_def(def.sample_count, 1);
     }
+    if (def.usage.immutable) {
+        def.update_mode = SG_UPDATEMODE_MULTIBUFFER;
+        def.num_update_slots = 1;
+    } else {
+        const bool injected = (0 != def.gl_textures[0]) || (0 != def.mtl_textures[0]);
+        def.update_mode = _sg_def(def.update_mode, injected ? SG_UPDATEMODE_MULTIBUFFER : _sg.desc.update_mode);
+        def.num_update_slots = _sg_num_update_slots(def.update_mode, def.num_update_slots, injected);
+    }
     return def;
 }
 
@@ -19852,11 +24403,261 @@ _SOKOL_PRIVATE sg_attachments_desc _sg_attachments_desc_defaults(const sg_attach
     return def;
 }
 
+_SOKOL_PRIVATE sg_command_list_desc _sg_command_list_desc_defaults(const sg_command_list_desc* desc) {
+    sg_command_list_desc def = *desc;
+    def.buffer_size = _sg_def(def.buffer_size, (size_t)_SG_DEFAULT_COMMAND_LIST_BUFFER_SIZE);
+    return def;
+}
+
+_SOKOL_PRIVATE sg_image_readback_desc _sg_image_readback_desc_defaults(const sg_image_readback_desc* desc) {
+    sg_image_readback_desc def = *desc;
+    const _sg_image_t* img = _sg_lookup_image(def.image.id);
+    if (img && (def.region.mip_level >= 0) && (def.region.mip_level < img->cmn.num_mipmaps)) {
+        const int mip_width = _sg_miplevel_dim(img->cmn.width, def.region.mip_level);
+        const int mip_height = _sg_miplevel_dim(img->cmn.height, def.region.mip_level);
+        def.region.width = _sg_def(def.region.width, mip_width - def.region.x);
+        def.region.height = _sg_def(def.region.height, mip_height - def.region.y);
+    }
+    return def;
+}
+
+_SOKOL_PRIVATE sg_buffer_readback_desc _sg_buffer_readback_desc_defaults(const sg_buffer_readback_desc* desc) {
+    sg_buffer_readback_desc def = *desc;
+    const _sg_buffer_t* buf = _sg_lookup_buffer(def.buffer.id);
+    if (buf) {
+        def.size = _sg_def(def.size, buf->cmn.size - def.offset);
+    }
+    return def;
+}
+
+_SOKOL_PRIVATE void _sg_dedup_discard(_sg_dedup_cache_t* cache) {
+    SOKOL_ASSERT(cache);
+    for (int i = 0; i < cache->cap; i++) {
+        if (cache->items[i].res_id != SG_INVALID_ID) {
+            _sg_free(cache->items[i].key);
+        }
+    }
+    if (cache->items) {
+        _sg_free(cache->items);
+    }
+    if (cache->slot_items) {
+        _sg_free(cache->slot_items);
+    }
+    _sg_clear(cache, sizeof(_sg_dedup_cache_t));
+}
+
+// returns the table index of a cached resource, or -1 if the resource isn't in the cache
+_SOKOL_PRIVATE int _sg_dedup_find(const _sg_dedup_cache_t* cache, uint32_t res_id) {
+    SOKOL_ASSERT(cache);
+    const int slot_index = _sg_slot_index(res_id);
+    if (slot_index < cache->num_slots) {
+        const int item_index = cache->slot_items[slot_index] - 1;
+        if ((item_index >= 0) && (cache->items[item_index].res_id == res_id)) {
+            return item_index;
+        }
+    }
+    return -1;
+}
+
+_SOKOL_PRIVATE void _sg_dedup_map_slot(_sg_dedup_cache_t* cache, uint32_t res_id, int item_index) {
+    SOKOL_ASSERT(cache);
+    const int slot_index = _sg_slot_index(res_id);
+    if (slot_index >= cache->num_slots) {
+        // resource pools may grow, so the slot map grows on demand
+        const int new_num_slots = _sg_max(slot_index + 1, 2 * cache->num_slots);
+        int* new_slot_items = (int*)_sg_malloc_clear((size_t)new_num_slots * sizeof(int));
+        if (cache->slot_items) {
+            memcpy(new_slot_items, cache->slot_items, (size_t)cache->num_slots * sizeof(int));
+            _sg_free(cache->slot_items);
+        }
+        cache->slot_items = new_slot_items;
+        cache->num_slots = new_num_slots;
+    }
+    cache->slot_items[slot_index] = item_index + 1;
+}
+
+// store an item at the first free position of its probe sequence (takes ownership of the key)
+_SOKOL_PRIVATE void _sg_dedup_insert(_sg_dedup_cache_t* cache, const _sg_dedup_item_t* src) {
+    SOKOL_ASSERT(cache && src && (cache->num < cache->cap));
+    const uint32_t mask = (uint32_t)cache->cap - 1;
+    uint32_t index = (uint32_t)src->hash & mask;
+    while (cache->items[index].res_id != SG_INVALID_ID) {
+        index = (index + 1) & mask;
+    }
+    cache->items[index] = *src;
+    cache->num += 1;
+    _sg_dedup_map_slot(cache, src->res_id, (int)index);
+}
+
+// returns the id of a cached resource with identical key and bumps its reference count, or SG_INVALID_ID
+_SOKOL_PRIVATE uint32_t _sg_dedup_lookup(_sg_dedup_cache_t* cache, uint64_t hash, const void* key, size_t key_size) {
+    SOKOL_ASSERT(cache && key && (key_size > 0));
+    if (0 == cache->cap) {
+        return SG_INVALID_ID;
+    }
+    const uint32_t mask = (uint32_t)cache->cap - 1;
+    uint32_t index = (uint32_t)hash & mask;
+    while (cache->items[index].res_id != SG_INVALID_ID) {
+        _sg_dedup_item_t* item = &cache->items[index];
+        if ((item->hash == hash) && (0 == memcmp(item->key, key, key_size))) {
+            item->ref_count += 1;
+            return item->res_id;
+        }
+        index = (index + 1) & mask;
+    }
+    return SG_INVALID_ID;
+}
+
+_SOKOL_PRIVATE void _sg_dedup_add(_sg_dedup_cache_t* cache, uint64_t hash, const void* key, size_t key_size, uint32_t res_id) {
+    SOKOL_ASSERT(cache && key && (key_size > 0) && (res_id != SG_INVALID_ID));
+    SOKOL_ASSERT(_sg_dedup_find(cache, res_id) < 0);
+    // keep the load factor at or below 1/2 so that probe sequences stay short
+    if (2 * (cache->num + 1) > cache->cap) {
+        _sg_dedup_item_t* old_items = cache->items;
+        const int old_cap = cache->cap;
+        cache->cap = _sg_max(16, 2 * old_cap);
+        cache->items = (_sg_dedup_item_t*)_sg_malloc_clear((size_t)cache->cap * sizeof(_sg_dedup_item_t));
+        cache->num = 0;
+        if (old_items) {
+            for (int i = 0; i < old_cap; i++) {
+                if (old_items[i].res_id != SG_INVALID_ID) {
+                    _sg_dedup_insert(cache, &old_items[i]);
+                }
+            }
+            _sg_free(old_items);
+        }
+    }
+    _sg_dedup_item_t item;
+    _sg_clear(&item, sizeof(item));
+    item.hash = hash;
+    item.res_id = res_id;
+    item.ref_count = 1;
+    item.key = _sg_malloc(key_size);
+    memcpy(item.key, key, key_size);
+    _sg_dedup_insert(cache, &item);
+}
+
+// drop a reference, returns the number of remaining references (0 if the resource isn't in the cache)
+_SOKOL_PRIVATE int _sg_dedup_release(_sg_dedup_cache_t* cache, uint32_t res_id) {
+    SOKOL_ASSERT(cache);
+    const int item_index = _sg_dedup_find(cache, res_id);
+    if (item_index < 0) {
+        return 0;
+    }
+    _sg_dedup_item_t* item = &cache->items[item_index];
+    SOKOL_ASSERT(item->ref_count > 0);
+    item->ref_count -= 1;
+    return item->ref_count;
+}
+
+// called when a resource is uninitialized, removes its cache item (if any)
+_SOKOL_PRIVATE void _sg_dedup_remove(_sg_dedup_cache_t* cache, uint32_t res_id) {
+    SOKOL_ASSERT(cache);
+    const int item_index = _sg_dedup_find(cache, res_id);
+    if (item_index < 0) {
+        return;
+    }
+    _sg_free(cache->items[item_index].key);
+    cache->slot_items[_sg_slot_index(res_id)] = 0;
+    // backward-shift deletion: move following items of the same probe sequence
+    // into the hole, so that lookups never need to skip over deleted entries
+    const uint32_t mask = (uint32_t)cache->cap - 1;
+    uint32_t hole = (uint32_t)item_index;
+    for (uint32_t index = (hole + 1) & mask; cache->items[index].res_id != SG_INVALID_ID; index = (index + 1) & mask) {
+        const _sg_dedup_item_t* item = &cache->items[index];
+        // the item may move if its home position isn't cyclically between the hole and its current position
+        const uint32_t home = (uint32_t)item->hash & mask;
+        if (((index - home) & mask) >= ((index - hole) & mask)) {
+            cache->items[hole] = *item;
+            _sg_dedup_map_slot(cache, item->res_id, (int)hole);
+            hole = index;
+        }
+    }
+    _sg_clear(&cache->items[hole], sizeof(_sg_dedup_item_t));
+    cache->num -= 1;
+}
+
+// NOTE: the dedup keys are built field by field into a cleared struct, since a struct
+// assignment may copy the undefined padding bytes of the source struct, and the keys
+// are hashed and compared as raw bytes (structs without padding are copied as a whole)
+_SOKOL_PRIVATE uint64_t _sg_pipeline_dedup_key(_sg_pipeline_dedup_key_t* key, const sg_pipeline_desc* desc_def) {
+    SOKOL_ASSERT(key && desc_def);
+    _sg_clear(key, sizeof(_sg_pipeline_dedup_key_t));
+    sg_pipeline_desc* dst = &key->desc;
+    const sg_pipeline_desc* src = desc_def;
+    dst->compute = src->compute;
+    dst->shader = src->shader;
+    dst->layout = src->layout;
+    dst->depth.pixel_format = src->depth.pixel_format;
+    dst->depth.compare = src->depth.compare;
+    dst->depth.write_enabled = src->depth.write_enabled;
+    dst->depth.bias = src->depth.bias;
+    dst->depth.bias_slope_scale = src->depth.bias_slope_scale;
+    dst->depth.bias_clamp = src->depth.bias_clamp;
+    dst->stencil.enabled = src->stencil.enabled;
+    dst->stencil.front = src->stencil.front;
+    dst->stencil.back = src->stencil.back;
+    dst->stencil.read_mask = src->stencil.read_mask;
+    dst->stencil.write_mask = src->stencil.write_mask;
+    dst->stencil.ref = src->stencil.ref;
+    dst->color_count = src->color_count;
+    for (size_t i = 0; i < SG_MAX_COLOR_ATTACHMENTS; i++) {
+        sg_color_target_state* dst_col = &dst->colors[i];
+        const sg_color_target_state* src_col = &src->colors[i];
+        dst_col->pixel_format = src_col->pixel_format;
+        dst_col->write_mask = src_col->write_mask;
+        dst_col->blend.enabled = src_col->blend.enabled;
+        dst_col->blend.src_factor_rgb = src_col->blend.src_factor_rgb;
+        dst_col->blend.dst_factor_rgb = src_col->blend.dst_factor_rgb;
+        dst_col->blend.op_rgb = src_col->blend.op_rgb;
+        dst_col->blend.src_factor_alpha = src_col->blend.src_factor_alpha;
+        dst_col->blend.dst_factor_alpha = src_col->blend.dst_factor_alpha;
+        dst_col->blend.op_alpha = src_col->blend.op_alpha;
+    }
+    dst->primitive_type = src->primitive_type;
+    dst->index_type = src->index_type;
+    dst->cull_mode = src->cull_mode;
+    dst->face_winding = src->face_winding;
+    dst->sample_count = src->sample_count;
+    dst->blend_color = src->blend_color;
+    dst->alpha_to_coverage_enabled = src->alpha_to_coverage_enabled;
+    const _sg_shader_t* shd = _sg_lookup_shader(desc_def->shader.id);
+    key->shd_uninit_count = shd ? shd->slot.uninit_count : 0;
+    return _sg_hash(key, (int)sizeof(_sg_pipeline_dedup_key_t), 0x1234567887654321);
+}
+
+// returns false for samplers with injected backend objects, these are never deduplicated
+_SOKOL_PRIVATE bool _sg_sampler_dedup_key(sg_sampler_desc* key, const sg_sampler_desc* desc_def, uint64_t* out_hash) {
+    SOKOL_ASSERT(key && desc_def && out_hash);
+    if (desc_def->gl_sampler || desc_def->mtl_sampler || desc_def->d3d11_sampler || desc_def->wgpu_sampler) {
+        return false;
+    }
+    _sg_clear(key, sizeof(sg_sampler_desc));
+    key->min_filter = desc_def->min_filter;
+    key->mag_filter = desc_def->mag_filter;
+    key->mipmap_filter = desc_def->mipmap_filter;
+    key->wrap_u = desc_def->wrap_u;
+    key->wrap_v = desc_def->wrap_v;
+    key->wrap_w = desc_def->wrap_w;
+    key->min_lod = desc_def->min_lod;
+    key->max_lod = desc_def->max_lod;
+    key->border_color = desc_def->border_color;
+    key->compare = desc_def->compare;
+    key->max_anisotropy = desc_def->max_anisotropy;
+    *out_hash = _sg_hash(key, (int)sizeof(sg_sampler_desc), 0x1234567887654321);
+    return true;
+}
+
 _SOKOL_PRIVATE sg_buffer _sg_alloc_buffer(void) {
     sg_buffer res;
-    int slot_index = _sg_pool_alloc_index(&_sg.pools.buffer_pool);
+    _sg_pool_t* pool = &_sg.pools.buffer_pool;
+    const int old_pool_size = pool->size;
+    if (_sg_pool_grow_if_exhausted(pool)) {
+        _sg.pools.buffers = _sg_buffer_items_grow(_sg.pools.buffers, old_pool_size, pool->size);
+    }
+    int slot_index = _sg_pool_alloc_index(pool);
     if (_SG_INVALID_SLOT_INDEX != slot_index) {
-        res.id = _sg_slot_alloc(&_sg.pools.buffer_pool, &_sg.pools.buffers[slot_index].slot, slot_index);
+        res.id = _sg_slot_alloc(pool, &_sg.pools.buffers[slot_index]->slot, slot_index);
     } else {
         res.id = SG_INVALID_ID;
         _SG_ERROR(BUFFER_POOL_EXHAUSTED);
@@ -19866,9 +24667,14 @@ _SOKOL_PRIVATE sg_buffer _sg_alloc_buffer(void) {
 
 _SOKOL_PRIVATE sg_image _sg_alloc_image(void) {
     sg_image res;
-    int slot_index = _sg_pool_alloc_index(&_sg.pools.image_pool);
+    _sg_pool_t* pool = &_sg.pools.image_pool;
+    const int old_pool_size = pool->size;
+    if (_sg_pool_grow_if_exhausted(pool)) {
+        _sg.pools.images = _sg_image_items_grow(_sg.pools.images, old_pool_size, pool->size);
+    }
+    int slot_index = _sg_pool_alloc_index(pool);
     if (_SG_INVALID_SLOT_INDEX != slot_index) {
-        res.id = _sg_slot_alloc(&_sg.pools.image_pool, &_sg.pools.images[slot_index].slot, slot_index);
+        res.id = _sg_slot_alloc(pool, &_sg.pools.images[slot_index]->slot, slot_index);
     } else {
         res.id = SG_INVALID_ID;
         _SG_ERROR(IMAGE_POOL_EXHAUSTED);
@@ -19878,9 +24684,14 @@ _SOKOL_PRIVATE sg_image _sg_alloc_image(void) {
 
 _SOKOL_PRIVATE sg_sampler _sg_alloc_sampler(void) {
     sg_sampler res;
-    int slot_index = _sg_pool_alloc_index(&_sg.pools.sampler_pool);
+    _sg_pool_t* pool = &_sg.pools.sampler_pool;
+    const int old_pool_size = pool->size;
+    if (_sg_pool_grow_if_exhausted(pool)) {
+        _sg.pools.samplers = _sg_sampler_items_grow(_sg.pools.samplers, old_pool_size, pool->size);
+    }
+    int slot_index = _sg_pool_alloc_index(pool);
     if (_SG_INVALID_SLOT_INDEX != slot_index) {
-        res.id = _sg_slot_alloc(&_sg.pools.sampler_pool, &_sg.pools.samplers[slot_index].slot, slot_index);
+        res.id = _sg_slot_alloc(pool, &_sg.pools.samplers[slot_index]->slot, slot_index);
     } else {
         res.id = SG_INVALID_ID;
         _SG_ERROR(SAMPLER_POOL_EXHAUSTED);
@@ -19890,9 +24701,14 @@ _SOKOL_PRIVATE sg_sampler _sg_alloc_sampler(void) {
 
 _SOKOL_PRIVATE sg_shader _sg_alloc_shader(void) {
     sg_shader res;
-    int slot_index = _sg_pool_alloc_index(&_sg.pools.shader_pool);
+    _sg_pool_t* pool = &_sg.pools.shader_pool;
+    const int old_pool_size = pool->size;
+    if (_sg_pool_grow_if_exhausted(pool)) {
+        _sg.pools.shaders = _sg_shader_items_grow(_sg.pools.shaders, old_pool_size, pool->size);
+    }
+    int slot_index = _sg_pool_alloc_index(pool);
     if (_SG_INVALID_SLOT_INDEX != slot_index) {
-        res.id = _sg_slot_alloc(&_sg.pools.shader_pool, &_sg.pools.shaders[slot_index].slot, slot_index);
+        res.id = _sg_slot_alloc(pool, &_sg.pools.shaders[slot_index]->slot, slot_index);
     } else {
         res.id = SG_INVALID_ID;
         _SG_ERROR(SHADER_POOL_EXHAUSTED);
@@ -19902,9 +24718,14 @@ _SOKOL_PRIVATE sg_shader _sg_alloc_shader(void) {
 
 _SOKOL_PRIVATE sg_pipeline _sg_alloc_pipeline(void) {
     sg_pipeline res;
-    int slot_index = _sg_pool_alloc_index(&_sg.pools.pipeline_pool);
+    _sg_pool_t* pool = &_sg.pools.pipeline_pool;
+    const int old_pool_size = pool->size;
+    if (_sg_pool_grow_if_exhausted(pool)) {
+        _sg.pools.pipelines = _sg_pipeline_items_grow(_sg.pools.pipelines, old_pool_size, pool->size);
+    }
+    int slot_index = _sg_pool_alloc_index(pool);
     if (_SG_INVALID_SLOT_INDEX != slot_index) {
-        res.id =_sg_slot_alloc(&_sg.pools.pipeline_pool, &_sg.pools.pipelines[slot_index].slot, slot_index);
+        res.id =_sg_slot_alloc(pool, &_sg.pools.pipelines[slot_index]->slot, slot_index);
     } else {
         res.id = SG_INVALID_ID;
         _SG_ERROR(PIPELINE_POOL_EXHAUSTED);
@@ -19914,9 +24735,14 @@ _SOKOL_PRIVATE sg_pipeline _sg_alloc_pipeline(void) {
 
 _SOKOL_PRIVATE sg_attachments _sg_alloc_attachments(void) {
     sg_attachments res;
-    int slot_index = _sg_pool_alloc_index(&_sg.pools.attachments_pool);
+    _sg_pool_t* pool = &_sg.pools.attachments_pool;
+    const int old_pool_size = pool->size;
+    if (_sg_pool_grow_if_exhausted(pool)) {
+        _sg.pools.attachments = _sg_attachments_items_grow(_sg.pools.attachments, old_pool_size, pool->size);
+    }
+    int slot_index = _sg_pool_alloc_index(pool);
     if (_SG_INVALID_SLOT_INDEX != slot_index) {
-        res.id = _sg_slot_alloc(&_sg.pools.attachments_pool, &_sg.pools.attachments[slot_index].slot, slot_index);
+        res.id = _sg_slot_alloc(pool, &_sg.pools.attachments[slot_index]->slot, slot_index);
     } else {
         res.id = SG_INVALID_ID;
         _SG_ERROR(PASS_POOL_EXHAUSTED);
@@ -19924,6 +24750,57 @@ _SOKOL_PRIVATE sg_attachments _sg_alloc_attachments(void) {
     return res;
 }
 
+_SOKOL_PRIVATE sg_bindgroup _sg_alloc_bindgroup(void) {
+    sg_bindgroup res;
+    _sg_pool_t* pool = &_sg.pools.bindgroup_pool;
+    const int old_pool_size = pool->size;
+    if (_sg_pool_grow_if_exhausted(pool)) {
+        _sg.pools.bindgroups = _sg_bindgroup_items_grow(_sg.pools.bindgroups, old_pool_size, pool->size);
+    }
+    int slot_index = _sg_pool_alloc_index(pool);
+    if (_SG_INVALID_SLOT_INDEX != slot_index) {
+        res.id = _sg_slot_alloc(pool, &_sg.pools.bindgroups[slot_index]->slot, slot_index);
+    } else {
+        res.id = SG_INVALID_ID;
+        _SG_ERROR(BINDGROUP_POOL_EXHAUSTED);
+    }
+    return res;
+}
+
+_SOKOL_PRIVATE sg_command_list _sg_alloc_command_list(void) {
+    sg_command_list res;
+    _sg_pool_t* pool = &_sg.pools.command_list_pool;
+    const int old_pool_size = pool->size;
+    if (_sg_pool_grow_if_exhausted(pool)) {
+        _sg.pools.command_lists = _sg_command_list_items_grow(_sg.pools.command_lists, old_pool_size, pool->size);
+    }
+    int slot_index = _sg_pool_alloc_index(pool);
+    if (_SG_INVALID_SLOT_INDEX != slot_index) {
+        res.id = _sg_slot_alloc(pool, &_sg.pools.command_lists[slot_index]->slot, slot_index);
+    } else {
+        res.id = SG_INVALID_ID;
+        _SG_ERROR(COMMAND_LIST_POOL_EXHAUSTED);
+    }
+    return res;
+}
+
+_SOKOL_PRIVATE sg_readback _sg_alloc_readback(void) {
+    sg_readback res;
+    _sg_pool_t* pool = &_sg.pools.readback_pool;
+    const int old_pool_size = pool->size;
+    if (_sg_pool_grow_if_exhausted(pool)) {
+        _sg.pools.readbacks = _sg_readback_items_grow(_sg.pools.readbacks, old_pool_size, pool->size);
+    }
+    int slot_index = _sg_pool_alloc_index(pool);
+    if (_SG_INVALID_SLOT_INDEX != slot_index) {
+        res.id = _sg_slot_alloc(pool, &_sg.pools.readbacks[slot_index]->slot, slot_index);
+    } else {
+        res.id = SG_INVALID_ID;
+        _SG_ERROR(READBACK_POOL_EXHAUSTED);
+    }
+    return res;
+}
+
 _SOKOL_PRIVATE void _sg_dealloc_buffer(_sg_buffer_t* buf) {
     SOKOL_ASSERT(buf && (buf->slot.state == SG_RESOURCESTATE_ALLOC) && (buf->slot.id != SG_INVALID_ID));
     _sg_pool_free_index(&_sg.pools.buffer_pool, _sg_slot_index(buf->slot.id));
@@ -19960,12 +24837,206 @@ _SOKOL_PRIVATE void _sg_dealloc_attachments(_sg_attachments_t* atts) {
     _sg_slot_reset(&atts->slot);
 }
 
+_SOKOL_PRIVATE void _sg_dealloc_bindgroup(_sg_bindgroup_t* bg) {
+    SOKOL_ASSERT(bg && (bg->slot.state == SG_RESOURCESTATE_ALLOC) && (bg->slot.id != SG_INVALID_ID));
+    _sg_pool_free_index(&_sg.pools.bindgroup_pool, _sg_slot_index(bg->slot.id));
+    _sg_slot_reset(&bg->slot);
+}
+
+_SOKOL_PRIVATE void _sg_dealloc_command_list(_sg_command_list_t* cl) {
+    SOKOL_ASSERT(cl && (cl->slot.state == SG_RESOURCESTATE_ALLOC) && (cl->slot.id != SG_INVALID_ID));
+    _sg_pool_free_index(&_sg.pools.command_list_pool, _sg_slot_index(cl->slot.id));
+    _sg_slot_reset(&cl->slot);
+}
+
+_SOKOL_PRIVATE void _sg_dealloc_readback(_sg_readback_t* rb) {
+    SOKOL_ASSERT(rb && (rb->slot.state == SG_RESOURCESTATE_ALLOC) && (rb->slot.id != SG_INVALID_ID));
+    _sg_pool_free_index(&_sg.pools.readback_pool, _sg_slot_index(rb->slot.id));
+    _sg_slot_reset(&rb->slot);
+}
+
+_SOKOL_PRIVATE void _sg_setup_mipmaps(const sg_desc* desc) {
+    SOKOL_ASSERT(desc && (desc->image_pool_size > 0));
+    _sg_tracker_init(&_sg.mipmaps.pending, (uint32_t)desc->image_pool_size);
+}
+
+_SOKOL_PRIVATE void _sg_discard_mipmaps(void) {
+    _sg_tracker_discard(&_sg.mipmaps.pending);
+}
+
+// generate the mip chain right away, or defer until sg_end_pass() when called inside a pass
+_SOKOL_PRIVATE void _sg_request_generate_mipmaps(_sg_image_t* img) {
+    SOKOL_ASSERT(img && img->cmn.generate_mipmaps);
+    if (img->cmn.num_mipmaps < 2) {
+        return;
+    }
+    if (!_sg.cur_pass.in_pass) {
+        _sg_generate_mipmaps(img);
+        return;
+    }
+    if (img->cmn.mipmaps_pending) {
+        return;
+    }
+    // each image is tracked at most once, so the tracker only fills up
+    // when a growable image pool has grown beyond its initial size
+    _sg_tracker_t* tracker = &_sg.mipmaps.pending;
+    if (tracker->cur == tracker->size) {
+        const uint32_t new_size = tracker->size * 2;
+        uint32_t* new_items = (uint32_t*)_sg_malloc_clear(new_size * sizeof(uint32_t));
+        memcpy(new_items, tracker->items, tracker->cur * sizeof(uint32_t));
+        _sg_free(tracker->items);
+        tracker->items = new_items;
+        tracker->size = new_size;
+    }
+    _sg_tracker_add(tracker, img->slot.id);
+    img->cmn.mipmaps_pending = true;
+}
+
+_SOKOL_PRIVATE void _sg_mipmaps_on_endpass(void) {
+    SOKOL_ASSERT(!_sg.cur_pass.in_pass);
+    _sg_tracker_t* tracker = &_sg.mipmaps.pending;
+    for (uint32_t i = 0; i < tracker->cur; i++) {
+        // images may have been destroyed in the meantime
+        _sg_image_t* img = _sg_lookup_image(tracker->items[i]);
+        if (img && (img->slot.state == SG_RESOURCESTATE_VALID) && img->cmn.mipmaps_pending) {
+            img->cmn.mipmaps_pending = false;
+            _sg_generate_mipmaps(img);
+        }
+    }
+    _sg_tracker_reset(tracker);
+}
+
+// number of backend objects per buffer or image (see sg_update_mode)
+_SOKOL_PRIVATE uint64_t _sg_memory_num_copies(int num_slots) {
+    #if defined(SOKOL_D3D11) || defined(SOKOL_WGPU)
+        _SOKOL_UNUSED(num_slots);
+        return 1;
+    #else
+        return (uint64_t)num_slots;
+    #endif
+}
+
+_SOKOL_PRIVATE uint64_t _sg_buffer_memory_size(const _sg_buffer_t* buf) {
+    return (uint64_t)buf->cmn.size * _sg_memory_num_copies(buf->cmn.num_slots);
+}
+
+_SOKOL_PRIVATE uint64_t _sg_image_memory_size(const _sg_image_t* img) {
+    const int num_faces = (img->cmn.type == SG_IMAGETYPE_CUBE) ? 6 : 1;
+    uint64_t size = 0;
+    for (int mip_index = 0; mip_index < img->cmn.num_mipmaps; mip_index++) {
+        const int mip_width = _sg_miplevel_dim(img->cmn.width, mip_index);
+        const int mip_height = _sg_miplevel_dim(img->cmn.height, mip_index);
+        const int mip_slices = (img->cmn.type == SG_IMAGETYPE_3D) ? _sg_miplevel_dim(img->cmn.num_slices, mip_index) : img->cmn.num_slices;
+        size += (uint64_t)_sg_surface_pitch(img->cmn.pixel_format, mip_width, mip_height, 1) * (uint64_t)mip_slices;
+    }
+    return size * (uint64_t)num_faces * (uint64_t)img->cmn.sample_count * _sg_memory_num_copies(img->cmn.num_slots);
+}
+
+_SOKOL_PRIVATE sg_memory_info* _sg_buffer_memory_info(const sg_buffer_usage* usage) {
+    if (usage->stream_update) {
+        return &_sg.memory.stats.buffers.stream_update;
+    } else if (usage->dynamic_update) {
+        return &_sg.memory.stats.buffers.dynamic_update;
+    } else {
+        return &_sg.memory.stats.buffers.immutable;
+    }
+}
+
+_SOKOL_PRIVATE sg_memory_info* _sg_image_memory_info(const sg_image_usage* usage) {
+    if (usage->render_attachment) {
+        return &_sg.memory.stats.images.render_attachment;
+    } else if (usage->storage_attachment) {
+        return &_sg.memory.stats.images.storage_attachment;
+    } else if (usage->stream_update) {
+        return &_sg.memory.stats.images.stream_update;
+    } else if (usage->dynamic_update) {
+        return &_sg.memory.stats.images.dynamic_update;
+    } else {
+        return &_sg.memory.stats.images.immutable;
+    }
+}
+
+_SOKOL_PRIVATE void _sg_memory_add(sg_memory_info* info, sg_memory_info* group, uint64_t num_bytes) {
+    sg_memory_stats* stats = &_sg.memory.stats;
+    info->num_resources += 1;
+    info->num_bytes += num_bytes;
+    group->num_resources += 1;
+    group->num_bytes += num_bytes;
+    stats->total.num_resources += 1;
+    stats->total.num_bytes += num_bytes;
+    if (stats->total.num_bytes > stats->high_water_mark) {
+        stats->high_water_mark = stats->total.num_bytes;
+    }
+    if ((stats->budget > 0) && (stats->total.num_bytes > stats->budget)) {
+        _sg.memory.budget_exceeded = true;
+    }
+}
+
+_SOKOL_PRIVATE void _sg_memory_remove(sg_memory_info* info, sg_memory_info* group, uint64_t num_bytes) {
+    sg_memory_stats* stats = &_sg.memory.stats;
+    SOKOL_ASSERT((info->num_resources > 0) && (info->num_bytes >= num_bytes));
+    info->num_resources -= 1;
+    info->num_bytes -= num_bytes;
+    group->num_resources -= 1;
+    group->num_bytes -= num_bytes;
+    stats->total.num_resources -= 1;
+    stats->total.num_bytes -= num_bytes;
+    if (stats->total.num_bytes <= stats->budget) {
+        // re-arm the budget callback
+        _sg.memory.budget_exceeded = false;
+        _sg.memory.budget_notified = false;
+    }
+}
+
+_SOKOL_PRIVATE void _sg_memory_track_buffer(_sg_buffer_t* buf) {
+    SOKOL_ASSERT(buf && (buf->slot.state == SG_RESOURCESTATE_VALID) && (0 == buf->cmn.mem_size));
+    buf->cmn.mem_size = _sg_buffer_memory_size(buf);
+    _sg_memory_add(_sg_buffer_memory_info(&buf->cmn.usage), &_sg.memory.stats.buffers.total, buf->cmn.mem_size);
+}
+
+_SOKOL_PRIVATE void _sg_memory_untrack_buffer(const _sg_buffer_t* buf) {
+    SOKOL_ASSERT(buf);
+    // failed buffers have never been tracked
+    if (buf->cmn.mem_size > 0) {
+        _sg_memory_remove(_sg_buffer_memory_info(&buf->cmn.usage), &_sg.memory.stats.buffers.total, buf->cmn.mem_size);
+    }
+}
+
+_SOKOL_PRIVATE void _sg_memory_track_image(_sg_image_t* img) {
+    SOKOL_ASSERT(img && (img->slot.state == SG_RESOURCESTATE_VALID) && (0 == img->cmn.mem_size));
+    img->cmn.mem_size = _sg_image_memory_size(img);
+    _sg_memory_add(_sg_image_memory_info(&img->cmn.usage), &_sg.memory.stats.images.total, img->cmn.mem_size);
+}
+
+_SOKOL_PRIVATE void _sg_memory_untrack_image(const _sg_image_t* img) {
+    SOKOL_ASSERT(img);
+    if (img->cmn.mem_size > 0) {
+        _sg_memory_remove(_sg_image_memory_info(&img->cmn.usage), &_sg.memory.stats.images.total, img->cmn.mem_size);
+    }
+}
+
+// called at the end of the public buffer and image creation functions, so that
+// the callback may safely destroy resources
+_SOKOL_PRIVATE void _sg_memory_check_budget(void) {
+    if (_sg.memory.budget_exceeded && !_sg.memory.budget_notified) {
+        _sg.memory.budget_notified = true;
+        _SG_WARN(MEMORY_BUDGET_EXCEEDED);
+        if (_sg.desc.memory_budget.exceeded_cb) {
+            const sg_memory_stats stats = _sg.memory.stats;
+            _sg.desc.memory_budget.exceeded_cb(&stats, _sg.desc.memory_budget.user_data);
+        }
+    }
+}
+
 _SOKOL_PRIVATE void _sg_init_buffer(_sg_buffer_t* buf, const sg_buffer_desc* desc) {
     SOKOL_ASSERT(buf && (buf->slot.state == SG_RESOURCESTATE_ALLOC));
     SOKOL_ASSERT(desc);
     if (_sg_validate_buffer_desc(desc)) {
         _sg_buffer_common_init(&buf->cmn, desc);
         buf->slot.state = _sg_create_buffer(buf, desc);
+        if (buf->slot.state == SG_RESOURCESTATE_VALID) {
+            _sg_memory_track_buffer(buf);
+        }
     } else {
         buf->slot.state = SG_RESOURCESTATE_FAILED;
     }
@@ -19978,6 +25049,12 @@ _SOKOL_PRIVATE void _sg_init_image(_sg_image_t* img, const sg_image_desc* desc)
     if (_sg_validate_image_desc(desc)) {
         _sg_image_common_init(&img->cmn, desc);
         img->slot.state = _sg_create_image(img, desc);
+        if (img->slot.state == SG_RESOURCESTATE_VALID) {
+            _sg_memory_track_image(img);
+        }
+        if ((img->slot.state == SG_RESOURCESTATE_VALID) && img->cmn.generate_mipmaps && desc->data.subimage[0][0].ptr) {
+            _sg_request_generate_mipmaps(img);
+        }
     } else {
         img->slot.state = SG_RESOURCESTATE_FAILED;
     }
@@ -20081,47 +25158,400 @@ _SOKOL_PRIVATE void _sg_init_attachments(_sg_attachments_t* atts, const sg_attac
         _sg_attachments_common_init(&atts->cmn, desc, &atts_ptrs, width, height);
         atts->slot.state = _sg_create_attachments(atts, desc);
     } else {
-        atts->slot.state = SG_RESOURCESTATE_FAILED;
+        atts->slot.state = SG_RESOURCESTATE_FAILED;
+    }
+    SOKOL_ASSERT((atts->slot.state == SG_RESOURCESTATE_VALID)||(atts->slot.state == SG_RESOURCESTATE_FAILED));
+}
+
+// resolve the bindings of a bindgroup into resource references, this must not
+// rely on the validation layer since it is also used in release mode
+_SOKOL_PRIVATE sg_resource_state _sg_bindgroup_resolve(_sg_bindgroup_t* bg, const sg_bindgroup_desc* desc) {
+    _sg_pipeline_t* pip = _sg_lookup_pipeline(desc->pipeline.id);
+    if ((0 == pip) || (pip->slot.state != SG_RESOURCESTATE_VALID) || !_sg_shader_ref_alive(&pip->cmn.shader)) {
+        return SG_RESOURCESTATE_FAILED;
+    }
+    _sg_shader_t* shd = _sg_shader_ref_ptr(&pip->cmn.shader);
+    if (shd->slot.state != SG_RESOURCESTATE_VALID) {
+        return SG_RESOURCESTATE_FAILED;
+    }
+    const sg_bindings* bnd = &desc->bindings;
+    bg->pip = _sg_pipeline_ref(pip);
+    bg->shd = _sg_shader_ref(shd);
+    bg->is_compute = pip->cmn.is_compute;
+    if (!bg->is_compute) {
+        for (size_t i = 0; i < SG_MAX_VERTEXBUFFER_BINDSLOTS; i++) {
+            if (pip->cmn.vertex_buffer_layout_active[i]) {
+                _sg_buffer_t* vb = _sg_lookup_buffer(bnd->vertex_buffers[i].id);
+                if (0 == vb) {
+                    return SG_RESOURCESTATE_FAILED;
+                }
+                bg->vbs[i] = _sg_buffer_ref(vb);
+                bg->vb_offsets[i] = bnd->vertex_buffer_offsets[i];
+                bg->vb_slots[bg->num_vbs++] = (uint8_t)i;
+            }
+        }
+        if (pip->cmn.index_type != SG_INDEXTYPE_NONE) {
+            _sg_buffer_t* ib = _sg_lookup_buffer(bnd->index_buffer.id);
+            if (0 == ib) {
+                return SG_RESOURCESTATE_FAILED;
+            }
+            bg->ib = _sg_buffer_ref(ib);
+            bg->ib_offset = bnd->index_buffer_offset;
+        }
+    }
+    for (size_t i = 0; i < SG_MAX_IMAGE_BINDSLOTS; i++) {
+        if (shd->cmn.images[i].stage != SG_SHADERSTAGE_NONE) {
+            _sg_image_t* img = _sg_lookup_image(bnd->images[i].id);
+            if (0 == img) {
+                return SG_RESOURCESTATE_FAILED;
+            }
+            bg->imgs[i] = _sg_image_ref(img);
+            bg->img_slots[bg->num_imgs++] = (uint8_t)i;
+        }
+    }
+    for (size_t i = 0; i < SG_MAX_SAMPLER_BINDSLOTS; i++) {
+        if (shd->cmn.samplers[i].stage != SG_SHADERSTAGE_NONE) {
+            _sg_sampler_t* smp = _sg_lookup_sampler(bnd->samplers[i].id);
+            if (0 == smp) {
+                return SG_RESOURCESTATE_FAILED;
+            }
+            bg->smps[i] = _sg_sampler_ref(smp);
+            bg->smp_slots[bg->num_smps++] = (uint8_t)i;
+        }
+    }
+    for (size_t i = 0; i < SG_MAX_STORAGEBUFFER_BINDSLOTS; i++) {
+        if (shd->cmn.storage_buffers[i].stage != SG_SHADERSTAGE_NONE) {
+            _sg_buffer_t* sbuf = _sg_lookup_buffer(bnd->storage_buffers[i].id);
+            if (0 == sbuf) {
+                return SG_RESOURCESTATE_FAILED;
+            }
+            bg->sbufs[i] = _sg_buffer_ref(sbuf);
+            bg->sbuf_slots[bg->num_sbufs++] = (uint8_t)i;
+        }
+    }
+    #if defined(SOKOL_DEBUG)
+    bg->bindings = *bnd;
+    #endif
+    return SG_RESOURCESTATE_VALID;
+}
+
+_SOKOL_PRIVATE void _sg_init_bindgroup(_sg_bindgroup_t* bg, const sg_bindgroup_desc* desc) {
+    SOKOL_ASSERT(bg && (bg->slot.state == SG_RESOURCESTATE_ALLOC));
+    SOKOL_ASSERT(desc);
+    if (_sg_validate_bindgroup_desc(desc)) {
+        bg->slot.state = _sg_bindgroup_resolve(bg, desc);
+    } else {
+        bg->slot.state = SG_RESOURCESTATE_FAILED;
+    }
+    SOKOL_ASSERT((bg->slot.state == SG_RESOURCESTATE_VALID)||(bg->slot.state == SG_RESOURCESTATE_FAILED));
+}
+
+_SOKOL_PRIVATE void _sg_init_command_list(_sg_command_list_t* cl, const sg_command_list_desc* desc) {
+    SOKOL_ASSERT(cl && (cl->slot.state == SG_RESOURCESTATE_ALLOC));
+    SOKOL_ASSERT(desc && (desc->buffer_size > 0));
+    if (_sg_validate_command_list_desc(desc)) {
+        cl->size = desc->buffer_size;
+        cl->buf = (uint8_t*) _sg_malloc(cl->size);
+        cl->slot.state = SG_RESOURCESTATE_VALID;
+    } else {
+        cl->slot.state = SG_RESOURCESTATE_FAILED;
+    }
+}
+
+_SOKOL_PRIVATE void _sg_destroy_queue_push(_sg_destroy_queue_t* queue, const void* res, size_t res_size) {
+    SOKOL_ASSERT(queue && res && (res_size > 0));
+    SOKOL_ASSERT((0 == queue->item_size) || (queue->item_size == res_size));
+    if (queue->num == queue->cap) {
+        const int new_cap = _sg_max(64, 2 * queue->cap);
+        uint32_t* new_frame_indices = (uint32_t*)_sg_malloc((size_t)new_cap * sizeof(uint32_t));
+        uint8_t* new_items = (uint8_t*)_sg_malloc((size_t)new_cap * res_size);
+        if (queue->num > 0) {
+            memcpy(new_frame_indices, queue->frame_indices, (size_t)queue->num * sizeof(uint32_t));
+            memcpy(new_items, queue->items, (size_t)queue->num * res_size);
+        }
+        if (queue->items) {
+            _sg_free(queue->frame_indices);
+            _sg_free(queue->items);
+        }
+        queue->frame_indices = new_frame_indices;
+        queue->items = new_items;
+        queue->cap = new_cap;
+        queue->item_size = res_size;
+    }
+    queue->frame_indices[queue->num] = _sg.frame_index;
+    memcpy(queue->items + (size_t)queue->num * res_size, res, res_size);
+    queue->num += 1;
+}
+
+// returns the number of queued items which are ready to be released, items are queued in frame order
+_SOKOL_PRIVATE int _sg_destroy_queue_num_ready(const _sg_destroy_queue_t* queue, bool all) {
+    SOKOL_ASSERT(queue);
+    if (all) {
+        return queue->num;
+    }
+    int num_ready = 0;
+    while ((num_ready < queue->num) && ((queue->frame_indices[num_ready] + SG_NUM_INFLIGHT_FRAMES) <= _sg.frame_index)) {
+        num_ready++;
+    }
+    return num_ready;
+}
+
+// remove the first num items from the queue
+_SOKOL_PRIVATE void _sg_destroy_queue_pop(_sg_destroy_queue_t* queue, int num) {
+    SOKOL_ASSERT(queue && (num >= 0) && (num <= queue->num));
+    if (num == 0) {
+        return;
+    }
+    const int num_left = queue->num - num;
+    if (num_left > 0) {
+        memmove(queue->frame_indices, queue->frame_indices + num, (size_t)num_left * sizeof(uint32_t));
+        memmove(queue->items, queue->items + (size_t)num * queue->item_size, (size_t)num_left * queue->item_size);
+    }
+    queue->num = num_left;
+}
+
+_SOKOL_PRIVATE void _sg_destroy_queue_discard(_sg_destroy_queue_t* queue) {
+    SOKOL_ASSERT(queue && (0 == queue->num));
+    if (queue->items) {
+        _sg_free(queue->frame_indices);
+        _sg_free(queue->items);
+    }
+    _sg_clear(queue, sizeof(_sg_destroy_queue_t));
+}
+
+/* release the backend objects of destroyed resources which are no longer in
+   flight, called from sg_commit() after the frame has been submitted, and with
+   'all == true' from sg_shutdown()
+*/
+_SOKOL_PRIVATE void _sg_release_destroyed_resources(bool all) {
+    int num;
+    num = _sg_destroy_queue_num_ready(&_sg.destroy_queue.buffers, all);
+    for (int i = 0; i < num; i++) {
+        _sg_buffer_t* buf = (_sg_buffer_t*)(_sg.destroy_queue.buffers.items + (size_t)i * sizeof(_sg_buffer_t));
+        _sg_memory_untrack_buffer(buf);
+        _sg_discard_buffer(buf);
+    }
+    _sg_destroy_queue_pop(&_sg.destroy_queue.buffers, num);
+    num = _sg_destroy_queue_num_ready(&_sg.destroy_queue.images, all);
+    for (int i = 0; i < num; i++) {
+        _sg_image_t* img = (_sg_image_t*)(_sg.destroy_queue.images.items + (size_t)i * sizeof(_sg_image_t));
+        _sg_memory_untrack_image(img);
+        _sg_discard_image(img);
+    }
+    _sg_destroy_queue_pop(&_sg.destroy_queue.images, num);
+    num = _sg_destroy_queue_num_ready(&_sg.destroy_queue.samplers, all);
+    for (int i = 0; i < num; i++) {
+        _sg_discard_sampler((_sg_sampler_t*)(_sg.destroy_queue.samplers.items + (size_t)i * sizeof(_sg_sampler_t)));
+    }
+    _sg_destroy_queue_pop(&_sg.destroy_queue.samplers, num);
+    num = _sg_destroy_queue_num_ready(&_sg.destroy_queue.shaders, all);
+    for (int i = 0; i < num; i++) {
+        _sg_discard_shader((_sg_shader_t*)(_sg.destroy_queue.shaders.items + (size_t)i * sizeof(_sg_shader_t)));
+    }
+    _sg_destroy_queue_pop(&_sg.destroy_queue.shaders, num);
+    num = _sg_destroy_queue_num_ready(&_sg.destroy_queue.pipelines, all);
+    for (int i = 0; i < num; i++) {
+        _sg_discard_pipeline((_sg_pipeline_t*)(_sg.destroy_queue.pipelines.items + (size_t)i * sizeof(_sg_pipeline_t)));
+    }
+    _sg_destroy_queue_pop(&_sg.destroy_queue.pipelines, num);
+    num = _sg_destroy_queue_num_ready(&_sg.destroy_queue.attachments, all);
+    for (int i = 0; i < num; i++) {
+        _sg_discard_attachments((_sg_attachments_t*)(_sg.destroy_queue.attachments.items + (size_t)i * sizeof(_sg_attachments_t)));
+    }
+    _sg_destroy_queue_pop(&_sg.destroy_queue.attachments, num);
+}
+
+_SOKOL_PRIVATE void _sg_discard_destroy_queues(void) {
+    _sg_destroy_queue_discard(&_sg.destroy_queue.buffers);
+    _sg_destroy_queue_discard(&_sg.destroy_queue.images);
+    _sg_destroy_queue_discard(&_sg.destroy_queue.samplers);
+    _sg_destroy_queue_discard(&_sg.destroy_queue.shaders);
+    _sg_destroy_queue_discard(&_sg.destroy_queue.pipelines);
+    _sg_destroy_queue_discard(&_sg.destroy_queue.attachments);
+}
+
+_SOKOL_PRIVATE void _sg_deferred_discard_buffer(_sg_buffer_t* buf) {
+    if (_sg.desc.deferred_destroy) {
+        _sg_destroy_queue_push(&_sg.destroy_queue.buffers, buf, sizeof(_sg_buffer_t));
+    } else {
+        _sg_memory_untrack_buffer(buf);
+        _sg_discard_buffer(buf);
+    }
+}
+
+_SOKOL_PRIVATE void _sg_deferred_discard_image(_sg_image_t* img) {
+    if (_sg.desc.deferred_destroy) {
+        _sg_destroy_queue_push(&_sg.destroy_queue.images, img, sizeof(_sg_image_t));
+    } else {
+        _sg_memory_untrack_image(img);
+        _sg_discard_image(img);
+    }
+}
+
+_SOKOL_PRIVATE void _sg_deferred_discard_sampler(_sg_sampler_t* smp) {
+    if (_sg.desc.deferred_destroy) {
+        _sg_destroy_queue_push(&_sg.destroy_queue.samplers, smp, sizeof(_sg_sampler_t));
+    } else {
+        _sg_discard_sampler(smp);
+    }
+}
+
+_SOKOL_PRIVATE void _sg_deferred_discard_shader(_sg_shader_t* shd) {
+    if (_sg.desc.deferred_destroy) {
+        _sg_destroy_queue_push(&_sg.destroy_queue.shaders, shd, sizeof(_sg_shader_t));
+    } else {
+        _sg_discard_shader(shd);
+    }
+}
+
+_SOKOL_PRIVATE void _sg_deferred_discard_pipeline(_sg_pipeline_t* pip) {
+    if (_sg.desc.deferred_destroy) {
+        _sg_destroy_queue_push(&_sg.destroy_queue.pipelines, pip, sizeof(_sg_pipeline_t));
+    } else {
+        _sg_discard_pipeline(pip);
+    }
+}
+
+_SOKOL_PRIVATE void _sg_deferred_discard_attachments(_sg_attachments_t* atts) {
+    if (_sg.desc.deferred_destroy) {
+        _sg_destroy_queue_push(&_sg.destroy_queue.attachments, atts, sizeof(_sg_attachments_t));
+    } else {
+        _sg_discard_attachments(atts);
     }
-    SOKOL_ASSERT((atts->slot.state == SG_RESOURCESTATE_VALID)||(atts->slot.state == SG_RESOURCESTATE_FAILED));
 }
 
 _SOKOL_PRIVATE void _sg_uninit_buffer(_sg_buffer_t* buf) {
     SOKOL_ASSERT(buf && ((buf->slot.state == SG_RESOURCESTATE_VALID) || (buf->slot.state == SG_RESOURCESTATE_FAILED)));
-    _sg_discard_buffer(buf);
+    _sg_deferred_discard_buffer(buf);
     _sg_reset_buffer_to_alloc_state(buf);
 }
 
 _SOKOL_PRIVATE void _sg_uninit_image(_sg_image_t* img) {
     SOKOL_ASSERT(img && ((img->slot.state == SG_RESOURCESTATE_VALID) || (img->slot.state == SG_RESOURCESTATE_FAILED)));
-    _sg_discard_image(img);
+    _sg_deferred_discard_image(img);
     _sg_reset_image_to_alloc_state(img);
 }
 
 _SOKOL_PRIVATE void _sg_uninit_sampler(_sg_sampler_t* smp) {
     SOKOL_ASSERT(smp && ((smp->slot.state == SG_RESOURCESTATE_VALID) || (smp->slot.state == SG_RESOURCESTATE_FAILED)));
-    _sg_discard_sampler(smp);
+    _sg_dedup_remove(&_sg.dedup.samplers, smp->slot.id);
+    _sg_deferred_discard_sampler(smp);
     _sg_reset_sampler_to_alloc_state(smp);
 }
 
 _SOKOL_PRIVATE void _sg_uninit_shader(_sg_shader_t* shd) {
     SOKOL_ASSERT(shd && ((shd->slot.state == SG_RESOURCESTATE_VALID) || (shd->slot.state == SG_RESOURCESTATE_FAILED)));
-    _sg_discard_shader(shd);
+    _sg_deferred_discard_shader(shd);
     _sg_reset_shader_to_alloc_state(shd);
 }
 
 _SOKOL_PRIVATE void _sg_uninit_pipeline(_sg_pipeline_t* pip) {
     SOKOL_ASSERT(pip && ((pip->slot.state == SG_RESOURCESTATE_VALID) || (pip->slot.state == SG_RESOURCESTATE_FAILED)));
-    _sg_discard_pipeline(pip);
+    _sg_dedup_remove(&_sg.dedup.pipelines, pip->slot.id);
+    _sg_deferred_discard_pipeline(pip);
     _sg_reset_pipeline_to_alloc_state(pip);
 }
 
 _SOKOL_PRIVATE void _sg_uninit_attachments(_sg_attachments_t* atts) {
     SOKOL_ASSERT(atts && ((atts->slot.state == SG_RESOURCESTATE_VALID) || (atts->slot.state == SG_RESOURCESTATE_FAILED)));
-    _sg_discard_attachments(atts);
+    _sg_deferred_discard_attachments(atts);
     _sg_reset_attachments_to_alloc_state(atts);
 }
 
+_SOKOL_PRIVATE void _sg_uninit_bindgroup(_sg_bindgroup_t* bg) {
+    SOKOL_ASSERT(bg && ((bg->slot.state == SG_RESOURCESTATE_VALID) || (bg->slot.state == SG_RESOURCESTATE_FAILED)));
+    // bindgroups don't own any backend resources
+    _sg_reset_bindgroup_to_alloc_state(bg);
+}
+
+_SOKOL_PRIVATE void _sg_uninit_command_list(_sg_command_list_t* cl) {
+    SOKOL_ASSERT(cl && ((cl->slot.state == SG_RESOURCESTATE_VALID) || (cl->slot.state == SG_RESOURCESTATE_FAILED)));
+    SOKOL_ASSERT(!cl->recording);
+    if (cl->buf) {
+        _sg_free(cl->buf);
+    }
+    _sg_reset_command_list_to_alloc_state(cl);
+}
+
+_SOKOL_PRIVATE void _sg_readback_common_init(_sg_readback_common_t* cmn, int width, int height, int row_pitch, const sg_range* data, void (*callback)(const sg_readback_result*), void* user_data) {
+    SOKOL_ASSERT(cmn && data && (width > 0) && (height > 0) && (row_pitch > 0));
+    cmn->width = width;
+    cmn->height = height;
+    cmn->row_pitch = row_pitch;
+    cmn->size = row_pitch * height;
+    cmn->data = *data;
+    cmn->callback = callback;
+    cmn->user_data = user_data;
+}
+
+// destroy a completed (or failed) readback and invoke its callback
+_SOKOL_PRIVATE void _sg_finish_readback(_sg_readback_t* rb) {
+    SOKOL_ASSERT(rb && rb->cmn.completed);
+    SOKOL_ASSERT((rb->slot.state == SG_RESOURCESTATE_VALID) || (rb->slot.state == SG_RESOURCESTATE_FAILED));
+    sg_readback_result result;
+    _sg_clear(&result, sizeof(result));
+    result.readback.id = rb->slot.id;
+    result.failed = rb->cmn.failed;
+    result.data.ptr = rb->cmn.data.ptr;
+    result.data.size = rb->cmn.failed ? 0 : (size_t)rb->cmn.size;
+    result.user_data = rb->cmn.user_data;
+    void (*callback)(const sg_readback_result*) = rb->cmn.callback;
+    _sg_discard_readback(rb);
+    _sg_reset_readback_to_alloc_state(rb);
+    _sg_dealloc_readback(rb);
+    // invoke the callback last, so that it may start a new readback
+    if (callback) {
+        callback(&result);
+    }
+}
+
+// called from sg_commit() after the frame has been submitted, and with
+// 'cancel == true' from sg_shutdown() to fail all pending readbacks
+_SOKOL_PRIVATE void _sg_update_readbacks(bool cancel) {
+    const _sg_pool_t* pool = &_sg.pools.readback_pool;
+    if (pool->queue_top == (pool->size - 1)) {
+        // no readbacks in flight
+        return;
+    }
+    for (int i = 1; i < pool->size; i++) {
+        _sg_readback_t* rb = _sg.pools.readbacks[i];
+        if (rb->slot.state == SG_RESOURCESTATE_FAILED) {
+            rb->cmn.completed = true;
+            rb->cmn.failed = true;
+        } else if (rb->slot.state != SG_RESOURCESTATE_VALID) {
+            continue;
+        } else if (!rb->cmn.completed) {
+            if (cancel) {
+                rb->cmn.completed = true;
+                rb->cmn.failed = true;
+            } else {
+                _sg_poll_readback(rb);
+            }
+        }
+        if (rb->cmn.completed) {
+            _sg_finish_readback(rb);
+        }
+    }
+}
+
+// check if a bindgroup can be used with a different pipeline than the one it was created with
+_SOKOL_PRIVATE bool _sg_bindgroup_compatible(const _sg_bindgroup_t* bg, const _sg_pipeline_t* pip) {
+    if (!_sg_shader_ref_alive(&bg->shd) || !_sg_shader_ref_eql(&pip->cmn.shader, bg->shd.ptr)) {
+        return false;
+    }
+    if (!pip->cmn.is_compute) {
+        for (size_t i = 0; i < SG_MAX_VERTEXBUFFER_BINDSLOTS; i++) {
+            if (pip->cmn.vertex_buffer_layout_active[i] && _sg_buffer_ref_null(&bg->vbs[i])) {
+                return false;
+            }
+        }
+        if ((pip->cmn.index_type == SG_INDEXTYPE_NONE) != _sg_buffer_ref_null(&bg->ib)) {
+            return false;
+        }
+    }
+    return true;
+}
+
 _SOKOL_PRIVATE void _sg_setup_commit_listeners(const sg_desc* desc) {
     SOKOL_ASSERT(desc->max_commit_listeners > 0);
     SOKOL_ASSERT(0 == _sg.commit_listeners.items);
@@ -20195,30 +25625,489 @@ _SOKOL_PRIVATE bool _sg_remove_commit_listener(const sg_commit_listener* listene
             return true;
         }
     }
-    return false;
-}
-
-_SOKOL_PRIVATE void _sg_setup_compute(const sg_desc* desc) {
-    SOKOL_ASSERT(desc && (desc->max_dispatch_calls_per_pass > 0));
-    const uint32_t max_tracked_sbufs = (uint32_t)desc->max_dispatch_calls_per_pass * SG_MAX_STORAGEBUFFER_BINDSLOTS;
-    _sg_tracker_init(&_sg.compute.readwrite_sbufs, max_tracked_sbufs);
-}
-
-_SOKOL_PRIVATE void _sg_discard_compute(void) {
-    _sg_tracker_discard(&_sg.compute.readwrite_sbufs);
-}
-
-_SOKOL_PRIVATE void _sg_compute_pass_track_storage_buffer(_sg_buffer_t* sbuf, bool readonly) {
-    SOKOL_ASSERT(sbuf);
-    if (!readonly) {
-        _sg_tracker_add(&_sg.compute.readwrite_sbufs, sbuf->slot.id);
-    }
-}
-
-_SOKOL_PRIVATE void _sg_compute_on_endpass(void) {
-    SOKOL_ASSERT(_sg.cur_pass.in_pass);
-    SOKOL_ASSERT(_sg.cur_pass.is_compute);
-    _sg_tracker_reset(&_sg.compute.readwrite_sbufs);
+    return false;
+}
+
+_SOKOL_PRIVATE void _sg_setup_compute(const sg_desc* desc) {
+    SOKOL_ASSERT(desc && (desc->max_dispatch_calls_per_pass > 0));
+    const uint32_t max_tracked_sbufs = (uint32_t)desc->max_dispatch_calls_per_pass * SG_MAX_STORAGEBUFFER_BINDSLOTS;
+    _sg_tracker_init(&_sg.compute.readwrite_sbufs, max_tracked_sbufs);
+}
+
+_SOKOL_PRIVATE void _sg_discard_compute(void) {
+    _sg_tracker_discard(&_sg.compute.readwrite_sbufs);
+}
+
+_SOKOL_PRIVATE void _sg_compute_pass_track_storage_buffer(_sg_buffer_t* sbuf, bool readonly) {
+    SOKOL_ASSERT(sbuf);
+    if (!readonly) {
+        _sg_tracker_add(&_sg.compute.readwrite_sbufs, sbuf->slot.id);
+    }
+}
+
+_SOKOL_PRIVATE void _sg_compute_on_endpass(void) {
+    SOKOL_ASSERT(_sg.cur_pass.in_pass);
+    SOKOL_ASSERT(_sg.cur_pass.is_compute);
+    _sg_tracker_reset(&_sg.compute.readwrite_sbufs);
+}
+
+_SOKOL_PRIVATE void _sg_reset_uniform_cache(void) {
+    _sg_clear(_sg.uniform_cache.hash, sizeof(_sg.uniform_cache.hash));
+    _sg_clear(_sg.uniform_cache.size, sizeof(_sg.uniform_cache.size));
+}
+
+_SOKOL_PRIVATE void _sg_discard_uniform_cache(void) {
+    for (int i = 0; i < SG_MAX_UNIFORMBLOCK_BINDSLOTS; i++) {
+        if (_sg.uniform_cache.data[i]) {
+            _sg_free(_sg.uniform_cache.data[i]);
+        }
+    }
+    _sg_clear(&_sg.uniform_cache, sizeof(_sg.uniform_cache));
+}
+
+// apply uniform data, skipping redundant updates if sg_desc.dedup_uniforms is true
+_SOKOL_PRIVATE void _sg_exec_apply_uniforms(int ub_slot, const sg_range* data) {
+    SOKOL_ASSERT((ub_slot >= 0) && (ub_slot < SG_MAX_UNIFORMBLOCK_BINDSLOTS));
+    SOKOL_ASSERT(data && data->ptr && (data->size > 0));
+    if (_sg.desc.dedup_uniforms) {
+        const uint64_t hash = _sg_hash(data->ptr, (int)data->size, 0);
+        // the hash is only a quick pre-check, a hash collision must not drop a real update
+        if ((_sg.uniform_cache.size[ub_slot] == data->size)
+            && (_sg.uniform_cache.hash[ub_slot] == hash)
+            && (0 == memcmp(_sg.uniform_cache.data[ub_slot], data->ptr, data->size)))
+        {
+            _sg_stats_add(num_apply_uniforms_skipped, 1);
+            return;
+        }
+        if (_sg.uniform_cache.capacity[ub_slot] < data->size) {
+            if (_sg.uniform_cache.data[ub_slot]) {
+                _sg_free(_sg.uniform_cache.data[ub_slot]);
+            }
+            _sg.uniform_cache.data[ub_slot] = (uint8_t*)_sg_malloc(data->size);
+            _sg.uniform_cache.capacity[ub_slot] = data->size;
+        }
+        memcpy(_sg.uniform_cache.data[ub_slot], data->ptr, data->size);
+        _sg.uniform_cache.hash[ub_slot] = hash;
+        _sg.uniform_cache.size[ub_slot] = data->size;
+    }
+    _sg_apply_uniforms(ub_slot, data);
+}
+
+// apply a pipeline object, shared by sg_apply_pipeline() and command list execution
+_SOKOL_PRIVATE void _sg_exec_apply_pipeline(_sg_pipeline_t* pip) {
+    SOKOL_ASSERT(pip);
+    _sg_reset_uniform_cache();
+    _sg.cur_pip = _sg_pipeline_ref(pip);
+    _sg.next_draw_valid = (SG_RESOURCESTATE_VALID == pip->slot.state);
+    if (!_sg.next_draw_valid) {
+        return;
+    }
+    _sg_apply_pipeline(pip);
+
+    // set the expected bindings and uniform block flags
+    const _sg_shader_t* shd = _sg_shader_ref_ptr(&pip->cmn.shader);
+    _sg.required_bindings_and_uniforms = pip->cmn.required_bindings_and_uniforms | shd->cmn.required_bindings_and_uniforms;
+    _sg.applied_bindings_and_uniforms = 0;
+}
+
+// allocate a new item in the command stream, returns null on overflow
+_SOKOL_PRIVATE void* _sg_cmdlist_push(_sg_command_list_t* cl, _sg_cmd_type_t type, size_t size) {
+    SOKOL_ASSERT(cl && cl->recording && cl->buf);
+    SOKOL_ASSERT(size >= sizeof(_sg_cmd_t));
+    if (cl->overflow) {
+        return 0;
+    }
+    size = (size_t)_sg_roundup_u64((uint64_t)size, 8);
+    if ((cl->pos + size) > cl->size) {
+        cl->overflow = true;
+        _SG_ERROR(COMMAND_LIST_OVERFLOW);
+        return 0;
+    }
+    _sg_cmd_t* cmd = (_sg_cmd_t*) (cl->buf + cl->pos);
+    cmd->type = (uint32_t)type;
+    cmd->size = (uint32_t)size;
+    cl->pos += size;
+    return cmd;
+}
+
+_SOKOL_PRIVATE void _sg_cmdlist_push_invalidate(_sg_command_list_t* cl) {
+    _sg_cmdlist_push(cl, _SG_CMD_INVALIDATE, sizeof(_sg_cmd_t));
+}
+
+_SOKOL_PRIVATE _sg_cmd_resource_t* _sg_cmdlist_add_resource(_sg_cmd_resource_t* items, int* num_items, _sg_cmdres_type_t type, size_t slot, int offset) {
+    SOKOL_ASSERT(*num_items < _SG_CMD_MAX_RESOURCES);
+    _sg_cmd_resource_t* item = &items[(*num_items)++];
+    _sg_clear(item, sizeof(_sg_cmd_resource_t));
+    item->type = (uint8_t)type;
+    item->slot = (uint8_t)slot;
+    item->offset = offset;
+    return item;
+}
+
+_SOKOL_PRIVATE void _sg_cmdlist_push_bindings(_sg_command_list_t* cl, bool valid, const _sg_cmd_resource_t* items, int num_items) {
+    if (!valid) {
+        num_items = 0;
+    }
+    const size_t items_size = (size_t)num_items * sizeof(_sg_cmd_resource_t);
+    _sg_cmd_bindings_t* cmd = (_sg_cmd_bindings_t*) _sg_cmdlist_push(cl, _SG_CMD_APPLY_BINDINGS, sizeof(_sg_cmd_bindings_t) + items_size);
+    if (cmd) {
+        cmd->valid = valid;
+        cmd->num_resources = num_items;
+        if (items_size > 0) {
+            memcpy(cmd + 1, items, items_size);
+        }
+    }
+}
+
+_SOKOL_PRIVATE void _sg_record_rect(_sg_command_list_t* cl, _sg_cmd_type_t type, int x, int y, int width, int height, bool origin_top_left) {
+    if (!_sg_validate_record_rect(cl)) {
+        return;
+    }
+    _sg_cmd_rect_t* cmd = (_sg_cmd_rect_t*) _sg_cmdlist_push(cl, type, sizeof(_sg_cmd_rect_t));
+    if (cmd) {
+        cmd->x = x;
+        cmd->y = y;
+        cmd->width = width;
+        cmd->height = height;
+        cmd->origin_top_left = origin_top_left;
+    }
+}
+
+_SOKOL_PRIVATE void _sg_record_apply_pipeline(_sg_command_list_t* cl, sg_pipeline pip_id) {
+    _sg_pipeline_t* pip = _sg_lookup_pipeline(pip_id.id);
+    if (!_sg_validate_record_apply_pipeline(cl, pip_id)) {
+        pip = 0;
+    }
+    // NOTE: a failed pipeline is recorded as null reference, which skips the following draws
+    _sg_cmd_pipeline_t* cmd = (_sg_cmd_pipeline_t*) _sg_cmdlist_push(cl, _SG_CMD_APPLY_PIPELINE, sizeof(_sg_cmd_pipeline_t));
+    if (cmd) {
+        cmd->pip = _sg_pipeline_ref(pip);
+    }
+    cl->rec.pip = _sg_pipeline_ref(pip);
+    cl->rec.required_bindings_and_uniforms = 0;
+    cl->rec.applied_bindings_and_uniforms = 0;
+    if (pip && (pip->slot.state == SG_RESOURCESTATE_VALID) && _sg_shader_ref_alive(&pip->cmn.shader)) {
+        if (!cl->has_pipeline) {
+            cl->has_pipeline = true;
+            cl->is_compute = pip->cmn.is_compute;
+        }
+        const _sg_shader_t* shd = _sg_shader_ref_ptr(&pip->cmn.shader);
+        cl->rec.required_bindings_and_uniforms = pip->cmn.required_bindings_and_uniforms | shd->cmn.required_bindings_and_uniforms;
+    }
+}
+
+_SOKOL_PRIVATE void _sg_record_apply_bindings(_sg_command_list_t* cl, const sg_bindings* bindings) {
+    cl->rec.applied_bindings_and_uniforms |= (1 << SG_MAX_UNIFORMBLOCK_BINDSLOTS);
+    bool valid = _sg_validate_record_apply_bindings(cl, bindings);
+    valid &= _sg_pipeline_ref_alive(&cl->rec.pip) && _sg_shader_ref_alive(&cl->rec.pip.ptr->cmn.shader);
+    _sg_cmd_resource_t items[_SG_CMD_MAX_RESOURCES];
+    int num_items = 0;
+    if (valid) {
+        const _sg_pipeline_t* pip = _sg_pipeline_ref_ptr(&cl->rec.pip);
+        const _sg_shader_t* shd = _sg_shader_ref_ptr(&pip->cmn.shader);
+        if (!pip->cmn.is_compute) {
+            for (size_t i = 0; i < SG_MAX_VERTEXBUFFER_BINDSLOTS; i++) {
+                if (pip->cmn.vertex_buffer_layout_active[i]) {
+                    _sg_buffer_t* buf = _sg_lookup_buffer(bindings->vertex_buffers[i].id);
+                    valid &= 0 != buf;
+                    _sg_cmdlist_add_resource(items, &num_items, _SG_CMDRES_VERTEXBUFFER, i, bindings->vertex_buffer_offsets[i])->ref.buf = _sg_buffer_ref(buf);
+                }
+            }
+            if (bindings->index_buffer.id != SG_INVALID_ID) {
+                _sg_buffer_t* buf = _sg_lookup_buffer(bindings->index_buffer.id);
+                valid &= 0 != buf;
+                _sg_cmdlist_add_resource(items, &num_items, _SG_CMDRES_INDEXBUFFER, 0, bindings->index_buffer_offset)->ref.buf = _sg_buffer_ref(buf);
+            }
+        }
+        for (size_t i = 0; i < SG_MAX_IMAGE_BINDSLOTS; i++) {
+            if (shd->cmn.images[i].stage != SG_SHADERSTAGE_NONE) {
+                _sg_image_t* img = _sg_lookup_image(bindings->images[i].id);
+                valid &= 0 != img;
+                _sg_cmdlist_add_resource(items, &num_items, _SG_CMDRES_IMAGE, i, 0)->ref.img = _sg_image_ref(img);
+            }
+        }
+        for (size_t i = 0; i < SG_MAX_SAMPLER_BINDSLOTS; i++) {
+            if (shd->cmn.samplers[i].stage != SG_SHADERSTAGE_NONE) {
+                _sg_sampler_t* smp = _sg_lookup_sampler(bindings->samplers[i].id);
+                valid &= 0 != smp;
+                _sg_cmdlist_add_resource(items, &num_items, _SG_CMDRES_SAMPLER, i, 0)->ref.smp = _sg_sampler_ref(smp);
+            }
+        }
+        for (size_t i = 0; i < SG_MAX_STORAGEBUFFER_BINDSLOTS; i++) {
+            if (shd->cmn.storage_buffers[i].stage != SG_SHADERSTAGE_NONE) {
+                _sg_buffer_t* sbuf = _sg_lookup_buffer(bindings->storage_buffers[i].id);
+                valid &= 0 != sbuf;
+                _sg_cmdlist_add_resource(items, &num_items, _SG_CMDRES_STORAGEBUFFER, i, 0)->ref.buf = _sg_buffer_ref(sbuf);
+            }
+        }
+    }
+    _sg_cmdlist_push_bindings(cl, valid, items, num_items);
+}
+
+_SOKOL_PRIVATE void _sg_record_apply_bindgroup(_sg_command_list_t* cl, sg_bindgroup bg_id) {
+    cl->rec.applied_bindings_and_uniforms |= (1 << SG_MAX_UNIFORMBLOCK_BINDSLOTS);
+    bool valid = _sg_validate_record_apply_bindgroup(cl, bg_id);
+    const _sg_bindgroup_t* bg = _sg_lookup_bindgroup(bg_id.id);
+    valid &= (0 != bg) && (bg->slot.state == SG_RESOURCESTATE_VALID) && _sg_pipeline_ref_alive(&cl->rec.pip);
+    if (valid) {
+        const _sg_pipeline_t* pip = _sg_pipeline_ref_ptr(&cl->rec.pip);
+        valid &= _sg_pipeline_ref_eql(&bg->pip, pip) || _sg_bindgroup_compatible(bg, pip);
+    }
+    // the bindgroup is flattened into the command stream
+    _sg_cmd_resource_t items[_SG_CMD_MAX_RESOURCES];
+    int num_items = 0;
+    if (valid) {
+        if (!bg->is_compute) {
+            for (size_t i = 0; i < bg->num_vbs; i++) {
+                const size_t slot = bg->vb_slots[i];
+                _sg_cmdlist_add_resource(items, &num_items, _SG_CMDRES_VERTEXBUFFER, slot, bg->vb_offsets[slot])->ref.buf = bg->vbs[slot];
+            }
+            if (!_sg_buffer_ref_null(&bg->ib)) {
+                _sg_cmdlist_add_resource(items, &num_items, _SG_CMDRES_INDEXBUFFER, 0, bg->ib_offset)->ref.buf = bg->ib;
+            }
+        }
+        for (size_t i = 0; i < bg->num_imgs; i++) {
+            const size_t slot = bg->img_slots[i];
+            _sg_cmdlist_add_resource(items, &num_items, _SG_CMDRES_IMAGE, slot, 0)->ref.img = bg->imgs[slot];
+        }
+        for (size_t i = 0; i < bg->num_smps; i++) {
+            const size_t slot = bg->smp_slots[i];
+            _sg_cmdlist_add_resource(items, &num_items, _SG_CMDRES_SAMPLER, slot, 0)->ref.smp = bg->smps[slot];
+        }
+        for (size_t i = 0; i < bg->num_sbufs; i++) {
+            const size_t slot = bg->sbuf_slots[i];
+            _sg_cmdlist_add_resource(items, &num_items, _SG_CMDRES_STORAGEBUFFER, slot, 0)->ref.buf = bg->sbufs[slot];
+        }
+    }
+    _sg_cmdlist_push_bindings(cl, valid, items, num_items);
+}
+
+_SOKOL_PRIVATE void _sg_record_apply_uniforms(_sg_command_list_t* cl, int ub_slot, const sg_range* data) {
+    cl->rec.applied_bindings_and_uniforms |= 1 << ub_slot;
+    if (!_sg_validate_record_apply_uniforms(cl, ub_slot, data)) {
+        _sg_cmdlist_push_invalidate(cl);
+        return;
+    }
+    _sg_cmd_uniforms_t* cmd = (_sg_cmd_uniforms_t*) _sg_cmdlist_push(cl, _SG_CMD_APPLY_UNIFORMS, sizeof(_sg_cmd_uniforms_t) + data->size);
+    if (cmd) {
+        cmd->ub_slot = ub_slot;
+        cmd->num_bytes = (uint32_t)data->size;
+        memcpy(cmd + 1, data->ptr, data->size);
+    }
+}
+
+_SOKOL_PRIVATE void _sg_record_draw_or_dispatch(_sg_command_list_t* cl, _sg_cmd_type_t type, int arg0, int arg1, int arg2) {
+    _sg_cmd_draw_t* cmd = (_sg_cmd_draw_t*) _sg_cmdlist_push(cl, type, sizeof(_sg_cmd_draw_t));
+    if (cmd) {
+        cmd->args[0] = arg0;
+        cmd->args[1] = arg1;
+        cmd->args[2] = arg2;
+    }
+}
+
+_SOKOL_PRIVATE void _sg_record_draw_indirect(_sg_command_list_t* cl, _sg_buffer_t* buf, int offset) {
+    _sg_cmd_draw_indirect_t* cmd = (_sg_cmd_draw_indirect_t*) _sg_cmdlist_push(cl, _SG_CMD_DRAW_INDIRECT, sizeof(_sg_cmd_draw_indirect_t));
+    if (cmd) {
+        cmd->buf = _sg_buffer_ref(buf);
+        cmd->offset = offset;
+    }
+}
+
+// remember the frame in which buffers and images have been bound, partial updates
+// must happen before a resource is used in a frame (see _sg_validate_update_buffer_range())
+_SOKOL_PRIVATE void _sg_track_bound_resources(const _sg_bindings_ptrs_t* bnd) {
+    #if defined(SOKOL_DEBUG)
+    SOKOL_ASSERT(bnd);
+    for (size_t i = 0; i < SG_MAX_VERTEXBUFFER_BINDSLOTS; i++) {
+        if (bnd->vbs[i]) {
+            bnd->vbs[i]->cmn.bind_frame_index = _sg.frame_index;
+        }
+    }
+    if (bnd->ib) {
+        bnd->ib->cmn.bind_frame_index = _sg.frame_index;
+    }
+    for (size_t i = 0; i < SG_MAX_IMAGE_BINDSLOTS; i++) {
+        if (bnd->imgs[i]) {
+            bnd->imgs[i]->cmn.bind_frame_index = _sg.frame_index;
+        }
+    }
+    for (size_t i = 0; i < SG_MAX_STORAGEBUFFER_BINDSLOTS; i++) {
+        if (bnd->sbufs[i]) {
+            bnd->sbufs[i]->cmn.bind_frame_index = _sg.frame_index;
+        }
+    }
+    #else
+    _SOKOL_UNUSED(bnd);
+    #endif
+}
+
+// replay recorded bindings, resources have been resolved at record time,
+// only check that they are still alive and in valid state
+_SOKOL_PRIVATE void _sg_exec_recorded_bindings(const _sg_cmd_bindings_t* cmd) {
+    if (!cmd->valid || !_sg_pipeline_ref_alive(&_sg.cur_pip)) {
+        _sg.next_draw_valid = false;
+        return;
+    }
+    if (!_sg.next_draw_valid) {
+        return;
+    }
+    _sg_bindings_ptrs_t bnd;
+    _sg_clear(&bnd, sizeof(bnd));
+    bnd.pip = _sg_pipeline_ref_ptr(&_sg.cur_pip);
+    const _sg_shader_t* shd = _sg_shader_ref_ptr(&bnd.pip->cmn.shader);
+    const _sg_cmd_resource_t* items = (const _sg_cmd_resource_t*) (cmd + 1);
+    bool valid = true;
+    for (int i = 0; i < cmd->num_resources; i++) {
+        const _sg_cmd_resource_t* item = &items[i];
+        switch (item->type) {
+            case _SG_CMDRES_VERTEXBUFFER:
+            case _SG_CMDRES_INDEXBUFFER:
+                if (_sg_buffer_ref_alive(&item->ref.buf)) {
+                    _sg_buffer_t* buf = item->ref.buf.ptr;
+                    if (item->type == _SG_CMDRES_VERTEXBUFFER) {
+                        bnd.vbs[item->slot] = buf;
+                        bnd.vb_offsets[item->slot] = item->offset;
+                    } else {
+                        bnd.ib = buf;
+                        bnd.ib_offset = item->offset;
+                    }
+                    valid &= (SG_RESOURCESTATE_VALID == buf->slot.state) && !buf->cmn.append_overflow;
+                } else {
+                    valid = false;
+                }
+                break;
+            case _SG_CMDRES_IMAGE:
+                if (_sg_image_ref_alive(&item->ref.img)) {
+                    bnd.imgs[item->slot] = item->ref.img.ptr;
+                    valid &= SG_RESOURCESTATE_VALID == bnd.imgs[item->slot]->slot.state;
+                } else {
+                    valid = false;
+                }
+                break;
+            case _SG_CMDRES_SAMPLER:
+                if (_sg_sampler_ref_alive(&item->ref.smp)) {
+                    bnd.smps[item->slot] = item->ref.smp.ptr;
+                    valid &= SG_RESOURCESTATE_VALID == bnd.smps[item->slot]->slot.state;
+                } else {
+                    valid = false;
+                }
+                break;
+            case _SG_CMDRES_STORAGEBUFFER:
+                if (_sg_buffer_ref_alive(&item->ref.buf)) {
+                    bnd.sbufs[item->slot] = item->ref.buf.ptr;
+                    valid &= SG_RESOURCESTATE_VALID == bnd.sbufs[item->slot]->slot.state;
+                    if (_sg.cur_pass.is_compute) {
+                        _sg_compute_pass_track_storage_buffer(bnd.sbufs[item->slot], shd->cmn.storage_buffers[item->slot].readonly);
+                    }
+                } else {
+                    valid = false;
+                }
+                break;
+            default:
+                SOKOL_UNREACHABLE;
+                break;
+        }
+    }
+    _sg.next_draw_valid = valid;
+    if (_sg.next_draw_valid) {
+        _sg_track_bound_resources(&bnd);
+        _sg.next_draw_valid &= _sg_apply_bindings(&bnd);
+    }
+}
+
+_SOKOL_PRIVATE void _sg_exec_command_list(const _sg_command_list_t* cl) {
+    SOKOL_ASSERT(cl && !cl->recording && !cl->overflow);
+    size_t pos = 0;
+    while (pos < cl->pos) {
+        const _sg_cmd_t* cmd = (const _sg_cmd_t*) (cl->buf + pos);
+        SOKOL_ASSERT((cmd->size > 0) && ((pos + cmd->size) <= cl->pos));
+        pos += cmd->size;
+        switch ((_sg_cmd_type_t)cmd->type) {
+            case _SG_CMD_APPLY_VIEWPORT:
+                {
+                    const _sg_cmd_rect_t* cmd_rect = (const _sg_cmd_rect_t*) cmd;
+                    _sg_stats_add(num_apply_viewport, 1);
+                    if (!_sg.cur_pass.is_compute) {
+                        _sg_apply_viewport(cmd_rect->x, cmd_rect->y, cmd_rect->width, cmd_rect->height, cmd_rect->origin_top_left);
+                    }
+                }
+                break;
+            case _SG_CMD_APPLY_SCISSOR_RECT:
+                {
+                    const _sg_cmd_rect_t* cmd_rect = (const _sg_cmd_rect_t*) cmd;
+                    _sg_stats_add(num_apply_scissor_rect, 1);
+                    if (!_sg.cur_pass.is_compute) {
+                        _sg_apply_scissor_rect(cmd_rect->x, cmd_rect->y, cmd_rect->width, cmd_rect->height, cmd_rect->origin_top_left);
+                    }
+                }
+                break;
+            case _SG_CMD_APPLY_PIPELINE:
+                {
+                    const _sg_cmd_pipeline_t* cmd_pip = (const _sg_cmd_pipeline_t*) cmd;
+                    _sg_stats_add(num_apply_pipeline, 1);
+                    if (_sg_pipeline_ref_alive(&cmd_pip->pip) && (cmd_pip->pip.ptr->cmn.is_compute == _sg.cur_pass.is_compute)) {
+                        _sg_exec_apply_pipeline(cmd_pip->pip.ptr);
+                    } else {
+                        _sg.cur_pip = _sg_pipeline_ref(0);
+                        _sg.next_draw_valid = false;
+                    }
+                }
+                break;
+            case _SG_CMD_APPLY_BINDINGS:
+                _sg_stats_add(num_apply_bindings, 1);
+                _sg.applied_bindings_and_uniforms |= (1 << SG_MAX_UNIFORMBLOCK_BINDSLOTS);
+                _sg_exec_recorded_bindings((const _sg_cmd_bindings_t*)cmd);
+                break;
+            case _SG_CMD_APPLY_UNIFORMS:
+                {
+                    const _sg_cmd_uniforms_t* cmd_ub = (const _sg_cmd_uniforms_t*) cmd;
+                    _sg_stats_add(num_apply_uniforms, 1);
+                    _sg_stats_add(size_apply_uniforms, cmd_ub->num_bytes);
+                    _sg.applied_bindings_and_uniforms |= 1 << cmd_ub->ub_slot;
+                    if (_sg.next_draw_valid) {
+                        const sg_range data = { cmd_ub + 1, cmd_ub->num_bytes };
+                        _sg_exec_apply_uniforms(cmd_ub->ub_slot, &data);
+                    }
+                }
+                break;
+            case _SG_CMD_DRAW:
+                {
+                    const _sg_cmd_draw_t* cmd_draw = (const _sg_cmd_draw_t*) cmd;
+                    _sg_stats_add(num_draw, 1);
+                    // skip no-op draws
+                    if (_sg.next_draw_valid && (0 != cmd_draw->args[1]) && (0 != cmd_draw->args[2])) {
+                        _sg_draw(cmd_draw->args[0], cmd_draw->args[1], cmd_draw->args[2]);
+                    }
+                }
+                break;
+            case _SG_CMD_DRAW_INDIRECT:
+                {
+                    const _sg_cmd_draw_indirect_t* cmd_draw = (const _sg_cmd_draw_indirect_t*) cmd;
+                    _sg_stats_add(num_draw, 1);
+                    // skip draws with buffers which are not (or no longer) valid
+                    if (_sg.next_draw_valid && _sg_buffer_ref_alive(&cmd_draw->buf) && (SG_RESOURCESTATE_VALID == cmd_draw->buf.ptr->slot.state)) {
+                        _sg_draw_indirect(cmd_draw->buf.ptr, cmd_draw->offset);
+                    }
+                }
+                break;
+            case _SG_CMD_DISPATCH:
+                {
+                    const _sg_cmd_draw_t* cmd_disp = (const _sg_cmd_draw_t*) cmd;
+                    _sg_stats_add(num_dispatch, 1);
+                    // skip no-op dispatches
+                    if (_sg.next_draw_valid && (0 != cmd_disp->args[0]) && (0 != cmd_disp->args[1]) && (0 != cmd_disp->args[2])) {
+                        _sg_dispatch(cmd_disp->args[0], cmd_disp->args[1], cmd_disp->args[2]);
+                    }
+                }
+                break;
+            case _SG_CMD_INVALIDATE:
+                _sg.next_draw_valid = false;
+                break;
+            default:
+                SOKOL_UNREACHABLE;
+                return;
+        }
+    }
 }
 
 _SOKOL_PRIVATE sg_desc _sg_desc_defaults(const sg_desc* desc) {
@@ -20242,6 +26131,12 @@ _SOKOL_PRIVATE sg_desc _sg_desc_defaults(const sg_desc* desc) {
     res.shader_pool_size = _sg_def(res.shader_pool_size, _SG_DEFAULT_SHADER_POOL_SIZE);
     res.pipeline_pool_size = _sg_def(res.pipeline_pool_size, _SG_DEFAULT_PIPELINE_POOL_SIZE);
     res.attachments_pool_size = _sg_def(res.attachments_pool_size, _SG_DEFAULT_ATTACHMENTS_POOL_SIZE);
+    res.bindgroup_pool_size = _sg_def(res.bindgroup_pool_size, _SG_DEFAULT_BINDGROUP_POOL_SIZE);
+    res.command_list_pool_size = _sg_def(res.command_list_pool_size, _SG_DEFAULT_COMMAND_LIST_POOL_SIZE);
+    res.readback_pool_size = _sg_def(res.readback_pool_size, _SG_DEFAULT_READBACK_POOL_SIZE);
+    res.update_mode = _sg_def(res.update_mode, SG_UPDATEMODE_MULTIBUFFER);
+    res.num_update_slots = _sg_def(res.num_update_slots, SG_NUM_INFLIGHT_FRAMES);
+    SOKOL_ASSERT((res.num_update_slots >= 1) && (res.num_update_slots <= SG_MAX_UPDATE_SLOTS));
     res.uniform_buffer_size = _sg_def(res.uniform_buffer_size, _SG_DEFAULT_UB_SIZE);
     res.max_dispatch_calls_per_pass = _sg_def(res.max_dispatch_calls_per_pass, _SG_DEFAULT_MAX_DISPATCH_CALLS_PER_PASS);
     res.max_commit_listeners = _sg_def(res.max_commit_listeners, _SG_DEFAULT_MAX_COMMIT_LISTENERS);
@@ -20272,39 +26167,44 @@ _SOKOL_PRIVATE void _sg_discard_all_resources(void) {
               and the resource slots not be cleared!
     */
     for (int i = 1; i < _sg.pools.buffer_pool.size; i++) {
-        sg_resource_state state = _sg.pools.buffers[i].slot.state;
+        sg_resource_state state = _sg.pools.buffers[i]->slot.state;
         if ((state == SG_RESOURCESTATE_VALID) || (state == SG_RESOURCESTATE_FAILED)) {
-            _sg_discard_buffer(&_sg.pools.buffers[i]);
+            _sg_discard_buffer(_sg.pools.buffers[i]);
         }
     }
     for (int i = 1; i < _sg.pools.image_pool.size; i++) {
-        sg_resource_state state = _sg.pools.images[i].slot.state;
+        sg_resource_state state = _sg.pools.images[i]->slot.state;
         if ((state == SG_RESOURCESTATE_VALID) || (state == SG_RESOURCESTATE_FAILED)) {
-            _sg_discard_image(&_sg.pools.images[i]);
+            _sg_discard_image(_sg.pools.images[i]);
         }
     }
     for (int i = 1; i < _sg.pools.sampler_pool.size; i++) {
-        sg_resource_state state = _sg.pools.samplers[i].slot.state;
+        sg_resource_state state = _sg.pools.samplers[i]->slot.state;
         if ((state == SG_RESOURCESTATE_VALID) || (state == SG_RESOURCESTATE_FAILED)) {
-            _sg_discard_sampler(&_sg.pools.samplers[i]);
+            _sg_discard_sampler(_sg.pools.samplers[i]);
         }
     }
     for (int i = 1; i < _sg.pools.shader_pool.size; i++) {
-        sg_resource_state state = _sg.pools.shaders[i].slot.state;
+        sg_resource_state state = _sg.pools.shaders[i]->slot.state;
         if ((state == SG_RESOURCESTATE_VALID) || (state == SG_RESOURCESTATE_FAILED)) {
-            _sg_discard_shader(&_sg.pools.shaders[i]);
+            _sg_discard_shader(_sg.pools.shaders[i]);
         }
     }
     for (int i = 1; i < _sg.pools.pipeline_pool.size; i++) {
-        sg_resource_state state = _sg.pools.pipelines[i].slot.state;
+        sg_resource_state state = _sg.pools.pipelines[i]->slot.state;
         if ((state == SG_RESOURCESTATE_VALID) || (state == SG_RESOURCESTATE_FAILED)) {
-            _sg_discard_pipeline(&_sg.pools.pipelines[i]);
+            _sg_discard_pipeline(_sg.pools.pipelines[i]);
         }
     }
     for (int i = 1; i < _sg.pools.attachments_pool.size; i++) {
-        sg_resource_state state = _sg.pools.attachments[i].slot.state;
+        sg_resource_state state = _sg.pools.attachments[i]->slot.state;
         if ((state == SG_RESOURCESTATE_VALID) || (state == SG_RESOURCESTATE_FAILED)) {
-            _sg_discard_attachments(&_sg.pools.attachments[i]);
+            _sg_discard_attachments(_sg.pools.attachments[i]);
+        }
+    }
+    for (int i = 1; i < _sg.pools.command_list_pool.size; i++) {
+        if (_sg.pools.command_lists[i]->buf) {
+            _sg_free(_sg.pools.command_lists[i]->buf);
         }
     }
 }
@@ -20331,18 +26231,30 @@ SOKOL_API_IMPL void sg_setup(const sg_desc* desc) {
     _sg.desc = _sg_desc_defaults(desc);
     _sg_setup_pools(&_sg.pools, &_sg.desc);
     _sg_setup_compute(&_sg.desc);
+    _sg_setup_mipmaps(&_sg.desc);
+    _sg.memory.stats.budget = _sg.desc.memory_budget.num_bytes;
     _sg_setup_commit_listeners(&_sg.desc);
     _sg.frame_index = 1;
     _sg.stats_enabled = true;
     _sg_setup_backend(&_sg.desc);
+    if (_sg.desc.gpu_timings && !_sg.features.gpu_timings) {
+        _SG_WARN(GPU_TIMINGS_NOT_SUPPORTED);
+    }
     _sg.valid = true;
 }
 
 SOKOL_API_IMPL void sg_shutdown(void) {
+    _sg_update_readbacks(true);
+    _sg_release_destroyed_resources(true);
+    _sg_discard_destroy_queues();
     _sg_discard_all_resources();
     _sg_discard_backend();
     _sg_discard_commit_listeners();
+    _sg_dedup_discard(&_sg.dedup.samplers);
+    _sg_dedup_discard(&_sg.dedup.pipelines);
     _sg_discard_compute();
+    _sg_discard_uniform_cache();
+    _sg_discard_mipmaps();
     _sg_discard_pools(&_sg.pools);
     _SG_CLEAR_ARC_STRUCT(_sg_state_t, _sg);
 }
@@ -20414,6 +26326,11 @@ SOKOL_API_IMPL sg_frame_stats sg_query_frame_stats(void) {
     return _sg.prev_stats;
 }
 
+SOKOL_API_IMPL sg_gpu_timings sg_query_gpu_timings(void) {
+    SOKOL_ASSERT(_sg.valid);
+    return _sg.gpu_timings;
+}
+
 SOKOL_API_IMPL sg_trace_hooks sg_install_trace_hooks(const sg_trace_hooks* trace_hooks) {
     SOKOL_ASSERT(_sg.valid);
     SOKOL_ASSERT(trace_hooks);
@@ -20561,6 +26478,7 @@ SOKOL_API_IMPL void sg_init_buffer(sg_buffer buf_id, const sg_buffer_desc* desc)
         }
     }
     _SG_TRACE_ARGS(init_buffer, buf_id, &desc_def);
+    _sg_memory_check_budget();
 }
 
 SOKOL_API_IMPL void sg_init_image(sg_image img_id, const sg_image_desc* desc) {
@@ -20576,6 +26494,7 @@ SOKOL_API_IMPL void sg_init_image(sg_image img_id, const sg_image_desc* desc) {
         }
     }
     _SG_TRACE_ARGS(init_image, img_id, &desc_def);
+    _sg_memory_check_budget();
 }
 
 SOKOL_API_IMPL void sg_init_sampler(sg_sampler smp_id, const sg_sampler_desc* desc) {
@@ -20842,6 +26761,26 @@ SOKOL_API_IMPL sg_resource_state sg_query_attachments_state(sg_attachments atts_
     return res;
 }
 
+SOKOL_API_IMPL sg_resource_state sg_query_bindgroup_state(sg_bindgroup bg_id) {
+    SOKOL_ASSERT(_sg.valid);
+    _sg_bindgroup_t* bg = _sg_lookup_bindgroup(bg_id.id);
+    sg_resource_state res = bg ? bg->slot.state : SG_RESOURCESTATE_INVALID;
+    return res;
+}
+
+SOKOL_API_IMPL sg_resource_state sg_query_command_list_state(sg_command_list cl_id) {
+    SOKOL_ASSERT(_sg.valid);
+    _sg_command_list_t* cl = _sg_lookup_command_list(cl_id.id);
+    sg_resource_state res = cl ? cl->slot.state : SG_RESOURCESTATE_INVALID;
+    return res;
+}
+
+SOKOL_API_IMPL bool sg_query_readback_pending(sg_readback rb_id) {
+    SOKOL_ASSERT(_sg.valid);
+    // readback objects are destroyed when completed
+    return 0 != _sg_lookup_readback(rb_id.id);
+}
+
 SOKOL_API_IMPL sg_buffer sg_make_buffer(const sg_buffer_desc* desc) {
     SOKOL_ASSERT(_sg.valid);
     SOKOL_ASSERT(desc);
@@ -20854,6 +26793,7 @@ SOKOL_API_IMPL sg_buffer sg_make_buffer(const sg_buffer_desc* desc) {
         SOKOL_ASSERT((buf->slot.state == SG_RESOURCESTATE_VALID) || (buf->slot.state == SG_RESOURCESTATE_FAILED));
     }
     _SG_TRACE_ARGS(make_buffer, &desc_def, buf_id);
+    _sg_memory_check_budget();
     return buf_id;
 }
 
@@ -20869,6 +26809,7 @@ SOKOL_API_IMPL sg_image sg_make_image(const sg_image_desc* desc) {
         SOKOL_ASSERT((img->slot.state == SG_RESOURCESTATE_VALID) || (img->slot.state == SG_RESOURCESTATE_FAILED));
     }
     _SG_TRACE_ARGS(make_image, &desc_def, img_id);
+    _sg_memory_check_budget();
     return img_id;
 }
 
@@ -20876,12 +26817,24 @@ SOKOL_API_IMPL sg_sampler sg_make_sampler(const sg_sampler_desc* desc) {
     SOKOL_ASSERT(_sg.valid);
     SOKOL_ASSERT(desc);
     sg_sampler_desc desc_def = _sg_sampler_desc_defaults(desc);
-    sg_sampler smp_id = _sg_alloc_sampler();
-    if (smp_id.id != SG_INVALID_ID) {
-        _sg_sampler_t* smp = _sg_sampler_at(smp_id.id);
-        SOKOL_ASSERT(smp && (smp->slot.state == SG_RESOURCESTATE_ALLOC));
-        _sg_init_sampler(smp, &desc_def);
-        SOKOL_ASSERT((smp->slot.state == SG_RESOURCESTATE_VALID) || (smp->slot.state == SG_RESOURCESTATE_FAILED));
+    sg_sampler smp_id = { SG_INVALID_ID };
+    sg_sampler_desc dedup_key;
+    uint64_t dedup_hash = 0;
+    const bool dedup = _sg.desc.dedup_samplers && _sg_sampler_dedup_key(&dedup_key, &desc_def, &dedup_hash);
+    if (dedup) {
+        smp_id.id = _sg_dedup_lookup(&_sg.dedup.samplers, dedup_hash, &dedup_key, sizeof(dedup_key));
+    }
+    if (smp_id.id == SG_INVALID_ID) {
+        smp_id = _sg_alloc_sampler();
+        if (smp_id.id != SG_INVALID_ID) {
+            _sg_sampler_t* smp = _sg_sampler_at(smp_id.id);
+            SOKOL_ASSERT(smp && (smp->slot.state == SG_RESOURCESTATE_ALLOC));
+            _sg_init_sampler(smp, &desc_def);
+            SOKOL_ASSERT((smp->slot.state == SG_RESOURCESTATE_VALID) || (smp->slot.state == SG_RESOURCESTATE_FAILED));
+            if (dedup && (smp->slot.state == SG_RESOURCESTATE_VALID)) {
+                _sg_dedup_add(&_sg.dedup.samplers, dedup_hash, &dedup_key, sizeof(dedup_key), smp_id.id);
+            }
+        }
     }
     _SG_TRACE_ARGS(make_sampler, &desc_def, smp_id);
     return smp_id;
@@ -20906,12 +26859,25 @@ SOKOL_API_IMPL sg_pipeline sg_make_pipeline(const sg_pipeline_desc* desc) {
     SOKOL_ASSERT(_sg.valid);
     SOKOL_ASSERT(desc);
     sg_pipeline_desc desc_def = _sg_pipeline_desc_defaults(desc);
-    sg_pipeline pip_id = _sg_alloc_pipeline();
-    if (pip_id.id != SG_INVALID_ID) {
-        _sg_pipeline_t* pip = _sg_pipeline_at(pip_id.id);
-        SOKOL_ASSERT(pip && (pip->slot.state == SG_RESOURCESTATE_ALLOC));
-        _sg_init_pipeline(pip, &desc_def);
-        SOKOL_ASSERT((pip->slot.state == SG_RESOURCESTATE_VALID) || (pip->slot.state == SG_RESOURCESTATE_FAILED));
+    sg_pipeline pip_id = { SG_INVALID_ID };
+    _sg_pipeline_dedup_key_t dedup_key;
+    uint64_t dedup_hash = 0;
+    const bool dedup = _sg.desc.dedup_pipelines;
+    if (dedup) {
+        dedup_hash = _sg_pipeline_dedup_key(&dedup_key, &desc_def);
+        pip_id.id = _sg_dedup_lookup(&_sg.dedup.pipelines, dedup_hash, &dedup_key, sizeof(dedup_key));
+    }
+    if (pip_id.id == SG_INVALID_ID) {
+        pip_id = _sg_alloc_pipeline();
+        if (pip_id.id != SG_INVALID_ID) {
+            _sg_pipeline_t* pip = _sg_pipeline_at(pip_id.id);
+            SOKOL_ASSERT(pip && (pip->slot.state == SG_RESOURCESTATE_ALLOC));
+            _sg_init_pipeline(pip, &desc_def);
+            SOKOL_ASSERT((pip->slot.state == SG_RESOURCESTATE_VALID) || (pip->slot.state == SG_RESOURCESTATE_FAILED));
+            if (dedup && (pip->slot.state == SG_RESOURCESTATE_VALID)) {
+                _sg_dedup_add(&_sg.dedup.pipelines, dedup_hash, &dedup_key, sizeof(dedup_key), pip_id.id);
+            }
+        }
     }
     _SG_TRACE_ARGS(make_pipeline, &desc_def, pip_id);
     return pip_id;
@@ -20932,6 +26898,36 @@ SOKOL_API_IMPL sg_attachments sg_make_attachments(const sg_attachments_desc* des
     return atts_id;
 }
 
+SOKOL_API_IMPL sg_bindgroup sg_make_bindgroup(const sg_bindgroup_desc* desc) {
+    SOKOL_ASSERT(_sg.valid);
+    SOKOL_ASSERT(desc);
+    SOKOL_ASSERT((desc->bindings._start_canary == 0) && (desc->bindings._end_canary == 0));
+    sg_bindgroup bg_id = _sg_alloc_bindgroup();
+    if (bg_id.id != SG_INVALID_ID) {
+        _sg_bindgroup_t* bg = _sg_bindgroup_at(bg_id.id);
+        SOKOL_ASSERT(bg && (bg->slot.state == SG_RESOURCESTATE_ALLOC));
+        _sg_init_bindgroup(bg, desc);
+        SOKOL_ASSERT((bg->slot.state == SG_RESOURCESTATE_VALID) || (bg->slot.state == SG_RESOURCESTATE_FAILED));
+    }
+    _SG_TRACE_ARGS(make_bindgroup, desc, bg_id);
+    return bg_id;
+}
+
+SOKOL_API_IMPL sg_command_list sg_make_command_list(const sg_command_list_desc* desc) {
+    SOKOL_ASSERT(_sg.valid);
+    SOKOL_ASSERT(desc);
+    sg_command_list_desc desc_def = _sg_command_list_desc_defaults(desc);
+    sg_command_list cl_id = _sg_alloc_command_list();
+    if (cl_id.id != SG_INVALID_ID) {
+        _sg_command_list_t* cl = _sg_command_list_at(cl_id.id);
+        SOKOL_ASSERT(cl && (cl->slot.state == SG_RESOURCESTATE_ALLOC));
+        _sg_init_command_list(cl, &desc_def);
+        SOKOL_ASSERT((cl->slot.state == SG_RESOURCESTATE_VALID) || (cl->slot.state == SG_RESOURCESTATE_FAILED));
+    }
+    _SG_TRACE_ARGS(make_command_list, &desc_def, cl_id);
+    return cl_id;
+}
+
 SOKOL_API_IMPL void sg_destroy_buffer(sg_buffer buf_id) {
     SOKOL_ASSERT(_sg.valid);
     _SG_TRACE_ARGS(destroy_buffer, buf_id);
@@ -20968,7 +26964,8 @@ SOKOL_API_IMPL void sg_destroy_sampler(sg_sampler smp_id) {
     SOKOL_ASSERT(_sg.valid);
     _SG_TRACE_ARGS(destroy_sampler, smp_id);
     _sg_sampler_t* smp = _sg_lookup_sampler(smp_id.id);
-    if (smp) {
+    // deduplicated samplers are only destroyed when the last reference is dropped
+    if (smp && (0 == _sg_dedup_release(&_sg.dedup.samplers, smp_id.id))) {
         if ((smp->slot.state == SG_RESOURCESTATE_VALID) || (smp->slot.state == SG_RESOURCESTATE_FAILED)) {
             _sg_uninit_sampler(smp);
             SOKOL_ASSERT(smp->slot.state == SG_RESOURCESTATE_ALLOC);
@@ -21000,7 +26997,8 @@ SOKOL_API_IMPL void sg_destroy_pipeline(sg_pipeline pip_id) {
     SOKOL_ASSERT(_sg.valid);
     _SG_TRACE_ARGS(destroy_pipeline, pip_id);
     _sg_pipeline_t* pip = _sg_lookup_pipeline(pip_id.id);
-    if (pip) {
+    // deduplicated pipelines are only destroyed when the last reference is dropped
+    if (pip && (0 == _sg_dedup_release(&_sg.dedup.pipelines, pip_id.id))) {
         if ((pip->slot.state == SG_RESOURCESTATE_VALID) || (pip->slot.state == SG_RESOURCESTATE_FAILED)) {
             _sg_uninit_pipeline(pip);
             SOKOL_ASSERT(pip->slot.state == SG_RESOURCESTATE_ALLOC);
@@ -21028,8 +27026,41 @@ SOKOL_API_IMPL void sg_destroy_attachments(sg_attachments atts_id) {
     }
 }
 
+SOKOL_API_IMPL void sg_destroy_bindgroup(sg_bindgroup bg_id) {
+    SOKOL_ASSERT(_sg.valid);
+    _SG_TRACE_ARGS(destroy_bindgroup, bg_id);
+    _sg_bindgroup_t* bg = _sg_lookup_bindgroup(bg_id.id);
+    if (bg) {
+        if ((bg->slot.state == SG_RESOURCESTATE_VALID) || (bg->slot.state == SG_RESOURCESTATE_FAILED)) {
+            _sg_uninit_bindgroup(bg);
+            SOKOL_ASSERT(bg->slot.state == SG_RESOURCESTATE_ALLOC);
+        }
+        if (bg->slot.state == SG_RESOURCESTATE_ALLOC) {
+            _sg_dealloc_bindgroup(bg);
+            SOKOL_ASSERT(bg->slot.state == SG_RESOURCESTATE_INITIAL);
+        }
+    }
+}
+
+SOKOL_API_IMPL void sg_destroy_command_list(sg_command_list cl_id) {
+    SOKOL_ASSERT(_sg.valid);
+    _SG_TRACE_ARGS(destroy_command_list, cl_id);
+    _sg_command_list_t* cl = _sg_lookup_command_list(cl_id.id);
+    if (cl) {
+        if ((cl->slot.state == SG_RESOURCESTATE_VALID) || (cl->slot.state == SG_RESOURCESTATE_FAILED)) {
+            _sg_uninit_command_list(cl);
+            SOKOL_ASSERT(cl->slot.state == SG_RESOURCESTATE_ALLOC);
+        }
+        if (cl->slot.state == SG_RESOURCESTATE_ALLOC) {
+            _sg_dealloc_command_list(cl);
+            SOKOL_ASSERT(cl->slot.state == SG_RESOURCESTATE_INITIAL);
+        }
+    }
+}
+
 SOKOL_API_IMPL void sg_begin_pass(const sg_pass* pass) {
     SOKOL_ASSERT(_sg.valid);
+    SOKOL_ASSERT(0 == _sg_rec_cmdlist);
     SOKOL_ASSERT(!_sg.cur_pass.valid);
     SOKOL_ASSERT(!_sg.cur_pass.in_pass);
     SOKOL_ASSERT(_sg_attachments_ref_null(&_sg.cur_pass.atts));
@@ -21065,12 +27096,18 @@ SOKOL_API_IMPL void sg_begin_pass(const sg_pass* pass) {
     _sg.cur_pass.valid = true;  // may be overruled by backend begin-pass functions
     _sg.cur_pass.in_pass = true;
     _sg.cur_pass.is_compute = pass_def.compute;
+    _sg_reset_uniform_cache();
+    _sg_begin_gpu_timing(pass_def.label ? pass_def.label : (pass_def.compute ? "compute pass" : "pass"));
     _sg_begin_pass(&pass_def);
     _SG_TRACE_ARGS(begin_pass, &pass_def);
 }
 
 SOKOL_API_IMPL void sg_apply_viewport(int x, int y, int width, int height, bool origin_top_left) {
     SOKOL_ASSERT(_sg.valid);
+    if (_sg_rec_cmdlist) {
+        _sg_record_rect(_sg_rec_cmdlist, _SG_CMD_APPLY_VIEWPORT, x, y, width, height, origin_top_left);
+        return;
+    }
     #if defined(SOKOL_DEBUG)
     if (!_sg_validate_apply_viewport(x, y, width, height, origin_top_left)) {
         return;
@@ -21090,6 +27127,10 @@ SOKOL_API_IMPL void sg_apply_viewportf(float x, float y, float width, float heig
 
 SOKOL_API_IMPL void sg_apply_scissor_rect(int x, int y, int width, int height, bool origin_top_left) {
     SOKOL_ASSERT(_sg.valid);
+    if (_sg_rec_cmdlist) {
+        _sg_record_rect(_sg_rec_cmdlist, _SG_CMD_APPLY_SCISSOR_RECT, x, y, width, height, origin_top_left);
+        return;
+    }
     #if defined(SOKOL_DEBUG)
     if (!_sg_validate_apply_scissor_rect(x, y, width, height, origin_top_left)) {
         return;
@@ -21109,6 +27150,10 @@ SOKOL_API_IMPL void sg_apply_scissor_rectf(float x, float y, float width, float
 
 SOKOL_API_IMPL void sg_apply_pipeline(sg_pipeline pip_id) {
     SOKOL_ASSERT(_sg.valid);
+    if (_sg_rec_cmdlist) {
+        _sg_record_apply_pipeline(_sg_rec_cmdlist, pip_id);
+        return;
+    }
     _sg_stats_add(num_apply_pipeline, 1);
     if (!_sg_validate_apply_pipeline(pip_id)) {
         _sg.next_draw_valid = false;
@@ -21119,20 +27164,10 @@ SOKOL_API_IMPL void sg_apply_pipeline(sg_pipeline pip_id) {
     }
     _sg_pipeline_t* pip = _sg_lookup_pipeline(pip_id.id);
     SOKOL_ASSERT(pip);
-    _sg.cur_pip = _sg_pipeline_ref(pip);
-
-    _sg.next_draw_valid = (SG_RESOURCESTATE_VALID == pip->slot.state);
+    _sg_exec_apply_pipeline(pip);
     if (!_sg.next_draw_valid) {
         return;
     }
-
-    _sg_apply_pipeline(pip);
-
-    // set the expected bindings and uniform block flags
-    const _sg_shader_t* shd = _sg_shader_ref_ptr(&pip->cmn.shader);
-    _sg.required_bindings_and_uniforms = pip->cmn.required_bindings_and_uniforms | shd->cmn.required_bindings_and_uniforms;
-    _sg.applied_bindings_and_uniforms = 0;
-
     _SG_TRACE_ARGS(apply_pipeline, pip_id);
 }
 
@@ -21140,6 +27175,10 @@ SOKOL_API_IMPL void sg_apply_bindings(const sg_bindings* bindings) {
     SOKOL_ASSERT(_sg.valid);
     SOKOL_ASSERT(bindings);
     SOKOL_ASSERT((bindings->_start_canary == 0) && (bindings->_end_canary==0));
+    if (_sg_rec_cmdlist) {
+        _sg_record_apply_bindings(_sg_rec_cmdlist, bindings);
+        return;
+    }
     _sg_stats_add(num_apply_bindings, 1);
     _sg.applied_bindings_and_uniforms |= (1 << SG_MAX_UNIFORMBLOCK_BINDSLOTS);
     if (!_sg_validate_apply_bindings(bindings)) {
@@ -21225,15 +27264,117 @@ SOKOL_API_IMPL void sg_apply_bindings(const sg_bindings* bindings) {
     }
 
     if (_sg.next_draw_valid) {
+        _sg_track_bound_resources(&bnd);
         _sg.next_draw_valid &= _sg_apply_bindings(&bnd);
         _SG_TRACE_ARGS(apply_bindings, bindings);
     }
 }
 
+SOKOL_API_IMPL void sg_apply_bindgroup(sg_bindgroup bg_id) {
+    SOKOL_ASSERT(_sg.valid);
+    if (_sg_rec_cmdlist) {
+        _sg_record_apply_bindgroup(_sg_rec_cmdlist, bg_id);
+        return;
+    }
+    _sg_stats_add(num_apply_bindings, 1);
+    _sg.applied_bindings_and_uniforms |= (1 << SG_MAX_UNIFORMBLOCK_BINDSLOTS);
+    if (!_sg_validate_apply_bindgroup(bg_id)) {
+        _sg.next_draw_valid = false;
+    }
+    if (!_sg_pipeline_ref_alive(&_sg.cur_pip)) {
+        _sg.next_draw_valid = false;
+    }
+    if (!_sg.cur_pass.valid) {
+        return;
+    }
+    if (!_sg.next_draw_valid) {
+        return;
+    }
+    const _sg_bindgroup_t* bg = _sg_lookup_bindgroup(bg_id.id);
+    if ((0 == bg) || (bg->slot.state != SG_RESOURCESTATE_VALID)) {
+        _sg.next_draw_valid = false;
+        return;
+    }
+    _sg_bindings_ptrs_t bnd;
+    _sg_clear(&bnd, sizeof(bnd));
+    bnd.pip = _sg_pipeline_ref_ptr(&_sg.cur_pip);
+    if (!_sg_pipeline_ref_eql(&bg->pip, bnd.pip) && !_sg_bindgroup_compatible(bg, bnd.pip)) {
+        _sg.next_draw_valid = false;
+        return;
+    }
+
+    // the bindslots have been resolved in sg_make_bindgroup(), only check
+    // that the referenced resources are still alive and in valid state
+    bool valid = true;
+    if (!bg->is_compute) {
+        for (size_t i = 0; i < bg->num_vbs; i++) {
+            const size_t slot = bg->vb_slots[i];
+            const _sg_buffer_ref_t* ref = &bg->vbs[slot];
+            if (_sg_buffer_ref_alive(ref)) {
+                bnd.vbs[slot] = ref->ptr;
+                bnd.vb_offsets[slot] = bg->vb_offsets[slot];
+                valid &= (SG_RESOURCESTATE_VALID == ref->ptr->slot.state) && !ref->ptr->cmn.append_overflow;
+            } else {
+                valid = false;
+            }
+        }
+        if (!_sg_buffer_ref_null(&bg->ib)) {
+            if (_sg_buffer_ref_alive(&bg->ib)) {
+                bnd.ib = bg->ib.ptr;
+                bnd.ib_offset = bg->ib_offset;
+                valid &= (SG_RESOURCESTATE_VALID == bnd.ib->slot.state) && !bnd.ib->cmn.append_overflow;
+            } else {
+                valid = false;
+            }
+        }
+    }
+    for (size_t i = 0; i < bg->num_imgs; i++) {
+        const size_t slot = bg->img_slots[i];
+        if (_sg_image_ref_alive(&bg->imgs[slot])) {
+            bnd.imgs[slot] = bg->imgs[slot].ptr;
+            valid &= SG_RESOURCESTATE_VALID == bnd.imgs[slot]->slot.state;
+        } else {
+            valid = false;
+        }
+    }
+    for (size_t i = 0; i < bg->num_smps; i++) {
+        const size_t slot = bg->smp_slots[i];
+        if (_sg_sampler_ref_alive(&bg->smps[slot])) {
+            bnd.smps[slot] = bg->smps[slot].ptr;
+            valid &= SG_RESOURCESTATE_VALID == bnd.smps[slot]->slot.state;
+        } else {
+            valid = false;
+        }
+    }
+    for (size_t i = 0; i < bg->num_sbufs; i++) {
+        const size_t slot = bg->sbuf_slots[i];
+        if (_sg_buffer_ref_alive(&bg->sbufs[slot])) {
+            bnd.sbufs[slot] = bg->sbufs[slot].ptr;
+            valid &= SG_RESOURCESTATE_VALID == bnd.sbufs[slot]->slot.state;
+            if (_sg.cur_pass.is_compute) {
+                _sg_compute_pass_track_storage_buffer(bnd.sbufs[slot], bg->shd.ptr->cmn.storage_buffers[slot].readonly);
+            }
+        } else {
+            valid = false;
+        }
+    }
+
+    _sg.next_draw_valid = valid;
+    if (_sg.next_draw_valid) {
+        _sg_track_bound_resources(&bnd);
+        _sg.next_draw_valid &= _sg_apply_bindings(&bnd);
+        _SG_TRACE_ARGS(apply_bindgroup, bg_id);
+    }
+}
+
 SOKOL_API_IMPL void sg_apply_uniforms(int ub_slot, const sg_range* data) {
     SOKOL_ASSERT(_sg.valid);
     SOKOL_ASSERT((ub_slot >= 0) && (ub_slot < SG_MAX_UNIFORMBLOCK_BINDSLOTS));
     SOKOL_ASSERT(data && data->ptr && (data->size > 0));
+    if (_sg_rec_cmdlist) {
+        _sg_record_apply_uniforms(_sg_rec_cmdlist, ub_slot, data);
+        return;
+    }
     _sg_stats_add(num_apply_uniforms, 1);
     _sg_stats_add(size_apply_uniforms, (uint32_t)data->size);
     _sg.applied_bindings_and_uniforms |= 1 << ub_slot;
@@ -21247,12 +27388,18 @@ SOKOL_API_IMPL void sg_apply_uniforms(int ub_slot, const sg_range* data) {
     if (!_sg.next_draw_valid) {
         return;
     }
-    _sg_apply_uniforms(ub_slot, data);
+    _sg_exec_apply_uniforms(ub_slot, data);
     _SG_TRACE_ARGS(apply_uniforms, ub_slot, data);
 }
 
 SOKOL_API_IMPL void sg_draw(int base_element, int num_elements, int num_instances) {
     SOKOL_ASSERT(_sg.valid);
+    if (_sg_rec_cmdlist) {
+        if (_sg_validate_record_draw(_sg_rec_cmdlist, base_element, num_elements, num_instances)) {
+            _sg_record_draw_or_dispatch(_sg_rec_cmdlist, _SG_CMD_DRAW, base_element, num_elements, num_instances);
+        }
+        return;
+    }
     #if defined(SOKOL_DEBUG)
     if (!_sg_validate_draw(base_element, num_elements, num_instances)) {
         return;
@@ -21273,8 +27420,44 @@ SOKOL_API_IMPL void sg_draw(int base_element, int num_elements, int num_instance
     _SG_TRACE_ARGS(draw, base_element, num_elements, num_instances);
 }
 
+SOKOL_API_IMPL void sg_draw_indirect(sg_buffer buf_id, int offset) {
+    SOKOL_ASSERT(_sg.valid);
+    if (_sg_rec_cmdlist) {
+        _sg_buffer_t* buf = _sg_lookup_buffer(buf_id.id);
+        if (_sg_validate_record_draw_indirect(_sg_rec_cmdlist, buf, offset)) {
+            _sg_record_draw_indirect(_sg_rec_cmdlist, buf, offset);
+        }
+        return;
+    }
+    #if defined(SOKOL_DEBUG)
+    if (!_sg_validate_draw_indirect(buf_id, offset)) {
+        return;
+    }
+    #endif
+    _sg_stats_add(num_draw, 1);
+    if (!_sg.cur_pass.valid) {
+        return;
+    }
+    if (!_sg.next_draw_valid) {
+        return;
+    }
+    // skip draws with buffers which are not (or no longer) valid
+    _sg_buffer_t* buf = _sg_lookup_buffer(buf_id.id);
+    if ((0 == buf) || (SG_RESOURCESTATE_VALID != buf->slot.state)) {
+        return;
+    }
+    _sg_draw_indirect(buf, offset);
+    _SG_TRACE_ARGS(draw_indirect, buf_id, offset);
+}
+
 SOKOL_API_IMPL void sg_dispatch(int num_groups_x, int num_groups_y, int num_groups_z) {
     SOKOL_ASSERT(_sg.valid);
+    if (_sg_rec_cmdlist) {
+        if (_sg_validate_record_dispatch(_sg_rec_cmdlist, num_groups_x, num_groups_y, num_groups_z)) {
+            _sg_record_draw_or_dispatch(_sg_rec_cmdlist, _SG_CMD_DISPATCH, num_groups_x, num_groups_y, num_groups_z);
+        }
+        return;
+    }
     #if defined(SOKOL_DEBUG)
     if (!_sg_validate_dispatch(num_groups_x, num_groups_y, num_groups_z)) {
         return;
@@ -21297,23 +27480,30 @@ SOKOL_API_IMPL void sg_dispatch(int num_groups_x, int num_groups_y, int num_grou
 
 SOKOL_API_IMPL void sg_end_pass(void) {
     SOKOL_ASSERT(_sg.valid);
+    SOKOL_ASSERT(0 == _sg_rec_cmdlist);
     SOKOL_ASSERT(_sg.cur_pass.in_pass);
     _sg_stats_add(num_passes, 1);
     // NOTE: don't exit early if !_sg.cur_pass.valid
     _sg_end_pass();
+    _sg_end_gpu_timing();
     _sg.cur_pip = _sg_pipeline_ref(0);
     if (_sg.cur_pass.is_compute) {
         _sg_compute_on_endpass();
     }
     _sg_clear(&_sg.cur_pass, sizeof(_sg.cur_pass));
+    // mipmap generation which was requested inside the pass
+    _sg_mipmaps_on_endpass();
     _SG_TRACE_NOARGS(end_pass);
 }
 
 SOKOL_API_IMPL void sg_commit(void) {
     SOKOL_ASSERT(_sg.valid);
+    SOKOL_ASSERT(0 == _sg_rec_cmdlist);
     SOKOL_ASSERT(!_sg.cur_pass.valid);
     SOKOL_ASSERT(!_sg.cur_pass.in_pass);
     _sg_commit();
+    _sg_update_readbacks(false);
+    _sg_release_destroyed_resources(false);
     _sg.stats.frame_index = _sg.frame_index;
     _sg.prev_stats = _sg.stats;
     _sg_clear(&_sg.stats, sizeof(_sg.stats));
@@ -21322,9 +27512,60 @@ SOKOL_API_IMPL void sg_commit(void) {
     _sg.frame_index++;
 }
 
+SOKOL_API_IMPL void sg_begin_command_list(sg_command_list cl_id) {
+    SOKOL_ASSERT(_sg.valid);
+    if (!_sg_validate_begin_command_list(cl_id)) {
+        return;
+    }
+    _sg_command_list_t* cl = _sg_lookup_command_list(cl_id.id);
+    if (cl && (cl->slot.state == SG_RESOURCESTATE_VALID) && !cl->recording && (0 == _sg_rec_cmdlist)) {
+        cl->pos = 0;
+        cl->overflow = false;
+        cl->has_pipeline = false;
+        cl->is_compute = false;
+        _sg_clear(&cl->rec, sizeof(cl->rec));
+        cl->recording = true;
+        _sg_rec_cmdlist = cl;
+    }
+}
+
+SOKOL_API_IMPL void sg_end_command_list(void) {
+    SOKOL_ASSERT(_sg.valid);
+    if (!_sg_validate_end_command_list()) {
+        return;
+    }
+    if (_sg_rec_cmdlist) {
+        SOKOL_ASSERT(_sg_rec_cmdlist->recording);
+        _sg_rec_cmdlist->recording = false;
+        _sg_rec_cmdlist = 0;
+    }
+}
+
+SOKOL_API_IMPL void sg_execute_command_list(sg_command_list cl_id) {
+    SOKOL_ASSERT(_sg.valid);
+    SOKOL_ASSERT(0 == _sg_rec_cmdlist);
+    if (!_sg_validate_execute_command_list(cl_id)) {
+        _sg.next_draw_valid = false;
+        return;
+    }
+    if (!_sg.cur_pass.valid) {
+        return;
+    }
+    const _sg_command_list_t* cl = _sg_lookup_command_list(cl_id.id);
+    if ((0 == cl) || (cl->slot.state != SG_RESOURCESTATE_VALID) || cl->recording || cl->overflow) {
+        return;
+    }
+    if (cl->has_pipeline && (cl->is_compute != _sg.cur_pass.is_compute)) {
+        return;
+    }
+    _sg_exec_command_list(cl);
+    _SG_TRACE_ARGS(execute_command_list, cl_id);
+}
+
 SOKOL_API_IMPL void sg_reset_state_cache(void) {
     SOKOL_ASSERT(_sg.valid);
     _sg_reset_state_cache();
+    _sg_reset_uniform_cache();
     _SG_TRACE_NOARGS(reset_state_cache);
 }
 
@@ -21429,20 +27670,112 @@ SOKOL_API_IMPL void sg_update_image(sg_image img_id, const sg_image_data* data)
             SOKOL_ASSERT(img->cmn.upd_frame_index != _sg.frame_index);
             _sg_update_image(img, data);
             img->cmn.upd_frame_index = _sg.frame_index;
+            if (img->cmn.generate_mipmaps) {
+                _sg_request_generate_mipmaps(img);
+            }
         }
     }
     _SG_TRACE_ARGS(update_image, img_id, data);
 }
 
+SOKOL_API_IMPL void sg_update_buffer_range(sg_buffer buf_id, int offset, const sg_range* data) {
+    SOKOL_ASSERT(_sg.valid);
+    SOKOL_ASSERT(data && data->ptr && (data->size > 0));
+    _sg_stats_add(num_update_buffer, 1);
+    _sg_stats_add(size_update_buffer, (uint32_t)data->size);
+    _sg_buffer_t* buf = _sg_lookup_buffer(buf_id.id);
+    if ((data->size > 0) && buf && (buf->slot.state == SG_RESOURCESTATE_VALID)) {
+        if (_sg_validate_update_buffer_range(buf, offset, data)) {
+            SOKOL_ASSERT((offset >= 0) && (((size_t)offset + data->size) <= (size_t)buf->cmn.size));
+            // update and append on same buffer in same frame not allowed
+            SOKOL_ASSERT(buf->cmn.append_frame_index != _sg.frame_index);
+            _sg_update_buffer_range(buf, offset, data, buf->cmn.update_frame_index != _sg.frame_index);
+            buf->cmn.update_frame_index = _sg.frame_index;
+        }
+    }
+    _SG_TRACE_ARGS(update_buffer_range, buf_id, offset, data);
+}
+
+SOKOL_API_IMPL void sg_update_image_region(sg_image img_id, const sg_image_region* region, const sg_range* data) {
+    SOKOL_ASSERT(_sg.valid);
+    SOKOL_ASSERT(region && data);
+    _sg_stats_add(num_update_image, 1);
+    _sg_stats_add(size_update_image, (uint32_t)data->size);
+    _sg_image_t* img = _sg_lookup_image(img_id.id);
+    if (img && img->slot.state == SG_RESOURCESTATE_VALID) {
+        if (_sg_validate_update_image_region(img, region, data)) {
+            _sg_update_image_region(img, region, data, img->cmn.upd_frame_index != _sg.frame_index);
+            img->cmn.upd_frame_index = _sg.frame_index;
+        }
+    }
+    _SG_TRACE_ARGS(update_image_region, img_id, region, data);
+}
+
+SOKOL_API_IMPL void sg_generate_mipmaps(sg_image img_id) {
+    SOKOL_ASSERT(_sg.valid);
+    SOKOL_ASSERT(0 == _sg_rec_cmdlist);
+    _sg_image_t* img = _sg_lookup_image(img_id.id);
+    if (img && img->slot.state == SG_RESOURCESTATE_VALID) {
+        if (_sg_validate_generate_mipmaps(img)) {
+            _sg_request_generate_mipmaps(img);
+        }
+    }
+    _SG_TRACE_ARGS(generate_mipmaps, img_id);
+}
+
+SOKOL_API_IMPL sg_readback sg_read_image_async(const sg_image_readback_desc* desc) {
+    SOKOL_ASSERT(_sg.valid);
+    SOKOL_ASSERT(desc);
+    sg_readback res = { SG_INVALID_ID };
+    sg_image_readback_desc desc_def = _sg_image_readback_desc_defaults(desc);
+    if (_sg_validate_image_readback_desc(&desc_def)) {
+        _sg_image_t* img = _sg_lookup_image(desc_def.image.id);
+        if (img && (img->slot.state == SG_RESOURCESTATE_VALID)) {
+            res = _sg_alloc_readback();
+            if (res.id != SG_INVALID_ID) {
+                _sg_readback_t* rb = _sg_readback_at(res.id);
+                const sg_image_region* region = &desc_def.region;
+                const int row_pitch = _sg_row_pitch(img->cmn.pixel_format, region->width, 1);
+                _sg_readback_common_init(&rb->cmn, region->width, region->height, row_pitch, &desc_def.data, desc_def.callback, desc_def.user_data);
+                rb->slot.state = _sg_create_image_readback(rb, img, region);
+            }
+        }
+    }
+    _SG_TRACE_ARGS(read_image_async, &desc_def, res);
+    return res;
+}
+
+SOKOL_API_IMPL sg_readback sg_read_buffer_async(const sg_buffer_readback_desc* desc) {
+    SOKOL_ASSERT(_sg.valid);
+    SOKOL_ASSERT(desc);
+    sg_readback res = { SG_INVALID_ID };
+    sg_buffer_readback_desc desc_def = _sg_buffer_readback_desc_defaults(desc);
+    if (_sg_validate_buffer_readback_desc(&desc_def)) {
+        _sg_buffer_t* buf = _sg_lookup_buffer(desc_def.buffer.id);
+        if (buf && (buf->slot.state == SG_RESOURCESTATE_VALID)) {
+            res = _sg_alloc_readback();
+            if (res.id != SG_INVALID_ID) {
+                _sg_readback_t* rb = _sg_readback_at(res.id);
+                _sg_readback_common_init(&rb->cmn, desc_def.size, 1, desc_def.size, &desc_def.data, desc_def.callback, desc_def.user_data);
+                rb->slot.state = _sg_create_buffer_readback(rb, buf, desc_def.offset);
+            }
+        }
+    }
+    _SG_TRACE_ARGS(read_buffer_async, &desc_def, res);
+    return res;
+}
+
 SOKOL_API_IMPL void sg_push_debug_group(const char* name) {
     SOKOL_ASSERT(_sg.valid);
     SOKOL_ASSERT(name);
     _sg_push_debug_group(name);
+    _sg_begin_gpu_timing(name);
     _SG_TRACE_ARGS(push_debug_group, name);
 }
 
 SOKOL_API_IMPL void sg_pop_debug_group(void) {
     SOKOL_ASSERT(_sg.valid);
+    _sg_end_gpu_timing();
     _sg_pop_debug_group();
     _SG_TRACE_NOARGS(pop_debug_group);
 }
@@ -21491,6 +27824,7 @@ SOKOL_API_IMPL sg_buffer_info sg_query_buffer_info(sg_buffer buf_id) {
         info.num_slots = buf->cmn.num_slots;
         info.active_slot = buf->cmn.active_slot;
         #endif
+        info.num_bytes = buf->cmn.mem_size;
     }
     return info;
 }
@@ -21512,6 +27846,7 @@ SOKOL_API_IMPL sg_image_info sg_query_image_info(sg_image img_id) {
         info.num_slots = img->cmn.num_slots;
         info.active_slot = img->cmn.active_slot;
         #endif
+        info.num_bytes = img->cmn.mem_size;
     }
     return info;
 }
@@ -21568,6 +27903,38 @@ SOKOL_API_IMPL sg_attachments_info sg_query_attachments_info(sg_attachments atts
     return info;
 }
 
+_SOKOL_PRIVATE sg_pool_info _sg_pool_info(const _sg_pool_t* pool) {
+    SOKOL_ASSERT(pool);
+    sg_pool_info info;
+    _sg_clear(&info, sizeof(info));
+    // don't count the reserved slot 0
+    info.size = pool->size - 1;
+    info.num_used = info.size - pool->queue_top;
+    info.high_water_mark = pool->high_water_mark;
+    return info;
+}
+
+SOKOL_API_IMPL sg_pool_stats sg_query_pool_stats(void) {
+    SOKOL_ASSERT(_sg.valid);
+    sg_pool_stats stats;
+    _sg_clear(&stats, sizeof(stats));
+    stats.buffers = _sg_pool_info(&_sg.pools.buffer_pool);
+    stats.images = _sg_pool_info(&_sg.pools.image_pool);
+    stats.samplers = _sg_pool_info(&_sg.pools.sampler_pool);
+    stats.shaders = _sg_pool_info(&_sg.pools.shader_pool);
+    stats.pipelines = _sg_pool_info(&_sg.pools.pipeline_pool);
+    stats.attachments = _sg_pool_info(&_sg.pools.attachments_pool);
+    stats.bindgroups = _sg_pool_info(&_sg.pools.bindgroup_pool);
+    stats.command_lists = _sg_pool_info(&_sg.pools.command_list_pool);
+    stats.readbacks = _sg_pool_info(&_sg.pools.readback_pool);
+    return stats;
+}
+
+SOKOL_API_IMPL sg_memory_stats sg_query_memory_stats(void) {
+    SOKOL_ASSERT(_sg.valid);
+    return _sg.memory.stats;
+}
+
 SOKOL_API_IMPL sg_buffer_desc sg_query_buffer_desc(sg_buffer buf_id) {
     SOKOL_ASSERT(_sg.valid);
     sg_buffer_desc desc;
@@ -21576,6 +27943,8 @@ SOKOL_API_IMPL sg_buffer_desc sg_query_buffer_desc(sg_buffer buf_id) {
     if (buf) {
         desc.size = (size_t)buf->cmn.size;
         desc.usage = buf->cmn.usage;
+        desc.update_mode = buf->cmn.update_mode;
+        desc.num_update_slots = buf->cmn.num_slots;
     }
     return desc;
 }
@@ -21611,9 +27980,12 @@ SOKOL_API_IMPL sg_image_desc sg_query_image_desc(sg_image img_id) {
         desc.height = img->cmn.height;
         desc.num_slices = img->cmn.num_slices;
         desc.num_mipmaps = img->cmn.num_mipmaps;
+        desc.generate_mipmaps = img->cmn.generate_mipmaps;
         desc.usage = img->cmn.usage;
         desc.pixel_format = img->cmn.pixel_format;
         desc.sample_count = img->cmn.sample_count;
+        desc.update_mode = img->cmn.update_mode;
+        desc.num_update_slots = img->cmn.num_slots;
     }
     return desc;
 }
@@ -22001,7 +28373,7 @@ SOKOL_API_IMPL sg_mtl_buffer_info sg_mtl_query_buffer_info(sg_buffer buf_id) {
     #if defined(SOKOL_METAL)
         const _sg_buffer_t* buf = _sg_lookup_buffer(buf_id.id);
         if (buf) {
-            for (int i = 0; i < SG_NUM_INFLIGHT_FRAMES; i++) {
+            for (int i = 0; i < SG_MAX_UPDATE_SLOTS; i++) {
                 if (buf->mtl.buf[i] != 0) {
                     res.buf[i] = (__bridge void*) _sg_mtl_id(buf->mtl.buf[i]);
                 }
@@ -22021,7 +28393,7 @@ SOKOL_API_IMPL sg_mtl_image_info sg_mtl_query_image_info(sg_image img_id) {
     #if defined(SOKOL_METAL)
         const _sg_image_t* img = _sg_lookup_image(img_id.id);
         if (img) {
-            for (int i = 0; i < SG_NUM_INFLIGHT_FRAMES; i++) {
+            for (int i = 0; i < SG_MAX_UPDATE_SLOTS; i++) {
                 if (img->mtl.tex[i] != 0) {
                     res.tex[i] = (__bridge void*) _sg_mtl_id(img->mtl.tex[i]);
                 }
@@ -22246,7 +28618,7 @@ SOKOL_API_IMPL sg_gl_buffer_info sg_gl_query_buffer_info(sg_buffer buf_id) {
     #if defined(_SOKOL_ANY_GL)
         const _sg_buffer_t* buf = _sg_lookup_buffer(buf_id.id);
         if (buf) {
-            for (int i = 0; i < SG_NUM_INFLIGHT_FRAMES; i++) {
+            for (int i = 0; i < SG_MAX_UPDATE_SLOTS; i++) {
                 res.buf[i] = buf->gl.buf[i];
             }
             res.active_slot = buf->cmn.active_slot;
@@ -22264,7 +28636,7 @@ SOKOL_API_IMPL sg_gl_image_info sg_gl_query_image_info(sg_image img_id) {
     #if defined(_SOKOL_ANY_GL)
         const _sg_image_t* img = _sg_lookup_image(img_id.id);
         if (img) {
-            for (int i = 0; i < SG_NUM_INFLIGHT_FRAMES; i++) {
+            for (int i = 0; i < SG_MAX_UPDATE_SLOTS; i++) {
                 res.tex[i] = img->gl.tex[i];
             }
             res.tex_target = img->gl.target;
@@ -0,0 +1,2502 @@
+#if defined(SOKOL_IMPL) && !defined(SOKOL_GFX_TRACE_IMPL)
+#define SOKOL_GFX_TRACE_IMPL
+#endif
+#ifndef SOKOL_GFX_TRACE_INCLUDED
+/*
+    sokol_gfx_trace.h -- capture and replay sokol_gfx.h call streams
+
+    Project URL: https://github.com/Ed94/SectrPrototype (Sectr fork of sokol-odin)
+
+    This header is an addition of the Sectr fork and is not part of the upstream
+    sokol headers (https://github.com/floooh/sokol), it follows their API conventions.
+
+    Do this:
+        #define SOKOL_IMPL or
+        #define SOKOL_GFX_TRACE_IMPL
+    before you include this file in *one* C or C++ file to create the
+    implementation.
+
+    sokol_gfx.h must be compiled with SOKOL_TRACE_HOOKS defined, otherwise
+    no calls will be captured.
+
+    Optionally provide the following defines with your own implementations:
+
+    SOKOL_ASSERT(c)             - your own assert macro (default: assert(c))
+    SOKOL_UNREACHABLE()         - a guard macro for unreachable code (default: assert(false))
+    SOKOL_GFX_TRACE_API_DECL    - public function declaration prefix (default: extern)
+    SOKOL_API_DECL              - same as SOKOL_GFX_TRACE_API_DECL
+    SOKOL_API_IMPL              - public function implementation prefix (default: -)
+
+    If sokol_gfx_trace.h is compiled as a DLL, define the following before
+    including the declaration or implementation:
+
+    SOKOL_DLL
+
+    On Windows, SOKOL_DLL will define SOKOL_GFX_TRACE_API_DECL as __declspec(dllexport)
+    or __declspec(dllimport) as needed.
+
+    Include the following headers before including sokol_gfx_trace.h:
+
+        sokol_gfx.h
+
+    FEATURES AND CONCEPTS
+    =====================
+    - captures the complete sokol_gfx.h call stream of one or more frames
+      (including all uploaded data) into a compact binary blob via the
+      sokol_gfx.h trace hooks
+    - the blob also contains the creation parameters of all resources
+      which are alive when the capture starts, so a capture is self-contained
+    - replays a captured blob on any sokol_gfx.h backend (including the
+      dummy backend) for reproducible performance measurements of
+      real-world frames without the original application
+
+    STEP BY STEP: CAPTURING
+    =======================
+    --- call sgtrace_setup() right after sg_setup(), so that the creation
+        of all resources is observed:
+
+            sg_setup(&(sg_desc){ ... });
+            sgtrace_setup(&(sgtrace_desc_t){ .logger.func = slog_func });
+
+        sokol_gfx_trace.h installs its own trace hooks and calls any
+        previously installed trace hooks.
+
+        NOTE: to be able to put live resources into a capture,
+        sokol_gfx_trace.h keeps a copy of the creation parameters of each
+        live resource (including the initial content of immutable buffers
+        and images) until the resource is destroyed.
+
+    --- to capture one or more frames, call:
+
+            sgtrace_begin_capture(num_frames);
+
+        The capture starts right after the next sg_commit() and ends
+        after num_frames calls to sg_commit().
+
+    --- check when the capture is complete and get the captured data:
+
+            if (sgtrace_capture_ready()) {
+                const sgtrace_range data = sgtrace_get_capture();
+                // ...write data.ptr/data.size to a file...
+            }
+
+        The captured data remains valid until the next call to
+        sgtrace_begin_capture() or sgtrace_shutdown().
+
+        If the capture data grows beyond sgtrace_desc_t.max_capture_size,
+        the capture is cancelled with a CAPTURE_BUFFER_FULL error.
+
+    --- call sgtrace_shutdown() before sg_shutdown():
+
+            sgtrace_shutdown();
+            sg_shutdown();
+
+    STEP BY STEP: REPLAYING
+    =======================
+    --- replaying doesn't require sgtrace_setup() to be called, first
+        start the replay with the captured data (the data is copied):
+
+            if (!sgtrace_begin_replay(data)) {
+                // not a valid capture, or captured with a different
+                // version of sokol_gfx.h (see log output)
+            }
+
+        This creates all resources which were alive when the capture started.
+
+    --- in each frame, replay the next captured frame, followed by
+        the usual sg_commit():
+
+            sgtrace_replay_frame(sglue_swapchain());
+            sg_commit();
+
+        All captured sokol_gfx.h calls up to (but not including) the captured
+        sg_commit() call are replayed, swapchain render passes render into
+        the provided swapchain. After the last captured frame, the replay
+        rewinds to the first frame: resources created in the captured
+        frames are destroyed, and resources which were destroyed in the
+        captured frames are created again.
+
+        To get the total number of captured frames call:
+
+            int num_frames = sgtrace_replay_num_frames();
+
+    --- finally stop the replay, this destroys all replay resources:
+
+            sgtrace_end_replay();
+
+    LIMITATIONS
+    ===========
+    - the capture format depends on the sokol_gfx.h version and the
+      CPU architecture (it contains raw sokol_gfx.h desc structs), captures
+      must be replayed with the same version of sokol_gfx.h
+    - the content of dynamic and stream-update resources at the start of
+      the capture isn't captured (only updates inside captured frames)
+    - injected native 3D-API resources are not captured
+    - the content of command lists isn't visible to trace hooks, so
+      sg_execute_command_list() calls are skipped in the replay
+    - sg_read_image_async() and sg_read_buffer_async() are not captured
+
+    ERROR REPORTING AND LOGGING
+    ===========================
+    To get any logging information at all you need to provide a logging callback in the setup call,
+    the easiest way is to use sokol_log.h:
+
+        #include "sokol_log.h"
+
+        sgtrace_setup(&(sgtrace_desc_t){
+            // ...
+            .logger.func = slog_func
+        });
+
+    NOTE that replaying doesn't require sgtrace_setup(), in this case
+    errors are reported through the logger passed into sgtrace_begin_replay()
+    via sgtrace_replay_desc_t.
+
+    MEMORY ALLOCATION OVERRIDE
+    ==========================
+    You can override the memory allocation functions at initialization time
+    like this:
+
+        void* my_alloc(size_t size, void* user_data) {
+            return malloc(size);
+        }
+
+        void my_free(void* ptr, void* user_data) {
+            free(ptr);
+        }
+
+        ...
+            sgtrace_setup(&(sgtrace_desc_t){
+                // ...
+                .allocator = {
+                    .alloc_fn = my_alloc,
+                    .free_fn = my_free,
+                    .user_data = ...;
+                }
+            });
+        ...
+
+    If no overrides are provided, malloc and free will be used.
+
+    LICENSE
+    =======
+    zlib/libpng license
+
+    Copyright (c) 2026 the Sectr fork contributors
+
+    This software is provided 'as-is', without any express or implied warranty.
+    In no event will the authors be held liable for any damages arising from the
+    use of this software.
+
+    Permission is granted to anyone to use this software for any purpose,
+    including commercial applications, and to alter it and redistribute it
+    freely, subject to the following restrictions:
+
+        1. The origin of this software must not be misrepresented; you must not
+        claim that you wrote the original software. If you use this software in a
+        product, an acknowledgment in the product documentation would be
+        appreciated but is not required.
+
+        2. Altered source versions must be plainly marked as such, and must not
+        be misrepresented as being the original software.
+
+        3. This notice may not be removed or altered from any source
+        distribution.
+*/
+#define SOKOL_GFX_TRACE_INCLUDED (1)
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h> // size_t
+
+#if !defined(SOKOL_GFX_INCLUDED)
+#error "Please include sokol_gfx.h before sokol_gfx_trace.h"
+#endif
+
+#if defined(SOKOL_API_DECL) && !defined(SOKOL_GFX_TRACE_API_DECL)
+#define SOKOL_GFX_TRACE_API_DECL SOKOL_API_DECL
+#endif
+#ifndef SOKOL_GFX_TRACE_API_DECL
+#if defined(_WIN32) && defined(SOKOL_DLL) && defined(SOKOL_GFX_TRACE_IMPL)
+#define SOKOL_GFX_TRACE_API_DECL __declspec(dllexport)
+#elif defined(_WIN32) && defined(SOKOL_DLL)
+#define SOKOL_GFX_TRACE_API_DECL __declspec(dllimport)
+#else
+#define SOKOL_GFX_TRACE_API_DECL extern
+#endif
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+    sgtrace_log_item_t
+
+    Log items are defined via X-Macros, and expanded to an
+    enum 'sgtrace_log_item' - and in debug mode only - corresponding strings.
+
+    Used as parameter in the logging callback.
+*/
+#define _SGTRACE_LOG_ITEMS \
+    _SGTRACE_LOGITEM_XMACRO(OK, "Ok") \
+    _SGTRACE_LOGITEM_XMACRO(MALLOC_FAILED, "memory allocation failed") \
+    _SGTRACE_LOGITEM_XMACRO(CAPTURE_ALREADY_ACTIVE, "sgtrace_begin_capture() called while a capture is in progress") \
+    _SGTRACE_LOGITEM_XMACRO(CAPTURE_BUFFER_FULL, "capture cancelled because capture buffer is full (adjust via sgtrace_desc_t.max_capture_size)") \
+    _SGTRACE_LOGITEM_XMACRO(REPLAY_ALREADY_ACTIVE, "sgtrace_begin_replay() called while a replay is in progress") \
+    _SGTRACE_LOGITEM_XMACRO(REPLAY_INVALID_DATA, "replay data is not a sokol_gfx_trace.h capture") \
+    _SGTRACE_LOGITEM_XMACRO(REPLAY_VERSION_MISMATCH, "replay data was captured with a different sokol_gfx_trace.h version") \
+    _SGTRACE_LOGITEM_XMACRO(REPLAY_ABI_MISMATCH, "replay data was captured with a different sokol_gfx.h version or CPU architecture") \
+    _SGTRACE_LOGITEM_XMACRO(REPLAY_CORRUPT_DATA, "replay data is truncated or corrupt") \
+    _SGTRACE_LOGITEM_XMACRO(REPLAY_COMMAND_LIST_SKIPPED, "sg_execute_command_list() skipped in replay (command list content isn't captured)") \
+
+#define _SGTRACE_LOGITEM_XMACRO(item,msg) SGTRACE_LOGITEM_##item,
+typedef enum sgtrace_log_item_t {
+    _SGTRACE_LOG_ITEMS
+} sgtrace_log_item_t;
+#undef _SGTRACE_LOGITEM_XMACRO
+
+/*
+    sgtrace_logger_t
+
+    Used in sgtrace_desc_t and sgtrace_replay_desc_t to provide a custom
+    logging and error reporting callback to sokol-gfx-trace.
+*/
+typedef struct sgtrace_logger_t {
+    void (*func)(
+        const char* tag,                // always "sgtrace"
+        uint32_t log_level,             // 0=panic, 1=error, 2=warning, 3=info
+        uint32_t log_item_id,           // SGTRACE_LOGITEM_*
+        const char* message_or_null,    // a message string, may be nullptr in release mode
+        uint32_t line_nr,               // line number in sokol_gfx_trace.h
+        const char* filename_or_null,   // source filename, may be nullptr in release mode
+        void* user_data);
+    void* user_data;
+} sgtrace_logger_t;
+
+/*
+    sgtrace_allocator_t
+
+    Used in sgtrace_desc_t and sgtrace_replay_desc_t to provide custom
+    memory-alloc and -free functions to sokol_gfx_trace.h. If memory
+    management should be overridden, both the alloc_fn and free_fn function
+    must be provided (e.g. it's not valid to override one function but not
+    the other).
+*/
+typedef struct sgtrace_allocator_t {
+    void* (*alloc_fn)(size_t size, void* user_data);
+    void (*free_fn)(void* ptr, void* user_data);
+    void* user_data;
+} sgtrace_allocator_t;
+
+/*
+    sgtrace_range is a pointer-size-pair struct used to pass captured
+    data in and out of sokol-gfx-trace.
+*/
+typedef struct sgtrace_range {
+    const void* ptr;
+    size_t size;
+} sgtrace_range;
+
+/*
+    sgtrace_desc_t
+
+    Describes the capture setup parameters, passed to sgtrace_setup().
+*/
+typedef struct sgtrace_desc_t {
+    size_t max_capture_size;                // max size of captured data in bytes, default: 64 MBytes
+    sgtrace_allocator_t allocator;          // optional memory allocation overrides (default: malloc/free)
+    sgtrace_logger_t logger;                // optional log override function (default: NO LOGGING)
+} sgtrace_desc_t;
+
+/*
+    sgtrace_replay_desc_t
+
+    Describes the replay parameters, passed to sgtrace_begin_replay().
+*/
+typedef struct sgtrace_replay_desc_t {
+    sgtrace_range data;                     // the captured data, will be copied
+    sgtrace_allocator_t allocator;          // optional memory allocation overrides (default: malloc/free)
+    sgtrace_logger_t logger;                // optional log override function (default: NO LOGGING)
+} sgtrace_replay_desc_t;
+
+/* capture setup and shutdown */
+SOKOL_GFX_TRACE_API_DECL void sgtrace_setup(const sgtrace_desc_t* desc);
+SOKOL_GFX_TRACE_API_DECL void sgtrace_shutdown(void);
+
+/* capturing */
+SOKOL_GFX_TRACE_API_DECL void sgtrace_begin_capture(int num_frames);
+SOKOL_GFX_TRACE_API_DECL bool sgtrace_capture_active(void);
+SOKOL_GFX_TRACE_API_DECL bool sgtrace_capture_ready(void);
+SOKOL_GFX_TRACE_API_DECL sgtrace_range sgtrace_get_capture(void);
+
+/* replaying */
+SOKOL_GFX_TRACE_API_DECL bool sgtrace_begin_replay(const sgtrace_replay_desc_t* desc);
+SOKOL_GFX_TRACE_API_DECL int sgtrace_replay_num_frames(void);
+SOKOL_GFX_TRACE_API_DECL int sgtrace_replay_frame_index(void);
+SOKOL_GFX_TRACE_API_DECL void sgtrace_replay_frame(sg_swapchain swapchain);
+SOKOL_GFX_TRACE_API_DECL void sgtrace_end_replay(void);
+
+#ifdef __cplusplus
+} /* extern "C" */
+/* C++ const-ref wrappers */
+inline void sgtrace_setup(const sgtrace_desc_t& desc) { return sgtrace_setup(&desc); }
+inline bool sgtrace_begin_replay(const sgtrace_replay_desc_t& desc) { return sgtrace_begin_replay(&desc); }
+#endif
+#endif /* SOKOL_GFX_TRACE_INCLUDED */
+
+// ██ ███    ███ ██████  ██      ███████ ███    ███ ███████ ███    ██ ████████  █████  ████████ ██  ██████  ███    ██
+// ██ ████  ████ ██   ██ ██      ██      ████  ████ ██      ████   ██    ██    ██   ██    ██    ██ ██    ██ ████   ██
+// ██ ██ ████ ██ ██████  ██      █████   ██ ████ ██ █████   ██ ██  ██    ██    ███████    ██    ██ ██    ██ ██ ██  ██
+// ██ ██  ██  ██ ██      ██      ██      ██  ██  ██ ██      ██  ██ ██    ██    ██   ██    ██    ██ ██    ██ ██  ██ ██
+// ██ ██      ██ ██      ███████ ███████ ██      ██ ███████ ██   ████    ██    ██   ██    ██    ██  ██████  ██   ████
+//
+// >>implementation
+#ifdef SOKOL_GFX_TRACE_IMPL
+#define SOKOL_GFX_TRACE_IMPL_INCLUDED (1)
+
+#if defined(SOKOL_MALLOC) || defined(SOKOL_CALLOC) || defined(SOKOL_FREE)
+#error "SOKOL_MALLOC/CALLOC/FREE macros are no longer supported, please use sgtrace_desc_t.allocator to override memory allocation functions"
+#endif
+
+#include <string.h> // memset, memcpy, strlen
+#include <stdlib.h> // malloc/free, qsort
+
+#ifndef SOKOL_API_IMPL
+    #define SOKOL_API_IMPL
+#endif
+#ifndef SOKOL_DEBUG
+    #ifndef NDEBUG
+        #define SOKOL_DEBUG
+    #endif
+#endif
+#ifndef SOKOL_ASSERT
+    #include <assert.h>
+    #define SOKOL_ASSERT(c) assert(c)
+#endif
+#ifndef SOKOL_UNREACHABLE
+    #define SOKOL_UNREACHABLE SOKOL_ASSERT(false)
+#endif
+#ifndef _SOKOL_UNUSED
+    #define _SOKOL_UNUSED(x) (void)(x)
+#endif
+
+#define _sgtrace_def(val, def) (((val) == 0) ? (def) : (val))
+#define _SGTRACE_INIT_COOKIE (0xABCDBADC)
+#define _SGTRACE_DEFAULT_MAX_CAPTURE_SIZE (64 * 1024 * 1024)
+#define _SGTRACE_MAGIC (0x52544753)     // 'SGTR'
+#define _SGTRACE_VERSION (1)
+
+// resource types, used in resource commands and as key prefix in id maps
+typedef enum {
+    _SGTRACE_RES_BUFFER = 1,
+    _SGTRACE_RES_IMAGE,
+    _SGTRACE_RES_SAMPLER,
+    _SGTRACE_RES_SHADER,
+    _SGTRACE_RES_PIPELINE,
+    _SGTRACE_RES_ATTACHMENTS,
+    _SGTRACE_RES_BINDGROUP,
+    _SGTRACE_RES_COMMAND_LIST,
+} _sgtrace_res_t;
+
+// command types in the captured stream
+typedef enum {
+    _SGTRACE_CMD_INVALID,
+    _SGTRACE_CMD_MAKE,                  // res_type, id, desc
+    _SGTRACE_CMD_DESTROY,               // res_type, id
+    _SGTRACE_CMD_ALLOC,                 // res_type, id
+    _SGTRACE_CMD_INIT,                  // res_type, id, desc
+    _SGTRACE_CMD_UNINIT,                // res_type, id
+    _SGTRACE_CMD_DEALLOC,               // res_type, id
+    _SGTRACE_CMD_FAIL,                  // res_type, id
+    _SGTRACE_CMD_UPDATE_BUFFER,         // id, data
+    _SGTRACE_CMD_APPEND_BUFFER,         // id, data
+    _SGTRACE_CMD_UPDATE_BUFFER_RANGE,   // id, offset, data
+    _SGTRACE_CMD_UPDATE_IMAGE,          // id, image data
+    _SGTRACE_CMD_UPDATE_IMAGE_REGION,   // id, region, data
+    _SGTRACE_CMD_BEGIN_PASS,            // pass
+    _SGTRACE_CMD_APPLY_VIEWPORT,        // x, y, width, height, origin_top_left
+    _SGTRACE_CMD_APPLY_SCISSOR_RECT,    // x, y, width, height, origin_top_left
+    _SGTRACE_CMD_APPLY_PIPELINE,        // id
+    _SGTRACE_CMD_APPLY_BINDINGS,        // bindings
+    _SGTRACE_CMD_APPLY_BINDGROUP,       // id
+    _SGTRACE_CMD_APPLY_UNIFORMS,        // ub_slot, data
+    _SGTRACE_CMD_DRAW,                  // base_element, num_elements, num_instances
+    _SGTRACE_CMD_DISPATCH,              // num_groups_x, num_groups_y, num_groups_z
+    _SGTRACE_CMD_EXECUTE_COMMAND_LIST,  // id
+    _SGTRACE_CMD_END_PASS,
+    _SGTRACE_CMD_COMMIT,
+    _SGTRACE_CMD_RESET_STATE_CACHE,
+    _SGTRACE_CMD_PUSH_DEBUG_GROUP,      // name
+    _SGTRACE_CMD_POP_DEBUG_GROUP,
+    _SGTRACE_CMD_DRAW_INDIRECT,         // id, offset
+    _SGTRACE_CMD_GENERATE_MIPMAPS,      // id
+    _SGTRACE_CMD_REF_COUNT,             // res_type, id, ref_count (only in the prologue)
+    _SGTRACE_CMD_NUM,
+} _sgtrace_cmd_t;
+
+// sizes of the raw structs in the capture, used to detect incompatible captures
+typedef enum {
+    _SGTRACE_ABI_POINTER,
+    _SGTRACE_ABI_BUFFER_DESC,
+    _SGTRACE_ABI_IMAGE_DESC,
+    _SGTRACE_ABI_SAMPLER_DESC,
+    _SGTRACE_ABI_SHADER_DESC,
+    _SGTRACE_ABI_PIPELINE_DESC,
+    _SGTRACE_ABI_ATTACHMENTS_DESC,
+    _SGTRACE_ABI_BINDGROUP_DESC,
+    _SGTRACE_ABI_COMMAND_LIST_DESC,
+    _SGTRACE_ABI_BINDINGS,
+    _SGTRACE_ABI_PASS,
+    _SGTRACE_ABI_IMAGE_DATA,
+    _SGTRACE_ABI_IMAGE_REGION,
+    _SGTRACE_ABI_NUM,
+} _sgtrace_abi_t;
+
+/*
+    The capture starts with a header, followed by the 'prologue' which
+    creates all resources alive at the start of the capture, followed by
+    the captured frames, each frame ends with a COMMIT command.
+
+    Each command starts with a uint32_t command type and a uint32_t payload
+    size. All values are stored unaligned in native byte order, desc structs
+    are stored as raw zero-run-length-encoded bytes, followed by the data
+    and strings referenced by the desc struct's pointers.
+*/
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t num_frames;
+    uint32_t prologue_size;     // size of the prologue in bytes, following the header
+    uint32_t abi[_SGTRACE_ABI_NUM];
+} _sgtrace_header_t;
+
+// a growable byte buffer
+typedef struct {
+    uint8_t* ptr;
+    size_t size;
+    size_t cap;
+    size_t max_size;
+    bool overflow;
+} _sgtrace_buf_t;
+
+// an open-addressing hash map with uint64_t keys and values (key 0 is reserved)
+typedef struct {
+    uint32_t cap;       // always a power of 2
+    uint32_t num;
+    uint64_t* keys;
+    uint64_t* values;
+} _sgtrace_map_t;
+
+// the creation parameters of a live resource
+typedef struct {
+    uint64_t seq;       // creation order
+    uint32_t ref_count; // > 1 when sokol_gfx.h returned the same handle more than once (see sg_desc.dedup_pipelines)
+    uint32_t cmd_size;
+    uint8_t* cmd;       // a serialized MAKE command
+} _sgtrace_live_t;
+
+typedef enum {
+    _SGTRACE_CAPTURE_IDLE,
+    _SGTRACE_CAPTURE_PENDING,   // waiting for next sg_commit()
+    _SGTRACE_CAPTURE_ACTIVE,
+    _SGTRACE_CAPTURE_READY,
+} _sgtrace_capture_state_t;
+
+// serialization state, either writes into a buffer, or reads from memory
+typedef struct {
+    bool reading;
+    _sgtrace_buf_t* buf;        // write target
+    const uint8_t* ptr;         // read position
+    const uint8_t* end;         // read end
+    bool error;                 // read past end or invalid data
+} _sgtrace_io_t;
+
+// a desc struct big enough for any resource type
+typedef union {
+    sg_buffer_desc buffer;
+    sg_image_desc image;
+    sg_sampler_desc sampler;
+    sg_shader_desc shader;
+    sg_pipeline_desc pipeline;
+    sg_attachments_desc attachments;
+    sg_bindgroup_desc bindgroup;
+    sg_command_list_desc command_list;
+} _sgtrace_desc_union_t;
+
+typedef struct {
+    uint32_t init_cookie;
+    sgtrace_desc_t desc;
+    sg_trace_hooks hooks;       // the previously installed trace hooks
+    _sgtrace_io_t io;
+    _sgtrace_buf_t scratch;     // serialized commands, copied into the capture and live resource table
+    struct {
+        _sgtrace_map_t map;     // (res_type, id) => index into items
+        int num;
+        int cap;
+        _sgtrace_live_t* items;
+        uint64_t seq;
+    } live;
+    struct {
+        _sgtrace_capture_state_t state;
+        int frames_left;
+        uint32_t num_frames;
+        _sgtrace_buf_t buf;
+    } capture;
+    struct {
+        bool active;
+        sgtrace_replay_desc_t desc;
+        uint8_t* data;
+        size_t size;
+        uint32_t prologue_size;
+        int num_frames;
+        int cur_frame;
+        size_t* frame_offsets;      // start offset of each frame in data
+        _sgtrace_map_t map;         // (res_type, captured id) => (ref_count << 32 | replay id)
+        _sgtrace_map_t frame_res;   // resources created by captured frames
+        _sgtrace_desc_union_t tmp_desc;
+        bool cmdlist_warned;
+    } replay;
+} _sgtrace_t;
+static _sgtrace_t _sgtrace;
+
+// ██       ██████   ██████   ██████  ██ ███    ██  ██████
+// ██      ██    ██ ██       ██       ██ ████   ██ ██
+// ██      ██    ██ ██   ███ ██   ███ ██ ██ ██  ██ ██   ███
+// ██      ██    ██ ██    ██ ██    ██ ██ ██  ██ ██ ██    ██
+// ███████  ██████   ██████   ██████  ██ ██   ████  ██████
+//
+// >>logging
+#if defined(SOKOL_DEBUG)
+#define _SGTRACE_LOGITEM_XMACRO(item,msg) #item ": " msg,
+static const char* _sgtrace_log_messages[] = {
+    _SGTRACE_LOG_ITEMS
+};
+#undef _SGTRACE_LOGITEM_XMACRO
+#endif // SOKOL_DEBUG
+
+#define _SGTRACE_PANIC(code) _sgtrace_log(SGTRACE_LOGITEM_ ##code, 0, __LINE__)
+#define _SGTRACE_ERROR(code) _sgtrace_log(SGTRACE_LOGITEM_ ##code, 1, __LINE__)
+#define _SGTRACE_WARN(code) _sgtrace_log(SGTRACE_LOGITEM_ ##code, 2, __LINE__)
+#define _SGTRACE_INFO(code) _sgtrace_log(SGTRACE_LOGITEM_ ##code, 3, __LINE__)
+
+// the replay has its own logger and allocator since it doesn't require sgtrace_setup()
+static const sgtrace_logger_t* _sgtrace_logger(void) {
+    return _sgtrace.replay.active ? &_sgtrace.replay.desc.logger : &_sgtrace.desc.logger;
+}
+
+static const sgtrace_allocator_t* _sgtrace_allocator(void) {
+    return _sgtrace.replay.active ? &_sgtrace.replay.desc.allocator : &_sgtrace.desc.allocator;
+}
+
+static void _sgtrace_log(sgtrace_log_item_t log_item, uint32_t log_level, uint32_t line_nr) {
+    const sgtrace_logger_t* logger = _sgtrace_logger();
+    if (logger->func) {
+        #if defined(SOKOL_DEBUG)
+            const char* filename = __FILE__;
+            const char* message = _sgtrace_log_messages[log_item];
+        #else
+            const char* filename = 0;
+            const char* message = 0;
+        #endif
+        logger->func("sgtrace", log_level, (uint32_t)log_item, message, line_nr, filename, logger->user_data);
+    } else {
+        // for log level PANIC it would be 'undefined behaviour' to continue
+        if (log_level == 0) {
+            abort();
+        }
+    }
+}
+
+// ███    ███ ███████ ███    ███  ██████  ██████  ██    ██
+// ████  ████ ██      ████  ████ ██    ██ ██   ██  ██  ██
+// ██ ████ ██ █████   ██ ████ ██ ██    ██ ██████    ████
+// ██  ██  ██ ██      ██  ██  ██ ██    ██ ██   ██    ██
+// ██      ██ ███████ ██      ██  ██████  ██   ██    ██
+//
+// >>memory
+static void _sgtrace_clear(void* ptr, size_t size) {
+    SOKOL_ASSERT(ptr && (size > 0));
+    memset(ptr, 0, size);
+}
+
+static void* _sgtrace_malloc(size_t size) {
+    SOKOL_ASSERT(size > 0);
+    const sgtrace_allocator_t* allocator = _sgtrace_allocator();
+    void* ptr;
+    if (allocator->alloc_fn) {
+        ptr = allocator->alloc_fn(size, allocator->user_data);
+    } else {
+        ptr = malloc(size);
+    }
+    if (0 == ptr) {
+        _SGTRACE_PANIC(MALLOC_FAILED);
+    }
+    return ptr;
+}
+
+static void* _sgtrace_malloc_clear(size_t size) {
+    void* ptr = _sgtrace_malloc(size);
+    _sgtrace_clear(ptr, size);
+    return ptr;
+}
+
+static void _sgtrace_free(void* ptr) {
+    const sgtrace_allocator_t* allocator = _sgtrace_allocator();
+    if (allocator->free_fn) {
+        allocator->free_fn(ptr, allocator->user_data);
+    } else {
+        free(ptr);
+    }
+}
+
+// ██████  ██    ██ ███████ ███████ ███████ ██████
+// ██   ██ ██    ██ ██      ██      ██      ██   ██
+// ██████  ██    ██ █████   █████   █████   ██████
+// ██   ██ ██    ██ ██      ██      ██      ██   ██
+// ██████   ██████  ██      ██      ███████ ██   ██
+//
+// >>buffer
+static void _sgtrace_buf_discard(_sgtrace_buf_t* buf) {
+    SOKOL_ASSERT(buf);
+    if (buf->ptr) {
+        _sgtrace_free(buf->ptr);
+    }
+    _sgtrace_clear(buf, sizeof(_sgtrace_buf_t));
+}
+
+static void _sgtrace_buf_reset(_sgtrace_buf_t* buf) {
+    SOKOL_ASSERT(buf);
+    buf->size = 0;
+    buf->overflow = false;
+}
+
+// make room for num_bytes, returns null on overflow
+static uint8_t* _sgtrace_buf_grow(_sgtrace_buf_t* buf, size_t num_bytes) {
+    SOKOL_ASSERT(buf);
+    if (buf->overflow) {
+        return 0;
+    }
+    const size_t new_size = buf->size + num_bytes;
+    if ((buf->max_size > 0) && (new_size > buf->max_size)) {
+        buf->overflow = true;
+        return 0;
+    }
+    if (new_size > buf->cap) {
+        size_t new_cap = (buf->cap > 0) ? (buf->cap * 2) : 4096;
+        while (new_cap < new_size) {
+            new_cap *= 2;
+        }
+        if ((buf->max_size > 0) && (new_cap > buf->max_size)) {
+            new_cap = buf->max_size;
+        }
+        uint8_t* new_ptr = (uint8_t*) _sgtrace_malloc(new_cap);
+        if (buf->ptr) {
+            memcpy(new_ptr, buf->ptr, buf->size);
+            _sgtrace_free(buf->ptr);
+        }
+        buf->ptr = new_ptr;
+        buf->cap = new_cap;
+    }
+    uint8_t* dst = buf->ptr + buf->size;
+    buf->size = new_size;
+    return dst;
+}
+
+static void _sgtrace_buf_append(_sgtrace_buf_t* buf, const void* data, size_t num_bytes) {
+    if (num_bytes > 0) {
+        uint8_t* dst = _sgtrace_buf_grow(buf, num_bytes);
+        if (dst) {
+            memcpy(dst, data, num_bytes);
+        }
+    }
+}
+
+// ███    ███  █████  ██████
+// ████  ████ ██   ██ ██   ██
+// ██ ████ ██ ███████ ██████
+// ██  ██  ██ ██   ██ ██
+// ██      ██ ██   ██ ██
+//
+// >>map
+static uint64_t _sgtrace_key(_sgtrace_res_t res_type, uint32_t id) {
+    return (((uint64_t)res_type) << 32) | id;
+}
+
+static uint32_t _sgtrace_map_slot(const _sgtrace_map_t* map, uint64_t key) {
+    // a 64-bit integer hash (splitmix64 finalizer)
+    key ^= key >> 30; key *= 0xBF58476D1CE4E5B9ULL;
+    key ^= key >> 27; key *= 0x94D049BB133111EBULL;
+    key ^= key >> 31;
+    return (uint32_t)key & (map->cap - 1);
+}
+
+static void _sgtrace_map_discard(_sgtrace_map_t* map) {
+    SOKOL_ASSERT(map);
+    if (map->keys) {
+        _sgtrace_free(map->keys);
+        _sgtrace_free(map->values);
+    }
+    _sgtrace_clear(map, sizeof(_sgtrace_map_t));
+}
+
+static uint64_t* _sgtrace_map_find(const _sgtrace_map_t* map, uint64_t key) {
+    SOKOL_ASSERT(map && (key != 0));
+    if (0 == map->num) {
+        return 0;
+    }
+    uint32_t slot = _sgtrace_map_slot(map, key);
+    while (map->keys[slot] != 0) {
+        if (map->keys[slot] == key) {
+            return &map->values[slot];
+        }
+        slot = (slot + 1) & (map->cap - 1);
+    }
+    return 0;
+}
+
+static void _sgtrace_map_set(_sgtrace_map_t* map, uint64_t key, uint64_t value);
+
+static void _sgtrace_map_rehash(_sgtrace_map_t* map, uint32_t new_cap) {
+    _sgtrace_map_t old_map = *map;
+    map->cap = new_cap;
+    map->num = 0;
+    map->keys = (uint64_t*) _sgtrace_malloc_clear(new_cap * sizeof(uint64_t));
+    map->values = (uint64_t*) _sgtrace_malloc_clear(new_cap * sizeof(uint64_t));
+    for (uint32_t i = 0; i < old_map.cap; i++) {
+        if (old_map.keys[i] != 0) {
+            _sgtrace_map_set(map, old_map.keys[i], old_map.values[i]);
+        }
+    }
+    if (old_map.keys) {
+        _sgtrace_free(old_map.keys);
+        _sgtrace_free(old_map.values);
+    }
+}
+
+static void _sgtrace_map_set(_sgtrace_map_t* map, uint64_t key, uint64_t value) {
+    SOKOL_ASSERT(map && (key != 0));
+    // keep the load factor below 50%
+    if ((map->num + 1) * 2 > map->cap) {
+        _sgtrace_map_rehash(map, (map->cap > 0) ? (map->cap * 2) : 256);
+    }
+    uint32_t slot = _sgtrace_map_slot(map, key);
+    while ((map->keys[slot] != 0) && (map->keys[slot] != key)) {
+        slot = (slot + 1) & (map->cap - 1);
+    }
+    if (map->keys[slot] == 0) {
+        map->keys[slot] = key;
+        map->num++;
+    }
+    map->values[slot] = value;
+}
+
+// remove a key with backward-shift deletion (no tombstones needed)
+static void _sgtrace_map_remove(_sgtrace_map_t* map, uint64_t key) {
+    SOKOL_ASSERT(map && (key != 0));
+    if (0 == map->num) {
+        return;
+    }
+    const uint32_t mask = map->cap - 1;
+    uint32_t slot = _sgtrace_map_slot(map, key);
+    while (map->keys[slot] != key) {
+        if (map->keys[slot] == 0) {
+            return;
+        }
+        slot = (slot + 1) & mask;
+    }
+    uint32_t next = (slot + 1) & mask;
+    while (map->keys[next] != 0) {
+        const uint32_t home = _sgtrace_map_slot(map, map->keys[next]);
+        // move the item at 'next' into the hole if its home slot isn't between the hole and 'next'
+        if (((next - home) & mask) >= ((next - slot) & mask)) {
+            map->keys[slot] = map->keys[next];
+            map->values[slot] = map->values[next];
+            slot = next;
+        }
+        next = (next + 1) & mask;
+    }
+    map->keys[slot] = 0;
+    map->values[slot] = 0;
+    map->num--;
+}
+
+// ███████ ███████ ██████  ██  █████  ██      ██ ███████ ███████
+// ██      ██      ██   ██ ██ ██   ██ ██      ██    ███  ██
+// ███████ █████   ██████  ██ ███████ ██      ██   ███   █████
+//      ██ ██      ██   ██ ██ ██   ██ ██      ██  ███    ██
+// ███████ ███████ ██   ██ ██ ██   ██ ███████ ██ ███████ ███████
+//
+// >>serialize
+static void _sgtrace_begin_write(_sgtrace_buf_t* buf) {
+    _sgtrace.io.reading = false;
+    _sgtrace.io.buf = buf;
+    _sgtrace.io.error = false;
+}
+
+static void _sgtrace_begin_read(const uint8_t* ptr, size_t size) {
+    _sgtrace.io.reading = true;
+    _sgtrace.io.buf = 0;
+    _sgtrace.io.ptr = ptr;
+    _sgtrace.io.end = ptr + size;
+    _sgtrace.io.error = false;
+}
+
+// read num_bytes, returns a pointer into the read data, or null on error
+static const uint8_t* _sgtrace_read(size_t num_bytes) {
+    if (_sgtrace.io.error || ((size_t)(_sgtrace.io.end - _sgtrace.io.ptr) < num_bytes)) {
+        _sgtrace.io.error = true;
+        return 0;
+    }
+    const uint8_t* ptr = _sgtrace.io.ptr;
+    _sgtrace.io.ptr += num_bytes;
+    return ptr;
+}
+
+// serialize plain bytes
+static void _sgtrace_ser_bytes(void* ptr, size_t num_bytes) {
+    if (_sgtrace.io.reading) {
+        const uint8_t* src = _sgtrace_read(num_bytes);
+        if (src) {
+            memcpy(ptr, src, num_bytes);
+        } else {
+            memset(ptr, 0, num_bytes);
+        }
+    } else {
+        _sgtrace_buf_append(_sgtrace.io.buf, ptr, num_bytes);
+    }
+}
+
+static void _sgtrace_ser_u32(uint32_t* val) {
+    _sgtrace_ser_bytes(val, sizeof(uint32_t));
+}
+
+static void _sgtrace_ser_int(int* val) {
+    _sgtrace_ser_bytes(val, sizeof(int));
+}
+
+static void _sgtrace_ser_bool(bool* val) {
+    uint8_t b = *val ? 1 : 0;
+    _sgtrace_ser_bytes(&b, 1);
+    *val = (b != 0);
+}
+
+/* serialize a struct as zero-run-length-encoded bytes, this is a sequence
+   of (uint16_t num_zeros, uint16_t num_literals, uint8_t literals[num_literals])
+   tokens, which is very effective on the mostly zero-initialized desc structs
+*/
+static void _sgtrace_ser_struct(void* ptr, size_t size) {
+    uint8_t* bytes = (uint8_t*) ptr;
+    size_t pos = 0;
+    if (_sgtrace.io.reading) {
+        memset(ptr, 0, size);
+        while (pos < size) {
+            uint16_t tok[2];
+            const uint8_t* src = _sgtrace_read(sizeof(tok));
+            if (0 == src) {
+                return;
+            }
+            memcpy(tok, src, sizeof(tok));
+            if (((size - pos) < tok[0]) || ((size - pos - tok[0]) < tok[1]) || ((tok[0] + tok[1]) == 0)) {
+                _sgtrace.io.error = true;
+                return;
+            }
+            pos += tok[0];
+            src = _sgtrace_read(tok[1]);
+            if (0 == src) {
+                return;
+            }
+            memcpy(bytes + pos, src, tok[1]);
+            pos += tok[1];
+        }
+    } else {
+        while (pos < size) {
+            size_t num_zeros = 0;
+            while (((pos + num_zeros) < size) && (bytes[pos + num_zeros] == 0) && (num_zeros < 0xFFFF)) {
+                num_zeros++;
+            }
+            const size_t lit_start = pos + num_zeros;
+            size_t num_lits = 0;
+            while (((lit_start + num_lits) < size) && (num_lits < 0xFFFF)) {
+                // end the literal run at a run of at least 4 zero bytes
+                const size_t i = lit_start + num_lits;
+                if ((bytes[i] == 0) && ((i + 3) < size) && (bytes[i+1] == 0) && (bytes[i+2] == 0) && (bytes[i+3] == 0)) {
+                    break;
+                }
+                num_lits++;
+            }
+            const uint16_t tok[2] = { (uint16_t)num_zeros, (uint16_t)num_lits };
+            _sgtrace_buf_append(_sgtrace.io.buf, tok, sizeof(tok));
+            _sgtrace_buf_append(_sgtrace.io.buf, bytes + lit_start, num_lits);
+            pos = lit_start + num_lits;
+        }
+    }
+}
+
+// serialize a blob of memory, when reading, the pointer will point into the read data
+static void _sgtrace_ser_blob(const void** ptr, size_t* size) {
+    if (_sgtrace.io.reading) {
+        uint32_t num_bytes = 0;
+        _sgtrace_ser_u32(&num_bytes);
+        const uint8_t* src = _sgtrace_read(num_bytes);
+        *ptr = (src && (num_bytes > 0)) ? src : 0;
+        *size = src ? num_bytes : 0;
+    } else {
+        uint32_t num_bytes = (*ptr) ? (uint32_t)*size : 0;
+        _sgtrace_ser_u32(&num_bytes);
+        _sgtrace_buf_append(_sgtrace.io.buf, *ptr, num_bytes);
+    }
+}
+
+static void _sgtrace_ser_range(sg_range* range) {
+    _sgtrace_ser_blob(&range->ptr, &range->size);
+}
+
+static void _sgtrace_ser_str(const char** str) {
+    const void* ptr = *str;
+    size_t size = ptr ? (strlen(*str) + 1) : 0;
+    _sgtrace_ser_blob(&ptr, &size);
+    if (_sgtrace.io.reading) {
+        // must be zero-terminated
+        if (ptr && (((const char*)ptr)[size - 1] != 0)) {
+            _sgtrace.io.error = true;
+            ptr = 0;
+        }
+        *str = (const char*) ptr;
+    }
+}
+
+// when reading, map captured resource ids to replay resource ids
+static void _sgtrace_ser_id(_sgtrace_res_t res_type, uint32_t* id) {
+    if (_sgtrace.io.reading && (*id != SG_INVALID_ID)) {
+        const uint64_t* val = _sgtrace_map_find(&_sgtrace.replay.map, _sgtrace_key(res_type, *id));
+        *id = val ? (uint32_t)*val : (uint32_t)SG_INVALID_ID;
+    }
+}
+
+static void _sgtrace_ser_buffer_desc(sg_buffer_desc* desc) {
+    _sgtrace_ser_struct(desc, sizeof(sg_buffer_desc));
+    _sgtrace_ser_range(&desc->data);
+    _sgtrace_ser_str(&desc->label);
+}
+
+static void _sgtrace_ser_image_data(sg_image_data* data) {
+    _sgtrace_ser_struct(data, sizeof(sg_image_data));
+    for (int face = 0; face < SG_CUBEFACE_NUM; face++) {
+        for (int mip = 0; mip < SG_MAX_MIPMAPS; mip++) {
+            _sgtrace_ser_range(&data->subimage[face][mip]);
+        }
+    }
+}
+
+static void _sgtrace_ser_image_desc(sg_image_desc* desc) {
+    _sgtrace_ser_struct(desc, sizeof(sg_image_desc));
+    for (int face = 0; face < SG_CUBEFACE_NUM; face++) {
+        for (int mip = 0; mip < SG_MAX_MIPMAPS; mip++) {
+            _sgtrace_ser_range(&desc->data.subimage[face][mip]);
+        }
+    }
+    _sgtrace_ser_str(&desc->label);
+}
+
+static void _sgtrace_ser_sampler_desc(sg_sampler_desc* desc) {
+    _sgtrace_ser_struct(desc, sizeof(sg_sampler_desc));
+    _sgtrace_ser_str(&desc->label);
+}
+
+static void _sgtrace_ser_shader_func(sg_shader_function* func) {
+    _sgtrace_ser_str(&func->source);
+    _sgtrace_ser_range(&func->bytecode);
+    _sgtrace_ser_str(&func->entry);
+    _sgtrace_ser_str(&func->d3d11_target);
+    _sgtrace_ser_str(&func->d3d11_filepath);
+}
+
+static void _sgtrace_ser_shader_desc(sg_shader_desc* desc) {
+    _sgtrace_ser_struct(desc, sizeof(sg_shader_desc));
+    _sgtrace_ser_shader_func(&desc->vertex_func);
+    _sgtrace_ser_shader_func(&desc->fragment_func);
+    _sgtrace_ser_shader_func(&desc->compute_func);
+    for (int i = 0; i < SG_MAX_VERTEX_ATTRIBUTES; i++) {
+        _sgtrace_ser_str(&desc->attrs[i].glsl_name);
+        _sgtrace_ser_str(&desc->attrs[i].hlsl_sem_name);
+    }
+    for (int i = 0; i < SG_MAX_UNIFORMBLOCK_BINDSLOTS; i++) {
+        for (int j = 0; j < SG_MAX_UNIFORMBLOCK_MEMBERS; j++) {
+            _sgtrace_ser_str(&desc->uniform_blocks[i].glsl_uniforms[j].glsl_name);
+        }
+    }
+    for (int i = 0; i < SG_MAX_IMAGE_SAMPLER_PAIRS; i++) {
+        _sgtrace_ser_str(&desc->image_sampler_pairs[i].glsl_name);
+    }
+    _sgtrace_ser_str(&desc->label);
+}
+
+static void _sgtrace_ser_pipeline_desc(sg_pipeline_desc* desc) {
+    _sgtrace_ser_struct(desc, sizeof(sg_pipeline_desc));
+    _sgtrace_ser_id(_SGTRACE_RES_SHADER, &desc->shader.id);
+    _sgtrace_ser_str(&desc->label);
+}
+
+static void _sgtrace_ser_attachments_desc(sg_attachments_desc* desc) {
+    _sgtrace_ser_struct(desc, sizeof(sg_attachments_desc));
+    for (int i = 0; i < SG_MAX_COLOR_ATTACHMENTS; i++) {
+        _sgtrace_ser_id(_SGTRACE_RES_IMAGE, &desc->colors[i].image.id);
+        _sgtrace_ser_id(_SGTRACE_RES_IMAGE, &desc->resolves[i].image.id);
+    }
+    _sgtrace_ser_id(_SGTRACE_RES_IMAGE, &desc->depth_stencil.image.id);
+    for (int i = 0; i < SG_MAX_STORAGE_ATTACHMENTS; i++) {
+        _sgtrace_ser_id(_SGTRACE_RES_IMAGE, &desc->storages[i].image.id);
+    }
+    _sgtrace_ser_str(&desc->label);
+}
+
+static void _sgtrace_ser_bindings_ids(sg_bindings* bnd) {
+    for (int i = 0; i < SG_MAX_VERTEXBUFFER_BINDSLOTS; i++) {
+        _sgtrace_ser_id(_SGTRACE_RES_BUFFER, &bnd->vertex_buffers[i].id);
+    }
+    _sgtrace_ser_id(_SGTRACE_RES_BUFFER, &bnd->index_buffer.id);
+    for (int i = 0; i < SG_MAX_IMAGE_BINDSLOTS; i++) {
+        _sgtrace_ser_id(_SGTRACE_RES_IMAGE, &bnd->images[i].id);
+    }
+    for (int i = 0; i < SG_MAX_SAMPLER_BINDSLOTS; i++) {
+        _sgtrace_ser_id(_SGTRACE_RES_SAMPLER, &bnd->samplers[i].id);
+    }
+    for (int i = 0; i < SG_MAX_STORAGEBUFFER_BINDSLOTS; i++) {
+        _sgtrace_ser_id(_SGTRACE_RES_BUFFER, &bnd->storage_buffers[i].id);
+    }
+}
+
+static void _sgtrace_ser_bindings(sg_bindings* bnd) {
+    _sgtrace_ser_struct(bnd, sizeof(sg_bindings));
+    _sgtrace_ser_bindings_ids(bnd);
+}
+
+static void _sgtrace_ser_bindgroup_desc(sg_bindgroup_desc* desc) {
+    _sgtrace_ser_struct(desc, sizeof(sg_bindgroup_desc));
+    _sgtrace_ser_id(_SGTRACE_RES_PIPELINE, &desc->pipeline.id);
+    _sgtrace_ser_bindings_ids(&desc->bindings);
+    _sgtrace_ser_str(&desc->label);
+}
+
+static void _sgtrace_ser_command_list_desc(sg_command_list_desc* desc) {
+    _sgtrace_ser_struct(desc, sizeof(sg_command_list_desc));
+    _sgtrace_ser_str(&desc->label);
+}
+
+static void _sgtrace_ser_pass(sg_pass* pass) {
+    _sgtrace_ser_struct(pass, sizeof(sg_pass));
+    _sgtrace_ser_id(_SGTRACE_RES_ATTACHMENTS, &pass->attachments.id);
+    _sgtrace_ser_str(&pass->label);
+}
+
+static void _sgtrace_ser_desc(_sgtrace_res_t res_type, void* desc) {
+    switch (res_type) {
+        case _SGTRACE_RES_BUFFER: _sgtrace_ser_buffer_desc((sg_buffer_desc*)desc); break;
+        case _SGTRACE_RES_IMAGE: _sgtrace_ser_image_desc((sg_image_desc*)desc); break;
+        case _SGTRACE_RES_SAMPLER: _sgtrace_ser_sampler_desc((sg_sampler_desc*)desc); break;
+        case _SGTRACE_RES_SHADER: _sgtrace_ser_shader_desc((sg_shader_desc*)desc); break;
+        case _SGTRACE_RES_PIPELINE: _sgtrace_ser_pipeline_desc((sg_pipeline_desc*)desc); break;
+        case _SGTRACE_RES_ATTACHMENTS: _sgtrace_ser_attachments_desc((sg_attachments_desc*)desc); break;
+        case _SGTRACE_RES_BINDGROUP: _sgtrace_ser_bindgroup_desc((sg_bindgroup_desc*)desc); break;
+        case _SGTRACE_RES_COMMAND_LIST: _sgtrace_ser_command_list_desc((sg_command_list_desc*)desc); break;
+        default: _sgtrace.io.error = true; break;
+    }
+}
+
+static void _sgtrace_abi(uint32_t* abi) {
+    abi[_SGTRACE_ABI_POINTER] = (uint32_t) sizeof(void*);
+    abi[_SGTRACE_ABI_BUFFER_DESC] = (uint32_t) sizeof(sg_buffer_desc);
+    abi[_SGTRACE_ABI_IMAGE_DESC] = (uint32_t) sizeof(sg_image_desc);
+    abi[_SGTRACE_ABI_SAMPLER_DESC] = (uint32_t) sizeof(sg_sampler_desc);
+    abi[_SGTRACE_ABI_SHADER_DESC] = (uint32_t) sizeof(sg_shader_desc);
+    abi[_SGTRACE_ABI_PIPELINE_DESC] = (uint32_t) sizeof(sg_pipeline_desc);
+    abi[_SGTRACE_ABI_ATTACHMENTS_DESC] = (uint32_t) sizeof(sg_attachments_desc);
+    abi[_SGTRACE_ABI_BINDGROUP_DESC] = (uint32_t) sizeof(sg_bindgroup_desc);
+    abi[_SGTRACE_ABI_COMMAND_LIST_DESC] = (uint32_t) sizeof(sg_command_list_desc);
+    abi[_SGTRACE_ABI_BINDINGS] = (uint32_t) sizeof(sg_bindings);
+    abi[_SGTRACE_ABI_PASS] = (uint32_t) sizeof(sg_pass);
+    abi[_SGTRACE_ABI_IMAGE_DATA] = (uint32_t) sizeof(sg_image_data);
+    abi[_SGTRACE_ABI_IMAGE_REGION] = (uint32_t) sizeof(sg_image_region);
+}
+
+//  ██████  █████  ██████  ████████ ██    ██ ██████  ███████
+// ██      ██   ██ ██   ██    ██    ██    ██ ██   ██ ██
+// ██      ███████ ██████     ██    ██    ██ ██████  █████
+// ██      ██   ██ ██         ██    ██    ██ ██   ██ ██
+//  ██████ ██   ██ ██         ██     ██████  ██   ██ ███████
+//
+// >>capture
+
+// start a new command in the scratch buffer
+static void _sgtrace_begin_cmd(_sgtrace_cmd_t cmd) {
+    _sgtrace_buf_reset(&_sgtrace.scratch);
+    _sgtrace_begin_write(&_sgtrace.scratch);
+    uint32_t header[2] = { (uint32_t)cmd, 0 };
+    _sgtrace_buf_append(&_sgtrace.scratch, header, sizeof(header));
+}
+
+// patch the payload size of the command in the scratch buffer
+static void _sgtrace_patch_cmd_size(void) {
+    _sgtrace_buf_t* scratch = &_sgtrace.scratch;
+    SOKOL_ASSERT(scratch->size >= (2 * sizeof(uint32_t)));
+    const uint32_t payload_size = (uint32_t)(scratch->size - (2 * sizeof(uint32_t)));
+    memcpy(scratch->ptr + sizeof(uint32_t), &payload_size, sizeof(uint32_t));
+}
+
+// copy the finished command into the capture
+static void _sgtrace_end_cmd(void) {
+    _sgtrace_buf_t* scratch = &_sgtrace.scratch;
+    _sgtrace_patch_cmd_size();
+    if (_sgtrace.capture.state == _SGTRACE_CAPTURE_ACTIVE) {
+        _sgtrace_buf_append(&_sgtrace.capture.buf, scratch->ptr, scratch->size);
+    }
+}
+
+static bool _sgtrace_capturing(void) {
+    return (_sgtrace.capture.state == _SGTRACE_CAPTURE_ACTIVE) && !_sgtrace.replay.active;
+}
+
+static void _sgtrace_live_add(_sgtrace_res_t res_type, uint32_t id) {
+    const uint64_t key = _sgtrace_key(res_type, id);
+    const uint64_t* index = _sgtrace_map_find(&_sgtrace.live.map, key);
+    if (index) {
+        // sokol_gfx.h returned an existing resource (e.g. a deduplicated pipeline)
+        _sgtrace.live.items[*index].ref_count++;
+        return;
+    }
+    if (_sgtrace.live.num == _sgtrace.live.cap) {
+        const int new_cap = (_sgtrace.live.cap > 0) ? (_sgtrace.live.cap * 2) : 256;
+        _sgtrace_live_t* new_items = (_sgtrace_live_t*) _sgtrace_malloc_clear((size_t)new_cap * sizeof(_sgtrace_live_t));
+        if (_sgtrace.live.items) {
+            memcpy(new_items, _sgtrace.live.items, (size_t)_sgtrace.live.num * sizeof(_sgtrace_live_t));
+            _sgtrace_free(_sgtrace.live.items);
+        }
+        _sgtrace.live.items = new_items;
+        _sgtrace.live.cap = new_cap;
+    }
+    const int item_index = _sgtrace.live.num++;
+    _sgtrace_live_t* item = &_sgtrace.live.items[item_index];
+    item->seq = _sgtrace.live.seq++;
+    item->ref_count = 1;
+    item->cmd_size = (uint32_t)_sgtrace.scratch.size;
+    item->cmd = (uint8_t*) _sgtrace_malloc(_sgtrace.scratch.size);
+    memcpy(item->cmd, _sgtrace.scratch.ptr, _sgtrace.scratch.size);
+    _sgtrace_map_set(&_sgtrace.live.map, key, (uint64_t)item_index);
+}
+
+static void _sgtrace_live_remove(_sgtrace_res_t res_type, uint32_t id) {
+    const uint64_t key = _sgtrace_key(res_type, id);
+    const uint64_t* index_ptr = _sgtrace_map_find(&_sgtrace.live.map, key);
+    if (0 == index_ptr) {
+        return;
+    }
+    const int index = (int)*index_ptr;
+    _sgtrace_live_t* item = &_sgtrace.live.items[index];
+    SOKOL_ASSERT(item->ref_count > 0);
+    if (--item->ref_count > 0) {
+        return;
+    }
+    _sgtrace_free(item->cmd);
+    _sgtrace_map_remove(&_sgtrace.live.map, key);
+    // move the last item into the hole, the prologue is sorted by creation order anyway
+    const int last_index = _sgtrace.live.num - 1;
+    if (index != last_index) {
+        *item = _sgtrace.live.items[last_index];
+        uint32_t last_cmd[4];
+        memcpy(last_cmd, item->cmd, sizeof(last_cmd));
+        // the moved item's key is in its MAKE command: (cmd, size, res_type, id)
+        _sgtrace_map_set(&_sgtrace.live.map, _sgtrace_key((_sgtrace_res_t)last_cmd[2], last_cmd[3]), (uint64_t)index);
+    }
+    _sgtrace.live.num--;
+}
+
+static void _sgtrace_live_discard(void) {
+    for (int i = 0; i < _sgtrace.live.num; i++) {
+        _sgtrace_free(_sgtrace.live.items[i].cmd);
+    }
+    if (_sgtrace.live.items) {
+        _sgtrace_free(_sgtrace.live.items);
+    }
+    _sgtrace_map_discard(&_sgtrace.live.map);
+    _sgtrace_clear(&_sgtrace.live, sizeof(_sgtrace.live));
+}
+
+static int _sgtrace_cmp_live(const void* a, const void* b) {
+    const uint64_t seq_a = (*(const _sgtrace_live_t* const*)a)->seq;
+    const uint64_t seq_b = (*(const _sgtrace_live_t* const*)b)->seq;
+    return (seq_a < seq_b) ? -1 : ((seq_a > seq_b) ? 1 : 0);
+}
+
+// start the capture with a header and the creation commands of all live resources
+static void _sgtrace_start_capture(void) {
+    _sgtrace_buf_t* buf = &_sgtrace.capture.buf;
+    _sgtrace_buf_reset(buf);
+    _sgtrace_header_t header;
+    _sgtrace_clear(&header, sizeof(header));
+    header.magic = _SGTRACE_MAGIC;
+    header.version = _SGTRACE_VERSION;
+    _sgtrace_abi(header.abi);
+    _sgtrace_buf_append(buf, &header, sizeof(header));
+    if (_sgtrace.live.num > 0) {
+        _sgtrace_live_t** sorted = (_sgtrace_live_t**) _sgtrace_malloc((size_t)_sgtrace.live.num * sizeof(_sgtrace_live_t*));
+        for (int i = 0; i < _sgtrace.live.num; i++) {
+            sorted[i] = &_sgtrace.live.items[i];
+        }
+        qsort(sorted, (size_t)_sgtrace.live.num, sizeof(_sgtrace_live_t*), _sgtrace_cmp_live);
+        for (int i = 0; i < _sgtrace.live.num; i++) {
+            _sgtrace_buf_append(buf, sorted[i]->cmd, sorted[i]->cmd_size);
+            // the MAKE command is followed by the reference count (> 1 for deduplicated
+            // resources), so that the replay only destroys the resource with its last DESTROY
+            uint32_t make_cmd[4];
+            memcpy(make_cmd, sorted[i]->cmd, sizeof(make_cmd));
+            const uint32_t ref_count_cmd[5] = {
+                (uint32_t)_SGTRACE_CMD_REF_COUNT, 3 * sizeof(uint32_t), make_cmd[2], make_cmd[3], sorted[i]->ref_count
+            };
+            _sgtrace_buf_append(buf, ref_count_cmd, sizeof(ref_count_cmd));
+        }
+        _sgtrace_free(sorted);
+    }
+    if (!buf->overflow) {
+        const uint32_t prologue_size = (uint32_t)(buf->size - sizeof(_sgtrace_header_t));
+        memcpy(buf->ptr + offsetof(_sgtrace_header_t, prologue_size), &prologue_size, sizeof(uint32_t));
+    }
+    _sgtrace.capture.state = _SGTRACE_CAPTURE_ACTIVE;
+    _sgtrace.capture.num_frames = 0;
+}
+
+static void _sgtrace_finish_capture(void) {
+    _sgtrace_buf_t* buf = &_sgtrace.capture.buf;
+    SOKOL_ASSERT(!buf->overflow);
+    memcpy(buf->ptr + offsetof(_sgtrace_header_t, num_frames), &_sgtrace.capture.num_frames, sizeof(uint32_t));
+    _sgtrace.capture.state = _SGTRACE_CAPTURE_READY;
+}
+
+static void _sgtrace_cancel_capture_on_overflow(void) {
+    if (_sgtrace.capture.buf.overflow && (_sgtrace.capture.state == _SGTRACE_CAPTURE_ACTIVE)) {
+        _SGTRACE_ERROR(CAPTURE_BUFFER_FULL);
+        _sgtrace_buf_reset(&_sgtrace.capture.buf);
+        _sgtrace.capture.state = _SGTRACE_CAPTURE_IDLE;
+    }
+}
+
+// serialize a MAKE or INIT command, and keep the creation parameters of the live resource
+static void _sgtrace_rec_make(_sgtrace_cmd_t cmd, _sgtrace_res_t res_type, uint32_t id, void* desc) {
+    if (_sgtrace.replay.active || (SG_INVALID_ID == id)) {
+        return;
+    }
+    uint32_t res_type_u32 = (uint32_t)res_type;
+    _sgtrace_begin_cmd(_SGTRACE_CMD_MAKE);
+    _sgtrace_ser_u32(&res_type_u32);
+    _sgtrace_ser_u32(&id);
+    _sgtrace_ser_desc(res_type, desc);
+    _sgtrace_patch_cmd_size();
+    _sgtrace_live_add(res_type, id);
+    if (cmd == _SGTRACE_CMD_INIT) {
+        // patch the command type, the live resource keeps a MAKE command for the prologue
+        const uint32_t init_cmd = (uint32_t)_SGTRACE_CMD_INIT;
+        memcpy(_sgtrace.scratch.ptr, &init_cmd, sizeof(uint32_t));
+    }
+    _sgtrace_end_cmd();
+}
+
+static void _sgtrace_rec_res(_sgtrace_cmd_t cmd, _sgtrace_res_t res_type, uint32_t id) {
+    if (_sgtrace.replay.active) {
+        return;
+    }
+    if ((cmd == _SGTRACE_CMD_DESTROY) || (cmd == _SGTRACE_CMD_UNINIT)) {
+        _sgtrace_live_remove(res_type, id);
+    }
+    if (_sgtrace_capturing()) {
+        uint32_t res_type_u32 = (uint32_t)res_type;
+        _sgtrace_begin_cmd(cmd);
+        _sgtrace_ser_u32(&res_type_u32);
+        _sgtrace_ser_u32(&id);
+        _sgtrace_end_cmd();
+    }
+}
+
+// ██   ██  ██████   ██████  ██   ██ ███████
+// ██   ██ ██    ██ ██    ██ ██  ██  ██
+// ███████ ██    ██ ██    ██ █████   ███████
+// ██   ██ ██    ██ ██    ██ ██  ██       ██
+// ██   ██  ██████   ██████  ██   ██ ███████
+//
+// >>hooks
+
+// injected native objects can't be captured
+static void _sgtrace_strip_buffer_desc(sg_buffer_desc* desc) {
+    for (int i = 0; i < SG_NUM_INFLIGHT_FRAMES; i++) {
+        desc->gl_buffers[i] = 0;
+        desc->mtl_buffers[i] = 0;
+    }
+    desc->d3d11_buffer = 0;
+    desc->wgpu_buffer = 0;
+}
+
+static void _sgtrace_strip_image_desc(sg_image_desc* desc) {
+    for (int i = 0; i < SG_NUM_INFLIGHT_FRAMES; i++) {
+        desc->gl_textures[i] = 0;
+        desc->mtl_textures[i] = 0;
+    }
+    desc->gl_texture_target = 0;
+    desc->d3d11_texture = 0;
+    desc->d3d11_shader_resource_view = 0;
+    desc->wgpu_texture = 0;
+    desc->wgpu_texture_view = 0;
+}
+
+static void _sgtrace_strip_sampler_desc(sg_sampler_desc* desc) {
+    desc->gl_sampler = 0;
+    desc->mtl_sampler = 0;
+    desc->d3d11_sampler = 0;
+    desc->wgpu_sampler = 0;
+}
+
+static void _sgtrace_make_buffer(const sg_buffer_desc* desc, sg_buffer result, void* user_data) {
+    sg_buffer_desc desc_copy = *desc;
+    _sgtrace_strip_buffer_desc(&desc_copy);
+    _sgtrace_rec_make(_SGTRACE_CMD_MAKE, _SGTRACE_RES_BUFFER, result.id, &desc_copy);
+    if (_sgtrace.hooks.make_buffer) {
+        _sgtrace.hooks.make_buffer(desc, result, user_data);
+    }
+}
+
+static void _sgtrace_make_image(const sg_image_desc* desc, sg_image result, void* user_data) {
+    sg_image_desc desc_copy = *desc;
+    _sgtrace_strip_image_desc(&desc_copy);
+    _sgtrace_rec_make(_SGTRACE_CMD_MAKE, _SGTRACE_RES_IMAGE, result.id, &desc_copy);
+    if (_sgtrace.hooks.make_image) {
+        _sgtrace.hooks.make_image(desc, result, user_data);
+    }
+}
+
+static void _sgtrace_make_sampler(const sg_sampler_desc* desc, sg_sampler result, void* user_data) {
+    sg_sampler_desc desc_copy = *desc;
+    _sgtrace_strip_sampler_desc(&desc_copy);
+    _sgtrace_rec_make(_SGTRACE_CMD_MAKE, _SGTRACE_RES_SAMPLER, result.id, &desc_copy);
+    if (_sgtrace.hooks.make_sampler) {
+        _sgtrace.hooks.make_sampler(desc, result, user_data);
+    }
+}
+
+static void _sgtrace_make_shader(const sg_shader_desc* desc, sg_shader result, void* user_data) {
+    sg_shader_desc desc_copy = *desc;
+    _sgtrace_rec_make(_SGTRACE_CMD_MAKE, _SGTRACE_RES_SHADER, result.id, &desc_copy);
+    if (_sgtrace.hooks.make_shader) {
+        _sgtrace.hooks.make_shader(desc, result, user_data);
+    }
+}
+
+static void _sgtrace_make_pipeline(const sg_pipeline_desc* desc, sg_pipeline result, void* user_data) {
+    sg_pipeline_desc desc_copy = *desc;
+    _sgtrace_rec_make(_SGTRACE_CMD_MAKE, _SGTRACE_RES_PIPELINE, result.id, &desc_copy);
+    if (_sgtrace.hooks.make_pipeline) {
+        _sgtrace.hooks.make_pipeline(desc, result, user_data);
+    }
+}
+
+static void _sgtrace_make_attachments(const sg_attachments_desc* desc, sg_attachments result, void* user_data) {
+    sg_attachments_desc desc_copy = *desc;
+    _sgtrace_rec_make(_SGTRACE_CMD_MAKE, _SGTRACE_RES_ATTACHMENTS, result.id, &desc_copy);
+    if (_sgtrace.hooks.make_attachments) {
+        _sgtrace.hooks.make_attachments(desc, result, user_data);
+    }
+}
+
+static void _sgtrace_make_bindgroup(const sg_bindgroup_desc* desc, sg_bindgroup result, void* user_data) {
+    sg_bindgroup_desc desc_copy = *desc;
+    _sgtrace_rec_make(_SGTRACE_CMD_MAKE, _SGTRACE_RES_BINDGROUP, result.id, &desc_copy);
+    if (_sgtrace.hooks.make_bindgroup) {
+        _sgtrace.hooks.make_bindgroup(desc, result, user_data);
+    }
+}
+
+static void _sgtrace_make_command_list(const sg_command_list_desc* desc, sg_command_list result, void* user_data) {
+    sg_command_list_desc desc_copy = *desc;
+    _sgtrace_rec_make(_SGTRACE_CMD_MAKE, _SGTRACE_RES_COMMAND_LIST, result.id, &desc_copy);
+    if (_sgtrace.hooks.make_command_list) {
+        _sgtrace.hooks.make_command_list(desc, result, user_data);
+    }
+}
+
+static void _sgtrace_init_buffer(sg_buffer buf_id, const sg_buffer_desc* desc, void* user_data) {
+    sg_buffer_desc desc_copy = *desc;
+    _sgtrace_strip_buffer_desc(&desc_copy);
+    _sgtrace_rec_make(_SGTRACE_CMD_INIT, _SGTRACE_RES_BUFFER, buf_id.id, &desc_copy);
+    if (_sgtrace.hooks.init_buffer) {
+        _sgtrace.hooks.init_buffer(buf_id, desc, user_data);
+    }
+}
+
+static void _sgtrace_init_image(sg_image img_id, const sg_image_desc* desc, void* user_data) {
+    sg_image_desc desc_copy = *desc;
+    _sgtrace_strip_image_desc(&desc_copy);
+    _sgtrace_rec_make(_SGTRACE_CMD_INIT, _SGTRACE_RES_IMAGE, img_id.id, &desc_copy);
+    if (_sgtrace.hooks.init_image) {
+        _sgtrace.hooks.init_image(img_id, desc, user_data);
+    }
+}
+
+static void _sgtrace_init_sampler(sg_sampler smp_id, const sg_sampler_desc* desc, void* user_data) {
+    sg_sampler_desc desc_copy = *desc;
+    _sgtrace_strip_sampler_desc(&desc_copy);
+    _sgtrace_rec_make(_SGTRACE_CMD_INIT, _SGTRACE_RES_SAMPLER, smp_id.id, &desc_copy);
+    if (_sgtrace.hooks.init_sampler) {
+        _sgtrace.hooks.init_sampler(smp_id, desc, user_data);
+    }
+}
+
+static void _sgtrace_init_shader(sg_shader shd_id, const sg_shader_desc* desc, void* user_data) {
+    sg_shader_desc desc_copy = *desc;
+    _sgtrace_rec_make(_SGTRACE_CMD_INIT, _SGTRACE_RES_SHADER, shd_id.id, &desc_copy);
+    if (_sgtrace.hooks.init_shader) {
+        _sgtrace.hooks.init_shader(shd_id, desc, user_data);
+    }
+}
+
+static void _sgtrace_init_pipeline(sg_pipeline pip_id, const sg_pipeline_desc* desc, void* user_data) {
+    sg_pipeline_desc desc_copy = *desc;
+    _sgtrace_rec_make(_SGTRACE_CMD_INIT, _SGTRACE_RES_PIPELINE, pip_id.id, &desc_copy);
+    if (_sgtrace.hooks.init_pipeline) {
+        _sgtrace.hooks.init_pipeline(pip_id, desc, user_data);
+    }
+}
+
+static void _sgtrace_init_attachments(sg_attachments atts_id, const sg_attachments_desc* desc, void* user_data) {
+    sg_attachments_desc desc_copy = *desc;
+    _sgtrace_rec_make(_SGTRACE_CMD_INIT, _SGTRACE_RES_ATTACHMENTS, atts_id.id, &desc_copy);
+    if (_sgtrace.hooks.init_attachments) {
+        _sgtrace.hooks.init_attachments(atts_id, desc, user_data);
+    }
+}
+
+// generate the hooks which only take a resource id
+#define _SGTRACE_RES_HOOK(hook, cmd, res_type, handle_type) \
+static void _sgtrace_##hook(handle_type res_id, void* user_data) { \
+    _sgtrace_rec_res(cmd, res_type, res_id.id); \
+    if (_sgtrace.hooks.hook) { \
+        _sgtrace.hooks.hook(res_id, user_data); \
+    } \
+}
+_SGTRACE_RES_HOOK(destroy_buffer, _SGTRACE_CMD_DESTROY, _SGTRACE_RES_BUFFER, sg_buffer)
+_SGTRACE_RES_HOOK(destroy_image, _SGTRACE_CMD_DESTROY, _SGTRACE_RES_IMAGE, sg_image)
+_SGTRACE_RES_HOOK(destroy_sampler, _SGTRACE_CMD_DESTROY, _SGTRACE_RES_SAMPLER, sg_sampler)
+_SGTRACE_RES_HOOK(destroy_shader, _SGTRACE_CMD_DESTROY, _SGTRACE_RES_SHADER, sg_shader)
+_SGTRACE_RES_HOOK(destroy_pipeline, _SGTRACE_CMD_DESTROY, _SGTRACE_RES_PIPELINE, sg_pipeline)
+_SGTRACE_RES_HOOK(destroy_attachments, _SGTRACE_CMD_DESTROY, _SGTRACE_RES_ATTACHMENTS, sg_attachments)
+_SGTRACE_RES_HOOK(destroy_bindgroup, _SGTRACE_CMD_DESTROY, _SGTRACE_RES_BINDGROUP, sg_bindgroup)
+_SGTRACE_RES_HOOK(destroy_command_list, _SGTRACE_CMD_DESTROY, _SGTRACE_RES_COMMAND_LIST, sg_command_list)
+_SGTRACE_RES_HOOK(alloc_buffer, _SGTRACE_CMD_ALLOC, _SGTRACE_RES_BUFFER, sg_buffer)
+_SGTRACE_RES_HOOK(alloc_image, _SGTRACE_CMD_ALLOC, _SGTRACE_RES_IMAGE, sg_image)
+_SGTRACE_RES_HOOK(alloc_sampler, _SGTRACE_CMD_ALLOC, _SGTRACE_RES_SAMPLER, sg_sampler)
+_SGTRACE_RES_HOOK(alloc_shader, _SGTRACE_CMD_ALLOC, _SGTRACE_RES_SHADER, sg_shader)
+_SGTRACE_RES_HOOK(alloc_pipeline, _SGTRACE_CMD_ALLOC, _SGTRACE_RES_PIPELINE, sg_pipeline)
+_SGTRACE_RES_HOOK(alloc_attachments, _SGTRACE_CMD_ALLOC, _SGTRACE_RES_ATTACHMENTS, sg_attachments)
+_SGTRACE_RES_HOOK(uninit_buffer, _SGTRACE_CMD_UNINIT, _SGTRACE_RES_BUFFER, sg_buffer)
+_SGTRACE_RES_HOOK(uninit_image, _SGTRACE_CMD_UNINIT, _SGTRACE_RES_IMAGE, sg_image)
+_SGTRACE_RES_HOOK(uninit_sampler, _SGTRACE_CMD_UNINIT, _SGTRACE_RES_SAMPLER, sg_sampler)
+_SGTRACE_RES_HOOK(uninit_shader, _SGTRACE_CMD_UNINIT, _SGTRACE_RES_SHADER, sg_shader)
+_SGTRACE_RES_HOOK(uninit_pipeline, _SGTRACE_CMD_UNINIT, _SGTRACE_RES_PIPELINE, sg_pipeline)
+_SGTRACE_RES_HOOK(uninit_attachments, _SGTRACE_CMD_UNINIT, _SGTRACE_RES_ATTACHMENTS, sg_attachments)
+_SGTRACE_RES_HOOK(dealloc_buffer, _SGTRACE_CMD_DEALLOC, _SGTRACE_RES_BUFFER, sg_buffer)
+_SGTRACE_RES_HOOK(dealloc_image, _SGTRACE_CMD_DEALLOC, _SGTRACE_RES_IMAGE, sg_image)
+_SGTRACE_RES_HOOK(dealloc_sampler, _SGTRACE_CMD_DEALLOC, _SGTRACE_RES_SAMPLER, sg_sampler)
+_SGTRACE_RES_HOOK(dealloc_shader, _SGTRACE_CMD_DEALLOC, _SGTRACE_RES_SHADER, sg_shader)
+_SGTRACE_RES_HOOK(dealloc_pipeline, _SGTRACE_CMD_DEALLOC, _SGTRACE_RES_PIPELINE, sg_pipeline)
+_SGTRACE_RES_HOOK(dealloc_attachments, _SGTRACE_CMD_DEALLOC, _SGTRACE_RES_ATTACHMENTS, sg_attachments)
+_SGTRACE_RES_HOOK(fail_buffer, _SGTRACE_CMD_FAIL, _SGTRACE_RES_BUFFER, sg_buffer)
+_SGTRACE_RES_HOOK(fail_image, _SGTRACE_CMD_FAIL, _SGTRACE_RES_IMAGE, sg_image)
+_SGTRACE_RES_HOOK(fail_sampler, _SGTRACE_CMD_FAIL, _SGTRACE_RES_SAMPLER, sg_sampler)
+_SGTRACE_RES_HOOK(fail_shader, _SGTRACE_CMD_FAIL, _SGTRACE_RES_SHADER, sg_shader)
+_SGTRACE_RES_HOOK(fail_pipeline, _SGTRACE_CMD_FAIL, _SGTRACE_RES_PIPELINE, sg_pipeline)
+_SGTRACE_RES_HOOK(fail_attachments, _SGTRACE_CMD_FAIL, _SGTRACE_RES_ATTACHMENTS, sg_attachments)
+#undef _SGTRACE_RES_HOOK
+
+static void _sgtrace_update_buffer(sg_buffer buf_id, const sg_range* data, void* user_data) {
+    if (_sgtrace_capturing()) {
+        sg_range data_copy = *data;
+        _sgtrace_begin_cmd(_SGTRACE_CMD_UPDATE_BUFFER);
+        _sgtrace_ser_u32(&buf_id.id);
+        _sgtrace_ser_range(&data_copy);
+        _sgtrace_end_cmd();
+    }
+    if (_sgtrace.hooks.update_buffer) {
+        _sgtrace.hooks.update_buffer(buf_id, data, user_data);
+    }
+}
+
+static void _sgtrace_append_buffer(sg_buffer buf_id, const sg_range* data, int result, void* user_data) {
+    if (_sgtrace_capturing()) {
+        sg_range data_copy = *data;
+        _sgtrace_begin_cmd(_SGTRACE_CMD_APPEND_BUFFER);
+        _sgtrace_ser_u32(&buf_id.id);
+        _sgtrace_ser_range(&data_copy);
+        _sgtrace_end_cmd();
+    }
+    if (_sgtrace.hooks.append_buffer) {
+        _sgtrace.hooks.append_buffer(buf_id, data, result, user_data);
+    }
+}
+
+static void _sgtrace_update_buffer_range(sg_buffer buf_id, int offset, const sg_range* data, void* user_data) {
+    if (_sgtrace_capturing()) {
+        sg_range data_copy = *data;
+        _sgtrace_begin_cmd(_SGTRACE_CMD_UPDATE_BUFFER_RANGE);
+        _sgtrace_ser_u32(&buf_id.id);
+        _sgtrace_ser_int(&offset);
+        _sgtrace_ser_range(&data_copy);
+        _sgtrace_end_cmd();
+    }
+    if (_sgtrace.hooks.update_buffer_range) {
+        _sgtrace.hooks.update_buffer_range(buf_id, offset, data, user_data);
+    }
+}
+
+static void _sgtrace_update_image(sg_image img_id, const sg_image_data* data, void* user_data) {
+    if (_sgtrace_capturing()) {
+        sg_image_data data_copy = *data;
+        _sgtrace_begin_cmd(_SGTRACE_CMD_UPDATE_IMAGE);
+        _sgtrace_ser_u32(&img_id.id);
+        _sgtrace_ser_image_data(&data_copy);
+        _sgtrace_end_cmd();
+    }
+    if (_sgtrace.hooks.update_image) {
+        _sgtrace.hooks.update_image(img_id, data, user_data);
+    }
+}
+
+static void _sgtrace_update_image_region(sg_image img_id, const sg_image_region* region, const sg_range* data, void* user_data) {
+    if (_sgtrace_capturing()) {
+        sg_image_region region_copy = *region;
+        sg_range data_copy = *data;
+        _sgtrace_begin_cmd(_SGTRACE_CMD_UPDATE_IMAGE_REGION);
+        _sgtrace_ser_u32(&img_id.id);
+        _sgtrace_ser_struct(&region_copy, sizeof(region_copy));
+        _sgtrace_ser_range(&data_copy);
+        _sgtrace_end_cmd();
+    }
+    if (_sgtrace.hooks.update_image_region) {
+        _sgtrace.hooks.update_image_region(img_id, region, data, user_data);
+    }
+}
+
+static void _sgtrace_generate_mipmaps(sg_image img_id, void* user_data) {
+    if (_sgtrace_capturing()) {
+        _sgtrace_begin_cmd(_SGTRACE_CMD_GENERATE_MIPMAPS);
+        _sgtrace_ser_u32(&img_id.id);
+        _sgtrace_end_cmd();
+    }
+    if (_sgtrace.hooks.generate_mipmaps) {
+        _sgtrace.hooks.generate_mipmaps(img_id, user_data);
+    }
+}
+
+static void _sgtrace_begin_pass(const sg_pass* pass, void* user_data) {
+    if (_sgtrace_capturing()) {
+        sg_pass pass_copy = *pass;
+        // the swapchain will be provided by the replay
+        _sgtrace_clear(&pass_copy.swapchain, sizeof(pass_copy.swapchain));
+        _sgtrace_begin_cmd(_SGTRACE_CMD_BEGIN_PASS);
+        _sgtrace_ser_pass(&pass_copy);
+        _sgtrace_end_cmd();
+    }
+    if (_sgtrace.hooks.begin_pass) {
+        _sgtrace.hooks.begin_pass(pass, user_data);
+    }
+}
+
+static void _sgtrace_rec_rect(_sgtrace_cmd_t cmd, int x, int y, int width, int height, bool origin_top_left) {
+    if (_sgtrace_capturing()) {
+        _sgtrace_begin_cmd(cmd);
+        _sgtrace_ser_int(&x);
+        _sgtrace_ser_int(&y);
+        _sgtrace_ser_int(&width);
+        _sgtrace_ser_int(&height);
+        _sgtrace_ser_bool(&origin_top_left);
+        _sgtrace_end_cmd();
+    }
+}
+
+static void _sgtrace_apply_viewport(int x, int y, int width, int height, bool origin_top_left, void* user_data) {
+    _sgtrace_rec_rect(_SGTRACE_CMD_APPLY_VIEWPORT, x, y, width, height, origin_top_left);
+    if (_sgtrace.hooks.apply_viewport) {
+        _sgtrace.hooks.apply_viewport(x, y, width, height, origin_top_left, user_data);
+    }
+}
+
+static void _sgtrace_apply_scissor_rect(int x, int y, int width, int height, bool origin_top_left, void* user_data) {
+    _sgtrace_rec_rect(_SGTRACE_CMD_APPLY_SCISSOR_RECT, x, y, width, height, origin_top_left);
+    if (_sgtrace.hooks.apply_scissor_rect) {
+        _sgtrace.hooks.apply_scissor_rect(x, y, width, height, origin_top_left, user_data);
+    }
+}
+
+static void _sgtrace_rec_id(_sgtrace_cmd_t cmd, uint32_t id) {
+    if (_sgtrace_capturing()) {
+        _sgtrace_begin_cmd(cmd);
+        _sgtrace_ser_u32(&id);
+        _sgtrace_end_cmd();
+    }
+}
+
+static void _sgtrace_apply_pipeline(sg_pipeline pip_id, void* user_data) {
+    _sgtrace_rec_id(_SGTRACE_CMD_APPLY_PIPELINE, pip_id.id);
+    if (_sgtrace.hooks.apply_pipeline) {
+        _sgtrace.hooks.apply_pipeline(pip_id, user_data);
+    }
+}
+
+static void _sgtrace_apply_bindings(const sg_bindings* bindings, void* user_data) {
+    if (_sgtrace_capturing()) {
+        sg_bindings bnd_copy = *bindings;
+        _sgtrace_begin_cmd(_SGTRACE_CMD_APPLY_BINDINGS);
+        _sgtrace_ser_bindings(&bnd_copy);
+        _sgtrace_end_cmd();
+    }
+    if (_sgtrace.hooks.apply_bindings) {
+        _sgtrace.hooks.apply_bindings(bindings, user_data);
+    }
+}
+
+static void _sgtrace_apply_bindgroup(sg_bindgroup bg_id, void* user_data) {
+    _sgtrace_rec_id(_SGTRACE_CMD_APPLY_BINDGROUP, bg_id.id);
+    if (_sgtrace.hooks.apply_bindgroup) {
+        _sgtrace.hooks.apply_bindgroup(bg_id, user_data);
+    }
+}
+
+static void _sgtrace_apply_uniforms(int ub_slot, const sg_range* data, void* user_data) {
+    if (_sgtrace_capturing()) {
+        sg_range data_copy = *data;
+        _sgtrace_begin_cmd(_SGTRACE_CMD_APPLY_UNIFORMS);
+        _sgtrace_ser_int(&ub_slot);
+        _sgtrace_ser_range(&data_copy);
+        _sgtrace_end_cmd();
+    }
+    if (_sgtrace.hooks.apply_uniforms) {
+        _sgtrace.hooks.apply_uniforms(ub_slot, data, user_data);
+    }
+}
+
+static void _sgtrace_rec_3i(_sgtrace_cmd_t cmd, int a, int b, int c) {
+    if (_sgtrace_capturing()) {
+        _sgtrace_begin_cmd(cmd);
+        _sgtrace_ser_int(&a);
+        _sgtrace_ser_int(&b);
+        _sgtrace_ser_int(&c);
+        _sgtrace_end_cmd();
+    }
+}
+
+static void _sgtrace_draw(int base_element, int num_elements, int num_instances, void* user_data) {
+    _sgtrace_rec_3i(_SGTRACE_CMD_DRAW, base_element, num_elements, num_instances);
+    if (_sgtrace.hooks.draw) {
+        _sgtrace.hooks.draw(base_element, num_elements, num_instances, user_data);
+    }
+}
+
+static void _sgtrace_draw_indirect(sg_buffer buf_id, int offset, void* user_data) {
+    if (_sgtrace_capturing()) {
+        _sgtrace_begin_cmd(_SGTRACE_CMD_DRAW_INDIRECT);
+        _sgtrace_ser_u32(&buf_id.id);
+        _sgtrace_ser_int(&offset);
+        _sgtrace_end_cmd();
+    }
+    if (_sgtrace.hooks.draw_indirect) {
+        _sgtrace.hooks.draw_indirect(buf_id, offset, user_data);
+    }
+}
+
+static void _sgtrace_dispatch(int num_groups_x, int num_groups_y, int num_groups_z, void* user_data) {
+    _sgtrace_rec_3i(_SGTRACE_CMD_DISPATCH, num_groups_x, num_groups_y, num_groups_z);
+    if (_sgtrace.hooks.dispatch) {
+        _sgtrace.hooks.dispatch(num_groups_x, num_groups_y, num_groups_z, user_data);
+    }
+}
+
+static void _sgtrace_execute_command_list(sg_command_list cl_id, void* user_data) {
+    _sgtrace_rec_id(_SGTRACE_CMD_EXECUTE_COMMAND_LIST, cl_id.id);
+    if (_sgtrace.hooks.execute_command_list) {
+        _sgtrace.hooks.execute_command_list(cl_id, user_data);
+    }
+}
+
+static void _sgtrace_rec_noargs(_sgtrace_cmd_t cmd) {
+    if (_sgtrace_capturing()) {
+        _sgtrace_begin_cmd(cmd);
+        _sgtrace_end_cmd();
+    }
+}
+
+static void _sgtrace_end_pass(void* user_data) {
+    _sgtrace_rec_noargs(_SGTRACE_CMD_END_PASS);
+    if (_sgtrace.hooks.end_pass) {
+        _sgtrace.hooks.end_pass(user_data);
+    }
+}
+
+static void _sgtrace_reset_state_cache(void* user_data) {
+    _sgtrace_rec_noargs(_SGTRACE_CMD_RESET_STATE_CACHE);
+    if (_sgtrace.hooks.reset_state_cache) {
+        _sgtrace.hooks.reset_state_cache(user_data);
+    }
+}
+
+static void _sgtrace_push_debug_group(const char* name, void* user_data) {
+    if (_sgtrace_capturing()) {
+        _sgtrace_begin_cmd(_SGTRACE_CMD_PUSH_DEBUG_GROUP);
+        _sgtrace_ser_str(&name);
+        _sgtrace_end_cmd();
+    }
+    if (_sgtrace.hooks.push_debug_group) {
+        _sgtrace.hooks.push_debug_group(name, user_data);
+    }
+}
+
+static void _sgtrace_pop_debug_group(void* user_data) {
+    _sgtrace_rec_noargs(_SGTRACE_CMD_POP_DEBUG_GROUP);
+    if (_sgtrace.hooks.pop_debug_group) {
+        _sgtrace.hooks.pop_debug_group(user_data);
+    }
+}
+
+// sg_commit() is the frame boundary which starts and ends captures
+static void _sgtrace_commit(void* user_data) {
+    if (!_sgtrace.replay.active) {
+        if (_sgtrace.capture.state == _SGTRACE_CAPTURE_ACTIVE) {
+            _sgtrace_rec_noargs(_SGTRACE_CMD_COMMIT);
+            _sgtrace.capture.num_frames++;
+            _sgtrace_cancel_capture_on_overflow();
+            if ((_sgtrace.capture.state == _SGTRACE_CAPTURE_ACTIVE) && (--_sgtrace.capture.frames_left == 0)) {
+                _sgtrace_finish_capture();
+            }
+        } else if (_sgtrace.capture.state == _SGTRACE_CAPTURE_PENDING) {
+            _sgtrace_start_capture();
+            _sgtrace_cancel_capture_on_overflow();
+        }
+    }
+    if (_sgtrace.hooks.commit) {
+        _sgtrace.hooks.commit(user_data);
+    }
+}
+
+static void _sgtrace_install_hooks(void) {
+    sg_trace_hooks hooks;
+    _sgtrace_clear(&hooks, sizeof(hooks));
+    hooks.user_data = _sgtrace.hooks.user_data;
+    hooks.reset_state_cache = _sgtrace_reset_state_cache;
+    hooks.make_buffer = _sgtrace_make_buffer;
+    hooks.make_image = _sgtrace_make_image;
+    hooks.make_sampler = _sgtrace_make_sampler;
+    hooks.make_shader = _sgtrace_make_shader;
+    hooks.make_pipeline = _sgtrace_make_pipeline;
+    hooks.make_attachments = _sgtrace_make_attachments;
+    hooks.make_bindgroup = _sgtrace_make_bindgroup;
+    hooks.make_command_list = _sgtrace_make_command_list;
+    hooks.destroy_buffer = _sgtrace_destroy_buffer;
+    hooks.destroy_image = _sgtrace_destroy_image;
+    hooks.destroy_sampler = _sgtrace_destroy_sampler;
+    hooks.destroy_shader = _sgtrace_destroy_shader;
+    hooks.destroy_pipeline = _sgtrace_destroy_pipeline;
+    hooks.destroy_attachments = _sgtrace_destroy_attachments;
+    hooks.destroy_bindgroup = _sgtrace_destroy_bindgroup;
+    hooks.destroy_command_list = _sgtrace_destroy_command_list;
+    hooks.update_buffer = _sgtrace_update_buffer;
+    hooks.update_image = _sgtrace_update_image;
+    hooks.update_buffer_range = _sgtrace_update_buffer_range;
+    hooks.update_image_region = _sgtrace_update_image_region;
+    hooks.generate_mipmaps = _sgtrace_generate_mipmaps;
+    hooks.read_image_async = _sgtrace.hooks.read_image_async;
+    hooks.read_buffer_async = _sgtrace.hooks.read_buffer_async;
+    hooks.append_buffer = _sgtrace_append_buffer;
+    hooks.begin_pass = _sgtrace_begin_pass;
+    hooks.apply_viewport = _sgtrace_apply_viewport;
+    hooks.apply_scissor_rect = _sgtrace_apply_scissor_rect;
+    hooks.apply_pipeline = _sgtrace_apply_pipeline;
+    hooks.apply_bindings = _sgtrace_apply_bindings;
+    hooks.apply_bindgroup = _sgtrace_apply_bindgroup;
+    hooks.apply_uniforms = _sgtrace_apply_uniforms;
+    hooks.draw = _sgtrace_draw;
+    hooks.draw_indirect = _sgtrace_draw_indirect;
+    hooks.dispatch = _sgtrace_dispatch;
+    hooks.execute_command_list = _sgtrace_execute_command_list;
+    hooks.end_pass = _sgtrace_end_pass;
+    hooks.commit = _sgtrace_commit;
+    hooks.alloc_buffer = _sgtrace_alloc_buffer;
+    hooks.alloc_image = _sgtrace_alloc_image;
+    hooks.alloc_sampler = _sgtrace_alloc_sampler;
+    hooks.alloc_shader = _sgtrace_alloc_shader;
+    hooks.alloc_pipeline = _sgtrace_alloc_pipeline;
+    hooks.alloc_attachments = _sgtrace_alloc_attachments;
+    hooks.dealloc_buffer = _sgtrace_dealloc_buffer;
+    hooks.dealloc_image = _sgtrace_dealloc_image;
+    hooks.dealloc_sampler = _sgtrace_dealloc_sampler;
+    hooks.dealloc_shader = _sgtrace_dealloc_shader;
+    hooks.dealloc_pipeline = _sgtrace_dealloc_pipeline;
+    hooks.dealloc_attachments = _sgtrace_dealloc_attachments;
+    hooks.init_buffer = _sgtrace_init_buffer;
+    hooks.init_image = _sgtrace_init_image;
+    hooks.init_sampler = _sgtrace_init_sampler;
+    hooks.init_shader = _sgtrace_init_shader;
+    hooks.init_pipeline = _sgtrace_init_pipeline;
+    hooks.init_attachments = _sgtrace_init_attachments;
+    hooks.uninit_buffer = _sgtrace_uninit_buffer;
+    hooks.uninit_image = _sgtrace_uninit_image;
+    hooks.uninit_sampler = _sgtrace_uninit_sampler;
+    hooks.uninit_shader = _sgtrace_uninit_shader;
+    hooks.uninit_pipeline = _sgtrace_uninit_pipeline;
+    hooks.uninit_attachments = _sgtrace_uninit_attachments;
+    hooks.fail_buffer = _sgtrace_fail_buffer;
+    hooks.fail_image = _sgtrace_fail_image;
+    hooks.fail_sampler = _sgtrace_fail_sampler;
+    hooks.fail_shader = _sgtrace_fail_shader;
+    hooks.fail_pipeline = _sgtrace_fail_pipeline;
+    hooks.fail_attachments = _sgtrace_fail_attachments;
+    hooks.push_debug_group = _sgtrace_push_debug_group;
+    hooks.pop_debug_group = _sgtrace_pop_debug_group;
+    _sgtrace.hooks = sg_install_trace_hooks(&hooks);
+}
+
+// ██████  ███████ ██████  ██       █████  ██    ██
+// ██   ██ ██      ██   ██ ██      ██   ██  ██  ██
+// ██████  █████   ██████  ██      ███████   ████
+// ██   ██ ██      ██      ██      ██   ██    ██
+// ██   ██ ███████ ██      ███████ ██   ██    ██
+//
+// >>replay
+static uint32_t _sgtrace_replay_lookup(_sgtrace_res_t res_type, uint32_t id) {
+    const uint64_t* val = _sgtrace_map_find(&_sgtrace.replay.map, _sgtrace_key(res_type, id));
+    return val ? (uint32_t)*val : (uint32_t)SG_INVALID_ID;
+}
+
+// register a replay resource, returns false if the captured id is already mapped
+static bool _sgtrace_replay_add(_sgtrace_res_t res_type, uint32_t id, uint32_t replay_id, bool in_frame) {
+    const uint64_t key = _sgtrace_key(res_type, id);
+    uint64_t* val = _sgtrace_map_find(&_sgtrace.replay.map, key);
+    if (val) {
+        // same handle returned more than once in the capture, just bump the ref count
+        *val += (1ULL << 32);
+        return false;
+    }
+    _sgtrace_map_set(&_sgtrace.replay.map, key, (1ULL << 32) | replay_id);
+    if (in_frame) {
+        _sgtrace_map_set(&_sgtrace.replay.frame_res, key, 1);
+    }
+    return true;
+}
+
+static void _sgtrace_replay_destroy_res(_sgtrace_res_t res_type, uint32_t replay_id) {
+    switch (res_type) {
+        case _SGTRACE_RES_BUFFER: { sg_buffer h = { replay_id }; sg_destroy_buffer(h); } break;
+        case _SGTRACE_RES_IMAGE: { sg_image h = { replay_id }; sg_destroy_image(h); } break;
+        case _SGTRACE_RES_SAMPLER: { sg_sampler h = { replay_id }; sg_destroy_sampler(h); } break;
+        case _SGTRACE_RES_SHADER: { sg_shader h = { replay_id }; sg_destroy_shader(h); } break;
+        case _SGTRACE_RES_PIPELINE: { sg_pipeline h = { replay_id }; sg_destroy_pipeline(h); } break;
+        case _SGTRACE_RES_ATTACHMENTS: { sg_attachments h = { replay_id }; sg_destroy_attachments(h); } break;
+        case _SGTRACE_RES_BINDGROUP: { sg_bindgroup h = { replay_id }; sg_destroy_bindgroup(h); } break;
+        case _SGTRACE_RES_COMMAND_LIST: { sg_command_list h = { replay_id }; sg_destroy_command_list(h); } break;
+        default: SOKOL_UNREACHABLE; break;
+    }
+}
+
+// unregister and destroy a replay resource once its ref count drops to zero
+static void _sgtrace_replay_remove(_sgtrace_res_t res_type, uint32_t id, bool destroy) {
+    const uint64_t key = _sgtrace_key(res_type, id);
+    uint64_t* val = _sgtrace_map_find(&_sgtrace.replay.map, key);
+    if (0 == val) {
+        return;
+    }
+    const uint32_t replay_id = (uint32_t)*val;
+    *val -= (1ULL << 32);
+    if ((*val >> 32) == 0) {
+        _sgtrace_map_remove(&_sgtrace.replay.map, key);
+        _sgtrace_map_remove(&_sgtrace.replay.frame_res, key);
+        if (destroy) {
+            _sgtrace_replay_destroy_res(res_type, replay_id);
+        }
+    }
+}
+
+static uint32_t _sgtrace_replay_make(_sgtrace_res_t res_type, const _sgtrace_desc_union_t* desc) {
+    switch (res_type) {
+        case _SGTRACE_RES_BUFFER: return sg_make_buffer(&desc->buffer).id;
+        case _SGTRACE_RES_IMAGE: return sg_make_image(&desc->image).id;
+        case _SGTRACE_RES_SAMPLER: return sg_make_sampler(&desc->sampler).id;
+        case _SGTRACE_RES_SHADER: return sg_make_shader(&desc->shader).id;
+        case _SGTRACE_RES_PIPELINE: return sg_make_pipeline(&desc->pipeline).id;
+        case _SGTRACE_RES_ATTACHMENTS: return sg_make_attachments(&desc->attachments).id;
+        case _SGTRACE_RES_BINDGROUP: return sg_make_bindgroup(&desc->bindgroup).id;
+        case _SGTRACE_RES_COMMAND_LIST: return sg_make_command_list(&desc->command_list).id;
+        default: SOKOL_UNREACHABLE; return SG_INVALID_ID;
+    }
+}
+
+static void _sgtrace_replay_init(_sgtrace_res_t res_type, uint32_t replay_id, const _sgtrace_desc_union_t* desc) {
+    switch (res_type) {
+        case _SGTRACE_RES_BUFFER: { sg_buffer h = { replay_id }; sg_init_buffer(h, &desc->buffer); } break;
+        case _SGTRACE_RES_IMAGE: { sg_image h = { replay_id }; sg_init_image(h, &desc->image); } break;
+        case _SGTRACE_RES_SAMPLER: { sg_sampler h = { replay_id }; sg_init_sampler(h, &desc->sampler); } break;
+        case _SGTRACE_RES_SHADER: { sg_shader h = { replay_id }; sg_init_shader(h, &desc->shader); } break;
+        case _SGTRACE_RES_PIPELINE: { sg_pipeline h = { replay_id }; sg_init_pipeline(h, &desc->pipeline); } break;
+        case _SGTRACE_RES_ATTACHMENTS: { sg_attachments h = { replay_id }; sg_init_attachments(h, &desc->attachments); } break;
+        default: break;
+    }
+}
+
+static uint32_t _sgtrace_replay_alloc(_sgtrace_res_t res_type) {
+    switch (res_type) {
+        case _SGTRACE_RES_BUFFER: return sg_alloc_buffer().id;
+        case _SGTRACE_RES_IMAGE: return sg_alloc_image().id;
+        case _SGTRACE_RES_SAMPLER: return sg_alloc_sampler().id;
+        case _SGTRACE_RES_SHADER: return sg_alloc_shader().id;
+        case _SGTRACE_RES_PIPELINE: return sg_alloc_pipeline().id;
+        case _SGTRACE_RES_ATTACHMENTS: return sg_alloc_attachments().id;
+        default: return SG_INVALID_ID;
+    }
+}
+
+static void _sgtrace_replay_uninit(_sgtrace_res_t res_type, uint32_t replay_id) {
+    switch (res_type) {
+        case _SGTRACE_RES_BUFFER: { sg_buffer h = { replay_id }; sg_uninit_buffer(h); } break;
+        case _SGTRACE_RES_IMAGE: { sg_image h = { replay_id }; sg_uninit_image(h); } break;
+        case _SGTRACE_RES_SAMPLER: { sg_sampler h = { replay_id }; sg_uninit_sampler(h); } break;
+        case _SGTRACE_RES_SHADER: { sg_shader h = { replay_id }; sg_uninit_shader(h); } break;
+        case _SGTRACE_RES_PIPELINE: { sg_pipeline h = { replay_id }; sg_uninit_pipeline(h); } break;
+        case _SGTRACE_RES_ATTACHMENTS: { sg_attachments h = { replay_id }; sg_uninit_attachments(h); } break;
+        default: break;
+    }
+}
+
+static void _sgtrace_replay_dealloc(_sgtrace_res_t res_type, uint32_t replay_id) {
+    switch (res_type) {
+        case _SGTRACE_RES_BUFFER: { sg_buffer h = { replay_id }; sg_dealloc_buffer(h); } break;
+        case _SGTRACE_RES_IMAGE: { sg_image h = { replay_id }; sg_dealloc_image(h); } break;
+        case _SGTRACE_RES_SAMPLER: { sg_sampler h = { replay_id }; sg_dealloc_sampler(h); } break;
+        case _SGTRACE_RES_SHADER: { sg_shader h = { replay_id }; sg_dealloc_shader(h); } break;
+        case _SGTRACE_RES_PIPELINE: { sg_pipeline h = { replay_id }; sg_dealloc_pipeline(h); } break;
+        case _SGTRACE_RES_ATTACHMENTS: { sg_attachments h = { replay_id }; sg_dealloc_attachments(h); } break;
+        default: break;
+    }
+}
+
+static void _sgtrace_replay_fail(_sgtrace_res_t res_type, uint32_t replay_id) {
+    switch (res_type) {
+        case _SGTRACE_RES_BUFFER: { sg_buffer h = { replay_id }; sg_fail_buffer(h); } break;
+        case _SGTRACE_RES_IMAGE: { sg_image h = { replay_id }; sg_fail_image(h); } break;
+        case _SGTRACE_RES_SAMPLER: { sg_sampler h = { replay_id }; sg_fail_sampler(h); } break;
+        case _SGTRACE_RES_SHADER: { sg_shader h = { replay_id }; sg_fail_shader(h); } break;
+        case _SGTRACE_RES_PIPELINE: { sg_pipeline h = { replay_id }; sg_fail_pipeline(h); } break;
+        case _SGTRACE_RES_ATTACHMENTS: { sg_attachments h = { replay_id }; sg_fail_attachments(h); } break;
+        default: break;
+    }
+}
+
+static bool _sgtrace_valid_res_type(uint32_t res_type) {
+    return (res_type >= _SGTRACE_RES_BUFFER) && (res_type <= _SGTRACE_RES_COMMAND_LIST);
+}
+
+/* replay a single command from the current read position, in the prologue,
+   resources which already exist are skipped (this happens when rewinding),
+   returns false if the command is a COMMIT, or on error
+*/
+static bool _sgtrace_replay_cmd(bool in_frame, const sg_swapchain* swapchain) {
+    uint32_t header[2];
+    _sgtrace_ser_bytes(header, sizeof(header));
+    if (_sgtrace.io.error) {
+        return false;
+    }
+    const _sgtrace_cmd_t cmd = (_sgtrace_cmd_t)header[0];
+    const uint8_t* cmd_end = _sgtrace.io.ptr + header[1];
+    if ((header[1] > (size_t)(_sgtrace.io.end - _sgtrace.io.ptr))) {
+        _sgtrace.io.error = true;
+        return false;
+    }
+    bool keep_going = true;
+    switch (cmd) {
+        case _SGTRACE_CMD_MAKE:
+        case _SGTRACE_CMD_INIT:
+            {
+                uint32_t res_type = 0, id = 0;
+                _sgtrace_ser_u32(&res_type);
+                _sgtrace_ser_u32(&id);
+                if (!_sgtrace_valid_res_type(res_type)) {
+                    _sgtrace.io.error = true;
+                    break;
+                }
+                if (!in_frame && (SG_INVALID_ID != _sgtrace_replay_lookup((_sgtrace_res_t)res_type, id))) {
+                    // still alive from a previous loop
+                    break;
+                }
+                _sgtrace_desc_union_t* desc = &_sgtrace.replay.tmp_desc;
+                _sgtrace_ser_desc((_sgtrace_res_t)res_type, desc);
+                if (_sgtrace.io.error) {
+                    break;
+                }
+                const uint32_t init_id = _sgtrace_replay_lookup((_sgtrace_res_t)res_type, id);
+                if ((cmd == _SGTRACE_CMD_MAKE) || (SG_INVALID_ID == init_id)) {
+                    // NOTE: an INIT without a captured ALLOC (allocated before the capture) becomes a MAKE
+                    const uint32_t replay_id = _sgtrace_replay_make((_sgtrace_res_t)res_type, desc);
+                    if (!_sgtrace_replay_add((_sgtrace_res_t)res_type, id, replay_id, in_frame)) {
+                        // a duplicate handle (e.g. a deduplicated pipeline in the capture)
+                        _sgtrace_replay_destroy_res((_sgtrace_res_t)res_type, replay_id);
+                    }
+                } else {
+                    _sgtrace_replay_init((_sgtrace_res_t)res_type, init_id, desc);
+                }
+            }
+            break;
+        case _SGTRACE_CMD_DESTROY:
+        case _SGTRACE_CMD_ALLOC:
+        case _SGTRACE_CMD_UNINIT:
+        case _SGTRACE_CMD_DEALLOC:
+        case _SGTRACE_CMD_FAIL:
+            {
+                uint32_t res_type = 0, id = 0;
+                _sgtrace_ser_u32(&res_type);
+                _sgtrace_ser_u32(&id);
+                if (!_sgtrace_valid_res_type(res_type)) {
+                    _sgtrace.io.error = true;
+                    break;
+                }
+                const _sgtrace_res_t rt = (_sgtrace_res_t)res_type;
+                const uint32_t replay_id = _sgtrace_replay_lookup(rt, id);
+                switch (cmd) {
+                    case _SGTRACE_CMD_DESTROY: _sgtrace_replay_remove(rt, id, true); break;
+                    case _SGTRACE_CMD_ALLOC: _sgtrace_replay_add(rt, id, _sgtrace_replay_alloc(rt), in_frame); break;
+                    case _SGTRACE_CMD_UNINIT: _sgtrace_replay_uninit(rt, replay_id); break;
+                    case _SGTRACE_CMD_DEALLOC: _sgtrace_replay_dealloc(rt, replay_id); _sgtrace_replay_remove(rt, id, false); break;
+                    case _SGTRACE_CMD_FAIL: _sgtrace_replay_fail(rt, replay_id); break;
+                    default: break;
+                }
+            }
+            break;
+        case _SGTRACE_CMD_REF_COUNT:
+            {
+                uint32_t res_type = 0, id = 0, ref_count = 0;
+                _sgtrace_ser_u32(&res_type);
+                _sgtrace_ser_u32(&id);
+                _sgtrace_ser_u32(&ref_count);
+                if (!_sgtrace_valid_res_type(res_type) || (0 == ref_count)) {
+                    _sgtrace.io.error = true;
+                    break;
+                }
+                // also restores the reference count of prologue resources when rewinding
+                uint64_t* val = _sgtrace_map_find(&_sgtrace.replay.map, _sgtrace_key((_sgtrace_res_t)res_type, id));
+                if (val) {
+                    *val = ((uint64_t)ref_count << 32) | (*val & 0xFFFFFFFF);
+                }
+            }
+            break;
+        case _SGTRACE_CMD_UPDATE_BUFFER:
+        case _SGTRACE_CMD_APPEND_BUFFER:
+        case _SGTRACE_CMD_UPDATE_BUFFER_RANGE:
+            {
+                sg_buffer buf = { 0 };
+                int offset = 0;
+                sg_range data = { 0, 0 };
+                _sgtrace_ser_u32(&buf.id);
+                _sgtrace_ser_id(_SGTRACE_RES_BUFFER, &buf.id);
+                if (cmd == _SGTRACE_CMD_UPDATE_BUFFER_RANGE) {
+                    _sgtrace_ser_int(&offset);
+                }
+                _sgtrace_ser_range(&data);
+                if (_sgtrace.io.error || (0 == data.ptr)) {
+                    break;
+                }
+                if (cmd == _SGTRACE_CMD_UPDATE_BUFFER) {
+                    sg_update_buffer(buf, &data);
+                } else if (cmd == _SGTRACE_CMD_APPEND_BUFFER) {
+                    sg_append_buffer(buf, &data);
+                } else {
+                    sg_update_buffer_range(buf, offset, &data);
+                }
+            }
+            break;
+        case _SGTRACE_CMD_UPDATE_IMAGE:
+            {
+                sg_image img = { 0 };
+                sg_image_data data;
+                _sgtrace_ser_u32(&img.id);
+                _sgtrace_ser_id(_SGTRACE_RES_IMAGE, &img.id);
+                _sgtrace_ser_image_data(&data);
+                if (!_sgtrace.io.error) {
+                    sg_update_image(img, &data);
+                }
+            }
+            break;
+        case _SGTRACE_CMD_UPDATE_IMAGE_REGION:
+            {
+                sg_image img = { 0 };
+                sg_image_region region;
+                sg_range data = { 0, 0 };
+                _sgtrace_ser_u32(&img.id);
+                _sgtrace_ser_id(_SGTRACE_RES_IMAGE, &img.id);
+                _sgtrace_ser_struct(&region, sizeof(region));
+                _sgtrace_ser_range(&data);
+                if (!_sgtrace.io.error && data.ptr) {
+                    sg_update_image_region(img, &region, &data);
+                }
+            }
+            break;
+        case _SGTRACE_CMD_GENERATE_MIPMAPS:
+            {
+                sg_image img = { 0 };
+                _sgtrace_ser_u32(&img.id);
+                _sgtrace_ser_id(_SGTRACE_RES_IMAGE, &img.id);
+                if (!_sgtrace.io.error) {
+                    sg_generate_mipmaps(img);
+                }
+            }
+            break;
+        case _SGTRACE_CMD_BEGIN_PASS:
+            {
+                sg_pass pass;
+                _sgtrace_ser_pass(&pass);
+                if (!_sgtrace.io.error) {
+                    if (!pass.compute && (SG_INVALID_ID == pass.attachments.id)) {
+                        pass.swapchain = *swapchain;
+                    }
+                    sg_begin_pass(&pass);
+                }
+            }
+            break;
+        case _SGTRACE_CMD_APPLY_VIEWPORT:
+        case _SGTRACE_CMD_APPLY_SCISSOR_RECT:
+            {
+                int x = 0, y = 0, w = 0, h = 0;
+                bool origin_top_left = false;
+                _sgtrace_ser_int(&x);
+                _sgtrace_ser_int(&y);
+                _sgtrace_ser_int(&w);
+                _sgtrace_ser_int(&h);
+                _sgtrace_ser_bool(&origin_top_left);
+                if (_sgtrace.io.error) {
+                    break;
+                }
+                if (cmd == _SGTRACE_CMD_APPLY_VIEWPORT) {
+                    sg_apply_viewport(x, y, w, h, origin_top_left);
+                } else {
+                    sg_apply_scissor_rect(x, y, w, h, origin_top_left);
+                }
+            }
+            break;
+        case _SGTRACE_CMD_APPLY_PIPELINE:
+            {
+                sg_pipeline pip = { 0 };
+                _sgtrace_ser_u32(&pip.id);
+                _sgtrace_ser_id(_SGTRACE_RES_PIPELINE, &pip.id);
+                sg_apply_pipeline(pip);
+            }
+            break;
+        case _SGTRACE_CMD_APPLY_BINDINGS:
+            {
+                sg_bindings bnd;
+                _sgtrace_ser_bindings(&bnd);
+                if (!_sgtrace.io.error) {
+                    sg_apply_bindings(&bnd);
+                }
+            }
+            break;
+        case _SGTRACE_CMD_APPLY_BINDGROUP:
+            {
+                sg_bindgroup bg = { 0 };
+                _sgtrace_ser_u32(&bg.id);
+                _sgtrace_ser_id(_SGTRACE_RES_BINDGROUP, &bg.id);
+                sg_apply_bindgroup(bg);
+            }
+            break;
+        case _SGTRACE_CMD_APPLY_UNIFORMS:
+            {
+                int ub_slot = 0;
+                sg_range data = { 0, 0 };
+                _sgtrace_ser_int(&ub_slot);
+                _sgtrace_ser_range(&data);
+                if (!_sgtrace.io.error && data.ptr && (ub_slot >= 0) && (ub_slot < SG_MAX_UNIFORMBLOCK_BINDSLOTS)) {
+                    sg_apply_uniforms(ub_slot, &data);
+                }
+            }
+            break;
+        case _SGTRACE_CMD_DRAW:
+        case _SGTRACE_CMD_DISPATCH:
+            {
+                int a = 0, b = 0, c = 0;
+                _sgtrace_ser_int(&a);
+                _sgtrace_ser_int(&b);
+                _sgtrace_ser_int(&c);
+                if (_sgtrace.io.error) {
+                    break;
+                }
+                if (cmd == _SGTRACE_CMD_DRAW) {
+                    sg_draw(a, b, c);
+                } else {
+                    sg_dispatch(a, b, c);
+                }
+            }
+            break;
+        case _SGTRACE_CMD_DRAW_INDIRECT:
+            {
+                sg_buffer buf = { 0 };
+                int offset = 0;
+                _sgtrace_ser_u32(&buf.id);
+                _sgtrace_ser_id(_SGTRACE_RES_BUFFER, &buf.id);
+                _sgtrace_ser_int(&offset);
+                if (!_sgtrace.io.error) {
+                    sg_draw_indirect(buf, offset);
+                }
+            }
+            break;
+        case _SGTRACE_CMD_EXECUTE_COMMAND_LIST:
+            if (!_sgtrace.replay.cmdlist_warned) {
+                _SGTRACE_WARN(REPLAY_COMMAND_LIST_SKIPPED);
+                _sgtrace.replay.cmdlist_warned = true;
+            }
+            break;
+        case _SGTRACE_CMD_END_PASS:
+            sg_end_pass();
+            break;
+        case _SGTRACE_CMD_COMMIT:
+            keep_going = false;
+            break;
+        case _SGTRACE_CMD_RESET_STATE_CACHE:
+            sg_reset_state_cache();
+            break;
+        case _SGTRACE_CMD_PUSH_DEBUG_GROUP:
+            {
+                const char* name = 0;
+                _sgtrace_ser_str(&name);
+                if (!_sgtrace.io.error && name) {
+                    sg_push_debug_group(name);
+                }
+            }
+            break;
+        case _SGTRACE_CMD_POP_DEBUG_GROUP:
+            sg_pop_debug_group();
+            break;
+        default:
+            _sgtrace.io.error = true;
+            break;
+    }
+    if (_sgtrace.io.error) {
+        return false;
+    }
+    // skip any unread payload bytes (e.g. a skipped MAKE command)
+    _sgtrace.io.ptr = cmd_end;
+    return keep_going;
+}
+
+// create the resources which were alive at the start of the capture
+static bool _sgtrace_replay_prologue(void) {
+    _sgtrace_begin_read(_sgtrace.replay.data + sizeof(_sgtrace_header_t), _sgtrace.replay.prologue_size);
+    while (_sgtrace.io.ptr < _sgtrace.io.end) {
+        if (!_sgtrace_replay_cmd(false, 0)) {
+            break;
+        }
+    }
+    return !_sgtrace.io.error;
+}
+
+// destroy all resources created in the captured frames, and restore the prologue resources
+static void _sgtrace_replay_rewind(void) {
+    _sgtrace_map_t* frame_res = &_sgtrace.replay.frame_res;
+    for (uint32_t i = 0; i < frame_res->cap; i++) {
+        const uint64_t key = frame_res->keys[i];
+        if (key != 0) {
+            const uint64_t* val = _sgtrace_map_find(&_sgtrace.replay.map, key);
+            if (val) {
+                _sgtrace_replay_destroy_res((_sgtrace_res_t)(key >> 32), (uint32_t)*val);
+                _sgtrace_map_remove(&_sgtrace.replay.map, key);
+            }
+        }
+    }
+    _sgtrace_map_discard(frame_res);
+    _sgtrace_replay_prologue();
+    _sgtrace.replay.cur_frame = 0;
+}
+
+// scan the captured frames and validate the command headers
+static bool _sgtrace_replay_scan_frames(void) {
+    const size_t frames_start = sizeof(_sgtrace_header_t) + _sgtrace.replay.prologue_size;
+    _sgtrace.replay.frame_offsets = (size_t*) _sgtrace_malloc_clear((size_t)(_sgtrace.replay.num_frames + 1) * sizeof(size_t));
+    size_t pos = frames_start;
+    int frame = 0;
+    _sgtrace.replay.frame_offsets[0] = pos;
+    while ((pos < _sgtrace.replay.size) && (frame < _sgtrace.replay.num_frames)) {
+        uint32_t header[2];
+        if ((_sgtrace.replay.size - pos) < sizeof(header)) {
+            return false;
+        }
+        memcpy(header, _sgtrace.replay.data + pos, sizeof(header));
+        pos += sizeof(header);
+        if ((header[0] == _SGTRACE_CMD_INVALID) || (header[0] >= _SGTRACE_CMD_NUM) || (header[1] > (_sgtrace.replay.size - pos))) {
+            return false;
+        }
+        pos += header[1];
+        if (header[0] == _SGTRACE_CMD_COMMIT) {
+            _sgtrace.replay.frame_offsets[++frame] = pos;
+        }
+    }
+    return frame == _sgtrace.replay.num_frames;
+}
+
+static void _sgtrace_replay_discard(void) {
+    // destroy all replay resources in reverse dependency order
+    static const _sgtrace_res_t order[] = {
+        _SGTRACE_RES_COMMAND_LIST, _SGTRACE_RES_BINDGROUP, _SGTRACE_RES_ATTACHMENTS, _SGTRACE_RES_PIPELINE,
+        _SGTRACE_RES_SHADER, _SGTRACE_RES_SAMPLER, _SGTRACE_RES_IMAGE, _SGTRACE_RES_BUFFER,
+    };
+    _sgtrace_map_t* map = &_sgtrace.replay.map;
+    for (size_t o = 0; o < (sizeof(order) / sizeof(order[0])); o++) {
+        for (uint32_t i = 0; i < map->cap; i++) {
+            if ((map->keys[i] != 0) && ((map->keys[i] >> 32) == (uint64_t)order[o])) {
+                _sgtrace_replay_destroy_res(order[o], (uint32_t)map->values[i]);
+            }
+        }
+    }
+    _sgtrace_map_discard(&_sgtrace.replay.map);
+    _sgtrace_map_discard(&_sgtrace.replay.frame_res);
+    if (_sgtrace.replay.frame_offsets) {
+        _sgtrace_free(_sgtrace.replay.frame_offsets);
+    }
+    if (_sgtrace.replay.data) {
+        _sgtrace_free(_sgtrace.replay.data);
+    }
+    _sgtrace_clear(&_sgtrace.replay, sizeof(_sgtrace.replay));
+}
+
+// ██████  ██    ██ ██████  ██      ██  ██████
+// ██   ██ ██    ██ ██   ██ ██      ██ ██
+// ██████  ██    ██ ██████  ██      ██ ██
+// ██      ██    ██ ██   ██ ██      ██ ██
+// ██       ██████  ██████  ███████ ██  ██████
+//
+// >>public
+static sgtrace_desc_t _sgtrace_desc_defaults(const sgtrace_desc_t* desc) {
+    SOKOL_ASSERT((desc->allocator.alloc_fn && desc->allocator.free_fn) || (!desc->allocator.alloc_fn && !desc->allocator.free_fn));
+    sgtrace_desc_t res = *desc;
+    res.max_capture_size = _sgtrace_def(res.max_capture_size, _SGTRACE_DEFAULT_MAX_CAPTURE_SIZE);
+    return res;
+}
+
+SOKOL_API_IMPL void sgtrace_setup(const sgtrace_desc_t* desc) {
+    SOKOL_ASSERT(desc);
+    SOKOL_ASSERT(!_sgtrace.replay.active);
+    _sgtrace_clear(&_sgtrace, sizeof(_sgtrace));
+    _sgtrace.init_cookie = _SGTRACE_INIT_COOKIE;
+    _sgtrace.desc = _sgtrace_desc_defaults(desc);
+    _sgtrace.capture.buf.max_size = _sgtrace.desc.max_capture_size;
+    _sgtrace_install_hooks();
+}
+
+SOKOL_API_IMPL void sgtrace_shutdown(void) {
+    SOKOL_ASSERT(_SGTRACE_INIT_COOKIE == _sgtrace.init_cookie);
+    SOKOL_ASSERT(!_sgtrace.replay.active);
+    sg_install_trace_hooks(&_sgtrace.hooks);
+    _sgtrace_live_discard();
+    _sgtrace_buf_discard(&_sgtrace.capture.buf);
+    _sgtrace_buf_discard(&_sgtrace.scratch);
+    _sgtrace.init_cookie = 0;
+}
+
+SOKOL_API_IMPL void sgtrace_begin_capture(int num_frames) {
+    SOKOL_ASSERT(_SGTRACE_INIT_COOKIE == _sgtrace.init_cookie);
+    SOKOL_ASSERT(num_frames > 0);
+    if ((_sgtrace.capture.state == _SGTRACE_CAPTURE_PENDING) || (_sgtrace.capture.state == _SGTRACE_CAPTURE_ACTIVE)) {
+        _SGTRACE_ERROR(CAPTURE_ALREADY_ACTIVE);
+        return;
+    }
+    _sgtrace_buf_reset(&_sgtrace.capture.buf);
+    _sgtrace.capture.state = _SGTRACE_CAPTURE_PENDING;
+    _sgtrace.capture.frames_left = num_frames;
+}
+
+SOKOL_API_IMPL bool sgtrace_capture_active(void) {
+    SOKOL_ASSERT(_SGTRACE_INIT_COOKIE == _sgtrace.init_cookie);
+    return (_sgtrace.capture.state == _SGTRACE_CAPTURE_PENDING) || (_sgtrace.capture.state == _SGTRACE_CAPTURE_ACTIVE);
+}
+
+SOKOL_API_IMPL bool sgtrace_capture_ready(void) {
+    SOKOL_ASSERT(_SGTRACE_INIT_COOKIE == _sgtrace.init_cookie);
+    return _sgtrace.capture.state == _SGTRACE_CAPTURE_READY;
+}
+
+SOKOL_API_IMPL sgtrace_range sgtrace_get_capture(void) {
+    SOKOL_ASSERT(_SGTRACE_INIT_COOKIE == _sgtrace.init_cookie);
+    sgtrace_range res = { 0, 0 };
+    if (_sgtrace.capture.state == _SGTRACE_CAPTURE_READY) {
+        res.ptr = _sgtrace.capture.buf.ptr;
+        res.size = _sgtrace.capture.buf.size;
+    }
+    return res;
+}
+
+SOKOL_API_IMPL bool sgtrace_begin_replay(const sgtrace_replay_desc_t* desc) {
+    SOKOL_ASSERT(desc);
+    SOKOL_ASSERT((desc->allocator.alloc_fn && desc->allocator.free_fn) || (!desc->allocator.alloc_fn && !desc->allocator.free_fn));
+    if (_sgtrace.replay.active) {
+        _SGTRACE_ERROR(REPLAY_ALREADY_ACTIVE);
+        return false;
+    }
+    _sgtrace.replay.active = true;
+    _sgtrace.replay.desc = *desc;
+    _sgtrace.replay.desc.data.ptr = 0;
+    _sgtrace.replay.desc.data.size = 0;
+    _sgtrace_header_t header;
+    if (!desc->data.ptr || (desc->data.size < sizeof(header))) {
+        _SGTRACE_ERROR(REPLAY_INVALID_DATA);
+        _sgtrace_replay_discard();
+        return false;
+    }
+    memcpy(&header, desc->data.ptr, sizeof(header));
+    uint32_t abi[_SGTRACE_ABI_NUM];
+    _sgtrace_abi(abi);
+    if (header.magic != _SGTRACE_MAGIC) {
+        _SGTRACE_ERROR(REPLAY_INVALID_DATA);
+    } else if (header.version != _SGTRACE_VERSION) {
+        _SGTRACE_ERROR(REPLAY_VERSION_MISMATCH);
+    } else if (0 != memcmp(header.abi, abi, sizeof(abi))) {
+        _SGTRACE_ERROR(REPLAY_ABI_MISMATCH);
+    } else if ((header.num_frames == 0) || (header.prologue_size > (desc->data.size - sizeof(header)))) {
+        _SGTRACE_ERROR(REPLAY_CORRUPT_DATA);
+    } else {
+        _sgtrace.replay.size = desc->data.size;
+        _sgtrace.replay.data = (uint8_t*) _sgtrace_malloc(desc->data.size);
+        memcpy(_sgtrace.replay.data, desc->data.ptr, desc->data.size);
+        _sgtrace.replay.prologue_size = header.prologue_size;
+        _sgtrace.replay.num_frames = (int)header.num_frames;
+        if (_sgtrace_replay_scan_frames() && _sgtrace_replay_prologue()) {
+            return true;
+        }
+        _SGTRACE_ERROR(REPLAY_CORRUPT_DATA);
+    }
+    _sgtrace_replay_discard();
+    return false;
+}
+
+SOKOL_API_IMPL int sgtrace_replay_num_frames(void) {
+    return _sgtrace.replay.active ? _sgtrace.replay.num_frames : 0;
+}
+
+SOKOL_API_IMPL int sgtrace_replay_frame_index(void) {
+    return _sgtrace.replay.active ? _sgtrace.replay.cur_frame : 0;
+}
+
+SOKOL_API_IMPL void sgtrace_replay_frame(sg_swapchain swapchain) {
+    SOKOL_ASSERT(_sgtrace.replay.active);
+    if (_sgtrace.replay.cur_frame >= _sgtrace.replay.num_frames) {
+        _sgtrace_replay_rewind();
+    }
+    const int frame = _sgtrace.replay.cur_frame++;
+    const size_t start = _sgtrace.replay.frame_offsets[frame];
+    const size_t end = _sgtrace.replay.frame_offsets[frame + 1];
+    _sgtrace_begin_read(_sgtrace.replay.data + start, end - start);
+    while (_sgtrace_replay_cmd(true, &swapchain)) { }
+    if (_sgtrace.io.error) {
+        _SGTRACE_ERROR(REPLAY_CORRUPT_DATA);
+    }
+}
+
+SOKOL_API_IMPL void sgtrace_end_replay(void) {
+    SOKOL_ASSERT(_sgtrace.replay.active);
+    _sgtrace_replay_discard();
+}
+#endif // SOKOL_GFX_TRACE_IMPL
@@ -506,6 +506,58 @@
     calls which require a currently active context will silently fail,
     and sgl_error() will return SGL_ERROR_NO_CONTEXT.
 
+    RECORDING ON WORKER THREADS:
+    ============================
+    The currently active context is global state, so normally all sokol-gl
+    recording for one context must happen on the same thread. To record
+    sokol-gl commands on worker threads (for instance debug visualization
+    running on job threads), create one 'record-only' context per worker
+    thread on the render thread:
+
+        sgl_context rec_ctx = sgl_make_context(&(sgl_context_desc_t){
+            .record_only = true,
+            .max_vertices = ...,
+            .max_commands = ...,
+        });
+
+    A record-only context doesn't own a sokol-gfx vertex buffer and isn't
+    rewound in sg_commit(), it can't be drawn directly, only 'spliced' into
+    a regular context.
+
+    On the worker thread, bind the record-only context as thread-local
+    current context and record as usual:
+
+        sgl_set_thread_context(rec_ctx);
+        sgl_begin_lines();
+        ...
+        sgl_end();
+        sgl_set_thread_context((sgl_context){ SG_INVALID_ID });
+
+    While a thread-local context is bound it takes precedence over the
+    global context set with sgl_set_context(), but only on the calling
+    thread. Binding and recording don't take any locks.
+
+    After the worker has finished recording (synchronization is up to
+    the job system), append the recorded vertices and commands to a
+    regular context on the render thread before drawing it:
+
+        sgl_context_splice(sgl_default_context(), rec_ctx);
+        ...
+        sgl_context_draw(sgl_default_context());
+
+    sgl_context_splice() copies the recorded vertices, uniforms and
+    commands (including layer ids) to the end of the destination context
+    and rewinds the source context for the next frame. Draw commands
+    which use the record-only context's default pipeline are redirected
+    to the destination context's default pipeline, so the pixel formats
+    of a record-only context don't matter unless it is used to create
+    custom pipelines. If the destination runs out of space the
+    destination's error flags are set, just like when recording directly.
+
+    Creating, destroying and splicing contexts, as well as creating
+    pipelines, must still happen on the render thread, and a record-only
+    context must not be spliced while a worker thread is recording into it.
+
     UNDER THE HOOD:
     ===============
     sokol_gl.h works by recording vertex data and rendering commands into
@@ -735,6 +787,7 @@ extern "C" {
     _SGL_LOGITEM_XMACRO(ADD_COMMIT_LISTENER_FAILED, "sg_add_commit_listener() failed") \
     _SGL_LOGITEM_XMACRO(CONTEXT_POOL_EXHAUSTED, "context pool exhausted (use sgl_desc_t.context_pool_size to adjust)") \
     _SGL_LOGITEM_XMACRO(CANNOT_DESTROY_DEFAULT_CONTEXT, "cannot destroy default context") \
+    _SGL_LOGITEM_XMACRO(CANNOT_DRAW_RECORD_ONLY_CONTEXT, "cannot draw a record-only context (use sgl_context_splice())") \
 
 #define _SGL_LOGITEM_XMACRO(item,msg) SGL_LOGITEM_##item,
 typedef enum sgl_log_item_t {
@@ -795,6 +848,7 @@ typedef struct sgl_context_desc_t {
     sg_pixel_format color_format;
     sg_pixel_format depth_format;
     int sample_count;
+    bool record_only;       // CPU-side recording only, see sgl_context_splice()
 } sgl_context_desc_t;
 
 /*
@@ -841,6 +895,8 @@ SOKOL_GL_API_DECL void sgl_destroy_context(sgl_context ctx);
 SOKOL_GL_API_DECL void sgl_set_context(sgl_context ctx);
 SOKOL_GL_API_DECL sgl_context sgl_get_context(void);
 SOKOL_GL_API_DECL sgl_context sgl_default_context(void);
+SOKOL_GL_API_DECL void sgl_set_thread_context(sgl_context ctx);
+SOKOL_GL_API_DECL void sgl_context_splice(sgl_context dst, sgl_context src);
 
 /* get information about recorded vertices and commands in current context */
 SOKOL_GL_API_DECL int sgl_num_vertices(void);
@@ -984,6 +1040,12 @@ inline sgl_pipeline sgl_context_make_pipeline(sgl_context ctx, const sg_pipeline
 #define _sgl_def(val, def) (((val) == 0) ? (def) : (val))
 #define _SGL_INIT_COOKIE (0xABCDABCD)
 
+#if defined(_MSC_VER)
+    #define _SGL_THREAD_LOCAL __declspec(thread)
+#else
+    #define _SGL_THREAD_LOCAL __thread
+#endif
+
 /*
     Embedded source code compiled with:
 
@@ -2875,6 +2937,8 @@ typedef struct {
     _sgl_context_pool_t context_pool;
 } _sgl_t;
 static _sgl_t _sgl;
+// per-thread current context override, see sgl_set_thread_context()
+static _SGL_THREAD_LOCAL _sgl_context_t* _sgl_thread_ctx;
 
 // ██       ██████   ██████   ██████  ██ ███    ██  ██████
 // ██      ██    ██ ██       ██       ██ ████   ██ ██
@@ -3315,25 +3379,30 @@ static void _sgl_init_context(sgl_context ctx_id, const sgl_context_desc_t* in_d
     ctx->uniforms.ptr = (_sgl_uniform_t*) _sgl_malloc((size_t)ctx->uniforms.cap * sizeof(_sgl_uniform_t));
     ctx->commands.ptr = (_sgl_command_t*) _sgl_malloc((size_t)ctx->commands.cap * sizeof(_sgl_command_t));
 
-    // create sokol-gfx resource objects
+    // create sokol-gfx resource objects (record-only contexts don't need
+    // a vertex buffer, and are rewound in sgl_context_splice() instead of sg_commit())
     sg_push_debug_group("sokol-gl");
 
-    sg_buffer_desc vbuf_desc;
-    _sgl_clear(&vbuf_desc, sizeof(vbuf_desc));
-    vbuf_desc.size = (size_t)ctx->vertices.cap * sizeof(_sgl_vertex_t);
-    vbuf_desc.usage.vertex_buffer = true;
-    vbuf_desc.usage.stream_update = true;
-    vbuf_desc.label = "sgl-vertex-buffer";
-    ctx->vbuf = sg_make_buffer(&vbuf_desc);
-    SOKOL_ASSERT(SG_INVALID_ID != ctx->vbuf.id);
-    ctx->bind.vertex_buffers[0] = ctx->vbuf;
+    if (!ctx->desc.record_only) {
+        sg_buffer_desc vbuf_desc;
+        _sgl_clear(&vbuf_desc, sizeof(vbuf_desc));
+        vbuf_desc.size = (size_t)ctx->vertices.cap * sizeof(_sgl_vertex_t);
+        vbuf_desc.usage.vertex_buffer = true;
+        vbuf_desc.usage.stream_update = true;
+        vbuf_desc.label = "sgl-vertex-buffer";
+        ctx->vbuf = sg_make_buffer(&vbuf_desc);
+        SOKOL_ASSERT(SG_INVALID_ID != ctx->vbuf.id);
+        ctx->bind.vertex_buffers[0] = ctx->vbuf;
+    }
 
     sg_pipeline_desc def_pip_desc;
     _sgl_clear(&def_pip_desc, sizeof(def_pip_desc));
     def_pip_desc.depth.write_enabled = true;
     ctx->def_pip = _sgl_make_pipeline(&def_pip_desc, &ctx->desc);
-    if (!sg_add_commit_listener(_sgl_make_commit_listener(ctx))) {
-        _SGL_ERROR(ADD_COMMIT_LISTENER_FAILED);
+    if (!ctx->desc.record_only) {
+        if (!sg_add_commit_listener(_sgl_make_commit_listener(ctx))) {
+            _SGL_ERROR(ADD_COMMIT_LISTENER_FAILED);
+        }
     }
     sg_pop_debug_group();
 
@@ -3373,9 +3442,11 @@ static void _sgl_destroy_context(sgl_context ctx_id) {
         ctx->commands.ptr = 0;
 
         sg_push_debug_group("sokol-gl");
-        sg_destroy_buffer(ctx->vbuf);
         _sgl_destroy_pipeline(ctx->def_pip);
-        sg_remove_commit_listener(_sgl_make_commit_listener(ctx));
+        if (!ctx->desc.record_only) {
+            sg_destroy_buffer(ctx->vbuf);
+            sg_remove_commit_listener(_sgl_make_commit_listener(ctx));
+        }
         sg_pop_debug_group();
 
         _sgl_reset_context(ctx);
@@ -3397,6 +3468,11 @@ static sgl_error_t _sgl_error_defaults(void) {
     return defaults;
 }
 
+// returns the thread-local context if one is bound, otherwise the global current context (may be 0!)
+static _sgl_context_t* _sgl_cur_ctx(void) {
+    return _sgl_thread_ctx ? _sgl_thread_ctx : _sgl.cur_ctx;
+}
+
 static int _sgl_num_vertices(_sgl_context_t* ctx) {
     return ctx->vertices.next;
 }
@@ -3855,6 +3931,10 @@ static bool _sgl_is_default_context(sgl_context ctx_id) {
 
 static void _sgl_draw(_sgl_context_t* ctx, int layer_id) {
     SOKOL_ASSERT(ctx);
+    if (ctx->desc.record_only) {
+        _SGL_WARN(CANNOT_DRAW_RECORD_ONLY_CONTEXT);
+        return;
+    }
     if ((ctx->vertices.next > 0) && (ctx->commands.next > 0)) {
         sg_push_debug_group("sokol-gl");
 
@@ -3924,6 +4004,66 @@ static void _sgl_draw(_sgl_context_t* ctx, int layer_id) {
     }
 }
 
+// append recorded vertices, uniforms and commands of src to dst, and rewind src
+static void _sgl_splice(_sgl_context_t* dst, _sgl_context_t* src) {
+    SOKOL_ASSERT(dst && src && (dst != src));
+    SOKOL_ASSERT(!src->in_begin);
+    if (src->error.any) {
+        dst->error.vertices_full |= src->error.vertices_full;
+        dst->error.uniforms_full |= src->error.uniforms_full;
+        dst->error.commands_full |= src->error.commands_full;
+        dst->error.stack_overflow |= src->error.stack_overflow;
+        dst->error.stack_underflow |= src->error.stack_underflow;
+        dst->error.any = true;
+    }
+    // don't record any new commands when the destination is in an error state
+    if (!dst->error.any && (src->commands.next > 0)) {
+        if ((dst->vertices.next + src->vertices.next) > dst->vertices.cap) {
+            dst->error.vertices_full = true;
+            dst->error.any = true;
+        } else if ((dst->uniforms.next + src->uniforms.next) > dst->uniforms.cap) {
+            dst->error.uniforms_full = true;
+            dst->error.any = true;
+        } else if ((dst->commands.next + src->commands.next) > dst->commands.cap) {
+            dst->error.commands_full = true;
+            dst->error.any = true;
+        } else {
+            const int base_vertex = dst->vertices.next;
+            const int base_uniform = dst->uniforms.next;
+            if (src->vertices.next > 0) {
+                memcpy(&dst->vertices.ptr[base_vertex], src->vertices.ptr, (size_t)src->vertices.next * sizeof(_sgl_vertex_t));
+            }
+            if (src->uniforms.next > 0) {
+                memcpy(&dst->uniforms.ptr[base_uniform], src->uniforms.ptr, (size_t)src->uniforms.next * sizeof(_sgl_uniform_t));
+            }
+            const _sgl_pipeline_t* src_def_pip = _sgl_lookup_pipeline(src->def_pip.id);
+            const _sgl_pipeline_t* dst_def_pip = _sgl_lookup_pipeline(dst->def_pip.id);
+            for (int i = 0; i < src->commands.next; i++) {
+                _sgl_command_t* cmd = &dst->commands.ptr[dst->commands.next++];
+                *cmd = src->commands.ptr[i];
+                if (cmd->cmd == SGL_COMMAND_DRAW) {
+                    cmd->args.draw.base_vertex += base_vertex;
+                    cmd->args.draw.uniform_index += base_uniform;
+                    // redirect the source context's default pipeline to the destination's
+                    if (src_def_pip && dst_def_pip) {
+                        for (int prim_type = 0; prim_type < SGL_NUM_PRIMITIVE_TYPES; prim_type++) {
+                            if (cmd->args.draw.pip.id == src_def_pip->pip[prim_type].id) {
+                                cmd->args.draw.pip = dst_def_pip->pip[prim_type];
+                                break;
+                            }
+                        }
+                    }
+                }
+            }
+            dst->vertices.next += src->vertices.next;
+            dst->uniforms.next += src->uniforms.next;
+            // the next sgl_end() on dst must not merge with a spliced command
+            dst->matrix_dirty = true;
+        }
+    }
+    _sgl_rewind(src);
+}
+
 static sgl_context_desc_t _sgl_as_context_desc(const sgl_desc_t* desc) {
     sgl_context_desc_t ctx_desc;
     _sgl_clear(&ctx_desc, sizeof(ctx_desc));
@@ -3970,11 +4110,12 @@ SOKOL_API_IMPL void sgl_shutdown(void) {
     _sgl_discard_context_pool();
     _sgl_discard_pipeline_pool();
     _sgl_discard_common();
+    _sgl_thread_ctx = 0;
     _sgl.init_cookie = 0;
 }
 
 SOKOL_API_IMPL sgl_error_t sgl_error(void) {
-    _sgl_context_t* ctx = _sgl.cur_ctx;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
     if (ctx) {
         return ctx->error;
     } else {
@@ -4020,6 +4161,10 @@ SOKOL_API_IMPL void sgl_destroy_context(sgl_context ctx_id) {
     // re-validate the current context pointer (this will return a nullptr
     // if we just destroyed the current context)
     _sgl.cur_ctx = _sgl_lookup_context(_sgl.cur_ctx_id.id);
+    // NOTE: only the calling thread's thread-local context can be re-validated
+    if (_sgl_thread_ctx && (_sgl_thread_ctx->slot.id == SG_INVALID_ID)) {
+        _sgl_thread_ctx = 0;
+    }
 }
 
 SOKOL_API_IMPL void sgl_set_context(sgl_context ctx_id) {
@@ -4035,6 +4180,9 @@ SOKOL_API_IMPL void sgl_set_context(sgl_context ctx_id) {
 
 SOKOL_API_IMPL sgl_context sgl_get_context(void) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
+    if (_sgl_thread_ctx) {
+        return _sgl_make_ctx_id(_sgl_thread_ctx->slot.id);
+    }
     return _sgl.cur_ctx_id;
 }
 
@@ -4042,9 +4190,24 @@ SOKOL_API_IMPL sgl_context sgl_default_context(void) {
     return SGL_DEFAULT_CONTEXT;
 }
 
+SOKOL_API_IMPL void sgl_set_thread_context(sgl_context ctx_id) {
+    SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
+    // this will return null if the handle isn't valid, which unbinds the thread-local context
+    _sgl_thread_ctx = _sgl_lookup_context(ctx_id.id);
+}
+
+SOKOL_API_IMPL void sgl_context_splice(sgl_context dst_id, sgl_context src_id) {
+    SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
+    _sgl_context_t* dst = _sgl_lookup_context(dst_id.id);
+    _sgl_context_t* src = _sgl_lookup_context(src_id.id);
+    if (dst && src && (dst != src)) {
+        _sgl_splice(dst, src);
+    }
+}
+
 SOKOL_API_IMPL int sgl_num_vertices(void) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
-    _sgl_context_t* ctx = _sgl.cur_ctx;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
     if (ctx) {
         return _sgl_num_vertices(ctx);
     } else {
@@ -4054,7 +4217,7 @@ SOKOL_API_IMPL int sgl_num_vertices(void) {
 
 SOKOL_API_IMPL int sgl_num_commands(void) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
-    _sgl_context_t* ctx = _sgl.cur_ctx;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
     if (ctx) {
         return _sgl_num_commands(ctx);
     } else {
@@ -4064,7 +4227,7 @@ SOKOL_API_IMPL int sgl_num_commands(void) {
 
 SOKOL_API_IMPL sgl_pipeline sgl_make_pipeline(const sg_pipeline_desc* desc) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
-    _sgl_context_t* ctx = _sgl.cur_ctx;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
     if (ctx) {
         return _sgl_make_pipeline(desc, &ctx->desc);
     } else {
@@ -4089,7 +4252,7 @@ SOKOL_API_IMPL void sgl_destroy_pipeline(sgl_pipeline pip_id) {
 
 SOKOL_API_IMPL void sgl_load_pipeline(sgl_pipeline pip_id) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
-    _sgl_context_t* ctx = _sgl.cur_ctx;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
     if (!ctx) {
         return;
     }
@@ -4099,7 +4262,7 @@ SOKOL_API_IMPL void sgl_load_pipeline(sgl_pipeline pip_id) {
 
 SOKOL_API_IMPL void sgl_load_default_pipeline(void) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
-    _sgl_context_t* ctx = _sgl.cur_ctx;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
     if (!ctx) {
         return;
     }
@@ -4109,7 +4272,7 @@ SOKOL_API_IMPL void sgl_load_default_pipeline(void) {
 
 SOKOL_API_IMPL void sgl_push_pipeline(void) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
-    _sgl_context_t* ctx = _sgl.cur_ctx;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
     if (!ctx) {
         return;
     }
@@ -4124,7 +4287,7 @@ SOKOL_API_IMPL void sgl_push_pipeline(void) {
 
 SOKOL_API_IMPL void sgl_pop_pipeline(void) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
-    _sgl_context_t* ctx = _sgl.cur_ctx;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
     if (!ctx) {
         return;
     }
@@ -4138,7 +4301,7 @@ SOKOL_API_IMPL void sgl_pop_pipeline(void) {
 
 SOKOL_API_IMPL void sgl_defaults(void) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
-    _sgl_context_t* ctx = _sgl.cur_ctx;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
     if (!ctx) {
         return;
     }
@@ -4159,7 +4322,7 @@ SOKOL_API_IMPL void sgl_defaults(void) {
 
 SOKOL_API_IMPL void sgl_layer(int layer_id) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
-    _sgl_context_t* ctx = _sgl.cur_ctx;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
     if (!ctx) {
         return;
     }
@@ -4169,7 +4332,7 @@ SOKOL_API_IMPL void sgl_layer(int layer_id) {
 
 SOKOL_API_IMPL void sgl_viewport(int x, int y, int w, int h, bool origin_top_left) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
-    _sgl_context_t* ctx = _sgl.cur_ctx;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
     if (!ctx) {
         return;
     }
@@ -4192,7 +4355,7 @@ SOKOL_API_IMPL void sgl_viewportf(float x, float y, float w, float h, bool origi
 
 SOKOL_API_IMPL void sgl_scissor_rect(int x, int y, int w, int h, bool origin_top_left) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
-    _sgl_context_t* ctx = _sgl.cur_ctx;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
     if (!ctx) {
         return;
     }
@@ -4215,7 +4378,7 @@ SOKOL_API_IMPL void sgl_scissor_rectf(float x, float y, float w, float h, bool o
 
 SOKOL_API_IMPL void sgl_enable_texture(void) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
-    _sgl_context_t* ctx = _sgl.cur_ctx;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
     if (!ctx) {
         return;
     }
@@ -4225,7 +4388,7 @@ SOKOL_API_IMPL void sgl_enable_texture(void) {
 
 SOKOL_API_IMPL void sgl_disable_texture(void) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
-    _sgl_context_t* ctx = _sgl.cur_ctx;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
     if (!ctx) {
         return;
     }
@@ -4235,7 +4398,7 @@ SOKOL_API_IMPL void sgl_disable_texture(void) {
 
 SOKOL_API_IMPL void sgl_texture(sg_image img, sg_sampler smp) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
-    _sgl_context_t* ctx = _sgl.cur_ctx;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
     if (!ctx) {
         return;
     }
@@ -4254,7 +4417,7 @@ SOKOL_API_IMPL void sgl_texture(sg_image img, sg_sampler smp) {
 
 SOKOL_API_IMPL void sgl_begin_points(void) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
-    _sgl_context_t* ctx = _sgl.cur_ctx;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
     if (!ctx) {
         return;
     }
@@ -4264,7 +4427,7 @@ SOKOL_API_IMPL void sgl_begin_points(void) {
 
 SOKOL_API_IMPL void sgl_begin_lines(void) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
-    _sgl_context_t* ctx = _sgl.cur_ctx;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
     if (!ctx) {
         return;
     }
@@ -4274,7 +4437,7 @@ SOKOL_API_IMPL void sgl_begin_lines(void) {
 
 SOKOL_API_IMPL void sgl_begin_line_strip(void) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
-    _sgl_context_t* ctx = _sgl.cur_ctx;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
     if (!ctx) {
         return;
     }
@@ -4284,7 +4447,7 @@ SOKOL_API_IMPL void sgl_begin_line_strip(void) {
 
 SOKOL_API_IMPL void sgl_begin_triangles(void) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
-    _sgl_context_t* ctx = _sgl.cur_ctx;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
     if (!ctx) {
         return;
     }
@@ -4294,7 +4457,7 @@ SOKOL_API_IMPL void sgl_begin_triangles(void) {
 
 SOKOL_API_IMPL void sgl_begin_triangle_strip(void) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
-    _sgl_context_t* ctx = _sgl.cur_ctx;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
     if (!ctx) {
         return;
     }
@@ -4304,7 +4467,7 @@ SOKOL_API_IMPL void sgl_begin_triangle_strip(void) {
 
 SOKOL_API_IMPL void sgl_begin_quads(void) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
-    _sgl_context_t* ctx = _sgl.cur_ctx;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
     if (!ctx) {
         return;
     }
@@ -4314,7 +4477,7 @@ SOKOL_API_IMPL void sgl_begin_quads(void) {
 
 SOKOL_API_IMPL void sgl_end(void) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
-    _sgl_context_t* ctx = _sgl.cur_ctx;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
     if (!ctx) {
         return;
     }
@@ -4377,14 +4540,14 @@ SOKOL_API_IMPL void sgl_end(void) {
 }
 
 SOKOL_API_IMPL void sgl_point_size(float s) {
-    _sgl_context_t* ctx = _sgl.cur_ctx;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
     if (ctx) {
         ctx->point_size = s;
     }
 }
 
 SOKOL_API_IMPL void sgl_t2f(float u, float v) {
-    _sgl_context_t* ctx = _sgl.cur_ctx;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
     if (ctx) {
         ctx->u = u;
         ctx->v = v;
@@ -4392,203 +4555,203 @@ SOKOL_API_IMPL void sgl_t2f(float u, float v) {
 }
 
 SOKOL_API_IMPL void sgl_c3f(float r, float g, float b) {
-    _sgl_context_t* ctx = _sgl.cur_ctx;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
     if (ctx) {
         ctx->rgba = _sgl_pack_rgbaf(r, g, b, 1.0f);
     }
 }
 
 SOKOL_API_IMPL void sgl_c4f(float r, float g, float b, float a) {
-    _sgl_context_t* ctx = _sgl.cur_ctx;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
     if (ctx) {
         ctx->rgba = _sgl_pack_rgbaf(r, g, b, a);
     }
 }
 
 SOKOL_API_IMPL void sgl_c3b(uint8_t r, uint8_t g, uint8_t b) {
-    _sgl_context_t* ctx = _sgl.cur_ctx;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
     if (ctx) {
         ctx->rgba = _sgl_pack_rgbab(r, g, b, 255);
     }
 }
 
 SOKOL_API_IMPL void sgl_c4b(uint8_t r, uint8_t g, uint8_t b, uint8_t a) {
-    _sgl_context_t* ctx = _sgl.cur_ctx;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
     if (ctx) {
         ctx->rgba = _sgl_pack_rgbab(r, g, b, a);
     }
 }
 
 SOKOL_API_IMPL void sgl_c1i(uint32_t rgba) {
-    _sgl_context_t* ctx = _sgl.cur_ctx;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
     if (ctx) {
         ctx->rgba = rgba;
     }
 }
 
 SOKOL_API_IMPL void sgl_v2f(float x, float y) {
-    _sgl_context_t* ctx = _sgl.cur_ctx;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
     if (ctx) {
         _sgl_vtx(ctx, x, y, 0.0f, ctx->u, ctx->v, ctx->rgba);
     }
 }
 
 SOKOL_API_IMPL void sgl_v3f(float x, float y, float z) {
-    _sgl_context_t* ctx = _sgl.cur_ctx;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
     if (ctx) {
         _sgl_vtx(ctx, x, y, z, ctx->u, ctx->v, ctx->rgba);
     }
 }
 
 SOKOL_API_IMPL void sgl_v2f_t2f(float x, float y, float u, float v) {
-    _sgl_context_t* ctx = _sgl.cur_ctx;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
     if (ctx) {
         _sgl_vtx(ctx, x, y, 0.0f, u, v, ctx->rgba);
     }
 }
 
 SOKOL_API_IMPL void sgl_v3f_t2f(float x, float y, float z, float u, float v) {
-    _sgl_context_t* ctx = _sgl.cur_ctx;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
     if (ctx) {
         _sgl_vtx(ctx, x, y, z, u, v, ctx->rgba);
     }
 }
 
 SOKOL_API_IMPL void sgl_v2f_c3f(float x, float y, float r, float g, float b) {
-    _sgl_context_t* ctx = _sgl.cur_ctx;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
     if (ctx) {
         _sgl_vtx(ctx, x, y, 0.0f, ctx->u, ctx->v, _sgl_pack_rgbaf(r, g, b, 1.0f));
     }
 }
 
 SOKOL_API_IMPL void sgl_v2f_c3b(float x, float y, uint8_t r, uint8_t g, uint8_t b) {
-    _sgl_context_t* ctx = _sgl.cur_ctx;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
     if (ctx) {
         _sgl_vtx(ctx, x, y, 0.0f, ctx->u, ctx->v, _sgl_pack_rgbab(r, g, b, 255));
     }
 }
 
 SOKOL_API_IMPL void sgl_v2f_c4f(float x, float y, float r, float g, float b, float a) {
-    _sgl_context_t* ctx = _sgl.cur_ctx;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
     if (ctx) {
         _sgl_vtx(ctx, x, y, 0.0f, ctx->u, ctx->v, _sgl_pack_rgbaf(r, g, b, a));
     }
 }
 
 SOKOL_API_IMPL void sgl_v2f_c4b(float x, float y, uint8_t r, uint8_t g, uint8_t b, uint8_t a) {
-    _sgl_context_t* ctx = _sgl.cur_ctx;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
     if (ctx) {
         _sgl_vtx(ctx, x, y, 0.0f, ctx->u, ctx->v, _sgl_pack_rgbab(r, g, b, a));
     }
 }
 
 SOKOL_API_IMPL void sgl_v2f_c1i(float x, float y, uint32_t rgba) {
-    _sgl_context_t* ctx = _sgl.cur_ctx;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
     if (ctx) {
         _sgl_vtx(ctx, x, y, 0.0f, ctx->u, ctx->v, rgba);
     }
 }
 
 SOKOL_API_IMPL void sgl_v3f_c3f(float x, float y, float z, float r, float g, float b) {
-    _sgl_context_t* ctx = _sgl.cur_ctx;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
     if (ctx) {
         _sgl_vtx(ctx, x, y, z, ctx->u, ctx->v, _sgl_pack_rgbaf(r, g, b, 1.0f));
     }
 }
 
 SOKOL_API_IMPL void sgl_v3f_c3b(float x, float y, float z, uint8_t r, uint8_t g, uint8_t b) {
-    _sgl_context_t* ctx = _sgl.cur_ctx;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
     if (ctx) {
         _sgl_vtx(ctx, x, y, z, ctx->u, ctx->v, _sgl_pack_rgbab(r, g, b, 255));
     }
 }
 
 SOKOL_API_IMPL void sgl_v3f_c4f(float x, float y, float z, float r, float g, float b, float a) {
-    _sgl_context_t* ctx = _sgl.cur_ctx;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
     if (ctx) {
         _sgl_vtx(ctx, x, y, z, ctx->u, ctx->v, _sgl_pack_rgbaf(r, g, b, a));
     }
 }
 
 SOKOL_API_IMPL void sgl_v3f_c4b(float x, float y, float z, uint8_t r, uint8_t g, uint8_t b, uint8_t a) {
-    _sgl_context_t* ctx = _sgl.cur_ctx;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
     if (ctx) {
         _sgl_vtx(ctx, x, y, z, ctx->u, ctx->v, _sgl_pack_rgbab(r, g, b, a));
     }
 }
 
 SOKOL_API_IMPL void sgl_v3f_c1i(float x, float y, float z, uint32_t rgba) {
-    _sgl_context_t* ctx = _sgl.cur_ctx;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
     if (ctx) {
         _sgl_vtx(ctx, x, y, z, ctx->u, ctx->v, rgba);
     }
 }
 
 SOKOL_API_IMPL void sgl_v2f_t2f_c3f(float x, float y, float u, float v, float r, float g, float b) {
-    _sgl_context_t* ctx = _sgl.cur_ctx;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
     if (ctx) {
         _sgl_vtx(ctx, x, y, 0.0f, u, v, _sgl_pack_rgbaf(r, g, b, 1.0f));
     }
 }
 
 SOKOL_API_IMPL void sgl_v2f_t2f_c3b(float x, float y, float u, float v, uint8_t r, uint8_t g, uint8_t b) {
-    _sgl_context_t* ctx = _sgl.cur_ctx;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
     if (ctx) {
         _sgl_vtx(ctx, x, y, 0.0f, u, v, _sgl_pack_rgbab(r, g, b, 255));
     }
 }
 
 SOKOL_API_IMPL void sgl_v2f_t2f_c4f(float x, float y, float u, float v, float r, float g, float b, float a) {
-    _sgl_context_t* ctx = _sgl.cur_ctx;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
     if (ctx) {
         _sgl_vtx(ctx, x, y, 0.0f, u, v, _sgl_pack_rgbaf(r, g, b, a));
     }
 }
 
 SOKOL_API_IMPL void sgl_v2f_t2f_c4b(float x, float y, float u, float v, uint8_t r, uint8_t g, uint8_t b, uint8_t a) {
-    _sgl_context_t* ctx = _sgl.cur_ctx;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
     if (ctx) {
         _sgl_vtx(ctx, x, y, 0.0f, u, v, _sgl_pack_rgbab(r, g, b, a));
     }
 }
 
 SOKOL_API_IMPL void sgl_v2f_t2f_c1i(float x, float y, float u, float v, uint32_t rgba) {
-    _sgl_context_t* ctx = _sgl.cur_ctx;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
     if (ctx) {
         _sgl_vtx(ctx, x, y, 0.0f, u, v, rgba);
     }
 }
 
 SOKOL_API_IMPL void sgl_v3f_t2f_c3f(float x, float y, float z, float u, float v, float r, float g, float b) {
-    _sgl_context_t* ctx = _sgl.cur_ctx;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
     if (ctx) {
         _sgl_vtx(ctx, x, y, z, u, v, _sgl_pack_rgbaf(r, g, b, 1.0f));
     }
 }
 
 SOKOL_API_IMPL void sgl_v3f_t2f_c3b(float x, float y, float z, float u, float v, uint8_t r, uint8_t g, uint8_t b) {
-    _sgl_context_t* ctx = _sgl.cur_ctx;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
     if (ctx) {
         _sgl_vtx(ctx, x, y, z, u, v, _sgl_pack_rgbab(r, g, b, 255));
     }
 }
 
 SOKOL_API_IMPL void sgl_v3f_t2f_c4f(float x, float y, float z, float u, float v, float r, float g, float b, float a) {
-    _sgl_context_t* ctx = _sgl.cur_ctx;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
     if (ctx) {
         _sgl_vtx(ctx, x, y, z, u, v, _sgl_pack_rgbaf(r, g, b, a));
     }
 }
 
 SOKOL_API_IMPL void sgl_v3f_t2f_c4b(float x, float y, float z, float u, float v, uint8_t r, uint8_t g, uint8_t b, uint8_t a) {
-    _sgl_context_t* ctx = _sgl.cur_ctx;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
     if (ctx) {
         _sgl_vtx(ctx, x, y, z, u, v, _sgl_pack_rgbab(r, g, b, a));
     }
 }
 
 SOKOL_API_IMPL void sgl_v3f_t2f_c1i(float x, float y, float z, float u, float v, uint32_t rgba) {
-    _sgl_context_t* ctx = _sgl.cur_ctx;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
     if (ctx) {
         _sgl_vtx(ctx,x, y, z, u, v, rgba);
     }
@@ -4596,7 +4759,7 @@ SOKOL_API_IMPL void sgl_v3f_t2f_c1i(float x, float y, float z, float u, float v,
 
 SOKOL_API_IMPL void sgl_matrix_mode_modelview(void) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
-    _sgl_context_t* ctx = _sgl.cur_ctx;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
     if (ctx) {
         ctx->cur_matrix_mode = SGL_MATRIXMODE_MODELVIEW;
     }
@@ -4604,7 +4767,7 @@ SOKOL_API_IMPL void sgl_matrix_mode_modelview(void) {
 
 SOKOL_API_IMPL void sgl_matrix_mode_projection(void) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
-    _sgl_context_t* ctx = _sgl.cur_ctx;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
     if (ctx) {
         ctx->cur_matrix_mode = SGL_MATRIXMODE_PROJECTION;
     }
@@ -4612,7 +4775,7 @@ SOKOL_API_IMPL void sgl_matrix_mode_projection(void) {
 
 SOKOL_API_IMPL void sgl_matrix_mode_texture(void) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
-    _sgl_context_t* ctx = _sgl.cur_ctx;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
     if (ctx) {
         ctx->cur_matrix_mode = SGL_MATRIXMODE_TEXTURE;
     }
@@ -4620,7 +4783,7 @@ SOKOL_API_IMPL void sgl_matrix_mode_texture(void) {
 
 SOKOL_API_IMPL void sgl_load_identity(void) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
-    _sgl_context_t* ctx = _sgl.cur_ctx;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
     if (!ctx) {
         return;
     }
@@ -4630,7 +4793,7 @@ SOKOL_API_IMPL void sgl_load_identity(void) {
 
 SOKOL_API_IMPL void sgl_load_matrix(const float m[16]) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
-    _sgl_context_t* ctx = _sgl.cur_ctx;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
     if (!ctx) {
         return;
     }
@@ -4640,7 +4803,7 @@ SOKOL_API_IMPL void sgl_load_matrix(const float m[16]) {
 
 SOKOL_API_IMPL void sgl_load_transpose_matrix(const float m[16]) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
-    _sgl_context_t* ctx = _sgl.cur_ctx;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
     if (!ctx) {
         return;
     }
@@ -4650,7 +4813,7 @@ SOKOL_API_IMPL void sgl_load_transpose_matrix(const float m[16]) {
 
 SOKOL_API_IMPL void sgl_mult_matrix(const float m[16]) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
-    _sgl_context_t* ctx = _sgl.cur_ctx;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
     if (!ctx) {
         return;
     }
@@ -4661,7 +4824,7 @@ SOKOL_API_IMPL void sgl_mult_matrix(const float m[16]) {
 
 SOKOL_API_IMPL void sgl_mult_transpose_matrix(const float m[16]) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
-    _sgl_context_t* ctx = _sgl.cur_ctx;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
     if (!ctx) {
         return;
     }
@@ -4673,7 +4836,7 @@ SOKOL_API_IMPL void sgl_mult_transpose_matrix(const float m[16]) {
 
 SOKOL_API_IMPL void sgl_rotate(float angle_rad, float x, float y, float z) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
-    _sgl_context_t* ctx = _sgl.cur_ctx;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
     if (!ctx) {
         return;
     }
@@ -4683,7 +4846,7 @@ SOKOL_API_IMPL void sgl_rotate(float angle_rad, float x, float y, float z) {
 
 SOKOL_API_IMPL void sgl_scale(float x, float y, float z) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
-    _sgl_context_t* ctx = _sgl.cur_ctx;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
     if (!ctx) {
         return;
     }
@@ -4693,7 +4856,7 @@ SOKOL_API_IMPL void sgl_scale(float x, float y, float z) {
 
 SOKOL_API_IMPL void sgl_translate(float x, float y, float z) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
-    _sgl_context_t* ctx = _sgl.cur_ctx;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
     if (!ctx) {
         return;
     }
@@ -4703,7 +4866,7 @@ SOKOL_API_IMPL void sgl_translate(float x, float y, float z) {
 
 SOKOL_API_IMPL void sgl_frustum(float l, float r, float b, float t, float n, float f) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
-    _sgl_context_t* ctx = _sgl.cur_ctx;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
     if (!ctx) {
         return;
     }
@@ -4713,7 +4876,7 @@ SOKOL_API_IMPL void sgl_frustum(float l, float r, float b, float t, float n, flo
 
 SOKOL_API_IMPL void sgl_ortho(float l, float r, float b, float t, float n, float f) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
-    _sgl_context_t* ctx = _sgl.cur_ctx;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
     if (!ctx) {
         return;
     }
@@ -4723,7 +4886,7 @@ SOKOL_API_IMPL void sgl_ortho(float l, float r, float b, float t, float n, float
 
 SOKOL_API_IMPL void sgl_perspective(float fov_y, float aspect, float z_near, float z_far) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
-    _sgl_context_t* ctx = _sgl.cur_ctx;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
     if (!ctx) {
         return;
     }
@@ -4733,7 +4896,7 @@ SOKOL_API_IMPL void sgl_perspective(float fov_y, float aspect, float z_near, flo
 
 SOKOL_API_IMPL void sgl_lookat(float eye_x, float eye_y, float eye_z, float center_x, float center_y, float center_z, float up_x, float up_y, float up_z) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
-    _sgl_context_t* ctx = _sgl.cur_ctx;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
     if (!ctx) {
         return;
     }
@@ -4743,7 +4906,7 @@ SOKOL_API_IMPL void sgl_lookat(float eye_x, float eye_y, float eye_z, float cent
 
 SOKOL_GL_API_DECL void sgl_push_matrix(void) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
-    _sgl_context_t* ctx = _sgl.cur_ctx;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
     if (!ctx) {
         return;
     }
@@ -4762,7 +4925,7 @@ SOKOL_GL_API_DECL void sgl_push_matrix(void) {
 
 SOKOL_GL_API_DECL void sgl_pop_matrix(void) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
-    _sgl_context_t* ctx = _sgl.cur_ctx;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
     if (!ctx) {
         return;
     }
@@ -4778,7 +4941,7 @@ SOKOL_GL_API_DECL void sgl_pop_matrix(void) {
 
 SOKOL_API_IMPL void sgl_draw(void) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
-    _sgl_context_t* ctx = _sgl.cur_ctx;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
     if (ctx) {
         _sgl_draw(ctx, 0);
     }
@@ -4786,7 +4949,7 @@ SOKOL_API_IMPL void sgl_draw(void) {
 
 SOKOL_API_IMPL void sgl_draw_layer(int layer_id) {
     SOKOL_ASSERT(_SGL_INIT_COOKIE == _sgl.init_cookie);
-    _sgl_context_t* ctx = _sgl.cur_ctx;
+    _sgl_context_t* ctx = _sgl_cur_ctx();
     if (ctx) {
         _sgl_draw(ctx, layer_id);
     }
@@ -0,0 +1,6 @@
+#if defined(IMPL)
+#define SOKOL_GPU_CULL_IMPL
+#endif
+#include "sokol_defines.h"
+#include "sokol_gfx.h"
+#include "sokol_gpu_cull.h"
@@ -0,0 +1,1187 @@
+#if defined(SOKOL_IMPL) && !defined(SOKOL_GPU_CULL_IMPL)
+#define SOKOL_GPU_CULL_IMPL
+#endif
+#ifndef SOKOL_GPU_CULL_INCLUDED
+/*
+    sokol_gpu_cull.h -- frustum-cull instances in a compute shader and write indirect draw arguments
+
+    Project URL: https://github.com/Ed94/SectrPrototype (Sectr fork of sokol-odin)
+
+    This header is an addition of the Sectr fork and is not part of the upstream
+    sokol headers (https://github.com/floooh/sokol), it follows their API conventions.
+
+    Do this:
+        #define SOKOL_IMPL or
+        #define SOKOL_GPU_CULL_IMPL
+    before you include this file in *one* C or C++ file to create the
+    implementation.
+
+    The following defines are used by the implementation to select the
+    platform-specific embedded shader code (these are the same defines as
+    used by sokol_gfx.h and sokol_app.h):
+
+    SOKOL_GLCORE
+    SOKOL_GLES3
+    SOKOL_D3D11
+    SOKOL_METAL
+    SOKOL_WGPU
+    SOKOL_DUMMY_BACKEND
+
+    Optionally provide the following defines with your own implementations:
+
+    SOKOL_ASSERT(c)             - your own assert macro (default: assert(c))
+    SOKOL_GPU_CULL_API_DECL     - public function declaration prefix (default: extern)
+    SOKOL_API_DECL              - same as SOKOL_GPU_CULL_API_DECL
+    SOKOL_API_IMPL              - public function implementation prefix (default: -)
+
+    If sokol_gpu_cull.h is compiled as a DLL, define the following before
+    including the declaration or implementation:
+
+    SOKOL_DLL
+
+    On Windows, SOKOL_DLL will define SOKOL_GPU_CULL_API_DECL as __declspec(dllexport)
+    or __declspec(dllimport) as needed.
+
+    Include the following headers before including sokol_gpu_cull.h:
+
+        sokol_gfx.h
+
+    FEATURES AND CONCEPTS
+    =====================
+    - a reusable compute stage which tests the bounding spheres of up to
+      a few million instances against the view frustum on the GPU
+    - the indices of the visible instances are written tightly packed into
+      a storage buffer, and the number of visible instances is written
+      into an indirect draw arguments buffer
+    - the following render pass renders the visible instances with a
+      single sg_draw_indirect() call, without a round trip to the CPU
+    - the vertex shader of the render pass looks up the visible instance
+      index by the builtin instance index, and reads the per-instance data
+      from its own storage buffer(s):
+
+            layout(binding=0) readonly buffer visible_buf { uint visible[]; };
+            layout(binding=1) readonly buffer instances_buf { instance_t instances[]; };
+            ...
+            instance_t inst = instances[visible[gl_InstanceIndex]];
+
+    - sokol_gpu_cull.h requires compute shader and indirect draw support,
+      check sg_query_features().draw_indirect
+
+    STEP BY STEP
+    ============
+    --- call scull_setup() after sg_setup():
+
+            sg_setup(&(sg_desc){ ... });
+            scull_setup(&(scull_desc_t){ .logger.func = slog_func });
+
+    --- create the three buffers used by the culling stage:
+
+        - a storage buffer with the instance bounding spheres, one vec4 per
+          instance with the sphere center in xyz and the radius in w
+        - a storage buffer which receives the visible instance indices, one
+          uint32_t per instance
+        - a buffer which receives the indirect draw arguments, this needs
+          both storage buffer and indirect buffer usage:
+
+            sg_buffer bounds_buf = sg_make_buffer(&(sg_buffer_desc){
+                .usage.storage_buffer = true,
+                .data = { bounds, num_instances * 4 * sizeof(float) },
+            });
+            sg_buffer visible_buf = sg_make_buffer(&(sg_buffer_desc){
+                .usage.storage_buffer = true,
+                .size = num_instances * sizeof(uint32_t),
+            });
+            sg_buffer args_buf = sg_make_buffer(&(sg_buffer_desc){
+                .usage = { .storage_buffer = true, .indirect_buffer = true },
+                .size = sizeof(sg_draw_indexed_indirect_args),
+            });
+
+    --- each frame, call scull_cull() inside a compute pass:
+
+            sg_begin_pass(&(sg_pass){ .compute = true });
+            scull_cull(&(scull_cull_desc){
+                .bounds = bounds_buf,
+                .visible = visible_buf,
+                .args = args_buf,
+                .num_instances = num_instances,
+                .view_proj = { ... },   // column-major view-projection matrix
+                .indexed = true,
+                .num_elements = 36,
+            });
+            sg_end_pass();
+
+        The .indexed, .num_elements, .base_element and .base_vertex items
+        are copied into the indirect draw arguments, .indexed must match
+        the index type of the render pipeline.
+
+        NOTE: scull_cull() applies its own compute pipeline, bindings and
+        uniforms, so you need to apply your own state again afterwards.
+
+    --- in the following render pass, render the visible instances:
+
+            sg_apply_pipeline(pip);
+            sg_apply_bindings(&(sg_bindings){
+                .vertex_buffers[0] = vbuf,
+                .index_buffer = ibuf,
+                .storage_buffers = {
+                    [SBUF_visible] = visible_buf,
+                    [SBUF_instances] = instances_buf,
+                },
+            });
+            sg_draw_indirect(args_buf, 0);
+
+    --- call scull_shutdown() before sg_shutdown():
+
+            scull_shutdown();
+            sg_shutdown();
+
+    LIMITATIONS
+    ===========
+    - the frustum planes are extracted from the view-projection matrix with
+      the OpenGL clip space convention (-w <= z <= w), with a D3D-style
+      projection matrix (0 <= z <= w) the near plane test is conservative
+      (e.g. some instances in front of the near plane are considered visible)
+    - the order of the visible instance indices is non-deterministic
+    - num_instances is limited to 65535 * 64 because of the max number of
+      compute workgroups per dispatch
+    - the arguments are always written to the start of the args buffer
+
+    ERROR REPORTING AND LOGGING
+    ===========================
+    To get any logging information at all you need to provide a logging callback in the setup call,
+    the easiest way is to use sokol_log.h:
+
+        #include "sokol_log.h"
+
+        scull_setup(&(scull_desc_t){
+            // ...
+            .logger.func = slog_func
+        });
+
+    LICENSE
+    =======
+    zlib/libpng license
+
+    Copyright (c) 2026 the Sectr fork contributors
+
+    This software is provided 'as-is', without any express or implied warranty.
+    In no event will the authors be held liable for any damages arising from the
+    use of this software.
+
+    Permission is granted to anyone to use this software for any purpose,
+    including commercial applications, and to alter it and redistribute it
+    freely, subject to the following restrictions:
+
+        1. The origin of this software must not be misrepresented; you must not
+        claim that you wrote the original software. If you use this software in a
+        product, an acknowledgment in the product documentation would be
+        appreciated but is not required.
+
+        2. Altered source versions must be plainly marked as such, and must not
+        be misrepresented as being the original software.
+
+        3. This notice may not be removed or altered from any source
+        distribution.
+*/
+#define SOKOL_GPU_CULL_INCLUDED (1)
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h> // size_t
+
+#if !defined(SOKOL_GFX_INCLUDED)
+#error "Please include sokol_gfx.h before sokol_gpu_cull.h"
+#endif
+
+#if defined(SOKOL_API_DECL) && !defined(SOKOL_GPU_CULL_API_DECL)
+#define SOKOL_GPU_CULL_API_DECL SOKOL_API_DECL
+#endif
+#ifndef SOKOL_GPU_CULL_API_DECL
+#if defined(_WIN32) && defined(SOKOL_DLL) && defined(SOKOL_GPU_CULL_IMPL)
+#define SOKOL_GPU_CULL_API_DECL __declspec(dllexport)
+#elif defined(_WIN32) && defined(SOKOL_DLL)
+#define SOKOL_GPU_CULL_API_DECL __declspec(dllimport)
+#else
+#define SOKOL_GPU_CULL_API_DECL extern
+#endif
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+    scull_log_item_t
+
+    Log items are defined via X-Macros, and expanded to an
+    enum 'scull_log_item' - and in debug mode only - corresponding strings.
+
+    Used as parameter in the logging callback.
+*/
+#define _SCULL_LOG_ITEMS \
+    _SCULL_LOGITEM_XMACRO(OK, "Ok") \
+    _SCULL_LOGITEM_XMACRO(NOT_SUPPORTED, "compute shaders or indirect draws not supported, scull_cull() will do nothing (see sg_features.draw_indirect)") \
+    _SCULL_LOGITEM_XMACRO(CREATE_SHADER_FAILED, "failed to create the culling compute shader") \
+    _SCULL_LOGITEM_XMACRO(CREATE_PIPELINE_FAILED, "failed to create the culling compute pipeline") \
+    _SCULL_LOGITEM_XMACRO(TOO_MANY_INSTANCES, "scull_cull_desc.num_instances exceeds the max number of instances per dispatch (65535 * 64), culling skipped") \
+
+#define _SCULL_LOGITEM_XMACRO(item,msg) SCULL_LOGITEM_##item,
+typedef enum scull_log_item_t {
+    _SCULL_LOG_ITEMS
+} scull_log_item_t;
+#undef _SCULL_LOGITEM_XMACRO
+
+/*
+    scull_logger_t
+
+    Used in scull_desc_t to provide a custom logging and error reporting
+    callback to sokol-gpu-cull.
+*/
+typedef struct scull_logger_t {
+    void (*func)(
+        const char* tag,                // always "scull"
+        uint32_t log_level,             // 0=panic, 1=error, 2=warning, 3=info
+        uint32_t log_item_id,           // SCULL_LOGITEM_*
+        const char* message_or_null,    // a message string, may be nullptr in release mode
+        uint32_t line_nr,               // line number in sokol_gpu_cull.h
+        const char* filename_or_null,   // source filename, may be nullptr in release mode
+        void* user_data);
+    void* user_data;
+} scull_logger_t;
+
+/*
+    scull_desc_t
+
+    Describes the culling stage setup parameters, passed to scull_setup().
+*/
+typedef struct scull_desc_t {
+    scull_logger_t logger;                  // optional log override function (default: NO LOGGING)
+} scull_desc_t;
+
+/*
+    scull_cull_desc
+
+    Describes one culling dispatch, passed to scull_cull().
+*/
+typedef struct scull_cull_desc {
+    sg_buffer bounds;       // storage buffer with one vec4 (center.xyz, radius) per instance
+    sg_buffer visible;      // storage buffer receiving one uint32_t index per visible instance
+    sg_buffer args;         // storage+indirect buffer receiving the indirect draw arguments
+    int num_instances;      // number of instances in the bounds buffer
+    float view_proj[16];    // column-major view-projection matrix
+    bool indexed;           // write sg_draw_indexed_indirect_args instead of sg_draw_indirect_args
+    int num_elements;       // number of vertices or indices per instance
+    int base_element;       // first vertex or index
+    int base_vertex;        // added to each index (only for indexed rendering)
+} scull_cull_desc;
+
+/* setup and shutdown */
+SOKOL_GPU_CULL_API_DECL void scull_setup(const scull_desc_t* desc);
+SOKOL_GPU_CULL_API_DECL void scull_shutdown(void);
+
+/* frustum-cull instances and write the indirect draw arguments (inside a compute pass) */
+SOKOL_GPU_CULL_API_DECL void scull_cull(const scull_cull_desc* desc);
+
+#ifdef __cplusplus
+} /* extern "C" */
+/* C++ const-ref wrappers */
+inline void scull_setup(const scull_desc_t& desc) { return scull_setup(&desc); }
+inline void scull_cull(const scull_cull_desc& desc) { return scull_cull(&desc); }
+#endif
+#endif /* SOKOL_GPU_CULL_INCLUDED */
+
+// ██ ███    ███ ██████  ██      ███████ ███    ███ ███████ ███    ██ ████████  █████  ████████ ██  ██████  ███    ██
+// ██ ████  ████ ██   ██ ██      ██      ████  ████ ██      ████   ██    ██    ██   ██    ██    ██ ██    ██ ████   ██
+// ██ ██ ████ ██ ██████  ██      █████   ██ ████ ██ █████   ██ ██  ██    ██    ███████    ██    ██ ██    ██ ██ ██  ██
+// ██ ██  ██  ██ ██      ██      ██      ██  ██  ██ ██      ██  ██ ██    ██    ██   ██    ██    ██ ██    ██ ██  ██ ██
+// ██ ██      ██ ██      ███████ ███████ ██      ██ ███████ ██   ████    ██    ██   ██    ██    ██  ██████  ██   ████
+//
+// >>implementation
+#ifdef SOKOL_GPU_CULL_IMPL
+#define SOKOL_GPU_CULL_IMPL_INCLUDED (1)
+
+#include <string.h> // memset
+#include <stdlib.h> // abort
+#include <math.h>   // sqrtf
+
+#ifndef SOKOL_API_IMPL
+    #define SOKOL_API_IMPL
+#endif
+#ifndef SOKOL_DEBUG
+    #ifndef NDEBUG
+        #define SOKOL_DEBUG
+    #endif
+#endif
+#ifndef SOKOL_ASSERT
+    #include <assert.h>
+    #define SOKOL_ASSERT(c) assert(c)
+#endif
+#ifndef _SOKOL_UNUSED
+    #define _SOKOL_UNUSED(x) (void)(x)
+#endif
+
+#define _SCULL_INIT_COOKIE (0xABCDCAFE)
+#define _SCULL_THREADS_PER_GROUP (64)
+#define _SCULL_MAX_GROUPS (65535)
+#define _SCULL_MODE_CLEAR (0)
+#define _SCULL_MODE_CULL (1)
+
+// storage buffer bind slots
+enum {
+    _SCULL_SBUF_BOUNDS = 0,
+    _SCULL_SBUF_VISIBLE = 1,
+    _SCULL_SBUF_ARGS = 2,
+};
+
+// the uniform block of the compute shader, all members are vec4-sized
+typedef struct {
+    float planes[6][4];
+    int32_t counts[4];      // num_instances, num_elements, base_element, base_vertex
+    int32_t flags[4];       // mode, indexed, unused, unused
+} _scull_params_t;
+
+typedef struct {
+    uint32_t init_cookie;
+    scull_desc_t desc;
+    bool supported;
+    sg_shader shd;
+    sg_pipeline pip;
+} _scull_t;
+static _scull_t _scull;
+
+// ██       ██████   ██████   ██████  ██ ███    ██  ██████
+// ██      ██    ██ ██       ██       ██ ████   ██ ██
+// ██      ██    ██ ██   ███ ██   ███ ██ ██ ██  ██ ██   ███
+// ██      ██    ██ ██    ██ ██    ██ ██ ██  ██ ██ ██    ██
+// ███████  ██████   ██████   ██████  ██ ██   ████  ██████
+//
+// >>logging
+#if defined(SOKOL_DEBUG)
+#define _SCULL_LOGITEM_XMACRO(item,msg) #item ": " msg,
+static const char* _scull_log_messages[] = {
+    _SCULL_LOG_ITEMS
+};
+#undef _SCULL_LOGITEM_XMACRO
+#endif // SOKOL_DEBUG
+
+#define _SCULL_PANIC(code) _scull_log(SCULL_LOGITEM_ ##code, 0, __LINE__)
+#define _SCULL_ERROR(code) _scull_log(SCULL_LOGITEM_ ##code, 1, __LINE__)
+#define _SCULL_WARN(code) _scull_log(SCULL_LOGITEM_ ##code, 2, __LINE__)
+#define _SCULL_INFO(code) _scull_log(SCULL_LOGITEM_ ##code, 3, __LINE__)
+
+static void _scull_log(scull_log_item_t log_item, uint32_t log_level, uint32_t line_nr) {
+    if (_scull.desc.logger.func) {
+        #if defined(SOKOL_DEBUG)
+            const char* filename = __FILE__;
+            const char* message = _scull_log_messages[log_item];
+        #else
+            const char* filename = 0;
+            const char* message = 0;
+        #endif
+        _scull.desc.logger.func("scull", log_level, (uint32_t)log_item, message, line_nr, filename, _scull.desc.logger.user_data);
+    } else {
+        // for log level PANIC it would be 'undefined behaviour' to continue
+        if (log_level == 0) {
+            abort();
+        }
+    }
+}
+
+/*
+    Embedded compute shader, hand-written for each backend and always
+    provided as source code. Mode 0 writes the indirect draw arguments
+    with an instance count of zero (in a single thread), mode 1 tests one
+    bounding sphere per thread against the frustum planes and appends
+    the index of each visible instance.
+*/
+#if defined(SOKOL_GLCORE)
+/*
+    #version 430
+
+    layout(local_size_x = 64, local_size_y = 1, local_size_z = 1) in;
+
+    uniform vec4 cs_planes[6];
+    uniform ivec4 cs_counts;
+    uniform ivec4 cs_flags;
+
+    layout(binding = 0, std430) readonly buffer bounds_buf {
+        vec4 bounds[];
+    };
+    layout(binding = 1, std430) writeonly buffer visible_buf {
+        uint visible[];
+    };
+    layout(binding = 2, std430) buffer args_buf {
+        uint args[];
+    };
+
+    void main() {
+        uint idx = gl_GlobalInvocationID.x;
+        if (cs_flags.x == 0) {
+            if (idx == 0u) {
+                args[0] = uint(cs_counts.y);
+                args[1] = 0u;
+                args[2] = uint(cs_counts.z);
+                if (cs_flags.y != 0) {
+                    args[3] = uint(cs_counts.w);
+                    args[4] = 0u;
+                } else {
+                    args[3] = 0u;
+                }
+            }
+            return;
+        }
+        if (idx >= uint(cs_counts.x)) {
+            return;
+        }
+        vec4 b = bounds[idx];
+        for (int i = 0; i < 6; i++) {
+            if ((dot(cs_planes[i].xyz, b.xyz) + cs_planes[i].w) < -b.w) {
+                return;
+            }
+        }
+        uint slot = atomicAdd(args[1], 1u);
+        visible[slot] = idx;
+    }
+*/
+static const uint8_t _scull_cs_source_glsl430[1099] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x33,0x30,0x0a,0x0a,0x6c,0x61,
+    0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x6c,0x5f,0x73,0x69,0x7a,0x65,0x5f,
+    0x78,0x20,0x3d,0x20,0x36,0x34,0x2c,0x20,0x6c,0x6f,0x63,0x61,0x6c,0x5f,0x73,0x69,
+    0x7a,0x65,0x5f,0x79,0x20,0x3d,0x20,0x31,0x2c,0x20,0x6c,0x6f,0x63,0x61,0x6c,0x5f,
+    0x73,0x69,0x7a,0x65,0x5f,0x7a,0x20,0x3d,0x20,0x31,0x29,0x20,0x69,0x6e,0x3b,0x0a,
+    0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x63,0x73,
+    0x5f,0x70,0x6c,0x61,0x6e,0x65,0x73,0x5b,0x36,0x5d,0x3b,0x0a,0x75,0x6e,0x69,0x66,
+    0x6f,0x72,0x6d,0x20,0x69,0x76,0x65,0x63,0x34,0x20,0x63,0x73,0x5f,0x63,0x6f,0x75,
+    0x6e,0x74,0x73,0x3b,0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x69,0x76,0x65,
+    0x63,0x34,0x20,0x63,0x73,0x5f,0x66,0x6c,0x61,0x67,0x73,0x3b,0x0a,0x0a,0x6c,0x61,
+    0x79,0x6f,0x75,0x74,0x28,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x20,0x3d,0x20,0x30,
+    0x2c,0x20,0x73,0x74,0x64,0x34,0x33,0x30,0x29,0x20,0x72,0x65,0x61,0x64,0x6f,0x6e,
+    0x6c,0x79,0x20,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x62,0x6f,0x75,0x6e,0x64,0x73,
+    0x5f,0x62,0x75,0x66,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,
+    0x62,0x6f,0x75,0x6e,0x64,0x73,0x5b,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x6c,0x61,0x79,
+    0x6f,0x75,0x74,0x28,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x20,0x3d,0x20,0x31,0x2c,
+    0x20,0x73,0x74,0x64,0x34,0x33,0x30,0x29,0x20,0x77,0x72,0x69,0x74,0x65,0x6f,0x6e,
+    0x6c,0x79,0x20,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x76,0x69,0x73,0x69,0x62,0x6c,
+    0x65,0x5f,0x62,0x75,0x66,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,
+    0x20,0x76,0x69,0x73,0x69,0x62,0x6c,0x65,0x5b,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x6c,
+    0x61,0x79,0x6f,0x75,0x74,0x28,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x20,0x3d,0x20,
+    0x32,0x2c,0x20,0x73,0x74,0x64,0x34,0x33,0x30,0x29,0x20,0x62,0x75,0x66,0x66,0x65,
+    0x72,0x20,0x61,0x72,0x67,0x73,0x5f,0x62,0x75,0x66,0x20,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x75,0x69,0x6e,0x74,0x20,0x61,0x72,0x67,0x73,0x5b,0x5d,0x3b,0x0a,0x7d,0x3b,
+    0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x20,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x69,0x64,0x78,0x20,0x3d,0x20,0x67,
+    0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,
+    0x6f,0x6e,0x49,0x44,0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,
+    0x63,0x73,0x5f,0x66,0x6c,0x61,0x67,0x73,0x2e,0x78,0x20,0x3d,0x3d,0x20,0x30,0x29,
+    0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,
+    0x64,0x78,0x20,0x3d,0x3d,0x20,0x30,0x75,0x29,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x61,0x72,0x67,0x73,0x5b,0x30,0x5d,0x20,
+    0x3d,0x20,0x75,0x69,0x6e,0x74,0x28,0x63,0x73,0x5f,0x63,0x6f,0x75,0x6e,0x74,0x73,
+    0x2e,0x79,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x61,0x72,0x67,0x73,0x5b,0x31,0x5d,0x20,0x3d,0x20,0x30,0x75,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x61,0x72,0x67,0x73,0x5b,
+    0x32,0x5d,0x20,0x3d,0x20,0x75,0x69,0x6e,0x74,0x28,0x63,0x73,0x5f,0x63,0x6f,0x75,
+    0x6e,0x74,0x73,0x2e,0x7a,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x63,0x73,0x5f,0x66,0x6c,0x61,0x67,0x73,
+    0x2e,0x79,0x20,0x21,0x3d,0x20,0x30,0x29,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x61,0x72,0x67,0x73,0x5b,
+    0x33,0x5d,0x20,0x3d,0x20,0x75,0x69,0x6e,0x74,0x28,0x63,0x73,0x5f,0x63,0x6f,0x75,
+    0x6e,0x74,0x73,0x2e,0x77,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x61,0x72,0x67,0x73,0x5b,0x34,0x5d,0x20,
+    0x3d,0x20,0x30,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x61,0x72,0x67,0x73,0x5b,
+    0x33,0x5d,0x20,0x3d,0x20,0x30,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,
+    0x64,0x78,0x20,0x3e,0x3d,0x20,0x75,0x69,0x6e,0x74,0x28,0x63,0x73,0x5f,0x63,0x6f,
+    0x75,0x6e,0x74,0x73,0x2e,0x78,0x29,0x29,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,
+    0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x62,0x20,0x3d,0x20,0x62,0x6f,
+    0x75,0x6e,0x64,0x73,0x5b,0x69,0x64,0x78,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6f,0x72,0x20,0x28,0x69,0x6e,0x74,0x20,0x69,0x20,0x3d,0x20,0x30,0x3b,0x20,0x69,
+    0x20,0x3c,0x20,0x36,0x3b,0x20,0x69,0x2b,0x2b,0x29,0x20,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x28,0x64,0x6f,0x74,0x28,0x63,0x73,
+    0x5f,0x70,0x6c,0x61,0x6e,0x65,0x73,0x5b,0x69,0x5d,0x2e,0x78,0x79,0x7a,0x2c,0x20,
+    0x62,0x2e,0x78,0x79,0x7a,0x29,0x20,0x2b,0x20,0x63,0x73,0x5f,0x70,0x6c,0x61,0x6e,
+    0x65,0x73,0x5b,0x69,0x5d,0x2e,0x77,0x29,0x20,0x3c,0x20,0x2d,0x62,0x2e,0x77,0x29,
+    0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,
+    0x65,0x74,0x75,0x72,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,
+    0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,
+    0x73,0x6c,0x6f,0x74,0x20,0x3d,0x20,0x61,0x74,0x6f,0x6d,0x69,0x63,0x41,0x64,0x64,
+    0x28,0x61,0x72,0x67,0x73,0x5b,0x31,0x5d,0x2c,0x20,0x31,0x75,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x76,0x69,0x73,0x69,0x62,0x6c,0x65,0x5b,0x73,0x6c,0x6f,0x74,0x5d,
+    0x20,0x3d,0x20,0x69,0x64,0x78,0x3b,0x0a,0x7d,0x0a,0x00,
+};
+#elif defined(SOKOL_GLES3)
+/*
+    #version 310 es
+
+    layout(local_size_x = 64, local_size_y = 1, local_size_z = 1) in;
+
+    uniform vec4 cs_planes[6];
+    uniform ivec4 cs_counts;
+    uniform ivec4 cs_flags;
+
+    layout(binding = 0, std430) readonly buffer bounds_buf {
+        vec4 bounds[];
+    };
+    layout(binding = 1, std430) writeonly buffer visible_buf {
+        uint visible[];
+    };
+    layout(binding = 2, std430) buffer args_buf {
+        uint args[];
+    };
+
+    void main() {
+        uint idx = gl_GlobalInvocationID.x;
+        if (cs_flags.x == 0) {
+            if (idx == 0u) {
+                args[0] = uint(cs_counts.y);
+                args[1] = 0u;
+                args[2] = uint(cs_counts.z);
+                if (cs_flags.y != 0) {
+                    args[3] = uint(cs_counts.w);
+                    args[4] = 0u;
+                } else {
+                    args[3] = 0u;
+                }
+            }
+            return;
+        }
+        if (idx >= uint(cs_counts.x)) {
+            return;
+        }
+        vec4 b = bounds[idx];
+        for (int i = 0; i < 6; i++) {
+            if ((dot(cs_planes[i].xyz, b.xyz) + cs_planes[i].w) < -b.w) {
+                return;
+            }
+        }
+        uint slot = atomicAdd(args[1], 1u);
+        visible[slot] = idx;
+    }
+*/
+static const uint8_t _scull_cs_source_glsl310es[1102] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x31,0x30,0x20,0x65,0x73,0x0a,
+    0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x6c,0x5f,0x73,0x69,
+    0x7a,0x65,0x5f,0x78,0x20,0x3d,0x20,0x36,0x34,0x2c,0x20,0x6c,0x6f,0x63,0x61,0x6c,
+    0x5f,0x73,0x69,0x7a,0x65,0x5f,0x79,0x20,0x3d,0x20,0x31,0x2c,0x20,0x6c,0x6f,0x63,
+    0x61,0x6c,0x5f,0x73,0x69,0x7a,0x65,0x5f,0x7a,0x20,0x3d,0x20,0x31,0x29,0x20,0x69,
+    0x6e,0x3b,0x0a,0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,
+    0x20,0x63,0x73,0x5f,0x70,0x6c,0x61,0x6e,0x65,0x73,0x5b,0x36,0x5d,0x3b,0x0a,0x75,
+    0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x69,0x76,0x65,0x63,0x34,0x20,0x63,0x73,0x5f,
+    0x63,0x6f,0x75,0x6e,0x74,0x73,0x3b,0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,
+    0x69,0x76,0x65,0x63,0x34,0x20,0x63,0x73,0x5f,0x66,0x6c,0x61,0x67,0x73,0x3b,0x0a,
+    0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x20,
+    0x3d,0x20,0x30,0x2c,0x20,0x73,0x74,0x64,0x34,0x33,0x30,0x29,0x20,0x72,0x65,0x61,
+    0x64,0x6f,0x6e,0x6c,0x79,0x20,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x62,0x6f,0x75,
+    0x6e,0x64,0x73,0x5f,0x62,0x75,0x66,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,
+    0x63,0x34,0x20,0x62,0x6f,0x75,0x6e,0x64,0x73,0x5b,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,
+    0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x20,0x3d,
+    0x20,0x31,0x2c,0x20,0x73,0x74,0x64,0x34,0x33,0x30,0x29,0x20,0x77,0x72,0x69,0x74,
+    0x65,0x6f,0x6e,0x6c,0x79,0x20,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x76,0x69,0x73,
+    0x69,0x62,0x6c,0x65,0x5f,0x62,0x75,0x66,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,
+    0x69,0x6e,0x74,0x20,0x76,0x69,0x73,0x69,0x62,0x6c,0x65,0x5b,0x5d,0x3b,0x0a,0x7d,
+    0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,
+    0x20,0x3d,0x20,0x32,0x2c,0x20,0x73,0x74,0x64,0x34,0x33,0x30,0x29,0x20,0x62,0x75,
+    0x66,0x66,0x65,0x72,0x20,0x61,0x72,0x67,0x73,0x5f,0x62,0x75,0x66,0x20,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x61,0x72,0x67,0x73,0x5b,0x5d,0x3b,
+    0x0a,0x7d,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,
+    0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x69,0x64,0x78,0x20,
+    0x3d,0x20,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,
+    0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,
+    0x66,0x20,0x28,0x63,0x73,0x5f,0x66,0x6c,0x61,0x67,0x73,0x2e,0x78,0x20,0x3d,0x3d,
+    0x20,0x30,0x29,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,
+    0x20,0x28,0x69,0x64,0x78,0x20,0x3d,0x3d,0x20,0x30,0x75,0x29,0x20,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x61,0x72,0x67,0x73,0x5b,
+    0x30,0x5d,0x20,0x3d,0x20,0x75,0x69,0x6e,0x74,0x28,0x63,0x73,0x5f,0x63,0x6f,0x75,
+    0x6e,0x74,0x73,0x2e,0x79,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x61,0x72,0x67,0x73,0x5b,0x31,0x5d,0x20,0x3d,0x20,0x30,0x75,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x61,0x72,
+    0x67,0x73,0x5b,0x32,0x5d,0x20,0x3d,0x20,0x75,0x69,0x6e,0x74,0x28,0x63,0x73,0x5f,
+    0x63,0x6f,0x75,0x6e,0x74,0x73,0x2e,0x7a,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x63,0x73,0x5f,0x66,0x6c,
+    0x61,0x67,0x73,0x2e,0x79,0x20,0x21,0x3d,0x20,0x30,0x29,0x20,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x61,0x72,
+    0x67,0x73,0x5b,0x33,0x5d,0x20,0x3d,0x20,0x75,0x69,0x6e,0x74,0x28,0x63,0x73,0x5f,
+    0x63,0x6f,0x75,0x6e,0x74,0x73,0x2e,0x77,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x61,0x72,0x67,0x73,0x5b,
+    0x34,0x5d,0x20,0x3d,0x20,0x30,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x61,0x72,
+    0x67,0x73,0x5b,0x33,0x5d,0x20,0x3d,0x20,0x30,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+    0x72,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,
+    0x20,0x28,0x69,0x64,0x78,0x20,0x3e,0x3d,0x20,0x75,0x69,0x6e,0x74,0x28,0x63,0x73,
+    0x5f,0x63,0x6f,0x75,0x6e,0x74,0x73,0x2e,0x78,0x29,0x29,0x20,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x62,0x20,0x3d,
+    0x20,0x62,0x6f,0x75,0x6e,0x64,0x73,0x5b,0x69,0x64,0x78,0x5d,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6f,0x72,0x20,0x28,0x69,0x6e,0x74,0x20,0x69,0x20,0x3d,0x20,0x30,
+    0x3b,0x20,0x69,0x20,0x3c,0x20,0x36,0x3b,0x20,0x69,0x2b,0x2b,0x29,0x20,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x28,0x64,0x6f,0x74,
+    0x28,0x63,0x73,0x5f,0x70,0x6c,0x61,0x6e,0x65,0x73,0x5b,0x69,0x5d,0x2e,0x78,0x79,
+    0x7a,0x2c,0x20,0x62,0x2e,0x78,0x79,0x7a,0x29,0x20,0x2b,0x20,0x63,0x73,0x5f,0x70,
+    0x6c,0x61,0x6e,0x65,0x73,0x5b,0x69,0x5d,0x2e,0x77,0x29,0x20,0x3c,0x20,0x2d,0x62,
+    0x2e,0x77,0x29,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,
+    0x6e,0x74,0x20,0x73,0x6c,0x6f,0x74,0x20,0x3d,0x20,0x61,0x74,0x6f,0x6d,0x69,0x63,
+    0x41,0x64,0x64,0x28,0x61,0x72,0x67,0x73,0x5b,0x31,0x5d,0x2c,0x20,0x31,0x75,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x69,0x73,0x69,0x62,0x6c,0x65,0x5b,0x73,0x6c,
+    0x6f,0x74,0x5d,0x20,0x3d,0x20,0x69,0x64,0x78,0x3b,0x0a,0x7d,0x0a,0x00,
+};
+#elif defined(SOKOL_METAL)
+/*
+    #include <metal_stdlib>
+    using namespace metal;
+
+    struct cs_params {
+        float4 planes[6];
+        int4 counts;
+        int4 flags;
+    };
+
+    kernel void main0(constant cs_params& params [[buffer(0)]],
+                      const device float4* bounds [[buffer(8)]],
+                      device uint* visible [[buffer(9)]],
+                      device atomic_uint* args [[buffer(10)]],
+                      uint3 gid [[thread_position_in_grid]]) {
+        uint idx = gid.x;
+        if (params.flags.x == 0) {
+            if (idx == 0) {
+                atomic_store_explicit(&args[0], uint(params.counts.y), memory_order_relaxed);
+                atomic_store_explicit(&args[1], 0u, memory_order_relaxed);
+                atomic_store_explicit(&args[2], uint(params.counts.z), memory_order_relaxed);
+                if (params.flags.y != 0) {
+                    atomic_store_explicit(&args[3], uint(params.counts.w), memory_order_relaxed);
+                    atomic_store_explicit(&args[4], 0u, memory_order_relaxed);
+                } else {
+                    atomic_store_explicit(&args[3], 0u, memory_order_relaxed);
+                }
+            }
+            return;
+        }
+        if (idx >= uint(params.counts.x)) {
+            return;
+        }
+        float4 b = bounds[idx];
+        for (int i = 0; i < 6; i++) {
+            if ((dot(params.planes[i].xyz, b.xyz) + params.planes[i].w) < -b.w) {
+                return;
+            }
+        }
+        uint slot = atomic_fetch_add_explicit(&args[1], 1u, memory_order_relaxed);
+        visible[slot] = idx;
+    }
+*/
+static const uint8_t _scull_cs_source_metal[1442] = {
+    0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,
+    0x73,0x74,0x64,0x6c,0x69,0x62,0x3e,0x0a,0x75,0x73,0x69,0x6e,0x67,0x20,0x6e,0x61,
+    0x6d,0x65,0x73,0x70,0x61,0x63,0x65,0x20,0x6d,0x65,0x74,0x61,0x6c,0x3b,0x0a,0x0a,
+    0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x63,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,
+    0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x70,0x6c,
+    0x61,0x6e,0x65,0x73,0x5b,0x36,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,
+    0x34,0x20,0x63,0x6f,0x75,0x6e,0x74,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,
+    0x74,0x34,0x20,0x66,0x6c,0x61,0x67,0x73,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x6b,0x65,
+    0x72,0x6e,0x65,0x6c,0x20,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x30,0x28,
+    0x63,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x20,0x63,0x73,0x5f,0x70,0x61,0x72,0x61,
+    0x6d,0x73,0x26,0x20,0x70,0x61,0x72,0x61,0x6d,0x73,0x20,0x5b,0x5b,0x62,0x75,0x66,
+    0x66,0x65,0x72,0x28,0x30,0x29,0x5d,0x5d,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6f,0x6e,0x73,
+    0x74,0x20,0x64,0x65,0x76,0x69,0x63,0x65,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x2a,
+    0x20,0x62,0x6f,0x75,0x6e,0x64,0x73,0x20,0x5b,0x5b,0x62,0x75,0x66,0x66,0x65,0x72,
+    0x28,0x38,0x29,0x5d,0x5d,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x65,0x76,0x69,0x63,0x65,0x20,
+    0x75,0x69,0x6e,0x74,0x2a,0x20,0x76,0x69,0x73,0x69,0x62,0x6c,0x65,0x20,0x5b,0x5b,
+    0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x39,0x29,0x5d,0x5d,0x2c,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,
+    0x65,0x76,0x69,0x63,0x65,0x20,0x61,0x74,0x6f,0x6d,0x69,0x63,0x5f,0x75,0x69,0x6e,
+    0x74,0x2a,0x20,0x61,0x72,0x67,0x73,0x20,0x5b,0x5b,0x62,0x75,0x66,0x66,0x65,0x72,
+    0x28,0x31,0x30,0x29,0x5d,0x5d,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x33,0x20,
+    0x67,0x69,0x64,0x20,0x5b,0x5b,0x74,0x68,0x72,0x65,0x61,0x64,0x5f,0x70,0x6f,0x73,
+    0x69,0x74,0x69,0x6f,0x6e,0x5f,0x69,0x6e,0x5f,0x67,0x72,0x69,0x64,0x5d,0x5d,0x29,
+    0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x69,0x64,0x78,0x20,
+    0x3d,0x20,0x67,0x69,0x64,0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,
+    0x28,0x70,0x61,0x72,0x61,0x6d,0x73,0x2e,0x66,0x6c,0x61,0x67,0x73,0x2e,0x78,0x20,
+    0x3d,0x3d,0x20,0x30,0x29,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x69,0x66,0x20,0x28,0x69,0x64,0x78,0x20,0x3d,0x3d,0x20,0x30,0x29,0x20,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x61,0x74,0x6f,0x6d,
+    0x69,0x63,0x5f,0x73,0x74,0x6f,0x72,0x65,0x5f,0x65,0x78,0x70,0x6c,0x69,0x63,0x69,
+    0x74,0x28,0x26,0x61,0x72,0x67,0x73,0x5b,0x30,0x5d,0x2c,0x20,0x75,0x69,0x6e,0x74,
+    0x28,0x70,0x61,0x72,0x61,0x6d,0x73,0x2e,0x63,0x6f,0x75,0x6e,0x74,0x73,0x2e,0x79,
+    0x29,0x2c,0x20,0x6d,0x65,0x6d,0x6f,0x72,0x79,0x5f,0x6f,0x72,0x64,0x65,0x72,0x5f,
+    0x72,0x65,0x6c,0x61,0x78,0x65,0x64,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x61,0x74,0x6f,0x6d,0x69,0x63,0x5f,0x73,0x74,0x6f,
+    0x72,0x65,0x5f,0x65,0x78,0x70,0x6c,0x69,0x63,0x69,0x74,0x28,0x26,0x61,0x72,0x67,
+    0x73,0x5b,0x31,0x5d,0x2c,0x20,0x30,0x75,0x2c,0x20,0x6d,0x65,0x6d,0x6f,0x72,0x79,
+    0x5f,0x6f,0x72,0x64,0x65,0x72,0x5f,0x72,0x65,0x6c,0x61,0x78,0x65,0x64,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x61,0x74,0x6f,
+    0x6d,0x69,0x63,0x5f,0x73,0x74,0x6f,0x72,0x65,0x5f,0x65,0x78,0x70,0x6c,0x69,0x63,
+    0x69,0x74,0x28,0x26,0x61,0x72,0x67,0x73,0x5b,0x32,0x5d,0x2c,0x20,0x75,0x69,0x6e,
+    0x74,0x28,0x70,0x61,0x72,0x61,0x6d,0x73,0x2e,0x63,0x6f,0x75,0x6e,0x74,0x73,0x2e,
+    0x7a,0x29,0x2c,0x20,0x6d,0x65,0x6d,0x6f,0x72,0x79,0x5f,0x6f,0x72,0x64,0x65,0x72,
+    0x5f,0x72,0x65,0x6c,0x61,0x78,0x65,0x64,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x70,0x61,0x72,0x61,0x6d,
+    0x73,0x2e,0x66,0x6c,0x61,0x67,0x73,0x2e,0x79,0x20,0x21,0x3d,0x20,0x30,0x29,0x20,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x61,0x74,0x6f,0x6d,0x69,0x63,0x5f,0x73,0x74,0x6f,0x72,0x65,0x5f,0x65,
+    0x78,0x70,0x6c,0x69,0x63,0x69,0x74,0x28,0x26,0x61,0x72,0x67,0x73,0x5b,0x33,0x5d,
+    0x2c,0x20,0x75,0x69,0x6e,0x74,0x28,0x70,0x61,0x72,0x61,0x6d,0x73,0x2e,0x63,0x6f,
+    0x75,0x6e,0x74,0x73,0x2e,0x77,0x29,0x2c,0x20,0x6d,0x65,0x6d,0x6f,0x72,0x79,0x5f,
+    0x6f,0x72,0x64,0x65,0x72,0x5f,0x72,0x65,0x6c,0x61,0x78,0x65,0x64,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x61,0x74,0x6f,0x6d,0x69,0x63,0x5f,0x73,0x74,0x6f,0x72,0x65,0x5f,0x65,0x78,0x70,
+    0x6c,0x69,0x63,0x69,0x74,0x28,0x26,0x61,0x72,0x67,0x73,0x5b,0x34,0x5d,0x2c,0x20,
+    0x30,0x75,0x2c,0x20,0x6d,0x65,0x6d,0x6f,0x72,0x79,0x5f,0x6f,0x72,0x64,0x65,0x72,
+    0x5f,0x72,0x65,0x6c,0x61,0x78,0x65,0x64,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x61,0x74,0x6f,0x6d,0x69,0x63,0x5f,0x73,0x74,0x6f,0x72,0x65,0x5f,0x65,0x78,0x70,
+    0x6c,0x69,0x63,0x69,0x74,0x28,0x26,0x61,0x72,0x67,0x73,0x5b,0x33,0x5d,0x2c,0x20,
+    0x30,0x75,0x2c,0x20,0x6d,0x65,0x6d,0x6f,0x72,0x79,0x5f,0x6f,0x72,0x64,0x65,0x72,
+    0x5f,0x72,0x65,0x6c,0x61,0x78,0x65,0x64,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,
+    0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,
+    0x28,0x69,0x64,0x78,0x20,0x3e,0x3d,0x20,0x75,0x69,0x6e,0x74,0x28,0x70,0x61,0x72,
+    0x61,0x6d,0x73,0x2e,0x63,0x6f,0x75,0x6e,0x74,0x73,0x2e,0x78,0x29,0x29,0x20,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x34,0x20,0x62,0x20,0x3d,0x20,0x62,0x6f,0x75,0x6e,0x64,0x73,0x5b,0x69,0x64,0x78,
+    0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x28,0x69,0x6e,0x74,0x20,
+    0x69,0x20,0x3d,0x20,0x30,0x3b,0x20,0x69,0x20,0x3c,0x20,0x36,0x3b,0x20,0x69,0x2b,
+    0x2b,0x29,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,
+    0x28,0x28,0x64,0x6f,0x74,0x28,0x70,0x61,0x72,0x61,0x6d,0x73,0x2e,0x70,0x6c,0x61,
+    0x6e,0x65,0x73,0x5b,0x69,0x5d,0x2e,0x78,0x79,0x7a,0x2c,0x20,0x62,0x2e,0x78,0x79,
+    0x7a,0x29,0x20,0x2b,0x20,0x70,0x61,0x72,0x61,0x6d,0x73,0x2e,0x70,0x6c,0x61,0x6e,
+    0x65,0x73,0x5b,0x69,0x5d,0x2e,0x77,0x29,0x20,0x3c,0x20,0x2d,0x62,0x2e,0x77,0x29,
+    0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,
+    0x65,0x74,0x75,0x72,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,
+    0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,
+    0x73,0x6c,0x6f,0x74,0x20,0x3d,0x20,0x61,0x74,0x6f,0x6d,0x69,0x63,0x5f,0x66,0x65,
+    0x74,0x63,0x68,0x5f,0x61,0x64,0x64,0x5f,0x65,0x78,0x70,0x6c,0x69,0x63,0x69,0x74,
+    0x28,0x26,0x61,0x72,0x67,0x73,0x5b,0x31,0x5d,0x2c,0x20,0x31,0x75,0x2c,0x20,0x6d,
+    0x65,0x6d,0x6f,0x72,0x79,0x5f,0x6f,0x72,0x64,0x65,0x72,0x5f,0x72,0x65,0x6c,0x61,
+    0x78,0x65,0x64,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x69,0x73,0x69,0x62,0x6c,
+    0x65,0x5b,0x73,0x6c,0x6f,0x74,0x5d,0x20,0x3d,0x20,0x69,0x64,0x78,0x3b,0x0a,0x7d,
+    0x0a,0x00,
+};
+#elif defined(SOKOL_D3D11)
+/*
+    cbuffer cs_params : register(b0) {
+        float4 cs_planes[6];
+        int4 cs_counts;
+        int4 cs_flags;
+    };
+    ByteAddressBuffer bounds : register(t0);
+    RWByteAddressBuffer visible : register(u0);
+    RWByteAddressBuffer args : register(u1);
+
+    [numthreads(64, 1, 1)]
+    void main(uint3 gid : SV_DispatchThreadID) {
+        uint idx = gid.x;
+        if (cs_flags.x == 0) {
+            if (idx == 0) {
+                args.Store(0, uint(cs_counts.y));
+                args.Store(4, 0);
+                args.Store(8, uint(cs_counts.z));
+                if (cs_flags.y != 0) {
+                    args.Store(12, uint(cs_counts.w));
+                    args.Store(16, 0);
+                } else {
+                    args.Store(12, 0);
+                }
+            }
+            return;
+        }
+        if (idx >= uint(cs_counts.x)) {
+            return;
+        }
+        float4 b = asfloat(bounds.Load4(idx * 16));
+        [unroll] for (int i = 0; i < 6; i++) {
+            if ((dot(cs_planes[i].xyz, b.xyz) + cs_planes[i].w) < -b.w) {
+                return;
+            }
+        }
+        uint slot;
+        args.InterlockedAdd(4, 1, slot);
+        visible.Store(slot * 4, idx);
+    }
+*/
+static const uint8_t _scull_cs_source_hlsl5[1059] = {
+    0x63,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x63,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x73,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x62,0x30,0x29,
+    0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,0x73,
+    0x5f,0x70,0x6c,0x61,0x6e,0x65,0x73,0x5b,0x36,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x69,0x6e,0x74,0x34,0x20,0x63,0x73,0x5f,0x63,0x6f,0x75,0x6e,0x74,0x73,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x34,0x20,0x63,0x73,0x5f,0x66,0x6c,0x61,0x67,
+    0x73,0x3b,0x0a,0x7d,0x3b,0x0a,0x42,0x79,0x74,0x65,0x41,0x64,0x64,0x72,0x65,0x73,
+    0x73,0x42,0x75,0x66,0x66,0x65,0x72,0x20,0x62,0x6f,0x75,0x6e,0x64,0x73,0x20,0x3a,
+    0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x74,0x30,0x29,0x3b,0x0a,0x52,
+    0x57,0x42,0x79,0x74,0x65,0x41,0x64,0x64,0x72,0x65,0x73,0x73,0x42,0x75,0x66,0x66,
+    0x65,0x72,0x20,0x76,0x69,0x73,0x69,0x62,0x6c,0x65,0x20,0x3a,0x20,0x72,0x65,0x67,
+    0x69,0x73,0x74,0x65,0x72,0x28,0x75,0x30,0x29,0x3b,0x0a,0x52,0x57,0x42,0x79,0x74,
+    0x65,0x41,0x64,0x64,0x72,0x65,0x73,0x73,0x42,0x75,0x66,0x66,0x65,0x72,0x20,0x61,
+    0x72,0x67,0x73,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x75,
+    0x31,0x29,0x3b,0x0a,0x0a,0x5b,0x6e,0x75,0x6d,0x74,0x68,0x72,0x65,0x61,0x64,0x73,
+    0x28,0x36,0x34,0x2c,0x20,0x31,0x2c,0x20,0x31,0x29,0x5d,0x0a,0x76,0x6f,0x69,0x64,
+    0x20,0x6d,0x61,0x69,0x6e,0x28,0x75,0x69,0x6e,0x74,0x33,0x20,0x67,0x69,0x64,0x20,
+    0x3a,0x20,0x53,0x56,0x5f,0x44,0x69,0x73,0x70,0x61,0x74,0x63,0x68,0x54,0x68,0x72,
+    0x65,0x61,0x64,0x49,0x44,0x29,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,
+    0x74,0x20,0x69,0x64,0x78,0x20,0x3d,0x20,0x67,0x69,0x64,0x2e,0x78,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x63,0x73,0x5f,0x66,0x6c,0x61,0x67,0x73,0x2e,
+    0x78,0x20,0x3d,0x3d,0x20,0x30,0x29,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x64,0x78,0x20,0x3d,0x3d,0x20,0x30,0x29,0x20,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x61,0x72,
+    0x67,0x73,0x2e,0x53,0x74,0x6f,0x72,0x65,0x28,0x30,0x2c,0x20,0x75,0x69,0x6e,0x74,
+    0x28,0x63,0x73,0x5f,0x63,0x6f,0x75,0x6e,0x74,0x73,0x2e,0x79,0x29,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x61,0x72,0x67,0x73,
+    0x2e,0x53,0x74,0x6f,0x72,0x65,0x28,0x34,0x2c,0x20,0x30,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x61,0x72,0x67,0x73,0x2e,0x53,
+    0x74,0x6f,0x72,0x65,0x28,0x38,0x2c,0x20,0x75,0x69,0x6e,0x74,0x28,0x63,0x73,0x5f,
+    0x63,0x6f,0x75,0x6e,0x74,0x73,0x2e,0x7a,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x63,0x73,0x5f,0x66,
+    0x6c,0x61,0x67,0x73,0x2e,0x79,0x20,0x21,0x3d,0x20,0x30,0x29,0x20,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x61,
+    0x72,0x67,0x73,0x2e,0x53,0x74,0x6f,0x72,0x65,0x28,0x31,0x32,0x2c,0x20,0x75,0x69,
+    0x6e,0x74,0x28,0x63,0x73,0x5f,0x63,0x6f,0x75,0x6e,0x74,0x73,0x2e,0x77,0x29,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x61,0x72,0x67,0x73,0x2e,0x53,0x74,0x6f,0x72,0x65,0x28,0x31,0x36,0x2c,
+    0x20,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x61,0x72,0x67,0x73,0x2e,0x53,
+    0x74,0x6f,0x72,0x65,0x28,0x31,0x32,0x2c,0x20,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,
+    0x75,0x72,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,
+    0x66,0x20,0x28,0x69,0x64,0x78,0x20,0x3e,0x3d,0x20,0x75,0x69,0x6e,0x74,0x28,0x63,
+    0x73,0x5f,0x63,0x6f,0x75,0x6e,0x74,0x73,0x2e,0x78,0x29,0x29,0x20,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
+    0x62,0x20,0x3d,0x20,0x61,0x73,0x66,0x6c,0x6f,0x61,0x74,0x28,0x62,0x6f,0x75,0x6e,
+    0x64,0x73,0x2e,0x4c,0x6f,0x61,0x64,0x34,0x28,0x69,0x64,0x78,0x20,0x2a,0x20,0x31,
+    0x36,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x5b,0x75,0x6e,0x72,0x6f,0x6c,0x6c,
+    0x5d,0x20,0x66,0x6f,0x72,0x20,0x28,0x69,0x6e,0x74,0x20,0x69,0x20,0x3d,0x20,0x30,
+    0x3b,0x20,0x69,0x20,0x3c,0x20,0x36,0x3b,0x20,0x69,0x2b,0x2b,0x29,0x20,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x28,0x64,0x6f,0x74,
+    0x28,0x63,0x73,0x5f,0x70,0x6c,0x61,0x6e,0x65,0x73,0x5b,0x69,0x5d,0x2e,0x78,0x79,
+    0x7a,0x2c,0x20,0x62,0x2e,0x78,0x79,0x7a,0x29,0x20,0x2b,0x20,0x63,0x73,0x5f,0x70,
+    0x6c,0x61,0x6e,0x65,0x73,0x5b,0x69,0x5d,0x2e,0x77,0x29,0x20,0x3c,0x20,0x2d,0x62,
+    0x2e,0x77,0x29,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,
+    0x6e,0x74,0x20,0x73,0x6c,0x6f,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x61,0x72,0x67,
+    0x73,0x2e,0x49,0x6e,0x74,0x65,0x72,0x6c,0x6f,0x63,0x6b,0x65,0x64,0x41,0x64,0x64,
+    0x28,0x34,0x2c,0x20,0x31,0x2c,0x20,0x73,0x6c,0x6f,0x74,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x76,0x69,0x73,0x69,0x62,0x6c,0x65,0x2e,0x53,0x74,0x6f,0x72,0x65,0x28,
+    0x73,0x6c,0x6f,0x74,0x20,0x2a,0x20,0x34,0x2c,0x20,0x69,0x64,0x78,0x29,0x3b,0x0a,
+    0x7d,0x0a,0x00,
+};
+#elif defined(SOKOL_WGPU)
+/*
+    struct cs_params {
+        planes: array<vec4f, 6>,
+        counts: vec4i,
+        flags: vec4i,
+    }
+
+    @group(0) @binding(0) var<uniform> params: cs_params;
+    @group(1) @binding(0) var<storage, read> bounds: array<vec4f>;
+    @group(1) @binding(1) var<storage, read_write> visible: array<u32>;
+    @group(1) @binding(2) var<storage, read_write> args: array<atomic<u32>>;
+
+    @compute @workgroup_size(64)
+    fn main(@builtin(global_invocation_id) gid: vec3u) {
+        let idx = gid.x;
+        if (params.flags.x == 0) {
+            if (idx == 0u) {
+                atomicStore(&args[0], u32(params.counts.y));
+                atomicStore(&args[1], 0u);
+                atomicStore(&args[2], u32(params.counts.z));
+                if (params.flags.y != 0) {
+                    atomicStore(&args[3], u32(params.counts.w));
+                    atomicStore(&args[4], 0u);
+                } else {
+                    atomicStore(&args[3], 0u);
+                }
+            }
+            return;
+        }
+        if (idx >= u32(params.counts.x)) {
+            return;
+        }
+        let b = bounds[idx];
+        for (var i = 0; i < 6; i++) {
+            if ((dot(params.planes[i].xyz, b.xyz) + params.planes[i].w) < -b.w) {
+                return;
+            }
+        }
+        let slot = atomicAdd(&args[1], 1u);
+        visible[slot] = idx;
+    }
+*/
+static const uint8_t _scull_cs_source_wgsl[1214] = {
+    0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x63,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,
+    0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x70,0x6c,0x61,0x6e,0x65,0x73,0x3a,0x20,0x61,
+    0x72,0x72,0x61,0x79,0x3c,0x76,0x65,0x63,0x34,0x66,0x2c,0x20,0x36,0x3e,0x2c,0x0a,
+    0x20,0x20,0x20,0x20,0x63,0x6f,0x75,0x6e,0x74,0x73,0x3a,0x20,0x76,0x65,0x63,0x34,
+    0x69,0x2c,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x61,0x67,0x73,0x3a,0x20,0x76,0x65,
+    0x63,0x34,0x69,0x2c,0x0a,0x7d,0x0a,0x0a,0x40,0x67,0x72,0x6f,0x75,0x70,0x28,0x30,
+    0x29,0x20,0x40,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x28,0x30,0x29,0x20,0x76,0x61,
+    0x72,0x3c,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x3e,0x20,0x70,0x61,0x72,0x61,0x6d,
+    0x73,0x3a,0x20,0x63,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x3b,0x0a,0x40,0x67,
+    0x72,0x6f,0x75,0x70,0x28,0x31,0x29,0x20,0x40,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,
+    0x28,0x30,0x29,0x20,0x76,0x61,0x72,0x3c,0x73,0x74,0x6f,0x72,0x61,0x67,0x65,0x2c,
+    0x20,0x72,0x65,0x61,0x64,0x3e,0x20,0x62,0x6f,0x75,0x6e,0x64,0x73,0x3a,0x20,0x61,
+    0x72,0x72,0x61,0x79,0x3c,0x76,0x65,0x63,0x34,0x66,0x3e,0x3b,0x0a,0x40,0x67,0x72,
+    0x6f,0x75,0x70,0x28,0x31,0x29,0x20,0x40,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x28,
+    0x31,0x29,0x20,0x76,0x61,0x72,0x3c,0x73,0x74,0x6f,0x72,0x61,0x67,0x65,0x2c,0x20,
+    0x72,0x65,0x61,0x64,0x5f,0x77,0x72,0x69,0x74,0x65,0x3e,0x20,0x76,0x69,0x73,0x69,
+    0x62,0x6c,0x65,0x3a,0x20,0x61,0x72,0x72,0x61,0x79,0x3c,0x75,0x33,0x32,0x3e,0x3b,
+    0x0a,0x40,0x67,0x72,0x6f,0x75,0x70,0x28,0x31,0x29,0x20,0x40,0x62,0x69,0x6e,0x64,
+    0x69,0x6e,0x67,0x28,0x32,0x29,0x20,0x76,0x61,0x72,0x3c,0x73,0x74,0x6f,0x72,0x61,
+    0x67,0x65,0x2c,0x20,0x72,0x65,0x61,0x64,0x5f,0x77,0x72,0x69,0x74,0x65,0x3e,0x20,
+    0x61,0x72,0x67,0x73,0x3a,0x20,0x61,0x72,0x72,0x61,0x79,0x3c,0x61,0x74,0x6f,0x6d,
+    0x69,0x63,0x3c,0x75,0x33,0x32,0x3e,0x3e,0x3b,0x0a,0x0a,0x40,0x63,0x6f,0x6d,0x70,
+    0x75,0x74,0x65,0x20,0x40,0x77,0x6f,0x72,0x6b,0x67,0x72,0x6f,0x75,0x70,0x5f,0x73,
+    0x69,0x7a,0x65,0x28,0x36,0x34,0x29,0x0a,0x66,0x6e,0x20,0x6d,0x61,0x69,0x6e,0x28,
+    0x40,0x62,0x75,0x69,0x6c,0x74,0x69,0x6e,0x28,0x67,0x6c,0x6f,0x62,0x61,0x6c,0x5f,
+    0x69,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x5f,0x69,0x64,0x29,0x20,0x67,
+    0x69,0x64,0x3a,0x20,0x76,0x65,0x63,0x33,0x75,0x29,0x20,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x6c,0x65,0x74,0x20,0x69,0x64,0x78,0x20,0x3d,0x20,0x67,0x69,0x64,0x2e,0x78,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x70,0x61,0x72,0x61,0x6d,0x73,
+    0x2e,0x66,0x6c,0x61,0x67,0x73,0x2e,0x78,0x20,0x3d,0x3d,0x20,0x30,0x29,0x20,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x64,0x78,
+    0x20,0x3d,0x3d,0x20,0x30,0x75,0x29,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x61,0x74,0x6f,0x6d,0x69,0x63,0x53,0x74,0x6f,0x72,
+    0x65,0x28,0x26,0x61,0x72,0x67,0x73,0x5b,0x30,0x5d,0x2c,0x20,0x75,0x33,0x32,0x28,
+    0x70,0x61,0x72,0x61,0x6d,0x73,0x2e,0x63,0x6f,0x75,0x6e,0x74,0x73,0x2e,0x79,0x29,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x61,
+    0x74,0x6f,0x6d,0x69,0x63,0x53,0x74,0x6f,0x72,0x65,0x28,0x26,0x61,0x72,0x67,0x73,
+    0x5b,0x31,0x5d,0x2c,0x20,0x30,0x75,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x61,0x74,0x6f,0x6d,0x69,0x63,0x53,0x74,0x6f,0x72,
+    0x65,0x28,0x26,0x61,0x72,0x67,0x73,0x5b,0x32,0x5d,0x2c,0x20,0x75,0x33,0x32,0x28,
+    0x70,0x61,0x72,0x61,0x6d,0x73,0x2e,0x63,0x6f,0x75,0x6e,0x74,0x73,0x2e,0x7a,0x29,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,
+    0x66,0x20,0x28,0x70,0x61,0x72,0x61,0x6d,0x73,0x2e,0x66,0x6c,0x61,0x67,0x73,0x2e,
+    0x79,0x20,0x21,0x3d,0x20,0x30,0x29,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x61,0x74,0x6f,0x6d,0x69,0x63,
+    0x53,0x74,0x6f,0x72,0x65,0x28,0x26,0x61,0x72,0x67,0x73,0x5b,0x33,0x5d,0x2c,0x20,
+    0x75,0x33,0x32,0x28,0x70,0x61,0x72,0x61,0x6d,0x73,0x2e,0x63,0x6f,0x75,0x6e,0x74,
+    0x73,0x2e,0x77,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x61,0x74,0x6f,0x6d,0x69,0x63,0x53,0x74,0x6f,
+    0x72,0x65,0x28,0x26,0x61,0x72,0x67,0x73,0x5b,0x34,0x5d,0x2c,0x20,0x30,0x75,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x20,
+    0x65,0x6c,0x73,0x65,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x61,0x74,0x6f,0x6d,0x69,0x63,0x53,0x74,0x6f,
+    0x72,0x65,0x28,0x26,0x61,0x72,0x67,0x73,0x5b,0x33,0x5d,0x2c,0x20,0x30,0x75,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,
+    0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x64,0x78,0x20,0x3e,0x3d,0x20,0x75,
+    0x33,0x32,0x28,0x70,0x61,0x72,0x61,0x6d,0x73,0x2e,0x63,0x6f,0x75,0x6e,0x74,0x73,
+    0x2e,0x78,0x29,0x29,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,
+    0x65,0x74,0x75,0x72,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,
+    0x20,0x6c,0x65,0x74,0x20,0x62,0x20,0x3d,0x20,0x62,0x6f,0x75,0x6e,0x64,0x73,0x5b,
+    0x69,0x64,0x78,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x28,0x76,
+    0x61,0x72,0x20,0x69,0x20,0x3d,0x20,0x30,0x3b,0x20,0x69,0x20,0x3c,0x20,0x36,0x3b,
+    0x20,0x69,0x2b,0x2b,0x29,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x69,0x66,0x20,0x28,0x28,0x64,0x6f,0x74,0x28,0x70,0x61,0x72,0x61,0x6d,0x73,0x2e,
+    0x70,0x6c,0x61,0x6e,0x65,0x73,0x5b,0x69,0x5d,0x2e,0x78,0x79,0x7a,0x2c,0x20,0x62,
+    0x2e,0x78,0x79,0x7a,0x29,0x20,0x2b,0x20,0x70,0x61,0x72,0x61,0x6d,0x73,0x2e,0x70,
+    0x6c,0x61,0x6e,0x65,0x73,0x5b,0x69,0x5d,0x2e,0x77,0x29,0x20,0x3c,0x20,0x2d,0x62,
+    0x2e,0x77,0x29,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x6c,0x65,
+    0x74,0x20,0x73,0x6c,0x6f,0x74,0x20,0x3d,0x20,0x61,0x74,0x6f,0x6d,0x69,0x63,0x41,
+    0x64,0x64,0x28,0x26,0x61,0x72,0x67,0x73,0x5b,0x31,0x5d,0x2c,0x20,0x31,0x75,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x69,0x73,0x69,0x62,0x6c,0x65,0x5b,0x73,0x6c,
+    0x6f,0x74,0x5d,0x20,0x3d,0x20,0x69,0x64,0x78,0x3b,0x0a,0x7d,0x0a,0x00,
+};
+#elif defined(SOKOL_DUMMY_BACKEND)
+static const char* _scull_cs_src_dummy = "";
+#else
+#error "Please define one of SOKOL_GLCORE, SOKOL_GLES3, SOKOL_D3D11, SOKOL_METAL, SOKOL_WGPU or SOKOL_DUMMY_BACKEND!"
+#endif
+
+// ██   ██ ███████ ██      ██████  ███████ ██████  ███████
+// ██   ██ ██      ██      ██   ██ ██      ██   ██ ██
+// ███████ █████   ██      ██████  █████   ██████  ███████
+// ██   ██ ██      ██      ██      ██      ██   ██      ██
+// ██   ██ ███████ ███████ ██      ███████ ██   ██ ███████
+//
+// >>helpers
+// extract the 6 frustum planes from a column-major view-projection matrix
+// (Gribb/Hartmann), the planes are normalized so that the plane distance
+// can be compared against the bounding sphere radius
+static void _scull_extract_planes(const float m[16], float planes[6][4]) {
+    for (int i = 0; i < 6; i++) {
+        // left/right: row 3 +/- row 0, bottom/top: row 3 +/- row 1, near/far: row 3 +/- row 2
+        const int row = i >> 1;
+        const float sign = (i & 1) ? -1.0f : 1.0f;
+        float len_sq = 0.0f;
+        for (int col = 0; col < 4; col++) {
+            planes[i][col] = m[col * 4 + 3] + sign * m[col * 4 + row];
+            if (col < 3) {
+                len_sq += planes[i][col] * planes[i][col];
+            }
+        }
+        if (len_sq > 0.0f) {
+            const float inv_len = 1.0f / sqrtf(len_sq);
+            for (int col = 0; col < 4; col++) {
+                planes[i][col] *= inv_len;
+            }
+        }
+    }
+}
+
+// ██████  ██    ██ ██████  ██      ██  ██████
+// ██   ██ ██    ██ ██   ██ ██      ██ ██
+// ██████  ██    ██ ██████  ██      ██ ██
+// ██      ██    ██ ██   ██ ██      ██ ██
+// ██       ██████  ██████  ███████ ██  ██████
+//
+// >>public
+static void _scull_init_shader_desc(sg_shader_desc* shd_desc) {
+    memset(shd_desc, 0, sizeof(sg_shader_desc));
+    shd_desc->label = "sokol-gpu-cull-shader";
+    shd_desc->uniform_blocks[0].stage = SG_SHADERSTAGE_COMPUTE;
+    shd_desc->uniform_blocks[0].size = sizeof(_scull_params_t);
+    shd_desc->uniform_blocks[0].hlsl_register_b_n = 0;
+    shd_desc->uniform_blocks[0].msl_buffer_n = 0;
+    shd_desc->uniform_blocks[0].wgsl_group0_binding_n = 0;
+    shd_desc->uniform_blocks[0].glsl_uniforms[0].glsl_name = "cs_planes";
+    shd_desc->uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+    shd_desc->uniform_blocks[0].glsl_uniforms[0].array_count = 6;
+    shd_desc->uniform_blocks[0].glsl_uniforms[1].glsl_name = "cs_counts";
+    shd_desc->uniform_blocks[0].glsl_uniforms[1].type = SG_UNIFORMTYPE_INT4;
+    shd_desc->uniform_blocks[0].glsl_uniforms[2].glsl_name = "cs_flags";
+    shd_desc->uniform_blocks[0].glsl_uniforms[2].type = SG_UNIFORMTYPE_INT4;
+    sg_shader_storage_buffer* sbuf = &shd_desc->storage_buffers[_SCULL_SBUF_BOUNDS];
+    sbuf->stage = SG_SHADERSTAGE_COMPUTE;
+    sbuf->readonly = true;
+    sbuf->hlsl_register_t_n = 0;
+    sbuf->msl_buffer_n = 8;
+    sbuf->wgsl_group1_binding_n = 0;
+    sbuf->glsl_binding_n = 0;
+    sbuf = &shd_desc->storage_buffers[_SCULL_SBUF_VISIBLE];
+    sbuf->stage = SG_SHADERSTAGE_COMPUTE;
+    sbuf->hlsl_register_u_n = 0;
+    sbuf->msl_buffer_n = 9;
+    sbuf->wgsl_group1_binding_n = 1;
+    sbuf->glsl_binding_n = 1;
+    sbuf = &shd_desc->storage_buffers[_SCULL_SBUF_ARGS];
+    sbuf->stage = SG_SHADERSTAGE_COMPUTE;
+    sbuf->hlsl_register_u_n = 1;
+    sbuf->msl_buffer_n = 10;
+    sbuf->wgsl_group1_binding_n = 2;
+    sbuf->glsl_binding_n = 2;
+    shd_desc->mtl_threads_per_threadgroup.x = _SCULL_THREADS_PER_GROUP;
+    shd_desc->mtl_threads_per_threadgroup.y = 1;
+    shd_desc->mtl_threads_per_threadgroup.z = 1;
+    #if defined(SOKOL_GLCORE)
+        shd_desc->compute_func.source = (const char*)_scull_cs_source_glsl430;
+    #elif defined(SOKOL_GLES3)
+        shd_desc->compute_func.source = (const char*)_scull_cs_source_glsl310es;
+    #elif defined(SOKOL_METAL)
+        shd_desc->compute_func.entry = "main0";
+        shd_desc->compute_func.source = (const char*)_scull_cs_source_metal;
+    #elif defined(SOKOL_D3D11)
+        shd_desc->compute_func.d3d11_target = "cs_5_0";
+        shd_desc->compute_func.source = (const char*)_scull_cs_source_hlsl5;
+    #elif defined(SOKOL_WGPU)
+        shd_desc->compute_func.source = (const char*)_scull_cs_source_wgsl;
+    #else
+        shd_desc->compute_func.source = _scull_cs_src_dummy;
+    #endif
+}
+
+SOKOL_API_IMPL void scull_setup(const scull_desc_t* desc) {
+    SOKOL_ASSERT(desc);
+    memset(&_scull, 0, sizeof(_scull));
+    _scull.init_cookie = _SCULL_INIT_COOKIE;
+    _scull.desc = *desc;
+    const sg_features features = sg_query_features();
+    _scull.supported = features.compute && features.draw_indirect;
+    if (!_scull.supported) {
+        _SCULL_WARN(NOT_SUPPORTED);
+        return;
+    }
+    sg_shader_desc shd_desc;
+    _scull_init_shader_desc(&shd_desc);
+    _scull.shd = sg_make_shader(&shd_desc);
+    if (SG_RESOURCESTATE_VALID != sg_query_shader_state(_scull.shd)) {
+        _SCULL_ERROR(CREATE_SHADER_FAILED);
+        _scull.supported = false;
+        return;
+    }
+    sg_pipeline_desc pip_desc;
+    memset(&pip_desc, 0, sizeof(pip_desc));
+    pip_desc.compute = true;
+    pip_desc.shader = _scull.shd;
+    pip_desc.label = "sokol-gpu-cull-pipeline";
+    _scull.pip = sg_make_pipeline(&pip_desc);
+    if (SG_RESOURCESTATE_VALID != sg_query_pipeline_state(_scull.pip)) {
+        _SCULL_ERROR(CREATE_PIPELINE_FAILED);
+        _scull.supported = false;
+        return;
+    }
+}
+
+SOKOL_API_IMPL void scull_shutdown(void) {
+    SOKOL_ASSERT(_SCULL_INIT_COOKIE == _scull.init_cookie);
+    // NOTE: it's valid to call the destroy funcs with SG_INVALID_ID
+    sg_destroy_pipeline(_scull.pip);
+    sg_destroy_shader(_scull.shd);
+    _scull.init_cookie = 0;
+}
+
+SOKOL_API_IMPL void scull_cull(const scull_cull_desc* desc) {
+    SOKOL_ASSERT(_SCULL_INIT_COOKIE == _scull.init_cookie);
+    SOKOL_ASSERT(desc && (desc->num_instances >= 0));
+    if (!_scull.supported) {
+        return;
+    }
+    const int num_groups = (desc->num_instances + _SCULL_THREADS_PER_GROUP - 1) / _SCULL_THREADS_PER_GROUP;
+    if (num_groups > _SCULL_MAX_GROUPS) {
+        _SCULL_ERROR(TOO_MANY_INSTANCES);
+        return;
+    }
+    _scull_params_t params;
+    memset(&params, 0, sizeof(params));
+    _scull_extract_planes(desc->view_proj, params.planes);
+    params.counts[0] = desc->num_instances;
+    params.counts[1] = desc->num_elements;
+    params.counts[2] = desc->base_element;
+    params.counts[3] = desc->base_vertex;
+    params.flags[1] = desc->indexed ? 1 : 0;
+
+    const sg_range params_range = { &params, sizeof(params) };
+    sg_bindings bnd;
+    memset(&bnd, 0, sizeof(bnd));
+    bnd.storage_buffers[_SCULL_SBUF_BOUNDS] = desc->bounds;
+    bnd.storage_buffers[_SCULL_SBUF_VISIBLE] = desc->visible;
+    bnd.storage_buffers[_SCULL_SBUF_ARGS] = desc->args;
+    sg_apply_pipeline(_scull.pip);
+
+    // first dispatch: reset the indirect draw arguments
+    params.flags[0] = _SCULL_MODE_CLEAR;
+    sg_apply_bindings(&bnd);
+    sg_apply_uniforms(0, &params_range);
+    sg_dispatch(1, 1, 1);
+
+    // second dispatch: cull and append visible instances, the bindings
+    // are applied again so that the GL backend inserts a memory barrier
+    if (num_groups > 0) {
+        params.flags[0] = _SCULL_MODE_CULL;
+        sg_apply_bindings(&bnd);
+        sg_apply_uniforms(0, &params_range);
+        sg_dispatch(num_groups, 1, 1);
+    }
+}
+
+#endif /* SOKOL_GPU_CULL_IMPL */
@@ -0,0 +1,8 @@
+#if defined(IMPL)
+#define SOKOL_PROFILER_IMPL
+#endif
+#include "sokol_defines.h"
+#include "sokol_app.h"
+#include "sokol_gfx.h"
+#include "sokol_time.h"
+#include "sokol_profiler.h"
@@ -0,0 +1,983 @@
+#if defined(SOKOL_IMPL) && !defined(SOKOL_PROFILER_IMPL)
+#define SOKOL_PROFILER_IMPL
+#endif
+#ifndef SOKOL_PROFILER_INCLUDED
+/*
+    sokol_profiler.h -- record CPU-side frame events and export them as Chrome trace JSON
+
+    Project URL: https://github.com/Ed94/SectrPrototype (Sectr fork of sokol-odin)
+
+    This header is an addition of the Sectr fork and is not part of the upstream
+    sokol headers (https://github.com/floooh/sokol), it follows their API conventions.
+
+    Do this:
+        #define SOKOL_IMPL or
+        #define SOKOL_PROFILER_IMPL
+    before you include this file in *one* C or C++ file to create the
+    implementation.
+
+    sokol_gfx.h must be compiled with SOKOL_TRACE_HOOKS defined, otherwise
+    no sokol_gfx.h events will be recorded (user scopes still work).
+
+    Optionally provide the following defines with your own implementations:
+
+    SOKOL_ASSERT(c)             - your own assert macro (default: assert(c))
+    SOKOL_PROFILER_API_DECL     - public function declaration prefix (default: extern)
+    SOKOL_API_DECL              - same as SOKOL_PROFILER_API_DECL
+    SOKOL_API_IMPL              - public function implementation prefix (default: -)
+
+    If sokol_profiler.h is compiled as a DLL, define the following before
+    including the declaration or implementation:
+
+    SOKOL_DLL
+
+    On Windows, SOKOL_DLL will define SOKOL_PROFILER_API_DECL as __declspec(dllexport)
+    or __declspec(dllimport) as needed.
+
+    Include the following headers before including sokol_profiler.h:
+
+        sokol_gfx.h
+        sokol_time.h
+
+    ...and optionally sokol_app.h to get sprof_wrap_sapp_desc().
+
+    FEATURES AND CONCEPTS
+    =====================
+    - records begin/end events with CPU timestamps into one ring buffer
+      per thread, recording doesn't take any locks, the oldest events
+      are overwritten when a ring buffer is full
+    - sokol_gfx.h passes and debug groups are recorded automatically
+      via the sokol_gfx.h trace hooks, since sokol_gl.h and sokol_debugtext.h
+      wrap their draw calls into debug groups this also records the
+      sgl_draw() and sdtx_draw() calls (sgp_flush() doesn't push a debug
+      group, see below)
+    - sg_commit() is recorded as an instant event
+    - the sokol_app.h init, frame and cleanup callbacks can be recorded
+      by wrapping the sapp_desc struct with sprof_wrap_sapp_desc()
+    - user scopes and instant events can be recorded from any thread
+    - the recorded events are exported as Chrome 'trace_event' JSON
+      which can be loaded into https://ui.perfetto.dev or chrome://tracing
+
+    STEP BY STEP
+    ============
+    --- call sprof_setup() after sg_setup() and stm_setup():
+
+            stm_setup();
+            sg_setup(&(sg_desc){ ... });
+            sprof_setup(&(sprof_desc_t){ .logger.func = slog_func });
+
+        sokol_profiler.h installs its own sokol_gfx.h trace hooks and calls
+        any previously installed trace hooks.
+
+        The following sprof_desc_t items can be provided:
+
+            .max_events     - the number of events in each per-thread
+                              ring buffer (default: 8192, rounded up
+                              to the next power of two)
+            .max_threads    - the max number of threads which record
+                              events (default: 32)
+
+    --- record your own scopes and instant events, these calls may happen
+        on any thread:
+
+            sprof_begin("update");
+            ...
+            sprof_end();
+            sprof_instant("level loaded");
+
+        Event names are copied, names longer than SPROF_MAX_NAME_LENGTH-1
+        characters are truncated. Calls to the recording functions are
+        silently ignored while sokol_profiler.h isn't set up.
+
+    --- sokol_gp.h (a third-party header) doesn't wrap sgp_flush() into a
+        debug group, to see it in the trace, wrap the call yourself:
+
+            sg_push_debug_group("sokol-gp");
+            sgp_flush();
+            sg_pop_debug_group();
+
+    --- optionally give the calling thread a name which shows up
+        in the trace viewer (call this once right at the start of a thread):
+
+            sprof_set_thread_name("worker 0");
+
+    --- to record the sokol_app.h callbacks, wrap the sapp_desc struct
+        returned from sokol_main():
+
+            sapp_desc sokol_main(int argc, char* argv[]) {
+                return sprof_wrap_sapp_desc(&(sapp_desc){
+                    .init_cb = init,
+                    .frame_cb = frame,
+                    .cleanup_cb = cleanup,
+                    ...
+                });
+            }
+
+        Note that the begin event of the init callback and the end event
+        of the cleanup callback are lost since sokol_profiler.h is set up
+        and shut down inside those callbacks.
+
+    --- to get the recorded events as Chrome trace JSON:
+
+            const sprof_range json = sprof_dump_json();
+            // ...write json.ptr/json.size to a file...
+
+        The returned data remains valid until the next call to
+        sprof_dump_json() or sprof_shutdown(). The dump contains the most
+        recent events of each thread and may be called while other threads
+        are recording (but it must not be called from several threads at
+        the same time).
+
+    --- to drop all events recorded so far (for instance to only
+        export the events of the next few frames) call:
+
+            sprof_clear();
+
+    --- call sprof_shutdown() before sg_shutdown(), all other threads must
+        have stopped recording at this point:
+
+            sprof_shutdown();
+            sg_shutdown();
+
+    ERROR REPORTING AND LOGGING
+    ===========================
+    To get any logging information at all you need to provide a logging callback in the setup call,
+    the easiest way is to use sokol_log.h:
+
+        #include "sokol_log.h"
+
+        sprof_setup(&(sprof_desc_t){
+            // ...
+            .logger.func = slog_func
+        });
+
+    NOTE that the logging callback may be called from any thread which
+    records events.
+
+    MEMORY ALLOCATION OVERRIDE
+    ==========================
+    You can override the memory allocation functions at initialization time
+    like this:
+
+        void* my_alloc(size_t size, void* user_data) {
+            return malloc(size);
+        }
+
+        void my_free(void* ptr, void* user_data) {
+            free(ptr);
+        }
+
+        ...
+            sprof_setup(&(sprof_desc_t){
+                // ...
+                .allocator = {
+                    .alloc_fn = my_alloc,
+                    .free_fn = my_free,
+                    .user_data = ...;
+                }
+            });
+        ...
+
+    If no overrides are provided, malloc and free will be used. The
+    ring buffer of a thread is allocated by the first event recorded
+    on that thread, so the alloc_fn must be thread-safe.
+
+    LICENSE
+    =======
+    zlib/libpng license
+
+    Copyright (c) 2026 the Sectr fork contributors
+
+    This software is provided 'as-is', without any express or implied warranty.
+    In no event will the authors be held liable for any damages arising from the
+    use of this software.
+
+    Permission is granted to anyone to use this software for any purpose,
+    including commercial applications, and to alter it and redistribute it
+    freely, subject to the following restrictions:
+
+        1. The origin of this software must not be misrepresented; you must not
+        claim that you wrote the original software. If you use this software in a
+        product, an acknowledgment in the product documentation would be
+        appreciated but is not required.
+
+        2. Altered source versions must be plainly marked as such, and must not
+        be misrepresented as being the original software.
+
+        3. This notice may not be removed or altered from any source
+        distribution.
+*/
+#define SOKOL_PROFILER_INCLUDED (1)
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h> // size_t
+
+#if !defined(SOKOL_GFX_INCLUDED)
+#error "Please include sokol_gfx.h before sokol_profiler.h"
+#endif
+#if !defined(SOKOL_TIME_INCLUDED)
+#error "Please include sokol_time.h before sokol_profiler.h"
+#endif
+
+#if defined(SOKOL_API_DECL) && !defined(SOKOL_PROFILER_API_DECL)
+#define SOKOL_PROFILER_API_DECL SOKOL_API_DECL
+#endif
+#ifndef SOKOL_PROFILER_API_DECL
+#if defined(_WIN32) && defined(SOKOL_DLL) && defined(SOKOL_PROFILER_IMPL)
+#define SOKOL_PROFILER_API_DECL __declspec(dllexport)
+#elif defined(_WIN32) && defined(SOKOL_DLL)
+#define SOKOL_PROFILER_API_DECL __declspec(dllimport)
+#else
+#define SOKOL_PROFILER_API_DECL extern
+#endif
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+enum {
+    SPROF_MAX_NAME_LENGTH = 32,     // including the terminating zero
+};
+
+/*
+    sprof_log_item_t
+
+    Log items are defined via X-Macros, and expanded to an
+    enum 'sprof_log_item' - and in debug mode only - corresponding strings.
+
+    Used as parameter in the logging callback.
+*/
+#define _SPROF_LOG_ITEMS \
+    _SPROF_LOGITEM_XMACRO(OK, "Ok") \
+    _SPROF_LOGITEM_XMACRO(MALLOC_FAILED, "memory allocation failed") \
+    _SPROF_LOGITEM_XMACRO(TOO_MANY_THREADS, "too many threads are recording events, events are dropped (adjust via sprof_desc_t.max_threads)") \
+
+#define _SPROF_LOGITEM_XMACRO(item,msg) SPROF_LOGITEM_##item,
+typedef enum sprof_log_item_t {
+    _SPROF_LOG_ITEMS
+} sprof_log_item_t;
+#undef _SPROF_LOGITEM_XMACRO
+
+/*
+    sprof_logger_t
+
+    Used in sprof_desc_t to provide a custom logging and error reporting
+    callback to sokol-profiler.
+*/
+typedef struct sprof_logger_t {
+    void (*func)(
+        const char* tag,                // always "sprof"
+        uint32_t log_level,             // 0=panic, 1=error, 2=warning, 3=info
+        uint32_t log_item_id,           // SPROF_LOGITEM_*
+        const char* message_or_null,    // a message string, may be nullptr in release mode
+        uint32_t line_nr,               // line number in sokol_profiler.h
+        const char* filename_or_null,   // source filename, may be nullptr in release mode
+        void* user_data);
+    void* user_data;
+} sprof_logger_t;
+
+/*
+    sprof_allocator_t
+
+    Used in sprof_desc_t to provide custom memory-alloc and -free functions
+    to sokol_profiler.h. If memory management should be overridden, both the
+    alloc_fn and free_fn function must be provided (e.g. it's not valid to
+    override one function but not the other).
+*/
+typedef struct sprof_allocator_t {
+    void* (*alloc_fn)(size_t size, void* user_data);
+    void (*free_fn)(void* ptr, void* user_data);
+    void* user_data;
+} sprof_allocator_t;
+
+/*
+    sprof_range is a pointer-size-pair struct used to pass
+    the exported JSON data out of sokol-profiler.
+*/
+typedef struct sprof_range {
+    const void* ptr;
+    size_t size;
+} sprof_range;
+
+/*
+    sprof_desc_t
+
+    Describes the profiler setup parameters, passed to sprof_setup().
+*/
+typedef struct sprof_desc_t {
+    int max_events;                         // number of events per thread, default: 8192
+    int max_threads;                        // max number of recording threads, default: 32
+    sprof_allocator_t allocator;            // optional memory allocation overrides (default: malloc/free)
+    sprof_logger_t logger;                  // optional log override function (default: NO LOGGING)
+} sprof_desc_t;
+
+/* setup and shutdown */
+SOKOL_PROFILER_API_DECL void sprof_setup(const sprof_desc_t* desc);
+SOKOL_PROFILER_API_DECL void sprof_shutdown(void);
+
+/* recording (may be called from any thread) */
+SOKOL_PROFILER_API_DECL void sprof_begin(const char* name);
+SOKOL_PROFILER_API_DECL void sprof_end(void);
+SOKOL_PROFILER_API_DECL void sprof_instant(const char* name);
+SOKOL_PROFILER_API_DECL void sprof_set_thread_name(const char* name);
+
+/* exporting */
+SOKOL_PROFILER_API_DECL void sprof_clear(void);
+SOKOL_PROFILER_API_DECL sprof_range sprof_dump_json(void);
+
+/* wrap the sokol_app.h callbacks into profiler scopes */
+#if defined(SOKOL_APP_INCLUDED)
+SOKOL_PROFILER_API_DECL sapp_desc sprof_wrap_sapp_desc(const sapp_desc* desc);
+#endif
+
+#ifdef __cplusplus
+} /* extern "C" */
+/* C++ const-ref wrappers */
+inline void sprof_setup(const sprof_desc_t& desc) { return sprof_setup(&desc); }
+#if defined(SOKOL_APP_INCLUDED)
+inline sapp_desc sprof_wrap_sapp_desc(const sapp_desc& desc) { return sprof_wrap_sapp_desc(&desc); }
+#endif
+#endif
+#endif /* SOKOL_PROFILER_INCLUDED */
+
+// ██ ███    ███ ██████  ██      ███████ ███    ███ ███████ ███    ██ ████████  █████  ████████ ██  ██████  ███    ██
+// ██ ████  ████ ██   ██ ██      ██      ████  ████ ██      ████   ██    ██    ██   ██    ██    ██ ██    ██ ████   ██
+// ██ ██ ████ ██ ██████  ██      █████   ██ ████ ██ █████   ██ ██  ██    ██    ███████    ██    ██ ██    ██ ██ ██  ██
+// ██ ██  ██  ██ ██      ██      ██      ██  ██  ██ ██      ██  ██ ██    ██    ██   ██    ██    ██ ██    ██ ██  ██ ██
+// ██ ██      ██ ██      ███████ ███████ ██      ██ ███████ ██   ████    ██    ██   ██    ██    ██  ██████  ██   ████
+//
+// >>implementation
+#ifdef SOKOL_PROFILER_IMPL
+#define SOKOL_PROFILER_IMPL_INCLUDED (1)
+
+#if defined(SOKOL_MALLOC) || defined(SOKOL_CALLOC) || defined(SOKOL_FREE)
+#error "SOKOL_MALLOC/CALLOC/FREE macros are no longer supported, please use sprof_desc_t.allocator to override memory allocation functions"
+#endif
+
+#include <string.h> // memset, memcpy
+#include <stdlib.h> // malloc/free
+#include <stdio.h>  // snprintf
+
+#ifndef SOKOL_API_IMPL
+    #define SOKOL_API_IMPL
+#endif
+#ifndef SOKOL_DEBUG
+    #ifndef NDEBUG
+        #define SOKOL_DEBUG
+    #endif
+#endif
+#ifndef SOKOL_ASSERT
+    #include <assert.h>
+    #define SOKOL_ASSERT(c) assert(c)
+#endif
+#ifndef _SOKOL_UNUSED
+    #define _SOKOL_UNUSED(x) (void)(x)
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h> // _InterlockedIncrement, ...
+#define _SPROF_THREAD_LOCAL __declspec(thread)
+#else
+#define _SPROF_THREAD_LOCAL __thread
+#endif
+
+#define _sprof_def(val, def) (((val) == 0) ? (def) : (val))
+#define _SPROF_INIT_COOKIE (0xABCDBAFF)
+#define _SPROF_DEFAULT_MAX_EVENTS (8192)
+#define _SPROF_DEFAULT_MAX_THREADS (32)
+
+// Chrome trace event phases
+typedef enum {
+    _SPROF_PHASE_BEGIN = 'B',
+    _SPROF_PHASE_END = 'E',
+    _SPROF_PHASE_INSTANT = 'i',
+} _sprof_phase_t;
+
+// event categories, written as 'cat' field
+typedef enum {
+    _SPROF_CAT_USER,
+    _SPROF_CAT_GFX,
+    _SPROF_CAT_APP,
+    _SPROF_CAT_NUM,
+} _sprof_cat_t;
+
+typedef struct {
+    uint64_t ticks;
+    uint8_t phase;                      // _sprof_phase_t
+    uint8_t cat;                        // _sprof_cat_t
+    char name[SPROF_MAX_NAME_LENGTH];
+} _sprof_event_t;
+
+// a per-thread ring buffer, only the owning thread writes events, the
+// write position is published with release semantics after the event
+// has been written so that sprof_dump_json() can take a snapshot
+typedef struct {
+    uint32_t registered;                // written once by the owning thread after setting up the slot
+    uint32_t write_pos;                 // monotonic event counter, wraps around
+    uint32_t clear_pos;                 // only accessed by the dumping thread
+    _sprof_event_t* events;
+    char name[SPROF_MAX_NAME_LENGTH];
+} _sprof_thread_t;
+
+typedef struct {
+    char* ptr;
+    size_t size;
+    size_t cap;
+} _sprof_str_t;
+
+typedef struct {
+    uint32_t init_cookie;
+    sprof_desc_t desc;
+    uint32_t ring_mask;                 // max_events - 1
+    uint32_t num_threads;               // incremented atomically when a thread records its first event
+    _sprof_thread_t* threads;
+    uint64_t start_ticks;
+    sg_trace_hooks hooks;
+    _sprof_event_t* snapshot;           // scratch space for sprof_dump_json()
+    _sprof_str_t json;
+} _sprof_t;
+static _sprof_t _sprof;
+
+// incremented on each sprof_setup() to invalidate the thread-local slot
+// pointers of a previous setup (and thus not cleared in sprof_setup())
+static uint32_t _sprof_generation;
+static _SPROF_THREAD_LOCAL _sprof_thread_t* _sprof_cur_thread;
+static _SPROF_THREAD_LOCAL uint32_t _sprof_cur_generation;
+
+// ██       ██████   ██████   ██████  ██ ███    ██  ██████
+// ██      ██    ██ ██       ██       ██ ████   ██ ██
+// ██      ██    ██ ██   ███ ██   ███ ██ ██ ██  ██ ██   ███
+// ██      ██    ██ ██    ██ ██    ██ ██ ██  ██ ██ ██    ██
+// ███████  ██████   ██████   ██████  ██ ██   ████  ██████
+//
+// >>logging
+#if defined(SOKOL_DEBUG)
+#define _SPROF_LOGITEM_XMACRO(item,msg) #item ": " msg,
+static const char* _sprof_log_messages[] = {
+    _SPROF_LOG_ITEMS
+};
+#undef _SPROF_LOGITEM_XMACRO
+#endif // SOKOL_DEBUG
+
+#define _SPROF_PANIC(code) _sprof_log(SPROF_LOGITEM_ ##code, 0, __LINE__)
+#define _SPROF_ERROR(code) _sprof_log(SPROF_LOGITEM_ ##code, 1, __LINE__)
+#define _SPROF_WARN(code) _sprof_log(SPROF_LOGITEM_ ##code, 2, __LINE__)
+#define _SPROF_INFO(code) _sprof_log(SPROF_LOGITEM_ ##code, 3, __LINE__)
+
+static void _sprof_log(sprof_log_item_t log_item, uint32_t log_level, uint32_t line_nr) {
+    if (_sprof.desc.logger.func) {
+        #if defined(SOKOL_DEBUG)
+            const char* filename = __FILE__;
+            const char* message = _sprof_log_messages[log_item];
+        #else
+            const char* filename = 0;
+            const char* message = 0;
+        #endif
+        _sprof.desc.logger.func("sprof", log_level, (uint32_t)log_item, message, line_nr, filename, _sprof.desc.logger.user_data);
+    } else {
+        // for log level PANIC it would be 'undefined behaviour' to continue
+        if (log_level == 0) {
+            abort();
+        }
+    }
+}
+
+// ███    ███ ███████ ███    ███  ██████  ██████  ██    ██
+// ████  ████ ██      ████  ████ ██    ██ ██   ██  ██  ██
+// ██ ████ ██ █████   ██ ████ ██ ██    ██ ██████    ████
+// ██  ██  ██ ██      ██  ██  ██ ██    ██ ██   ██    ██
+// ██      ██ ███████ ██      ██  ██████  ██   ██    ██
+//
+// >>memory
+static void _sprof_clear(void* ptr, size_t size) {
+    SOKOL_ASSERT(ptr && (size > 0));
+    memset(ptr, 0, size);
+}
+
+static void* _sprof_malloc(size_t size) {
+    SOKOL_ASSERT(size > 0);
+    void* ptr;
+    if (_sprof.desc.allocator.alloc_fn) {
+        ptr = _sprof.desc.allocator.alloc_fn(size, _sprof.desc.allocator.user_data);
+    } else {
+        ptr = malloc(size);
+    }
+    if (0 == ptr) {
+        _SPROF_PANIC(MALLOC_FAILED);
+    }
+    return ptr;
+}
+
+static void* _sprof_malloc_clear(size_t size) {
+    void* ptr = _sprof_malloc(size);
+    _sprof_clear(ptr, size);
+    return ptr;
+}
+
+static void _sprof_free(void* ptr) {
+    if (_sprof.desc.allocator.free_fn) {
+        _sprof.desc.allocator.free_fn(ptr, _sprof.desc.allocator.user_data);
+    } else {
+        free(ptr);
+    }
+}
+
+//  █████  ████████  ██████  ███    ███ ██  ██████
+// ██   ██    ██    ██    ██ ████  ████ ██ ██
+// ███████    ██    ██    ██ ██ ████ ██ ██ ██
+// ██   ██    ██    ██    ██ ██  ██  ██ ██ ██
+// ██   ██    ██     ██████  ██      ██ ██  ██████
+//
+// >>atomic
+static uint32_t _sprof_atomic_fetch_inc(uint32_t* ptr) {
+    #if defined(_MSC_VER)
+        return (uint32_t)_InterlockedIncrement((volatile long*)ptr) - 1;
+    #else
+        return __atomic_fetch_add(ptr, 1, __ATOMIC_RELAXED);
+    #endif
+}
+
+static uint32_t _sprof_atomic_load(uint32_t* ptr) {
+    #if defined(_MSC_VER)
+        return (uint32_t)_InterlockedOr((volatile long*)ptr, 0);
+    #else
+        return __atomic_load_n(ptr, __ATOMIC_ACQUIRE);
+    #endif
+}
+
+// a store which is neither reordered with preceding nor with following
+// memory accesses, the writer uses this to publish the write position
+// before overwriting the next ring buffer slot
+static void _sprof_atomic_store(uint32_t* ptr, uint32_t val) {
+    #if defined(_MSC_VER)
+        _InterlockedExchange((volatile long*)ptr, (long)val);
+    #else
+        __atomic_store_n(ptr, val, __ATOMIC_RELEASE);
+        __atomic_thread_fence(__ATOMIC_RELEASE);
+    #endif
+}
+
+// a load which isn't reordered with preceding reads, used by the
+// reader to check whether the writer has overwritten copied slots
+static uint32_t _sprof_atomic_reload(uint32_t* ptr) {
+    #if defined(_MSC_VER)
+        return (uint32_t)_InterlockedOr((volatile long*)ptr, 0);
+    #else
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        return __atomic_load_n(ptr, __ATOMIC_RELAXED);
+    #endif
+}
+
+// ██████  ███████  ██████  ██████  ██████  ██████  ██ ███    ██  ██████
+// ██   ██ ██      ██      ██    ██ ██   ██ ██   ██ ██ ████   ██ ██
+// ██████  █████   ██      ██    ██ ██████  ██   ██ ██ ██ ██  ██ ██   ███
+// ██   ██ ██      ██      ██    ██ ██   ██ ██   ██ ██ ██  ██ ██ ██    ██
+// ██   ██ ███████  ██████  ██████  ██   ██ ██████  ██ ██   ████  ██████
+//
+// >>recording
+static void _sprof_copy_name(char* dst, const char* src) {
+    size_t i = 0;
+    if (src) {
+        for (; (i < (SPROF_MAX_NAME_LENGTH - 1)) && (src[i] != 0); i++) {
+            dst[i] = src[i];
+        }
+    }
+    dst[i] = 0;
+}
+
+// returns the calling thread's ring buffer, or null if the thread
+// can't record events, the first call on a thread registers a new slot
+static _sprof_thread_t* _sprof_thread(void) {
+    if (_SPROF_INIT_COOKIE != _sprof.init_cookie) {
+        return 0;
+    }
+    if (_sprof_cur_generation == _sprof_generation) {
+        return _sprof_cur_thread;
+    }
+    _sprof_cur_generation = _sprof_generation;
+    _sprof_cur_thread = 0;
+    const uint32_t slot_index = _sprof_atomic_fetch_inc(&_sprof.num_threads);
+    if (slot_index >= (uint32_t)_sprof.desc.max_threads) {
+        if (slot_index == (uint32_t)_sprof.desc.max_threads) {
+            _SPROF_WARN(TOO_MANY_THREADS);
+        }
+        return 0;
+    }
+    _sprof_thread_t* thread = &_sprof.threads[slot_index];
+    thread->events = (_sprof_event_t*) _sprof_malloc_clear((size_t)_sprof.desc.max_events * sizeof(_sprof_event_t));
+    snprintf(thread->name, sizeof(thread->name), "thread %u", slot_index);
+    _sprof_atomic_store(&thread->registered, 1);
+    _sprof_cur_thread = thread;
+    return thread;
+}
+
+static void _sprof_record(_sprof_phase_t phase, _sprof_cat_t cat, const char* name) {
+    _sprof_thread_t* thread = _sprof_thread();
+    if (0 == thread) {
+        return;
+    }
+    // only the owning thread writes write_pos, so a plain read is fine here
+    const uint32_t pos = thread->write_pos;
+    _sprof_event_t* ev = &thread->events[pos & _sprof.ring_mask];
+    ev->ticks = stm_now();
+    ev->phase = (uint8_t)phase;
+    ev->cat = (uint8_t)cat;
+    _sprof_copy_name(ev->name, name);
+    _sprof_atomic_store(&thread->write_pos, pos + 1);
+}
+
+// ██   ██  ██████   ██████  ██   ██ ███████
+// ██   ██ ██    ██ ██    ██ ██  ██  ██
+// ███████ ██    ██ ██    ██ █████   ███████
+// ██   ██ ██    ██ ██    ██ ██  ██       ██
+// ██   ██  ██████   ██████  ██   ██ ███████
+//
+// >>hooks
+static void _sprof_begin_pass(const sg_pass* pass, void* user_data) {
+    const char* name = pass->label ? pass->label : (pass->compute ? "compute pass" : "pass");
+    _sprof_record(_SPROF_PHASE_BEGIN, _SPROF_CAT_GFX, name);
+    if (_sprof.hooks.begin_pass) {
+        _sprof.hooks.begin_pass(pass, user_data);
+    }
+}
+
+static void _sprof_end_pass(void* user_data) {
+    _sprof_record(_SPROF_PHASE_END, _SPROF_CAT_GFX, 0);
+    if (_sprof.hooks.end_pass) {
+        _sprof.hooks.end_pass(user_data);
+    }
+}
+
+static void _sprof_push_debug_group(const char* name, void* user_data) {
+    _sprof_record(_SPROF_PHASE_BEGIN, _SPROF_CAT_GFX, name);
+    if (_sprof.hooks.push_debug_group) {
+        _sprof.hooks.push_debug_group(name, user_data);
+    }
+}
+
+static void _sprof_pop_debug_group(void* user_data) {
+    _sprof_record(_SPROF_PHASE_END, _SPROF_CAT_GFX, 0);
+    if (_sprof.hooks.pop_debug_group) {
+        _sprof.hooks.pop_debug_group(user_data);
+    }
+}
+
+static void _sprof_commit(void* user_data) {
+    _sprof_record(_SPROF_PHASE_INSTANT, _SPROF_CAT_GFX, "sg_commit");
+    if (_sprof.hooks.commit) {
+        _sprof.hooks.commit(user_data);
+    }
+}
+
+// all other hooks are passed through to the previously installed hooks
+static void _sprof_install_hooks(void) {
+    sg_trace_hooks hooks;
+    _sprof_clear(&hooks, sizeof(hooks));
+    _sprof.hooks = sg_install_trace_hooks(&hooks);
+    hooks = _sprof.hooks;
+    hooks.begin_pass = _sprof_begin_pass;
+    hooks.end_pass = _sprof_end_pass;
+    hooks.push_debug_group = _sprof_push_debug_group;
+    hooks.pop_debug_group = _sprof_pop_debug_group;
+    hooks.commit = _sprof_commit;
+    sg_install_trace_hooks(&hooks);
+}
+
+//      ██ ███████  ██████  ███    ██
+//      ██ ██      ██    ██ ████   ██
+//      ██ ███████ ██    ██ ██ ██  ██
+// ██   ██      ██ ██    ██ ██  ██ ██
+//  █████  ███████  ██████  ██   ████
+//
+// >>json
+static void _sprof_str_discard(_sprof_str_t* str) {
+    if (str->ptr) {
+        _sprof_free(str->ptr);
+    }
+    _sprof_clear(str, sizeof(_sprof_str_t));
+}
+
+static void _sprof_str_reserve(_sprof_str_t* str, size_t num_bytes) {
+    if ((str->size + num_bytes) > str->cap) {
+        size_t new_cap = (str->cap > 0) ? (str->cap * 2) : (64 * 1024);
+        while (new_cap < (str->size + num_bytes)) {
+            new_cap *= 2;
+        }
+        char* new_ptr = (char*) _sprof_malloc(new_cap);
+        if (str->ptr) {
+            memcpy(new_ptr, str->ptr, str->size);
+            _sprof_free(str->ptr);
+        }
+        str->ptr = new_ptr;
+        str->cap = new_cap;
+    }
+}
+
+static void _sprof_str_append(_sprof_str_t* str, const char* src) {
+    const size_t len = strlen(src);
+    _sprof_str_reserve(str, len);
+    memcpy(str->ptr + str->size, src, len);
+    str->size += len;
+}
+
+// appends a string as a JSON string literal
+static void _sprof_str_append_quoted(_sprof_str_t* str, const char* src) {
+    char buf[8];
+    _sprof_str_append(str, "\"");
+    for (const char* p = src; *p; p++) {
+        const unsigned char c = (unsigned char)*p;
+        if ((c == '"') || (c == '\\')) {
+            buf[0] = '\\'; buf[1] = (char)c; buf[2] = 0;
+        } else if (c < 0x20) {
+            snprintf(buf, sizeof(buf), "\\u%04x", c);
+        } else {
+            buf[0] = (char)c; buf[1] = 0;
+        }
+        _sprof_str_append(str, buf);
+    }
+    _sprof_str_append(str, "\"");
+}
+
+static void _sprof_json_sep(_sprof_str_t* str, bool* first) {
+    _sprof_str_append(str, *first ? "\n" : ",\n");
+    *first = false;
+}
+
+static void _sprof_json_thread(_sprof_str_t* str, uint32_t tid, _sprof_thread_t* thread, bool* first) {
+    static const char* cat_names[_SPROF_CAT_NUM] = { "user", "gfx", "app" };
+    char buf[128];
+
+    // take a snapshot of the ring buffer, and afterwards drop the
+    // events which may have been overwritten while copying
+    const uint32_t cap = _sprof.ring_mask + 1;
+    const uint32_t end_pos = _sprof_atomic_load(&thread->write_pos);
+    uint32_t start_pos = ((end_pos - thread->clear_pos) > cap) ? (end_pos - cap) : thread->clear_pos;
+    for (uint32_t pos = start_pos; pos != end_pos; pos++) {
+        _sprof.snapshot[pos & _sprof.ring_mask] = thread->events[pos & _sprof.ring_mask];
+    }
+    // the owning thread may be writing the event at the current write
+    // position, which overwrites the slot of event (write_pos - cap)
+    const uint32_t safe_pos = _sprof_atomic_reload(&thread->write_pos) + 1 - cap;
+    if ((int32_t)(safe_pos - start_pos) > 0) {
+        start_pos = ((int32_t)(safe_pos - end_pos) > 0) ? end_pos : safe_pos;
+    }
+
+    _sprof_json_sep(str, first);
+    snprintf(buf, sizeof(buf), "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":", tid);
+    _sprof_str_append(str, buf);
+    _sprof_str_append_quoted(str, thread->name);
+    _sprof_str_append(str, "}}");
+
+    // end events without a matching begin event (because the begin
+    // event was overwritten or dropped) are skipped
+    int depth = 0;
+    for (uint32_t pos = start_pos; pos != end_pos; pos++) {
+        const _sprof_event_t* ev = &_sprof.snapshot[pos & _sprof.ring_mask];
+        if (ev->phase == _SPROF_PHASE_END) {
+            if (depth == 0) {
+                continue;
+            }
+            depth--;
+        } else if (ev->phase == _SPROF_PHASE_BEGIN) {
+            depth++;
+        }
+        SOKOL_ASSERT(ev->cat < _SPROF_CAT_NUM);
+        const double ts = stm_us(stm_diff(ev->ticks, _sprof.start_ticks));
+        _sprof_json_sep(str, first);
+        snprintf(buf, sizeof(buf), "{\"ph\":\"%c\",\"cat\":\"%s\",\"pid\":1,\"tid\":%u,\"ts\":%.3f",
+            (char)ev->phase, cat_names[ev->cat], tid, ts);
+        _sprof_str_append(str, buf);
+        if (ev->phase != _SPROF_PHASE_END) {
+            _sprof_str_append(str, ",\"name\":");
+            _sprof_str_append_quoted(str, ev->name);
+        }
+        if (ev->phase == _SPROF_PHASE_INSTANT) {
+            _sprof_str_append(str, ",\"s\":\"t\"");
+        }
+        _sprof_str_append(str, "}");
+    }
+}
+
+// ███████  █████  ██████  ██████
+// ██      ██   ██ ██   ██ ██   ██
+// ███████ ███████ ██████  ██████
+//      ██ ██   ██ ██      ██
+// ███████ ██   ██ ██      ██
+//
+// >>sapp
+#if defined(SOKOL_APP_INCLUDED)
+// the original callbacks, kept outside _sprof since sprof_setup() is
+// usually called from inside the wrapped init callback
+static struct {
+    sapp_desc desc;
+} _sprof_sapp;
+
+static void _sprof_sapp_init(void) {
+    sprof_begin("init");
+    _sprof_sapp.desc.init_cb();
+    sprof_end();
+}
+
+static void _sprof_sapp_frame(void) {
+    sprof_begin("frame");
+    _sprof_sapp.desc.frame_cb();
+    sprof_end();
+}
+
+static void _sprof_sapp_cleanup(void) {
+    sprof_begin("cleanup");
+    _sprof_sapp.desc.cleanup_cb();
+    sprof_end();
+}
+
+static void _sprof_sapp_init_userdata(void* user_data) {
+    sprof_begin("init");
+    _sprof_sapp.desc.init_userdata_cb(user_data);
+    sprof_end();
+}
+
+static void _sprof_sapp_frame_userdata(void* user_data) {
+    sprof_begin("frame");
+    _sprof_sapp.desc.frame_userdata_cb(user_data);
+    sprof_end();
+}
+
+static void _sprof_sapp_cleanup_userdata(void* user_data) {
+    sprof_begin("cleanup");
+    _sprof_sapp.desc.cleanup_userdata_cb(user_data);
+    sprof_end();
+}
+#endif
+
+// ██████  ██    ██ ██████  ██      ██  ██████
+// ██   ██ ██    ██ ██   ██ ██      ██ ██
+// ██████  ██    ██ ██████  ██      ██ ██
+// ██      ██    ██ ██   ██ ██      ██ ██
+// ██       ██████  ██████  ███████ ██  ██████
+//
+// >>public
+static sprof_desc_t _sprof_desc_defaults(const sprof_desc_t* desc) {
+    SOKOL_ASSERT((desc->allocator.alloc_fn && desc->allocator.free_fn) || (!desc->allocator.alloc_fn && !desc->allocator.free_fn));
+    sprof_desc_t res = *desc;
+    res.max_events = _sprof_def(res.max_events, _SPROF_DEFAULT_MAX_EVENTS);
+    res.max_threads = _sprof_def(res.max_threads, _SPROF_DEFAULT_MAX_THREADS);
+    // round the ring buffer size up to the next power of two
+    int max_events = 1;
+    while (max_events < res.max_events) {
+        max_events <<= 1;
+    }
+    res.max_events = max_events;
+    return res;
+}
+
+SOKOL_API_IMPL void sprof_setup(const sprof_desc_t* desc) {
+    SOKOL_ASSERT(desc);
+    SOKOL_ASSERT((desc->max_events >= 0) && (desc->max_threads >= 0));
+    _sprof_clear(&_sprof, sizeof(_sprof));
+    _sprof.desc = _sprof_desc_defaults(desc);
+    _sprof.ring_mask = (uint32_t)_sprof.desc.max_events - 1;
+    _sprof.threads = (_sprof_thread_t*) _sprof_malloc_clear((size_t)_sprof.desc.max_threads * sizeof(_sprof_thread_t));
+    _sprof.snapshot = (_sprof_event_t*) _sprof_malloc((size_t)_sprof.desc.max_events * sizeof(_sprof_event_t));
+    _sprof.start_ticks = stm_now();
+    if (++_sprof_generation == 0) {
+        _sprof_generation = 1;
+    }
+    _sprof_install_hooks();
+    _sprof.init_cookie = _SPROF_INIT_COOKIE;
+}
+
+SOKOL_API_IMPL void sprof_shutdown(void) {
+    SOKOL_ASSERT(_SPROF_INIT_COOKIE == _sprof.init_cookie);
+    _sprof.init_cookie = 0;
+    sg_install_trace_hooks(&_sprof.hooks);
+    uint32_t num_threads = _sprof_atomic_load(&_sprof.num_threads);
+    if (num_threads > (uint32_t)_sprof.desc.max_threads) {
+        num_threads = (uint32_t)_sprof.desc.max_threads;
+    }
+    for (uint32_t i = 0; i < num_threads; i++) {
+        if (_sprof.threads[i].events) {
+            _sprof_free(_sprof.threads[i].events);
+        }
+    }
+    _sprof_free(_sprof.threads);
+    _sprof_free(_sprof.snapshot);
+    _sprof_str_discard(&_sprof.json);
+}
+
+SOKOL_API_IMPL void sprof_begin(const char* name) {
+    _sprof_record(_SPROF_PHASE_BEGIN, _SPROF_CAT_USER, name);
+}
+
+SOKOL_API_IMPL void sprof_end(void) {
+    _sprof_record(_SPROF_PHASE_END, _SPROF_CAT_USER, 0);
+}
+
+SOKOL_API_IMPL void sprof_instant(const char* name) {
+    _sprof_record(_SPROF_PHASE_INSTANT, _SPROF_CAT_USER, name);
+}
+
+SOKOL_API_IMPL void sprof_set_thread_name(const char* name) {
+    _sprof_thread_t* thread = _sprof_thread();
+    if (thread) {
+        _sprof_copy_name(thread->name, name);
+    }
+}
+
+SOKOL_API_IMPL void sprof_clear(void) {
+    SOKOL_ASSERT(_SPROF_INIT_COOKIE == _sprof.init_cookie);
+    for (int i = 0; i < _sprof.desc.max_threads; i++) {
+        _sprof_thread_t* thread = &_sprof.threads[i];
+        if (_sprof_atomic_load(&thread->registered)) {
+            thread->clear_pos = _sprof_atomic_load(&thread->write_pos);
+        }
+    }
+}
+
+SOKOL_API_IMPL sprof_range sprof_dump_json(void) {
+    SOKOL_ASSERT(_SPROF_INIT_COOKIE == _sprof.init_cookie);
+    _sprof_str_t* str = &_sprof.json;
+    str->size = 0;
+    bool first = true;
+    _sprof_str_append(str, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+    for (int i = 0; i < _sprof.desc.max_threads; i++) {
+        _sprof_thread_t* thread = &_sprof.threads[i];
+        if (_sprof_atomic_load(&thread->registered)) {
+            _sprof_json_thread(str, (uint32_t)i + 1, thread, &first);
+        }
+    }
+    _sprof_str_append(str, "\n]}\n");
+    sprof_range res;
+    res.ptr = str->ptr;
+    res.size = str->size;
+    return res;
+}
+
+#if defined(SOKOL_APP_INCLUDED)
+SOKOL_API_IMPL sapp_desc sprof_wrap_sapp_desc(const sapp_desc* desc) {
+    SOKOL_ASSERT(desc);
+    _sprof_sapp.desc = *desc;
+    sapp_desc res = *desc;
+    if (desc->init_cb) {
+        res.init_cb = _sprof_sapp_init;
+    }
+    if (desc->frame_cb) {
+        res.frame_cb = _sprof_sapp_frame;
+    }
+    if (desc->cleanup_cb) {
+        res.cleanup_cb = _sprof_sapp_cleanup;
+    }
+    if (desc->init_userdata_cb) {
+        res.init_userdata_cb = _sprof_sapp_init_userdata;
+    }
+    if (desc->frame_userdata_cb) {
+        res.frame_userdata_cb = _sprof_sapp_frame_userdata;
+    }
+    if (desc->cleanup_userdata_cb) {
+        res.cleanup_userdata_cb = _sprof_sapp_cleanup_userdata;
+    }
+    return res;
+}
+#endif
+
+#endif /* SOKOL_PROFILER_IMPL */
@@ -0,0 +1,6 @@
+#if defined(IMPL)
+#define SOKOL_RENDER_GRAPH_IMPL
+#endif
+#include "sokol_defines.h"
+#include "sokol_gfx.h"
+#include "sokol_render_graph.h"
@@ -0,0 +1,1104 @@
+#if defined(SOKOL_IMPL) && !defined(SOKOL_RENDER_GRAPH_IMPL)
+#define SOKOL_RENDER_GRAPH_IMPL
+#endif
+#ifndef SOKOL_RENDER_GRAPH_INCLUDED
+/*
+    sokol_render_graph.h -- declare render passes per frame, with pooled transient render targets
+
+    Project URL: https://github.com/Ed94/SectrPrototype (Sectr fork of sokol-odin)
+
+    This header is an addition of the Sectr fork and is not part of the upstream
+    sokol headers (https://github.com/floooh/sokol), it follows their API conventions.
+
+    Do this:
+        #define SOKOL_IMPL or
+        #define SOKOL_RENDER_GRAPH_IMPL
+    before you include this file in *one* C or C++ file to create the
+    implementation.
+
+    Optionally provide the following defines with your own implementations:
+
+    SOKOL_ASSERT(c)             - your own assert macro (default: assert(c))
+    SOKOL_RENDER_GRAPH_API_DECL - public function declaration prefix (default: extern)
+    SOKOL_API_DECL              - same as SOKOL_RENDER_GRAPH_API_DECL
+    SOKOL_API_IMPL              - public function implementation prefix (default: -)
+
+    If sokol_render_graph.h is compiled as a DLL, define the following before
+    including the declaration or implementation:
+
+    SOKOL_DLL
+
+    On Windows, SOKOL_DLL will define SOKOL_RENDER_GRAPH_API_DECL as __declspec(dllexport)
+    or __declspec(dllimport) as needed.
+
+    Include the following headers before including sokol_render_graph.h:
+
+        sokol_gfx.h
+
+    FEATURES AND CONCEPTS
+    =====================
+    - each frame, declare the render passes of the frame together with
+      the textures each pass renders into and the textures it samples
+    - textures are either transient (declared per frame, the render graph
+      provides the actual sokol_gfx.h image), or imported (an existing
+      sg_image owned by the application)
+    - passes which don't contribute to the final frame are culled: a pass
+      is kept if it renders to the swapchain, renders into an imported
+      texture, is flagged as 'never_cull', or renders into a texture
+      which is later read by a pass that is kept
+    - the lifetime of each transient texture is computed (from the first
+      to the last kept pass using the texture), and transient textures
+      with non-overlapping lifetimes share the same sokol_gfx.h image
+      (as long as they have the same size, pixel format and sample count)
+    - the pooled images and the sg_attachments objects for the passes
+      are kept across frames and are only destroyed when they haven't been
+      used for a number of frames, so that a window resize doesn't require
+      any manual resource management
+
+    STEP BY STEP
+    ============
+    --- call srg_setup() after sg_setup():
+
+            sg_setup(&(sg_desc){ ... });
+            srg_setup(&(srg_desc_t){ .logger.func = slog_func });
+
+        The following srg_desc_t items can be provided to override
+        the default pool sizes:
+
+            .max_passes         - max number of declared passes per frame (default: 64)
+            .max_textures       - max number of declared textures per frame (default: 128)
+            .max_images         - max number of pooled images (default: 64)
+            .max_attachments    - max number of pooled sg_attachments objects (default: 64)
+            .max_unused_frames  - pooled resources which haven't been used for
+                                  this number of frames are destroyed (default: 8)
+
+    --- each frame, start declaring the render graph with:
+
+            srg_begin_frame();
+
+    --- declare transient textures (note that no sokol_gfx.h image is
+        created at this point):
+
+            srg_texture color = srg_make_texture(&(srg_texture_desc){
+                .width = w,
+                .height = h,
+                .label = "scene-color",
+            });
+            srg_texture depth = srg_make_texture(&(srg_texture_desc){
+                .width = w,
+                .height = h,
+                .pixel_format = SG_PIXELFORMAT_DEPTH,
+            });
+
+        The pixel format defaults to sg_desc.environment.defaults.color_format,
+        the sample count defaults to 1.
+
+    --- ...or import an existing image which has been created with
+        'usage.render_attachment = true' (for instance to keep rendering
+        results across frames):
+
+            srg_texture history = srg_import_image(state.history_img);
+
+    --- declare the passes of the frame in execution order, with the
+        textures each pass renders into and the textures it reads:
+
+            srg_add_pass(&(srg_pass_desc){
+                .action = { .colors[0] = { .load_action = SG_LOADACTION_CLEAR } },
+                .colors[0] = color,
+                .depth_stencil = depth,
+                .exec_cb = draw_scene,
+                .label = "scene",
+            });
+            srg_add_pass(&(srg_pass_desc){
+                .swapchain = sglue_swapchain(),
+                .reads[0] = color,
+                .exec_cb = draw_postfx,
+                .label = "postfx",
+            });
+
+        A render pass without any color- or depth-stencil-attachments
+        renders into the swapchain. A pass with '.compute = true' is a compute
+        pass, compute passes can read textures but not render into
+        them, and are never culled.
+
+        Between sg_begin_pass() and sg_end_pass() the render graph calls the
+        exec_cb callback with the pass handle and the user_data from
+        srg_pass_desc. In the callback, get the sokol_gfx.h image of
+        a texture to bind it as shader resource with:
+
+            sg_image img = srg_get_image(color);
+
+        The returned image is only valid during the callbacks of the
+        current frame, since the same image may be used for a different
+        transient texture by other passes or in the next frame.
+
+        All passes and textures are only valid until the next srg_begin_frame().
+
+    --- finally call:
+
+            srg_end_frame();
+
+        ...this culls unused passes, assigns pooled images to the transient
+        textures, and executes the remaining passes in the order they
+        have been declared. srg_end_frame() must be called outside
+        of a sokol_gfx.h pass and before sg_commit().
+
+    --- to inspect the result of the last srg_end_frame() call:
+
+            srg_frame_info info = srg_query_frame_info();
+
+        ...this includes the number of culled passes and the total size
+        of all transient textures compared to the size of the pooled
+        images which were actually used.
+
+    --- call srg_shutdown() before sg_shutdown(), this destroys all
+        pooled resources:
+
+            srg_shutdown();
+            sg_shutdown();
+
+    LIMITATIONS
+    ===========
+    - sokol_gfx.h doesn't expose GPU memory heaps, so transient textures
+      can only share an image when they have exactly the same size, pixel
+      format and sample count
+    - only 2D textures without mipmaps can be transient textures
+    - storage attachments in compute passes are not supported
+
+    ERROR REPORTING AND LOGGING
+    ===========================
+    To get any logging information at all you need to provide a logging callback in the setup call,
+    the easiest way is to use sokol_log.h:
+
+        #include "sokol_log.h"
+
+        srg_setup(&(srg_desc_t){
+            // ...
+            .logger.func = slog_func
+        });
+
+    MEMORY ALLOCATION OVERRIDE
+    ==========================
+    You can override the memory allocation functions at initialization time
+    like this:
+
+        void* my_alloc(size_t size, void* user_data) {
+            return malloc(size);
+        }
+
+        void my_free(void* ptr, void* user_data) {
+            free(ptr);
+        }
+
+        ...
+            srg_setup(&(srg_desc_t){
+                // ...
+                .allocator = {
+                    .alloc_fn = my_alloc,
+                    .free_fn = my_free,
+                    .user_data = ...;
+                }
+            });
+        ...
+
+    If no overrides are provided, malloc and free will be used.
+
+    LICENSE
+    =======
+    zlib/libpng license
+
+    Copyright (c) 2026 the Sectr fork contributors
+
+    This software is provided 'as-is', without any express or implied warranty.
+    In no event will the authors be held liable for any damages arising from the
+    use of this software.
+
+    Permission is granted to anyone to use this software for any purpose,
+    including commercial applications, and to alter it and redistribute it
+    freely, subject to the following restrictions:
+
+        1. The origin of this software must not be misrepresented; you must not
+        claim that you wrote the original software. If you use this software in a
+        product, an acknowledgment in the product documentation would be
+        appreciated but is not required.
+
+        2. Altered source versions must be plainly marked as such, and must not
+        be misrepresented as being the original software.
+
+        3. This notice may not be removed or altered from any source
+        distribution.
+*/
+#define SOKOL_RENDER_GRAPH_INCLUDED (1)
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h> // size_t
+
+#if !defined(SOKOL_GFX_INCLUDED)
+#error "Please include sokol_gfx.h before sokol_render_graph.h"
+#endif
+
+#if defined(SOKOL_API_DECL) && !defined(SOKOL_RENDER_GRAPH_API_DECL)
+#define SOKOL_RENDER_GRAPH_API_DECL SOKOL_API_DECL
+#endif
+#ifndef SOKOL_RENDER_GRAPH_API_DECL
+#if defined(_WIN32) && defined(SOKOL_DLL) && defined(SOKOL_RENDER_GRAPH_IMPL)
+#define SOKOL_RENDER_GRAPH_API_DECL __declspec(dllexport)
+#elif defined(_WIN32) && defined(SOKOL_DLL)
+#define SOKOL_RENDER_GRAPH_API_DECL __declspec(dllimport)
+#else
+#define SOKOL_RENDER_GRAPH_API_DECL extern
+#endif
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+enum {
+    SRG_MAX_PASS_READS = 16,
+};
+
+/*
+    srg_texture and srg_pass are per-frame handles, they are only
+    valid until the next call to srg_begin_frame()
+*/
+typedef struct srg_texture { uint32_t id; } srg_texture;
+typedef struct srg_pass { uint32_t id; } srg_pass;
+
+/*
+    srg_log_item_t
+
+    Log items are defined via X-Macros, and expanded to an
+    enum 'srg_log_item' - and in debug mode only - corresponding strings.
+
+    Used as parameter in the logging callback.
+*/
+#define _SRG_LOG_ITEMS \
+    _SRG_LOGITEM_XMACRO(OK, "Ok") \
+    _SRG_LOGITEM_XMACRO(MALLOC_FAILED, "memory allocation failed") \
+    _SRG_LOGITEM_XMACRO(PASSES_EXHAUSTED, "too many passes in frame (adjust via srg_desc_t.max_passes)") \
+    _SRG_LOGITEM_XMACRO(TEXTURES_EXHAUSTED, "too many textures in frame (adjust via srg_desc_t.max_textures)") \
+    _SRG_LOGITEM_XMACRO(IMAGE_POOL_EXHAUSTED, "image pool exhausted, pass skipped (adjust via srg_desc_t.max_images)") \
+    _SRG_LOGITEM_XMACRO(ATTACHMENTS_POOL_EXHAUSTED, "attachments pool exhausted, pass skipped (adjust via srg_desc_t.max_attachments)") \
+    _SRG_LOGITEM_XMACRO(MAKE_IMAGE_FAILED, "failed to create pooled image, pass skipped") \
+    _SRG_LOGITEM_XMACRO(MAKE_ATTACHMENTS_FAILED, "failed to create pooled attachments, pass skipped") \
+    _SRG_LOGITEM_XMACRO(TEXTURE_READ_BEFORE_WRITE, "transient texture is read before a pass renders into it, content is undefined") \
+
+#define _SRG_LOGITEM_XMACRO(item,msg) SRG_LOGITEM_##item,
+typedef enum srg_log_item_t {
+    _SRG_LOG_ITEMS
+} srg_log_item_t;
+#undef _SRG_LOGITEM_XMACRO
+
+/*
+    srg_logger_t
+
+    Used in srg_desc_t to provide a custom logging and error reporting
+    callback to sokol-render-graph.
+*/
+typedef struct srg_logger_t {
+    void (*func)(
+        const char* tag,                // always "srg"
+        uint32_t log_level,             // 0=panic, 1=error, 2=warning, 3=info
+        uint32_t log_item_id,           // SRG_LOGITEM_*
+        const char* message_or_null,    // a message string, may be nullptr in release mode
+        uint32_t line_nr,               // line number in sokol_render_graph.h
+        const char* filename_or_null,   // source filename, may be nullptr in release mode
+        void* user_data);
+    void* user_data;
+} srg_logger_t;
+
+/*
+    srg_allocator_t
+
+    Used in srg_desc_t to provide custom memory-alloc and -free functions
+    to sokol_render_graph.h. If memory management should be overridden, both
+    the alloc_fn and free_fn function must be provided (e.g. it's not valid
+    to override one function but not the other).
+*/
+typedef struct srg_allocator_t {
+    void* (*alloc_fn)(size_t size, void* user_data);
+    void (*free_fn)(void* ptr, void* user_data);
+    void* user_data;
+} srg_allocator_t;
+
+/*
+    srg_desc_t
+
+    Describes the render graph setup parameters, passed to srg_setup().
+*/
+typedef struct srg_desc_t {
+    int max_passes;                         // max number of passes per frame, default: 64
+    int max_textures;                       // max number of textures per frame, default: 128
+    int max_images;                         // max number of pooled images, default: 64
+    int max_attachments;                    // max number of pooled sg_attachments, default: 64
+    int max_unused_frames;                  // destroy pooled resources after this many unused frames, default: 8
+    srg_allocator_t allocator;              // optional memory allocation overrides (default: malloc/free)
+    srg_logger_t logger;                    // optional log override function (default: NO LOGGING)
+} srg_desc_t;
+
+/*
+    srg_texture_desc
+
+    Describes a transient texture, passed to srg_make_texture().
+*/
+typedef struct srg_texture_desc {
+    int width;
+    int height;
+    sg_pixel_format pixel_format;           // default: sg_desc.environment.defaults.color_format
+    int sample_count;                       // default: 1
+    const char* label;
+} srg_texture_desc;
+
+/*
+    srg_pass_desc
+
+    Describes a pass, passed to srg_add_pass(). A render pass without
+    color- and depth-stencil-attachments renders into the swapchain.
+*/
+typedef struct srg_pass_desc {
+    bool compute;
+    bool never_cull;
+    sg_pass_action action;
+    srg_texture colors[SG_MAX_COLOR_ATTACHMENTS];
+    srg_texture resolves[SG_MAX_COLOR_ATTACHMENTS];
+    srg_texture depth_stencil;
+    srg_texture reads[SRG_MAX_PASS_READS];
+    sg_swapchain swapchain;
+    void (*exec_cb)(srg_pass pass, void* user_data);
+    void* user_data;
+    const char* label;
+} srg_pass_desc;
+
+/*
+    srg_frame_info
+
+    Statistics of the last srg_end_frame() call, returned
+    by srg_query_frame_info().
+*/
+typedef struct srg_frame_info {
+    int num_passes;                         // number of declared passes
+    int num_culled_passes;                  // number of passes which have been culled
+    int num_transient_textures;             // number of transient textures used by the remaining passes
+    int num_used_images;                    // number of pooled images used by the remaining passes
+    int num_created_images;                 // number of pooled images which had to be created
+    int num_pooled_images;                  // number of pooled images (used or not)
+    uint64_t transient_bytes;               // total size of all used transient textures
+    uint64_t used_image_bytes;              // total size of all used pooled images
+} srg_frame_info;
+
+/* setup and shutdown */
+SOKOL_RENDER_GRAPH_API_DECL void srg_setup(const srg_desc_t* desc);
+SOKOL_RENDER_GRAPH_API_DECL void srg_shutdown(void);
+
+/* declare and execute a frame */
+SOKOL_RENDER_GRAPH_API_DECL void srg_begin_frame(void);
+SOKOL_RENDER_GRAPH_API_DECL srg_texture srg_make_texture(const srg_texture_desc* desc);
+SOKOL_RENDER_GRAPH_API_DECL srg_texture srg_import_image(sg_image img);
+SOKOL_RENDER_GRAPH_API_DECL srg_pass srg_add_pass(const srg_pass_desc* desc);
+SOKOL_RENDER_GRAPH_API_DECL void srg_end_frame(void);
+
+/* get the sokol_gfx.h image of a texture (only valid inside pass callbacks) */
+SOKOL_RENDER_GRAPH_API_DECL sg_image srg_get_image(srg_texture tex);
+
+/* statistics */
+SOKOL_RENDER_GRAPH_API_DECL srg_frame_info srg_query_frame_info(void);
+
+#ifdef __cplusplus
+} /* extern "C" */
+/* C++ const-ref wrappers */
+inline void srg_setup(const srg_desc_t& desc) { return srg_setup(&desc); }
+inline srg_texture srg_make_texture(const srg_texture_desc& desc) { return srg_make_texture(&desc); }
+inline srg_pass srg_add_pass(const srg_pass_desc& desc) { return srg_add_pass(&desc); }
+#endif
+#endif /* SOKOL_RENDER_GRAPH_INCLUDED */
+
+// ██ ███    ███ ██████  ██      ███████ ███    ███ ███████ ███    ██ ████████  █████  ████████ ██  ██████  ███    ██
+// ██ ████  ████ ██   ██ ██      ██      ████  ████ ██      ████   ██    ██    ██   ██    ██    ██ ██    ██ ████   ██
+// ██ ██ ████ ██ ██████  ██      █████   ██ ████ ██ █████   ██ ██  ██    ██    ███████    ██    ██ ██    ██ ██ ██  ██
+// ██ ██  ██  ██ ██      ██      ██      ██  ██  ██ ██      ██  ██ ██    ██    ██   ██    ██    ██ ██    ██ ██  ██ ██
+// ██ ██      ██ ██      ███████ ███████ ██      ██ ███████ ██   ████    ██    ██   ██    ██    ██  ██████  ██   ████
+//
+// >>implementation
+#ifdef SOKOL_RENDER_GRAPH_IMPL
+#define SOKOL_RENDER_GRAPH_IMPL_INCLUDED (1)
+
+#if defined(SOKOL_MALLOC) || defined(SOKOL_CALLOC) || defined(SOKOL_FREE)
+#error "SOKOL_MALLOC/CALLOC/FREE macros are no longer supported, please use srg_desc_t.allocator to override memory allocation functions"
+#endif
+
+#include <string.h> // memset, memcmp
+#include <stdlib.h> // malloc/free
+
+#ifndef SOKOL_API_IMPL
+    #define SOKOL_API_IMPL
+#endif
+#ifndef SOKOL_DEBUG
+    #ifndef NDEBUG
+        #define SOKOL_DEBUG
+    #endif
+#endif
+#ifndef SOKOL_ASSERT
+    #include <assert.h>
+    #define SOKOL_ASSERT(c) assert(c)
+#endif
+#ifndef _SOKOL_UNUSED
+    #define _SOKOL_UNUSED(x) (void)(x)
+#endif
+
+#define _srg_def(val, def) (((val) == 0) ? (def) : (val))
+#define _SRG_INIT_COOKIE (0xABCDBEEF)
+#define _SRG_DEFAULT_MAX_PASSES (64)
+#define _SRG_DEFAULT_MAX_TEXTURES (128)
+#define _SRG_DEFAULT_MAX_IMAGES (64)
+#define _SRG_DEFAULT_MAX_ATTACHMENTS (64)
+#define _SRG_DEFAULT_MAX_UNUSED_FRAMES (8)
+#define _SRG_MAX_PASS_TEXTURES (2 * SG_MAX_COLOR_ATTACHMENTS + 1 + SRG_MAX_PASS_READS)
+
+// handles contain the frame index in the upper 16 bits to catch
+// handles which are used after the frame they were created in
+#define _SRG_INDEX_MASK (0xFFFF)
+#define _SRG_FRAME_SHIFT (16)
+
+typedef struct {
+    srg_texture_desc desc;          // with defaults resolved
+    bool imported;
+    sg_image image;                 // imported image, or assigned pooled image
+    int pool_index;                 // index of assigned pooled image, or -1
+    int first_pass;                 // lifetime in kept passes
+    int last_pass;
+    bool needed;                    // used when culling passes
+} _srg_texture_t;
+
+typedef struct {
+    srg_pass_desc desc;
+    bool kept;
+} _srg_pass_t;
+
+typedef struct {
+    sg_image img;
+    srg_texture_desc desc;          // only size, pixel format and sample count
+    uint32_t last_used_frame;
+    bool in_use;
+} _srg_image_t;
+
+typedef struct {
+    sg_attachments atts;
+    sg_attachments_desc desc;       // zero-initialized, compared with memcmp
+    uint32_t last_used_frame;
+} _srg_attachments_t;
+
+typedef struct {
+    uint32_t init_cookie;
+    srg_desc_t desc;
+    uint32_t frame_index;
+    bool in_frame;
+    bool in_exec;
+    int num_passes;
+    int num_textures;
+    _srg_pass_t* passes;
+    _srg_texture_t* textures;
+    _srg_image_t* images;
+    _srg_attachments_t* attachments;
+    srg_frame_info frame_info;
+} _srg_t;
+static _srg_t _srg;
+
+// ██       ██████   ██████   ██████  ██ ███    ██  ██████
+// ██      ██    ██ ██       ██       ██ ████   ██ ██
+// ██      ██    ██ ██   ███ ██   ███ ██ ██ ██  ██ ██   ███
+// ██      ██    ██ ██    ██ ██    ██ ██ ██  ██ ██ ██    ██
+// ███████  ██████   ██████   ██████  ██ ██   ████  ██████
+//
+// >>logging
+#if defined(SOKOL_DEBUG)
+#define _SRG_LOGITEM_XMACRO(item,msg) #item ": " msg,
+static const char* _srg_log_messages[] = {
+    _SRG_LOG_ITEMS
+};
+#undef _SRG_LOGITEM_XMACRO
+#endif // SOKOL_DEBUG
+
+#define _SRG_PANIC(code) _srg_log(SRG_LOGITEM_ ##code, 0, __LINE__)
+#define _SRG_ERROR(code) _srg_log(SRG_LOGITEM_ ##code, 1, __LINE__)
+#define _SRG_WARN(code) _srg_log(SRG_LOGITEM_ ##code, 2, __LINE__)
+#define _SRG_INFO(code) _srg_log(SRG_LOGITEM_ ##code, 3, __LINE__)
+
+static void _srg_log(srg_log_item_t log_item, uint32_t log_level, uint32_t line_nr) {
+    if (_srg.desc.logger.func) {
+        #if defined(SOKOL_DEBUG)
+            const char* filename = __FILE__;
+            const char* message = _srg_log_messages[log_item];
+        #else
+            const char* filename = 0;
+            const char* message = 0;
+        #endif
+        _srg.desc.logger.func("srg", log_level, (uint32_t)log_item, message, line_nr, filename, _srg.desc.logger.user_data);
+    } else {
+        // for log level PANIC it would be 'undefined behaviour' to continue
+        if (log_level == 0) {
+            abort();
+        }
+    }
+}
+
+// ███    ███ ███████ ███    ███  ██████  ██████  ██    ██
+// ████  ████ ██      ████  ████ ██    ██ ██   ██  ██  ██
+// ██ ████ ██ █████   ██ ████ ██ ██    ██ ██████    ████
+// ██  ██  ██ ██      ██  ██  ██ ██    ██ ██   ██    ██
+// ██      ██ ███████ ██      ██  ██████  ██   ██    ██
+//
+// >>memory
+static void _srg_clear(void* ptr, size_t size) {
+    SOKOL_ASSERT(ptr && (size > 0));
+    memset(ptr, 0, size);
+}
+
+static void* _srg_malloc(size_t size) {
+    SOKOL_ASSERT(size > 0);
+    void* ptr;
+    if (_srg.desc.allocator.alloc_fn) {
+        ptr = _srg.desc.allocator.alloc_fn(size, _srg.desc.allocator.user_data);
+    } else {
+        ptr = malloc(size);
+    }
+    if (0 == ptr) {
+        _SRG_PANIC(MALLOC_FAILED);
+    }
+    return ptr;
+}
+
+static void* _srg_malloc_clear(size_t size) {
+    void* ptr = _srg_malloc(size);
+    _srg_clear(ptr, size);
+    return ptr;
+}
+
+static void _srg_free(void* ptr) {
+    if (_srg.desc.allocator.free_fn) {
+        _srg.desc.allocator.free_fn(ptr, _srg.desc.allocator.user_data);
+    } else {
+        free(ptr);
+    }
+}
+
+// ██████   ██████   ██████  ██
+// ██   ██ ██    ██ ██    ██ ██
+// ██████  ██    ██ ██    ██ ██
+// ██      ██    ██ ██    ██ ██
+// ██       ██████   ██████  ███████
+//
+// >>pool
+static uint64_t _srg_texture_bytes(const srg_texture_desc* desc) {
+    const sg_pixelformat_info fmt_info = sg_query_pixelformat(desc->pixel_format);
+    return (uint64_t)desc->width * (uint64_t)desc->height * (uint64_t)desc->sample_count * (uint64_t)fmt_info.bytes_per_pixel;
+}
+
+static bool _srg_image_matches(const _srg_image_t* img, const srg_texture_desc* desc) {
+    return (img->desc.width == desc->width)
+        && (img->desc.height == desc->height)
+        && (img->desc.pixel_format == desc->pixel_format)
+        && (img->desc.sample_count == desc->sample_count);
+}
+
+// returns the index of an unused pooled image matching the texture desc,
+// creates a new pooled image if necessary, returns -1 on error
+static int _srg_acquire_image(const srg_texture_desc* desc) {
+    int free_slot = -1;
+    for (int i = 0; i < _srg.desc.max_images; i++) {
+        _srg_image_t* img = &_srg.images[i];
+        if (img->img.id == SG_INVALID_ID) {
+            if (free_slot < 0) {
+                free_slot = i;
+            }
+        } else if (!img->in_use && _srg_image_matches(img, desc)) {
+            img->in_use = true;
+            img->last_used_frame = _srg.frame_index;
+            return i;
+        }
+    }
+    if (free_slot < 0) {
+        _SRG_ERROR(IMAGE_POOL_EXHAUSTED);
+        return -1;
+    }
+    sg_image_desc img_desc;
+    _srg_clear(&img_desc, sizeof(img_desc));
+    img_desc.usage.render_attachment = true;
+    img_desc.width = desc->width;
+    img_desc.height = desc->height;
+    img_desc.pixel_format = desc->pixel_format;
+    img_desc.sample_count = desc->sample_count;
+    img_desc.label = "srg-pooled-image";
+    sg_image sg_img = sg_make_image(&img_desc);
+    if (sg_query_image_state(sg_img) != SG_RESOURCESTATE_VALID) {
+        _SRG_ERROR(MAKE_IMAGE_FAILED);
+        sg_destroy_image(sg_img);
+        return -1;
+    }
+    _srg_image_t* img = &_srg.images[free_slot];
+    img->img = sg_img;
+    img->desc.width = desc->width;
+    img->desc.height = desc->height;
+    img->desc.pixel_format = desc->pixel_format;
+    img->desc.sample_count = desc->sample_count;
+    img->last_used_frame = _srg.frame_index;
+    img->in_use = true;
+    _srg.frame_info.num_created_images++;
+    return free_slot;
+}
+
+static bool _srg_attachments_use_image(const sg_attachments_desc* desc, uint32_t img_id) {
+    for (int i = 0; i < SG_MAX_COLOR_ATTACHMENTS; i++) {
+        if ((desc->colors[i].image.id == img_id) || (desc->resolves[i].image.id == img_id)) {
+            return true;
+        }
+    }
+    return desc->depth_stencil.image.id == img_id;
+}
+
+static void _srg_destroy_attachments(_srg_attachments_t* atts) {
+    sg_destroy_attachments(atts->atts);
+    _srg_clear(atts, sizeof(_srg_attachments_t));
+}
+
+// destroys a pooled image and all pooled attachments which use the image
+static void _srg_destroy_image(_srg_image_t* img) {
+    for (int i = 0; i < _srg.desc.max_attachments; i++) {
+        _srg_attachments_t* atts = &_srg.attachments[i];
+        if ((atts->atts.id != SG_INVALID_ID) && _srg_attachments_use_image(&atts->desc, img->img.id)) {
+            _srg_destroy_attachments(atts);
+        }
+    }
+    sg_destroy_image(img->img);
+    _srg_clear(img, sizeof(_srg_image_t));
+}
+
+// returns a pooled attachments object, or an invalid handle on error
+static sg_attachments _srg_acquire_attachments(const sg_attachments_desc* desc) {
+    int free_slot = -1;
+    for (int i = 0; i < _srg.desc.max_attachments; i++) {
+        _srg_attachments_t* atts = &_srg.attachments[i];
+        if (atts->atts.id == SG_INVALID_ID) {
+            if (free_slot < 0) {
+                free_slot = i;
+            }
+        } else if (0 == memcmp(&atts->desc, desc, sizeof(sg_attachments_desc))) {
+            atts->last_used_frame = _srg.frame_index;
+            return atts->atts;
+        }
+    }
+    sg_attachments res = { SG_INVALID_ID };
+    if (free_slot < 0) {
+        _SRG_ERROR(ATTACHMENTS_POOL_EXHAUSTED);
+        return res;
+    }
+    res = sg_make_attachments(desc);
+    if (sg_query_attachments_state(res) != SG_RESOURCESTATE_VALID) {
+        _SRG_ERROR(MAKE_ATTACHMENTS_FAILED);
+        sg_destroy_attachments(res);
+        res.id = SG_INVALID_ID;
+        return res;
+    }
+    _srg_attachments_t* atts = &_srg.attachments[free_slot];
+    atts->atts = res;
+    atts->desc = *desc;
+    atts->last_used_frame = _srg.frame_index;
+    return res;
+}
+
+static bool _srg_unused_too_long(uint32_t last_used_frame) {
+    return (_srg.frame_index - last_used_frame) > (uint32_t)_srg.desc.max_unused_frames;
+}
+
+static void _srg_collect_garbage(void) {
+    for (int i = 0; i < _srg.desc.max_attachments; i++) {
+        _srg_attachments_t* atts = &_srg.attachments[i];
+        if ((atts->atts.id != SG_INVALID_ID) && _srg_unused_too_long(atts->last_used_frame)) {
+            _srg_destroy_attachments(atts);
+        }
+    }
+    for (int i = 0; i < _srg.desc.max_images; i++) {
+        _srg_image_t* img = &_srg.images[i];
+        if ((img->img.id != SG_INVALID_ID) && _srg_unused_too_long(img->last_used_frame)) {
+            SOKOL_ASSERT(!img->in_use);
+            _srg_destroy_image(img);
+        }
+    }
+}
+
+//  ██████  ██████   █████  ██████  ██   ██
+// ██       ██   ██ ██   ██ ██   ██ ██   ██
+// ██   ███ ██████  ███████ ██████  ███████
+// ██    ██ ██   ██ ██   ██ ██      ██   ██
+//  ██████  ██   ██ ██   ██ ██      ██   ██
+//
+// >>graph
+static uint32_t _srg_make_id(int index) {
+    return ((_srg.frame_index & _SRG_INDEX_MASK) << _SRG_FRAME_SHIFT) | ((uint32_t)index + 1);
+}
+
+// returns the texture index of a handle, or -1 for the invalid handle
+static int _srg_texture_index(srg_texture tex) {
+    if (tex.id == SG_INVALID_ID) {
+        return -1;
+    }
+    SOKOL_ASSERT((tex.id >> _SRG_FRAME_SHIFT) == (_srg.frame_index & _SRG_INDEX_MASK));
+    const int index = (int)(tex.id & _SRG_INDEX_MASK) - 1;
+    SOKOL_ASSERT((index >= 0) && (index < _srg.num_textures));
+    return index;
+}
+
+static bool _srg_is_swapchain_pass(const srg_pass_desc* desc) {
+    if (desc->compute) {
+        return false;
+    }
+    for (int i = 0; i < SG_MAX_COLOR_ATTACHMENTS; i++) {
+        if (desc->colors[i].id != SG_INVALID_ID) {
+            return false;
+        }
+    }
+    return desc->depth_stencil.id == SG_INVALID_ID;
+}
+
+// collects the texture indices a pass renders into, and whether the
+// pass completely overwrites the texture content (no load action)
+static int _srg_pass_writes(const srg_pass_desc* desc, int* indices, bool* overwrites) {
+    int num = 0;
+    for (int i = 0; i < SG_MAX_COLOR_ATTACHMENTS; i++) {
+        const int color_index = _srg_texture_index(desc->colors[i]);
+        if (color_index >= 0) {
+            indices[num] = color_index;
+            overwrites[num++] = desc->action.colors[i].load_action != SG_LOADACTION_LOAD;
+        }
+        const int resolve_index = _srg_texture_index(desc->resolves[i]);
+        if (resolve_index >= 0) {
+            indices[num] = resolve_index;
+            overwrites[num++] = true;
+        }
+    }
+    const int ds_index = _srg_texture_index(desc->depth_stencil);
+    if (ds_index >= 0) {
+        indices[num] = ds_index;
+        overwrites[num++] = (desc->action.depth.load_action != SG_LOADACTION_LOAD)
+            && (desc->action.stencil.load_action != SG_LOADACTION_LOAD);
+    }
+    return num;
+}
+
+static int _srg_pass_reads(const srg_pass_desc* desc, int* indices) {
+    int num = 0;
+    for (int i = 0; i < SRG_MAX_PASS_READS; i++) {
+        const int index = _srg_texture_index(desc->reads[i]);
+        if (index >= 0) {
+            indices[num++] = index;
+        }
+    }
+    return num;
+}
+
+// walks the passes backward and keeps a pass if it has side effects, or
+// if it renders into a texture which is needed by a later kept pass
+static void _srg_cull_passes(void) {
+    int write_indices[_SRG_MAX_PASS_TEXTURES];
+    bool overwrites[_SRG_MAX_PASS_TEXTURES];
+    int read_indices[_SRG_MAX_PASS_TEXTURES];
+    for (int pass_index = _srg.num_passes - 1; pass_index >= 0; pass_index--) {
+        _srg_pass_t* pass = &_srg.passes[pass_index];
+        const int num_writes = _srg_pass_writes(&pass->desc, write_indices, overwrites);
+        bool keep = pass->desc.never_cull || pass->desc.compute || _srg_is_swapchain_pass(&pass->desc);
+        for (int i = 0; i < num_writes; i++) {
+            const _srg_texture_t* tex = &_srg.textures[write_indices[i]];
+            keep |= tex->imported || tex->needed;
+        }
+        pass->kept = keep;
+        if (!keep) {
+            _srg.frame_info.num_culled_passes++;
+            continue;
+        }
+        // textures which are overwritten by this pass are not needed by earlier passes
+        for (int i = 0; i < num_writes; i++) {
+            _srg.textures[write_indices[i]].needed = !overwrites[i];
+        }
+        const int num_reads = _srg_pass_reads(&pass->desc, read_indices);
+        for (int i = 0; i < num_reads; i++) {
+            _srg.textures[read_indices[i]].needed = true;
+        }
+    }
+    for (int i = 0; i < _srg.num_textures; i++) {
+        if (!_srg.textures[i].imported && _srg.textures[i].needed) {
+            _SRG_WARN(TEXTURE_READ_BEFORE_WRITE);
+        }
+    }
+}
+
+static void _srg_compute_lifetimes(void) {
+    int indices[_SRG_MAX_PASS_TEXTURES];
+    bool overwrites[_SRG_MAX_PASS_TEXTURES];
+    for (int pass_index = 0; pass_index < _srg.num_passes; pass_index++) {
+        const _srg_pass_t* pass = &_srg.passes[pass_index];
+        if (!pass->kept) {
+            continue;
+        }
+        int num = _srg_pass_writes(&pass->desc, indices, overwrites);
+        num += _srg_pass_reads(&pass->desc, &indices[num]);
+        for (int i = 0; i < num; i++) {
+            _srg_texture_t* tex = &_srg.textures[indices[i]];
+            if (tex->first_pass < 0) {
+                tex->first_pass = pass_index;
+            }
+            tex->last_pass = pass_index;
+        }
+    }
+    for (int i = 0; i < _srg.num_textures; i++) {
+        const _srg_texture_t* tex = &_srg.textures[i];
+        if (!tex->imported && (tex->first_pass >= 0)) {
+            _srg.frame_info.num_transient_textures++;
+            _srg.frame_info.transient_bytes += _srg_texture_bytes(&tex->desc);
+        }
+    }
+}
+
+// assigns pooled images to the transient textures which start their
+// lifetime in this pass, returns false if this failed
+static bool _srg_acquire_pass_images(int pass_index) {
+    bool res = true;
+    for (int i = 0; i < _srg.num_textures; i++) {
+        _srg_texture_t* tex = &_srg.textures[i];
+        if (!tex->imported && (tex->first_pass == pass_index)) {
+            tex->pool_index = _srg_acquire_image(&tex->desc);
+            if (tex->pool_index >= 0) {
+                tex->image = _srg.images[tex->pool_index].img;
+            } else {
+                res = false;
+            }
+        }
+    }
+    return res;
+}
+
+// returns the pooled images of transient textures which end their
+// lifetime in this pass, so that later passes can reuse them
+static void _srg_release_pass_images(int pass_index) {
+    for (int i = 0; i < _srg.num_textures; i++) {
+        _srg_texture_t* tex = &_srg.textures[i];
+        if (!tex->imported && (tex->last_pass == pass_index) && (tex->pool_index >= 0)) {
+            _srg.images[tex->pool_index].in_use = false;
+        }
+    }
+}
+
+static bool _srg_pass_images_valid(const srg_pass_desc* desc) {
+    int indices[_SRG_MAX_PASS_TEXTURES];
+    bool overwrites[_SRG_MAX_PASS_TEXTURES];
+    int num = _srg_pass_writes(desc, indices, overwrites);
+    num += _srg_pass_reads(desc, &indices[num]);
+    for (int i = 0; i < num; i++) {
+        if (_srg.textures[indices[i]].image.id == SG_INVALID_ID) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static sg_image _srg_image(srg_texture tex) {
+    const int index = _srg_texture_index(tex);
+    sg_image res = { SG_INVALID_ID };
+    if (index >= 0) {
+        res = _srg.textures[index].image;
+    }
+    return res;
+}
+
+static void _srg_exec_pass(int pass_index) {
+    const srg_pass_desc* desc = &_srg.passes[pass_index].desc;
+    sg_pass pass;
+    _srg_clear(&pass, sizeof(pass));
+    pass.compute = desc->compute;
+    pass.action = desc->action;
+    pass.label = desc->label;
+    if (!desc->compute) {
+        if (_srg_is_swapchain_pass(desc)) {
+            pass.swapchain = desc->swapchain;
+        } else {
+            // NOTE: memcmp is used on the desc to find pooled attachments
+            sg_attachments_desc atts_desc;
+            _srg_clear(&atts_desc, sizeof(atts_desc));
+            for (int i = 0; i < SG_MAX_COLOR_ATTACHMENTS; i++) {
+                atts_desc.colors[i].image = _srg_image(desc->colors[i]);
+                atts_desc.resolves[i].image = _srg_image(desc->resolves[i]);
+            }
+            atts_desc.depth_stencil.image = _srg_image(desc->depth_stencil);
+            atts_desc.label = "srg-pooled-attachments";
+            pass.attachments = _srg_acquire_attachments(&atts_desc);
+            if (pass.attachments.id == SG_INVALID_ID) {
+                return;
+            }
+        }
+    }
+    srg_pass pass_id = { _srg_make_id(pass_index) };
+    sg_begin_pass(&pass);
+    if (desc->exec_cb) {
+        _srg.in_exec = true;
+        desc->exec_cb(pass_id, desc->user_data);
+        _srg.in_exec = false;
+    }
+    sg_end_pass();
+}
+
+// ██████  ██    ██ ██████  ██      ██  ██████
+// ██   ██ ██    ██ ██   ██ ██      ██ ██
+// ██████  ██    ██ ██████  ██      ██ ██
+// ██      ██    ██ ██   ██ ██      ██ ██
+// ██       ██████  ██████  ███████ ██  ██████
+//
+// >>public
+static srg_desc_t _srg_desc_defaults(const srg_desc_t* desc) {
+    SOKOL_ASSERT((desc->allocator.alloc_fn && desc->allocator.free_fn) || (!desc->allocator.alloc_fn && !desc->allocator.free_fn));
+    srg_desc_t res = *desc;
+    res.max_passes = _srg_def(res.max_passes, _SRG_DEFAULT_MAX_PASSES);
+    res.max_textures = _srg_def(res.max_textures, _SRG_DEFAULT_MAX_TEXTURES);
+    res.max_images = _srg_def(res.max_images, _SRG_DEFAULT_MAX_IMAGES);
+    res.max_attachments = _srg_def(res.max_attachments, _SRG_DEFAULT_MAX_ATTACHMENTS);
+    res.max_unused_frames = _srg_def(res.max_unused_frames, _SRG_DEFAULT_MAX_UNUSED_FRAMES);
+    return res;
+}
+
+SOKOL_API_IMPL void srg_setup(const srg_desc_t* desc) {
+    SOKOL_ASSERT(desc);
+    _srg_clear(&_srg, sizeof(_srg));
+    _srg.init_cookie = _SRG_INIT_COOKIE;
+    _srg.desc = _srg_desc_defaults(desc);
+    SOKOL_ASSERT((_srg.desc.max_passes > 0) && (_srg.desc.max_passes < _SRG_INDEX_MASK));
+    SOKOL_ASSERT((_srg.desc.max_textures > 0) && (_srg.desc.max_textures < _SRG_INDEX_MASK));
+    _srg.passes = (_srg_pass_t*) _srg_malloc_clear((size_t)_srg.desc.max_passes * sizeof(_srg_pass_t));
+    _srg.textures = (_srg_texture_t*) _srg_malloc_clear((size_t)_srg.desc.max_textures * sizeof(_srg_texture_t));
+    _srg.images = (_srg_image_t*) _srg_malloc_clear((size_t)_srg.desc.max_images * sizeof(_srg_image_t));
+    _srg.attachments = (_srg_attachments_t*) _srg_malloc_clear((size_t)_srg.desc.max_attachments * sizeof(_srg_attachments_t));
+}
+
+SOKOL_API_IMPL void srg_shutdown(void) {
+    SOKOL_ASSERT(_SRG_INIT_COOKIE == _srg.init_cookie);
+    SOKOL_ASSERT(!_srg.in_frame);
+    for (int i = 0; i < _srg.desc.max_images; i++) {
+        if (_srg.images[i].img.id != SG_INVALID_ID) {
+            _srg_destroy_image(&_srg.images[i]);
+        }
+    }
+    _srg_free(_srg.attachments);
+    _srg_free(_srg.images);
+    _srg_free(_srg.textures);
+    _srg_free(_srg.passes);
+    _srg.init_cookie = 0;
+}
+
+SOKOL_API_IMPL void srg_begin_frame(void) {
+    SOKOL_ASSERT(_SRG_INIT_COOKIE == _srg.init_cookie);
+    SOKOL_ASSERT(!_srg.in_frame);
+    _srg.in_frame = true;
+    _srg.frame_index++;
+    _srg.num_passes = 0;
+    _srg.num_textures = 0;
+}
+
+static srg_texture _srg_add_texture(void) {
+    srg_texture res = { SG_INVALID_ID };
+    if (_srg.num_textures >= _srg.desc.max_textures) {
+        _SRG_ERROR(TEXTURES_EXHAUSTED);
+        return res;
+    }
+    const int index = _srg.num_textures++;
+    _srg_texture_t* tex = &_srg.textures[index];
+    _srg_clear(tex, sizeof(_srg_texture_t));
+    tex->pool_index = -1;
+    tex->first_pass = -1;
+    tex->last_pass = -1;
+    res.id = _srg_make_id(index);
+    return res;
+}
+
+SOKOL_API_IMPL srg_texture srg_make_texture(const srg_texture_desc* desc) {
+    SOKOL_ASSERT(_SRG_INIT_COOKIE == _srg.init_cookie);
+    SOKOL_ASSERT(_srg.in_frame && desc);
+    SOKOL_ASSERT((desc->width > 0) && (desc->height > 0));
+    const srg_texture res = _srg_add_texture();
+    if (res.id != SG_INVALID_ID) {
+        _srg_texture_t* tex = &_srg.textures[_srg_texture_index(res)];
+        tex->desc = *desc;
+        tex->desc.pixel_format = _srg_def(desc->pixel_format, sg_query_desc().environment.defaults.color_format);
+        tex->desc.sample_count = _srg_def(desc->sample_count, 1);
+    }
+    return res;
+}
+
+SOKOL_API_IMPL srg_texture srg_import_image(sg_image img) {
+    SOKOL_ASSERT(_SRG_INIT_COOKIE == _srg.init_cookie);
+    SOKOL_ASSERT(_srg.in_frame);
+    SOKOL_ASSERT(img.id != SG_INVALID_ID);
+    const srg_texture res = _srg_add_texture();
+    if (res.id != SG_INVALID_ID) {
+        _srg_texture_t* tex = &_srg.textures[_srg_texture_index(res)];
+        tex->imported = true;
+        tex->image = img;
+    }
+    return res;
+}
+
+SOKOL_API_IMPL srg_pass srg_add_pass(const srg_pass_desc* desc) {
+    SOKOL_ASSERT(_SRG_INIT_COOKIE == _srg.init_cookie);
+    SOKOL_ASSERT(_srg.in_frame && desc);
+    srg_pass res = { SG_INVALID_ID };
+    if (_srg.num_passes >= _srg.desc.max_passes) {
+        _SRG_ERROR(PASSES_EXHAUSTED);
+        return res;
+    }
+    const int index = _srg.num_passes++;
+    _srg_pass_t* pass = &_srg.passes[index];
+    pass->desc = *desc;
+    pass->kept = false;
+    res.id = _srg_make_id(index);
+    return res;
+}
+
+SOKOL_API_IMPL void srg_end_frame(void) {
+    SOKOL_ASSERT(_SRG_INIT_COOKIE == _srg.init_cookie);
+    SOKOL_ASSERT(_srg.in_frame);
+    _srg_clear(&_srg.frame_info, sizeof(_srg.frame_info));
+    _srg.frame_info.num_passes = _srg.num_passes;
+    _srg_cull_passes();
+    _srg_compute_lifetimes();
+    for (int pass_index = 0; pass_index < _srg.num_passes; pass_index++) {
+        if (!_srg.passes[pass_index].kept) {
+            continue;
+        }
+        if (_srg_acquire_pass_images(pass_index) && _srg_pass_images_valid(&_srg.passes[pass_index].desc)) {
+            _srg_exec_pass(pass_index);
+        }
+        _srg_release_pass_images(pass_index);
+    }
+    for (int i = 0; i < _srg.desc.max_images; i++) {
+        const _srg_image_t* img = &_srg.images[i];
+        if (img->img.id != SG_INVALID_ID) {
+            SOKOL_ASSERT(!img->in_use);
+            _srg.frame_info.num_pooled_images++;
+            if (img->last_used_frame == _srg.frame_index) {
+                _srg.frame_info.num_used_images++;
+                _srg.frame_info.used_image_bytes += _srg_texture_bytes(&img->desc);
+            }
+        }
+    }
+    _srg_collect_garbage();
+    _srg.in_frame = false;
+}
+
+SOKOL_API_IMPL sg_image srg_get_image(srg_texture tex) {
+    SOKOL_ASSERT(_SRG_INIT_COOKIE == _srg.init_cookie);
+    SOKOL_ASSERT(_srg.in_exec);
+    return _srg_image(tex);
+}
+
+SOKOL_API_IMPL srg_frame_info srg_query_frame_info(void) {
+    SOKOL_ASSERT(_SRG_INIT_COOKIE == _srg.init_cookie);
+    return _srg.frame_info;
+}
+
+#endif /* SOKOL_RENDER_GRAPH_IMPL */
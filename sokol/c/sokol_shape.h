@@ -332,6 +332,64 @@
     sg_draw(green_cube.base_element, green_cube.num_elements, 1);
     ```
 
+    BUILDING SHAPES ON MULTIPLE THREADS
+    ===================================
+    When building a lot of shapes (or very big shapes) at load time, the
+    work can be distributed across your own worker threads (sokol_shape.h
+    doesn't create any threads itself). This happens in two steps:
+
+    First, on a single thread, reserve space for all shapes in the vertex-
+    and index-buffers. The reserve functions do the same validation and
+    bookkeeping as the build functions, but don't generate any data. Keep
+    the buffer state *before* each reserve call around, together with the
+    shape parameters:
+
+    ```c
+    typedef struct { sshape_buffer_t buf; sshape_sphere_t params; } job_t;
+    job_t jobs[NUM_SHAPES];
+
+    sshape_buffer_t buf = { ... };
+    for (int i = 0; i < NUM_SHAPES; i++) {
+        jobs[i].buf = buf;
+        jobs[i].params = (sshape_sphere_t){ ... };
+        buf = sshape_reserve_sphere(&buf, &jobs[i].params);
+        sshape_element_range_t elms = sshape_element_range(&buf);   // optional
+    }
+    assert(buf.valid);
+    ```
+
+    Then, on any thread, generate the shape data:
+
+    ```c
+    sshape_build_sphere_part(&jobs[i].buf, &jobs[i].params, part, num_parts);
+    ```
+
+    Each shape is split into 'num_parts' parts (for instance one per worker
+    thread) along its stacks, sides or tile rows, and each part writes
+    into a separate region of the vertex- and index-buffers, so that
+    different parts of the same shape and different shapes can be built
+    concurrently without any synchronization. Use part = 0 and num_parts = 1
+    to build a complete shape on one thread. The result is identical to
+    calling the regular build function, including random colors (the
+    random color sequence is restarted from a hash of the row index at
+    each vertex row, so no part depends on the rows before it).
+
+    The following functions are available:
+
+    ```c
+    sshape_buffer_t sshape_reserve_plane(const sshape_buffer_t* buf, const sshape_plane_t* params);
+    sshape_buffer_t sshape_reserve_box(const sshape_buffer_t* buf, const sshape_box_t* params);
+    sshape_buffer_t sshape_reserve_sphere(const sshape_buffer_t* buf, const sshape_sphere_t* params);
+    sshape_buffer_t sshape_reserve_cylinder(const sshape_buffer_t* buf, const sshape_cylinder_t* params);
+    sshape_buffer_t sshape_reserve_torus(const sshape_buffer_t* buf, const sshape_torus_t* params);
+
+    void sshape_build_plane_part(const sshape_buffer_t* buf, const sshape_plane_t* params, uint32_t part, uint32_t num_parts);
+    void sshape_build_box_part(const sshape_buffer_t* buf, const sshape_box_t* params, uint32_t part, uint32_t num_parts);
+    void sshape_build_sphere_part(const sshape_buffer_t* buf, const sshape_sphere_t* params, uint32_t part, uint32_t num_parts);
+    void sshape_build_cylinder_part(const sshape_buffer_t* buf, const sshape_cylinder_t* params, uint32_t part, uint32_t num_parts);
+    void sshape_build_torus_part(const sshape_buffer_t* buf, const sshape_torus_t* params, uint32_t part, uint32_t num_parts);
+    ```
+
     ...that's about all :)
 
     LICENSE
@@ -505,6 +563,20 @@ SOKOL_SHAPE_API_DECL sshape_buffer_t sshape_build_sphere(const sshape_buffer_t*
 SOKOL_SHAPE_API_DECL sshape_buffer_t sshape_build_cylinder(const sshape_buffer_t* buf, const sshape_cylinder_t* params);
 SOKOL_SHAPE_API_DECL sshape_buffer_t sshape_build_torus(const sshape_buffer_t* buf, const sshape_torus_t* params);
 
+/* reserve buffer space for a shape without generating any data (for building shapes in parts on multiple threads) */
+SOKOL_SHAPE_API_DECL sshape_buffer_t sshape_reserve_plane(const sshape_buffer_t* buf, const sshape_plane_t* params);
+SOKOL_SHAPE_API_DECL sshape_buffer_t sshape_reserve_box(const sshape_buffer_t* buf, const sshape_box_t* params);
+SOKOL_SHAPE_API_DECL sshape_buffer_t sshape_reserve_sphere(const sshape_buffer_t* buf, const sshape_sphere_t* params);
+SOKOL_SHAPE_API_DECL sshape_buffer_t sshape_reserve_cylinder(const sshape_buffer_t* buf, const sshape_cylinder_t* params);
+SOKOL_SHAPE_API_DECL sshape_buffer_t sshape_reserve_torus(const sshape_buffer_t* buf, const sshape_torus_t* params);
+
+/* generate one of 'num_parts' parts of a reserved shape, 'buf' is the buffer state passed into the reserve function */
+SOKOL_SHAPE_API_DECL void sshape_build_plane_part(const sshape_buffer_t* buf, const sshape_plane_t* params, uint32_t part, uint32_t num_parts);
+SOKOL_SHAPE_API_DECL void sshape_build_box_part(const sshape_buffer_t* buf, const sshape_box_t* params, uint32_t part, uint32_t num_parts);
+SOKOL_SHAPE_API_DECL void sshape_build_sphere_part(const sshape_buffer_t* buf, const sshape_sphere_t* params, uint32_t part, uint32_t num_parts);
+SOKOL_SHAPE_API_DECL void sshape_build_cylinder_part(const sshape_buffer_t* buf, const sshape_cylinder_t* params, uint32_t part, uint32_t num_parts);
+SOKOL_SHAPE_API_DECL void sshape_build_torus_part(const sshape_buffer_t* buf, const sshape_torus_t* params, uint32_t part, uint32_t num_parts);
+
 /* query required vertex- and index-buffer sizes in bytes */
 SOKOL_SHAPE_API_DECL sshape_sizes_t sshape_plane_sizes(uint32_t tiles);
 SOKOL_SHAPE_API_DECL sshape_sizes_t sshape_box_sizes(uint32_t tiles);
@@ -777,11 +849,7 @@ static sshape_torus_t _sshape_torus_defaults(const sshape_torus_t* params) {
     return res;
 }
 
-static void _sshape_add_vertex(sshape_buffer_t* buf, _sshape_vec4_t pos, _sshape_vec4_t norm, _sshape_vec2_t uv, uint32_t color) {
-    size_t offset = buf->vertices.data_size;
-    SOKOL_ASSERT((offset + sizeof(sshape_vertex_t)) <= buf->vertices.buffer.size);
-    buf->vertices.data_size += sizeof(sshape_vertex_t);
-    sshape_vertex_t* v_ptr = (sshape_vertex_t*) ((uint8_t*)buf->vertices.buffer.ptr + offset);
+static sshape_vertex_t* _sshape_write_vertex(sshape_vertex_t* v_ptr, _sshape_vec4_t pos, _sshape_vec4_t norm, _sshape_vec2_t uv, uint32_t color) {
     v_ptr->x = pos.x;
     v_ptr->y = pos.y;
     v_ptr->z = pos.z;
@@ -789,16 +857,14 @@ static void _sshape_add_vertex(sshape_buffer_t* buf, _sshape_vec4_t pos, _sshape
     v_ptr->u = _sshape_pack_f_ushortn(uv.x);
     v_ptr->v = _sshape_pack_f_ushortn(uv.y);
     v_ptr->color = color;
+    return v_ptr + 1;
 }
 
-static void _sshape_add_triangle(sshape_buffer_t* buf, uint16_t i0, uint16_t i1, uint16_t i2) {
-    size_t offset = buf->indices.data_size;
-    SOKOL_ASSERT((offset + 3*sizeof(uint16_t)) <= buf->indices.buffer.size);
-    buf->indices.data_size += 3*sizeof(uint16_t);
-    uint16_t* i_ptr = (uint16_t*) ((uint8_t*)buf->indices.buffer.ptr + offset);
+static uint16_t* _sshape_write_triangle(uint16_t* i_ptr, uint16_t i0, uint16_t i1, uint16_t i2) {
     i_ptr[0] = i0;
     i_ptr[1] = i1;
     i_ptr[2] = i2;
+    return i_ptr + 3;
 }
 
 static uint32_t _sshape_rand_color(uint32_t* xorshift_state) {
@@ -815,6 +881,96 @@ static uint32_t _sshape_rand_color(uint32_t* xorshift_state) {
 
 }
 
+// random color state at the start of a vertex row, hashed from the row index so
+// that a shape built in parts gets the same colors without skipping ahead
+static uint32_t _sshape_rand_seed(uint32_t row) {
+    // lowbias32 integer hash
+    uint32_t x = row + 0x12345678;
+    x ^= x>>16;
+    x *= 0x7feb352d;
+    x ^= x>>15;
+    x *= 0x846ca68b;
+    x ^= x>>16;
+    // xorshift32 state must not be zero
+    return x ? x : 0x12345678;
+}
+
+// reserve space for a new shape and return the updated buffer state
+static sshape_buffer_t _sshape_reserve(const sshape_buffer_t* in_buf, uint32_t num_vertices, uint32_t num_indices, bool merge) {
+    sshape_buffer_t buf = *in_buf;
+    if (!_sshape_validate_buffer(&buf, num_vertices, num_indices)) {
+        buf.valid = false;
+        return buf;
+    }
+    buf.valid = true;
+    if (!merge) {
+        _sshape_advance_offset(&buf.vertices);
+        _sshape_advance_offset(&buf.indices);
+    }
+    buf.vertices.data_size += num_vertices * sizeof(sshape_vertex_t);
+    buf.indices.data_size += num_indices * sizeof(uint16_t);
+    return buf;
+}
+
+// write destination of a shape, taken from the buffer state *before* the shape was reserved
+typedef struct {
+    sshape_vertex_t* vertices;
+    uint16_t* indices;
+    uint16_t start_index;
+} _sshape_dst_t;
+
+static _sshape_dst_t _sshape_dst(const sshape_buffer_t* buf) {
+    _sshape_dst_t dst;
+    dst.vertices = (sshape_vertex_t*) ((uint8_t*)buf->vertices.buffer.ptr + buf->vertices.data_size);
+    dst.indices = (uint16_t*) ((uint8_t*)buf->indices.buffer.ptr + buf->indices.data_size);
+    dst.start_index = _sshape_base_index(buf);
+    return dst;
+}
+
+// split 'num_rows' vertex- or index-rows evenly into 'num_parts' and return the row range of 'part'
+static void _sshape_part_rows(uint32_t num_rows, uint32_t part, uint32_t num_parts, uint32_t* out_first, uint32_t* out_end) {
+    SOKOL_ASSERT((num_parts > 0) && (part < num_parts));
+    *out_first = (uint32_t) (((uint64_t)num_rows * part) / num_parts);
+    *out_end = (uint32_t) (((uint64_t)num_rows * (part + 1)) / num_parts);
+}
+
+/*
+    sin/cos lookup table for 'num + 1' equally spaced angles, this is
+    computed once per shape (or shape part) instead of per vertex, for
+    very high tessellations which don't fit into the table, sinf/cosf
+    is called directly
+*/
+#define _SSHAPE_SINCOS_TABLE_SIZE (1024)
+typedef struct { float s, c; } _sshape_sincos_t;
+typedef struct {
+    uint32_t num;
+    float range;
+    _sshape_sincos_t items[_SSHAPE_SINCOS_TABLE_SIZE];
+} _sshape_sincos_table_t;
+
+static void _sshape_init_sincos_table(_sshape_sincos_table_t* table, uint32_t num, float range) {
+    table->num = num;
+    table->range = range;
+    if (num < _SSHAPE_SINCOS_TABLE_SIZE) {
+        for (uint32_t i = 0; i <= num; i++) {
+            const float angle = (range * i) / num;
+            table->items[i].s = sinf(angle);
+            table->items[i].c = cosf(angle);
+        }
+    }
+}
+
+static inline _sshape_sincos_t _sshape_sincos(const _sshape_sincos_table_t* table, uint32_t i) {
+    SOKOL_ASSERT(i <= table->num);
+    if (table->num < _SSHAPE_SINCOS_TABLE_SIZE) {
+        return table->items[i];
+    } else {
+        const float angle = (table->range * i) / table->num;
+        _sshape_sincos_t res = { sinf(angle), cosf(angle) };
+        return res;
+    }
+}
+
 /*=== PUBLIC API FUNCTIONS ===================================================*/
 SOKOL_API_IMPL uint32_t sshape_color_4f(float r, float g, float b, float a) {
     return _sshape_pack_f4_ubyte4n(_sshape_clamp(r), _sshape_clamp(g), _sshape_clamp(b), _sshape_clamp(a));
@@ -913,153 +1069,131 @@ SOKOL_API_IMPL sshape_sizes_t sshape_torus_sizes(uint32_t sides, uint32_t rings)
     |\ |\ |\ |\ |
     | \| \| \| \|
     +--+--+--+--+
+
+    Vertex rows are split along x, index rows along z.
 */
-SOKOL_API_IMPL sshape_buffer_t sshape_build_plane(const sshape_buffer_t* in_buf, const sshape_plane_t* in_params) {
-    SOKOL_ASSERT(in_buf && in_params);
-    const sshape_plane_t params = _sshape_plane_defaults(in_params);
-    const uint32_t num_vertices = _sshape_plane_num_vertices(params.tiles);
-    const uint32_t num_indices = _sshape_plane_num_indices(params.tiles);
-    sshape_buffer_t buf = *in_buf;
-    if (!_sshape_validate_buffer(&buf, num_vertices, num_indices)) {
-        buf.valid = false;
-        return buf;
-    }
-    buf.valid = true;
-    const uint16_t start_index = _sshape_base_index(&buf);
-    if (!params.merge) {
-        _sshape_advance_offset(&buf.vertices);
-        _sshape_advance_offset(&buf.indices);
-    }
+static void _sshape_build_plane_part(const sshape_buffer_t* buf, const sshape_plane_t* params, uint32_t part, uint32_t num_parts) {
+    const _sshape_dst_t dst = _sshape_dst(buf);
+    const uint32_t row_len = params->tiles + 1;
+    uint32_t first, end;
 
     // write vertices
-    uint32_t rand_seed = 0x12345678;
-    const float x0 = -params.width * 0.5f;
-    const float z0 =  params.depth * 0.5f;
-    const float dx =  params.width / params.tiles;
-    const float dz = -params.depth / params.tiles;
-    const float duv = 1.0f / params.tiles;
-    _sshape_vec4_t tnorm = _sshape_vec4_norm(_sshape_mat4_mul(&params.transform, _sshape_vec4(0.0f, 1.0f, 0.0f, 0.0f)));
-    for (uint32_t ix = 0; ix <= params.tiles; ix++) {
-        for (uint32_t iz = 0; iz <= params.tiles; iz++) {
+    _sshape_part_rows(params->tiles + 1, part, num_parts, &first, &end);
+    uint32_t rand_seed = 0;
+    sshape_vertex_t* v_ptr = dst.vertices + first * row_len;
+    const float x0 = -params->width * 0.5f;
+    const float z0 =  params->depth * 0.5f;
+    const float dx =  params->width / params->tiles;
+    const float dz = -params->depth / params->tiles;
+    const float duv = 1.0f / params->tiles;
+    _sshape_vec4_t tnorm = _sshape_vec4_norm(_sshape_mat4_mul(&params->transform, _sshape_vec4(0.0f, 1.0f, 0.0f, 0.0f)));
+    for (uint32_t ix = first; ix < end; ix++) {
+        if (params->random_colors) {
+            rand_seed = _sshape_rand_seed(ix);
+        }
+        for (uint32_t iz = 0; iz <= params->tiles; iz++) {
             const _sshape_vec4_t pos = _sshape_vec4(x0 + dx*ix, 0.0f, z0 + dz*iz, 1.0f);
-            const _sshape_vec4_t tpos = _sshape_mat4_mul(&params.transform, pos);
+            const _sshape_vec4_t tpos = _sshape_mat4_mul(&params->transform, pos);
             const _sshape_vec2_t uv = _sshape_vec2(duv*ix, duv*iz);
-            const uint32_t color = params.random_colors ? _sshape_rand_color(&rand_seed) : params.color;
-            _sshape_add_vertex(&buf, tpos, tnorm, uv, color);
+            const uint32_t color = params->random_colors ? _sshape_rand_color(&rand_seed) : params->color;
+            v_ptr = _sshape_write_vertex(v_ptr, tpos, tnorm, uv, color);
         }
     }
 
     // write indices
-    for (uint16_t j = 0; j < params.tiles; j++) {
-        for (uint16_t i = 0; i < params.tiles; i++) {
-            const uint16_t i0 = start_index + (j * (params.tiles + 1)) + i;
+    _sshape_part_rows(params->tiles, part, num_parts, &first, &end);
+    uint16_t* i_ptr = dst.indices + first * params->tiles * 6;
+    for (uint32_t j = first; j < end; j++) {
+        for (uint16_t i = 0; i < params->tiles; i++) {
+            const uint16_t i0 = dst.start_index + (j * (params->tiles + 1)) + i;
             const uint16_t i1 = i0 + 1;
-            const uint16_t i2 = i0 + params.tiles + 1;
+            const uint16_t i2 = i0 + params->tiles + 1;
             const uint16_t i3 = i2 + 1;
-            _sshape_add_triangle(&buf, i0, i1, i3);
-            _sshape_add_triangle(&buf, i0, i3, i2);
+            i_ptr = _sshape_write_triangle(i_ptr, i0, i1, i3);
+            i_ptr = _sshape_write_triangle(i_ptr, i0, i3, i2);
         }
     }
-    return buf;
 }
 
-SOKOL_API_IMPL sshape_buffer_t sshape_build_box(const sshape_buffer_t* in_buf, const sshape_box_t* in_params) {
-    SOKOL_ASSERT(in_buf && in_params);
-    const sshape_box_t params = _sshape_box_defaults(in_params);
-    const uint32_t num_vertices = _sshape_box_num_vertices(params.tiles);
-    const uint32_t num_indices = _sshape_box_num_indices(params.tiles);
-    sshape_buffer_t buf = *in_buf;
-    if (!_sshape_validate_buffer(&buf, num_vertices, num_indices)) {
-        buf.valid = false;
-        return buf;
-    }
-    buf.valid = true;
-    const uint16_t start_index = _sshape_base_index(&buf);
-    if (!params.merge) {
-        _sshape_advance_offset(&buf.vertices);
-        _sshape_advance_offset(&buf.indices);
-    }
+/*
+    Boxes are built from 6 planes (bottom, top, left, right, front, back),
+    vertex and index rows are numbered continuously across all faces.
+*/
+static void _sshape_build_box_part(const sshape_buffer_t* buf, const sshape_box_t* params, uint32_t part, uint32_t num_parts) {
+    const _sshape_dst_t dst = _sshape_dst(buf);
+    const uint32_t row_len = params->tiles + 1;
+    uint32_t first, end;
 
-    // build vertices
-    uint32_t rand_seed = 0x12345678;
-    const float x0 = -params.width * 0.5f;
-    const float x1 =  params.width * 0.5f;
-    const float y0 = -params.height * 0.5f;
-    const float y1 =  params.height * 0.5f;
-    const float z0 = -params.depth * 0.5f;
-    const float z1 =  params.depth * 0.5f;
-    const float dx = params.width / params.tiles;
-    const float dy = params.height / params.tiles;
-    const float dz = params.depth / params.tiles;
-    const float duv = 1.0f / params.tiles;
-
-    // bottom/top vertices
-    for (uint32_t top_bottom = 0; top_bottom < 2; top_bottom++) {
-        _sshape_vec4_t pos = _sshape_vec4(0.0f, (0==top_bottom) ? y0:y1, 0.0f, 1.0f);
-        const _sshape_vec4_t norm = _sshape_vec4(0.0f, (0==top_bottom) ? -1.0f:1.0f, 0.0f, 0.0f);
-        const _sshape_vec4_t tnorm = _sshape_vec4_norm(_sshape_mat4_mul(&params.transform, norm));
-        for (uint32_t ix = 0; ix <= params.tiles; ix++) {
-            pos.x = (0==top_bottom) ? (x0 + dx * ix) : (x1 - dx * ix);
-            for (uint32_t iz = 0; iz <= params.tiles; iz++) {
-                pos.z = z0 + dz * iz;
-                const _sshape_vec4_t tpos = _sshape_mat4_mul(&params.transform, pos);
-                const _sshape_vec2_t uv = _sshape_vec2(ix * duv, iz * duv);
-                const uint32_t color = params.random_colors ? _sshape_rand_color(&rand_seed) : params.color;
-                _sshape_add_vertex(&buf, tpos, tnorm, uv, color);
-            }
+    // write vertices
+    _sshape_part_rows(6 * row_len, part, num_parts, &first, &end);
+    uint32_t rand_seed = 0;
+    sshape_vertex_t* v_ptr = dst.vertices + first * row_len;
+    const float x0 = -params->width * 0.5f;
+    const float x1 =  params->width * 0.5f;
+    const float y0 = -params->height * 0.5f;
+    const float y1 =  params->height * 0.5f;
+    const float z0 = -params->depth * 0.5f;
+    const float z1 =  params->depth * 0.5f;
+    const float dx = params->width / params->tiles;
+    const float dy = params->height / params->tiles;
+    const float dz = params->depth / params->tiles;
+    const float duv = 1.0f / params->tiles;
+    for (uint32_t row = first; row < end; row++) {
+        if (params->random_colors) {
+            rand_seed = _sshape_rand_seed(row);
         }
-    }
-
-    // left/right vertices
-    for (uint32_t left_right = 0; left_right < 2; left_right++) {
-        _sshape_vec4_t pos = _sshape_vec4((0==left_right) ? x0:x1, 0.0f, 0.0f, 1.0f);
-        const _sshape_vec4_t norm = _sshape_vec4((0==left_right) ? -1.0f:1.0f, 0.0f, 0.0f, 0.0f);
-        const _sshape_vec4_t tnorm = _sshape_vec4_norm(_sshape_mat4_mul(&params.transform, norm));
-        for (uint32_t iy = 0; iy <= params.tiles; iy++) {
-            pos.y = (0==left_right) ? (y1 - dy * iy) : (y0 + dy * iy);
-            for (uint32_t iz = 0; iz <= params.tiles; iz++) {
-                pos.z = z0 + dz * iz;
-                const _sshape_vec4_t tpos = _sshape_mat4_mul(&params.transform, pos);
-                const _sshape_vec2_t uv = _sshape_vec2(iy * duv, iz * duv);
-                const uint32_t color = params.random_colors ? _sshape_rand_color(&rand_seed) : params.color;
-                _sshape_add_vertex(&buf, tpos, tnorm, uv, color);
-            }
+        const uint32_t face = row / row_len;
+        const uint32_t k = row % row_len;
+        const bool first_side = 0 == (face & 1);
+        const float nrm = first_side ? -1.0f : 1.0f;
+        _sshape_vec4_t pos, norm;
+        switch (face >> 1) {
+            case 0:
+                // bottom/top
+                pos = _sshape_vec4(first_side ? (x0 + dx * k) : (x1 - dx * k), first_side ? y0:y1, 0.0f, 1.0f);
+                norm = _sshape_vec4(0.0f, nrm, 0.0f, 0.0f);
+                break;
+            case 1:
+                // left/right
+                pos = _sshape_vec4(first_side ? x0:x1, first_side ? (y1 - dy * k) : (y0 + dy * k), 0.0f, 1.0f);
+                norm = _sshape_vec4(nrm, 0.0f, 0.0f, 0.0f);
+                break;
+            default:
+                // front/back
+                pos = _sshape_vec4(first_side ? (x1 - dx * k) : (x0 + dx * k), 0.0f, first_side ? z0:z1, 1.0f);
+                norm = _sshape_vec4(0.0f, 0.0f, nrm, 0.0f);
+                break;
         }
-    }
-
-    // front/back vertices
-    for (uint32_t front_back = 0; front_back < 2; front_back++) {
-        _sshape_vec4_t pos = _sshape_vec4(0.0f, 0.0f, (0==front_back) ? z0:z1, 1.0f);
-        const _sshape_vec4_t norm = _sshape_vec4(0.0f, 0.0f, (0==front_back) ? -1.0f:1.0f, 0.0f);
-        const _sshape_vec4_t tnorm = _sshape_vec4_norm(_sshape_mat4_mul(&params.transform, norm));
-        for (uint32_t ix = 0; ix <= params.tiles; ix++) {
-            pos.x = (0==front_back) ? (x1 - dx * ix) : (x0 + dx * ix);
-            for (uint32_t iy = 0; iy <= params.tiles; iy++) {
-                pos.y = y0 + dy * iy;
-                const _sshape_vec4_t tpos = _sshape_mat4_mul(&params.transform, pos);
-                const _sshape_vec2_t uv = _sshape_vec2(ix * duv, iy * duv);
-                const uint32_t color = params.random_colors ? _sshape_rand_color(&rand_seed) : params.color;
-                _sshape_add_vertex(&buf, tpos, tnorm, uv, color);
+        const _sshape_vec4_t tnorm = _sshape_vec4_norm(_sshape_mat4_mul(&params->transform, norm));
+        for (uint32_t l = 0; l <= params->tiles; l++) {
+            if ((face >> 1) < 2) {
+                pos.z = z0 + dz * l;
+            } else {
+                pos.y = y0 + dy * l;
             }
+            const _sshape_vec4_t tpos = _sshape_mat4_mul(&params->transform, pos);
+            const _sshape_vec2_t uv = _sshape_vec2(k * duv, l * duv);
+            const uint32_t color = params->random_colors ? _sshape_rand_color(&rand_seed) : params->color;
+            v_ptr = _sshape_write_vertex(v_ptr, tpos, tnorm, uv, color);
         }
     }
 
-    // build indices
-    const uint16_t verts_per_face = (params.tiles + 1) * (params.tiles + 1);
-    for (uint16_t face = 0; face < 6; face++) {
-        uint16_t face_start_index = start_index + face * verts_per_face;
-        for (uint16_t j = 0; j < params.tiles; j++) {
-            for (uint16_t i = 0; i < params.tiles; i++) {
-                const uint16_t i0 = face_start_index + (j * (params.tiles + 1)) + i;
-                const uint16_t i1 = i0 + 1;
-                const uint16_t i2 = i0 + params.tiles + 1;
-                const uint16_t i3 = i2 + 1;
-                _sshape_add_triangle(&buf, i0, i1, i3);
-                _sshape_add_triangle(&buf, i0, i3, i2);
-            }
+    // write indices
+    _sshape_part_rows(6 * params->tiles, part, num_parts, &first, &end);
+    uint16_t* i_ptr = dst.indices + first * params->tiles * 6;
+    const uint16_t verts_per_face = (params->tiles + 1) * (params->tiles + 1);
+    for (uint32_t row = first; row < end; row++) {
+        const uint16_t face_start_index = dst.start_index + (row / params->tiles) * verts_per_face;
+        const uint32_t j = row % params->tiles;
+        for (uint16_t i = 0; i < params->tiles; i++) {
+            const uint16_t i0 = face_start_index + (j * (params->tiles + 1)) + i;
+            const uint16_t i1 = i0 + 1;
+            const uint16_t i2 = i0 + params->tiles + 1;
+            const uint16_t i3 = i2 + 1;
+            i_ptr = _sshape_write_triangle(i_ptr, i0, i1, i3);
+            i_ptr = _sshape_write_triangle(i_ptr, i0, i3, i2);
         }
     }
-    return buf;
 }
 
 /*
@@ -1078,76 +1212,68 @@ SOKOL_API_IMPL sshape_buffer_t sshape_build_box(const sshape_buffer_t* in_buf, c
      \ |\ |\ |\ |\ |
       \| \| \| \| \|
     +  +  +  +  +  +        south pole
+
+    Vertex rows are the stacks + 1 rings, index rows are the north-pole
+    triangles, the stacks - 2 quad rows and the south-pole triangles.
 */
-SOKOL_API_IMPL sshape_buffer_t sshape_build_sphere(const sshape_buffer_t* in_buf, const sshape_sphere_t* in_params) {
-    SOKOL_ASSERT(in_buf && in_params);
-    const sshape_sphere_t params = _sshape_sphere_defaults(in_params);
-    const uint32_t num_vertices = _sshape_sphere_num_vertices(params.slices, params.stacks);
-    const uint32_t num_indices = _sshape_sphere_num_indices(params.slices, params.stacks);
-    sshape_buffer_t buf = *in_buf;
-    if (!_sshape_validate_buffer(&buf, num_vertices, num_indices)) {
-        buf.valid = false;
-        return buf;
-    }
-    buf.valid = true;
-    const uint16_t start_index = _sshape_base_index(&buf);
-    if (!params.merge) {
-        _sshape_advance_offset(&buf.vertices);
-        _sshape_advance_offset(&buf.indices);
-    }
+static void _sshape_build_sphere_part(const sshape_buffer_t* buf, const sshape_sphere_t* params, uint32_t part, uint32_t num_parts) {
+    const _sshape_dst_t dst = _sshape_dst(buf);
+    const uint32_t row_len = params->slices + 1;
+    uint32_t first, end;
 
-    uint32_t rand_seed = 0x12345678;
+    // write vertices
+    _sshape_part_rows(params->stacks + 1, part, num_parts, &first, &end);
+    uint32_t rand_seed = 0;
+    sshape_vertex_t* v_ptr = dst.vertices + first * row_len;
     const float pi = 3.14159265358979323846f;
     const float two_pi = 2.0f * pi;
-    const float du = 1.0f / params.slices;
-    const float dv = 1.0f / params.stacks;
-
-    // generate vertices
-    for (uint32_t stack = 0; stack <= params.stacks; stack++) {
-        const float stack_angle = (pi * stack) / params.stacks;
+    const float du = 1.0f / params->slices;
+    const float dv = 1.0f / params->stacks;
+    _sshape_sincos_table_t slice_table;
+    _sshape_init_sincos_table(&slice_table, params->slices, two_pi);
+    for (uint32_t stack = first; stack < end; stack++) {
+        if (params->random_colors) {
+            rand_seed = _sshape_rand_seed(stack);
+        }
+        const float stack_angle = (pi * stack) / params->stacks;
         const float sin_stack = sinf(stack_angle);
         const float cos_stack = cosf(stack_angle);
-        for (uint32_t slice = 0; slice <= params.slices; slice++) {
-            const float slice_angle = (two_pi * slice) / params.slices;
-            const float sin_slice = sinf(slice_angle);
-            const float cos_slice = cosf(slice_angle);
-            const _sshape_vec4_t norm = _sshape_vec4(-sin_slice * sin_stack, cos_stack, cos_slice * sin_stack, 0.0f);
-            const _sshape_vec4_t pos = _sshape_vec4(norm.x * params.radius, norm.y * params.radius, norm.z * params.radius, 1.0f);
-            const _sshape_vec4_t tnorm = _sshape_vec4_norm(_sshape_mat4_mul(&params.transform, norm));
-            const _sshape_vec4_t tpos = _sshape_mat4_mul(&params.transform, pos);
+        for (uint32_t slice = 0; slice <= params->slices; slice++) {
+            const _sshape_sincos_t slice_sc = _sshape_sincos(&slice_table, slice);
+            const _sshape_vec4_t norm = _sshape_vec4(-slice_sc.s * sin_stack, cos_stack, slice_sc.c * sin_stack, 0.0f);
+            const _sshape_vec4_t pos = _sshape_vec4(norm.x * params->radius, norm.y * params->radius, norm.z * params->radius, 1.0f);
+            const _sshape_vec4_t tnorm = _sshape_vec4_norm(_sshape_mat4_mul(&params->transform, norm));
+            const _sshape_vec4_t tpos = _sshape_mat4_mul(&params->transform, pos);
             const _sshape_vec2_t uv = _sshape_vec2(1.0f - slice * du, 1.0f - stack * dv);
-            const uint32_t color = params.random_colors ? _sshape_rand_color(&rand_seed) : params.color;
-            _sshape_add_vertex(&buf, tpos, tnorm, uv, color);
+            const uint32_t color = params->random_colors ? _sshape_rand_color(&rand_seed) : params->color;
+            v_ptr = _sshape_write_vertex(v_ptr, tpos, tnorm, uv, color);
         }
     }
 
-    // generate indices
-    {
-        // north-pole triangles
-        const uint16_t row_a = start_index;
-        const uint16_t row_b = row_a + params.slices + 1;
-        for (uint16_t slice = 0; slice < params.slices; slice++) {
-            _sshape_add_triangle(&buf, row_a + slice, row_b + slice, row_b + slice + 1);
-        }
-    }
-    // stack triangles
-    for (uint16_t stack = 1; stack < params.stacks - 1; stack++) {
-        const uint16_t row_a = start_index + stack * (params.slices + 1);
-        const uint16_t row_b = row_a + params.slices + 1;
-        for (uint16_t slice = 0; slice < params.slices; slice++) {
-            _sshape_add_triangle(&buf, row_a + slice, row_b + slice + 1, row_a + slice + 1);
-            _sshape_add_triangle(&buf, row_a + slice, row_b + slice, row_b + slice + 1);
-        }
-    }
-    {
-        // south-pole triangles
-        const uint16_t row_a = start_index + (params.stacks - 1) * (params.slices + 1);
-        const uint16_t row_b = row_a + params.slices + 1;
-        for (uint16_t slice = 0; slice < params.slices; slice++) {
-            _sshape_add_triangle(&buf, row_a + slice, row_b + slice + 1, row_a + slice + 1);
+    // write indices
+    _sshape_part_rows(params->stacks, part, num_parts, &first, &end);
+    uint16_t* i_ptr = dst.indices + ((first == 0) ? 0 : (params->slices * 3 + (first - 1) * params->slices * 6));
+    for (uint32_t stack = first; stack < end; stack++) {
+        const uint16_t row_a = dst.start_index + stack * (params->slices + 1);
+        const uint16_t row_b = row_a + params->slices + 1;
+        if (stack == 0) {
+            // north-pole triangles
+            for (uint16_t slice = 0; slice < params->slices; slice++) {
+                i_ptr = _sshape_write_triangle(i_ptr, row_a + slice, row_b + slice, row_b + slice + 1);
+            }
+        } else if (stack == (uint32_t)(params->stacks - 1)) {
+            // south-pole triangles
+            for (uint16_t slice = 0; slice < params->slices; slice++) {
+                i_ptr = _sshape_write_triangle(i_ptr, row_a + slice, row_b + slice + 1, row_a + slice + 1);
+            }
+        } else {
+            // stack triangles
+            for (uint16_t slice = 0; slice < params->slices; slice++) {
+                i_ptr = _sshape_write_triangle(i_ptr, row_a + slice, row_b + slice + 1, row_a + slice + 1);
+                i_ptr = _sshape_write_triangle(i_ptr, row_a + slice, row_b + slice, row_b + slice + 1);
+            }
         }
     }
-    return buf;
 }
 
 /*
@@ -1168,106 +1294,110 @@ SOKOL_API_IMPL sshape_buffer_t sshape_build_sphere(const sshape_buffer_t* in_buf
      \ |\ |\ |\ |\ |
       \| \| \| \| \|
     +  +  +  +  +  +
+
+    Vertex rows are: top pole, top cap ring, stacks + 1 shaft rings,
+    bottom cap ring and bottom pole. Index rows are: top cap, stacks
+    shaft quad rows and bottom cap.
 */
-static void _sshape_build_cylinder_cap_pole(sshape_buffer_t* buf, const sshape_cylinder_t* params, float pos_y, float norm_y, float du, float v, uint32_t* rand_seed) {
+static sshape_vertex_t* _sshape_build_cylinder_cap_pole(sshape_vertex_t* v_ptr, const sshape_cylinder_t* params, float pos_y, float norm_y, float du, float v, uint32_t* rand_seed) {
     const _sshape_vec4_t tnorm = _sshape_vec4_norm(_sshape_mat4_mul(&params->transform, _sshape_vec4(0.0f, norm_y, 0.0f, 0.0f)));
     const _sshape_vec4_t tpos = _sshape_mat4_mul(&params->transform, _sshape_vec4(0.0f, pos_y, 0.0f, 1.0f));
     for (uint32_t slice = 0; slice <= params->slices; slice++) {
         const _sshape_vec2_t uv = _sshape_vec2(slice * du, 1.0f - v);
         const uint32_t color = params->random_colors ? _sshape_rand_color(rand_seed) : params->color;
-        _sshape_add_vertex(buf, tpos, tnorm, uv, color);
+        v_ptr = _sshape_write_vertex(v_ptr, tpos, tnorm, uv, color);
     }
+    return v_ptr;
 }
 
-static void _sshape_build_cylinder_cap_ring(sshape_buffer_t* buf, const sshape_cylinder_t* params, float pos_y, float norm_y, float du, float v, uint32_t* rand_seed) {
-    const float two_pi = 2.0f * 3.14159265358979323846f;
+static sshape_vertex_t* _sshape_build_cylinder_cap_ring(sshape_vertex_t* v_ptr, const sshape_cylinder_t* params, const _sshape_sincos_table_t* slice_table, float pos_y, float norm_y, float du, float v, uint32_t* rand_seed) {
     const _sshape_vec4_t tnorm = _sshape_vec4_norm(_sshape_mat4_mul(&params->transform, _sshape_vec4(0.0f, norm_y, 0.0f, 0.0f)));
     for (uint32_t slice = 0; slice <= params->slices; slice++) {
-        const float slice_angle = (two_pi * slice) / params->slices;
-        const float sin_slice = sinf(slice_angle);
-        const float cos_slice = cosf(slice_angle);
-        const _sshape_vec4_t pos = _sshape_vec4(sin_slice * params->radius, pos_y, cos_slice * params->radius, 1.0f);
+        const _sshape_sincos_t slice_sc = _sshape_sincos(slice_table, slice);
+        const _sshape_vec4_t pos = _sshape_vec4(slice_sc.s * params->radius, pos_y, slice_sc.c * params->radius, 1.0f);
         const _sshape_vec4_t tpos = _sshape_mat4_mul(&params->transform, pos);
         const _sshape_vec2_t uv = _sshape_vec2(slice * du, 1.0f - v);
         const uint32_t color = params->random_colors ? _sshape_rand_color(rand_seed) : params->color;
-        _sshape_add_vertex(buf, tpos, tnorm, uv, color);
+        v_ptr = _sshape_write_vertex(v_ptr, tpos, tnorm, uv, color);
     }
+    return v_ptr;
 }
 
-SOKOL_SHAPE_API_DECL sshape_buffer_t sshape_build_cylinder(const sshape_buffer_t* in_buf, const sshape_cylinder_t* in_params) {
-    SOKOL_ASSERT(in_buf && in_params);
-    const sshape_cylinder_t params = _sshape_cylinder_defaults(in_params);
-    const uint32_t num_vertices = _sshape_cylinder_num_vertices(params.slices, params.stacks);
-    const uint32_t num_indices = _sshape_cylinder_num_indices(params.slices, params.stacks);
-    sshape_buffer_t buf = *in_buf;
-    if (!_sshape_validate_buffer(&buf, num_vertices, num_indices)) {
-        buf.valid = false;
-        return buf;
-    }
-    buf.valid = true;
-    const uint16_t start_index = _sshape_base_index(&buf);
-    if (!params.merge) {
-        _sshape_advance_offset(&buf.vertices);
-        _sshape_advance_offset(&buf.indices);
-    }
+static void _sshape_build_cylinder_part(const sshape_buffer_t* buf, const sshape_cylinder_t* params, uint32_t part, uint32_t num_parts) {
+    const _sshape_dst_t dst = _sshape_dst(buf);
+    const uint32_t row_len = params->slices + 1;
+    uint32_t first, end;
 
-    uint32_t rand_seed = 0x12345678;
+    // write vertices
+    _sshape_part_rows(params->stacks + 5, part, num_parts, &first, &end);
+    uint32_t rand_seed = 0;
+    sshape_vertex_t* v_ptr = dst.vertices + first * row_len;
     const float two_pi = 2.0f * 3.14159265358979323846f;
-    const float du = 1.0f / params.slices;
-    const float dv = 1.0f / (params.stacks + 2);
-    const float y0 = params.height * 0.5f;
-    const float y1 = -params.height * 0.5f;
-    const float dy = params.height / params.stacks;
-
-    // generate vertices
-    _sshape_build_cylinder_cap_pole(&buf, &params, y0, 1.0f, du, 0.0f, &rand_seed);
-    _sshape_build_cylinder_cap_ring(&buf, &params, y0, 1.0f, du, dv, &rand_seed);
-    for (uint32_t stack = 0; stack <= params.stacks; stack++) {
-        const float y = y0 - dy * stack;
-        const float v = dv * stack + dv;
-        for (uint32_t slice = 0; slice <= params.slices; slice++) {
-            const float slice_angle = (two_pi * slice) / params.slices;
-            const float sin_slice = sinf(slice_angle);
-            const float cos_slice = cosf(slice_angle);
-            const _sshape_vec4_t pos = _sshape_vec4(sin_slice * params.radius, y, cos_slice * params.radius, 1.0f);
-            const _sshape_vec4_t tpos = _sshape_mat4_mul(&params.transform, pos);
-            const _sshape_vec4_t norm = _sshape_vec4(sin_slice, 0.0f, cos_slice, 0.0f);
-            const _sshape_vec4_t tnorm = _sshape_vec4_norm(_sshape_mat4_mul(&params.transform, norm));
-            const _sshape_vec2_t uv = _sshape_vec2(slice * du, 1.0f - v);
-            const uint32_t color = params.random_colors ? _sshape_rand_color(&rand_seed) : params.color;
-            _sshape_add_vertex(&buf, tpos, tnorm, uv, color);
-        }
-    }
-    _sshape_build_cylinder_cap_ring(&buf, &params, y1, -1.0f, du, 1.0f - dv, &rand_seed);
-    _sshape_build_cylinder_cap_pole(&buf, &params, y1, -1.0f, du, 1.0f, &rand_seed);
-
-    // generate indices
-    {
-        // top-cap indices
-        const uint16_t row_a = start_index;
-        const uint16_t row_b = row_a + params.slices + 1;
-        for (uint16_t slice = 0; slice < params.slices; slice++) {
-            _sshape_add_triangle(&buf, row_a + slice, row_b + slice + 1, row_b + slice);
+    const float du = 1.0f / params->slices;
+    const float dv = 1.0f / (params->stacks + 2);
+    const float y0 = params->height * 0.5f;
+    const float y1 = -params->height * 0.5f;
+    const float dy = params->height / params->stacks;
+    _sshape_sincos_table_t slice_table;
+    _sshape_init_sincos_table(&slice_table, params->slices, two_pi);
+    for (uint32_t row = first; row < end; row++) {
+        if (params->random_colors) {
+            rand_seed = _sshape_rand_seed(row);
         }
-    }
-    // shaft triangles
-    for (uint16_t stack = 0; stack < params.stacks; stack++) {
-        const uint16_t row_a = start_index + (stack + 2) * (params.slices + 1);
-        const uint16_t row_b = row_a + params.slices + 1;
-        for (uint16_t slice = 0; slice < params.slices; slice++) {
-            _sshape_add_triangle(&buf, row_a + slice, row_a + slice + 1, row_b + slice + 1);
-            _sshape_add_triangle(&buf, row_a + slice, row_b + slice + 1, row_b + slice);
+        if (row == 0) {
+            v_ptr = _sshape_build_cylinder_cap_pole(v_ptr, params, y0, 1.0f, du, 0.0f, &rand_seed);
+        } else if (row == 1) {
+            v_ptr = _sshape_build_cylinder_cap_ring(v_ptr, params, &slice_table, y0, 1.0f, du, dv, &rand_seed);
+        } else if (row == (uint32_t)(params->stacks + 3)) {
+            v_ptr = _sshape_build_cylinder_cap_ring(v_ptr, params, &slice_table, y1, -1.0f, du, 1.0f - dv, &rand_seed);
+        } else if (row == (uint32_t)(params->stacks + 4)) {
+            v_ptr = _sshape_build_cylinder_cap_pole(v_ptr, params, y1, -1.0f, du, 1.0f, &rand_seed);
+        } else {
+            const uint32_t stack = row - 2;
+            const float y = y0 - dy * stack;
+            const float v = dv * stack + dv;
+            for (uint32_t slice = 0; slice <= params->slices; slice++) {
+                const _sshape_sincos_t slice_sc = _sshape_sincos(&slice_table, slice);
+                const _sshape_vec4_t pos = _sshape_vec4(slice_sc.s * params->radius, y, slice_sc.c * params->radius, 1.0f);
+                const _sshape_vec4_t tpos = _sshape_mat4_mul(&params->transform, pos);
+                const _sshape_vec4_t norm = _sshape_vec4(slice_sc.s, 0.0f, slice_sc.c, 0.0f);
+                const _sshape_vec4_t tnorm = _sshape_vec4_norm(_sshape_mat4_mul(&params->transform, norm));
+                const _sshape_vec2_t uv = _sshape_vec2(slice * du, 1.0f - v);
+                const uint32_t color = params->random_colors ? _sshape_rand_color(&rand_seed) : params->color;
+                v_ptr = _sshape_write_vertex(v_ptr, tpos, tnorm, uv, color);
+            }
         }
     }
-    {
-        // bottom-cap indices
-        const uint16_t row_a = start_index + (params.stacks + 3) * (params.slices + 1);
-        const uint16_t row_b = row_a + params.slices + 1;
-        for (uint16_t slice = 0; slice < params.slices; slice++) {
-            _sshape_add_triangle(&buf, row_a + slice, row_a + slice + 1, row_b + slice + 1);
+
+    // write indices
+    _sshape_part_rows(params->stacks + 2, part, num_parts, &first, &end);
+    uint16_t* i_ptr = dst.indices + ((first == 0) ? 0 : (params->slices * 3 + (first - 1) * params->slices * 6));
+    for (uint32_t row = first; row < end; row++) {
+        if (row == 0) {
+            // top-cap indices
+            const uint16_t row_a = dst.start_index;
+            const uint16_t row_b = row_a + params->slices + 1;
+            for (uint16_t slice = 0; slice < params->slices; slice++) {
+                i_ptr = _sshape_write_triangle(i_ptr, row_a + slice, row_b + slice + 1, row_b + slice);
+            }
+        } else if (row == (uint32_t)(params->stacks + 1)) {
+            // bottom-cap indices
+            const uint16_t row_a = dst.start_index + (params->stacks + 3) * (params->slices + 1);
+            const uint16_t row_b = row_a + params->slices + 1;
+            for (uint16_t slice = 0; slice < params->slices; slice++) {
+                i_ptr = _sshape_write_triangle(i_ptr, row_a + slice, row_a + slice + 1, row_b + slice + 1);
+            }
+        } else {
+            // shaft triangles
+            const uint32_t stack = row - 1;
+            const uint16_t row_a = dst.start_index + (stack + 2) * (params->slices + 1);
+            const uint16_t row_b = row_a + params->slices + 1;
+            for (uint16_t slice = 0; slice < params->slices; slice++) {
+                i_ptr = _sshape_write_triangle(i_ptr, row_a + slice, row_a + slice + 1, row_b + slice + 1);
+                i_ptr = _sshape_write_triangle(i_ptr, row_a + slice, row_b + slice + 1, row_b + slice);
+            }
         }
     }
-    return buf;
 }
 
 /*
@@ -1286,71 +1416,191 @@ SOKOL_SHAPE_API_DECL sshape_buffer_t sshape_build_cylinder(const sshape_buffer_t
     |\ |\ |\ |\ |\ |
     | \| \| \| \| \|
     +--+--+--+--+--+
+
+    Vertex and index rows are split along the sides.
 */
-SOKOL_API_IMPL sshape_buffer_t sshape_build_torus(const sshape_buffer_t* in_buf, const sshape_torus_t* in_params) {
-    SOKOL_ASSERT(in_buf && in_params);
-    const sshape_torus_t params = _sshape_torus_defaults(in_params);
-    const uint32_t num_vertices = _sshape_torus_num_vertices(params.sides, params.rings);
-    const uint32_t num_indices = _sshape_torus_num_indices(params.sides, params.rings);
-    sshape_buffer_t buf = *in_buf;
-    if (!_sshape_validate_buffer(&buf, num_vertices, num_indices)) {
-        buf.valid = false;
-        return buf;
-    }
-    buf.valid = true;
-    const uint16_t start_index = _sshape_base_index(&buf);
-    if (!params.merge) {
-        _sshape_advance_offset(&buf.vertices);
-        _sshape_advance_offset(&buf.indices);
-    }
+static void _sshape_build_torus_part(const sshape_buffer_t* buf, const sshape_torus_t* params, uint32_t part, uint32_t num_parts) {
+    const _sshape_dst_t dst = _sshape_dst(buf);
+    const uint32_t row_len = params->rings + 1;
+    uint32_t first, end;
 
-    uint32_t rand_seed = 0x12345678;
+    // write vertices
+    _sshape_part_rows(params->sides + 1, part, num_parts, &first, &end);
+    uint32_t rand_seed = 0;
+    sshape_vertex_t* v_ptr = dst.vertices + first * row_len;
     const float two_pi = 2.0f * 3.14159265358979323846f;
-    const float dv = 1.0f / params.sides;
-    const float du = 1.0f / params.rings;
-
-    // generate vertices
-    for (uint32_t side = 0; side <= params.sides; side++) {
-        const float phi = (side * two_pi) / params.sides;
+    const float dv = 1.0f / params->sides;
+    const float du = 1.0f / params->rings;
+    _sshape_sincos_table_t ring_table;
+    _sshape_init_sincos_table(&ring_table, params->rings, two_pi);
+    for (uint32_t side = first; side < end; side++) {
+        if (params->random_colors) {
+            rand_seed = _sshape_rand_seed(side);
+        }
+        const float phi = (side * two_pi) / params->sides;
         const float sin_phi = sinf(phi);
         const float cos_phi = cosf(phi);
-        for (uint32_t ring = 0; ring <= params.rings; ring++) {
-            const float theta = (ring * two_pi) / params.rings;
-            const float sin_theta = sinf(theta);
-            const float cos_theta = cosf(theta);
+        for (uint32_t ring = 0; ring <= params->rings; ring++) {
+            const _sshape_sincos_t theta_sc = _sshape_sincos(&ring_table, ring);
 
             // torus surface position
-            const float spx = sin_theta * (params.radius - (params.ring_radius * cos_phi));
-            const float spy = sin_phi * params.ring_radius;
-            const float spz = cos_theta * (params.radius - (params.ring_radius * cos_phi));
+            const float spx = theta_sc.s * (params->radius - (params->ring_radius * cos_phi));
+            const float spy = sin_phi * params->ring_radius;
+            const float spz = theta_sc.c * (params->radius - (params->ring_radius * cos_phi));
 
             // torus position with ring-radius zero (for normal computation)
-            const float ipx = sin_theta * params.radius;
+            const float ipx = theta_sc.s * params->radius;
             const float ipy = 0.0f;
-            const float ipz = cos_theta * params.radius;
+            const float ipz = theta_sc.c * params->radius;
 
             const _sshape_vec4_t pos = _sshape_vec4(spx, spy, spz, 1.0f);
             const _sshape_vec4_t norm = _sshape_vec4(spx - ipx, spy - ipy, spz - ipz, 0.0f);
-            const _sshape_vec4_t tpos = _sshape_mat4_mul(&params.transform, pos);
-            const _sshape_vec4_t tnorm = _sshape_vec4_norm(_sshape_mat4_mul(&params.transform, norm));
+            const _sshape_vec4_t tpos = _sshape_mat4_mul(&params->transform, pos);
+            const _sshape_vec4_t tnorm = _sshape_vec4_norm(_sshape_mat4_mul(&params->transform, norm));
             const _sshape_vec2_t uv = _sshape_vec2(ring * du, 1.0f - side * dv);
-            const uint32_t color = params.random_colors ? _sshape_rand_color(&rand_seed) : params.color;
-            _sshape_add_vertex(&buf, tpos, tnorm, uv, color);
+            const uint32_t color = params->random_colors ? _sshape_rand_color(&rand_seed) : params->color;
+            v_ptr = _sshape_write_vertex(v_ptr, tpos, tnorm, uv, color);
         }
     }
 
-    // generate indices
-    for (uint16_t side = 0; side < params.sides; side++) {
-        const uint16_t row_a = start_index + side * (params.rings + 1);
-        const uint16_t row_b = row_a + params.rings + 1;
-        for (uint16_t ring = 0; ring < params.rings; ring++) {
-            _sshape_add_triangle(&buf, row_a + ring, row_a + ring + 1, row_b + ring + 1);
-            _sshape_add_triangle(&buf, row_a + ring, row_b + ring + 1, row_b + ring);
+    // write indices
+    _sshape_part_rows(params->sides, part, num_parts, &first, &end);
+    uint16_t* i_ptr = dst.indices + first * params->rings * 6;
+    for (uint32_t side = first; side < end; side++) {
+        const uint16_t row_a = dst.start_index + side * (params->rings + 1);
+        const uint16_t row_b = row_a + params->rings + 1;
+        for (uint16_t ring = 0; ring < params->rings; ring++) {
+            i_ptr = _sshape_write_triangle(i_ptr, row_a + ring, row_a + ring + 1, row_b + ring + 1);
+            i_ptr = _sshape_write_triangle(i_ptr, row_a + ring, row_b + ring + 1, row_b + ring);
         }
     }
+}
+
+SOKOL_API_IMPL sshape_buffer_t sshape_build_plane(const sshape_buffer_t* in_buf, const sshape_plane_t* in_params) {
+    SOKOL_ASSERT(in_buf && in_params);
+    const sshape_plane_t params = _sshape_plane_defaults(in_params);
+    const sshape_buffer_t buf = _sshape_reserve(in_buf, _sshape_plane_num_vertices(params.tiles), _sshape_plane_num_indices(params.tiles), params.merge);
+    if (buf.valid) {
+        _sshape_build_plane_part(in_buf, &params, 0, 1);
+    }
+    return buf;
+}
+
+SOKOL_API_IMPL sshape_buffer_t sshape_reserve_plane(const sshape_buffer_t* in_buf, const sshape_plane_t* in_params) {
+    SOKOL_ASSERT(in_buf && in_params);
+    const sshape_plane_t params = _sshape_plane_defaults(in_params);
+    return _sshape_reserve(in_buf, _sshape_plane_num_vertices(params.tiles), _sshape_plane_num_indices(params.tiles), params.merge);
+}
+
+SOKOL_API_IMPL void sshape_build_plane_part(const sshape_buffer_t* in_buf, const sshape_plane_t* in_params, uint32_t part, uint32_t num_parts) {
+    SOKOL_ASSERT(in_buf && in_params);
+    SOKOL_ASSERT((num_parts > 0) && (part < num_parts));
+    const sshape_plane_t params = _sshape_plane_defaults(in_params);
+    if (_sshape_validate_buffer(in_buf, _sshape_plane_num_vertices(params.tiles), _sshape_plane_num_indices(params.tiles))) {
+        _sshape_build_plane_part(in_buf, &params, part, num_parts);
+    }
+}
+
+SOKOL_API_IMPL sshape_buffer_t sshape_build_box(const sshape_buffer_t* in_buf, const sshape_box_t* in_params) {
+    SOKOL_ASSERT(in_buf && in_params);
+    const sshape_box_t params = _sshape_box_defaults(in_params);
+    const sshape_buffer_t buf = _sshape_reserve(in_buf, _sshape_box_num_vertices(params.tiles), _sshape_box_num_indices(params.tiles), params.merge);
+    if (buf.valid) {
+        _sshape_build_box_part(in_buf, &params, 0, 1);
+    }
     return buf;
 }
 
+SOKOL_API_IMPL sshape_buffer_t sshape_reserve_box(const sshape_buffer_t* in_buf, const sshape_box_t* in_params) {
+    SOKOL_ASSERT(in_buf && in_params);
+    const sshape_box_t params = _sshape_box_defaults(in_params);
+    return _sshape_reserve(in_buf, _sshape_box_num_vertices(params.tiles), _sshape_box_num_indices(params.tiles), params.merge);
+}
+
+SOKOL_API_IMPL void sshape_build_box_part(const sshape_buffer_t* in_buf, const sshape_box_t* in_params, uint32_t part, uint32_t num_parts) {
+    SOKOL_ASSERT(in_buf && in_params);
+    SOKOL_ASSERT((num_parts > 0) && (part < num_parts));
+    const sshape_box_t params = _sshape_box_defaults(in_params);
+    if (_sshape_validate_buffer(in_buf, _sshape_box_num_vertices(params.tiles), _sshape_box_num_indices(params.tiles))) {
+        _sshape_build_box_part(in_buf, &params, part, num_parts);
+    }
+}
+
+SOKOL_API_IMPL sshape_buffer_t sshape_build_sphere(const sshape_buffer_t* in_buf, const sshape_sphere_t* in_params) {
+    SOKOL_ASSERT(in_buf && in_params);
+    const sshape_sphere_t params = _sshape_sphere_defaults(in_params);
+    const sshape_buffer_t buf = _sshape_reserve(in_buf, _sshape_sphere_num_vertices(params.slices, params.stacks), _sshape_sphere_num_indices(params.slices, params.stacks), params.merge);
+    if (buf.valid) {
+        _sshape_build_sphere_part(in_buf, &params, 0, 1);
+    }
+    return buf;
+}
+
+SOKOL_API_IMPL sshape_buffer_t sshape_reserve_sphere(const sshape_buffer_t* in_buf, const sshape_sphere_t* in_params) {
+    SOKOL_ASSERT(in_buf && in_params);
+    const sshape_sphere_t params = _sshape_sphere_defaults(in_params);
+    return _sshape_reserve(in_buf, _sshape_sphere_num_vertices(params.slices, params.stacks), _sshape_sphere_num_indices(params.slices, params.stacks), params.merge);
+}
+
+SOKOL_API_IMPL void sshape_build_sphere_part(const sshape_buffer_t* in_buf, const sshape_sphere_t* in_params, uint32_t part, uint32_t num_parts) {
+    SOKOL_ASSERT(in_buf && in_params);
+    SOKOL_ASSERT((num_parts > 0) && (part < num_parts));
+    const sshape_sphere_t params = _sshape_sphere_defaults(in_params);
+    if (_sshape_validate_buffer(in_buf, _sshape_sphere_num_vertices(params.slices, params.stacks), _sshape_sphere_num_indices(params.slices, params.stacks))) {
+        _sshape_build_sphere_part(in_buf, &params, part, num_parts);
+    }
+}
+
+SOKOL_API_IMPL sshape_buffer_t sshape_build_cylinder(const sshape_buffer_t* in_buf, const sshape_cylinder_t* in_params) {
+    SOKOL_ASSERT(in_buf && in_params);
+    const sshape_cylinder_t params = _sshape_cylinder_defaults(in_params);
+    const sshape_buffer_t buf = _sshape_reserve(in_buf, _sshape_cylinder_num_vertices(params.slices, params.stacks), _sshape_cylinder_num_indices(params.slices, params.stacks), params.merge);
+    if (buf.valid) {
+        _sshape_build_cylinder_part(in_buf, &params, 0, 1);
+    }
+    return buf;
+}
+
+SOKOL_API_IMPL sshape_buffer_t sshape_reserve_cylinder(const sshape_buffer_t* in_buf, const sshape_cylinder_t* in_params) {
+    SOKOL_ASSERT(in_buf && in_params);
+    const sshape_cylinder_t params = _sshape_cylinder_defaults(in_params);
+    return _sshape_reserve(in_buf, _sshape_cylinder_num_vertices(params.slices, params.stacks), _sshape_cylinder_num_indices(params.slices, params.stacks), params.merge);
+}
+
+SOKOL_API_IMPL void sshape_build_cylinder_part(const sshape_buffer_t* in_buf, const sshape_cylinder_t* in_params, uint32_t part, uint32_t num_parts) {
+    SOKOL_ASSERT(in_buf && in_params);
+    SOKOL_ASSERT((num_parts > 0) && (part < num_parts));
+    const sshape_cylinder_t params = _sshape_cylinder_defaults(in_params);
+    if (_sshape_validate_buffer(in_buf, _sshape_cylinder_num_vertices(params.slices, params.stacks), _sshape_cylinder_num_indices(params.slices, params.stacks))) {
+        _sshape_build_cylinder_part(in_buf, &params, part, num_parts);
+    }
+}
+
+SOKOL_API_IMPL sshape_buffer_t sshape_build_torus(const sshape_buffer_t* in_buf, const sshape_torus_t* in_params) {
+    SOKOL_ASSERT(in_buf && in_params);
+    const sshape_torus_t params = _sshape_torus_defaults(in_params);
+    const sshape_buffer_t buf = _sshape_reserve(in_buf, _sshape_torus_num_vertices(params.sides, params.rings), _sshape_torus_num_indices(params.sides, params.rings), params.merge);
+    if (buf.valid) {
+        _sshape_build_torus_part(in_buf, &params, 0, 1);
+    }
+    return buf;
+}
+
+SOKOL_API_IMPL sshape_buffer_t sshape_reserve_torus(const sshape_buffer_t* in_buf, const sshape_torus_t* in_params) {
+    SOKOL_ASSERT(in_buf && in_params);
+    const sshape_torus_t params = _sshape_torus_defaults(in_params);
+    return _sshape_reserve(in_buf, _sshape_torus_num_vertices(params.sides, params.rings), _sshape_torus_num_indices(params.sides, params.rings), params.merge);
+}
+
+SOKOL_API_IMPL void sshape_build_torus_part(const sshape_buffer_t* in_buf, const sshape_torus_t* in_params, uint32_t part, uint32_t num_parts) {
+    SOKOL_ASSERT(in_buf && in_params);
+    SOKOL_ASSERT((num_parts > 0) && (part < num_parts));
+    const sshape_torus_t params = _sshape_torus_defaults(in_params);
+    if (_sshape_validate_buffer(in_buf, _sshape_torus_num_vertices(params.sides, params.rings), _sshape_torus_num_indices(params.sides, params.rings))) {
+        _sshape_build_torus_part(in_buf, &params, part, num_parts);
+    }
+}
+
 SOKOL_API_IMPL sg_buffer_desc sshape_vertex_buffer_desc(const sshape_buffer_t* buf) {
     SOKOL_ASSERT(buf && buf->valid);
     sg_buffer_desc desc = { 0 };
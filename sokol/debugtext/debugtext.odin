@@ -74,6 +74,10 @@ package sokol_debugtext
         .context_pool_size (default: 8)
             The max number of text contexts that can be created.
 
+        .block_pool_size (default: 64)
+            The max number of retained text blocks that can be created
+            (see RETAINED TEXT BLOCKS below).
+
         .printf_buf_size (default: 4096)
             The size of the internal text formatting buffer used by
             sdtx_printf() and sdtx_vprintf().
@@ -136,6 +140,18 @@ package sokol_debugtext
                 values here when rendering to render targets with different
                 pixel format attributes than the default framebuffer.
 
+            .instanced (default: false)
+                If true, each character is recorded as a single 12-byte
+                instance (position, character code, font and color) instead
+                of 6 vertices (96 bytes), and the quad is expanded in the
+                vertex shader via an instanced draw call. This reduces the
+                per-frame buffer upload size by 8x and is recommended for
+                large amounts of text (e.g. full-screen consoles). In instanced
+                mode, character positions are stored with quarter-pixel precision
+                in a 16-bit range, so positions must be within -1024..1023
+                character cells. NOTE: the instanced vertex shader is always
+                compiled from source, on D3D11 this requires d3dcompiler_47.dll.
+
     --- Before starting to render text, optionally call sdtx_canvas() to
         dynamically resize the virtual canvas. This is recommended when
         rendering to a resizeable window. The virtual canvas size can
@@ -154,6 +170,11 @@ package sokol_debugtext
         Do *not* use integer math here, since this will not look nice
         when the render target size isn't divisible by 2.
 
+        The new canvas size applies to all following text, except while a
+        text block is being recorded (see RETAINED TEXT BLOCKS below): block
+        characters are recorded in character cells, and the canvas size is
+        only applied when the block is drawn.
+
     --- Optionally define the origin for the character grid with:
 
             sdtx_origin(x, y);
@@ -221,6 +242,26 @@ package sokol_debugtext
             sdtx_vprintf(fmt, args) - same as sdtx_printf() but with the arguments
                                       provided in a va_list
 
+            sdtx_put_int(val)       - output a signed integer in decimal notation
+
+            sdtx_put_float(val, decimals)
+                                    - output a float in fixed-point notation with
+                                      'decimals' (0..9) digits after the decimal point,
+                                      the result is rounded to nearest (ties away from
+                                      zero), values which round to zero are printed
+                                      without a minus sign
+
+            sdtx_put_hex(val, num_digits)
+                                    - output an unsigned integer as uppercase hex
+                                      number without prefix, zero-padded to
+                                      'num_digits' (0..8), 0 means no padding
+
+        - sdtx_put_int(), sdtx_put_float() and sdtx_put_hex() don't go through
+          vsnprintf() and an intermediate format buffer, and are much faster than
+          sdtx_printf() when printing a lot of numbers (sdtx_put_float() only falls
+          back to sdtx_printf() for NaN, infinity and values which don't fit into
+          a 64-bit integer after scaling by 10^decimals)
+
         - Note that the text will not yet be rendered, only recorded for rendering
           at a later time, the actual rendering happens when sdtx_draw() is called
           inside a sokol-gfx render pass.
@@ -288,6 +329,7 @@ package sokol_debugtext
         .color_format       -- color pixel format of target render pass
         .depth_format       -- depth pixel format of target render pass
         .sample_count       -- MSAA sample count of target render pass
+        .instanced          -- render each character as one instance instead of 6 vertices
 
     To make a new context the active context, call:
 
@@ -334,6 +376,61 @@ package sokol_debugtext
         sdtx_context_draw(ctx)
         sdtx_context_draw_layer(ctx, layer_id)
 
+    RETAINED TEXT BLOCKS
+    ====================
+    Text output with the functions above is recorded anew each frame. For
+    large, mostly static text (like help screens or table headers) you can
+    instead record the text once into a 'text block' which keeps its
+    characters in an immutable sokol-gfx buffer, and then draw the block each
+    frame at a new position and with a tint color, which only costs a single
+    draw call.
+
+    To record a text block, call:
+
+        sdtx_begin_block();
+        sdtx_puts("...");
+        sdtx_printf(...);
+        ...
+        sdtx_block block = sdtx_end_block();
+
+    Between sdtx_begin_block() and sdtx_end_block() all text output of the
+    current context goes into the text block instead of the per-frame
+    text buffer. The cursor position and origin are reset to zero
+    in sdtx_begin_block() and restored in sdtx_end_block(), so that block
+    positions are relative to the top-left corner of the block. Font and
+    color changes are recorded into the block, layer changes are ignored.
+    The canvas size is not recorded: calling sdtx_canvas() while recording
+    a block doesn't change the block's characters, it only changes the
+    context's canvas size, which takes effect when the block (or any other
+    text) is drawn later. Like outside of a block, it also resets the
+    cursor position and origin. A block can hold at most as many characters
+    as the char_buf_size of the recording context.
+
+    The returned handle will be invalid (SG_INVALID_ID) if the block pool
+    is exhausted (see sdtx_desc_t.block_pool_size).
+
+    To draw a text block from inside a sokol-gfx render pass, call:
+
+        sdtx_draw_block(block, x, y, rgba)
+
+    ...where x and y is the position of the block's top-left corner in
+    character cells relative to the virtual canvas of the current context,
+    and rgba is a tint color (ABGR 0xAABBGGRR) which is multiplied with
+    the recorded character colors (0xFFFFFFFF for no tint). Unlike sdtx_draw(),
+    the block is rendered immediately, the pipeline attributes (pixel formats
+    and sample count) and virtual canvas size are taken from the current
+    context. To draw with a specific context:
+
+        sdtx_context_draw_block(ctx, block, x, y, rgba)
+
+    Text blocks are always rendered via instancing (see the .instanced
+    context parameter above), and block positions are limited to the same
+    -1024..1023 character cell range.
+
+    Text blocks are not owned by a context, to destroy a text block, call:
+
+        sdtx_destroy_block(block)
+
     USING YOUR OWN FONT DATA
     ========================
 
@@ -636,8 +733,17 @@ foreign sokol_debugtext_clib {
     putc :: proc(c: u8)  ---
     puts :: proc(str: cstring)  ---
     putr :: proc(str: cstring, #any_int len: c.int)  ---
+    put_int :: proc(#any_int val: c.int)  ---
+    put_float :: proc(val: f32, #any_int decimals: c.int)  ---
+    put_hex :: proc(val: u32, #any_int num_digits: c.int)  ---
     // language bindings helper: get the internal printf format buffer
     get_cleared_fmt_buffer :: proc() -> Range ---
+    // retained text blocks
+    begin_block :: proc()  ---
+    end_block :: proc() -> Block ---
+    destroy_block :: proc(block: Block)  ---
+    draw_block :: proc(block: Block, x: f32, y: f32, rgba: u32)  ---
+    context_draw_block :: proc(ctx: Context, block: Block, x: f32, y: f32, rgba: u32)  ---
 }
 
 Log_Item :: enum i32 {
@@ -647,6 +753,10 @@ Log_Item :: enum i32 {
     COMMAND_BUFFER_FULL,
     CONTEXT_POOL_EXHAUSTED,
     CANNOT_DESTROY_DEFAULT_CONTEXT,
+    BLOCK_POOL_EXHAUSTED,
+    BLOCK_ALREADY_ACTIVE,
+    NO_ACTIVE_BLOCK,
+    BLOCK_BUFFER_FULL,
 }
 
 /*
@@ -665,6 +775,11 @@ Context :: struct {
     id : u32,
 }
 
+// a retained text block handle
+Block :: struct {
+    id : u32,
+}
+
 /*
     sdtx_range is a pointer-size-pair struct used to pass memory
     blobs into sokol-debugtext. When initialized from a value type
@@ -699,6 +814,7 @@ Context_Desc :: struct {
     color_format : sg.Pixel_Format,
     depth_format : sg.Pixel_Format,
     sample_count : c.int,
+    instanced : bool,
 }
 
 /*
@@ -733,6 +849,7 @@ Allocator :: struct {
 */
 Desc :: struct {
     context_pool_size : c.int,
+    block_pool_size : c.int,
     printf_buf_size : c.int,
     fonts : [8]Font_Desc,
     ctx : Context_Desc,
@@ -0,0 +1,355 @@
+// machine generated, do not edit
+
+package sokol_draw_queue
+
+/*
+    sokol_draw_queue.h -- sort draw calls by a 64-bit key and submit them with minimal state changes
+
+    Project URL: https://github.com/Ed94/SectrPrototype (Sectr fork of sokol-odin)
+
+    This header is an addition of the Sectr fork and is not part of the upstream
+    sokol headers (https://github.com/floooh/sokol), it follows their API conventions.
+
+    Do this:
+        #define SOKOL_IMPL or
+        #define SOKOL_DRAW_QUEUE_IMPL
+    before you include this file in *one* C or C++ file to create the
+    implementation.
+
+    Optionally provide the following defines with your own implementations:
+
+    SOKOL_ASSERT(c)             - your own assert macro (default: assert(c))
+    SOKOL_DRAW_QUEUE_API_DECL   - public function declaration prefix (default: extern)
+    SOKOL_API_DECL              - same as SOKOL_DRAW_QUEUE_API_DECL
+    SOKOL_API_IMPL              - public function implementation prefix (default: -)
+
+    If sokol_draw_queue.h is compiled as a DLL, define the following before
+    including the declaration or implementation:
+
+    SOKOL_DLL
+
+    On Windows, SOKOL_DLL will define SOKOL_DRAW_QUEUE_API_DECL as __declspec(dllexport)
+    or __declspec(dllimport) as needed.
+
+    Include the following headers before including sokol_draw_queue.h:
+
+        sokol_gfx.h
+
+    FEATURES AND CONCEPTS
+    =====================
+    - draw calls are queued together with their pipeline, bindings (or
+      bindgroup), uniform data and a 64-bit sort key
+    - when the queue is flushed, the queued draws are radix-sorted by
+      their sort key (draws with the same key keep their submission order)
+      and submitted to sokol_gfx.h, sg_apply_pipeline(), sg_apply_bindings(),
+      sg_apply_bindgroup() and sg_apply_uniforms() calls which wouldn't
+      change the current state are skipped
+    - this means that a scene can be submitted in traversal order, and
+      the number of state changes is minimized automatically
+    - the sort key layout is up to the caller, but sdq_make_key() builds
+      a key from the typical ingredients (from most to least significant):
+
+        - pass (8 bits): a queue can collect the draws for several
+          sokol_gfx.h passes, each pass is flushed separately
+          with sdq_flush_pass()
+        - layer (8 bits): for instance opaque, alpha-tested, transparent, UI
+        - pipeline (16 bits): the slot index of the sg_pipeline handle
+        - material (16 bits): an application-defined material index
+        - depth (16 bits): a depth value between 0.0 and 1.0, for
+          front-to-back sorting (pass 1.0 - depth for back-to-front sorting),
+          values outside this range are clamped and NaN is treated as 0.0
+
+    STEP BY STEP
+    ============
+    --- call sdq_setup() after sg_setup():
+
+            sg_setup(&(sg_desc){ ... });
+            sdq_setup(&(sdq_desc_t){ .logger.func = slog_func });
+
+        The following sdq_desc_t items can be provided:
+
+            .max_draws          - the max number of queued draws (default: 16384)
+            .max_uniform_bytes  - the max size of all queued uniform data
+                                  (default: 1 MByte)
+
+    --- queue draws with sdq_draw(), this doesn't call into sokol_gfx.h:
+
+            sdq_draw(&(sdq_draw_desc){
+                .key = sdq_make_key(0, LAYER_OPAQUE, pip, mat_index, depth),
+                .pipeline = pip,
+                .bindings = { ... },
+                .uniforms[UB_vs_params] = SG_RANGE(vs_params),
+                .num_elements = 36,
+                .num_instances = 1,
+            });
+
+        Uniform data is copied, and at most SG_MAX_UNIFORMBLOCK_BINDSLOTS
+        uniform blocks can be provided per draw. Instead of .bindings, a
+        bindgroup can be provided via .bindgroup. Empty bindings are not
+        applied (for shaders without resource bindings).
+
+    --- inside a sokol_gfx.h pass, submit the queued draws:
+
+            sg_begin_pass(...);
+            sdq_flush();
+            sg_end_pass();
+
+        sdq_flush() submits all queued draws and resets the queue. If the
+        queue collects the draws for several passes, call:
+
+            sg_begin_pass(&(sg_pass){ .label = "shadow", ... });
+            sdq_flush_pass(PASS_SHADOW);
+            sg_end_pass();
+            sg_begin_pass(&(sg_pass){ .label = "main", ... });
+            sdq_flush_pass(PASS_MAIN);
+            sg_end_pass();
+
+        ...this only submits the queued draws with the given pass value in
+        the upper 8 bits of their sort key. The queue is reset when all
+        queued draws have been submitted, or explicitly with sdq_clear().
+
+    --- to check how many state changes have been eliminated, call:
+
+            sdq_stats stats = sdq_query_stats();
+
+        ...this returns the accumulated statistics since the last call
+        to sdq_reset_stats().
+
+    --- call sdq_shutdown() before sg_shutdown():
+
+            sdq_shutdown();
+            sg_shutdown();
+
+    ERROR REPORTING AND LOGGING
+    ===========================
+    To get any logging information at all you need to provide a logging callback in the setup call,
+    the easiest way is to use sokol_log.h:
+
+        #include "sokol_log.h"
+
+        sdq_setup(&(sdq_desc_t){
+            // ...
+            .logger.func = slog_func
+        });
+
+    MEMORY ALLOCATION OVERRIDE
+    ==========================
+    You can override the memory allocation functions at initialization time
+    like this:
+
+        void* my_alloc(size_t size, void* user_data) {
+            return malloc(size);
+        }
+
+        void my_free(void* ptr, void* user_data) {
+            free(ptr);
+        }
+
+        ...
+            sdq_setup(&(sdq_desc_t){
+                // ...
+                .allocator = {
+                    .alloc_fn = my_alloc,
+                    .free_fn = my_free,
+                    .user_data = ...;
+                }
+            });
+        ...
+
+    If no overrides are provided, malloc and free will be used.
+
+    LICENSE
+    =======
+    zlib/libpng license
+
+    Copyright (c) 2026 the Sectr fork contributors
+
+    This software is provided 'as-is', without any express or implied warranty.
+    In no event will the authors be held liable for any damages arising from the
+    use of this software.
+
+    Permission is granted to anyone to use this software for any purpose,
+    including commercial applications, and to alter it and redistribute it
+    freely, subject to the following restrictions:
+
+        1. The origin of this software must not be misrepresented; you must not
+        claim that you wrote the original software. If you use this software in a
+        product, an acknowledgment in the product documentation would be
+        appreciated but is not required.
+
+        2. Altered source versions must be plainly marked as such, and must not
+        be misrepresented as being the original software.
+
+        3. This notice may not be removed or altered from any source
+        distribution.
+*/
+import sg "../gfx"
+
+import "core:c"
+
+_ :: c
+
+SOKOL_DEBUG :: #config(SOKOL_DEBUG, ODIN_DEBUG)
+
+DEBUG :: #config(SOKOL_DRAW_QUEUE_DEBUG, SOKOL_DEBUG)
+USE_GL :: #config(SOKOL_USE_GL, false)
+USE_DLL :: #config(SOKOL_DLL, true)
+
+when ODIN_OS == .Windows {
+    when USE_DLL {
+        when USE_GL {
+            when DEBUG { foreign import sokol_draw_queue_clib { "../sokol_dll_windows_x64_gl_debug.lib" } }
+            else       { foreign import sokol_draw_queue_clib { "../sokol_dll_windows_x64_gl_release.lib" } }
+        } else {
+            when DEBUG { foreign import sokol_draw_queue_clib { "../sokol_dll_windows_x64_d3d11_debug.lib" } }
+            else       { foreign import sokol_draw_queue_clib { "../sokol_dll_windows_x64_d3d11_release.lib" } }
+        }
+    } else {
+        when USE_GL {
+            when DEBUG { foreign import sokol_draw_queue_clib { "sokol_draw_queue_windows_x64_gl_debug.lib" } }
+            else       { foreign import sokol_draw_queue_clib { "sokol_draw_queue_windows_x64_gl_release.lib" } }
+        } else {
+            when DEBUG { foreign import sokol_draw_queue_clib { "sokol_draw_queue_windows_x64_d3d11_debug.lib" } }
+            else       { foreign import sokol_draw_queue_clib { "sokol_draw_queue_windows_x64_d3d11_release.lib" } }
+        }
+    }
+} else when ODIN_OS == .Darwin {
+    when USE_DLL {
+             when  USE_GL && ODIN_ARCH == .arm64 &&  DEBUG { foreign import sokol_draw_queue_clib { "../dylib/sokol_dylib_macos_arm64_gl_debug.dylib" } }
+        else when  USE_GL && ODIN_ARCH == .arm64 && !DEBUG { foreign import sokol_draw_queue_clib { "../dylib/sokol_dylib_macos_arm64_gl_release.dylib" } }
+        else when  USE_GL && ODIN_ARCH == .amd64 &&  DEBUG { foreign import sokol_draw_queue_clib { "../dylib/sokol_dylib_macos_x64_gl_debug.dylib" } }
+        else when  USE_GL && ODIN_ARCH == .amd64 && !DEBUG { foreign import sokol_draw_queue_clib { "../dylib/sokol_dylib_macos_x64_gl_release.dylib" } }
+        else when !USE_GL && ODIN_ARCH == .arm64 &&  DEBUG { foreign import sokol_draw_queue_clib { "../dylib/sokol_dylib_macos_arm64_metal_debug.dylib" } }
+        else when !USE_GL && ODIN_ARCH == .arm64 && !DEBUG { foreign import sokol_draw_queue_clib { "../dylib/sokol_dylib_macos_arm64_metal_release.dylib" } }
+        else when !USE_GL && ODIN_ARCH == .amd64 &&  DEBUG { foreign import sokol_draw_queue_clib { "../dylib/sokol_dylib_macos_x64_metal_debug.dylib" } }
+        else when !USE_GL && ODIN_ARCH == .amd64 && !DEBUG { foreign import sokol_draw_queue_clib { "../dylib/sokol_dylib_macos_x64_metal_release.dylib" } }
+    } else {
+        when USE_GL {
+            when ODIN_ARCH == .arm64 {
+                when DEBUG { foreign import sokol_draw_queue_clib { "sokol_draw_queue_macos_arm64_gl_debug.a" } }
+                else       { foreign import sokol_draw_queue_clib { "sokol_draw_queue_macos_arm64_gl_release.a" } }
+            } else {
+                when DEBUG { foreign import sokol_draw_queue_clib { "sokol_draw_queue_macos_x64_gl_debug.a" } }
+                else       { foreign import sokol_draw_queue_clib { "sokol_draw_queue_macos_x64_gl_release.a" } }
+            }
+        } else {
+            when ODIN_ARCH == .arm64 {
+                when DEBUG { foreign import sokol_draw_queue_clib { "sokol_draw_queue_macos_arm64_metal_debug.a" } }
+                else       { foreign import sokol_draw_queue_clib { "sokol_draw_queue_macos_arm64_metal_release.a" } }
+            } else {
+                when DEBUG { foreign import sokol_draw_queue_clib { "sokol_draw_queue_macos_x64_metal_debug.a" } }
+                else       { foreign import sokol_draw_queue_clib { "sokol_draw_queue_macos_x64_metal_release.a" } }
+            }
+        }
+    }
+} else when ODIN_OS == .Linux {
+    when USE_DLL {
+        when DEBUG { foreign import sokol_draw_queue_clib { "sokol_draw_queue_linux_x64_gl_debug.so" } }
+        else       { foreign import sokol_draw_queue_clib { "sokol_draw_queue_linux_x64_gl_release.so" } }
+    } else {
+        when DEBUG { foreign import sokol_draw_queue_clib { "sokol_draw_queue_linux_x64_gl_debug.a" } }
+        else       { foreign import sokol_draw_queue_clib { "sokol_draw_queue_linux_x64_gl_release.a" } }
+    }
+} else when ODIN_ARCH == .wasm32 || ODIN_ARCH == .wasm64p32 {
+    // Feed sokol_draw_queue_wasm_gl_debug.a or sokol_draw_queue_wasm_gl_release.a into emscripten compiler.
+    foreign import sokol_draw_queue_clib { "env.o" }
+} else {
+    #panic("This OS is currently not supported")
+}
+
+@(default_calling_convention="c", link_prefix="sdq_")
+foreign sokol_draw_queue_clib {
+    // setup and shutdown
+    setup :: proc(#by_ptr desc: Desc)  ---
+    shutdown :: proc()  ---
+    // build a sort key from pass, layer, pipeline, material and depth (0.0 .. 1.0)
+    make_key :: proc(pass: c.int, layer: c.int, pip: sg.Pipeline, material: c.int, depth: f32) -> u64 ---
+    // queue draws and submit them
+    draw :: proc(#by_ptr desc: Draw_Desc)  ---
+    flush :: proc()  ---
+    flush_pass :: proc(pass: c.int)  ---
+    clear :: proc()  ---
+    num_queued_draws :: proc() -> c.int ---
+    // statistics
+    query_stats :: proc() -> Stats ---
+    reset_stats :: proc()  ---
+}
+
+Log_Item :: enum i32 {
+    OK,
+    MALLOC_FAILED,
+    DRAWS_EXHAUSTED,
+    UNIFORMS_EXHAUSTED,
+}
+
+/*
+    sdq_logger_t
+
+    Used in sdq_desc_t to provide a custom logging and error reporting
+    callback to sokol-draw-queue.
+*/
+Logger :: struct {
+    func : proc "c" (a0: cstring, a1: u32, a2: u32, a3: cstring, a4: u32, a5: cstring, a6: rawptr),
+    user_data : rawptr,
+}
+
+/*
+    sdq_allocator_t
+
+    Used in sdq_desc_t to provide custom memory-alloc and -free functions
+    to sokol_draw_queue.h. If memory management should be overridden, both
+    the alloc_fn and free_fn function must be provided (e.g. it's not valid
+    to override one function but not the other).
+*/
+Allocator :: struct {
+    alloc_fn : proc "c" (a0: c.size_t, a1: rawptr) -> rawptr,
+    free_fn : proc "c" (a0: rawptr, a1: rawptr),
+    user_data : rawptr,
+}
+
+/*
+    sdq_desc_t
+
+    Describes the draw queue setup parameters, passed to sdq_setup().
+*/
+Desc :: struct {
+    max_draws : c.int,
+    max_uniform_bytes : c.int,
+    allocator : Allocator,
+    logger : Logger,
+}
+
+/*
+    sdq_draw_desc
+
+    Describes a queued draw call, passed to sdq_draw(). If a bindgroup
+    is provided, the bindings are ignored.
+*/
+Draw_Desc :: struct {
+    key : u64,
+    pipeline : sg.Pipeline,
+    bindings : sg.Bindings,
+    bindgroup : sg.Bindgroup,
+    uniforms : [8]sg.Range,
+    base_element : c.int,
+    num_elements : c.int,
+    num_instances : c.int,
+}
+
+/*
+    sdq_stats
+
+    Accumulated statistics since the last call to sdq_reset_stats(),
+    returned by sdq_query_stats().
+*/
+Stats :: struct {
+    num_draws : u32,
+    num_dropped_draws : u32,
+    num_apply_pipeline : u32,
+    num_apply_bindings : u32,
+    num_apply_uniforms : u32,
+    num_skipped_apply_pipeline : u32,
+    num_skipped_apply_bindings : u32,
+    num_skipped_apply_uniforms : u32,
+}
+
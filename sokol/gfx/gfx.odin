@@ -35,7 +35,8 @@ package sokol_gfx
 
     The dummy backend replaces the platform-specific backend code with empty
     stub functions. This is useful for writing tests that need to run on the
-    command line.
+    command line. With frame stats enabled, the dummy backend also records
+    the effects a real backend would have (see DUMMY BACKEND STATS).
 
     Optionally provide the following defines with your own implementations:
 
@@ -187,6 +188,18 @@ package sokol_gfx
         or index-buffer bindings are allowed and will be rejected by the validation
         layer.
 
+        If the same resource bindings are applied over and over again, consider
+        baking them into a pre-validated sg_bindgroup object instead:
+
+            sg_bindgroup sg_make_bindgroup(const sg_bindgroup_desc* desc)
+            sg_apply_bindgroup(sg_bindgroup bg)
+
+        See the documentation block of sg_bindgroup_desc for details.
+
+        Sequences of sg_apply_*(), sg_draw() and sg_dispatch() calls can
+        also be recorded into a command list (on any thread) and replayed
+        later inside a pass, see the section 'COMMAND LISTS' below.
+
     --- optionally update shader uniform data with:
 
             sg_apply_uniforms(int ub_slot, const sg_range* data)
@@ -208,6 +221,12 @@ package sokol_gfx
         containing per-instance data must be bound, and the num_instances parameter
         must be > 1.
 
+    --- ...or kick off a draw call with arguments read from a GPU buffer:
+
+            sg_draw_indirect(sg_buffer buf, int offset)
+
+        See the section 'ON INDIRECT DRAWS' for details.
+
     --- ...or kick of a dispatch call to invoke a compute shader workload:
 
             sg_dispatch(int num_groups_x, int num_groups_y, int num_groups_z)
@@ -235,6 +254,8 @@ package sokol_gfx
             sg_destroy_shader(sg_shader shd)
             sg_destroy_pipeline(sg_pipeline pip)
             sg_destroy_attachments(sg_attachments atts)
+            sg_destroy_bindgroup(sg_bindgroup bg)
+            sg_destroy_command_list(sg_command_list cl)
 
     --- to set a new viewport rectangle, call:
 
@@ -275,6 +296,74 @@ package sokol_gfx
         operation only references the valid (updated) data in the
         buffer or image.
 
+    --- to overwrite parts of a buffer or image while keeping the remaining
+        content intact, call:
+
+            sg_update_buffer_range(sg_buffer buf, int offset, const sg_range* data)
+            sg_update_image_region(sg_image img, const sg_image_region* region, const sg_range* data)
+
+        Unlike sg_update_buffer() and sg_update_image(), those functions can
+        be called any number of times per frame and resource, for instance
+        to stream in dirty tiles of a terrain heightmap or dirty rectangles of
+        a texture atlas. Resources updated this way must have been created with
+        .usage.dynamic_update (not .stream_update).
+
+        sg_update_buffer_range() writes data->size bytes at the byte offset
+        'offset', both the offset and size must be a multiple of 4.
+
+        sg_update_image_region() overwrites a rectangle in a single mipmap
+        level and slice (cubemap face, array layer or 3D-texture depth slice)
+        of an image, described by an sg_image_region struct:
+
+            sg_update_image_region(img,
+                &(sg_image_region){
+                    .mip_level = 0,
+                    .slice = 0,
+                    .x = 64, .y = 32,
+                    .width = 16, .height = 16,
+                },
+                &SG_RANGE(pixels));
+
+        The pixel data must be tightly packed (no row padding). Compressed
+        pixel formats are not supported.
+
+        Partial updates can be mixed with a preceding sg_update_buffer() or
+        sg_update_image() in the same frame (but not the other way around),
+        and can't be mixed with sg_append_buffer() in the same frame.
+
+        All partial updates of a resource in a frame must happen before the
+        resource is bound with sg_apply_bindings() or sg_apply_bindgroup()
+        in that frame, otherwise the validation layer reports an error. On
+        Metal and WebGPU the GPU only executes the frame's draw calls after
+        the updates have been written, so a draw issued before a partial
+        update would already see the updated data.
+
+        Backend-specific notes:
+
+            - GL: consecutive range updates into the same buffer are
+              gathered and uploaded with a single glBufferSubData() call
+            - Metal: since dynamic resources are multi-buffered, the first
+              partial update in a frame copies the current content into the
+              next buffer or texture before the update is applied
+            - D3D11: buffers and images with usage.dynamic_update are created
+              with D3D11_USAGE_DEFAULT and updated via UpdateSubresource()
+              (injected D3D11 resources must also use D3D11_USAGE_DEFAULT
+              for partial updates). This also applies to full updates with
+              sg_update_buffer() and sg_update_image(), which then go through
+              UpdateSubresource() instead of Map(WRITE_DISCARD), and the
+              driver may need to copy the data into a temporary buffer when
+              the GPU still uses the resource. Resources which are only
+              updated as a whole should be created with usage.stream_update,
+              which keeps D3D11_USAGE_DYNAMIC and Map(WRITE_DISCARD).
+
+    --- to (re-)build the mipmap chain of an image on the GPU from the
+        content of its top mip level, call:
+
+            sg_generate_mipmaps(sg_image img)
+
+        The image must have been created with sg_image_desc.generate_mipmaps,
+        see the section 'ON MIPMAP GENERATION' for details.
+
     --- to append a chunk of data to a buffer resource, call:
 
             int sg_append_buffer(sg_buffer buf, const sg_range* data)
@@ -330,6 +419,73 @@ package sokol_gfx
         is associated with one draw call, but will be problematic when
         a single indexed draw call spans several appended chunks of indices.
 
+    --- to read back the content of an image or buffer (for instance for
+        screenshots, automated rendering tests or to get the results of
+        a compute shader), call:
+
+            sg_readback sg_read_image_async(const sg_image_readback_desc* desc)
+            sg_readback sg_read_buffer_async(const sg_buffer_readback_desc* desc)
+
+        Both functions must be called outside a pass, they record a copy
+        operation into the current frame and return immediately with an
+        sg_readback handle. The readback completes a couple of frames later
+        when the GPU has finished the copy, completion is checked in sg_commit(),
+        at which point the data is copied into the memory provided in
+        desc.data and the completion callback is invoked:
+
+            static void readback_done(const sg_readback_result* res) {
+                if (!res->failed) {
+                    // res->data.ptr and res->data.size point to the destination memory
+                    ...
+                }
+            }
+
+            sg_read_image_async(&(sg_image_readback_desc){
+                .image = img,
+                .data = SG_RANGE(pixels),
+                .callback = readback_done,
+                .user_data = ...,
+            });
+
+        The destination memory must remain valid until the callback
+        has been called. Instead of providing a callback you can also poll
+        the readback state with:
+
+            bool sg_query_readback_pending(sg_readback rb)
+
+        ...which returns false when the readback has completed (or failed).
+
+        An image readback reads a rectangle in a single mipmap level and
+        slice described by an sg_image_region struct (by default the entire
+        mipmap level 0 and slice 0), the pixel data is written tightly packed
+        with the same row order as sg_update_image() data. Depth-stencil,
+        compressed and MSAA images can't be read back. A buffer readback
+        reads desc.size bytes (by default the entire buffer) starting at the
+        byte offset desc.offset, both must be a multiple of 4.
+
+        Readbacks which are still pending in sg_shutdown() will be completed
+        with the .failed flag set.
+
+        The maximum number of pending readbacks is defined by
+        sg_desc.readback_pool_size (default: 16).
+
+        Backend-specific notes:
+
+            - GL: images are read with glReadPixels() into a pixel-pack-buffer,
+              buffers are copied with glCopyBufferSubData(), completion is
+              detected with a fence object. On WebGL2 image readbacks are
+              synchronous (but the callback is still deferred to sg_commit())
+              and buffer readbacks are not supported. On GLES3 only RGBA8
+              images are guaranteed to be readable
+            - Metal: the copy happens in a blit command encoder into a
+              shared MTLBuffer, completion is detected via the command
+              buffer status
+            - D3D11: the copy goes into a staging resource which is polled
+              with Map(..., D3D11_MAP_FLAG_DO_NOT_WAIT, ...)
+            - WebGPU: the copy goes into a mappable buffer which is mapped with
+              wgpuBufferMapAsync(), so the WebGPU event loop must be pumped
+              for readbacks to complete
+
     --- to check at runtime for optional features, limits and pixelformat support,
         call:
 
@@ -395,6 +551,23 @@ package sokol_gfx
         to sokol_gfx.h internals, and may change more often than other
         public API functions and structs.
 
+    --- you can inspect the current size, usage and high-water-mark of
+        the resource pools via:
+
+            sg_pool_stats sg_query_pool_stats(void)
+
+        ...this is useful to tune the sg_desc.*_pool_size values, or to
+        check how much growable pools have grown (see sg_desc.growable_pools).
+
+    --- you can query the estimated GPU memory used by buffer and image
+        objects via:
+
+            sg_memory_stats sg_query_memory_stats(void)
+
+        ...and get notified when a memory budget is exceeded by setting
+        sg_desc.memory_budget (see the sg_memory_stats documentation
+        for details).
+
     --- you can query frame stats and control stats collection via:
 
             sg_query_frame_stats()
@@ -402,6 +575,11 @@ package sokol_gfx
             sg_disable_frame_stats()
             sg_frame_stats_enabled()
 
+    --- when GPU timings are enabled via sg_desc.gpu_timings, you can query
+        the GPU time spent in each pass and debug group of a recent frame via:
+
+            sg_gpu_timings sg_query_gpu_timings(void)
+
     --- you can ask at runtime what backend sokol_gfx.h has been compiled for:
 
             sg_backend sg_query_backend(void)
@@ -819,6 +997,123 @@ package sokol_gfx
         - https://floooh.github.io/sokol-webgpu/imageblur-sapp.html
 
 
+    ON INDIRECT DRAWS
+    =================
+    sg_draw_indirect() issues a draw call which reads its arguments (number
+    of elements, number of instances, etc...) from a GPU buffer instead of
+    from function arguments. The typical use case is a compute shader which
+    decides how many instances to render (for instance after frustum culling
+    on the GPU), without a round trip to the CPU.
+
+    Indirect draws are supported where compute passes are supported,
+    check sg_query_features().draw_indirect.
+
+    A buffer which holds indirect draw arguments must be created with
+    `indirect_buffer` usage, and if the arguments are written by a compute
+    shader, also with `storage_buffer` usage:
+
+        sg_buffer args_buf = sg_make_buffer(&(sg_buffer_desc){
+            .usage = {
+                .storage_buffer = true,
+                .indirect_buffer = true,
+            },
+            .size = sizeof(sg_draw_indexed_indirect_args),
+        });
+
+    The buffer content at the byte offset passed to sg_draw_indirect() must
+    have the memory layout of the struct sg_draw_indirect_args for
+    non-indexed rendering, or sg_draw_indexed_indirect_args for indexed
+    rendering (the currently applied pipeline decides which):
+
+        typedef struct sg_draw_indirect_args {
+            uint32_t num_elements;
+            uint32_t num_instances;
+            uint32_t base_element;
+            uint32_t base_instance;     // must be 0
+        } sg_draw_indirect_args;
+
+        typedef struct sg_draw_indexed_indirect_args {
+            uint32_t num_elements;
+            uint32_t num_instances;
+            uint32_t base_element;
+            int32_t base_vertex;
+            uint32_t base_instance;     // must be 0
+        } sg_draw_indexed_indirect_args;
+
+    Inside a render pass, indirect draws work exactly like sg_draw() except
+    for where the arguments come from:
+
+        sg_apply_pipeline(pip);
+        sg_apply_bindings(&bindings);
+        sg_draw_indirect(args_buf, 0);
+
+    NOTE: in the GL backends, the index buffer offset in sg_bindings must
+    be zero for indexed indirect draws, use base_element in the indirect
+    draw arguments instead.
+
+    The header sokol_gpu_cull.h provides a reusable compute stage which
+    frustum-culls instances on the GPU and writes the indirect draw
+    arguments for the following render pass.
+
+
+    ON MIPMAP GENERATION
+    ====================
+    Instead of providing the content of all mip levels in sg_make_image(),
+    an image can be created with the .generate_mipmaps flag, and sokol-gfx
+    will build mip levels 1..N on the GPU by downsampling mip level 0:
+
+        sg_image img = sg_make_image(&(sg_image_desc){
+            .width = 256,
+            .height = 256,
+            .generate_mipmaps = true,
+            .data.subimage[0][0] = SG_RANGE(pixels),
+        });
+
+    If .num_mipmaps is left at zero, the image gets a complete mip chain down
+    to 1x1 pixels (clamped to SG_MAX_MIPMAPS), otherwise only the requested
+    number of mip levels is created.
+
+    Only the top mip level may be provided as initialization data (and in
+    sg_update_image()), the validation layer rejects data for the other mip
+    levels. The mip chain is built automatically:
+
+        - after sg_make_image() with initial data
+        - after each sg_update_image()
+
+    For all other cases (render- and storage-attachment images, or after
+    sg_update_image_region()) call sg_generate_mipmaps() explicitly, for
+    instance after the render pass which rendered into mip level 0 of an
+    offscreen render target:
+
+        sg_begin_pass(&(sg_pass){ .attachments = offscreen_atts, ... });
+        ...
+        sg_end_pass();
+        sg_generate_mipmaps(offscreen_img);
+
+    sg_generate_mipmaps() may be called inside a pass (but not while recording
+    a command list), in that case the mipmap generation is deferred until
+    sg_end_pass() since most 3D APIs can't do it in the middle of a pass.
+
+    Mipmap generation requires a pixel format which is both filterable and
+    renderable (see sg_query_pixelformat()), and it doesn't work with
+    MSAA images, compressed or depth-stencil pixel formats, or injected
+    native textures.
+
+    Backend-specific notes:
+
+        - GL: glGenerateMipmap()
+        - D3D11: the texture is created with D3D11_RESOURCE_MISC_GENERATE_MIPS
+          and the mip chain is built with ID3D11DeviceContext::GenerateMips()
+        - Metal: a blit-encoder generateMipmapsForTexture: call
+        - WebGPU: there is no builtin mipmap generation, sokol-gfx renders
+          each mip level with a downsampling fullscreen-triangle pipeline
+          (not supported for 3D images)
+
+    Note that the mip levels are generated with a simple box filter, if you
+    need higher-quality downsampling, provide all mip levels as image data
+    instead.
+
+
     ON SHADER CREATION
     ==================
     sokol-gfx doesn't come with an integrated shader cross-compiler, instead
@@ -1600,6 +1895,84 @@ package sokol_gfx
     listener item was found and removed, and false otherwise.
 
 
+    COMMAND LISTS
+    =============
+    A command list records a sequence of the following calls into a compact
+    binary command stream, instead of executing them immediately:
+
+        sg_apply_viewport(), sg_apply_viewportf()
+        sg_apply_scissor_rect(), sg_apply_scissor_rectf()
+        sg_apply_pipeline()
+        sg_apply_bindings()
+        sg_apply_bindgroup()
+        sg_apply_uniforms()
+        sg_draw()
+        sg_dispatch()
+
+    The recorded calls are validated at record time, and resource handles
+    are resolved into internal references, so that replaying a command list
+    skips the validation layer and resource lookups. This is useful for
+    static parts of a scene which are rendered the same way each frame, and
+    for recording draw calls on worker threads.
+
+    Command lists are created on the render thread with:
+
+        sg_command_list cl = sg_make_command_list(&(sg_command_list_desc){
+            .buffer_size = 64 * 1024,   // the default
+        });
+
+    ...where .buffer_size is the size of the command stream in bytes. To record
+    into a command list, bracket the calls to be recorded with:
+
+        sg_begin_command_list(cl);
+        sg_apply_pipeline(pip);
+        sg_apply_bindings(&bindings);
+        sg_apply_uniforms(UB_vs_params, &SG_RANGE(vs_params));
+        sg_draw(0, 36, 1);
+        ...
+        sg_end_command_list();
+
+    sg_begin_command_list() discards any previously recorded commands. While a
+    command list is being recorded, the above functions don't access any
+    sokol-gfx state other than the command list and the resource pools, so
+    recording can happen outside a pass, and on any thread (one command list
+    per thread, the recording command list is tracked in a thread-local
+    variable). Note that any validation errors will also be reported on the
+    recording thread.
+
+    Execute a recorded command list inside a render- or compute-pass on
+    the render thread with:
+
+        sg_execute_command_list(cl);
+
+    ...this can happen any number of times, until the command list is recorded
+    again. A command list must either contain only render pipelines and be
+    executed in a render pass, or only compute pipelines and be executed in
+    a compute pass. The first recorded call after sg_begin_command_list()
+    which depends on a pipeline must be preceded by a recorded sg_apply_pipeline()
+    (e.g. the pipeline state of the pass doesn't carry over into the command list),
+    on the other hand the pipeline, bindings and uniforms applied by the last
+    recorded commands remain applied after sg_execute_command_list() returns.
+
+    Please note the following restrictions:
+
+    - while worker threads are recording command lists, the render thread must
+      not call any functions which create, destroy or update resource objects
+    - resource objects referenced by a command list may be updated or
+      destroyed between recording and execution (just as with regular
+      rendering, draw calls with destroyed or invalid resources will be skipped),
+      but a command list doesn't keep referenced resources alive
+    - validation checks which depend on the pass (for instance that an image
+      isn't bound as texture while also being used as pass attachment) are
+      not performed on recorded commands
+    - when a command list runs out of space, an error will be logged and the
+      command list can't be executed until it is recorded again
+    - the frame stats returned by sg_query_frame_stats() are counted when
+      command lists are executed, not when they are recorded
+
+    The number of command list objects is defined by sg_desc.command_list_pool_size
+    (default: 16).
+
     RESOURCE CREATION AND DESTRUCTION IN DETAIL
     ===========================================
     The 'vanilla' way to create resource objects is with the 'make functions':
@@ -1764,6 +2137,40 @@ package sokol_gfx
     an attachments object with invalid image objects.
 
 
+    DUMMY BACKEND STATS
+    ===================
+    The dummy backend doesn't talk to a 3D API, but when frame stats are
+    enabled via sg_enable_frame_stats() it records what a GL-style backend
+    with a state cache would have done into sg_frame_stats.dummy. This allows
+    to run CPU-side benchmarks and state-change regression tests on headless
+    CI machines without a GPU, for instance by rendering a scene for a couple
+    of frames and comparing sg_query_frame_stats() against known values.
+
+    The simulated state cache works like this:
+
+    - sg_apply_pipeline() with the same pipeline as the previous call is
+      counted in .num_skip_redundant_pipeline, otherwise in .num_set_pipeline,
+      and each changed render state group (depth, stencil, blend and
+      rasterizer state) between the old and new pipeline is counted in
+      .num_set_render_state
+    - each vertex buffer, index buffer, image, sampler, storage buffer and
+      storage image bound in sg_apply_bindings() is compared against what is
+      currently bound to the same bind slot (including the buffer offset and the
+      currently active internal buffer of dynamic and stream resources), and
+      counted either in .num_bind_* or .num_skip_redundant_*
+    - sg_begin_pass() sets viewport and scissor rect to the full framebuffer,
+      sg_apply_viewport() and sg_apply_scissor_rect() are only counted in
+      .num_set_viewport/.num_set_scissor_rect when the rectangle changes
+    - uploaded bytes are tracked in .size_upload_buffer and .size_upload_image,
+      this includes initial content provided at resource creation
+    - draws are additionally split into indexed, instanced and indirect draws,
+      and the number of elements and instances are summed up in .num_elements
+      and .num_instances (indirect draws don't contribute to those)
+
+    The cache persists across passes and frames, and is cleared by
+    sg_reset_state_cache().
+
+
     WEBGPU CAVEATS
     ==============
     For a general overview and design notes of the WebGPU backend see:
@@ -1980,14 +2387,23 @@ foreign sokol_gfx_clib {
     make_shader :: proc(#by_ptr desc: Shader_Desc) -> Shader ---
     make_pipeline :: proc(#by_ptr desc: Pipeline_Desc) -> Pipeline ---
     make_attachments :: proc(#by_ptr desc: Attachments_Desc) -> Attachments ---
+    make_bindgroup :: proc(#by_ptr desc: Bindgroup_Desc) -> Bindgroup ---
+    make_command_list :: proc(#by_ptr desc: Command_List_Desc) -> Command_List ---
     destroy_buffer :: proc(buf: Buffer)  ---
     destroy_image :: proc(img: Image)  ---
     destroy_sampler :: proc(smp: Sampler)  ---
     destroy_shader :: proc(shd: Shader)  ---
     destroy_pipeline :: proc(pip: Pipeline)  ---
     destroy_attachments :: proc(atts: Attachments)  ---
+    destroy_bindgroup :: proc(bg: Bindgroup)  ---
+    destroy_command_list :: proc(cl: Command_List)  ---
     update_buffer :: proc(buf: Buffer, #by_ptr data: Range)  ---
     update_image :: proc(img: Image, #by_ptr data: Image_Data)  ---
+    update_buffer_range :: proc(buf: Buffer, offset: c.int, #by_ptr data: Range)  ---
+    update_image_region :: proc(img: Image, #by_ptr region: Image_Region, #by_ptr data: Range)  ---
+    generate_mipmaps :: proc(img: Image)  ---
+    read_image_async :: proc(#by_ptr desc: Image_Readback_Desc) -> Readback ---
+    read_buffer_async :: proc(#by_ptr desc: Buffer_Readback_Desc) -> Readback ---
     append_buffer :: proc(buf: Buffer, #by_ptr data: Range) -> c.int ---
     query_buffer_overflow :: proc(buf: Buffer) -> bool ---
     query_buffer_will_overflow :: proc(buf: Buffer, size: c.size_t) -> bool ---
@@ -1999,11 +2415,17 @@ foreign sokol_gfx_clib {
     apply_scissor_rectf :: proc(x: f32, y: f32, width: f32, height: f32, origin_top_left: bool)  ---
     apply_pipeline :: proc(pip: Pipeline)  ---
     apply_bindings :: proc(#by_ptr bindings: Bindings)  ---
+    apply_bindgroup :: proc(bg: Bindgroup)  ---
     apply_uniforms :: proc(#any_int ub_slot: c.int, #by_ptr data: Range)  ---
     draw :: proc(#any_int base_element: c.int, #any_int num_elements: c.int, #any_int num_instances: c.int)  ---
+    draw_indirect :: proc(buf: Buffer, #any_int offset: c.int)  ---
     dispatch :: proc(#any_int num_groups_x: c.int, #any_int num_groups_y: c.int, #any_int num_groups_z: c.int)  ---
     end_pass :: proc()  ---
     commit :: proc()  ---
+    // command list recording and execution
+    begin_command_list :: proc(cl: Command_List)  ---
+    end_command_list :: proc()  ---
+    execute_command_list :: proc(cl: Command_List)  ---
     // getting information
     query_desc :: proc() -> Desc ---
     query_backend :: proc() -> Backend ---
@@ -2019,6 +2441,10 @@ foreign sokol_gfx_clib {
     query_shader_state :: proc(shd: Shader) -> Resource_State ---
     query_pipeline_state :: proc(pip: Pipeline) -> Resource_State ---
     query_attachments_state :: proc(atts: Attachments) -> Resource_State ---
+    query_bindgroup_state :: proc(bg: Bindgroup) -> Resource_State ---
+    query_command_list_state :: proc(cl: Command_List) -> Resource_State ---
+    // check if an asynchronous readback is still in flight
+    query_readback_pending :: proc(rb: Readback) -> bool ---
     // get runtime information about a resource
     query_buffer_info :: proc(buf: Buffer) -> Buffer_Info ---
     query_image_info :: proc(img: Image) -> Image_Info ---
@@ -2026,6 +2452,10 @@ foreign sokol_gfx_clib {
     query_shader_info :: proc(shd: Shader) -> Shader_Info ---
     query_pipeline_info :: proc(pip: Pipeline) -> Pipeline_Info ---
     query_attachments_info :: proc(atts: Attachments) -> Attachments_Info ---
+    // get size, usage and high-water-mark of the resource pools
+    query_pool_stats :: proc() -> Pool_Stats ---
+    // get the estimated GPU memory used by buffers and images
+    query_memory_stats :: proc() -> Memory_Stats ---
     // get desc structs matching a specific resource (NOTE that not all creation attributes may be provided)
     query_buffer_desc :: proc(buf: Buffer) -> Buffer_Desc ---
     query_image_desc :: proc(img: Image) -> Image_Desc ---
@@ -2087,6 +2517,8 @@ foreign sokol_gfx_clib {
     disable_frame_stats :: proc()  ---
     frame_stats_enabled :: proc() -> bool ---
     query_frame_stats :: proc() -> Frame_Stats ---
+    // GPU timings
+    query_gpu_timings :: proc() -> Gpu_Timings ---
     // D3D11: return ID3D11Device
     d3d11_device :: proc() -> rawptr ---
     // D3D11: return ID3D11DeviceContext
@@ -2199,6 +2631,18 @@ Attachments :: struct {
     id : u32,
 }
 
+Bindgroup :: struct {
+    id : u32,
+}
+
+Command_List :: struct {
+    id : u32,
+}
+
+Readback :: struct {
+    id : u32,
+}
+
 /*
     sg_range is a pointer-size-pair struct used to pass memory blobs into
     sokol-gfx. When initialized from a value type (array or struct), you can
@@ -2214,6 +2658,7 @@ Range :: struct {
 // various compile-time constants in the public API
 INVALID_ID :: 0
 NUM_INFLIGHT_FRAMES :: 2
+MAX_UPDATE_SLOTS :: 3
 MAX_COLOR_ATTACHMENTS :: 4
 MAX_STORAGE_ATTACHMENTS :: 4
 MAX_UNIFORMBLOCK_MEMBERS :: 16
@@ -2226,6 +2671,8 @@ MAX_IMAGE_BINDSLOTS :: 16
 MAX_SAMPLER_BINDSLOTS :: 16
 MAX_STORAGEBUFFER_BINDSLOTS :: 8
 MAX_IMAGE_SAMPLER_PAIRS :: 16
+MAX_GPU_TIMINGS :: 64
+GPU_TIMING_LABEL_SIZE :: 32
 
 /*
     sg_color
@@ -2392,6 +2839,8 @@ Features :: struct {
     compute : bool,
     msaa_image_bindings : bool,
     separate_buffer_types : bool,
+    gpu_timings : bool,
+    draw_indirect : bool,
 }
 
 // Runtime information about resource limits, returned by sg_query_limit()
@@ -3237,6 +3686,117 @@ Bindings :: struct {
     _ : u32,
 }
 
+/*
+    sg_bindgroup_desc
+
+    Creation parameters for sg_bindgroup objects, used in the
+    sg_make_bindgroup() call.
+
+    A bindgroup is an immutable, pre-validated snapshot of an sg_bindings
+    struct. Applying a bindgroup with sg_apply_bindgroup() has the same
+    effect as calling sg_apply_bindings() with the original sg_bindings
+    struct, but the bindings are only validated and resolved into internal
+    resource pointers once in sg_make_bindgroup(), instead of on each
+    sg_apply_bindings() call:
+
+        // at setup time:
+        sg_bindgroup bg = sg_make_bindgroup(&(sg_bindgroup_desc){
+            .pipeline = pip,
+            .bindings = {
+                .vertex_buffers[0] = vbuf,
+                .index_buffer = ibuf,
+                .images[IMG_tex] = img,
+                .samplers[SMP_smp] = smp,
+            },
+        });
+
+        // in the frame loop:
+        sg_apply_pipeline(pip);
+        sg_apply_bindgroup(bg);
+        sg_apply_uniforms(...);
+        sg_draw(...);
+
+    The .pipeline item is required and defines the expected bindings
+    layout (the vertex buffer layout and index type of the pipeline,
+    and the image-, sampler- and storage-buffer bindslots of the pipeline's
+    shader). The bindings are validated against this pipeline exactly
+    like in sg_apply_bindings() (so any validation errors will be reported
+    with the sg_apply_bindings prefix), and any bindings not used by
+    the pipeline are dropped.
+
+    A bindgroup can be applied with any pipeline which uses the same
+    shader object and has a compatible vertex buffer and index buffer
+    layout as the pipeline used to create the bindgroup.
+
+    A bindgroup doesn't own the referenced resources. If a referenced
+    resource is destroyed, or a buffer has overflown after sg_append_buffer(),
+    draw calls after sg_apply_bindgroup() will be silently skipped (and in
+    debug mode a validation error is reported).
+
+    Note that the content of dynamic or stream-update resources can still
+    be updated after the bindgroup has been created.
+
+    The .bindgroup_pool_size item in sg_desc defines the maximum number
+    of bindgroup objects (default: 256).
+*/
+Bindgroup_Desc :: struct {
+    _ : u32,
+    pipeline : Pipeline,
+    bindings : Bindings,
+    label : cstring,
+    _ : u32,
+}
+
+/*
+    sg_command_list_desc
+
+    Creation parameters for sg_command_list objects, used in the
+    sg_make_command_list() call:
+
+    .buffer_size    size of the recorded command stream in bytes (default: 64 KBytes)
+    .label          optional debug label
+
+    See the documentation section 'COMMAND LISTS' at the top of
+    sokol_gfx.h for details.
+*/
+Command_List_Desc :: struct {
+    _ : u32,
+    buffer_size : c.size_t,
+    label : cstring,
+    _ : u32,
+}
+
+/*
+    sg_update_mode
+
+    How the GL and Metal backends avoid CPU/GPU synchronization stalls when
+    the content of a dynamic- or stream-update buffer or image is replaced
+    with sg_update_buffer(), sg_append_buffer() or sg_update_image(). This
+    is used in sg_buffer_desc.update_mode, sg_image_desc.update_mode and
+    as default value for both in sg_desc.update_mode:
+
+    SG_UPDATEMODE_MULTIBUFFER
+        sokol_gfx.h creates .num_update_slots (1..SG_MAX_UPDATE_SLOTS)
+        backend objects per resource and rotates through them on each
+        update, so that the GPU can still read from the previous frame's
+        copy while the CPU writes the next one
+    SG_UPDATEMODE_ORPHAN
+        only a single backend object is created, and each update first
+        orphans the old storage (glBufferData() with a null pointer) so
+        that the GL driver can hand out fresh memory without waiting for
+        the GPU, this saves memory for big streamed buffers
+
+    The default is SG_UPDATEMODE_MULTIBUFFER.
+
+    See the section 'Dynamic resource updates' in the sg_desc documentation
+    for details and backend-specific restrictions.
+*/
+Update_Mode :: enum i32 {
+    DEFAULT,
+    MULTIBUFFER,
+    ORPHAN,
+}
+
 /*
     sg_buffer_usage
 
@@ -3248,6 +3808,9 @@ Bindings :: struct {
         the buffer will bound as index buffer via sg_bindings.index_buffer
     .storage_buffer (default: false)
         the buffer will bound as storage buffer via sg_bindings.storage_buffers[]
+    .indirect_buffer (default: false)
+        the buffer will provide the arguments for sg_draw_indirect() (can be
+        combined with .storage_buffer to write the arguments in a compute shader)
     .immutable (default: true)
         the buffer content will never be updated from the CPU side (but
         may be written to by a compute shader)
@@ -3260,6 +3823,7 @@ Buffer_Usage :: struct {
     vertex_buffer : bool,
     index_buffer : bool,
     storage_buffer : bool,
+    indirect_buffer : bool,
     immutable : bool,
     dynamic_update : bool,
     stream_update : bool,
@@ -3276,6 +3840,8 @@ Buffer_Usage :: struct {
     .usage              .vertex_buffer = true, .immutable = true
     .data.ptr   0       (*must* be valid for immutable buffers without storage buffer usage)
     .data.size  0       (*must* be > 0 for immutable buffers without storage buffer usage)
+    .update_mode        sg_desc.update_mode (only for dynamic- and stream-update buffers)
+    .num_update_slots   sg_desc.num_update_slots (only with SG_UPDATEMODE_MULTIBUFFER)
     .label      0       (optional string label)
 
     For immutable buffers which are initialized with initial data,
@@ -3312,7 +3878,9 @@ Buffer_Usage :: struct {
     3D-API buffer, otherwise you need to provide SG_NUM_INFLIGHT_FRAMES buffers
     (only for GL and Metal, not D3D11). Providing multiple buffers for GL and
     Metal is necessary because sokol_gfx will rotate through them when calling
-    sg_update_buffer() to prevent lock-stalls.
+    sg_update_buffer() to prevent lock-stalls. Injected buffers ignore the
+    sg_desc.update_mode and sg_desc.num_update_slots defaults, and an explicit
+    .num_update_slots must not be greater than SG_NUM_INFLIGHT_FRAMES.
 
     Note that it is expected that immutable injected buffer have already been
     initialized with content, and the .content member must be 0!
@@ -3325,6 +3893,8 @@ Buffer_Desc :: struct {
     size : c.size_t,
     usage : Buffer_Usage,
     data : Range,
+    update_mode : Update_Mode,
+    num_update_slots : c.int,
     label : cstring,
     gl_buffers : [2]u32,
     mtl_buffers : [2]rawptr,
@@ -3333,6 +3903,30 @@ Buffer_Desc :: struct {
     _ : u32,
 }
 
+/*
+    sg_draw_indirect_args
+    sg_draw_indexed_indirect_args
+
+    The memory layout of the draw arguments in a buffer with
+    indirect_buffer usage, read by sg_draw_indirect(). The first
+    struct is used for non-indexed rendering, the second for
+    indexed rendering. The base_instance item must be zero.
+*/
+Draw_Indirect_Args :: struct {
+    num_elements : u32,
+    num_instances : u32,
+    base_element : u32,
+    base_instance : u32,
+}
+
+Draw_Indexed_Indirect_Args :: struct {
+    num_elements : u32,
+    num_instances : u32,
+    base_element : u32,
+    base_vertex : i32,
+    base_instance : u32,
+}
+
 /*
     sg_image_usage
 
@@ -3373,6 +3967,23 @@ Image_Data :: struct {
     subimage : [6][16]Range,
 }
 
+/*
+    sg_image_region
+
+    Describes a rectangular area in a single mipmap level and slice of an
+    image for sg_update_image_region(). The .slice item is the cubemap face
+    index for cubemap images, the layer index for array images, and the
+    depth-slice index (in the given mipmap level) for 3D images.
+*/
+Image_Region :: struct {
+    mip_level : c.int,
+    slice : c.int,
+    x : c.int,
+    y : c.int,
+    width : c.int,
+    height : c.int,
+}
+
 /*
     sg_image_desc
 
@@ -3385,10 +3996,13 @@ Image_Data :: struct {
     .width              0 (must be set to >0)
     .height             0 (must be set to >0)
     .num_slices         1 (3D textures: depth; array textures: number of layers)
-    .num_mipmaps        1
+    .num_mipmaps        1 (or the full mip chain if .generate_mipmaps is true)
+    .generate_mipmaps   false (build mip levels 1..N on the GPU from mip level 0)
     .pixel_format       SG_PIXELFORMAT_RGBA8 for textures, or sg_desc.environment.defaults.color_format for render targets
     .sample_count       1 for textures, or sg_desc.environment.defaults.sample_count for render targets
     .data               an sg_image_data struct to define the initial content
+    .update_mode        sg_desc.update_mode (only for dynamic- and stream-update images)
+    .num_update_slots   sg_desc.num_update_slots (only with SG_UPDATEMODE_MULTIBUFFER)
     .label              0 (optional string label for trace hooks)
 
     Q: Why is the default sample_count for render targets identical with the
@@ -3403,7 +4017,8 @@ Image_Data :: struct {
     NOTE:
 
     Regular (non-attachment) images with usage.immutable must be fully initialized by
-    providing a valid .data member which points to initialization data.
+    providing a valid .data member which points to initialization data
+    (with .generate_mipmaps only the top mip level must be provided).
 
     Images with usage.render_attachment or usage.storage_attachment must
     *not* be created with initial content. Be aware that the initial
@@ -3431,6 +4046,8 @@ Image_Data :: struct {
 
     The same rules apply as for injecting native buffers (see sg_buffer_desc
     documentation for more details).
+
+    See the section 'ON MIPMAP GENERATION' for details about .generate_mipmaps.
 */
 Image_Desc :: struct {
     _ : u32,
@@ -3440,9 +4057,12 @@ Image_Desc :: struct {
     height : c.int,
     num_slices : c.int,
     num_mipmaps : c.int,
+    generate_mipmaps : bool,
     pixel_format : Pixel_Format,
     sample_count : c.int,
     data : Image_Data,
+    update_mode : Update_Mode,
+    num_update_slots : c.int,
     label : cstring,
     gl_textures : [2]u32,
     gl_texture_target : u32,
@@ -3969,6 +4589,58 @@ Attachments_Desc :: struct {
     _ : u32,
 }
 
+/*
+    sg_readback_result
+    sg_image_readback_desc
+    sg_buffer_readback_desc
+
+    Describe an asynchronous image- or buffer-readback operation for
+    sg_read_image_async() and sg_read_buffer_async().
+
+    The .data item points to the destination memory which will be written
+    when the readback has completed, this memory must remain valid until
+    the callback has been called (or sg_query_readback_pending() returns
+    false), and must be big enough to hold the requested data.
+
+    In sg_image_readback_desc, a zero .region.width or .region.height
+    means 'the remaining width or height of the mipmap level starting at
+    .region.x or .region.y'.
+
+    In sg_buffer_readback_desc, a zero .size means 'the remaining buffer
+    size starting at .offset'.
+
+    The optional callback is invoked from inside sg_commit() (or sg_shutdown()
+    for readbacks which didn't complete) with a pointer to an sg_readback_result
+    struct, the .data item is the written part of the destination memory.
+*/
+Readback_Result :: struct {
+    readback : Readback,
+    failed : bool,
+    data : Range,
+    user_data : rawptr,
+}
+
+Image_Readback_Desc :: struct {
+    _ : u32,
+    image : Image,
+    region : Image_Region,
+    data : Range,
+    callback : proc "c" (a0: ^Readback_Result),
+    user_data : rawptr,
+    _ : u32,
+}
+
+Buffer_Readback_Desc :: struct {
+    _ : u32,
+    buffer : Buffer,
+    offset : c.int,
+    size : c.int,
+    data : Range,
+    callback : proc "c" (a0: ^Readback_Result),
+    user_data : rawptr,
+    _ : u32,
+}
+
 /*
     sg_buffer_info
     sg_image_info
@@ -4006,6 +4678,7 @@ Buffer_Info :: struct {
     append_overflow : bool,
     num_slots : c.int,
     active_slot : c.int,
+    num_bytes : u64,
 }
 
 Image_Info :: struct {
@@ -4013,6 +4686,7 @@ Image_Info :: struct {
     upd_frame_index : u32,
     num_slots : c.int,
     active_slot : c.int,
+    num_bytes : u64,
 }
 
 Sampler_Info :: struct {
@@ -4031,6 +4705,114 @@ Attachments_Info :: struct {
     slot : Slot_Info,
 }
 
+/*
+    sg_pool_info
+    sg_pool_stats
+
+    Runtime information about the resource pools, returned by
+    sg_query_pool_stats(). The .high_water_mark item is the maximum
+    number of resource objects which have been alive at the same time
+    since sg_setup(). Pool sizes don't include the reserved slot for the
+    invalid resource id, and may be bigger than the pool sizes provided
+    in sg_desc when sg_desc.growable_pools is true.
+*/
+Pool_Info :: struct {
+    size : c.int,
+    num_used : c.int,
+    high_water_mark : c.int,
+}
+
+Pool_Stats :: struct {
+    buffers : Pool_Info,
+    images : Pool_Info,
+    samplers : Pool_Info,
+    shaders : Pool_Info,
+    pipelines : Pool_Info,
+    attachments : Pool_Info,
+    bindgroups : Pool_Info,
+    command_lists : Pool_Info,
+    readbacks : Pool_Info,
+}
+
+/*
+    sg_memory_info
+    sg_buffer_memory_stats
+    sg_image_memory_stats
+    sg_memory_stats
+
+    The estimated GPU memory used by buffer and image objects, returned by
+    sg_query_memory_stats(). The numbers are tracked in the sokol_gfx.h core
+    when resource objects are created and destroyed, and are computed from
+    the creation parameters, they are not queried from the 3D backend:
+
+    - buffers: the buffer size
+    - images: the sum of all mip levels, faces and slices (with the row
+      pitch of the pixel format), multiplied by the sample count
+    - both are multiplied by the number of backend objects per resource
+      on GL and Metal (see sg_update_mode), D3D11 and WebGPU always
+      use a single backend object
+
+    Backend-internal allocations (like uniform buffers, GL pixel-unpack
+    buffers or driver-side renaming of streamed resources), padding and
+    alignment aren't included, the numbers should be treated as a lower
+    bound. Resource objects with injected backend objects are included,
+    and destroyed resources are only subtracted when their backend objects
+    are actually released (see sg_desc.deferred_destroy).
+
+    Buffers are counted by their update frequency, images with render- or
+    storage-attachment usage are counted in the .render_attachment or
+    .storage_attachment items instead of .immutable. The .total items
+    are the sum of all items in a group.
+
+    Memory budget:
+
+    Set sg_desc.memory_budget.num_bytes to a value > 0 to get notified
+    when the estimated total memory exceeds this budget:
+
+        sg_setup(&(sg_desc){
+            .memory_budget = {
+                .num_bytes = 512 * 1024 * 1024,
+                .exceeded_cb = my_budget_exceeded,
+                .user_data = ...,
+            },
+        });
+
+    The exceeded_cb callback (if provided) and a MEMORY_BUDGET_EXCEEDED
+    warning fire at the end of the sg_make_buffer(), sg_make_image(),
+    sg_init_buffer() or sg_init_image() call which pushed the total above
+    the budget. The callback is only called again after the total has
+    dropped back to or below the budget. It's safe to destroy resources
+    inside the callback (for instance to evict streamed textures).
+*/
+Memory_Info :: struct {
+    num_resources : c.int,
+    num_bytes : u64,
+}
+
+Buffer_Memory_Stats :: struct {
+    immutable : Memory_Info,
+    dynamic_update : Memory_Info,
+    stream_update : Memory_Info,
+    total : Memory_Info,
+}
+
+Image_Memory_Stats :: struct {
+    immutable : Memory_Info,
+    dynamic_update : Memory_Info,
+    stream_update : Memory_Info,
+    render_attachment : Memory_Info,
+    storage_attachment : Memory_Info,
+    total : Memory_Info,
+}
+
+Memory_Stats :: struct {
+    buffers : Buffer_Memory_Stats,
+    images : Image_Memory_Stats,
+    total : Memory_Info,
+    high_water_mark : u64,
+    budget : u64,
+}
+
 /*
     sg_frame_stats
 
@@ -4051,6 +4833,14 @@ Frame_Stats_Gl :: struct {
     num_disable_vertex_attrib_array : u32,
     num_uniform : u32,
     num_memory_barriers : u32,
+    num_bind_vertex_array : u32,
+    num_vao_cache_hits : u32,
+    num_vao_cache_misses : u32,
+    num_pbo_uploads : u32,
+    num_pbo_upload_fallbacks : u32,
+    num_pbo_fence_waits : u32,
+    size_pbo_uploads : u32,
+    num_buffer_orphans : u32,
 }
 
 Frame_Stats_D3d11_Pass :: struct {
@@ -4174,6 +4964,41 @@ Frame_Stats_Wgpu :: struct {
     bindings : Frame_Stats_Wgpu_Bindings,
 }
 
+Frame_Stats_Dummy :: struct {
+    num_set_pipeline : u32,
+    num_skip_redundant_pipeline : u32,
+    num_set_render_state : u32,
+    num_set_viewport : u32,
+    num_skip_redundant_viewport : u32,
+    num_set_scissor_rect : u32,
+    num_skip_redundant_scissor_rect : u32,
+    num_bind_vertex_buffer : u32,
+    num_skip_redundant_vertex_buffer : u32,
+    num_bind_index_buffer : u32,
+    num_skip_redundant_index_buffer : u32,
+    num_bind_image : u32,
+    num_skip_redundant_image : u32,
+    num_bind_sampler : u32,
+    num_skip_redundant_sampler : u32,
+    num_bind_storage_buffer : u32,
+    num_skip_redundant_storage_buffer : u32,
+    num_bind_storage_image : u32,
+    num_skip_redundant_storage_image : u32,
+    num_uniform : u32,
+    size_uniform : u32,
+    num_upload_buffer : u32,
+    size_upload_buffer : u32,
+    num_upload_image : u32,
+    size_upload_image : u32,
+    num_draw : u32,
+    num_draw_indexed : u32,
+    num_draw_instanced : u32,
+    num_draw_indirect : u32,
+    num_dispatch : u32,
+    num_elements : u32,
+    num_instances : u32,
+}
+
 Frame_Stats :: struct {
     frame_index : u32,
     num_passes : u32,
@@ -4182,6 +5007,7 @@ Frame_Stats :: struct {
     num_apply_pipeline : u32,
     num_apply_bindings : u32,
     num_apply_uniforms : u32,
+    num_apply_uniforms_skipped : u32,
     num_draw : u32,
     num_dispatch : u32,
     num_update_buffer : u32,
@@ -4195,6 +5021,42 @@ Frame_Stats :: struct {
     d3d11 : Frame_Stats_D3d11,
     metal : Frame_Stats_Metal,
     wgpu : Frame_Stats_Wgpu,
+    dummy : Frame_Stats_Dummy,
+}
+
+/*
+    sg_gpu_timings
+
+    GPU execution times of the passes and debug groups of a past frame,
+    obtained by calling sg_query_gpu_timings() when GPU timings have been
+    enabled with sg_desc.gpu_timings (currently only supported on the
+    GLCORE backend, check sg_features.gpu_timings).
+
+    Each sg_begin_pass()/sg_end_pass() and sg_push_debug_group()/
+    sg_pop_debug_group() pair records one sg_gpu_timing item, in the order
+    the scopes were opened. The .depth item is the nesting depth of the
+    scope (e.g. a debug group inside a pass has depth 1). Scopes beyond
+    SG_MAX_GPU_TIMINGS per frame are not measured and counted in
+    .num_dropped.
+
+    GPU timer results are collected without stalling the CPU, so the
+    returned timings are typically SG_NUM_INFLIGHT_FRAMES frames old
+    (compare .frame_index with sg_frame_stats.frame_index). The .valid
+    item is false until the first results are available.
+*/
+Gpu_Timing :: struct {
+    label : [32]u8,
+    depth : c.int,
+    duration_ns : u64,
+}
+
+Gpu_Timings :: struct {
+    valid : bool,
+    frame_index : u32,
+    frame_duration_ns : u64,
+    num_timings : c.int,
+    num_dropped : c.int,
+    timings : [64]Gpu_Timing,
 }
 
 Log_Item :: enum i32 {
@@ -4216,6 +5078,9 @@ Log_Item :: enum i32 {
     GL_FRAMEBUFFER_STATUS_UNSUPPORTED,
     GL_FRAMEBUFFER_STATUS_INCOMPLETE_MULTISAMPLE,
     GL_FRAMEBUFFER_STATUS_UNKNOWN,
+    GL_READBACK_FRAMEBUFFER_INCOMPLETE,
+    GL_BUFFER_READBACK_NOT_SUPPORTED,
+    GL_DRAW_INDIRECT_INDEX_BUFFER_OFFSET,
     D3D11_CREATE_BUFFER_FAILED,
     D3D11_CREATE_BUFFER_SRV_FAILED,
     D3D11_CREATE_BUFFER_UAV_FAILED,
@@ -4249,6 +5114,9 @@ Log_Item :: enum i32 {
     D3D11_MAP_FOR_UPDATE_BUFFER_FAILED,
     D3D11_MAP_FOR_APPEND_BUFFER_FAILED,
     D3D11_MAP_FOR_UPDATE_IMAGE_FAILED,
+    D3D11_CREATE_READBACK_STAGING_FAILED,
+    D3D11_MAP_FOR_READBACK_FAILED,
+    D3D11_PARTIAL_UPDATE_REQUIRES_DEFAULT_USAGE,
     METAL_CREATE_BUFFER_FAILED,
     METAL_TEXTURE_FORMAT_NOT_SUPPORTED,
     METAL_CREATE_TEXTURE_FAILED,
@@ -4267,6 +5135,8 @@ Log_Item :: enum i32 {
     METAL_CREATE_RPS_FAILED,
     METAL_CREATE_RPS_OUTPUT,
     METAL_CREATE_DSS_FAILED,
+    METAL_CREATE_READBACK_BUFFER_FAILED,
+    METAL_READBACK_COMMAND_BUFFER_FAILED,
     WGPU_BINDGROUPS_POOL_EXHAUSTED,
     WGPU_BINDGROUPSCACHE_SIZE_GREATER_ONE,
     WGPU_BINDGROUPSCACHE_SIZE_POW2,
@@ -4286,9 +5156,13 @@ Log_Item :: enum i32 {
     WGPU_CREATE_RENDER_PIPELINE_FAILED,
     WGPU_CREATE_COMPUTE_PIPELINE_FAILED,
     WGPU_ATTACHMENTS_CREATE_TEXTURE_VIEW_FAILED,
+    WGPU_CREATE_READBACK_BUFFER_FAILED,
+    WGPU_MAP_READBACK_BUFFER_FAILED,
+    WGPU_GENERATE_MIPMAPS_3D_IMAGE,
     IDENTICAL_COMMIT_LISTENER,
     COMMIT_LISTENER_ARRAY_FULL,
     TRACE_HOOKS_NOT_ENABLED,
+    GPU_TIMINGS_NOT_SUPPORTED,
     DEALLOC_BUFFER_INVALID_STATE,
     DEALLOC_IMAGE_INVALID_STATE,
     DEALLOC_SAMPLER_INVALID_STATE,
@@ -4319,9 +5193,14 @@ Log_Item :: enum i32 {
     SHADER_POOL_EXHAUSTED,
     PIPELINE_POOL_EXHAUSTED,
     PASS_POOL_EXHAUSTED,
+    BINDGROUP_POOL_EXHAUSTED,
+    COMMAND_LIST_POOL_EXHAUSTED,
+    COMMAND_LIST_OVERFLOW,
+    READBACK_POOL_EXHAUSTED,
     BEGINPASS_ATTACHMENT_INVALID,
     APPLY_BINDINGS_STORAGE_BUFFER_TRACKER_EXHAUSTED,
     DRAW_WITHOUT_BINDINGS,
+    MEMORY_BUDGET_EXCEEDED,
     VALIDATE_BUFFERDESC_CANARY,
     VALIDATE_BUFFERDESC_IMMUTABLE_DYNAMIC_STREAM,
     VALIDATE_BUFFERDESC_SEPARATE_BUFFER_TYPES,
@@ -4332,6 +5211,10 @@ Log_Item :: enum i32 {
     VALIDATE_BUFFERDESC_EXPECT_DATA,
     VALIDATE_BUFFERDESC_STORAGEBUFFER_SUPPORTED,
     VALIDATE_BUFFERDESC_STORAGEBUFFER_SIZE_MULTIPLE_4,
+    VALIDATE_BUFFERDESC_INDIRECTBUFFER_SUPPORTED,
+    VALIDATE_BUFFERDESC_INDIRECTBUFFER_SIZE_MULTIPLE_4,
+    VALIDATE_BUFFERDESC_NUM_UPDATE_SLOTS,
+    VALIDATE_BUFFERDESC_INJECTED_NUM_UPDATE_SLOTS,
     VALIDATE_IMAGEDATA_NODATA,
     VALIDATE_IMAGEDATA_DATA_SIZE,
     VALIDATE_IMAGEDESC_CANARY,
@@ -4355,6 +5238,12 @@ Log_Item :: enum i32 {
     VALIDATE_IMAGEDESC_INJECTED_NO_DATA,
     VALIDATE_IMAGEDESC_DYNAMIC_NO_DATA,
     VALIDATE_IMAGEDESC_COMPRESSED_IMMUTABLE,
+    VALIDATE_IMAGEDESC_GENMIPMAPS_PIXELFORMAT,
+    VALIDATE_IMAGEDESC_GENMIPMAPS_MSAA,
+    VALIDATE_IMAGEDESC_GENMIPMAPS_INJECTED,
+    VALIDATE_IMAGEDESC_GENMIPMAPS_MIPDATA,
+    VALIDATE_IMAGEDESC_NUM_UPDATE_SLOTS,
+    VALIDATE_IMAGEDESC_INJECTED_NUM_UPDATE_SLOTS,
     VALIDATE_SAMPLERDESC_CANARY,
     VALIDATE_SAMPLERDESC_ANISTROPIC_REQUIRES_LINEAR_FILTERING,
     VALIDATE_SHADERDESC_CANARY,
@@ -4470,6 +5359,32 @@ Log_Item :: enum i32 {
     VALIDATE_ATTACHMENTSDESC_STORAGE_IMAGE_NO_STORAGEATTACHMENT,
     VALIDATE_ATTACHMENTSDESC_STORAGE_INV_PIXELFORMAT,
     VALIDATE_ATTACHMENTSDESC_RENDER_VS_STORAGE_ATTACHMENTS,
+    VALIDATE_BGDESC_CANARY,
+    VALIDATE_BGDESC_PIPELINE,
+    VALIDATE_BGDESC_PIPELINE_ALIVE,
+    VALIDATE_BGDESC_PIPELINE_VALID,
+    VALIDATE_BGDESC_PIPELINE_SHADER_ALIVE,
+    VALIDATE_BGDESC_PIPELINE_SHADER_VALID,
+    VALIDATE_BGDESC_EMPTY_BINDINGS,
+    VALIDATE_BGDESC_BINDINGS,
+    VALIDATE_CLDESC_CANARY,
+    VALIDATE_BEGINCL_CMDLIST_EXISTS,
+    VALIDATE_BEGINCL_CMDLIST_VALID,
+    VALIDATE_BEGINCL_ALREADY_RECORDING,
+    VALIDATE_BEGINCL_CMDLIST_BUSY,
+    VALIDATE_ENDCL_NOT_RECORDING,
+    VALIDATE_RECCL_NO_PIPELINE,
+    VALIDATE_RECCL_PIPELINE_ALIVE,
+    VALIDATE_RECCL_MIXED_PIPELINES,
+    VALIDATE_RECCL_RENDER_PIPELINE_EXPECTED,
+    VALIDATE_RECCL_COMPUTE_PIPELINE_EXPECTED,
+    VALIDATE_EXECCL_PASS_EXPECTED,
+    VALIDATE_EXECCL_CMDLIST_EXISTS,
+    VALIDATE_EXECCL_CMDLIST_VALID,
+    VALIDATE_EXECCL_RECORDING,
+    VALIDATE_EXECCL_OVERFLOW,
+    VALIDATE_EXECCL_RENDERPASS_EXPECTED,
+    VALIDATE_EXECCL_COMPUTEPASS_EXPECTED,
     VALIDATE_BEGINPASS_CANARY,
     VALIDATE_BEGINPASS_ATTACHMENTS_EXISTS,
     VALIDATE_BEGINPASS_ATTACHMENTS_VALID,
@@ -4575,6 +5490,18 @@ Log_Item :: enum i32 {
     VALIDATE_ABND_IMAGE_BINDING_VS_COLOR_ATTACHMENT,
     VALIDATE_ABND_IMAGE_BINDING_VS_RESOLVE_ATTACHMENT,
     VALIDATE_ABND_IMAGE_BINDING_VS_STORAGE_ATTACHMENT,
+    VALIDATE_ABG_PASS_EXPECTED,
+    VALIDATE_ABG_BINDGROUP_EXISTS,
+    VALIDATE_ABG_BINDGROUP_VALID,
+    VALIDATE_ABG_NO_PIPELINE,
+    VALIDATE_ABG_PIPELINE_ALIVE,
+    VALIDATE_ABG_PIPELINE_VALID,
+    VALIDATE_ABG_SHADER_MISMATCH,
+    VALIDATE_ABG_EXPECTED_VB,
+    VALIDATE_ABG_NO_IB,
+    VALIDATE_ABG_IB,
+    VALIDATE_ABG_RESOURCE_ALIVE,
+    VALIDATE_ABG_BUFFER_OVERFLOW,
     VALIDATE_AU_PASS_EXPECTED,
     VALIDATE_AU_NO_PIPELINE,
     VALIDATE_AU_PIPELINE_ALIVE,
@@ -4588,6 +5515,13 @@ Log_Item :: enum i32 {
     VALIDATE_DRAW_NUMELEMENTS,
     VALIDATE_DRAW_NUMINSTANCES,
     VALIDATE_DRAW_REQUIRED_BINDINGS_OR_UNIFORMS_MISSING,
+    VALIDATE_DRAWINDIRECT_RENDERPASS_EXPECTED,
+    VALIDATE_DRAWINDIRECT_SUPPORTED,
+    VALIDATE_DRAWINDIRECT_BUFFER_ALIVE,
+    VALIDATE_DRAWINDIRECT_BUFFER_TYPE,
+    VALIDATE_DRAWINDIRECT_OFFSET,
+    VALIDATE_DRAWINDIRECT_SIZE,
+    VALIDATE_DRAWINDIRECT_REQUIRED_BINDINGS_OR_UNIFORMS_MISSING,
     VALIDATE_DISPATCH_COMPUTEPASS_EXPECTED,
     VALIDATE_DISPATCH_NUMGROUPSX,
     VALIDATE_DISPATCH_NUMGROUPSY,
@@ -4602,6 +5536,35 @@ Log_Item :: enum i32 {
     VALIDATE_APPENDBUF_UPDATE,
     VALIDATE_UPDIMG_USAGE,
     VALIDATE_UPDIMG_ONCE,
+    VALIDATE_UPDIMG_GENMIPMAPS_MIPDATA,
+    VALIDATE_UPDBUFRANGE_USAGE,
+    VALIDATE_UPDBUFRANGE_ALIGNMENT,
+    VALIDATE_UPDBUFRANGE_SIZE,
+    VALIDATE_UPDBUFRANGE_APPEND,
+    VALIDATE_UPDBUFRANGE_BOUND,
+    VALIDATE_UPDIMGREGION_USAGE,
+    VALIDATE_UPDIMGREGION_COMPRESSED,
+    VALIDATE_UPDIMGREGION_MIPLEVEL,
+    VALIDATE_UPDIMGREGION_SLICE,
+    VALIDATE_UPDIMGREGION_RECT,
+    VALIDATE_UPDIMGREGION_DATA,
+    VALIDATE_UPDIMGREGION_BOUND,
+    VALIDATE_GENMIPMAPS_FLAG,
+    VALIDATE_IMGRBDESC_CANARY,
+    VALIDATE_IMGRB_IN_PASS,
+    VALIDATE_IMGRB_IMAGE,
+    VALIDATE_IMGRB_SAMPLECOUNT,
+    VALIDATE_IMGRB_PIXELFORMAT,
+    VALIDATE_IMGRB_MIPLEVEL,
+    VALIDATE_IMGRB_SLICE,
+    VALIDATE_IMGRB_RECT,
+    VALIDATE_IMGRB_DATA,
+    VALIDATE_BUFRBDESC_CANARY,
+    VALIDATE_BUFRB_IN_PASS,
+    VALIDATE_BUFRB_BUFFER,
+    VALIDATE_BUFRB_ALIGNMENT,
+    VALIDATE_BUFRB_SIZE,
+    VALIDATE_BUFRB_DATA,
     VALIDATION_FAILED,
 }
 
@@ -4619,13 +5582,27 @@ Log_Item :: enum i32 {
     .shader_pool_size               32
     .pipeline_pool_size             64
     .attachments_pool_size          16
+    .bindgroup_pool_size            256
+    .command_list_pool_size         16
+    .readback_pool_size             16
+    .growable_pools                 false
+    .dedup_pipelines                false
+    .dedup_samplers                 false
+    .deferred_destroy               false
+    .dedup_uniforms                 false
+    .gpu_timings                    false
+    .update_mode                    SG_UPDATEMODE_MULTIBUFFER
+    .num_update_slots               SG_NUM_INFLIGHT_FRAMES (2)
     .uniform_buffer_size            4 MB (4*1024*1024)
     .max_dispatch_calls_per_pass    1024
     .max_commit_listeners           1024
     .disable_validation             false
+    .gl_vao_cache_size              0 (disabled)
+    .gl_texture_upload_buffer_size  0 (disabled)
     .mtl_force_managed_storage_mode false
     .wgpu_disable_bindgroups_cache  false
     .wgpu_bindgroups_cache_size     1024
+    .memory_budget.num_bytes        0 (disabled)
 
     .allocator.alloc_fn     0 (in this case, malloc() will be called)
     .allocator.free_fn      0 (in this case, free() will be called)
@@ -4638,6 +5615,142 @@ Log_Item :: enum i32 {
     .environment.defaults.depth_format: SG_PIXELFORMAT_DEPTH_STENCIL
     .environment.defaults.sample_count: 1
 
+    Resource pools:
+        .growable_pools
+            By default, the resource pools are allocated once in sg_setup()
+            with the sizes provided in the *_pool_size items, and creating
+            a resource object fails with a POOL_EXHAUSTED log message when
+            its pool is full. When .growable_pools is true, an exhausted pool
+            instead grows by its initial size (up to a maximum of 65535
+            resource objects per pool). Growing a pool doesn't invalidate
+            existing resource handles, but the initial pool sizes should
+            still be picked so that growing the pools is a rare event (call
+            sg_query_pool_stats() to inspect the pool high-water-marks).
+        .dedup_pipelines
+        .dedup_samplers
+            When true, sg_make_pipeline() or sg_make_sampler() first look
+            for an existing object created from an identical desc struct
+            (after default values have been patched in, ignoring the .label
+            item) and return its handle instead of creating a new object.
+            Deduplicated objects are reference counted, each call to
+            sg_make_pipeline() or sg_make_sampler() must be balanced with a
+            call to sg_destroy_pipeline() or sg_destroy_sampler(), and the
+            object is only destroyed when the last reference is dropped
+            (calling sg_uninit_pipeline() or sg_uninit_sampler() on a
+            deduplicated object ignores the reference count though). This
+            allows libraries like sokol_gl.h and sokol_debugtext.h to share
+            identical pipeline and sampler objects. Samplers with injected
+            backend objects are never deduplicated, and the separate
+            alloc/init functions bypass the cache.
+
+    Resource destruction:
+        .deferred_destroy
+            By default, the sg_destroy_*() and sg_uninit_*() functions
+            immediately release the backend objects owned by a resource
+            (e.g. with glDeleteBuffers() in the GL backend), which may cause
+            stalls when the GPU is still using the resource, and invalidates
+            the backend's state cache in the middle of a frame. When
+            .deferred_destroy is true, the resource handle becomes invalid
+            immediately, but the backend objects are put into a queue and
+            released together in sg_commit() SG_NUM_INFLIGHT_FRAMES frames
+            later. This helps to smooth frame times when destroying many
+            resources at once (e.g. when unloading a level). Bindgroups,
+            command lists and readbacks don't own backend objects and are
+            not affected.
+
+    Uniform data:
+        .dedup_uniforms
+            When true, sokol_gfx.h keeps a copy and a hash of the uniform
+            data last applied to each uniform block slot, and
+            sg_apply_uniforms() skips the backend upload when the size, hash
+            and content of the new data match (the hash only serves as a
+            quick pre-check before comparing the bytes). The cache is reset
+            by sg_begin_pass(), sg_apply_pipeline() and
+            sg_reset_state_cache(), so only redundant calls between two
+            pipeline changes are skipped (e.g. a camera or material block
+            which is re-applied for each draw call). This trades the cost of
+            hashing and comparing the uniform data against the cost of the
+            backend upload
+            (and uniform buffer space in the Metal, D3D11 and WebGPU
+            backends). Check the .num_apply_uniforms_skipped item returned
+            by sg_query_frame_stats() to see whether it pays off.
+
+    Dynamic resource updates:
+        .update_mode
+        .num_update_slots
+            The defaults for the same-named sg_buffer_desc and sg_image_desc
+            items of dynamic- and stream-update resources (immutable
+            resources always have a single backend object). With the
+            default SG_UPDATEMODE_MULTIBUFFER, the GL and Metal backends
+            create .num_update_slots copies of each backend object and
+            rotate through them on each sg_update_*() call. Two copies match
+            the number of frames in flight (SG_NUM_INFLIGHT_FRAMES), a third
+            copy can avoid stalls when the GPU runs behind, and a single
+            copy leaves the synchronization to the GL driver (which may then
+            stall in glBufferSubData()). With SG_UPDATEMODE_ORPHAN the GL
+            backend only creates a single buffer and calls glBufferData()
+            with a null pointer before each full update (and before the
+            first sg_append_buffer() call in a frame), which allows the
+            driver to allocate fresh storage while the GPU is still reading
+            from the old one. This halves the memory footprint of big
+            streamed buffers without introducing stalls, the number of
+            orphaning calls is counted in the .gl.num_buffer_orphans item
+            returned by sg_query_frame_stats().
+            Backend-specific notes:
+                - GL textures are created with immutable storage and can't
+                  be orphaned, SG_UPDATEMODE_ORPHAN images use a single
+                  texture which is updated with glTexSubImage*() (combine
+                  this with .gl_texture_upload_buffer_size to keep the
+                  upload asynchronous)
+                - the Metal backend writes directly into its buffers and
+                  textures and always uses at least SG_NUM_INFLIGHT_FRAMES
+                  copies, SG_UPDATEMODE_ORPHAN behaves like the default
+                - D3D11 and WebGPU use a single backend object and let the
+                  driver handle renaming (D3D11_MAP_WRITE_DISCARD is the
+                  D3D11 equivalent of orphaning), the update mode is ignored
+
+    GPU timings:
+        .gpu_timings
+            When true, sokol_gfx.h measures the GPU execution time of each
+            render pass and debug group with timestamp queries, and the
+            results can be obtained a few frames later with
+            sg_query_gpu_timings(). The queries are ring-buffered over
+            several frames and results which aren't available yet are never
+            waited for, so that measuring doesn't stall the CPU. This is
+            currently only implemented in the GLCORE backend (GL 3.3 or
+            later), check sg_features.gpu_timings at runtime.
+
+    GL specific:
+        .gl_vao_cache_size
+            When this is > 0, the GL backend keeps a cache of up to this many
+            vertex array objects, keyed by the pipeline object, the vertex
+            buffers, vertex buffer offsets and the index buffer passed into
+            sg_apply_bindings(). On a cache hit, sg_apply_bindings() only
+            needs a single glBindVertexArray() call instead of updating
+            the vertex attribute state of a single shared VAO. When the cache
+            is full, the least recently used VAO is discarded. Check the
+            .gl.num_vao_cache_hits and .gl.num_vao_cache_misses items returned
+            by sg_query_frame_stats() to tune the cache size (a good starting
+            point is the number of different meshes rendered per frame).
+            Please note that the cache is keyed by the GL buffer names, so
+            that streaming buffers which are updated each frame will cycle
+            through multiple cache entries. The cache is disabled by default.
+        .gl_texture_upload_buffer_size
+            When this is > 0, the GL backend creates a ring of pixel-unpack
+            buffers of this size (in bytes, one per frame-in-flight plus one),
+            and sg_update_image() and sg_update_image_region() copy the pixel
+            data into the current frame's buffer instead of handing a client
+            memory pointer to glTexSubImage*(). This allows the GL driver to
+            perform the actual texture upload asynchronously instead of
+            stalling the render thread, which helps with video playback or
+            streamed texture pages. The buffer size should be big enough to
+            hold all image updates of a single frame, updates which don't fit
+            fall back to the regular (synchronous) upload path. Check the
+            .gl.num_pbo_uploads, .gl.num_pbo_upload_fallbacks and
+            .gl.num_pbo_fence_waits items returned by sg_query_frame_stats()
+            to tune the buffer size. Not supported on WebGL2, where this
+            item is ignored.
+
     Metal specific:
         (NOTE: All Objective-C object references are transferred through
         a bridged cast (__bridge const void*) to sokol_gfx, which will use an
@@ -4749,6 +5862,19 @@ Allocator :: struct {
     user_data : rawptr,
 }
 
+/*
+    sg_memory_budget
+
+    Used in sg_desc to provide an optional GPU memory budget for buffer and
+    image objects, and a callback which is called when the budget is
+    exceeded. See the sg_memory_stats documentation for details.
+*/
+Memory_Budget :: struct {
+    num_bytes : u64,
+    exceeded_cb : proc "c" (a0: ^Memory_Stats, a1: rawptr),
+    user_data : rawptr,
+}
+
 /*
     sg_logger
 
@@ -4781,15 +5907,29 @@ Desc :: struct {
     shader_pool_size : c.int,
     pipeline_pool_size : c.int,
     attachments_pool_size : c.int,
+    bindgroup_pool_size : c.int,
+    command_list_pool_size : c.int,
+    readback_pool_size : c.int,
+    growable_pools : bool,
+    dedup_pipelines : bool,
+    dedup_samplers : bool,
+    deferred_destroy : bool,
+    dedup_uniforms : bool,
+    gpu_timings : bool,
+    update_mode : Update_Mode,
+    num_update_slots : c.int,
     uniform_buffer_size : c.int,
     max_dispatch_calls_per_pass : c.int,
     max_commit_listeners : c.int,
     disable_validation : bool,
+    gl_vao_cache_size : c.int,
+    gl_texture_upload_buffer_size : c.int,
     d3d11_shader_debugging : bool,
     mtl_force_managed_storage_mode : bool,
     mtl_use_command_buffer_with_retained_references : bool,
     wgpu_disable_bindgroups_cache : bool,
     wgpu_bindgroups_cache_size : c.int,
+    memory_budget : Memory_Budget,
     allocator : Allocator,
     logger : Logger,
     environment : Environment,
@@ -4836,12 +5976,12 @@ D3d11_Attachments_Info :: struct {
 }
 
 Mtl_Buffer_Info :: struct {
-    buf : [2]rawptr,
+    buf : [3]rawptr,
     active_slot : c.int,
 }
 
 Mtl_Image_Info :: struct {
-    tex : [2]rawptr,
+    tex : [3]rawptr,
     active_slot : c.int,
 }
 
@@ -4892,12 +6032,12 @@ Wgpu_Attachments_Info :: struct {
 }
 
 Gl_Buffer_Info :: struct {
-    buf : [2]u32,
+    buf : [3]u32,
     active_slot : c.int,
 }
 
 Gl_Image_Info :: struct {
-    tex : [2]u32,
+    tex : [3]u32,
     tex_target : u32,
     msaa_render_buffer : u32,
     active_slot : c.int,
@@ -0,0 +1,368 @@
+// machine generated, do not edit
+
+package sokol_gfx_trace
+
+/*
+
+    sokol_gfx_trace.h -- capture and replay sokol_gfx.h call streams
+
+    Project URL: https://github.com/Ed94/SectrPrototype (Sectr fork of sokol-odin)
+
+    This header is an addition of the Sectr fork and is not part of the upstream
+    sokol headers (https://github.com/floooh/sokol), it follows their API conventions.
+
+    Do this:
+        #define SOKOL_IMPL or
+        #define SOKOL_GFX_TRACE_IMPL
+    before you include this file in *one* C or C++ file to create the
+    implementation.
+
+    sokol_gfx.h must be compiled with SOKOL_TRACE_HOOKS defined, otherwise
+    no calls will be captured.
+
+    Optionally provide the following defines with your own implementations:
+
+    SOKOL_ASSERT(c)             - your own assert macro (default: assert(c))
+    SOKOL_UNREACHABLE()         - a guard macro for unreachable code (default: assert(false))
+    SOKOL_GFX_TRACE_API_DECL    - public function declaration prefix (default: extern)
+    SOKOL_API_DECL              - same as SOKOL_GFX_TRACE_API_DECL
+    SOKOL_API_IMPL              - public function implementation prefix (default: -)
+
+    If sokol_gfx_trace.h is compiled as a DLL, define the following before
+    including the declaration or implementation:
+
+    SOKOL_DLL
+
+    On Windows, SOKOL_DLL will define SOKOL_GFX_TRACE_API_DECL as __declspec(dllexport)
+    or __declspec(dllimport) as needed.
+
+    Include the following headers before including sokol_gfx_trace.h:
+
+        sokol_gfx.h
+
+    FEATURES AND CONCEPTS
+    =====================
+    - captures the complete sokol_gfx.h call stream of one or more frames
+      (including all uploaded data) into a compact binary blob via the
+      sokol_gfx.h trace hooks
+    - the blob also contains the creation parameters of all resources
+      which are alive when the capture starts, so a capture is self-contained
+    - replays a captured blob on any sokol_gfx.h backend (including the
+      dummy backend) for reproducible performance measurements of
+      real-world frames without the original application
+
+    STEP BY STEP: CAPTURING
+    =======================
+    --- call sgtrace_setup() right after sg_setup(), so that the creation
+        of all resources is observed:
+
+            sg_setup(&(sg_desc){ ... });
+            sgtrace_setup(&(sgtrace_desc_t){ .logger.func = slog_func });
+
+        sokol_gfx_trace.h installs its own trace hooks and calls any
+        previously installed trace hooks.
+
+        NOTE: to be able to put live resources into a capture,
+        sokol_gfx_trace.h keeps a copy of the creation parameters of each
+        live resource (including the initial content of immutable buffers
+        and images) until the resource is destroyed.
+
+    --- to capture one or more frames, call:
+
+            sgtrace_begin_capture(num_frames);
+
+        The capture starts right after the next sg_commit() and ends
+        after num_frames calls to sg_commit().
+
+    --- check when the capture is complete and get the captured data:
+
+            if (sgtrace_capture_ready()) {
+                const sgtrace_range data = sgtrace_get_capture();
+                // ...write data.ptr/data.size to a file...
+            }
+
+        The captured data remains valid until the next call to
+        sgtrace_begin_capture() or sgtrace_shutdown().
+
+        If the capture data grows beyond sgtrace_desc_t.max_capture_size,
+        the capture is cancelled with a CAPTURE_BUFFER_FULL error.
+
+    --- call sgtrace_shutdown() before sg_shutdown():
+
+            sgtrace_shutdown();
+            sg_shutdown();
+
+    STEP BY STEP: REPLAYING
+    =======================
+    --- replaying doesn't require sgtrace_setup() to be called, first
+        start the replay with the captured data (the data is copied):
+
+            if (!sgtrace_begin_replay(data)) {
+                // not a valid capture, or captured with a different
+                // version of sokol_gfx.h (see log output)
+            }
+
+        This creates all resources which were alive when the capture started.
+
+    --- in each frame, replay the next captured frame, followed by
+        the usual sg_commit():
+
+            sgtrace_replay_frame(sglue_swapchain());
+            sg_commit();
+
+        All captured sokol_gfx.h calls up to (but not including) the captured
+        sg_commit() call are replayed, swapchain render passes render into
+        the provided swapchain. After the last captured frame, the replay
+        rewinds to the first frame: resources created in the captured
+        frames are destroyed, and resources which were destroyed in the
+        captured frames are created again.
+
+        To get the total number of captured frames call:
+
+            int num_frames = sgtrace_replay_num_frames();
+
+    --- finally stop the replay, this destroys all replay resources:
+
+            sgtrace_end_replay();
+
+    LIMITATIONS
+    ===========
+    - the capture format depends on the sokol_gfx.h version and the
+      CPU architecture (it contains raw sokol_gfx.h desc structs), captures
+      must be replayed with the same version of sokol_gfx.h
+    - the content of dynamic and stream-update resources at the start of
+      the capture isn't captured (only updates inside captured frames)
+    - injected native 3D-API resources are not captured
+    - the content of command lists isn't visible to trace hooks, so
+      sg_execute_command_list() calls are skipped in the replay
+    - sg_read_image_async() and sg_read_buffer_async() are not captured
+
+    ERROR REPORTING AND LOGGING
+    ===========================
+    To get any logging information at all you need to provide a logging callback in the setup call,
+    the easiest way is to use sokol_log.h:
+
+        #include "sokol_log.h"
+
+        sgtrace_setup(&(sgtrace_desc_t){
+            // ...
+            .logger.func = slog_func
+        });
+
+    NOTE that replaying doesn't require sgtrace_setup(), in this case
+    errors are reported through the logger passed into sgtrace_begin_replay()
+    via sgtrace_replay_desc_t.
+
+    MEMORY ALLOCATION OVERRIDE
+    ==========================
+    You can override the memory allocation functions at initialization time
+    like this:
+
+        void* my_alloc(size_t size, void* user_data) {
+            return malloc(size);
+        }
+
+        void my_free(void* ptr, void* user_data) {
+            free(ptr);
+        }
+
+        ...
+            sgtrace_setup(&(sgtrace_desc_t){
+                // ...
+                .allocator = {
+                    .alloc_fn = my_alloc,
+                    .free_fn = my_free,
+                    .user_data = ...;
+                }
+            });
+        ...
+
+    If no overrides are provided, malloc and free will be used.
+
+    LICENSE
+    =======
+    zlib/libpng license
+
+    Copyright (c) 2026 the Sectr fork contributors
+
+    This software is provided 'as-is', without any express or implied warranty.
+    In no event will the authors be held liable for any damages arising from the
+    use of this software.
+
+    Permission is granted to anyone to use this software for any purpose,
+    including commercial applications, and to alter it and redistribute it
+    freely, subject to the following restrictions:
+
+        1. The origin of this software must not be misrepresented; you must not
+        claim that you wrote the original software. If you use this software in a
+        product, an acknowledgment in the product documentation would be
+        appreciated but is not required.
+
+        2. Altered source versions must be plainly marked as such, and must not
+        be misrepresented as being the original software.
+
+        3. This notice may not be removed or altered from any source
+        distribution.
+*/
+import sg "../gfx"
+
+import "core:c"
+
+_ :: c
+
+SOKOL_DEBUG :: #config(SOKOL_DEBUG, ODIN_DEBUG)
+
+DEBUG :: #config(SOKOL_GFX_TRACE_DEBUG, SOKOL_DEBUG)
+USE_GL :: #config(SOKOL_USE_GL, false)
+USE_DLL :: #config(SOKOL_DLL, true)
+
+when ODIN_OS == .Windows {
+    when USE_DLL {
+        when USE_GL {
+            when DEBUG { foreign import sokol_gfx_trace_clib { "../sokol_dll_windows_x64_gl_debug.lib" } }
+            else       { foreign import sokol_gfx_trace_clib { "../sokol_dll_windows_x64_gl_release.lib" } }
+        } else {
+            when DEBUG { foreign import sokol_gfx_trace_clib { "../sokol_dll_windows_x64_d3d11_debug.lib" } }
+            else       { foreign import sokol_gfx_trace_clib { "../sokol_dll_windows_x64_d3d11_release.lib" } }
+        }
+    } else {
+        when USE_GL {
+            when DEBUG { foreign import sokol_gfx_trace_clib { "sokol_gfx_trace_windows_x64_gl_debug.lib" } }
+            else       { foreign import sokol_gfx_trace_clib { "sokol_gfx_trace_windows_x64_gl_release.lib" } }
+        } else {
+            when DEBUG { foreign import sokol_gfx_trace_clib { "sokol_gfx_trace_windows_x64_d3d11_debug.lib" } }
+            else       { foreign import sokol_gfx_trace_clib { "sokol_gfx_trace_windows_x64_d3d11_release.lib" } }
+        }
+    }
+} else when ODIN_OS == .Darwin {
+    when USE_DLL {
+             when  USE_GL && ODIN_ARCH == .arm64 &&  DEBUG { foreign import sokol_gfx_trace_clib { "../dylib/sokol_dylib_macos_arm64_gl_debug.dylib" } }
+        else when  USE_GL && ODIN_ARCH == .arm64 && !DEBUG { foreign import sokol_gfx_trace_clib { "../dylib/sokol_dylib_macos_arm64_gl_release.dylib" } }
+        else when  USE_GL && ODIN_ARCH == .amd64 &&  DEBUG { foreign import sokol_gfx_trace_clib { "../dylib/sokol_dylib_macos_x64_gl_debug.dylib" } }
+        else when  USE_GL && ODIN_ARCH == .amd64 && !DEBUG { foreign import sokol_gfx_trace_clib { "../dylib/sokol_dylib_macos_x64_gl_release.dylib" } }
+        else when !USE_GL && ODIN_ARCH == .arm64 &&  DEBUG { foreign import sokol_gfx_trace_clib { "../dylib/sokol_dylib_macos_arm64_metal_debug.dylib" } }
+        else when !USE_GL && ODIN_ARCH == .arm64 && !DEBUG { foreign import sokol_gfx_trace_clib { "../dylib/sokol_dylib_macos_arm64_metal_release.dylib" } }
+        else when !USE_GL && ODIN_ARCH == .amd64 &&  DEBUG { foreign import sokol_gfx_trace_clib { "../dylib/sokol_dylib_macos_x64_metal_debug.dylib" } }
+        else when !USE_GL && ODIN_ARCH == .amd64 && !DEBUG { foreign import sokol_gfx_trace_clib { "../dylib/sokol_dylib_macos_x64_metal_release.dylib" } }
+    } else {
+        when USE_GL {
+            when ODIN_ARCH == .arm64 {
+                when DEBUG { foreign import sokol_gfx_trace_clib { "sokol_gfx_trace_macos_arm64_gl_debug.a" } }
+                else       { foreign import sokol_gfx_trace_clib { "sokol_gfx_trace_macos_arm64_gl_release.a" } }
+            } else {
+                when DEBUG { foreign import sokol_gfx_trace_clib { "sokol_gfx_trace_macos_x64_gl_debug.a" } }
+                else       { foreign import sokol_gfx_trace_clib { "sokol_gfx_trace_macos_x64_gl_release.a" } }
+            }
+        } else {
+            when ODIN_ARCH == .arm64 {
+                when DEBUG { foreign import sokol_gfx_trace_clib { "sokol_gfx_trace_macos_arm64_metal_debug.a" } }
+                else       { foreign import sokol_gfx_trace_clib { "sokol_gfx_trace_macos_arm64_metal_release.a" } }
+            } else {
+                when DEBUG { foreign import sokol_gfx_trace_clib { "sokol_gfx_trace_macos_x64_metal_debug.a" } }
+                else       { foreign import sokol_gfx_trace_clib { "sokol_gfx_trace_macos_x64_metal_release.a" } }
+            }
+        }
+    }
+} else when ODIN_OS == .Linux {
+    when USE_DLL {
+        when DEBUG { foreign import sokol_gfx_trace_clib { "sokol_gfx_trace_linux_x64_gl_debug.so" } }
+        else       { foreign import sokol_gfx_trace_clib { "sokol_gfx_trace_linux_x64_gl_release.so" } }
+    } else {
+        when DEBUG { foreign import sokol_gfx_trace_clib { "sokol_gfx_trace_linux_x64_gl_debug.a" } }
+        else       { foreign import sokol_gfx_trace_clib { "sokol_gfx_trace_linux_x64_gl_release.a" } }
+    }
+} else when ODIN_ARCH == .wasm32 || ODIN_ARCH == .wasm64p32 {
+    // Feed sokol_gfx_trace_wasm_gl_debug.a or sokol_gfx_trace_wasm_gl_release.a into emscripten compiler.
+    foreign import sokol_gfx_trace_clib { "env.o" }
+} else {
+    #panic("This OS is currently not supported")
+}
+
+@(default_calling_convention="c", link_prefix="sgtrace_")
+foreign sokol_gfx_trace_clib {
+    // capture setup and shutdown
+    setup :: proc(#by_ptr desc: Desc)  ---
+    shutdown :: proc()  ---
+    // capturing
+    begin_capture :: proc(#any_int num_frames: c.int)  ---
+    capture_active :: proc() -> bool ---
+    capture_ready :: proc() -> bool ---
+    get_capture :: proc() -> Range ---
+    // replaying
+    begin_replay :: proc(#by_ptr desc: Replay_Desc) -> bool ---
+    replay_num_frames :: proc() -> c.int ---
+    replay_frame_index :: proc() -> c.int ---
+    replay_frame :: proc(swapchain: sg.Swapchain)  ---
+    end_replay :: proc()  ---
+}
+
+Log_Item :: enum i32 {
+    OK,
+    MALLOC_FAILED,
+    CAPTURE_ALREADY_ACTIVE,
+    CAPTURE_BUFFER_FULL,
+    REPLAY_ALREADY_ACTIVE,
+    REPLAY_INVALID_DATA,
+    REPLAY_VERSION_MISMATCH,
+    REPLAY_ABI_MISMATCH,
+    REPLAY_CORRUPT_DATA,
+    REPLAY_COMMAND_LIST_SKIPPED,
+}
+
+/*
+    sgtrace_logger_t
+
+    Used in sgtrace_desc_t and sgtrace_replay_desc_t to provide a custom
+    logging and error reporting callback to sokol-gfx-trace.
+*/
+Logger :: struct {
+    func : proc "c" (a0: cstring, a1: u32, a2: u32, a3: cstring, a4: u32, a5: cstring, a6: rawptr),
+    user_data : rawptr,
+}
+
+/*
+    sgtrace_allocator_t
+
+    Used in sgtrace_desc_t and sgtrace_replay_desc_t to provide custom
+    memory-alloc and -free functions to sokol_gfx_trace.h. If memory
+    management should be overridden, both the alloc_fn and free_fn function
+    must be provided (e.g. it's not valid to override one function but not
+    the other).
+*/
+Allocator :: struct {
+    alloc_fn : proc "c" (a0: c.size_t, a1: rawptr) -> rawptr,
+    free_fn : proc "c" (a0: rawptr, a1: rawptr),
+    user_data : rawptr,
+}
+
+/*
+    sgtrace_range is a pointer-size-pair struct used to pass captured
+    data in and out of sokol-gfx-trace.
+*/
+Range :: struct {
+    ptr : rawptr,
+    size : c.size_t,
+}
+
+/*
+    sgtrace_desc_t
+
+    Describes the capture setup parameters, passed to sgtrace_setup().
+*/
+Desc :: struct {
+    max_capture_size : c.size_t,
+    allocator : Allocator,
+    logger : Logger,
+}
+
+/*
+    sgtrace_replay_desc_t
+
+    Describes the replay parameters, passed to sgtrace_begin_replay().
+*/
+Replay_Desc :: struct {
+    data : Range,
+    allocator : Allocator,
+    logger : Logger,
+}
+
@@ -507,6 +507,58 @@ package sokol_gl
     calls which require a currently active context will silently fail,
     and sgl_error() will return SGL_ERROR_NO_CONTEXT.
 
+    RECORDING ON WORKER THREADS:
+    ============================
+    The currently active context is global state, so normally all sokol-gl
+    recording for one context must happen on the same thread. To record
+    sokol-gl commands on worker threads (for instance debug visualization
+    running on job threads), create one 'record-only' context per worker
+    thread on the render thread:
+
+        sgl_context rec_ctx = sgl_make_context(&(sgl_context_desc_t){
+            .record_only = true,
+            .max_vertices = ...,
+            .max_commands = ...,
+        });
+
+    A record-only context doesn't own a sokol-gfx vertex buffer and isn't
+    rewound in sg_commit(), it can't be drawn directly, only 'spliced' into
+    a regular context.
+
+    On the worker thread, bind the record-only context as thread-local
+    current context and record as usual:
+
+        sgl_set_thread_context(rec_ctx);
+        sgl_begin_lines();
+        ...
+        sgl_end();
+        sgl_set_thread_context((sgl_context){ SG_INVALID_ID });
+
+    While a thread-local context is bound it takes precedence over the
+    global context set with sgl_set_context(), but only on the calling
+    thread. Binding and recording don't take any locks.
+
+    After the worker has finished recording (synchronization is up to
+    the job system), append the recorded vertices and commands to a
+    regular context on the render thread before drawing it:
+
+        sgl_context_splice(sgl_default_context(), rec_ctx);
+        ...
+        sgl_context_draw(sgl_default_context());
+
+    sgl_context_splice() copies the recorded vertices, uniforms and
+    commands (including layer ids) to the end of the destination context
+    and rewinds the source context for the next frame. Draw commands
+    which use the record-only context's default pipeline are redirected
+    to the destination context's default pipeline, so the pixel formats
+    of a record-only context don't matter unless it is used to create
+    custom pipelines. If the destination runs out of space the
+    destination's error flags are set, just like when recording directly.
+
+    Creating, destroying and splicing contexts, as well as creating
+    pipelines, must still happen on the render thread, and a record-only
+    context must not be spliced while a worker thread is recording into it.
+
     UNDER THE HOOD:
     ===============
     sokol_gl.h works by recording vertex data and rendering commands into
@@ -784,6 +836,8 @@ foreign sokol_gl_clib {
     set_context :: proc(ctx: Context)  ---
     get_context :: proc() -> Context ---
     default_context :: proc() -> Context ---
+    set_thread_context :: proc(ctx: Context)  ---
+    context_splice :: proc(dst: Context, src: Context)  ---
     // get information about recorded vertices and commands in current context
     num_vertices :: proc() -> c.int ---
     num_commands :: proc() -> c.int ---
@@ -879,6 +933,7 @@ Log_Item :: enum i32 {
     ADD_COMMIT_LISTENER_FAILED,
     CONTEXT_POOL_EXHAUSTED,
     CANNOT_DESTROY_DEFAULT_CONTEXT,
+    CANNOT_DRAW_RECORD_ONLY_CONTEXT,
 }
 
 /*
@@ -931,6 +986,7 @@ Context_Desc :: struct {
     color_format : sg.Pixel_Format,
     depth_format : sg.Pixel_Format,
     sample_count : c.int,
+    record_only : bool,
 }
 
 /*
@@ -0,0 +1,313 @@
+// machine generated, do not edit
+
+package sokol_gpu_cull
+
+/*
+    sokol_gpu_cull.h -- frustum-cull instances in a compute shader and write indirect draw arguments
+
+    Project URL: https://github.com/Ed94/SectrPrototype (Sectr fork of sokol-odin)
+
+    This header is an addition of the Sectr fork and is not part of the upstream
+    sokol headers (https://github.com/floooh/sokol), it follows their API conventions.
+
+    Do this:
+        #define SOKOL_IMPL or
+        #define SOKOL_GPU_CULL_IMPL
+    before you include this file in *one* C or C++ file to create the
+    implementation.
+
+    The following defines are used by the implementation to select the
+    platform-specific embedded shader code (these are the same defines as
+    used by sokol_gfx.h and sokol_app.h):
+
+    SOKOL_GLCORE
+    SOKOL_GLES3
+    SOKOL_D3D11
+    SOKOL_METAL
+    SOKOL_WGPU
+    SOKOL_DUMMY_BACKEND
+
+    Optionally provide the following defines with your own implementations:
+
+    SOKOL_ASSERT(c)             - your own assert macro (default: assert(c))
+    SOKOL_GPU_CULL_API_DECL     - public function declaration prefix (default: extern)
+    SOKOL_API_DECL              - same as SOKOL_GPU_CULL_API_DECL
+    SOKOL_API_IMPL              - public function implementation prefix (default: -)
+
+    If sokol_gpu_cull.h is compiled as a DLL, define the following before
+    including the declaration or implementation:
+
+    SOKOL_DLL
+
+    On Windows, SOKOL_DLL will define SOKOL_GPU_CULL_API_DECL as __declspec(dllexport)
+    or __declspec(dllimport) as needed.
+
+    Include the following headers before including sokol_gpu_cull.h:
+
+        sokol_gfx.h
+
+    FEATURES AND CONCEPTS
+    =====================
+    - a reusable compute stage which tests the bounding spheres of up to
+      a few million instances against the view frustum on the GPU
+    - the indices of the visible instances are written tightly packed into
+      a storage buffer, and the number of visible instances is written
+      into an indirect draw arguments buffer
+    - the following render pass renders the visible instances with a
+      single sg_draw_indirect() call, without a round trip to the CPU
+    - the vertex shader of the render pass looks up the visible instance
+      index by the builtin instance index, and reads the per-instance data
+      from its own storage buffer(s):
+
+            layout(binding=0) readonly buffer visible_buf { uint visible[]; };
+            layout(binding=1) readonly buffer instances_buf { instance_t instances[]; };
+            ...
+            instance_t inst = instances[visible[gl_InstanceIndex]];
+
+    - sokol_gpu_cull.h requires compute shader and indirect draw support,
+      check sg_query_features().draw_indirect
+
+    STEP BY STEP
+    ============
+    --- call scull_setup() after sg_setup():
+
+            sg_setup(&(sg_desc){ ... });
+            scull_setup(&(scull_desc_t){ .logger.func = slog_func });
+
+    --- create the three buffers used by the culling stage:
+
+        - a storage buffer with the instance bounding spheres, one vec4 per
+          instance with the sphere center in xyz and the radius in w
+        - a storage buffer which receives the visible instance indices, one
+          uint32_t per instance
+        - a buffer which receives the indirect draw arguments, this needs
+          both storage buffer and indirect buffer usage:
+
+            sg_buffer bounds_buf = sg_make_buffer(&(sg_buffer_desc){
+                .usage.storage_buffer = true,
+                .data = { bounds, num_instances * 4 * sizeof(float) },
+            });
+            sg_buffer visible_buf = sg_make_buffer(&(sg_buffer_desc){
+                .usage.storage_buffer = true,
+                .size = num_instances * sizeof(uint32_t),
+            });
+            sg_buffer args_buf = sg_make_buffer(&(sg_buffer_desc){
+                .usage = { .storage_buffer = true, .indirect_buffer = true },
+                .size = sizeof(sg_draw_indexed_indirect_args),
+            });
+
+    --- each frame, call scull_cull() inside a compute pass:
+
+            sg_begin_pass(&(sg_pass){ .compute = true });
+            scull_cull(&(scull_cull_desc){
+                .bounds = bounds_buf,
+                .visible = visible_buf,
+                .args = args_buf,
+                .num_instances = num_instances,
+                .view_proj = { ... },   // column-major view-projection matrix
+                .indexed = true,
+                .num_elements = 36,
+            });
+            sg_end_pass();
+
+        The .indexed, .num_elements, .base_element and .base_vertex items
+        are copied into the indirect draw arguments, .indexed must match
+        the index type of the render pipeline.
+
+        NOTE: scull_cull() applies its own compute pipeline, bindings and
+        uniforms, so you need to apply your own state again afterwards.
+
+    --- in the following render pass, render the visible instances:
+
+            sg_apply_pipeline(pip);
+            sg_apply_bindings(&(sg_bindings){
+                .vertex_buffers[0] = vbuf,
+                .index_buffer = ibuf,
+                .storage_buffers = {
+                    [SBUF_visible] = visible_buf,
+                    [SBUF_instances] = instances_buf,
+                },
+            });
+            sg_draw_indirect(args_buf, 0);
+
+    --- call scull_shutdown() before sg_shutdown():
+
+            scull_shutdown();
+            sg_shutdown();
+
+    LIMITATIONS
+    ===========
+    - the frustum planes are extracted from the view-projection matrix with
+      the OpenGL clip space convention (-w <= z <= w), with a D3D-style
+      projection matrix (0 <= z <= w) the near plane test is conservative
+      (e.g. some instances in front of the near plane are considered visible)
+    - the order of the visible instance indices is non-deterministic
+    - num_instances is limited to 65535 * 64 because of the max number of
+      compute workgroups per dispatch
+    - the arguments are always written to the start of the args buffer
+
+    ERROR REPORTING AND LOGGING
+    ===========================
+    To get any logging information at all you need to provide a logging callback in the setup call,
+    the easiest way is to use sokol_log.h:
+
+        #include "sokol_log.h"
+
+        scull_setup(&(scull_desc_t){
+            // ...
+            .logger.func = slog_func
+        });
+
+    LICENSE
+    =======
+    zlib/libpng license
+
+    Copyright (c) 2026 the Sectr fork contributors
+
+    This software is provided 'as-is', without any express or implied warranty.
+    In no event will the authors be held liable for any damages arising from the
+    use of this software.
+
+    Permission is granted to anyone to use this software for any purpose,
+    including commercial applications, and to alter it and redistribute it
+    freely, subject to the following restrictions:
+
+        1. The origin of this software must not be misrepresented; you must not
+        claim that you wrote the original software. If you use this software in a
+        product, an acknowledgment in the product documentation would be
+        appreciated but is not required.
+
+        2. Altered source versions must be plainly marked as such, and must not
+        be misrepresented as being the original software.
+
+        3. This notice may not be removed or altered from any source
+        distribution.
+*/
+import sg "../gfx"
+
+import "core:c"
+
+_ :: c
+
+SOKOL_DEBUG :: #config(SOKOL_DEBUG, ODIN_DEBUG)
+
+DEBUG :: #config(SOKOL_GPU_CULL_DEBUG, SOKOL_DEBUG)
+USE_GL :: #config(SOKOL_USE_GL, false)
+USE_DLL :: #config(SOKOL_DLL, true)
+
+when ODIN_OS == .Windows {
+    when USE_DLL {
+        when USE_GL {
+            when DEBUG { foreign import sokol_gpu_cull_clib { "../sokol_dll_windows_x64_gl_debug.lib" } }
+            else       { foreign import sokol_gpu_cull_clib { "../sokol_dll_windows_x64_gl_release.lib" } }
+        } else {
+            when DEBUG { foreign import sokol_gpu_cull_clib { "../sokol_dll_windows_x64_d3d11_debug.lib" } }
+            else       { foreign import sokol_gpu_cull_clib { "../sokol_dll_windows_x64_d3d11_release.lib" } }
+        }
+    } else {
+        when USE_GL {
+            when DEBUG { foreign import sokol_gpu_cull_clib { "sokol_gpu_cull_windows_x64_gl_debug.lib" } }
+            else       { foreign import sokol_gpu_cull_clib { "sokol_gpu_cull_windows_x64_gl_release.lib" } }
+        } else {
+            when DEBUG { foreign import sokol_gpu_cull_clib { "sokol_gpu_cull_windows_x64_d3d11_debug.lib" } }
+            else       { foreign import sokol_gpu_cull_clib { "sokol_gpu_cull_windows_x64_d3d11_release.lib" } }
+        }
+    }
+} else when ODIN_OS == .Darwin {
+    when USE_DLL {
+             when  USE_GL && ODIN_ARCH == .arm64 &&  DEBUG { foreign import sokol_gpu_cull_clib { "../dylib/sokol_dylib_macos_arm64_gl_debug.dylib" } }
+        else when  USE_GL && ODIN_ARCH == .arm64 && !DEBUG { foreign import sokol_gpu_cull_clib { "../dylib/sokol_dylib_macos_arm64_gl_release.dylib" } }
+        else when  USE_GL && ODIN_ARCH == .amd64 &&  DEBUG { foreign import sokol_gpu_cull_clib { "../dylib/sokol_dylib_macos_x64_gl_debug.dylib" } }
+        else when  USE_GL && ODIN_ARCH == .amd64 && !DEBUG { foreign import sokol_gpu_cull_clib { "../dylib/sokol_dylib_macos_x64_gl_release.dylib" } }
+        else when !USE_GL && ODIN_ARCH == .arm64 &&  DEBUG { foreign import sokol_gpu_cull_clib { "../dylib/sokol_dylib_macos_arm64_metal_debug.dylib" } }
+        else when !USE_GL && ODIN_ARCH == .arm64 && !DEBUG { foreign import sokol_gpu_cull_clib { "../dylib/sokol_dylib_macos_arm64_metal_release.dylib" } }
+        else when !USE_GL && ODIN_ARCH == .amd64 &&  DEBUG { foreign import sokol_gpu_cull_clib { "../dylib/sokol_dylib_macos_x64_metal_debug.dylib" } }
+        else when !USE_GL && ODIN_ARCH == .amd64 && !DEBUG { foreign import sokol_gpu_cull_clib { "../dylib/sokol_dylib_macos_x64_metal_release.dylib" } }
+    } else {
+        when USE_GL {
+            when ODIN_ARCH == .arm64 {
+                when DEBUG { foreign import sokol_gpu_cull_clib { "sokol_gpu_cull_macos_arm64_gl_debug.a" } }
+                else       { foreign import sokol_gpu_cull_clib { "sokol_gpu_cull_macos_arm64_gl_release.a" } }
+            } else {
+                when DEBUG { foreign import sokol_gpu_cull_clib { "sokol_gpu_cull_macos_x64_gl_debug.a" } }
+                else       { foreign import sokol_gpu_cull_clib { "sokol_gpu_cull_macos_x64_gl_release.a" } }
+            }
+        } else {
+            when ODIN_ARCH == .arm64 {
+                when DEBUG { foreign import sokol_gpu_cull_clib { "sokol_gpu_cull_macos_arm64_metal_debug.a" } }
+                else       { foreign import sokol_gpu_cull_clib { "sokol_gpu_cull_macos_arm64_metal_release.a" } }
+            } else {
+                when DEBUG { foreign import sokol_gpu_cull_clib { "sokol_gpu_cull_macos_x64_metal_debug.a" } }
+                else       { foreign import sokol_gpu_cull_clib { "sokol_gpu_cull_macos_x64_metal_release.a" } }
+            }
+        }
+    }
+} else when ODIN_OS == .Linux {
+    when USE_DLL {
+        when DEBUG { foreign import sokol_gpu_cull_clib { "sokol_gpu_cull_linux_x64_gl_debug.so" } }
+        else       { foreign import sokol_gpu_cull_clib { "sokol_gpu_cull_linux_x64_gl_release.so" } }
+    } else {
+        when DEBUG { foreign import sokol_gpu_cull_clib { "sokol_gpu_cull_linux_x64_gl_debug.a" } }
+        else       { foreign import sokol_gpu_cull_clib { "sokol_gpu_cull_linux_x64_gl_release.a" } }
+    }
+} else when ODIN_ARCH == .wasm32 || ODIN_ARCH == .wasm64p32 {
+    // Feed sokol_gpu_cull_wasm_gl_debug.a or sokol_gpu_cull_wasm_gl_release.a into emscripten compiler.
+    foreign import sokol_gpu_cull_clib { "env.o" }
+} else {
+    #panic("This OS is currently not supported")
+}
+
+@(default_calling_convention="c", link_prefix="scull_")
+foreign sokol_gpu_cull_clib {
+    // setup and shutdown
+    setup :: proc(#by_ptr desc: Desc)  ---
+    shutdown :: proc()  ---
+    // frustum-cull instances and write the indirect draw arguments (inside a compute pass)
+    cull :: proc(#by_ptr desc: Cull_Desc)  ---
+}
+
+Log_Item :: enum i32 {
+    OK,
+    NOT_SUPPORTED,
+    CREATE_SHADER_FAILED,
+    CREATE_PIPELINE_FAILED,
+    TOO_MANY_INSTANCES,
+}
+
+/*
+    scull_logger_t
+
+    Used in scull_desc_t to provide a custom logging and error reporting
+    callback to sokol-gpu-cull.
+*/
+Logger :: struct {
+    func : proc "c" (a0: cstring, a1: u32, a2: u32, a3: cstring, a4: u32, a5: cstring, a6: rawptr),
+    user_data : rawptr,
+}
+
+/*
+    scull_desc_t
+
+    Describes the culling stage setup parameters, passed to scull_setup().
+*/
+Desc :: struct {
+    logger : Logger,
+}
+
+/*
+    scull_cull_desc
+
+    Describes one culling dispatch, passed to scull_cull().
+*/
+Cull_Desc :: struct {
+    bounds : sg.Buffer,
+    visible : sg.Buffer,
+    args : sg.Buffer,
+    num_instances : c.int,
+    view_proj : [16]f32,
+    indexed : bool,
+    num_elements : c.int,
+    base_element : c.int,
+    base_vertex : c.int,
+}
+
@@ -0,0 +1,354 @@
+// machine generated, do not edit
+
+package sokol_profiler
+
+/*
+    sokol_profiler.h -- record CPU-side frame events and export them as Chrome trace JSON
+
+    Project URL: https://github.com/Ed94/SectrPrototype (Sectr fork of sokol-odin)
+
+    This header is an addition of the Sectr fork and is not part of the upstream
+    sokol headers (https://github.com/floooh/sokol), it follows their API conventions.
+
+    Do this:
+        #define SOKOL_IMPL or
+        #define SOKOL_PROFILER_IMPL
+    before you include this file in *one* C or C++ file to create the
+    implementation.
+
+    sokol_gfx.h must be compiled with SOKOL_TRACE_HOOKS defined, otherwise
+    no sokol_gfx.h events will be recorded (user scopes still work).
+
+    Optionally provide the following defines with your own implementations:
+
+    SOKOL_ASSERT(c)             - your own assert macro (default: assert(c))
+    SOKOL_PROFILER_API_DECL     - public function declaration prefix (default: extern)
+    SOKOL_API_DECL              - same as SOKOL_PROFILER_API_DECL
+    SOKOL_API_IMPL              - public function implementation prefix (default: -)
+
+    If sokol_profiler.h is compiled as a DLL, define the following before
+    including the declaration or implementation:
+
+    SOKOL_DLL
+
+    On Windows, SOKOL_DLL will define SOKOL_PROFILER_API_DECL as __declspec(dllexport)
+    or __declspec(dllimport) as needed.
+
+    Include the following headers before including sokol_profiler.h:
+
+        sokol_gfx.h
+        sokol_time.h
+
+    ...and optionally sokol_app.h to get sprof_wrap_sapp_desc().
+
+    FEATURES AND CONCEPTS
+    =====================
+    - records begin/end events with CPU timestamps into one ring buffer
+      per thread, recording doesn't take any locks, the oldest events
+      are overwritten when a ring buffer is full
+    - sokol_gfx.h passes and debug groups are recorded automatically
+      via the sokol_gfx.h trace hooks, since sokol_gl.h and sokol_debugtext.h
+      wrap their draw calls into debug groups this also records the
+      sgl_draw() and sdtx_draw() calls (sgp_flush() doesn't push a debug
+      group, see below)
+    - sg_commit() is recorded as an instant event
+    - the sokol_app.h init, frame and cleanup callbacks can be recorded
+      by wrapping the sapp_desc struct with sprof_wrap_sapp_desc()
+    - user scopes and instant events can be recorded from any thread
+    - the recorded events are exported as Chrome 'trace_event' JSON
+      which can be loaded into https://ui.perfetto.dev or chrome://tracing
+
+    STEP BY STEP
+    ============
+    --- call sprof_setup() after sg_setup() and stm_setup():
+
+            stm_setup();
+            sg_setup(&(sg_desc){ ... });
+            sprof_setup(&(sprof_desc_t){ .logger.func = slog_func });
+
+        sokol_profiler.h installs its own sokol_gfx.h trace hooks and calls
+        any previously installed trace hooks.
+
+        The following sprof_desc_t items can be provided:
+
+            .max_events     - the number of events in each per-thread
+                              ring buffer (default: 8192, rounded up
+                              to the next power of two)
+            .max_threads    - the max number of threads which record
+                              events (default: 32)
+
+    --- record your own scopes and instant events, these calls may happen
+        on any thread:
+
+            sprof_begin("update");
+            ...
+            sprof_end();
+            sprof_instant("level loaded");
+
+        Event names are copied, names longer than SPROF_MAX_NAME_LENGTH-1
+        characters are truncated. Calls to the recording functions are
+        silently ignored while sokol_profiler.h isn't set up.
+
+    --- sokol_gp.h (a third-party header) doesn't wrap sgp_flush() into a
+        debug group, to see it in the trace, wrap the call yourself:
+
+            sg_push_debug_group("sokol-gp");
+            sgp_flush();
+            sg_pop_debug_group();
+
+    --- optionally give the calling thread a name which shows up
+        in the trace viewer (call this once right at the start of a thread):
+
+            sprof_set_thread_name("worker 0");
+
+    --- to record the sokol_app.h callbacks, wrap the sapp_desc struct
+        returned from sokol_main():
+
+            sapp_desc sokol_main(int argc, char* argv[]) {
+                return sprof_wrap_sapp_desc(&(sapp_desc){
+                    .init_cb = init,
+                    .frame_cb = frame,
+                    .cleanup_cb = cleanup,
+                    ...
+                });
+            }
+
+        Note that the begin event of the init callback and the end event
+        of the cleanup callback are lost since sokol_profiler.h is set up
+        and shut down inside those callbacks.
+
+    --- to get the recorded events as Chrome trace JSON:
+
+            const sprof_range json = sprof_dump_json();
+            // ...write json.ptr/json.size to a file...
+
+        The returned data remains valid until the next call to
+        sprof_dump_json() or sprof_shutdown(). The dump contains the most
+        recent events of each thread and may be called while other threads
+        are recording (but it must not be called from several threads at
+        the same time).
+
+    --- to drop all events recorded so far (for instance to only
+        export the events of the next few frames) call:
+
+            sprof_clear();
+
+    --- call sprof_shutdown() before sg_shutdown(), all other threads must
+        have stopped recording at this point:
+
+            sprof_shutdown();
+            sg_shutdown();
+
+    ERROR REPORTING AND LOGGING
+    ===========================
+    To get any logging information at all you need to provide a logging callback in the setup call,
+    the easiest way is to use sokol_log.h:
+
+        #include "sokol_log.h"
+
+        sprof_setup(&(sprof_desc_t){
+            // ...
+            .logger.func = slog_func
+        });
+
+    NOTE that the logging callback may be called from any thread which
+    records events.
+
+    MEMORY ALLOCATION OVERRIDE
+    ==========================
+    You can override the memory allocation functions at initialization time
+    like this:
+
+        void* my_alloc(size_t size, void* user_data) {
+            return malloc(size);
+        }
+
+        void my_free(void* ptr, void* user_data) {
+            free(ptr);
+        }
+
+        ...
+            sprof_setup(&(sprof_desc_t){
+                // ...
+                .allocator = {
+                    .alloc_fn = my_alloc,
+                    .free_fn = my_free,
+                    .user_data = ...;
+                }
+            });
+        ...
+
+    If no overrides are provided, malloc and free will be used. The
+    ring buffer of a thread is allocated by the first event recorded
+    on that thread, so the alloc_fn must be thread-safe.
+
+    LICENSE
+    =======
+    zlib/libpng license
+
+    Copyright (c) 2026 the Sectr fork contributors
+
+    This software is provided 'as-is', without any express or implied warranty.
+    In no event will the authors be held liable for any damages arising from the
+    use of this software.
+
+    Permission is granted to anyone to use this software for any purpose,
+    including commercial applications, and to alter it and redistribute it
+    freely, subject to the following restrictions:
+
+        1. The origin of this software must not be misrepresented; you must not
+        claim that you wrote the original software. If you use this software in a
+        product, an acknowledgment in the product documentation would be
+        appreciated but is not required.
+
+        2. Altered source versions must be plainly marked as such, and must not
+        be misrepresented as being the original software.
+
+        3. This notice may not be removed or altered from any source
+        distribution.
+*/
+import sapp "../app"
+
+import "core:c"
+
+_ :: c
+
+SOKOL_DEBUG :: #config(SOKOL_DEBUG, ODIN_DEBUG)
+
+DEBUG :: #config(SOKOL_PROFILER_DEBUG, SOKOL_DEBUG)
+USE_GL :: #config(SOKOL_USE_GL, false)
+USE_DLL :: #config(SOKOL_DLL, true)
+
+when ODIN_OS == .Windows {
+    when USE_DLL {
+        when USE_GL {
+            when DEBUG { foreign import sokol_profiler_clib { "../sokol_dll_windows_x64_gl_debug.lib" } }
+            else       { foreign import sokol_profiler_clib { "../sokol_dll_windows_x64_gl_release.lib" } }
+        } else {
+            when DEBUG { foreign import sokol_profiler_clib { "../sokol_dll_windows_x64_d3d11_debug.lib" } }
+            else       { foreign import sokol_profiler_clib { "../sokol_dll_windows_x64_d3d11_release.lib" } }
+        }
+    } else {
+        when USE_GL {
+            when DEBUG { foreign import sokol_profiler_clib { "sokol_profiler_windows_x64_gl_debug.lib" } }
+            else       { foreign import sokol_profiler_clib { "sokol_profiler_windows_x64_gl_release.lib" } }
+        } else {
+            when DEBUG { foreign import sokol_profiler_clib { "sokol_profiler_windows_x64_d3d11_debug.lib" } }
+            else       { foreign import sokol_profiler_clib { "sokol_profiler_windows_x64_d3d11_release.lib" } }
+        }
+    }
+} else when ODIN_OS == .Darwin {
+    when USE_DLL {
+             when  USE_GL && ODIN_ARCH == .arm64 &&  DEBUG { foreign import sokol_profiler_clib { "../dylib/sokol_dylib_macos_arm64_gl_debug.dylib" } }
+        else when  USE_GL && ODIN_ARCH == .arm64 && !DEBUG { foreign import sokol_profiler_clib { "../dylib/sokol_dylib_macos_arm64_gl_release.dylib" } }
+        else when  USE_GL && ODIN_ARCH == .amd64 &&  DEBUG { foreign import sokol_profiler_clib { "../dylib/sokol_dylib_macos_x64_gl_debug.dylib" } }
+        else when  USE_GL && ODIN_ARCH == .amd64 && !DEBUG { foreign import sokol_profiler_clib { "../dylib/sokol_dylib_macos_x64_gl_release.dylib" } }
+        else when !USE_GL && ODIN_ARCH == .arm64 &&  DEBUG { foreign import sokol_profiler_clib { "../dylib/sokol_dylib_macos_arm64_metal_debug.dylib" } }
+        else when !USE_GL && ODIN_ARCH == .arm64 && !DEBUG { foreign import sokol_profiler_clib { "../dylib/sokol_dylib_macos_arm64_metal_release.dylib" } }
+        else when !USE_GL && ODIN_ARCH == .amd64 &&  DEBUG { foreign import sokol_profiler_clib { "../dylib/sokol_dylib_macos_x64_metal_debug.dylib" } }
+        else when !USE_GL && ODIN_ARCH == .amd64 && !DEBUG { foreign import sokol_profiler_clib { "../dylib/sokol_dylib_macos_x64_metal_release.dylib" } }
+    } else {
+        when USE_GL {
+            when ODIN_ARCH == .arm64 {
+                when DEBUG { foreign import sokol_profiler_clib { "sokol_profiler_macos_arm64_gl_debug.a" } }
+                else       { foreign import sokol_profiler_clib { "sokol_profiler_macos_arm64_gl_release.a" } }
+            } else {
+                when DEBUG { foreign import sokol_profiler_clib { "sokol_profiler_macos_x64_gl_debug.a" } }
+                else       { foreign import sokol_profiler_clib { "sokol_profiler_macos_x64_gl_release.a" } }
+            }
+        } else {
+            when ODIN_ARCH == .arm64 {
+                when DEBUG { foreign import sokol_profiler_clib { "sokol_profiler_macos_arm64_metal_debug.a" } }
+                else       { foreign import sokol_profiler_clib { "sokol_profiler_macos_arm64_metal_release.a" } }
+            } else {
+                when DEBUG { foreign import sokol_profiler_clib { "sokol_profiler_macos_x64_metal_debug.a" } }
+                else       { foreign import sokol_profiler_clib { "sokol_profiler_macos_x64_metal_release.a" } }
+            }
+        }
+    }
+} else when ODIN_OS == .Linux {
+    when USE_DLL {
+        when DEBUG { foreign import sokol_profiler_clib { "sokol_profiler_linux_x64_gl_debug.so" } }
+        else       { foreign import sokol_profiler_clib { "sokol_profiler_linux_x64_gl_release.so" } }
+    } else {
+        when DEBUG { foreign import sokol_profiler_clib { "sokol_profiler_linux_x64_gl_debug.a" } }
+        else       { foreign import sokol_profiler_clib { "sokol_profiler_linux_x64_gl_release.a" } }
+    }
+} else when ODIN_ARCH == .wasm32 || ODIN_ARCH == .wasm64p32 {
+    // Feed sokol_profiler_wasm_gl_debug.a or sokol_profiler_wasm_gl_release.a into emscripten compiler.
+    foreign import sokol_profiler_clib { "env.o" }
+} else {
+    #panic("This OS is currently not supported")
+}
+
+@(default_calling_convention="c", link_prefix="sprof_")
+foreign sokol_profiler_clib {
+    // setup and shutdown
+    setup :: proc(#by_ptr desc: Desc)  ---
+    shutdown :: proc()  ---
+    // recording (may be called from any thread)
+    begin :: proc(name: cstring)  ---
+    end :: proc()  ---
+    instant :: proc(name: cstring)  ---
+    set_thread_name :: proc(name: cstring)  ---
+    // exporting
+    clear :: proc()  ---
+    dump_json :: proc() -> Range ---
+    // wrap the sokol_app.h callbacks into profiler scopes
+    wrap_sapp_desc :: proc(#by_ptr desc: sapp.Desc) -> sapp.Desc ---
+}
+
+MAX_NAME_LENGTH :: 32
+
+Log_Item :: enum i32 {
+    OK,
+    MALLOC_FAILED,
+    TOO_MANY_THREADS,
+}
+
+/*
+    sprof_logger_t
+
+    Used in sprof_desc_t to provide a custom logging and error reporting
+    callback to sokol-profiler.
+*/
+Logger :: struct {
+    func : proc "c" (a0: cstring, a1: u32, a2: u32, a3: cstring, a4: u32, a5: cstring, a6: rawptr),
+    user_data : rawptr,
+}
+
+/*
+    sprof_allocator_t
+
+    Used in sprof_desc_t to provide custom memory-alloc and -free functions
+    to sokol_profiler.h. If memory management should be overridden, both the
+    alloc_fn and free_fn function must be provided (e.g. it's not valid to
+    override one function but not the other).
+*/
+Allocator :: struct {
+    alloc_fn : proc "c" (a0: c.size_t, a1: rawptr) -> rawptr,
+    free_fn : proc "c" (a0: rawptr, a1: rawptr),
+    user_data : rawptr,
+}
+
+/*
+    sprof_range is a pointer-size-pair struct used to pass
+    the exported JSON data out of sokol-profiler.
+*/
+Range :: struct {
+    ptr : rawptr,
+    size : c.size_t,
+}
+
+/*
+    sprof_desc_t
+
+    Describes the profiler setup parameters, passed to sprof_setup().
+*/
+Desc :: struct {
+    max_events : c.int,
+    max_threads : c.int,
+    allocator : Allocator,
+    logger : Logger,
+}
+
@@ -0,0 +1,437 @@
+// machine generated, do not edit
+
+package sokol_render_graph
+
+/*
+    sokol_render_graph.h -- declare render passes per frame, with pooled transient render targets
+
+    Project URL: https://github.com/Ed94/SectrPrototype (Sectr fork of sokol-odin)
+
+    This header is an addition of the Sectr fork and is not part of the upstream
+    sokol headers (https://github.com/floooh/sokol), it follows their API conventions.
+
+    Do this:
+        #define SOKOL_IMPL or
+        #define SOKOL_RENDER_GRAPH_IMPL
+    before you include this file in *one* C or C++ file to create the
+    implementation.
+
+    Optionally provide the following defines with your own implementations:
+
+    SOKOL_ASSERT(c)             - your own assert macro (default: assert(c))
+    SOKOL_RENDER_GRAPH_API_DECL - public function declaration prefix (default: extern)
+    SOKOL_API_DECL              - same as SOKOL_RENDER_GRAPH_API_DECL
+    SOKOL_API_IMPL              - public function implementation prefix (default: -)
+
+    If sokol_render_graph.h is compiled as a DLL, define the following before
+    including the declaration or implementation:
+
+    SOKOL_DLL
+
+    On Windows, SOKOL_DLL will define SOKOL_RENDER_GRAPH_API_DECL as __declspec(dllexport)
+    or __declspec(dllimport) as needed.
+
+    Include the following headers before including sokol_render_graph.h:
+
+        sokol_gfx.h
+
+    FEATURES AND CONCEPTS
+    =====================
+    - each frame, declare the render passes of the frame together with
+      the textures each pass renders into and the textures it samples
+    - textures are either transient (declared per frame, the render graph
+      provides the actual sokol_gfx.h image), or imported (an existing
+      sg_image owned by the application)
+    - passes which don't contribute to the final frame are culled: a pass
+      is kept if it renders to the swapchain, renders into an imported
+      texture, is flagged as 'never_cull', or renders into a texture
+      which is later read by a pass that is kept
+    - the lifetime of each transient texture is computed (from the first
+      to the last kept pass using the texture), and transient textures
+      with non-overlapping lifetimes share the same sokol_gfx.h image
+      (as long as they have the same size, pixel format and sample count)
+    - the pooled images and the sg_attachments objects for the passes
+      are kept across frames and are only destroyed when they haven't been
+      used for a number of frames, so that a window resize doesn't require
+      any manual resource management
+
+    STEP BY STEP
+    ============
+    --- call srg_setup() after sg_setup():
+
+            sg_setup(&(sg_desc){ ... });
+            srg_setup(&(srg_desc_t){ .logger.func = slog_func });
+
+        The following srg_desc_t items can be provided to override
+        the default pool sizes:
+
+            .max_passes         - max number of declared passes per frame (default: 64)
+            .max_textures       - max number of declared textures per frame (default: 128)
+            .max_images         - max number of pooled images (default: 64)
+            .max_attachments    - max number of pooled sg_attachments objects (default: 64)
+            .max_unused_frames  - pooled resources which haven't been used for
+                                  this number of frames are destroyed (default: 8)
+
+    --- each frame, start declaring the render graph with:
+
+            srg_begin_frame();
+
+    --- declare transient textures (note that no sokol_gfx.h image is
+        created at this point):
+
+            srg_texture color = srg_make_texture(&(srg_texture_desc){
+                .width = w,
+                .height = h,
+                .label = "scene-color",
+            });
+            srg_texture depth = srg_make_texture(&(srg_texture_desc){
+                .width = w,
+                .height = h,
+                .pixel_format = SG_PIXELFORMAT_DEPTH,
+            });
+
+        The pixel format defaults to sg_desc.environment.defaults.color_format,
+        the sample count defaults to 1.
+
+    --- ...or import an existing image which has been created with
+        'usage.render_attachment = true' (for instance to keep rendering
+        results across frames):
+
+            srg_texture history = srg_import_image(state.history_img);
+
+    --- declare the passes of the frame in execution order, with the
+        textures each pass renders into and the textures it reads:
+
+            srg_add_pass(&(srg_pass_desc){
+                .action = { .colors[0] = { .load_action = SG_LOADACTION_CLEAR } },
+                .colors[0] = color,
+                .depth_stencil = depth,
+                .exec_cb = draw_scene,
+                .label = "scene",
+            });
+            srg_add_pass(&(srg_pass_desc){
+                .swapchain = sglue_swapchain(),
+                .reads[0] = color,
+                .exec_cb = draw_postfx,
+                .label = "postfx",
+            });
+
+        A render pass without any color- or depth-stencil-attachments
+        renders into the swapchain. A pass with '.compute = true' is a compute
+        pass, compute passes can read textures but not render into
+        them, and are never culled.
+
+        Between sg_begin_pass() and sg_end_pass() the render graph calls the
+        exec_cb callback with the pass handle and the user_data from
+        srg_pass_desc. In the callback, get the sokol_gfx.h image of
+        a texture to bind it as shader resource with:
+
+            sg_image img = srg_get_image(color);
+
+        The returned image is only valid during the callbacks of the
+        current frame, since the same image may be used for a different
+        transient texture by other passes or in the next frame.
+
+        All passes and textures are only valid until the next srg_begin_frame().
+
+    --- finally call:
+
+            srg_end_frame();
+
+        ...this culls unused passes, assigns pooled images to the transient
+        textures, and executes the remaining passes in the order they
+        have been declared. srg_end_frame() must be called outside
+        of a sokol_gfx.h pass and before sg_commit().
+
+    --- to inspect the result of the last srg_end_frame() call:
+
+            srg_frame_info info = srg_query_frame_info();
+
+        ...this includes the number of culled passes and the total size
+        of all transient textures compared to the size of the pooled
+        images which were actually used.
+
+    --- call srg_shutdown() before sg_shutdown(), this destroys all
+        pooled resources:
+
+            srg_shutdown();
+            sg_shutdown();
+
+    LIMITATIONS
+    ===========
+    - sokol_gfx.h doesn't expose GPU memory heaps, so transient textures
+      can only share an image when they have exactly the same size, pixel
+      format and sample count
+    - only 2D textures without mipmaps can be transient textures
+    - storage attachments in compute passes are not supported
+
+    ERROR REPORTING AND LOGGING
+    ===========================
+    To get any logging information at all you need to provide a logging callback in the setup call,
+    the easiest way is to use sokol_log.h:
+
+        #include "sokol_log.h"
+
+        srg_setup(&(srg_desc_t){
+            // ...
+            .logger.func = slog_func
+        });
+
+    MEMORY ALLOCATION OVERRIDE
+    ==========================
+    You can override the memory allocation functions at initialization time
+    like this:
+
+        void* my_alloc(size_t size, void* user_data) {
+            return malloc(size);
+        }
+
+        void my_free(void* ptr, void* user_data) {
+            free(ptr);
+        }
+
+        ...
+            srg_setup(&(srg_desc_t){
+                // ...
+                .allocator = {
+                    .alloc_fn = my_alloc,
+                    .free_fn = my_free,
+                    .user_data = ...;
+                }
+            });
+        ...
+
+    If no overrides are provided, malloc and free will be used.
+
+    LICENSE
+    =======
+    zlib/libpng license
+
+    Copyright (c) 2026 the Sectr fork contributors
+
+    This software is provided 'as-is', without any express or implied warranty.
+    In no event will the authors be held liable for any damages arising from the
+    use of this software.
+
+    Permission is granted to anyone to use this software for any purpose,
+    including commercial applications, and to alter it and redistribute it
+    freely, subject to the following restrictions:
+
+        1. The origin of this software must not be misrepresented; you must not
+        claim that you wrote the original software. If you use this software in a
+        product, an acknowledgment in the product documentation would be
+        appreciated but is not required.
+
+        2. Altered source versions must be plainly marked as such, and must not
+        be misrepresented as being the original software.
+
+        3. This notice may not be removed or altered from any source
+        distribution.
+*/
+import sg "../gfx"
+
+import "core:c"
+
+_ :: c
+
+SOKOL_DEBUG :: #config(SOKOL_DEBUG, ODIN_DEBUG)
+
+DEBUG :: #config(SOKOL_RENDER_GRAPH_DEBUG, SOKOL_DEBUG)
+USE_GL :: #config(SOKOL_USE_GL, false)
+USE_DLL :: #config(SOKOL_DLL, true)
+
+when ODIN_OS == .Windows {
+    when USE_DLL {
+        when USE_GL {
+            when DEBUG { foreign import sokol_render_graph_clib { "../sokol_dll_windows_x64_gl_debug.lib" } }
+            else       { foreign import sokol_render_graph_clib { "../sokol_dll_windows_x64_gl_release.lib" } }
+        } else {
+            when DEBUG { foreign import sokol_render_graph_clib { "../sokol_dll_windows_x64_d3d11_debug.lib" } }
+            else       { foreign import sokol_render_graph_clib { "../sokol_dll_windows_x64_d3d11_release.lib" } }
+        }
+    } else {
+        when USE_GL {
+            when DEBUG { foreign import sokol_render_graph_clib { "sokol_render_graph_windows_x64_gl_debug.lib" } }
+            else       { foreign import sokol_render_graph_clib { "sokol_render_graph_windows_x64_gl_release.lib" } }
+        } else {
+            when DEBUG { foreign import sokol_render_graph_clib { "sokol_render_graph_windows_x64_d3d11_debug.lib" } }
+            else       { foreign import sokol_render_graph_clib { "sokol_render_graph_windows_x64_d3d11_release.lib" } }
+        }
+    }
+} else when ODIN_OS == .Darwin {
+    when USE_DLL {
+             when  USE_GL && ODIN_ARCH == .arm64 &&  DEBUG { foreign import sokol_render_graph_clib { "../dylib/sokol_dylib_macos_arm64_gl_debug.dylib" } }
+        else when  USE_GL && ODIN_ARCH == .arm64 && !DEBUG { foreign import sokol_render_graph_clib { "../dylib/sokol_dylib_macos_arm64_gl_release.dylib" } }
+        else when  USE_GL && ODIN_ARCH == .amd64 &&  DEBUG { foreign import sokol_render_graph_clib { "../dylib/sokol_dylib_macos_x64_gl_debug.dylib" } }
+        else when  USE_GL && ODIN_ARCH == .amd64 && !DEBUG { foreign import sokol_render_graph_clib { "../dylib/sokol_dylib_macos_x64_gl_release.dylib" } }
+        else when !USE_GL && ODIN_ARCH == .arm64 &&  DEBUG { foreign import sokol_render_graph_clib { "../dylib/sokol_dylib_macos_arm64_metal_debug.dylib" } }
+        else when !USE_GL && ODIN_ARCH == .arm64 && !DEBUG { foreign import sokol_render_graph_clib { "../dylib/sokol_dylib_macos_arm64_metal_release.dylib" } }
+        else when !USE_GL && ODIN_ARCH == .amd64 &&  DEBUG { foreign import sokol_render_graph_clib { "../dylib/sokol_dylib_macos_x64_metal_debug.dylib" } }
+        else when !USE_GL && ODIN_ARCH == .amd64 && !DEBUG { foreign import sokol_render_graph_clib { "../dylib/sokol_dylib_macos_x64_metal_release.dylib" } }
+    } else {
+        when USE_GL {
+            when ODIN_ARCH == .arm64 {
+                when DEBUG { foreign import sokol_render_graph_clib { "sokol_render_graph_macos_arm64_gl_debug.a" } }
+                else       { foreign import sokol_render_graph_clib { "sokol_render_graph_macos_arm64_gl_release.a" } }
+            } else {
+                when DEBUG { foreign import sokol_render_graph_clib { "sokol_render_graph_macos_x64_gl_debug.a" } }
+                else       { foreign import sokol_render_graph_clib { "sokol_render_graph_macos_x64_gl_release.a" } }
+            }
+        } else {
+            when ODIN_ARCH == .arm64 {
+                when DEBUG { foreign import sokol_render_graph_clib { "sokol_render_graph_macos_arm64_metal_debug.a" } }
+                else       { foreign import sokol_render_graph_clib { "sokol_render_graph_macos_arm64_metal_release.a" } }
+            } else {
+                when DEBUG { foreign import sokol_render_graph_clib { "sokol_render_graph_macos_x64_metal_debug.a" } }
+                else       { foreign import sokol_render_graph_clib { "sokol_render_graph_macos_x64_metal_release.a" } }
+            }
+        }
+    }
+} else when ODIN_OS == .Linux {
+    when USE_DLL {
+        when DEBUG { foreign import sokol_render_graph_clib { "sokol_render_graph_linux_x64_gl_debug.so" } }
+        else       { foreign import sokol_render_graph_clib { "sokol_render_graph_linux_x64_gl_release.so" } }
+    } else {
+        when DEBUG { foreign import sokol_render_graph_clib { "sokol_render_graph_linux_x64_gl_debug.a" } }
+        else       { foreign import sokol_render_graph_clib { "sokol_render_graph_linux_x64_gl_release.a" } }
+    }
+} else when ODIN_ARCH == .wasm32 || ODIN_ARCH == .wasm64p32 {
+    // Feed sokol_render_graph_wasm_gl_debug.a or sokol_render_graph_wasm_gl_release.a into emscripten compiler.
+    foreign import sokol_render_graph_clib { "env.o" }
+} else {
+    #panic("This OS is currently not supported")
+}
+
+@(default_calling_convention="c", link_prefix="srg_")
+foreign sokol_render_graph_clib {
+    // setup and shutdown
+    setup :: proc(#by_ptr desc: Desc)  ---
+    shutdown :: proc()  ---
+    // declare and execute a frame
+    begin_frame :: proc()  ---
+    make_texture :: proc(#by_ptr desc: Texture_Desc) -> Texture ---
+    import_image :: proc(img: sg.Image) -> Texture ---
+    add_pass :: proc(#by_ptr desc: Pass_Desc) -> Pass ---
+    end_frame :: proc()  ---
+    // get the sokol_gfx.h image of a texture (only valid inside pass callbacks)
+    get_image :: proc(tex: Texture) -> sg.Image ---
+    // statistics
+    query_frame_info :: proc() -> Frame_Info ---
+}
+
+MAX_PASS_READS :: 16
+
+/*
+    srg_texture and srg_pass are per-frame handles, they are only
+    valid until the next call to srg_begin_frame()
+*/
+Texture :: struct {
+    id : u32,
+}
+
+Pass :: struct {
+    id : u32,
+}
+
+Log_Item :: enum i32 {
+    OK,
+    MALLOC_FAILED,
+    PASSES_EXHAUSTED,
+    TEXTURES_EXHAUSTED,
+    IMAGE_POOL_EXHAUSTED,
+    ATTACHMENTS_POOL_EXHAUSTED,
+    MAKE_IMAGE_FAILED,
+    MAKE_ATTACHMENTS_FAILED,
+    TEXTURE_READ_BEFORE_WRITE,
+}
+
+/*
+    srg_logger_t
+
+    Used in srg_desc_t to provide a custom logging and error reporting
+    callback to sokol-render-graph.
+*/
+Logger :: struct {
+    func : proc "c" (a0: cstring, a1: u32, a2: u32, a3: cstring, a4: u32, a5: cstring, a6: rawptr),
+    user_data : rawptr,
+}
+
+/*
+    srg_allocator_t
+
+    Used in srg_desc_t to provide custom memory-alloc and -free functions
+    to sokol_render_graph.h. If memory management should be overridden, both
+    the alloc_fn and free_fn function must be provided (e.g. it's not valid
+    to override one function but not the other).
+*/
+Allocator :: struct {
+    alloc_fn : proc "c" (a0: c.size_t, a1: rawptr) -> rawptr,
+    free_fn : proc "c" (a0: rawptr, a1: rawptr),
+    user_data : rawptr,
+}
+
+/*
+    srg_desc_t
+
+    Describes the render graph setup parameters, passed to srg_setup().
+*/
+Desc :: struct {
+    max_passes : c.int,
+    max_textures : c.int,
+    max_images : c.int,
+    max_attachments : c.int,
+    max_unused_frames : c.int,
+    allocator : Allocator,
+    logger : Logger,
+}
+
+/*
+    srg_texture_desc
+
+    Describes a transient texture, passed to srg_make_texture().
+*/
+Texture_Desc :: struct {
+    width : c.int,
+    height : c.int,
+    pixel_format : sg.Pixel_Format,
+    sample_count : c.int,
+    label : cstring,
+}
+
+/*
+    srg_pass_desc
+
+    Describes a pass, passed to srg_add_pass(). A render pass without
+    color- and depth-stencil-attachments renders into the swapchain.
+*/
+Pass_Desc :: struct {
+    compute : bool,
+    never_cull : bool,
+    action : sg.Pass_Action,
+    colors : [4]Texture,
+    resolves : [4]Texture,
+    depth_stencil : Texture,
+    reads : [16]Texture,
+    swapchain : sg.Swapchain,
+    exec_cb : proc "c" (a0: Pass, a1: rawptr),
+    user_data : rawptr,
+    label : cstring,
+}
+
+/*
+    srg_frame_info
+
+    Statistics of the last srg_end_frame() call, returned
+    by srg_query_frame_info().
+*/
+Frame_Info :: struct {
+    num_passes : c.int,
+    num_culled_passes : c.int,
+    num_transient_textures : c.int,
+    num_used_images : c.int,
+    num_created_images : c.int,
+    num_pooled_images : c.int,
+    transient_bytes : u64,
+    used_image_bytes : u64,
+}
+
@@ -333,6 +333,64 @@ package sokol_shape
     sg_draw(green_cube.base_element, green_cube.num_elements, 1);
     ```
 
+    BUILDING SHAPES ON MULTIPLE THREADS
+    ===================================
+    When building a lot of shapes (or very big shapes) at load time, the
+    work can be distributed across your own worker threads (sokol_shape.h
+    doesn't create any threads itself). This happens in two steps:
+
+    First, on a single thread, reserve space for all shapes in the vertex-
+    and index-buffers. The reserve functions do the same validation and
+    bookkeeping as the build functions, but don't generate any data. Keep
+    the buffer state *before* each reserve call around, together with the
+    shape parameters:
+
+    ```c
+    typedef struct { sshape_buffer_t buf; sshape_sphere_t params; } job_t;
+    job_t jobs[NUM_SHAPES];
+
+    sshape_buffer_t buf = { ... };
+    for (int i = 0; i < NUM_SHAPES; i++) {
+        jobs[i].buf = buf;
+        jobs[i].params = (sshape_sphere_t){ ... };
+        buf = sshape_reserve_sphere(&buf, &jobs[i].params);
+        sshape_element_range_t elms = sshape_element_range(&buf);   // optional
+    }
+    assert(buf.valid);
+    ```
+
+    Then, on any thread, generate the shape data:
+
+    ```c
+    sshape_build_sphere_part(&jobs[i].buf, &jobs[i].params, part, num_parts);
+    ```
+
+    Each shape is split into 'num_parts' parts (for instance one per worker
+    thread) along its stacks, sides or tile rows, and each part writes
+    into a separate region of the vertex- and index-buffers, so that
+    different parts of the same shape and different shapes can be built
+    concurrently without any synchronization. Use part = 0 and num_parts = 1
+    to build a complete shape on one thread. The result is identical to
+    calling the regular build function, including random colors (the
+    random color sequence is restarted from a hash of the row index at
+    each vertex row, so no part depends on the rows before it).
+
+    The following functions are available:
+
+    ```c
+    sshape_buffer_t sshape_reserve_plane(const sshape_buffer_t* buf, const sshape_plane_t* params);
+    sshape_buffer_t sshape_reserve_box(const sshape_buffer_t* buf, const sshape_box_t* params);
+    sshape_buffer_t sshape_reserve_sphere(const sshape_buffer_t* buf, const sshape_sphere_t* params);
+    sshape_buffer_t sshape_reserve_cylinder(const sshape_buffer_t* buf, const sshape_cylinder_t* params);
+    sshape_buffer_t sshape_reserve_torus(const sshape_buffer_t* buf, const sshape_torus_t* params);
+
+    void sshape_build_plane_part(const sshape_buffer_t* buf, const sshape_plane_t* params, uint32_t part, uint32_t num_parts);
+    void sshape_build_box_part(const sshape_buffer_t* buf, const sshape_box_t* params, uint32_t part, uint32_t num_parts);
+    void sshape_build_sphere_part(const sshape_buffer_t* buf, const sshape_sphere_t* params, uint32_t part, uint32_t num_parts);
+    void sshape_build_cylinder_part(const sshape_buffer_t* buf, const sshape_cylinder_t* params, uint32_t part, uint32_t num_parts);
+    void sshape_build_torus_part(const sshape_buffer_t* buf, const sshape_torus_t* params, uint32_t part, uint32_t num_parts);
+    ```
+
     ...that's about all :)
 
     LICENSE
@@ -443,6 +501,18 @@ foreign sokol_shape_clib {
     build_sphere :: proc(#by_ptr buf: Buffer, #by_ptr params: Sphere) -> Buffer ---
     build_cylinder :: proc(#by_ptr buf: Buffer, #by_ptr params: Cylinder) -> Buffer ---
     build_torus :: proc(#by_ptr buf: Buffer, #by_ptr params: Torus) -> Buffer ---
+    // reserve buffer space for a shape without generating any data (for building shapes in parts on multiple threads)
+    reserve_plane :: proc(#by_ptr buf: Buffer, #by_ptr params: Plane) -> Buffer ---
+    reserve_box :: proc(#by_ptr buf: Buffer, #by_ptr params: Box) -> Buffer ---
+    reserve_sphere :: proc(#by_ptr buf: Buffer, #by_ptr params: Sphere) -> Buffer ---
+    reserve_cylinder :: proc(#by_ptr buf: Buffer, #by_ptr params: Cylinder) -> Buffer ---
+    reserve_torus :: proc(#by_ptr buf: Buffer, #by_ptr params: Torus) -> Buffer ---
+    // generate one of 'num_parts' parts of a reserved shape, 'buf' is the buffer state passed into the reserve function
+    build_plane_part :: proc(#by_ptr buf: Buffer, #by_ptr params: Plane, part: u32, num_parts: u32)  ---
+    build_box_part :: proc(#by_ptr buf: Buffer, #by_ptr params: Box, part: u32, num_parts: u32)  ---
+    build_sphere_part :: proc(#by_ptr buf: Buffer, #by_ptr params: Sphere, part: u32, num_parts: u32)  ---
+    build_cylinder_part :: proc(#by_ptr buf: Buffer, #by_ptr params: Cylinder, part: u32, num_parts: u32)  ---
+    build_torus_part :: proc(#by_ptr buf: Buffer, #by_ptr params: Torus, part: u32, num_parts: u32)  ---
     // query required vertex- and index-buffer sizes in bytes
     plane_sizes :: proc(tiles: u32) -> Sizes ---
     box_sizes :: proc(tiles: u32) -> Sizes ---
@@ -0,0 +1,131 @@
+//------------------------------------------------------------------------------
+//  sokol_gfx_trace_test.c
+//
+//  Captures and replays deduplicated pipelines with the dummy backend and
+//  checks that the replay only destroys a pipeline with its last DESTROY.
+//
+//  cc -pthread -Isokol/c tests/sokol_gfx_trace_test.c -o trace_test && ./trace_test
+//------------------------------------------------------------------------------
+#define SOKOL_IMPL
+#define SOKOL_DUMMY_BACKEND
+#define SOKOL_TRACE_HOOKS
+#define SOKOL_VALIDATE_NON_FATAL
+#include "sokol_gfx.h"
+#include "sokol_gfx_trace.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static int num_errors;
+
+static void log_func(const char* tag, uint32_t log_level, uint32_t log_item_id, const char* message, uint32_t line_nr, const char* filename, void* user_data) {
+    (void)log_item_id; (void)line_nr; (void)filename; (void)user_data;
+    if (log_level <= 1) {
+        num_errors++;
+        printf("  [%s] %s\n", tag, message ? message : "");
+    }
+}
+
+static sg_swapchain swapchain(void) {
+    return (sg_swapchain){
+        .width = 64,
+        .height = 64,
+        .sample_count = 1,
+        .color_format = SG_PIXELFORMAT_RGBA8,
+        .depth_format = SG_PIXELFORMAT_DEPTH_STENCIL,
+    };
+}
+
+static void setup(bool dedup) {
+    sg_setup(&(sg_desc){
+        .dedup_pipelines = dedup,
+        .environment.defaults = {
+            .color_format = SG_PIXELFORMAT_RGBA8,
+            .depth_format = SG_PIXELFORMAT_DEPTH_STENCIL,
+            .sample_count = 1,
+        },
+        .logger.func = log_func,
+    });
+}
+
+static sg_pipeline make_pipeline(sg_shader shd) {
+    return sg_make_pipeline(&(sg_pipeline_desc){ .shader = shd });
+}
+
+static void draw(sg_pipeline pip) {
+    sg_begin_pass(&(sg_pass){ .swapchain = swapchain() });
+    sg_apply_pipeline(pip);
+    sg_draw(0, 3, 1);
+    sg_end_pass();
+}
+
+// capture 2 frames, with the pipeline made twice before (prologue) or inside the capture
+static sgtrace_range capture(bool in_prologue) {
+    setup(true);
+    sgtrace_setup(&(sgtrace_desc_t){ .logger.func = log_func });
+    sg_shader shd = sg_make_shader(&(sg_shader_desc){ .vertex_func.source = "vs", .fragment_func.source = "fs" });
+    sg_pipeline pip0 = { SG_INVALID_ID };
+    sg_pipeline pip1 = { SG_INVALID_ID };
+    if (in_prologue) {
+        pip0 = make_pipeline(shd);
+        pip1 = make_pipeline(shd);
+    }
+    sgtrace_begin_capture(2);
+    sg_commit();
+    if (!in_prologue) {
+        pip0 = make_pipeline(shd);
+        pip1 = make_pipeline(shd);
+    }
+    if (pip0.id != pip1.id) {
+        printf("  pipelines not deduplicated\n");
+        num_errors++;
+    }
+    // the first destroy only drops a reference, the pipeline must remain usable
+    sg_destroy_pipeline(pip0);
+    draw(pip1);
+    sg_commit();
+    draw(pip1);
+    sg_destroy_pipeline(pip1);
+    sg_commit();
+    const sgtrace_range cap = sgtrace_get_capture();
+    sgtrace_range copy = { 0, 0 };
+    if (sgtrace_capture_ready()) {
+        copy.ptr = malloc(cap.size);
+        memcpy((void*)copy.ptr, cap.ptr, cap.size);
+        copy.size = cap.size;
+    } else {
+        printf("  capture not ready\n");
+        num_errors++;
+    }
+    sgtrace_shutdown();
+    sg_shutdown();
+    return copy;
+}
+
+static void replay(sgtrace_range data, bool dedup) {
+    setup(dedup);
+    if (sgtrace_begin_replay(&(sgtrace_replay_desc_t){ .data = data, .logger.func = log_func })) {
+        // replay twice to also cover the rewind
+        for (int i = 0; i < (2 * sgtrace_replay_num_frames()); i++) {
+            sgtrace_replay_frame(swapchain());
+            sg_commit();
+        }
+        sgtrace_end_replay();
+    } else {
+        num_errors++;
+    }
+    sg_shutdown();
+}
+
+int main(void) {
+    for (int in_prologue = 0; in_prologue < 2; in_prologue++) {
+        sgtrace_range data = capture(0 != in_prologue);
+        for (int dedup = 0; dedup < 2; dedup++) {
+            printf("%s, replay dedup %s\n", in_prologue ? "prologue" : "in frame", dedup ? "on" : "off");
+            replay(data, 0 != dedup);
+        }
+        free((void*)data.ptr);
+    }
+    printf("%s (%d errors)\n", (num_errors == 0) ? "OK" : "FAILED", num_errors);
+    return (num_errors == 0) ? 0 : 1;
+}